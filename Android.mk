@@ -9,6 +9,7 @@ LOCAL_MODULE := libdeqp
 LOCAL_SRC_FILES := \
 	execserver/xsDefs.cpp \
 	execserver/xsExecutionServer.cpp \
+	execserver/xsForkServerTestProcess.cpp \
 	execserver/xsPosixFileReader.cpp \
 	execserver/xsPosixTestProcess.cpp \
 	execserver/xsProtocol.cpp \
@@ -18,14 +19,18 @@ LOCAL_SRC_FILES := \
 	executor/xeBatchExecutor.cpp \
 	executor/xeBatchResult.cpp \
 	executor/xeCallQueue.cpp \
+	executor/xeCaseTimingDatabase.cpp \
 	executor/xeCommLink.cpp \
 	executor/xeContainerFormatParser.cpp \
 	executor/xeDefs.cpp \
 	executor/xeLocalTcpIpLink.cpp \
+	executor/xeMappedBatchResult.cpp \
+	executor/xeParallelTestLogParser.cpp \
 	executor/xeTcpIpLink.cpp \
 	executor/xeTestCase.cpp \
 	executor/xeTestCaseListParser.cpp \
 	executor/xeTestCaseResult.cpp \
+	executor/xeTestLogIndex.cpp \
 	executor/xeTestLogParser.cpp \
 	executor/xeTestLogWriter.cpp \
 	executor/xeTestResultParser.cpp \
@@ -35,6 +40,8 @@ LOCAL_SRC_FILES := \
 	framework/common/tcuArray.cpp \
 	framework/common/tcuAstcUtil.cpp \
 	framework/common/tcuBilinearImageCompare.cpp \
+	framework/common/tcuCallTrace.cpp \
+	framework/common/tcuCaseTimingFile.cpp \
 	framework/common/tcuCommandLine.cpp \
 	framework/common/tcuCompressedTexture.cpp \
 	framework/common/tcuCPUWarmup.cpp \
@@ -50,6 +57,7 @@ LOCAL_SRC_FILES := \
 	framework/common/tcuInterval.cpp \
 	framework/common/tcuMatrix.cpp \
 	framework/common/tcuMaybe.cpp \
+	framework/common/tcuPackedArchive.cpp \
 	framework/common/tcuPlatform.cpp \
 	framework/common/tcuRandomValueIterator.cpp \
 	framework/common/tcuRenderTarget.cpp \
@@ -61,6 +69,7 @@ LOCAL_SRC_FILES := \
 	framework/common/tcuSurface.cpp \
 	framework/common/tcuTestCase.cpp \
 	framework/common/tcuTestContext.cpp \
+	framework/common/tcuTestHierarchyCache.cpp \
 	framework/common/tcuTestHierarchyIterator.cpp \
 	framework/common/tcuTestHierarchyUtil.cpp \
 	framework/common/tcuTestLog.cpp \
@@ -91,6 +100,7 @@ LOCAL_SRC_FILES := \
 	framework/delibs/decpp/deDirectoryIterator.cpp \
 	framework/delibs/decpp/deDynamicLibrary.cpp \
 	framework/delibs/decpp/deFilePath.cpp \
+	framework/delibs/decpp/deMappedFile.cpp \
 	framework/delibs/decpp/deMemPool.cpp \
 	framework/delibs/decpp/deMeta.cpp \
 	framework/delibs/decpp/deMutex.cpp \
@@ -138,6 +148,7 @@ LOCAL_SRC_FILES := \
 	framework/delibs/deutil/deCommandLine.c \
 	framework/delibs/deutil/deDynamicLibrary.c \
 	framework/delibs/deutil/deFile.c \
+	framework/delibs/deutil/deMappedFile.c \
 	framework/delibs/deutil/deProcess.c \
 	framework/delibs/deutil/deSocket.c \
 	framework/delibs/deutil/deTimer.c \
@@ -160,6 +171,8 @@ LOCAL_SRC_FILES := \
 	framework/egl/wrapper/eglwDefs.cpp \
 	framework/egl/wrapper/eglwFunctions.cpp \
 	framework/egl/wrapper/eglwLibrary.cpp \
+	framework/forkserver/fsForkServer.cpp \
+	framework/forkserver/fsProtocol.cpp \
 	framework/opengl/gluCallLogWrapper.cpp \
 	framework/opengl/gluContextFactory.cpp \
 	framework/opengl/gluContextInfo.cpp \
@@ -691,6 +704,7 @@ LOCAL_C_INCLUDES := \
 	$(deqp_dir)/framework/platform/android \
 	$(deqp_dir)/framework/egl \
 	$(deqp_dir)/framework/egl/wrapper \
+	$(deqp_dir)/framework/forkserver \
 	$(deqp_dir)/framework/opengl \
 	$(deqp_dir)/framework/opengl/wrapper \
 	$(deqp_dir)/framework/referencerenderer \
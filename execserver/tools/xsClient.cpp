@@ -128,6 +128,7 @@ Message* readMessage (de::Socket& socket)
 		case MESSAGETYPE_INFO:					return new InfoMessage(&messageBuf[0], (int)messageBuf.size());
 		case MESSAGETYPE_PROCESS_LAUNCH_FAILED:	return new ProcessLaunchFailedMessage(&messageBuf[0], (int)messageBuf.size());
 		case MESSAGETYPE_PROCESS_FINISHED:		return new ProcessFinishedMessage(&messageBuf[0], (int)messageBuf.size());
+		case MESSAGETYPE_SERVER_FEATURES:		return new ServerFeaturesMessage(&messageBuf[0], (int)messageBuf.size());
 		default:
 			XS_FAIL("Unknown message");
 	}
@@ -305,7 +306,7 @@ int runClient (int argc, const char* const* argv)
 	// Defaults.
 	cmdLine.address.setHost("127.0.0.1");
 	cmdLine.address.setPort(50016);
-	cmdLine.dstFileName = "TestResults.qpa";
+	cmdLine.dstFileName = TEST_LOG_FILE_NAME;
 
 	// Parse command line.
 	for (int argNdx = 1; argNdx < argc; argNdx++)
@@ -29,6 +29,7 @@
 #	include "xsWin32TestProcess.hpp"
 #else
 #	include "xsPosixTestProcess.hpp"
+#	include "xsForkServerTestProcess.hpp"
 #endif
 
 #include <iostream>
@@ -38,6 +39,10 @@ namespace opt
 
 DE_DECLARE_COMMAND_LINE_OPT(Port,		int);
 DE_DECLARE_COMMAND_LINE_OPT(SingleExec,	bool);
+DE_DECLARE_COMMAND_LINE_OPT(Parallel,	bool);
+#if (DE_OS != DE_OS_WIN32)
+DE_DECLARE_COMMAND_LINE_OPT(ForkServer,	bool);
+#endif
 
 void registerOptions (de::cmdline::Parser& parser)
 {
@@ -45,7 +50,12 @@ void registerOptions (de::cmdline::Parser& parser)
 	using de::cmdline::NamedValue;
 
 	parser << Option<Port>		("p", "port",	"Port", "50016")
-		   << Option<SingleExec>("s", "single",	"Kill execserver after first session");
+		   << Option<SingleExec>("s", "single",	"Kill execserver after first session")
+		   << Option<Parallel>	(DE_NULL, "parallel", "Share working directory with other execservers. Test log is named TestResults-<pid>.qpa and removed after each session");
+
+#if (DE_OS != DE_OS_WIN32)
+	parser << Option<ForkServer>("f", "fork-server", "Keep test binary running in fork server mode and fork each test process from it");
+#endif
 }
 
 }
@@ -55,9 +65,10 @@ int main (int argc, const char* const* argv)
 	de::cmdline::CommandLine	cmdLine;
 
 #if (DE_OS == DE_OS_WIN32)
-	xs::Win32TestProcess		testProcess;
+	xs::Win32TestProcess		win32TestProcess;
 #else
-	xs::PosixTestProcess		testProcess;
+	xs::PosixTestProcess		posixTestProcess;
+	xs::ForkServerTestProcess	forkServerTestProcess;
 
 	// Set line buffered mode to stdout so executor gets any log messages in a timely manner.
 	setvbuf(stdout, DE_NULL, _IOLBF, 4*1024);
@@ -75,6 +86,16 @@ int main (int argc, const char* const* argv)
 		}
 	}
 
+#if (DE_OS == DE_OS_WIN32)
+	xs::TestProcess&			testProcess		= win32TestProcess;
+#else
+	xs::TestProcess&			testProcess		= cmdLine.getOption<opt::ForkServer>()
+												? static_cast<xs::TestProcess&>(forkServerTestProcess)
+												: static_cast<xs::TestProcess&>(posixTestProcess);
+#endif
+
+	testProcess.setParallelMode(cmdLine.getOption<opt::Parallel>());
+
 	try
 	{
 		const xs::ExecutionServer::RunMode	runMode		= cmdLine.getOption<opt::SingleExec>()
@@ -134,6 +134,7 @@ Message* readMessage (de::Socket& socket)
 		case MESSAGETYPE_INFO:					return new InfoMessage(&messageBuf[0], (int)messageBuf.size());
 		case MESSAGETYPE_PROCESS_LAUNCH_FAILED:	return new ProcessLaunchFailedMessage(&messageBuf[0], (int)messageBuf.size());
 		case MESSAGETYPE_PROCESS_FINISHED:		return new ProcessFinishedMessage(&messageBuf[0], (int)messageBuf.size());
+		case MESSAGETYPE_SERVER_FEATURES:		return new ServerFeaturesMessage(&messageBuf[0], (int)messageBuf.size());
 		default:
 			XS_FAIL("Unknown message");
 	}
@@ -360,6 +361,19 @@ public:
 	{
 		xs::HelloMessage msg;
 		sendMessage(socket, (const xs::Message&)msg);
+
+		// Server replies with supported features.
+		for (;;)
+		{
+			ScopedMsgPtr reply(readMessage(socket));
+
+			if (reply->type == MESSAGETYPE_KEEPALIVE)
+				continue;
+
+			XS_CHECK_MSG(reply->type == MESSAGETYPE_SERVER_FEATURES, "Expected SERVER_FEATURES message");
+			XS_CHECK((static_cast<const ServerFeaturesMessage*>(reply.get())->features & SERVER_FEATURE_LOG_COMPRESSION) != 0);
+			break;
+		}
 	}
 
 	void runProgram (void) { /* nothing */ }
@@ -32,6 +32,9 @@
 namespace xs
 {
 
+//! Test log file name in test process working directory.
+static const char* const TEST_LOG_FILE_NAME = "TestResults.qpa";
+
 // Configuration.
 enum
 {
@@ -42,6 +45,7 @@ enum
 	SERVER_IDLE_THRESHOLD		= 10,
 	SERVER_IDLE_SLEEP			= 50,
 	FILEREADER_IDLE_SLEEP		= 100,
+	LOG_COALESCE_TIMEOUT		= 100,	//!< Max time compressed log data is held back for coalescing.
 
 	LOG_BUFFER_BLOCK_SIZE		= 1024,
 	LOG_BUFFER_NUM_BLOCKS		= 512,
@@ -49,11 +53,11 @@ enum
 	INFO_BUFFER_BLOCK_SIZE		= 64,
 	INFO_BUFFER_NUM_BLOCKS		= 128,
 
-	SEND_BUFFER_SIZE			= 16*1024,
+	SEND_BUFFER_SIZE			= 128*1024,	//!< Must fit a compressed log data chunk.
 	RECV_BUFFER_SIZE			= 4*1024,
 
 	FILEREADER_TMP_BUFFER_SIZE	= 1024,
-	SEND_RECV_TMP_BUFFER_SIZE	= 4*1024,
+	SEND_RECV_TMP_BUFFER_SIZE	= 16*1024,
 
 	MIN_MSG_PAYLOAD_SIZE		= 32
 };
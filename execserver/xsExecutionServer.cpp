@@ -267,6 +267,17 @@ void ExecutionRequestHandler::processMessage (MessageType type, const deUint8* d
 			DBG_PRINT(("HelloMessage: version = %d\n", msg.version));
 			if (msg.version != PROTOCOL_VERSION)
 				throw ProtocolError("Unsupported protocol version");
+
+			// Advertise optional features. Clients that don't send HELLO never see this message.
+			{
+				vector<deUint8> buf;
+				ServerFeaturesMessage(SERVER_FEATURE_LOG_COMPRESSION).write(buf);
+
+				if (m_bufferOut.getNumFree() < (int)buf.size())
+					throw ProtocolError("Send buffer full");
+
+				m_bufferOut.pushFront(&buf[0], (int)buf.size());
+			}
 			break;
 		}
 
@@ -302,6 +313,16 @@ void ExecutionRequestHandler::processMessage (MessageType type, const deUint8* d
 			break;
 		}
 
+		case MESSAGETYPE_SET_LOG_COMPRESSION:
+		{
+			SetLogCompressionMessage msg(data, dataSize);
+			DBG_PRINT(("SetLogCompressionMessage: level = %d\n", msg.level));
+			if (!de::inRange(msg.level, 0, 9))
+				throw ProtocolError("Invalid log compression level");
+			getTestDriver()->setLogCompression(msg.level);
+			break;
+		}
+
 		default:
 			throw ProtocolError("Unsupported message");
 	}
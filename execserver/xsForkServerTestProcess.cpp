@@ -0,0 +1,473 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Execution Server
+ * ---------------------------------------------
+ *
+ * Copyright 2014 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief TestProcess implementation using test binary fork server.
+ *//*--------------------------------------------------------------------*/
+
+#include "xsForkServerTestProcess.hpp"
+#include "deFilePath.hpp"
+#include "deClock.h"
+
+#include <string.h>
+#include <stdio.h>
+#include <signal.h>
+#include <unistd.h>
+
+using std::string;
+using std::vector;
+
+namespace xs
+{
+
+namespace
+{
+
+enum
+{
+	// Times are in milliseconds.
+	SERVER_RESPONSE_TIMEOUT		= 30000,	//!< Server may still be initializing when it gets its first request.
+	SERVER_STOP_TIMEOUT			= 1000,
+	PROCESS_STOP_TIMEOUT		= 1000
+};
+
+string getServerKey (const char* name, const char* params, const char* workingDir)
+{
+	return string(name) + "\n" + params + "\n" + workingDir;
+}
+
+} // anonymous
+
+namespace posix
+{
+
+ForkServerResponseReader::ForkServerResponseReader (void)
+	: m_file		(DE_NULL)
+	, m_state		(STATE_IDLE)
+	, m_exitCode	(-1)
+	, m_serverLost	(false)
+{
+}
+
+ForkServerResponseReader::~ForkServerResponseReader (void)
+{
+}
+
+void ForkServerResponseReader::start (deFile* file)
+{
+	DE_ASSERT(!isStarted());
+
+	m_file				= file;
+	m_state				= STATE_IDLE;
+	m_exitCode			= -1;
+	m_serverLost		= false;
+
+	m_launchFailReason.clear();
+
+	de::Thread::start();
+}
+
+void ForkServerResponseReader::run (void)
+{
+	vector<deUint8>	buf;
+	deUint8			tmpBuf		[FILEREADER_TMP_BUFFER_SIZE];
+
+	try
+	{
+		for (;;)
+		{
+			deInt64				numRead		= 0;
+			const deFileResult	result		= deFile_read(m_file, &tmpBuf[0], (deInt64)sizeof(tmpBuf), &numRead);
+
+			if (result == DE_FILERESULT_WOULD_BLOCK)
+			{
+				deSleep(1);
+				continue;
+			}
+			else if (result != DE_FILERESULT_SUCCESS)
+				break; // End of file or error, server is gone.
+
+			buf.insert(buf.end(), &tmpBuf[0], &tmpBuf[0] + numRead);
+
+			// Handle all complete messages.
+			while (buf.size() >= fs::MESSAGE_HEADER_SIZE)
+			{
+				fs::MessageType		type;
+				size_t				messageSize;
+
+				fs::parseHeader(&buf[0], buf.size(), type, messageSize);
+
+				if (buf.size() < messageSize)
+					break;
+
+				{
+					fs::Message		message;
+
+					fs::parseMessage(&buf[0], messageSize, message);
+
+					de::ScopedLock	lock	(m_lock);
+
+					switch (message.type)
+					{
+						case fs::MESSAGETYPE_PROCESS_STARTED:
+							m_state = STATE_RUNNING;
+							break;
+
+						case fs::MESSAGETYPE_PROCESS_LAUNCH_FAILED:
+							m_launchFailReason	= message.reason;
+							m_state				= STATE_LAUNCH_FAILED;
+							break;
+
+						case fs::MESSAGETYPE_PROCESS_FINISHED:
+							m_exitCode	= message.exitCode;
+							m_state		= STATE_FINISHED;
+							break;
+
+						default:
+							XS_FAIL("Unexpected message from fork server");
+					}
+				}
+
+				buf.erase(buf.begin(), buf.begin() + messageSize);
+			}
+		}
+	}
+	catch (const std::exception& e)
+	{
+		printf("ForkServerResponseReader::run(): %s\n", e.what());
+	}
+
+	{
+		de::ScopedLock lock(m_lock);
+		m_serverLost = true;
+	}
+}
+
+void ForkServerResponseReader::stop (void)
+{
+	if (!isStarted())
+		return; // Nothing to do.
+
+	// \note Server must have exited or otherwise joining will block.
+	join();
+
+	m_file = DE_NULL;
+}
+
+void ForkServerResponseReader::setState (State state)
+{
+	de::ScopedLock lock(m_lock);
+	m_state = state;
+}
+
+ForkServerResponseReader::State ForkServerResponseReader::getState (void) const
+{
+	de::ScopedLock lock(m_lock);
+	return m_state;
+}
+
+int ForkServerResponseReader::getExitCode (void) const
+{
+	de::ScopedLock lock(m_lock);
+	return m_exitCode;
+}
+
+string ForkServerResponseReader::getLaunchFailReason (void) const
+{
+	de::ScopedLock lock(m_lock);
+	return m_launchFailReason;
+}
+
+bool ForkServerResponseReader::isServerLost (void) const
+{
+	de::ScopedLock lock(m_lock);
+	return m_serverLost;
+}
+
+} // posix
+
+ForkServerTestProcess::ForkServerTestProcess (void)
+	: m_server				(DE_NULL)
+	, m_processStartTime	(0)
+	, m_infoBuffer			(INFO_BUFFER_BLOCK_SIZE, INFO_BUFFER_NUM_BLOCKS)
+	, m_stdErrReader		(&m_infoBuffer)
+	, m_logReader			(LOG_BUFFER_BLOCK_SIZE, LOG_BUFFER_NUM_BLOCKS)
+{
+}
+
+ForkServerTestProcess::~ForkServerTestProcess (void)
+{
+	m_logReader.stop();
+	stopServer();
+}
+
+void ForkServerTestProcess::startServer (const char* name, const char* params, const char* workingDir)
+{
+	DE_ASSERT(!m_server);
+
+	// Writing to a dead server must fail instead of killing execserver.
+	signal(SIGPIPE, SIG_IGN);
+
+	// Construct command line.
+	string cmdLine = de::FilePath(name).isAbsolutePath() ? name : de::FilePath::join(workingDir, name).getPath();
+	cmdLine += " --deqp-fork-server";
+
+	if (strlen(params) > 0)
+		cmdLine += string(" ") + params;
+
+	m_server = new de::Process();
+
+	try
+	{
+		m_server->start(cmdLine.c_str(), strlen(workingDir) > 0 ? workingDir : DE_NULL);
+	}
+	catch (const de::ProcessError& e)
+	{
+		delete m_server;
+		m_server = DE_NULL;
+		throw TestProcessException(e.what());
+	}
+
+	m_responseReader.start(m_server->getStdOut());
+
+	if (m_server->getStdErr())
+		m_stdErrReader.start(m_server->getStdErr());
+
+	m_serverKey = getServerKey(name, params, workingDir);
+}
+
+void ForkServerTestProcess::stopServer (void)
+{
+	if (!m_server)
+		return;
+
+	try
+	{
+		// Server kills any running process and exits once its stdin is closed.
+		const deUint64 stopTime = deGetMicroseconds();
+
+		m_server->closeStdIn();
+
+		while (m_server->isRunning() && deGetMicroseconds() - stopTime < SERVER_STOP_TIMEOUT*1000)
+			deSleep(10);
+
+		if (m_server->isRunning())
+		{
+			m_server->kill();
+			m_server->waitForFinish();
+		}
+	}
+	catch (const de::ProcessError& e)
+	{
+		printf("ForkServerTestProcess::stopServer(): Failed to stop server: %s\n", e.what());
+	}
+
+	m_responseReader.stop();
+	m_responseReader.setState(posix::ForkServerResponseReader::STATE_IDLE);
+
+	// \note Info buffer must be canceled before stopping pipe reader.
+	m_infoBuffer.cancel();
+	m_stdErrReader.stop();
+	m_infoBuffer.clear();
+
+	delete m_server;
+	m_server = DE_NULL;
+	m_serverKey.clear();
+}
+
+bool ForkServerTestProcess::isServerAlive (void)
+{
+	return m_server && !m_responseReader.isServerLost() && m_server->isRunning();
+}
+
+void ForkServerTestProcess::sendRequest (const fs::Message& message)
+{
+	deFile* const	dst		= m_server->getStdIn();
+	vector<deUint8>	buf;
+	size_t			pos		= 0;
+
+	XS_CHECK(dst);
+
+	fs::writeMessage(message, buf);
+
+	while (pos < buf.size())
+	{
+		deInt64 numWritten = 0;
+
+		if (deFile_write(dst, &buf[pos], (deInt64)(buf.size()-pos), &numWritten) != DE_FILERESULT_SUCCESS)
+			XS_FAIL("Failed to send request to fork server");
+
+		pos += (size_t)numWritten;
+	}
+}
+
+void ForkServerTestProcess::start (const char* name, const char* params, const char* workingDir, const char* caseList)
+{
+	XS_CHECK(m_responseReader.getState() == posix::ForkServerResponseReader::STATE_IDLE);
+
+	const de::FilePath logFilePath (getTestLogFileName(workingDir));
+	m_logFileName = logFilePath.getPath();
+
+	// Remove old file if such exists.
+	if (deFileExists(m_logFileName.c_str()))
+	{
+		if (!deDeleteFile(m_logFileName.c_str()) || deFileExists(m_logFileName.c_str()))
+			throw TestProcessException(string("Failed to remove '") + m_logFileName + "'");
+	}
+
+	// Server is reused only for identical binary and parameters.
+	if (m_server && (m_serverKey != getServerKey(name, params, workingDir) || !isServerAlive()))
+		stopServer();
+
+	if (!m_server)
+		startServer(name, params, workingDir);
+
+	{
+		fs::Message request (fs::MESSAGETYPE_EXECUTE);
+
+		// \note Server was started in working directory with the binary so only session parameters are passed on.
+		request.params		= string("--deqp-log-filename=") + logFilePath.getBaseName();
+		request.caseList	= caseList;
+
+		if (strlen(params) > 0)
+			request.params += string(" ") + params;
+
+		m_responseReader.setState(posix::ForkServerResponseReader::STATE_WAITING);
+
+		try
+		{
+			sendRequest(request);
+		}
+		catch (const std::exception& e)
+		{
+			stopServer();
+			throw TestProcessException(e.what());
+		}
+	}
+
+	// Wait until process has been forked.
+	{
+		const deUint64 requestTime = deGetMicroseconds();
+
+		for (;;)
+		{
+			const posix::ForkServerResponseReader::State state = m_responseReader.getState();
+
+			if (state == posix::ForkServerResponseReader::STATE_RUNNING ||
+				state == posix::ForkServerResponseReader::STATE_FINISHED)
+				break;
+
+			if (state == posix::ForkServerResponseReader::STATE_LAUNCH_FAILED)
+			{
+				m_responseReader.setState(posix::ForkServerResponseReader::STATE_IDLE);
+				throw TestProcessException(m_responseReader.getLaunchFailReason());
+			}
+
+			if (!isServerAlive() || deGetMicroseconds() - requestTime > SERVER_RESPONSE_TIMEOUT*1000)
+			{
+				stopServer();
+				throw TestProcessException("Fork server didn't respond to execution request");
+			}
+
+			deSleep(1);
+		}
+	}
+
+	m_processStartTime = deGetMicroseconds();
+}
+
+void ForkServerTestProcess::terminate (void)
+{
+	if (m_server && m_responseReader.getState() == posix::ForkServerResponseReader::STATE_RUNNING)
+	{
+		try
+		{
+			sendRequest(fs::Message(fs::MESSAGETYPE_STOP));
+		}
+		catch (const std::exception& e)
+		{
+			printf("ForkServerTestProcess::terminate(): Failed to stop process: %s\n", e.what());
+		}
+	}
+}
+
+void ForkServerTestProcess::cleanup (void)
+{
+	m_logReader.stop();
+
+	if (isRunning())
+	{
+		const deUint64 stopTime = deGetMicroseconds();
+
+		terminate();
+
+		while (isRunning() && deGetMicroseconds() - stopTime < PROCESS_STOP_TIMEOUT*1000)
+			deSleep(10);
+
+		// Server is unresponsive.
+		if (isRunning())
+			stopServer();
+	}
+
+	if (m_server && !isServerAlive())
+		stopServer();
+
+	m_responseReader.setState(posix::ForkServerResponseReader::STATE_IDLE);
+
+	// Log has been forwarded to executor, remove it so that per-server logs don't pile up in working directory.
+	if (isParallelMode() && !m_logFileName.empty() && deFileExists(m_logFileName.c_str()))
+		deDeleteFile(m_logFileName.c_str());
+}
+
+bool ForkServerTestProcess::isRunning (void)
+{
+	return m_responseReader.getState() == posix::ForkServerResponseReader::STATE_RUNNING && isServerAlive();
+}
+
+int ForkServerTestProcess::getExitCode (void) const
+{
+	if (m_responseReader.getState() == posix::ForkServerResponseReader::STATE_FINISHED)
+		return m_responseReader.getExitCode();
+	else
+		return -1;
+}
+
+int ForkServerTestProcess::readTestLog (deUint8* dst, int numBytes)
+{
+	if (!m_logReader.isRunning())
+	{
+		if (deGetMicroseconds() - m_processStartTime > LOG_FILE_TIMEOUT*1000)
+		{
+			// Timeout, kill process.
+			terminate();
+			return 0;
+		}
+
+		if (!deFileExists(m_logFileName.c_str()))
+			return 0;
+
+		// Start reader.
+		m_logReader.start(m_logFileName.c_str());
+	}
+
+	DE_ASSERT(m_logReader.isRunning());
+	return m_logReader.read(dst, numBytes);
+}
+
+} // xs
@@ -0,0 +1,134 @@
+#ifndef _XSFORKSERVERTESTPROCESS_HPP
+#define _XSFORKSERVERTESTPROCESS_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Execution Server
+ * ---------------------------------------------
+ *
+ * Copyright 2014 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief TestProcess implementation using test binary fork server.
+ *//*--------------------------------------------------------------------*/
+
+#include "xsDefs.hpp"
+#include "xsTestProcess.hpp"
+#include "xsPosixFileReader.hpp"
+#include "xsPosixTestProcess.hpp"
+#include "fsProtocol.hpp"
+#include "deProcess.hpp"
+#include "deThread.hpp"
+#include "deMutex.hpp"
+
+#include <string>
+
+namespace xs
+{
+namespace posix
+{
+
+//! Reads fork server responses from server stdout.
+class ForkServerResponseReader : public de::Thread
+{
+public:
+	enum State
+	{
+		STATE_IDLE = 0,			//!< No request pending.
+		STATE_WAITING,			//!< Waiting for response to ExecuteBinary.
+		STATE_RUNNING,			//!< Process was started.
+		STATE_LAUNCH_FAILED,	//!< Process couldn't be started.
+		STATE_FINISHED,			//!< Process has finished.
+
+		STATE_LAST
+	};
+
+							ForkServerResponseReader	(void);
+							~ForkServerResponseReader	(void);
+
+	void					start						(deFile* file);
+	void					stop						(void);
+
+	void					run							(void);
+
+	void					setState					(State state);
+	State					getState					(void) const;
+	int						getExitCode					(void) const;
+	std::string				getLaunchFailReason			(void) const;
+
+	//! Server closed its stdout, i.e. server has died or is exiting.
+	bool					isServerLost				(void) const;
+
+private:
+	mutable de::Mutex		m_lock;
+	deFile*					m_file;
+	State					m_state;
+	int						m_exitCode;
+	std::string				m_launchFailReason;
+	bool					m_serverLost;
+};
+
+} // posix
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Test process that forks batches from persistent test binary
+ *
+ * Test binary is started once with --deqp-fork-server and it is kept
+ * running for as long as later requests use the same binary, parameters
+ * and working directory. Each batch is then executed in a child forked
+ * from the already initialized test binary (see fsForkServer.hpp), which
+ * avoids binary startup cost for each batch and after each crash.
+ *//*--------------------------------------------------------------------*/
+class ForkServerTestProcess : public TestProcess
+{
+public:
+										ForkServerTestProcess		(void);
+	virtual								~ForkServerTestProcess		(void);
+
+	virtual void						start						(const char* name, const char* params, const char* workingDir, const char* caseList);
+	virtual void						terminate					(void);
+	virtual void						cleanup						(void);
+
+	virtual bool						isRunning					(void);
+
+	virtual int							getExitCode					(void) const;
+
+	virtual int							readTestLog					(deUint8* dst, int numBytes);
+	virtual int							readInfoLog					(deUint8* dst, int numBytes) { return m_infoBuffer.tryRead(numBytes, dst); }
+
+private:
+										ForkServerTestProcess		(const ForkServerTestProcess& other);
+	ForkServerTestProcess&				operator=					(const ForkServerTestProcess& other);
+
+	void								startServer					(const char* name, const char* params, const char* workingDir);
+	void								stopServer					(void);
+	bool								isServerAlive				(void);
+
+	void								sendRequest					(const fs::Message& message);
+
+	de::Process*						m_server;
+	std::string							m_serverKey;				//!< Binary, parameters and working directory of current server.
+	deUint64							m_processStartTime;			//!< Used for determining log file timeout.
+	std::string							m_logFileName;
+	ThreadedByteBuffer					m_infoBuffer;
+
+	// Threads.
+	posix::ForkServerResponseReader		m_responseReader;
+	posix::PipeReader					m_stdErrReader;
+	posix::FileReader					m_logReader;
+};
+
+} // xs
+
+#endif // _XSFORKSERVERTESTPROCESS_HPP
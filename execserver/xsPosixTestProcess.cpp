@@ -189,7 +189,7 @@ void PosixTestProcess::start (const char* name, const char* params, const char*
 
 	XS_CHECK(!m_process);
 
-	de::FilePath logFilePath = de::FilePath::join(workingDir, "TestResults.qpa");
+	const de::FilePath logFilePath (getTestLogFileName(workingDir));
 	m_logFileName = logFilePath.getPath();
 
 	// Remove old file if such exists.
@@ -293,6 +293,10 @@ void PosixTestProcess::cleanup (void)
 		delete m_process;
 		m_process = DE_NULL;
 	}
+
+	// Log has been forwarded to executor, remove it so that per-server logs don't pile up in working directory.
+	if (isParallelMode() && !m_logFileName.empty() && deFileExists(m_logFileName.c_str()))
+		deDeleteFile(m_logFileName.c_str());
 }
 
 bool PosixTestProcess::isRunning (void)
@@ -23,6 +23,8 @@
 
 #include "xsProtocol.hpp"
 
+#include <zlib.h>
+
 using std::string;
 using std::vector;
 
@@ -76,6 +78,14 @@ public:
 		m_pos += 1;
 	}
 
+	const deUint8* getRemaining (size_t& numBytes)
+	{
+		const deUint8* const ptr = m_data + m_pos;
+		numBytes	= m_size - m_pos;
+		m_pos		= m_size;
+		return ptr;
+	}
+
 	void assumEnd (void)
 	{
 		if (m_pos != m_size)
@@ -222,6 +232,83 @@ void ProcessLogDataMessage::write (vector<deUint8>& buf) const
 	writer.put(logData.c_str());
 }
 
+SetLogCompressionMessage::SetLogCompressionMessage (const deUint8* data, size_t dataSize)
+	: Message(MESSAGETYPE_SET_LOG_COMPRESSION)
+{
+	MessageParser parser(data, dataSize);
+	level = parser.get<int>();
+	parser.assumEnd();
+}
+
+void SetLogCompressionMessage::write (vector<deUint8>& buf) const
+{
+	MessageWriter writer(type, buf);
+	writer.put(level);
+}
+
+ServerFeaturesMessage::ServerFeaturesMessage (const deUint8* data, size_t dataSize)
+	: Message(MESSAGETYPE_SERVER_FEATURES)
+{
+	MessageParser parser(data, dataSize);
+	features = (deUint32)parser.get<int>();
+	parser.assumEnd();
+}
+
+void ServerFeaturesMessage::write (vector<deUint8>& buf) const
+{
+	MessageWriter writer(type, buf);
+	writer.put((int)features);
+}
+
+CompressedLogDataMessage::CompressedLogDataMessage (const deUint8* data, size_t dataSize)
+	: Message	(MESSAGETYPE_PROCESS_LOG_DATA_COMPRESSED)
+	, level		(0)
+{
+	MessageParser	parser				(data, dataSize);
+	const int		uncompressedSize	= parser.get<int>();
+	size_t			compressedSize		= 0;
+	const deUint8*	compressedData		= parser.getRemaining(compressedSize);
+
+	XS_CHECK_MSG(de::inRange(uncompressedSize, 0, (int)MAX_COMPRESSED_LOG_CHUNK_SIZE), "Invalid uncompressed size");
+
+	logData.resize(uncompressedSize);
+
+	if (uncompressedSize > 0)
+	{
+		uLongf	destLen	= (uLongf)uncompressedSize;
+		int		result	= uncompress(&logData[0], &destLen, compressedData, (uLong)compressedSize);
+
+		XS_CHECK_MSG(result == Z_OK && destLen == (uLongf)uncompressedSize, "Failed to decompress log data");
+	}
+}
+
+CompressedLogDataMessage::CompressedLogDataMessage (const deUint8* logData_, size_t logDataSize, int level_)
+	: Message	(MESSAGETYPE_PROCESS_LOG_DATA_COMPRESSED)
+	, logData	(logData_, logData_+logDataSize)
+	, level		(level_)
+{
+	DE_ASSERT(logDataSize <= MAX_COMPRESSED_LOG_CHUNK_SIZE);
+}
+
+void CompressedLogDataMessage::write (vector<deUint8>& buf) const
+{
+	MessageWriter writer(type, buf);
+	writer.put((int)logData.size());
+
+	if (!logData.empty())
+	{
+		const size_t	curPos	= buf.size();
+		uLongf			destLen	= compressBound((uLong)logData.size());
+		int				result;
+
+		buf.resize(curPos + destLen);
+		result = compress2(&buf[curPos], &destLen, &logData[0], (uLong)logData.size(), level);
+		XS_CHECK_MSG(result == Z_OK, "Failed to compress log data");
+
+		buf.resize(curPos + destLen);
+	}
+}
+
 ProcessLaunchFailedMessage::ProcessLaunchFailedMessage (const deUint8* data, size_t dataSize)
 	: Message(MESSAGETYPE_PROCESS_LAUNCH_FAILED)
 {
@@ -40,6 +40,16 @@ enum
 	// Times are in milliseconds.
 	KEEPALIVE_SEND_INTERVAL		= 5000,
 	KEEPALIVE_TIMEOUT			= 30000,
+
+	// Uncompressed sizes of compressed log data chunks.
+	COMPRESSED_LOG_CHUNK_SIZE		= 64*1024,		//!< Log data is coalesced into chunks of this size before compression.
+	MAX_COMPRESSED_LOG_CHUNK_SIZE	= 16*1024*1024,	//!< Largest chunk accepted by receiver.
+};
+
+//! Optional features advertised in SERVER_FEATURES.
+enum ServerFeature
+{
+	SERVER_FEATURE_LOG_COMPRESSION	= (1<<0)	//!< SET_LOG_COMPRESSION is understood.
 };
 
 enum MessageType
@@ -51,6 +61,7 @@ enum MessageType
 	MESSAGETYPE_TEST					= 101,	//!< Debug only
 	MESSAGETYPE_EXECUTE_BINARY			= 111,	//!< Request execution of a test package binary.
 	MESSAGETYPE_STOP_EXECUTION			= 112,	//!< Request cancellation of the currently executing binary.
+	MESSAGETYPE_SET_LOG_COMPRESSION		= 113,	//!< Request log data to be sent compressed. Not understood by older servers.
 
 	// Responses (from ExecServer to Client)
 	MESSAGETYPE_PROCESS_STARTED			= 200,	//!< Requested process has started.
@@ -58,6 +69,8 @@ enum MessageType
 	MESSAGETYPE_PROCESS_FINISHED		= 202,	//!< Requested process has finished (for any reason).
 	MESSAGETYPE_PROCESS_LOG_DATA		= 203,	//!< Unprocessed log data from TestResults.qpa.
 	MESSAGETYPE_INFO					= 204,	//!< Generic info message from ExecServer (for debugging purposes).
+	MESSAGETYPE_PROCESS_LOG_DATA_COMPRESSED	= 205,	//!< zlib-compressed log data, sent only if requested with SET_LOG_COMPRESSION.
+	MESSAGETYPE_SERVER_FEATURES			= 206,	//!< Reply to HELLO, lists optional features supported by ExecServer. Not sent by older servers.
 
 	MESSAGETYPE_KEEPALIVE				= 102	//!< Keep-alive packet
 };
@@ -138,6 +151,43 @@ public:
 	void			write						(std::vector<deUint8>& buf) const;
 };
 
+class SetLogCompressionMessage : public Message
+{
+public:
+	int				level;		//!< zlib compression level (1-9), 0 disables compression.
+
+					SetLogCompressionMessage	(const deUint8* data, size_t dataSize);
+					SetLogCompressionMessage	(int level_) : Message(MESSAGETYPE_SET_LOG_COMPRESSION), level(level_) {}
+					~SetLogCompressionMessage	(void) {}
+
+	void			write						(std::vector<deUint8>& buf) const;
+};
+
+class ServerFeaturesMessage : public Message
+{
+public:
+	deUint32		features;	//!< ServerFeature bits.
+
+					ServerFeaturesMessage		(const deUint8* data, size_t dataSize);
+					ServerFeaturesMessage		(deUint32 features_) : Message(MESSAGETYPE_SERVER_FEATURES), features(features_) {}
+					~ServerFeaturesMessage		(void) {}
+
+	void			write						(std::vector<deUint8>& buf) const;
+};
+
+class CompressedLogDataMessage : public Message
+{
+public:
+	std::vector<deUint8>	logData;	//!< Uncompressed log data.
+	int						level;		//!< Compression level used by write().
+
+							CompressedLogDataMessage	(const deUint8* data, size_t dataSize);
+							CompressedLogDataMessage	(const deUint8* logData_, size_t logDataSize, int level_);
+							~CompressedLogDataMessage	(void) {}
+
+	void					write						(std::vector<deUint8>& buf) const;
+};
+
 class ProcessLaunchFailedMessage : public Message
 {
 public:
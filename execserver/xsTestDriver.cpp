@@ -46,6 +46,8 @@ TestDriver::TestDriver (xs::TestProcess* testProcess)
 	, m_process				(testProcess)
 	, m_lastProcessDataTime	(0)
 	, m_dataMsgTmpBuf		(SEND_RECV_TMP_BUFFER_SIZE)
+	, m_logCompressionLevel	(0)
+	, m_pendingLogDataTime	(0)
 {
 }
 
@@ -58,11 +60,18 @@ void TestDriver::reset (void)
 {
 	m_process->cleanup();
 
-	m_state = STATE_NOT_STARTED;
+	m_state					= STATE_NOT_STARTED;
+	m_logCompressionLevel	= 0;
+
+	m_pendingLogData.clear();
+	m_compressedLogMsg.clear();
 }
 
 void TestDriver::startProcess (const char* name, const char* params, const char* workingDir, const char* caseList)
 {
+	m_pendingLogData.clear();
+	m_compressedLogMsg.clear();
+
 	try
 	{
 		m_process->start(name, params, workingDir, caseList);
@@ -81,6 +90,12 @@ void TestDriver::stopProcess (void)
 	m_process->terminate();
 }
 
+void TestDriver::setLogCompression (int level)
+{
+	DE_ASSERT(de::inRange(level, 0, 9));
+	m_logCompressionLevel = level;
+}
+
 bool TestDriver::poll (ByteBuffer& messageBuffer)
 {
 	switch (m_state)
@@ -149,7 +164,8 @@ bool TestDriver::poll (ByteBuffer& messageBuffer)
 				m_lastProcessDataTime = deGetMicroseconds();
 				return true;
 			}
-			else if (deGetMicroseconds() - m_lastProcessDataTime > READ_DATA_TIMEOUT*1000)
+			else if (deGetMicroseconds() - m_lastProcessDataTime > READ_DATA_TIMEOUT*1000 &&
+					 m_pendingLogData.empty() && m_compressedLogMsg.empty())
 			{
 				// Read timeout occurred.
 				m_state = STATE_PROCESS_FINISHED;
@@ -181,7 +197,10 @@ bool TestDriver::poll (ByteBuffer& messageBuffer)
 
 bool TestDriver::pollLogFile (ByteBuffer& messageBuffer)
 {
-	return pollBuffer(messageBuffer, MESSAGETYPE_PROCESS_LOG_DATA);
+	if (m_logCompressionLevel > 0)
+		return pollCompressedLog(messageBuffer);
+	else
+		return pollBuffer(messageBuffer, MESSAGETYPE_PROCESS_LOG_DATA);
 }
 
 bool TestDriver::pollInfo (ByteBuffer& messageBuffer)
@@ -224,6 +243,56 @@ bool TestDriver::pollBuffer (ByteBuffer& messageBuffer, MessageType msgType)
 	return true;
 }
 
+bool TestDriver::pollCompressedLog (ByteBuffer& messageBuffer)
+{
+	const deUint64	curTime		= deGetMicroseconds();
+	bool			gotData		= false;
+
+	// Log data is coalesced into large chunks for better compression ratio and less per-message overhead.
+	if (m_compressedLogMsg.empty() && m_pendingLogData.size() < COMPRESSED_LOG_CHUNK_SIZE)
+	{
+		const size_t	prevSize	= m_pendingLogData.size();
+		int				numRead		= 0;
+
+		m_pendingLogData.resize(COMPRESSED_LOG_CHUNK_SIZE);
+		numRead = m_process->readTestLog(&m_pendingLogData[prevSize], (int)(COMPRESSED_LOG_CHUNK_SIZE - prevSize));
+		m_pendingLogData.resize(prevSize + (size_t)de::max(numRead, 0));
+
+		if (numRead > 0)
+		{
+			if (prevSize == 0)
+				m_pendingLogDataTime = curTime;
+
+			gotData = true;
+		}
+	}
+
+	if (m_compressedLogMsg.empty() && !m_pendingLogData.empty())
+	{
+		// Send when chunk is full, data has waited long enough, or process has finished and log is drained.
+		const bool	chunkFull	= m_pendingLogData.size() >= COMPRESSED_LOG_CHUNK_SIZE;
+		const bool	timeout		= curTime - m_pendingLogDataTime > LOG_COALESCE_TIMEOUT*1000;
+		const bool	drained		= m_state == STATE_READING_DATA && !gotData;
+
+		if (chunkFull || timeout || drained)
+		{
+			CompressedLogDataMessage(&m_pendingLogData[0], m_pendingLogData.size(), m_logCompressionLevel).write(m_compressedLogMsg);
+			m_pendingLogData.clear();
+		}
+	}
+
+	if (!m_compressedLogMsg.empty() && messageBuffer.getNumFree() >= (int)m_compressedLogMsg.size())
+	{
+		messageBuffer.pushFront(&m_compressedLogMsg[0], (int)m_compressedLogMsg.size());
+		DBG_PRINT(("  wrote %d bytes of compressed log data\n", (int)m_compressedLogMsg.size()));
+
+		m_compressedLogMsg.clear();
+		return true;
+	}
+
+	return gotData;
+}
+
 bool TestDriver::writeMessage (ByteBuffer& messageBuffer, const Message& message)
 {
 	vector<deUint8> buf;
@@ -43,6 +43,9 @@ public:
 	void					startProcess		(const char* name, const char* params, const char* workingDir, const char* caseList);
 	void					stopProcess			(void);
 
+	//! Set zlib compression level for log data, 0 disables compression.
+	void					setLogCompression	(int level);
+
 	bool					poll				(ByteBuffer& messageBuffer);
 
 private:
@@ -61,6 +64,7 @@ private:
 	bool					pollLogFile			(ByteBuffer& messageBuffer);
 	bool					pollInfo			(ByteBuffer& messageBuffer);
 	bool					pollBuffer			(ByteBuffer& messageBuffer, MessageType msgType);
+	bool					pollCompressedLog	(ByteBuffer& messageBuffer);
 
 	bool					writeMessage		(ByteBuffer& messageBuffer, const Message& message);
 
@@ -73,6 +77,12 @@ private:
 	deUint64				m_lastProcessDataTime;
 
 	std::vector<deUint8>	m_dataMsgTmpBuf;
+
+	// Compressed log data.
+	int						m_logCompressionLevel;
+	std::vector<deUint8>	m_pendingLogData;		//!< Log data coalesced for next compressed message.
+	deUint64				m_pendingLogDataTime;	//!< Time when pending data was started.
+	std::vector<deUint8>	m_compressedLogMsg;		//!< Compressed message waiting for space in message buffer.
 };
 
 } // xs
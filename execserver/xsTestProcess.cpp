@@ -22,5 +22,41 @@
  *//*--------------------------------------------------------------------*/
 
 #include "xsTestProcess.hpp"
+#include "deFilePath.hpp"
 
-DE_EMPTY_CPP_FILE
+#include <sstream>
+
+#if (DE_OS == DE_OS_WIN32)
+#	if !defined(WIN32_LEAN_AND_MEAN)
+#		define WIN32_LEAN_AND_MEAN 1
+#	endif
+#	if !defined(NOMINMAX)
+#		define NOMINMAX 1
+#	endif
+#	include <windows.h>
+#else
+#	include <unistd.h>
+#endif
+
+namespace xs
+{
+
+std::string TestProcess::getTestLogFileName (const char* workingDir) const
+{
+	if (m_parallelMode)
+	{
+		std::ostringstream	fileName;
+
+#if (DE_OS == DE_OS_WIN32)
+		fileName << "TestResults-" << GetCurrentProcessId() << ".qpa";
+#else
+		fileName << "TestResults-" << getpid() << ".qpa";
+#endif
+
+		return de::FilePath::join(workingDir, fileName.str()).getPath();
+	}
+	else
+		return de::FilePath::join(workingDir, TEST_LOG_FILE_NAME).getPath();
+}
+
+} // xs
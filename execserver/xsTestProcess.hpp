@@ -26,6 +26,7 @@
 #include "xsDefs.hpp"
 
 #include <stdexcept>
+#include <string>
 
 namespace xs
 {
@@ -51,8 +52,17 @@ public:
 	virtual int				readTestLog				(deUint8* dst, int numBytes)	= DE_NULL;
 	virtual int				readInfoLog				(deUint8* dst, int numBytes)	= DE_NULL;
 
+	//! Enable when several execservers share working directory. Test log is then named per server and removed after cleanup().
+	void					setParallelMode			(bool parallel)					{ m_parallelMode = parallel;	}
+	bool					isParallelMode			(void) const					{ return m_parallelMode;		}
+
 protected:
-							TestProcess				(void) {}
+							TestProcess				(void) : m_parallelMode(false) {}
+
+	std::string				getTestLogFileName		(const char* workingDir) const;
+
+private:
+	bool					m_parallelMode;
 };
 
 } // xs
@@ -646,7 +646,7 @@ void Win32TestProcess::start (const char* name, const char* params, const char*
 
 	XS_CHECK(!m_process);
 
-	de::FilePath logFilePath = de::FilePath::join(workingDir, "TestResults.qpa");
+	const de::FilePath logFilePath (getTestLogFileName(workingDir));
 	m_logFileName = logFilePath.getPath();
 
 	// Remove old file if such exists.
@@ -749,6 +749,10 @@ void Win32TestProcess::cleanup (void)
 		delete m_process;
 		m_process = DE_NULL;
 	}
+
+	// Log has been forwarded to executor, remove it so that per-server logs don't pile up in working directory.
+	if (isParallelMode() && !m_logFileName.empty() && deFileExists(m_logFileName.c_str()))
+		deDeleteFile(m_logFileName.c_str());
 }
 
 int Win32TestProcess::readTestLog (deUint8* dst, int numBytes)
@@ -21,8 +21,7 @@
  * \brief Batch result to JUnit report conversion tool.
  *//*--------------------------------------------------------------------*/
 
-#include "xeTestLogParser.hpp"
-#include "xeTestResultParser.hpp"
+#include "xeParallelTestLogParser.hpp"
 #include "xeXMLWriter.hpp"
 #include "deFilePath.hpp"
 #include "deString.h"
@@ -32,6 +31,7 @@
 #include <string>
 #include <map>
 #include <cstdio>
+#include <cstdlib>
 #include <fstream>
 
 using std::vector;
@@ -41,46 +41,50 @@ using std::map;
 struct CommandLine
 {
 	CommandLine (void)
+		: numWorkers(xe::ParallelTestLogParser::getDefaultNumWorkers())
 	{
 	}
 
 	std::string		batchResultFile;
 	std::string		outputFile;
+	int				numWorkers;
 };
 
 static void printHelp (const char* binName)
 {
 	printf("%s: [testlog] [output file]\n", binName);
+	printf("  --jobs=[count]  Number of parser threads (default: number of cores).\n");
 }
 
 static void parseCommandLine (CommandLine& cmdLine, int argc, const char* const* argv)
 {
-	if (argc != 3)
-		throw xe::Error("Expected input and output paths");
-
-	cmdLine.batchResultFile	= argv[argc-2];
-	cmdLine.outputFile		= argv[argc-1];
-}
-
-static void parseBatchResult (xe::TestLogParser& parser, const char* filename)
-{
-	std::ifstream	in			(filename, std::ios_base::binary);
-	deUint8			buf[2048];
+	vector<string> paths;
 
-	for (;;)
+	for (int argNdx = 1; argNdx < argc; argNdx++)
 	{
-		in.read((char*)&buf[0], sizeof(buf));
-		int numRead = (int)in.gcount();
+		const char* arg = argv[argNdx];
+
+		if (deStringBeginsWith(arg, "--jobs="))
+		{
+			cmdLine.numWorkers = atoi(arg+7);
+
+			if (cmdLine.numWorkers <= 0)
+				throw xe::Error("Invalid number of jobs");
+		}
+		else if (!deStringBeginsWith(arg, "--"))
+			paths.push_back(arg);
+		else
+			throw xe::Error(string("Unknown option ") + arg);
+	}
 
-		if (numRead > 0)
-			parser.parse(&buf[0], numRead);
+	if (paths.size() != 2)
+		throw xe::Error("Expected input and output paths");
 
-		if (numRead < (int)sizeof(buf))
-			break;
-	}
+	cmdLine.batchResultFile	= paths[0];
+	cmdLine.outputFile		= paths[1];
 }
 
-class ResultToJUnitHandler : public xe::TestLogHandler
+class ResultToJUnitHandler : public xe::ParsedTestLogHandler
 {
 public:
 	ResultToJUnitHandler (xe::xml::Writer& writer)
@@ -92,23 +96,10 @@ public:
 	{
 	}
 
-	xe::TestCaseResultPtr startTestCaseResult (const char* casePath)
-	{
-		return xe::TestCaseResultPtr(new xe::TestCaseResultData(casePath));
-	}
-
-	void testCaseResultUpdated (const xe::TestCaseResultPtr&)
-	{
-	}
-
-	void testCaseResultComplete (const xe::TestCaseResultPtr& resultData)
+	void testCaseResultParsed (const xe::TestCaseResultData&, const xe::TestCaseResult& result)
 	{
 		using xe::xml::Writer;
 
-		xe::TestCaseResult result;
-
-		xe::parseTestCaseResultFromData(&m_resultParser, &result, *resultData.get());
-
 		// Split group and case names.
 		size_t			sepPos		= result.casePath.find_last_of('.');
 		std::string		caseName	= result.casePath.substr(sepPos+1);
@@ -130,15 +121,14 @@ public:
 
 private:
 	xe::xml::Writer&		m_writer;
-	xe::TestResultParser	m_resultParser;
 };
 
-static void batchResultToJUnitReport (const char* batchResultFilename, const char* dstFileName)
+static void batchResultToJUnitReport (const char* batchResultFilename, const char* dstFileName, int numWorkers)
 {
 	std::ofstream				out			(dstFileName, std::ios_base::binary);
 	xe::xml::Writer				writer		(out);
 	ResultToJUnitHandler		handler		(writer);
-	xe::TestLogParser			parser		(&handler);
+	xe::ParallelTestLogParser	parser		(&handler, numWorkers);
 
 	XE_CHECK(out.good());
 
@@ -148,7 +138,7 @@ static void batchResultToJUnitReport (const char* batchResultFilename, const cha
 		   << xe::xml::Writer::BeginElement("testsuite");
 
 	// Parse and write individual cases
-	parseBatchResult(parser, batchResultFilename);
+	parser.parseFile(batchResultFilename);
 
 	writer << xe::xml::Writer::EndElement << xe::xml::Writer::EndElement;
 }
@@ -168,7 +158,7 @@ int main (int argc, const char* const* argv)
 
 	try
 	{
-		batchResultToJUnitReport(cmdLine.batchResultFile.c_str(), cmdLine.outputFile.c_str());
+		batchResultToJUnitReport(cmdLine.batchResultFile.c_str(), cmdLine.outputFile.c_str(), cmdLine.numWorkers);
 	}
 	catch (const std::exception& e)
 	{
@@ -21,8 +21,7 @@
  * \brief Batch result to XML export.
  *//*--------------------------------------------------------------------*/
 
-#include "xeTestLogParser.hpp"
-#include "xeTestResultParser.hpp"
+#include "xeParallelTestLogParser.hpp"
 #include "xeXMLWriter.hpp"
 #include "xeTestLogWriter.hpp"
 #include "deFilePath.hpp"
@@ -55,7 +54,8 @@ enum OutputMode
 namespace opt
 {
 
-DE_DECLARE_COMMAND_LINE_OPT(OutMode, OutputMode);
+DE_DECLARE_COMMAND_LINE_OPT(OutMode,		OutputMode);
+DE_DECLARE_COMMAND_LINE_OPT(NumWorkers,	int);
 
 void registerOptions (de::cmdline::Parser& parser)
 {
@@ -68,7 +68,8 @@ void registerOptions (de::cmdline::Parser& parser)
 		{ "separate",	OUTPUTMODE_SEPARATE	}
 	};
 
-	parser << Option<OutMode>("m", "mode", "Output mode", s_modes, "single");
+	parser << Option<OutMode>		("m", "mode", "Output mode", s_modes, "single")
+		   << Option<NumWorkers>	("j", "jobs", "Number of parser threads, 0 for number of cores", "0");
 }
 
 } // opt
@@ -76,13 +77,15 @@ void registerOptions (de::cmdline::Parser& parser)
 struct CommandLine
 {
 	CommandLine (void)
-		: outputMode(OUTPUTMODE_SINGLE)
+		: outputMode	(OUTPUTMODE_SINGLE)
+		, numWorkers	(0)
 	{
 	}
 
 	std::string		batchResultFile;
 	std::string		outputPath;
 	OutputMode		outputMode;
+	int				numWorkers;
 };
 
 static bool parseCommandLine (CommandLine& cmdLine, int argc, const char* const* argv)
@@ -101,28 +104,19 @@ static bool parseCommandLine (CommandLine& cmdLine, int argc, const char* const*
 	}
 
 	cmdLine.outputMode		= opts.getOption<opt::OutMode>();
+	cmdLine.numWorkers		= opts.getOption<opt::NumWorkers>();
 	cmdLine.batchResultFile	= opts.getArgs()[0];
 	cmdLine.outputPath		= opts.getArgs()[1];
 
-	return true;
-}
-
-static void parseBatchResult (xe::TestLogParser& parser, const char* filename)
-{
-	std::ifstream	in			(filename, std::ios_base::binary);
-	deUint8			buf[2048];
-
-	for (;;)
+	if (cmdLine.numWorkers < 0)
 	{
-		in.read((char*)&buf[0], sizeof(buf));
-		int numRead = (int)in.gcount();
-
-		if (numRead > 0)
-			parser.parse(&buf[0], numRead);
-
-		if (numRead < (int)sizeof(buf))
-			break;
+		printf("Invalid number of jobs\n");
+		return false;
 	}
+	else if (cmdLine.numWorkers == 0)
+		cmdLine.numWorkers = xe::ParallelTestLogParser::getDefaultNumWorkers();
+
+	return true;
 }
 
 // Export to single file
@@ -138,7 +132,7 @@ struct BatchResultTotals
 	int countByCode[xe::TESTSTATUSCODE_LAST];
 };
 
-class ResultToSingleXmlLogHandler : public xe::TestLogHandler
+class ResultToSingleXmlLogHandler : public xe::ParsedTestLogHandler
 {
 public:
 	ResultToSingleXmlLogHandler (xe::xml::Writer& writer, BatchResultTotals& totals)
@@ -151,21 +145,8 @@ public:
 	{
 	}
 
-	xe::TestCaseResultPtr startTestCaseResult (const char* casePath)
-	{
-		return xe::TestCaseResultPtr(new xe::TestCaseResultData(casePath));
-	}
-
-	void testCaseResultUpdated (const xe::TestCaseResultPtr&)
+	void testCaseResultParsed (const xe::TestCaseResultData&, const xe::TestCaseResult& result)
 	{
-	}
-
-	void testCaseResultComplete (const xe::TestCaseResultPtr& resultData)
-	{
-		xe::TestCaseResult result;
-
-		xe::parseTestCaseResultFromData(&m_resultParser, &result, *resultData.get());
-
 		// Write result.
 		xe::writeTestResult(result, m_writer);
 
@@ -177,7 +158,6 @@ public:
 private:
 	xe::xml::Writer&		m_writer;
 	BatchResultTotals&		m_totals;
-	xe::TestResultParser	m_resultParser;
 };
 
 static void writeTotals (xe::xml::Writer& writer, const BatchResultTotals& totals)
@@ -198,13 +178,13 @@ static void writeTotals (xe::xml::Writer& writer, const BatchResultTotals& total
 		   << Writer::EndElement;
 }
 
-static void batchResultToSingleXmlFile (const char* batchResultFilename, const char* dstFileName)
+static void batchResultToSingleXmlFile (const char* batchResultFilename, const char* dstFileName, int numWorkers)
 {
 	std::ofstream				out			(dstFileName, std::ios_base::binary);
 	xe::xml::Writer				writer		(out);
 	BatchResultTotals			totals;
 	ResultToSingleXmlLogHandler	handler		(writer, totals);
-	xe::TestLogParser			parser		(&handler);
+	xe::ParallelTestLogParser	parser		(&handler, numWorkers);
 
 	XE_CHECK(out.good());
 
@@ -215,7 +195,7 @@ static void batchResultToSingleXmlFile (const char* batchResultFilename, const c
 		   << xe::xml::Writer::Attribute("FileName", de::FilePath(batchResultFilename).getBaseName());
 
 	// Parse and write individual cases
-	parseBatchResult(parser, batchResultFilename);
+	parser.parseFile(batchResultFilename);
 
 	// Write ResultTotals
 	writeTotals(writer, totals);
@@ -226,7 +206,7 @@ static void batchResultToSingleXmlFile (const char* batchResultFilename, const c
 
 // Export to separate files
 
-class ResultToXmlFilesLogHandler : public xe::TestLogHandler
+class ResultToXmlFilesLogHandler : public xe::ParsedTestLogHandler
 {
 public:
 	ResultToXmlFilesLogHandler (vector<xe::TestCaseResultHeader>& resultHeaders, const char* dstPath)
@@ -239,21 +219,8 @@ public:
 	{
 	}
 
-	xe::TestCaseResultPtr startTestCaseResult (const char* casePath)
+	void testCaseResultParsed (const xe::TestCaseResultData&, const xe::TestCaseResult& result)
 	{
-		return xe::TestCaseResultPtr(new xe::TestCaseResultData(casePath));
-	}
-
-	void testCaseResultUpdated (const xe::TestCaseResultPtr&)
-	{
-	}
-
-	void testCaseResultComplete (const xe::TestCaseResultPtr& resultData)
-	{
-		xe::TestCaseResult result;
-
-		xe::parseTestCaseResultFromData(&m_resultParser, &result, *resultData.get());
-
 		// Write result.
 		{
 			de::FilePath	casePath	= de::FilePath::join(m_dstPath, (result.casePath + ".xml").c_str());
@@ -275,7 +242,6 @@ public:
 private:
 	vector<xe::TestCaseResultHeader>&	m_resultHeaders;
 	std::string							m_dstPath;
-	xe::TestResultParser				m_resultParser;
 };
 
 typedef std::map<const xe::TestCase*, const xe::TestCaseResultHeader*> ShortTestResultMap;
@@ -331,7 +297,7 @@ static void writeTestCaseList (const xe::TestRoot& root, const ShortTestResultMa
 	dst << Writer::EndElement;
 }
 
-static void batchResultToSeparateXmlFiles (const char* batchResultFilename, const char* dstPath)
+static void batchResultToSeparateXmlFiles (const char* batchResultFilename, const char* dstPath, int numWorkers)
 {
 	xe::TestRoot						testRoot;
 	vector<xe::TestCaseResultHeader>	shortResults;
@@ -346,9 +312,9 @@ static void batchResultToSeparateXmlFiles (const char* batchResultFilename, cons
 	// Parse batch result and write out test cases.
 	{
 		ResultToXmlFilesLogHandler	handler		(shortResults, dstPath);
-		xe::TestLogParser			parser		(&handler);
+		xe::ParallelTestLogParser	parser		(&handler, numWorkers);
 
-		parseBatchResult(parser, batchResultFilename);
+		parser.parseFile(batchResultFilename);
 	}
 
 	// Build case hierarchy & short result map.
@@ -386,9 +352,9 @@ int main (int argc, const char* const* argv)
 			return -1;
 
 		if (cmdLine.outputMode == OUTPUTMODE_SINGLE)
-			batchResultToSingleXmlFile(cmdLine.batchResultFile.c_str(), cmdLine.outputPath.c_str());
+			batchResultToSingleXmlFile(cmdLine.batchResultFile.c_str(), cmdLine.outputPath.c_str(), cmdLine.numWorkers);
 		else
-			batchResultToSeparateXmlFiles(cmdLine.batchResultFile.c_str(), cmdLine.outputPath.c_str());
+			batchResultToSeparateXmlFiles(cmdLine.batchResultFile.c_str(), cmdLine.outputPath.c_str(), cmdLine.numWorkers);
 	}
 	catch (const std::exception& e)
 	{
@@ -22,6 +22,7 @@
  *//*--------------------------------------------------------------------*/
 
 #include "xeBatchExecutor.hpp"
+#include "xeCaseTimingDatabase.hpp"
 #include "xeLocalTcpIpLink.hpp"
 #include "xeTcpIpLink.hpp"
 #include "xeTestCaseListParser.hpp"
@@ -31,8 +32,10 @@
 #include "deCommandLine.hpp"
 #include "deDirectoryIterator.hpp"
 #include "deStringUtil.hpp"
+#include "deSharedPtr.hpp"
 
 #include "deString.h"
+#include "deFile.h"
 
 #include <algorithm>
 #include <cstdio>
@@ -40,6 +43,7 @@
 #include <fstream>
 #include <iostream>
 #include <memory>
+#include <set>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -61,13 +65,16 @@ namespace opt
 DE_DECLARE_COMMAND_LINE_OPT(StartServer,	string);
 DE_DECLARE_COMMAND_LINE_OPT(Host,			string);
 DE_DECLARE_COMMAND_LINE_OPT(Port,			int);
+DE_DECLARE_COMMAND_LINE_OPT(Workers,		int);
 DE_DECLARE_COMMAND_LINE_OPT(CaseListDir,	string);
 DE_DECLARE_COMMAND_LINE_OPT(TestSet,		vector<string>);
 DE_DECLARE_COMMAND_LINE_OPT(ExcludeSet,		vector<string>);
 DE_DECLARE_COMMAND_LINE_OPT(ContinueFile,	string);
 DE_DECLARE_COMMAND_LINE_OPT(TestLogFile,	string);
 DE_DECLARE_COMMAND_LINE_OPT(InfoLogFile,	string);
+DE_DECLARE_COMMAND_LINE_OPT(TimingsFile,	string);
 DE_DECLARE_COMMAND_LINE_OPT(Summary,		bool);
+DE_DECLARE_COMMAND_LINE_OPT(LogCompression,	int);
 
 // TargetConfiguration
 DE_DECLARE_COMMAND_LINE_OPT(BinaryName,		string);
@@ -95,15 +102,18 @@ void registerOptions (de::cmdline::Parser& parser)
 	};
 
 	parser << Option<StartServer>	("s",		"start-server",	"Start local execserver. Path to the execserver binary.")
-		   << Option<Host>			("c",		"connect",		"Connect to host. Address of the execserver.")
+		   << Option<Host>			("c",		"connect",		"Connect to host. Comma-separated list of execserver addresses, each optionally followed by :port. Execservers sharing a working directory must be started with --parallel.")
 		   << Option<Port>			("p",		"port",			"TCP port of the execserver.",											"50016")
+		   << Option<Workers>		("w",		"workers",		"Number of local execservers to start. Each uses its own port starting from --port.",	"1")
 		   << Option<CaseListDir>	("cd",		"caselistdir",	"Path to the directory containing test case XML files.",				".")
 		   << Option<TestSet>		("t",		"testset",		"Comma-separated list of include filters.",								parseCommaSeparatedList)
 		   << Option<ExcludeSet>	("e",		"exclude",		"Comma-separated list of exclude filters.",								parseCommaSeparatedList, "")
 		   << Option<ContinueFile>	(DE_NULL,	"continue",		"Continue execution by initializing results from existing test log.")
 		   << Option<TestLogFile>	("o",		"out",			"Output test log filename.",											"TestLog.qpa")
 		   << Option<InfoLogFile>	("i",		"info",			"Output info log filename.",											"InfoLog.txt")
+		   << Option<TimingsFile>	(DE_NULL,	"timings",		"Case duration database. Used for scheduling parallel runs and updated with new results.")
 		   << Option<Summary>		(DE_NULL,	"summary",		"Print summary after running tests.",									s_yesNo, "yes")
+		   << Option<LogCompression>(DE_NULL,	"log-compression",	"zlib level (1-9) for compressing test logs sent by remote execservers, 0 = disabled.",	"0")
 		   << Option<BinaryName>	("b",		"binaryname",	"Test binary path. Relative to working directory.",						"<Unused>")
 		   << Option<WorkingDir>	("wd",		"workdir",		"Working directory for the test execution.",							".")
 		   << Option<CmdLineArgs>	(DE_NULL,	"cmdline",		"Additional command line arguments for the test binary.",				"");
@@ -120,8 +130,10 @@ enum RunMode
 struct CommandLine
 {
 	CommandLine (void)
-		: port		(0)
-		, summary	(false)
+		: port				(0)
+		, numWorkers		(1)
+		, summary			(false)
+		, logCompression	(0)
 	{
 	}
 
@@ -129,13 +141,16 @@ struct CommandLine
 	RunMode					runMode;
 	string					serverBinOrAddress;
 	int						port;
+	int						numWorkers;
 	string					caseListDir;
 	vector<string>			testset;
 	vector<string>			exclude;
 	string					inFile;
 	string					outFile;
 	string					infoFile;
+	string					timingsFile;
 	bool					summary;
+	int						logCompression;
 };
 
 bool parseCommandLine (CommandLine& cmdLine, int argc, const char* const* argv)
@@ -165,6 +180,18 @@ bool parseCommandLine (CommandLine& cmdLine, int argc, const char* const* argv)
 		return false;
 	}
 
+	if (opts.getOption<opt::Workers>() < 1)
+	{
+		std::cout << "Invalid command line arguments. --workers must be at least 1." << std::endl;
+		return false;
+	}
+
+	if (!de::inRange(opts.getOption<opt::LogCompression>(), 0, 9))
+	{
+		std::cout << "Invalid command line arguments. --log-compression must be between 0 and 9." << std::endl;
+		return false;
+	}
+
 	if (!opts.hasOption<opt::TestSet>())
 	{
 		std::cout << "Invalid command line arguments. --testset not defined." << std::endl;
@@ -194,12 +221,15 @@ bool parseCommandLine (CommandLine& cmdLine, int argc, const char* const* argv)
 	}
 
 	cmdLine.port					= opts.getOption<opt::Port>();
+	cmdLine.numWorkers				= opts.getOption<opt::Workers>();
 	cmdLine.caseListDir				= opts.getOption<opt::CaseListDir>();
 	cmdLine.testset					= opts.getOption<opt::TestSet>();
 	cmdLine.exclude					= opts.getOption<opt::ExcludeSet>();
 	cmdLine.outFile					= opts.getOption<opt::TestLogFile>();
 	cmdLine.infoFile				= opts.getOption<opt::InfoLogFile>();
+	cmdLine.timingsFile				= opts.hasOption<opt::TimingsFile>() ? opts.getOption<opt::TimingsFile>() : string();
 	cmdLine.summary					= opts.getOption<opt::Summary>();
+	cmdLine.logCompression			= opts.getOption<opt::LogCompression>();
 	cmdLine.targetCfg.binaryName	= opts.getOption<opt::BinaryName>();
 	cmdLine.targetCfg.workingDir	= opts.getOption<opt::WorkingDir>();
 	cmdLine.targetCfg.cmdLineArgs	= opts.getOption<opt::CmdLineArgs>();
@@ -455,70 +485,101 @@ void writeInfoLog (const xe::InfoLog& log, const char* filename)
 	out.close();
 }
 
-xe::CommLink* createCommLink (const CommandLine& cmdLine)
+typedef de::SharedPtr<xe::CommLink> CommLinkPtr;
+
+xe::CommLink* startLocalServer (const CommandLine& cmdLine, int port)
+{
+	xe::LocalTcpIpLink* link = new xe::LocalTcpIpLink();
+	try
+	{
+		link->start(cmdLine.serverBinOrAddress.c_str(), DE_NULL, port, cmdLine.numWorkers > 1);
+		return link;
+	}
+	catch (...)
+	{
+		delete link;
+		throw;
+	}
+}
+
+xe::CommLink* connectToServer (const string& host, int port, int logCompression)
+{
+	de::SocketAddress address;
+
+	address.setFamily(DE_SOCKETFAMILY_INET4);
+	address.setProtocol(DE_SOCKETPROTOCOL_TCP);
+	address.setHost(host.c_str());
+	address.setPort(port);
+
+	xe::TcpIpLink* link = new xe::TcpIpLink();
+	try
+	{
+		link->connect(address);
+
+		if (logCompression > 0 && !link->setLogCompression(logCompression))
+			printf("ExecServer at %s:%d doesn't support log compression, test logs are sent uncompressed\n", host.c_str(), port);
+
+		return link;
+	}
+	catch (const std::exception& error)
+	{
+		delete link;
+		throw xe::Error("Failed to connect to ExecServer at: " + host + ":" + de::toString(port) + ", " + error.what());
+	}
+	catch (...)
+	{
+		delete link;
+		throw;
+	}
+}
+
+void createCommLinks (const CommandLine& cmdLine, vector<CommLinkPtr>& links)
 {
 	if (cmdLine.runMode == RUNMODE_START_SERVER)
 	{
-		xe::LocalTcpIpLink* link = new xe::LocalTcpIpLink();
-		try
-		{
-			link->start(cmdLine.serverBinOrAddress.c_str(), DE_NULL, cmdLine.port);
-			return link;
-		}
-		catch (...)
-		{
-			delete link;
-			throw;
-		}
+		for (int ndx = 0; ndx < cmdLine.numWorkers; ndx++)
+			links.push_back(CommLinkPtr(startLocalServer(cmdLine, cmdLine.port+ndx)));
 	}
 	else if (cmdLine.runMode == RUNMODE_CONNECT)
 	{
-		de::SocketAddress address;
+		vector<string> addresses;
 
-		address.setFamily(DE_SOCKETFAMILY_INET4);
-		address.setProtocol(DE_SOCKETPROTOCOL_TCP);
-		address.setHost(cmdLine.serverBinOrAddress.c_str());
-		address.setPort(cmdLine.port);
+		opt::parseCommaSeparatedList(cmdLine.serverBinOrAddress.c_str(), &addresses);
 
-		xe::TcpIpLink* link = new xe::TcpIpLink();
-		try
-		{
-			std::string error;
+		if (addresses.empty())
+			throw xe::Error("No execserver address given");
 
-			link->connect(address);
-			return link;
-		}
-		catch (const std::exception& error)
-		{
-			delete link;
-			throw xe::Error("Failed to connect to ExecServer at: " + cmdLine.serverBinOrAddress + ":" + de::toString(cmdLine.port) + ", " + error.what());
-		}
-		catch (...)
+		for (vector<string>::const_iterator addrIter = addresses.begin(); addrIter != addresses.end(); ++addrIter)
 		{
-			delete link;
-			throw;
+			const size_t	portPos	= addrIter->find(':');
+			const string	host	= addrIter->substr(0, portPos);
+			const int		port	= portPos != string::npos ? atoi(addrIter->c_str()+portPos+1) : cmdLine.port;
+
+			links.push_back(CommLinkPtr(connectToServer(host, port, cmdLine.logCompression)));
 		}
 	}
 	else
-	{
 		DE_ASSERT(false);
-		return DE_NULL;
-	}
 }
 
 #if (DE_OS == DE_OS_UNIX) || (DE_OS == DE_OS_ANDROID)
 
-static xe::BatchExecutor* s_executor = DE_NULL;
+static xe::BatchExecutor*			s_executor			= DE_NULL;
+static xe::ParallelBatchExecutor*	s_parallelExecutor	= DE_NULL;
 
 void signalHandler (int, siginfo_t*, void*)
 {
 	if (s_executor)
 		s_executor->cancel();
+
+	if (s_parallelExecutor)
+		s_parallelExecutor->cancel();
 }
 
-void setupSignalHandler (xe::BatchExecutor* executor)
+void setupSignalHandler (xe::BatchExecutor* executor, xe::ParallelBatchExecutor* parallelExecutor)
 {
-	s_executor = executor;
+	s_executor			= executor;
+	s_parallelExecutor	= parallelExecutor;
 	struct sigaction sa;
 
 	sa.sa_sigaction = signalHandler;
@@ -537,34 +598,41 @@ void resetSignalHandler (void)
 	sigfillset(&sa.sa_mask);
 
 	sigaction(SIGINT, &sa, DE_NULL);
-	s_executor = DE_NULL;
+	s_executor			= DE_NULL;
+	s_parallelExecutor	= DE_NULL;
 }
 
 #elif (DE_OS == DE_OS_WIN32)
 
-static xe::BatchExecutor* s_executor = DE_NULL;
+static xe::BatchExecutor*			s_executor			= DE_NULL;
+static xe::ParallelBatchExecutor*	s_parallelExecutor	= DE_NULL;
 
 void signalHandler (int)
 {
 	if (s_executor)
 		s_executor->cancel();
+
+	if (s_parallelExecutor)
+		s_parallelExecutor->cancel();
 }
 
-void setupSignalHandler (xe::BatchExecutor* executor)
+void setupSignalHandler (xe::BatchExecutor* executor, xe::ParallelBatchExecutor* parallelExecutor)
 {
-	s_executor = executor;
+	s_executor			= executor;
+	s_parallelExecutor	= parallelExecutor;
 	signal(SIGINT, signalHandler);
 }
 
 void resetSignalHandler (void)
 {
 	signal(SIGINT, SIG_DFL);
-	s_executor = DE_NULL;
+	s_executor			= DE_NULL;
+	s_parallelExecutor	= DE_NULL;
 }
 
 #else
 
-void setupSignalHandler (xe::BatchExecutor*)
+void setupSignalHandler (xe::BatchExecutor*, xe::ParallelBatchExecutor*)
 {
 }
 
@@ -574,6 +642,35 @@ void resetSignalHandler (void)
 
 #endif
 
+void writeOutputs (const CommandLine& cmdLine, const xe::TestNode* root, const xe::TestSet& testSet, const xe::BatchResult& batchResult, const xe::InfoLog& infoLog)
+{
+	if (!cmdLine.outFile.empty())
+	{
+		xe::writeBatchResultToFile(batchResult, cmdLine.outFile.c_str());
+		printf("Test log written to %s\n", cmdLine.outFile.c_str());
+	}
+
+	if (!cmdLine.infoFile.empty())
+	{
+		writeInfoLog(infoLog, cmdLine.infoFile.c_str());
+		printf("Info log written to %s\n", cmdLine.infoFile.c_str());
+	}
+
+	if (cmdLine.summary)
+		printBatchResultSummary(root, testSet, batchResult);
+}
+
+void updateCaseTimings (const CommandLine& cmdLine, xe::CaseTimingDatabase& caseTimings, const xe::BatchResult& batchResult, const std::set<string>& previousCases)
+{
+	if (!cmdLine.timingsFile.empty())
+	{
+		const int numAdded = caseTimings.addBatchResult(batchResult, previousCases);
+
+		caseTimings.write(cmdLine.timingsFile.c_str());
+		printf("Case timings (%d new) written to %s\n", numAdded, cmdLine.timingsFile.c_str());
+	}
+}
+
 void runExecutor (const CommandLine& cmdLine)
 {
 	xe::TestRoot root;
@@ -603,58 +700,60 @@ void runExecutor (const CommandLine& cmdLine)
 	if (!cmdLine.inFile.empty())
 		readLogFile(&batchResult, cmdLine.inFile.c_str());
 
-	// Initialize commLink.
-	std::auto_ptr<xe::CommLink> commLink(createCommLink(cmdLine));
+	// Cases executed in previous run are not measured again.
+	std::set<string> previousCases;
+	xe::getExecutedCases(previousCases, batchResult);
 
-	xe::BatchExecutor executor(cmdLine.targetCfg, commLink.get(), &root, testSet, &batchResult, &infoLog);
+	// Read case timings from previous runs (if supplied).
+	xe::CaseTimingDatabase caseTimings;
+
+	if (!cmdLine.timingsFile.empty() && deFileExists(cmdLine.timingsFile.c_str()))
+		caseTimings.read(cmdLine.timingsFile.c_str());
+
+	// Initialize commLinks.
+	vector<CommLinkPtr> commLinks;
+	createCommLinks(cmdLine, commLinks);
 
 	try
 	{
-		setupSignalHandler(&executor);
-		executor.run();
-		resetSignalHandler();
-	}
-	catch (...)
-	{
-		resetSignalHandler();
-
-		if (!cmdLine.outFile.empty())
+		if (commLinks.size() == 1)
 		{
-			xe::writeBatchResultToFile(batchResult, cmdLine.outFile.c_str());
-			printf("Test log written to %s\n", cmdLine.outFile.c_str());
-		}
+			xe::BatchExecutor executor(cmdLine.targetCfg, commLinks[0].get(), &root, testSet, &batchResult, &infoLog);
 
-		if (!cmdLine.infoFile.empty())
-		{
-			writeInfoLog(infoLog, cmdLine.infoFile.c_str());
-			printf("Info log written to %s\n", cmdLine.infoFile.c_str());
+			setupSignalHandler(&executor, DE_NULL);
+			executor.run();
+			resetSignalHandler();
 		}
+		else
+		{
+			vector<xe::CommLink*> links;
 
-		if (cmdLine.summary)
-			printBatchResultSummary(&root, testSet, batchResult);
+			for (size_t ndx = 0; ndx < commLinks.size(); ndx++)
+				links.push_back(commLinks[ndx].get());
 
-		throw;
-	}
+			xe::ParallelBatchExecutor executor(cmdLine.targetCfg, links, &root, testSet, &batchResult, &infoLog, caseTimings.getNumCases() > 0 ? &caseTimings : DE_NULL);
 
-	if (!cmdLine.outFile.empty())
-	{
-		xe::writeBatchResultToFile(batchResult, cmdLine.outFile.c_str());
-		printf("Test log written to %s\n", cmdLine.outFile.c_str());
+			setupSignalHandler(DE_NULL, &executor);
+			executor.run();
+			resetSignalHandler();
+		}
 	}
-
-	if (!cmdLine.infoFile.empty())
+	catch (...)
 	{
-		writeInfoLog(infoLog, cmdLine.infoFile.c_str());
-		printf("Info log written to %s\n", cmdLine.infoFile.c_str());
+		resetSignalHandler();
+		writeOutputs(cmdLine, &root, testSet, batchResult, infoLog);
+		updateCaseTimings(cmdLine, caseTimings, batchResult, previousCases);
+		throw;
 	}
 
-	if (cmdLine.summary)
-		printBatchResultSummary(&root, testSet, batchResult);
+	writeOutputs(cmdLine, &root, testSet, batchResult, infoLog);
+	updateCaseTimings(cmdLine, caseTimings, batchResult, previousCases);
 
+	for (size_t ndx = 0; ndx < commLinks.size(); ndx++)
 	{
 		string err;
 
-		if (commLink->getState(err) == xe::COMMLINKSTATE_ERROR)
+		if (commLinks[ndx]->getState(err) == xe::COMMLINKSTATE_ERROR)
 			throw xe::Error(err);
 	}
 }
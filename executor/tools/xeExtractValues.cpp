@@ -21,8 +21,7 @@
  * \brief Extract values by name from logs.
  *//*--------------------------------------------------------------------*/
 
-#include "xeTestLogParser.hpp"
-#include "xeTestResultParser.hpp"
+#include "xeParallelTestLogParser.hpp"
 #include "deFilePath.hpp"
 #include "deString.h"
 
@@ -42,13 +41,15 @@ using std::map;
 struct CommandLine
 {
 	CommandLine (void)
-		: statusCode(false)
+		: statusCode	(false)
+		, numWorkers	(xe::ParallelTestLogParser::getDefaultNumWorkers())
 	{
 	}
 
 	string			filename;
 	vector<string>	tagNames;
 	bool			statusCode;
+	int				numWorkers;
 };
 
 typedef xe::ri::NumericValue Value;
@@ -123,7 +124,7 @@ static Value findValueByTag (const xe::ri::List& items, const string& tagName)
 	return Value();
 }
 
-class TagParser : public xe::TestLogHandler
+class TagParser : public xe::ParsedTestLogHandler
 {
 public:
 	TagParser (BatchResultValues& result)
@@ -136,53 +137,25 @@ public:
 		// Ignored.
 	}
 
-	xe::TestCaseResultPtr startTestCaseResult (const char* casePath)
-	{
-		return xe::TestCaseResultPtr(new xe::TestCaseResultData(casePath));
-	}
-
-	void testCaseResultUpdated (const xe::TestCaseResultPtr&)
-	{
-		// Ignored.
-	}
-
-	void testCaseResultComplete (const xe::TestCaseResultPtr& caseData)
+	void testCaseResultParsed (const xe::TestCaseResultData& caseData, const xe::TestCaseResult& fullResult)
 	{
 		const vector<string>&	tagNames	= m_result.getTagNames();
 		CaseValues				tagResult;
 
-		tagResult.casePath		= caseData->getTestCasePath();
+		tagResult.casePath		= caseData.getTestCasePath();
 		tagResult.caseType		= xe::TESTCASETYPE_SELF_VALIDATE;
-		tagResult.statusCode	= caseData->getStatusCode();
-		tagResult.statusDetails	= caseData->getStatusDetails();
+		tagResult.statusCode	= caseData.getStatusCode();
+		tagResult.statusDetails	= caseData.getStatusDetails();
 		tagResult.values.resize(tagNames.size());
 
-		if (caseData->getDataSize() > 0 && caseData->getStatusCode() == xe::TESTSTATUSCODE_LAST)
+		// \note Status set by container (crash, timeout) takes precedence over parsed one.
+		if (tagResult.statusCode == xe::TESTSTATUSCODE_LAST)
 		{
-			xe::TestCaseResult					fullResult;
-			xe::TestResultParser::ParseResult	parseResult;
-
-			m_testResultParser.init(&fullResult);
-			parseResult = m_testResultParser.parse(caseData->getData(), caseData->getDataSize());
-
-			if ((parseResult != xe::TestResultParser::PARSERESULT_ERROR && fullResult.statusCode != xe::TESTSTATUSCODE_LAST) ||
-				(tagResult.statusCode == xe::TESTSTATUSCODE_LAST && fullResult.statusCode != xe::TESTSTATUSCODE_LAST))
-			{
-				tagResult.statusCode	= fullResult.statusCode;
-				tagResult.statusDetails	= fullResult.statusDetails;
-			}
-			else if (tagResult.statusCode == xe::TESTSTATUSCODE_LAST)
-			{
-				DE_ASSERT(parseResult == xe::TestResultParser::PARSERESULT_ERROR);
-				tagResult.statusCode	= xe::TESTSTATUSCODE_INTERNAL_ERROR;
-				tagResult.statusDetails	= "Test case result parsing failed";
-			}
-
-			if (parseResult != xe::TestResultParser::PARSERESULT_ERROR)
-			{
-				for (int valNdx = 0; valNdx < (int)tagNames.size(); valNdx++)
-					tagResult.values[valNdx] = findValueByTag(fullResult.resultItems, tagNames[valNdx]);
-			}
+			tagResult.statusCode	= fullResult.statusCode;
+			tagResult.statusDetails	= fullResult.statusDetails;
+
+			for (int valNdx = 0; valNdx < (int)tagNames.size(); valNdx++)
+				tagResult.values[valNdx] = findValueByTag(fullResult.resultItems, tagNames[valNdx]);
 		}
 
 		m_result.add(tagResult);
@@ -190,39 +163,21 @@ public:
 
 private:
 	BatchResultValues&		m_result;
-	xe::TestResultParser	m_testResultParser;
 };
 
-static void readLogFile (BatchResultValues& batchResult, const char* filename)
+static void readLogFile (BatchResultValues& batchResult, const char* filename, int numWorkers)
 {
-	std::ifstream		in				(filename, std::ifstream::binary|std::ifstream::in);
-	TagParser			resultHandler	(batchResult);
-	xe::TestLogParser	parser			(&resultHandler);
-	deUint8				buf				[1024];
-	int					numRead			= 0;
+	TagParser					resultHandler	(batchResult);
+	xe::ParallelTestLogParser	parser			(&resultHandler, numWorkers);
 
-	if (!in.good())
-		throw std::runtime_error(string("Failed to open '") + filename + "'");
-
-	for (;;)
-	{
-		in.read((char*)&buf[0], DE_LENGTH_OF_ARRAY(buf));
-		numRead = (int)in.gcount();
-
-		if (numRead <= 0)
-			break;
-
-		parser.parse(&buf[0], numRead);
-	}
-
-	in.close();
+	parser.parseFile(filename);
 }
 
 static void printTaggedValues (const CommandLine& cmdLine, std::ostream& dst)
 {
 	BatchResultValues values(cmdLine.tagNames);
 
-	readLogFile(values, cmdLine.filename.c_str());
+	readLogFile(values, cmdLine.filename.c_str(), cmdLine.numWorkers);
 
 	// Header
 	{
@@ -255,6 +210,7 @@ static void printHelp (const char* binName)
 {
 	printf("%s: [filename] [name 1] [[name 2]...]\n", binName);
 	printf(" --statuscode     Include status code as first entry.\n");
+	printf(" --jobs=[count]   Number of parser threads (default: number of cores).\n");
 }
 
 static bool parseCommandLine (CommandLine& cmdLine, int argc, const char* const* argv)
@@ -265,6 +221,12 @@ static bool parseCommandLine (CommandLine& cmdLine, int argc, const char* const*
 
 		if (deStringEqual(arg, "--statuscode"))
 			cmdLine.statusCode = true;
+		else if (deStringBeginsWith(arg, "--jobs="))
+		{
+			cmdLine.numWorkers = atoi(arg+7);
+			if (cmdLine.numWorkers <= 0)
+				return false;
+		}
 		else if (!deStringBeginsWith(arg, "--"))
 		{
 			if (cmdLine.filename.empty())
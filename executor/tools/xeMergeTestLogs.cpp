@@ -20,16 +20,18 @@
  * \file
  * \brief Merge two test logs.
  *
- * \todo [2013-11-08 pyry] Write variant that can operate with less memory.
+ * Source logs are memory-mapped and only their case indices are kept in
+ * memory; case data is copied out one case at a time while writing.
  *//*--------------------------------------------------------------------*/
 
-#include "xeTestLogParser.hpp"
-#include "xeTestResultParser.hpp"
+#include "xeMappedBatchResult.hpp"
 #include "xeTestLogWriter.hpp"
+#include "deSharedPtr.hpp"
 #include "deString.h"
 
 #include <vector>
 #include <string>
+#include <map>
 #include <cstdio>
 #include <cstdlib>
 #include <fstream>
@@ -38,12 +40,12 @@
 
 using std::vector;
 using std::string;
-using std::set;
 using std::map;
 
 enum Flags
 {
-	FLAG_USE_LAST_INFO = (1<<0)
+	FLAG_USE_LAST_INFO	= (1<<0),
+	FLAG_USE_INDEX		= (1<<1)
 };
 
 struct CommandLine
@@ -58,104 +60,100 @@ struct CommandLine
 	deUint32		flags;
 };
 
-class LogHandler : public xe::TestLogHandler
+static void combineSessionInfo (xe::SessionInfo& combinedInfo, const xe::SessionInfo& info, deUint32 flags)
 {
-public:
-	LogHandler (xe::BatchResult* batchResult, deUint32 flags)
-		: m_batchResult	(batchResult)
-		, m_flags		(flags)
+	if (flags & FLAG_USE_LAST_INFO)
 	{
+		if (!info.targetName.empty())		combinedInfo.targetName			= info.targetName;
+		if (!info.releaseId.empty())		combinedInfo.releaseId			= info.releaseId;
+		if (!info.releaseName.empty())		combinedInfo.releaseName		= info.releaseName;
+		if (!info.candyTargetName.empty())	combinedInfo.candyTargetName	= info.candyTargetName;
+		if (!info.configName.empty())		combinedInfo.configName			= info.configName;
+		if (!info.resultName.empty())		combinedInfo.resultName			= info.resultName;
+		if (!info.timestamp.empty())		combinedInfo.timestamp			= info.timestamp;
 	}
-
-	void setSessionInfo (const xe::SessionInfo& info)
-	{
-		xe::SessionInfo& combinedInfo = m_batchResult->getSessionInfo();
-
-		if (m_flags & FLAG_USE_LAST_INFO)
-		{
-			if (!info.targetName.empty())		combinedInfo.targetName			= info.targetName;
-			if (!info.releaseId.empty())		combinedInfo.releaseId			= info.releaseId;
-			if (!info.releaseName.empty())		combinedInfo.releaseName		= info.releaseName;
-			if (!info.candyTargetName.empty())	combinedInfo.candyTargetName	= info.candyTargetName;
-			if (!info.configName.empty())		combinedInfo.configName			= info.configName;
-			if (!info.resultName.empty())		combinedInfo.resultName			= info.resultName;
-			if (!info.timestamp.empty())		combinedInfo.timestamp			= info.timestamp;
-		}
-		else
-		{
-			if (combinedInfo.targetName.empty())		combinedInfo.targetName			= info.targetName;
-			if (combinedInfo.releaseId.empty())			combinedInfo.releaseId			= info.releaseId;
-			if (combinedInfo.releaseName.empty())		combinedInfo.releaseName		= info.releaseName;
-			if (combinedInfo.candyTargetName.empty())	combinedInfo.candyTargetName	= info.candyTargetName;
-			if (combinedInfo.configName.empty())		combinedInfo.configName			= info.configName;
-			if (combinedInfo.resultName.empty())		combinedInfo.resultName			= info.resultName;
-			if (combinedInfo.timestamp.empty())			combinedInfo.timestamp			= info.timestamp;
-		}
-	}
-
-	xe::TestCaseResultPtr startTestCaseResult (const char* casePath)
-	{
-		if (m_batchResult->hasTestCaseResult(casePath))
-		{
-			xe::TestCaseResultPtr existingResult = m_batchResult->getTestCaseResult(casePath);
-			existingResult->clear();
-			return existingResult;
-		}
-		else
-			return m_batchResult->createTestCaseResult(casePath);
-	}
-
-	void testCaseResultUpdated (const xe::TestCaseResultPtr&)
+	else
 	{
-		// Ignored.
+		if (combinedInfo.targetName.empty())		combinedInfo.targetName			= info.targetName;
+		if (combinedInfo.releaseId.empty())			combinedInfo.releaseId			= info.releaseId;
+		if (combinedInfo.releaseName.empty())		combinedInfo.releaseName		= info.releaseName;
+		if (combinedInfo.candyTargetName.empty())	combinedInfo.candyTargetName	= info.candyTargetName;
+		if (combinedInfo.configName.empty())		combinedInfo.configName			= info.configName;
+		if (combinedInfo.resultName.empty())		combinedInfo.resultName			= info.resultName;
+		if (combinedInfo.timestamp.empty())			combinedInfo.timestamp			= info.timestamp;
 	}
+}
 
-	void testCaseResultComplete (const xe::TestCaseResultPtr&)
+struct MergedCase
+{
+	MergedCase (int srcNdx_, int caseNdx_)
+		: srcNdx	(srcNdx_)
+		, caseNdx	(caseNdx_)
 	{
-		// Ignored.
 	}
 
-private:
-	xe::BatchResult* const	m_batchResult;
-	const deUint32			m_flags;
+	int		srcNdx;
+	int		caseNdx;
 };
 
-static void readLogFile (xe::BatchResult* dstResult, const char* filename, deUint32 flags)
+static void writeMergedLog (const vector<de::SharedPtr<xe::MappedBatchResult> >& srcResults, const xe::SessionInfo& sessionInfo, const vector<MergedCase>& cases, std::ostream& dst)
 {
-	std::ifstream		in				(filename, std::ifstream::binary|std::ifstream::in);
-	LogHandler			resultHandler	(dstResult, flags);
-	xe::TestLogParser	parser			(&resultHandler);
-	deUint8				buf				[2048];
-	int					numRead			= 0;
-
-	if (!in.good())
-		throw std::runtime_error(string("Failed to open '") + filename + "'");
+	xe::writeSessionBegin(sessionInfo, dst);
 
-	for (;;)
+	for (vector<MergedCase>::const_iterator caseIter = cases.begin(); caseIter != cases.end(); ++caseIter)
 	{
-		in.read((char*)&buf[0], DE_LENGTH_OF_ARRAY(buf));
-		numRead = (int)in.gcount();
-
-		if (numRead <= 0)
-			break;
-
-		parser.parse(&buf[0], numRead);
+		const xe::TestCaseResultPtr caseData = srcResults[caseIter->srcNdx]->getTestCaseResult(caseIter->caseNdx);
+		xe::writeTestCaseResultData(*caseData, dst);
 	}
 
-	in.close();
+	xe::writeSessionEnd(dst);
 }
 
 static void mergeTestLogs (const CommandLine& cmdLine)
 {
-	xe::BatchResult batchResult;
+	vector<de::SharedPtr<xe::MappedBatchResult> >	srcResults;
+	xe::SessionInfo									sessionInfo;
+	vector<MergedCase>								cases;
+	map<string, int>								caseMap;
 
 	for (vector<string>::const_iterator filename = cmdLine.srcFilenames.begin(); filename != cmdLine.srcFilenames.end(); ++filename)
-		readLogFile(&batchResult, filename->c_str(), cmdLine.flags);
+	{
+		const int		srcNdx		= (int)srcResults.size();
+		const string	indexName	= xe::getDefaultTestLogIndexFilename(filename->c_str());
+
+		srcResults.push_back(de::SharedPtr<xe::MappedBatchResult>(new xe::MappedBatchResult(filename->c_str(), (cmdLine.flags & FLAG_USE_INDEX) ? indexName.c_str() : DE_NULL)));
+
+		const xe::MappedBatchResult& srcResult = *srcResults.back();
+
+		combineSessionInfo(sessionInfo, srcResult.getSessionInfo(), cmdLine.flags);
+
+		// Later results replace earlier ones but keep original position.
+		for (int caseNdx = 0; caseNdx < srcResult.getNumTestCaseResults(); caseNdx++)
+		{
+			const string						casePath	= srcResult.getTestCasePath(caseNdx);
+			const map<string, int>::iterator	pos			= caseMap.find(casePath);
+
+			if (pos != caseMap.end())
+				cases[pos->second] = MergedCase(srcNdx, caseNdx);
+			else
+			{
+				caseMap[casePath] = (int)cases.size();
+				cases.push_back(MergedCase(srcNdx, caseNdx));
+			}
+		}
+	}
 
 	if (!cmdLine.dstFilename.empty())
-		xe::writeBatchResultToFile(batchResult, cmdLine.dstFilename.c_str());
+	{
+		std::ofstream out(cmdLine.dstFilename.c_str(), std::ofstream::binary|std::ofstream::trunc);
+
+		if (!out.good())
+			throw std::runtime_error(string("Failed to open '") + cmdLine.dstFilename + "'");
+
+		writeMergedLog(srcResults, sessionInfo, cases, out);
+	}
 	else
-		xe::writeTestLog(batchResult, std::cout);
+		writeMergedLog(srcResults, sessionInfo, cases, std::cout);
 }
 
 static void printHelp (const char* binName)
@@ -163,6 +161,7 @@ static void printHelp (const char* binName)
 	printf("%s: [filename] [[filename 2] ...]\n", binName);
 	printf("  --dst=[filename]    Write final log to file, otherwise written to stdout.\n");
 	printf("  --info=[first|last] Select which session info to use (default: first).\n");
+	printf("  --index             Read case index from [filename].index, create if missing or stale.\n");
 }
 
 static bool parseCommandLine (CommandLine& cmdLine, int argc, const char* const* argv)
@@ -183,6 +182,8 @@ static bool parseCommandLine (CommandLine& cmdLine, int argc, const char* const*
 			cmdLine.flags &= ~FLAG_USE_LAST_INFO;
 		else if (deStringEqual(arg, "--info=last"))
 			cmdLine.flags |= FLAG_USE_LAST_INFO;
+		else if (deStringEqual(arg, "--index"))
+			cmdLine.flags |= FLAG_USE_INDEX;
 		else
 			return false;
 	}
@@ -21,7 +21,8 @@
  * \brief Test log compare utility.
  *//*--------------------------------------------------------------------*/
 
-#include "xeTestLogParser.hpp"
+#include "xeMappedBatchResult.hpp"
+#include "xeParallelTestLogParser.hpp"
 #include "xeTestResultParser.hpp"
 #include "deFilePath.hpp"
 #include "deString.h"
@@ -36,6 +37,7 @@
 #include <iostream>
 #include <set>
 #include <map>
+#include <deque>
 
 using std::vector;
 using std::string;
@@ -72,6 +74,8 @@ namespace opt
 DE_DECLARE_COMMAND_LINE_OPT(OutMode,	OutputMode);
 DE_DECLARE_COMMAND_LINE_OPT(OutFormat,	OutputFormat);
 DE_DECLARE_COMMAND_LINE_OPT(OutValue,	OutputValue);
+DE_DECLARE_COMMAND_LINE_OPT(UseIndex,	bool);
+DE_DECLARE_COMMAND_LINE_OPT(NumWorkers,	int);
 
 static void registerOptions (de::cmdline::Parser& parser)
 {
@@ -96,7 +100,9 @@ static void registerOptions (de::cmdline::Parser& parser)
 
 	parser << Option<OutFormat>		("f",	"format",		"Output format",	s_outputFormats,	"csv")
 		   << Option<OutMode>		("m",	"mode",			"Output mode",		s_outputModes,		"all")
-		   << Option<OutValue>		("v",	"value",		"Value to extract",	s_outputValues,		"code");
+		   << Option<OutValue>		("v",	"value",		"Value to extract",	s_outputValues,		"code")
+		   << Option<UseIndex>		("i",	"index",		"Read case index from [filename].index, create if missing or stale")
+		   << Option<NumWorkers>	("j",	"jobs",			"Number of parser threads, 0 for number of cores", "0");
 }
 
 } // opt
@@ -107,12 +113,16 @@ struct CommandLine
 		: outMode	(OUTPUTMODE_ALL)
 		, outFormat	(OUTPUTFORMAT_CSV)
 		, outValue	(OUTPUTVALUE_STATUS_CODE)
+		, useIndex	(false)
+		, numWorkers(0)
 	{
 	}
 
 	OutputMode			outMode;
 	OutputFormat		outFormat;
 	OutputValue			outValue;
+	bool				useIndex;
+	int					numWorkers;
 	vector<string>		filenames;
 };
 
@@ -122,97 +132,108 @@ struct ShortBatchResult
 	map<string, int>					resultMap;
 };
 
-class ShortResultHandler : public xe::TestLogHandler
+// Receives fully parsed results for cases whose container did not set status.
+class FullResultHandler : public xe::ParsedTestLogHandler
 {
 public:
-	ShortResultHandler (ShortBatchResult& result)
+	FullResultHandler (ShortBatchResult& result)
 		: m_result(result)
 	{
 	}
 
-	void setSessionInfo (const xe::SessionInfo&)
-	{
-		// Ignored.
-	}
-
-	xe::TestCaseResultPtr startTestCaseResult (const char* casePath)
+	void addPendingCase (int caseNdx)
 	{
-		return xe::TestCaseResultPtr(new xe::TestCaseResultData(casePath));
+		m_pendingCases.push_back(caseNdx);
 	}
 
-	void testCaseResultUpdated (const xe::TestCaseResultPtr&)
+	void setSessionInfo (const xe::SessionInfo&)
 	{
 		// Ignored.
 	}
 
-	void testCaseResultComplete (const xe::TestCaseResultPtr& caseData)
+	void testCaseResultParsed (const xe::TestCaseResultData&, const xe::TestCaseResult& fullResult)
 	{
-		xe::TestCaseResultHeader	header;
-		int							caseNdx	= (int)m_result.resultHeaders.size();
-
-		header.casePath			= caseData->getTestCasePath();
-		header.caseType			= xe::TESTCASETYPE_SELF_VALIDATE;
-		header.statusCode		= caseData->getStatusCode();
-		header.statusDetails	= caseData->getStatusDetails();
+		// Results are delivered in queue order.
+		DE_ASSERT(!m_pendingCases.empty());
 
-		if (header.statusCode == xe::TESTSTATUSCODE_LAST)
-		{
-			xe::TestCaseResult fullResult;
-
-			xe::parseTestCaseResultFromData(&m_testResultParser, &fullResult, *caseData.get());
-
-			header = xe::TestCaseResultHeader(fullResult);
-		}
-
-		// Insert into result list & map.
-		m_result.resultHeaders.push_back(header);
-		m_result.resultMap[header.casePath] = caseNdx;
+		m_result.resultHeaders[m_pendingCases.front()] = xe::TestCaseResultHeader(fullResult);
+		m_pendingCases.pop_front();
 	}
 
 private:
 	ShortBatchResult&		m_result;
-	xe::TestResultParser	m_testResultParser;
+	std::deque<int>			m_pendingCases;
 };
 
-static void readLogFile (ShortBatchResult& batchResult, const char* filename)
+static void readLogFile (ShortBatchResult& batchResult, const char* filename, bool useIndex, int numWorkers)
 {
-	std::ifstream		in				(filename, std::ifstream::binary|std::ifstream::in);
-	ShortResultHandler	resultHandler	(batchResult);
-	xe::TestLogParser	parser			(&resultHandler);
-	deUint8				buf				[1024];
-	int					numRead			= 0;
+	const std::string			indexFilename		= xe::getDefaultTestLogIndexFilename(filename);
+	const xe::MappedBatchResult	mappedResult		(filename, useIndex ? indexFilename.c_str() : DE_NULL);
+	FullResultHandler			fullResultHandler	(batchResult);
+	xe::ParallelTestLogParser	fullResultParser	(&fullResultHandler, numWorkers);
+
+	batchResult.resultHeaders.resize(mappedResult.getNumTestCaseResults());
 
-	for (;;)
+	for (int caseNdx = 0; caseNdx < mappedResult.getNumTestCaseResults(); caseNdx++)
 	{
-		in.read((char*)&buf[0], DE_LENGTH_OF_ARRAY(buf));
-		numRead = (int)in.gcount();
+		xe::TestCaseResultHeader& header = batchResult.resultHeaders[caseNdx];
+
+		header.casePath			= mappedResult.getTestCasePath(caseNdx);
+		header.caseType			= xe::TESTCASETYPE_SELF_VALIDATE;
 
-		if (numRead <= 0)
-			break;
+		// Only this case is copied out of the mapping; data is parsed if container did not set status.
+		{
+			const xe::TestCaseResultPtr caseData = mappedResult.getTestCaseResult(caseNdx);
+
+			header.statusCode		= caseData->getStatusCode();
+			header.statusDetails	= caseData->getStatusDetails();
 
-		parser.parse(&buf[0], numRead);
+			if (header.statusCode == xe::TESTSTATUSCODE_LAST)
+			{
+				fullResultHandler.addPendingCase(caseNdx);
+				fullResultParser.queueTestCaseResult(caseData);
+			}
+		}
 	}
 
-	in.close();
+	fullResultParser.finish();
+
+	// Case path from full parse may differ from container, so map is built last.
+	for (int caseNdx = 0; caseNdx < (int)batchResult.resultHeaders.size(); caseNdx++)
+		batchResult.resultMap[batchResult.resultHeaders[caseNdx].casePath] = caseNdx;
 }
 
 class LogFileReader : public de::Thread
 {
 public:
-	LogFileReader (ShortBatchResult& batchResult, const char* filename)
+	LogFileReader (ShortBatchResult& batchResult, const char* filename, bool useIndex, int numWorkers)
 		: m_batchResult	(batchResult)
 		, m_filename	(filename)
+		, m_useIndex	(useIndex)
+		, m_numWorkers	(numWorkers)
 	{
 	}
 
 	void run (void)
 	{
-		readLogFile(m_batchResult, m_filename.c_str());
+		try
+		{
+			readLogFile(m_batchResult, m_filename.c_str(), m_useIndex, m_numWorkers);
+		}
+		catch (const std::exception& e)
+		{
+			m_error = e.what();
+		}
 	}
 
+	const std::string& getError (void) const { return m_error; }
+
 private:
 	ShortBatchResult&	m_batchResult;
 	std::string			m_filename;
+	bool				m_useIndex;
+	int					m_numWorkers;
+	std::string			m_error;
 };
 
 static void computeCaseList (vector<string>& cases, const vector<ShortBatchResult>& batchResults)
@@ -274,11 +295,13 @@ static bool runCompare (const CommandLine& cmdLine, std::ostream& dst)
 		// Read in batch results
 		results.resize(cmdLine.filenames.size());
 		{
-			std::vector<de::SharedPtr<LogFileReader> > readers;
+			// Files are read concurrently so parser threads are divided between them.
+			const int									numWorkersPerFile	= de::max(1, cmdLine.numWorkers / (int)cmdLine.filenames.size());
+			std::vector<de::SharedPtr<LogFileReader> >	readers;
 
 			for (int ndx = 0; ndx < (int)cmdLine.filenames.size(); ndx++)
 			{
-				readers.push_back(de::SharedPtr<LogFileReader>(new LogFileReader(results[ndx], cmdLine.filenames[ndx].c_str())));
+				readers.push_back(de::SharedPtr<LogFileReader>(new LogFileReader(results[ndx], cmdLine.filenames[ndx].c_str(), cmdLine.useIndex, numWorkersPerFile)));
 				readers.back()->start();
 			}
 
@@ -286,6 +309,9 @@ static bool runCompare (const CommandLine& cmdLine, std::ostream& dst)
 			{
 				readers[ndx]->join();
 
+				if (!readers[ndx]->getError().empty())
+					throw xe::Error(cmdLine.filenames[ndx] + ": " + readers[ndx]->getError());
+
 				// Use file name as batch name.
 				batchNames.push_back(de::FilePath(cmdLine.filenames[ndx].c_str()).getBaseName());
 			}
@@ -384,8 +410,18 @@ static bool parseCommandLine (CommandLine& cmdLine, int argc, const char* const*
 	cmdLine.outFormat	= opts.getOption<opt::OutFormat>();
 	cmdLine.outMode		= opts.getOption<opt::OutMode>();
 	cmdLine.outValue	= opts.getOption<opt::OutValue>();
+	cmdLine.useIndex	= opts.getOption<opt::UseIndex>();
+	cmdLine.numWorkers	= opts.getOption<opt::NumWorkers>();
 	cmdLine.filenames	= opts.getArgs();
 
+	if (cmdLine.numWorkers < 0)
+	{
+		std::cerr << "Invalid number of jobs\n";
+		return false;
+	}
+	else if (cmdLine.numWorkers == 0)
+		cmdLine.numWorkers = xe::ParallelTestLogParser::getDefaultNumWorkers();
+
 	return true;
 }
 
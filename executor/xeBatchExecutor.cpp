@@ -25,7 +25,7 @@
 #include "xeTestResultParser.hpp"
 
 #include <sstream>
-#include <cstdio>
+#include <algorithm>
 
 namespace xe
 {
@@ -36,7 +36,10 @@ using std::vector;
 enum
 {
 	TEST_LOG_TMP_BUFFER_SIZE	= 1024,
-	INFO_LOG_TMP_BUFFER_SIZE	= 256
+	INFO_LOG_TMP_BUFFER_SIZE	= 256,
+
+	CHUNKS_PER_WORKER			= 2,	//!< Chunk duration is remaining duration / (workers * CHUNKS_PER_WORKER)
+	MIN_STEAL_SIZE				= 2		//!< Minimum number of unstarted cases to steal from
 };
 
 // \todo [2012-11-01 pyry] Update execute set in handler.
@@ -95,6 +98,12 @@ static void computeBatchRequest (TestSet& requestSet, const TestSet& executeSet,
 	}
 }
 
+static void appendInfoLog (InfoLog* infoLog, const string& message)
+{
+	if (infoLog)
+		infoLog->append((const deUint8*)message.c_str(), message.size());
+}
+
 static int removeExecuted (TestSet& set, const TestNode* root, const BatchResult* batchResult)
 {
 	TestSet					oldSet		(set);
@@ -121,8 +130,9 @@ static int removeExecuted (TestSet& set, const TestNode* root, const BatchResult
 	return numRemoved;
 }
 
-BatchExecutorLogHandler::BatchExecutorLogHandler (BatchResult* batchResult)
-	: m_batchResult(batchResult)
+BatchExecutorLogHandler::BatchExecutorLogHandler (BatchResult* batchResult, InfoLog* infoLog)
+	: m_batchResult	(batchResult)
+	, m_infoLog		(infoLog)
 {
 }
 
@@ -151,7 +161,7 @@ void BatchExecutorLogHandler::testCaseResultUpdated (const TestCaseResultPtr&)
 void BatchExecutorLogHandler::testCaseResultComplete (const TestCaseResultPtr& result)
 {
 	// \todo [2012-11-01 pyry] Remove from execute set here instead of updating it between sessions.
-	printf("%s\n", result->getTestCasePath());
+	appendInfoLog(m_infoLog, string(result->getTestCasePath()) + "\n");
 }
 
 BatchExecutor::BatchExecutor (const TargetConfiguration& config, CommLink* commLink, const TestNode* root, const TestSet& testSet, BatchResult* batchResult, InfoLog* infoLog)
@@ -159,7 +169,7 @@ BatchExecutor::BatchExecutor (const TargetConfiguration& config, CommLink* commL
 	, m_commLink		(commLink)
 	, m_root			(root)
 	, m_testSet			(testSet)
-	, m_logHandler		(batchResult)
+	, m_logHandler		(batchResult, infoLog)
 	, m_batchResult		(batchResult)
 	, m_infoLog			(infoLog)
 	, m_state			(STATE_NOT_STARTED)
@@ -270,12 +280,12 @@ void BatchExecutor::onStateChanged (CommLinkState state, const char* message)
 		}
 
 		case COMMLINKSTATE_TEST_PROCESS_LAUNCH_FAILED:
-			printf("Failed to start test process: '%s'\n", message);
+			appendInfoLog(m_infoLog, string("Failed to start test process: '") + message + "'\n");
 			m_state = STATE_FINISHED;
 			break;
 
 		case COMMLINKSTATE_ERROR:
-			printf("CommLink error: '%s'\n", message);
+			appendInfoLog(m_infoLog, string("CommLink error: '") + message + "'\n");
 			m_state = STATE_FINISHED;
 			break;
 
@@ -418,4 +428,534 @@ void BatchExecutor::dispatchInfoLogData (CallReader& data)
 	executor->onInfoLogData(data.getDataBlock(numBytes), numBytes);
 }
 
+// ParallelBatchExecutor
+
+ParallelBatchExecutor::Worker::Worker (ParallelBatchExecutor* executor_, CommLink* link_)
+	: executor				(executor_)
+	, link					(link_)
+	, parser				(this)
+	, state					(STATE_IDLE)
+	, chunkEnd				(0)
+	, sessionEnd			(0)
+	, nextCase				(0)
+	, numCompletedInSession	(0)
+{
+}
+
+void ParallelBatchExecutor::Worker::setSessionInfo (const SessionInfo& sessionInfo)
+{
+	executor->m_batchResult->getSessionInfo() = sessionInfo;
+}
+
+TestCaseResultPtr ParallelBatchExecutor::Worker::startTestCaseResult (const char* casePath)
+{
+	// \note Results are kept separate until case is known to belong to this worker.
+	return TestCaseResultPtr(new TestCaseResultData(casePath));
+}
+
+void ParallelBatchExecutor::Worker::testCaseResultUpdated (const TestCaseResultPtr&)
+{
+}
+
+void ParallelBatchExecutor::Worker::testCaseResultComplete (const TestCaseResultPtr& result)
+{
+	executor->onCaseComplete(*this, result);
+}
+
+ParallelBatchExecutor::ParallelBatchExecutor (const TargetConfiguration& config, const std::vector<CommLink*>& commLinks, const TestNode* root, const TestSet& testSet, BatchResult* batchResult, InfoLog* infoLog, const CaseTimingDatabase* caseTimings)
+	: m_config		(config)
+	, m_root		(root)
+	, m_testSet		(testSet)
+	, m_batchResult	(batchResult)
+	, m_infoLog		(infoLog)
+	, m_caseTimings	(caseTimings)
+	, m_isCanceled	(false)
+{
+	for (size_t ndx = 0; ndx < commLinks.size(); ndx++)
+		m_workers.push_back(WorkerPtr(new Worker(this, commLinks[ndx])));
+}
+
+ParallelBatchExecutor::~ParallelBatchExecutor (void)
+{
+}
+
+void ParallelBatchExecutor::run (void)
+{
+	XE_CHECK(!m_workers.empty());
+	XE_CHECK(m_cases.empty());
+
+	// Check commlink states.
+	for (size_t ndx = 0; ndx < m_workers.size(); ndx++)
+	{
+		std::string				stateStr;
+		const CommLinkState		commState	= m_workers[ndx]->link->getState(stateStr);
+
+		if (commState == COMMLINKSTATE_ERROR)
+			XE_FAIL((string("CommLink error: '") + stateStr + "'").c_str());
+		else if (commState != COMMLINKSTATE_READY)
+			XE_FAIL("CommLink is not ready");
+	}
+
+	scheduleCases();
+
+	// Register callbacks.
+	for (size_t ndx = 0; ndx < m_workers.size(); ndx++)
+		m_workers[ndx]->link->setCallbacks(enqueueStateChanged, enqueueTestLogData, enqueueInfoLogData, m_workers[ndx].get());
+
+	try
+	{
+		for (size_t ndx = 0; ndx < m_workers.size(); ndx++)
+			assignWork(*m_workers[ndx]);
+
+		// Run handler loop until all workers are finished.
+		while (!m_isCanceled && isRunning())
+			m_dispatcher.callNext();
+
+		if (m_isCanceled)
+		{
+			for (size_t ndx = 0; ndx < m_workers.size(); ndx++)
+			{
+				if (m_workers[ndx]->state == Worker::STATE_RUNNING)
+					m_workers[ndx]->link->stopTestProcess();
+			}
+		}
+	}
+	catch (...)
+	{
+		for (size_t ndx = 0; ndx < m_workers.size(); ndx++)
+			m_workers[ndx]->link->setCallbacks(DE_NULL, DE_NULL, DE_NULL, DE_NULL);
+
+		mergeResults();
+		throw;
+	}
+
+	// De-register callbacks.
+	for (size_t ndx = 0; ndx < m_workers.size(); ndx++)
+		m_workers[ndx]->link->setCallbacks(DE_NULL, DE_NULL, DE_NULL, DE_NULL);
+
+	mergeResults();
+
+	// All workers have retired if cases are still left.
+	if (!m_isCanceled && !m_unassigned.empty())
+	{
+		std::ostringstream	message;
+		int					numNotExecuted	= 0;
+
+		for (std::deque<CaseRange>::const_iterator iter = m_unassigned.begin(); iter != m_unassigned.end(); ++iter)
+			numNotExecuted += iter->end - iter->begin;
+
+		message << numNotExecuted << " test cases were not executed, all test processes failed";
+		XE_FAIL(message.str().c_str());
+	}
+}
+
+namespace
+{
+
+struct LongerDuration
+{
+	template <typename T>
+	bool operator() (const T& a, const T& b) const { return a.duration > b.duration; }
+};
+
+struct EarlierInHierarchy
+{
+	template <typename T>
+	bool operator() (const T& a, const T& b) const { return a.hierarchyNdx < b.hierarchyNdx; }
+};
+
+} // anonymous
+
+void ParallelBatchExecutor::scheduleCases (void)
+{
+	TestSet executeSet;
+
+	computeExecuteSet(executeSet, m_root, m_testSet, m_batchResult);
+
+	for (ConstTestNodeIterator iter = ConstTestNodeIterator::begin(m_root); iter != ConstTestNodeIterator::end(m_root); ++iter)
+	{
+		const TestNode* node = *iter;
+
+		if (node->getNodeType() == TESTNODETYPE_TEST_CASE && executeSet.hasNode(node))
+		{
+			const TestCase* testCase = static_cast<const TestCase*>(node);
+			m_cases.push_back(ScheduledCase(testCase, (int)m_cases.size(), 1));
+		}
+	}
+
+	if (m_caseTimings)
+	{
+		// Unknown cases are expected to take average time of known ones.
+		deInt64	totalKnown	= 0;
+		int		numKnown	= 0;
+
+		for (size_t ndx = 0; ndx < m_cases.size(); ndx++)
+		{
+			const deInt64 duration = m_caseTimings->getDuration(m_cases[ndx].testCase->getFullPath().c_str(), -1);
+
+			if (duration >= 0)
+			{
+				// \note Durations are kept positive so that every case advances chunk duration.
+				m_cases[ndx].duration	= duration+1;
+				totalKnown				+= duration+1;
+				numKnown				+= 1;
+			}
+			else
+				m_cases[ndx].duration	= -1;
+		}
+
+		for (size_t ndx = 0; ndx < m_cases.size(); ndx++)
+		{
+			if (m_cases[ndx].duration < 0)
+				m_cases[ndx].duration = numKnown > 0 ? totalKnown / numKnown : 1;
+		}
+
+		// Longest processing time first. Ties keep hierarchy order.
+		std::stable_sort(m_cases.begin(), m_cases.end(), LongerDuration());
+	}
+
+	m_durationPrefix.resize(m_cases.size()+1);
+	m_durationPrefix[0] = 0;
+
+	for (size_t ndx = 0; ndx < m_cases.size(); ndx++)
+	{
+		m_durationPrefix[ndx+1]							= m_durationPrefix[ndx] + m_cases[ndx].duration;
+		m_caseIndex[m_cases[ndx].testCase->getFullPath()]	= (int)ndx;
+	}
+
+	m_results.resize(m_cases.size());
+
+	if (!m_cases.empty())
+		m_unassigned.push_back(CaseRange(0, (int)m_cases.size()));
+}
+
+void ParallelBatchExecutor::sortChunk (int begin, int end)
+{
+	// Test process executes cases in hierarchy order, so chunk must be in that order too.
+	std::sort(m_cases.begin()+begin, m_cases.begin()+end, EarlierInHierarchy());
+
+	for (int ndx = begin; ndx < end; ndx++)
+	{
+		m_durationPrefix[ndx+1]							= m_durationPrefix[ndx] + m_cases[ndx].duration;
+		m_caseIndex[m_cases[ndx].testCase->getFullPath()]	= ndx;
+	}
+}
+
+void ParallelBatchExecutor::cancel (void)
+{
+	m_isCanceled = true;
+	m_dispatcher.cancel();
+}
+
+bool ParallelBatchExecutor::isRunning (void) const
+{
+	for (size_t ndx = 0; ndx < m_workers.size(); ndx++)
+	{
+		if (m_workers[ndx]->state == Worker::STATE_RUNNING || m_workers[ndx]->state == Worker::STATE_STOPPING)
+			return true;
+	}
+
+	return false;
+}
+
+void ParallelBatchExecutor::assignWork (Worker& worker)
+{
+	DE_ASSERT(worker.state == Worker::STATE_IDLE);
+
+	if (!m_isCanceled && (takeChunk(worker) || stealChunk(worker)))
+		launchChunk(worker);
+}
+
+bool ParallelBatchExecutor::takeChunk (Worker& worker)
+{
+	if (m_unassigned.empty())
+		return false;
+
+	{
+		deInt64 remainingDuration = 0;
+
+		for (std::deque<CaseRange>::const_iterator iter = m_unassigned.begin(); iter != m_unassigned.end(); ++iter)
+			remainingDuration += getRangeDuration(iter->begin, iter->end);
+
+		{
+			CaseRange&		range			= m_unassigned.front();
+			const deInt64	targetDuration	= remainingDuration / ((deInt64)m_workers.size() * CHUNKS_PER_WORKER);
+			const int		maxChunkSize	= de::min(range.end - range.begin, de::max(m_config.maxCasesPerSession, 1));
+			int				chunkSize		= 1;
+
+			while (chunkSize < maxChunkSize && getRangeDuration(range.begin, range.begin+chunkSize+1) <= targetDuration)
+				chunkSize += 1;
+
+			worker.nextCase	= range.begin;
+			worker.chunkEnd	= range.begin + chunkSize;
+			range.begin		+= chunkSize;
+
+			if (range.begin == range.end)
+				m_unassigned.pop_front();
+		}
+	}
+
+	sortChunk(worker.nextCase, worker.chunkEnd);
+
+	return true;
+}
+
+bool ParallelBatchExecutor::stealChunk (Worker& worker)
+{
+	Worker*		victim				= DE_NULL;
+	deInt64		maxUnstartedDuration	= 0;
+
+	// \note Case at nextCase may already be running.
+	for (size_t ndx = 0; ndx < m_workers.size(); ndx++)
+	{
+		Worker&			candidate			= *m_workers[ndx];
+		const int		numUnstarted		= candidate.chunkEnd - (candidate.nextCase+1);
+
+		if (candidate.state == Worker::STATE_RUNNING && numUnstarted >= MIN_STEAL_SIZE)
+		{
+			const deInt64 unstartedDuration = getRangeDuration(candidate.nextCase+1, candidate.chunkEnd);
+
+			if (unstartedDuration > maxUnstartedDuration)
+			{
+				victim					= &candidate;
+				maxUnstartedDuration	= unstartedDuration;
+			}
+		}
+	}
+
+	if (!victim)
+		return false;
+
+	{
+		// Take cases from the end of the chunk until about half of the unstarted duration is taken.
+		int cut = victim->chunkEnd-1;
+
+		while (cut-1 > victim->nextCase+1 && getRangeDuration(cut-1, victim->chunkEnd) <= maxUnstartedDuration/2)
+			cut -= 1;
+
+		worker.nextCase		= cut;
+		worker.chunkEnd		= victim->chunkEnd;
+		victim->chunkEnd	= cut;
+	}
+
+	return true;
+}
+
+void ParallelBatchExecutor::launchChunk (Worker& worker)
+{
+	TestSet				caseSet;
+	std::ostringstream	caseList;
+
+	DE_ASSERT(worker.nextCase < worker.chunkEnd);
+
+	for (int ndx = worker.nextCase; ndx < worker.chunkEnd; ndx++)
+		caseSet.addCase(m_cases[ndx].testCase);
+
+	XE_CHECK(caseSet.hasNode(m_root));
+	XE_CHECK(m_root->getNodeType() == TESTNODETYPE_ROOT);
+	writeCaseListNode(caseList, m_root, caseSet);
+
+	worker.parser.reset();
+	worker.state					= Worker::STATE_RUNNING;
+	worker.sessionEnd				= worker.chunkEnd;
+	worker.numCompletedInSession	= 0;
+
+	worker.link->startTestProcess(m_config.binaryName.c_str(), m_config.cmdLineArgs.c_str(), m_config.workingDir.c_str(), caseList.str().c_str());
+}
+
+void ParallelBatchExecutor::retireWorker (Worker& worker, const char* reason)
+{
+	appendInfoLog(m_infoLog, string("Test process failed: '") + reason + "'\n");
+
+	// Give unfinished cases to other workers.
+	if (worker.nextCase < worker.chunkEnd)
+		m_unassigned.push_front(CaseRange(worker.nextCase, worker.chunkEnd));
+
+	worker.state	= Worker::STATE_RETIRED;
+	worker.nextCase	= 0;
+	worker.chunkEnd	= 0;
+
+	for (size_t ndx = 0; ndx < m_workers.size(); ndx++)
+	{
+		if (m_workers[ndx]->state == Worker::STATE_IDLE)
+			assignWork(*m_workers[ndx]);
+	}
+}
+
+void ParallelBatchExecutor::mergeResults (void)
+{
+	for (size_t ndx = 0; ndx < m_results.size(); ndx++)
+	{
+		if (m_results[ndx])
+		{
+			const char* const	casePath	= m_results[ndx]->getTestCasePath();
+			TestCaseResultPtr	dst			= m_batchResult->hasTestCaseResult(casePath) ? m_batchResult->getTestCaseResult(casePath)
+																						 : m_batchResult->createTestCaseResult(casePath);
+
+			*dst = *m_results[ndx];
+			m_results[ndx].clear();
+		}
+	}
+}
+
+void ParallelBatchExecutor::onCaseComplete (Worker& worker, const TestCaseResultPtr& result)
+{
+	const std::map<std::string, int>::const_iterator pos = m_caseIndex.find(result->getTestCasePath());
+
+	// Ignore unknown cases and cases that were stolen by another worker.
+	if (pos == m_caseIndex.end() || !de::inBounds(pos->second, worker.nextCase, worker.chunkEnd))
+		return;
+
+	m_results[m_cases[pos->second].hierarchyNdx]	= result;
+	worker.nextCase									= pos->second+1;
+	worker.numCompletedInSession					+= 1;
+
+	appendInfoLog(m_infoLog, string(result->getTestCasePath()) + "\n");
+
+	// Stop test process if rest of its cases have been stolen.
+	if (worker.state == Worker::STATE_RUNNING && worker.nextCase == worker.chunkEnd && worker.chunkEnd < worker.sessionEnd)
+	{
+		worker.state = Worker::STATE_STOPPING;
+		worker.link->stopTestProcess();
+	}
+}
+
+void ParallelBatchExecutor::onStateChanged (Worker& worker, CommLinkState state, const char* message)
+{
+	switch (state)
+	{
+		case COMMLINKSTATE_READY:
+		case COMMLINKSTATE_TEST_PROCESS_LAUNCHING:
+		case COMMLINKSTATE_TEST_PROCESS_RUNNING:
+			break; // Ignore.
+
+		case COMMLINKSTATE_TEST_PROCESS_FINISHED:
+		{
+			// Feed end of string to parser. This terminates open test case if such exists.
+			{
+				deUint8 eos = 0;
+				onTestLogData(worker, &eos, 1);
+			}
+
+			worker.link->reset();
+
+			if (worker.link->getState() != COMMLINKSTATE_READY)
+				retireWorker(worker, "CommLink not ready after test process finished");
+			else if (worker.state == Worker::STATE_RUNNING && worker.nextCase < worker.chunkEnd)
+			{
+				// Test process crashed. Restart from the next case unless no progress was made.
+				if (worker.numCompletedInSession > 0)
+					launchChunk(worker);
+				else
+					retireWorker(worker, "No cases were executed");
+			}
+			else
+			{
+				worker.state = Worker::STATE_IDLE;
+				assignWork(worker);
+			}
+
+			break;
+		}
+
+		case COMMLINKSTATE_TEST_PROCESS_LAUNCH_FAILED:
+		case COMMLINKSTATE_ERROR:
+			retireWorker(worker, message);
+			break;
+
+		default:
+			XE_FAIL("Unknown state");
+	}
+}
+
+void ParallelBatchExecutor::onTestLogData (Worker& worker, const deUint8* bytes, size_t numBytes)
+{
+	try
+	{
+		worker.parser.parse(bytes, numBytes);
+	}
+	catch (const ParseError& e)
+	{
+		const string message = string("Failed to parse test log: ") + e.what() + "\n";
+		onInfoLogData((const deUint8*)message.c_str(), message.size());
+	}
+}
+
+void ParallelBatchExecutor::onInfoLogData (const deUint8* bytes, size_t numBytes)
+{
+	if (numBytes > 0 && m_infoLog)
+		m_infoLog->append(bytes, numBytes);
+}
+
+void ParallelBatchExecutor::enqueueStateChanged (void* userPtr, CommLinkState state, const char* message)
+{
+	Worker*		worker	= static_cast<Worker*>(userPtr);
+	CallWriter	writer	(&worker->executor->m_dispatcher, ParallelBatchExecutor::dispatchStateChanged);
+
+	writer << worker
+		   << state
+		   << message;
+
+	writer.enqueue();
+}
+
+void ParallelBatchExecutor::enqueueTestLogData (void* userPtr, const deUint8* bytes, size_t numBytes)
+{
+	Worker*		worker	= static_cast<Worker*>(userPtr);
+	CallWriter	writer	(&worker->executor->m_dispatcher, ParallelBatchExecutor::dispatchTestLogData);
+
+	writer << worker
+		   << numBytes;
+
+	writer.write(bytes, numBytes);
+	writer.enqueue();
+}
+
+void ParallelBatchExecutor::enqueueInfoLogData (void* userPtr, const deUint8* bytes, size_t numBytes)
+{
+	Worker*		worker	= static_cast<Worker*>(userPtr);
+	CallWriter	writer	(&worker->executor->m_dispatcher, ParallelBatchExecutor::dispatchInfoLogData);
+
+	writer << worker
+		   << numBytes;
+
+	writer.write(bytes, numBytes);
+	writer.enqueue();
+}
+
+void ParallelBatchExecutor::dispatchStateChanged (CallReader& data)
+{
+	Worker*			worker	= DE_NULL;
+	CommLinkState	state	= COMMLINKSTATE_LAST;
+	std::string		message;
+
+	data >> worker
+		 >> state
+		 >> message;
+
+	worker->executor->onStateChanged(*worker, state, message.c_str());
+}
+
+void ParallelBatchExecutor::dispatchTestLogData (CallReader& data)
+{
+	Worker*	worker		= DE_NULL;
+	size_t	numBytes;
+
+	data >> worker
+		 >> numBytes;
+
+	worker->executor->onTestLogData(*worker, data.getDataBlock(numBytes), numBytes);
+}
+
+void ParallelBatchExecutor::dispatchInfoLogData (CallReader& data)
+{
+	Worker*	worker		= DE_NULL;
+	size_t	numBytes;
+
+	data >> worker
+		 >> numBytes;
+
+	worker->executor->onInfoLogData(data.getDataBlock(numBytes), numBytes);
+}
+
 } // xe
@@ -28,9 +28,14 @@
 #include "xeCommLink.hpp"
 #include "xeTestLogParser.hpp"
 #include "xeCallQueue.hpp"
+#include "xeCaseTimingDatabase.hpp"
+
+#include "deSharedPtr.hpp"
 
 #include <string>
 #include <vector>
+#include <deque>
+#include <map>
 
 namespace xe
 {
@@ -51,7 +56,7 @@ struct TargetConfiguration
 class BatchExecutorLogHandler : public TestLogHandler
 {
 public:
-							BatchExecutorLogHandler		(BatchResult* batchResult);
+							BatchExecutorLogHandler		(BatchResult* batchResult, InfoLog* infoLog);
 							~BatchExecutorLogHandler	(void);
 
 	void					setSessionInfo				(const SessionInfo& sessionInfo);
@@ -62,6 +67,7 @@ public:
 
 private:
 	BatchResult*			m_batchResult;
+	InfoLog*				m_infoLog;
 };
 
 class BatchExecutor
@@ -122,6 +128,132 @@ private:
 	CallQueue				m_dispatcher;
 };
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Execute test batch on multiple test processes in parallel
+ *
+ * Each CommLink drives one test process. Cases are handed out to idle
+ * processes in chunks that get smaller as the run nears its end. Once no
+ * unassigned cases are left, an idle process steals the second half of the
+ * remaining cases from the busiest process, which is stopped once it
+ * reaches the new end of its chunk.
+ *
+ * If case timings are given, cases are scheduled longest first and chunks
+ * are sized by expected duration instead of case count. Cases with no
+ * recorded duration are expected to take the average time.
+ *
+ * Crashed processes are restarted from the case following the crashed one.
+ * Results are merged into BatchResult in test hierarchy order once the
+ * run finishes.
+ *//*--------------------------------------------------------------------*/
+class ParallelBatchExecutor
+{
+public:
+							ParallelBatchExecutor	(const TargetConfiguration& config, const std::vector<CommLink*>& commLinks, const TestNode* root, const TestSet& testSet, BatchResult* batchResult, InfoLog* infoLog, const CaseTimingDatabase* caseTimings);
+							~ParallelBatchExecutor	(void);
+
+	void					run						(void);
+	void					cancel					(void); //!< Cancel current run(), can be called from any thread.
+
+private:
+							ParallelBatchExecutor	(const ParallelBatchExecutor& other);
+	ParallelBatchExecutor&	operator=				(const ParallelBatchExecutor& other);
+
+	struct CaseRange
+	{
+		int		begin;
+		int		end;
+
+		CaseRange (int begin_, int end_) : begin(begin_), end(end_) {}
+	};
+
+	struct ScheduledCase
+	{
+		const TestCase*	testCase;
+		int				hierarchyNdx;	//!< Position in test hierarchy order.
+		deInt64			duration;		//!< Expected duration, 1 for all cases if timings are not known.
+
+		ScheduledCase (const TestCase* testCase_, int hierarchyNdx_, deInt64 duration_) : testCase(testCase_), hierarchyNdx(hierarchyNdx_), duration(duration_) {}
+	};
+
+	class Worker : public TestLogHandler
+	{
+	public:
+		enum State
+		{
+			STATE_IDLE = 0,
+			STATE_RUNNING,
+			STATE_STOPPING,		//!< Stop requested after chunk was stolen from.
+			STATE_RETIRED,		//!< Link failed or test process made no progress.
+
+			STATE_LAST
+		};
+
+								Worker					(ParallelBatchExecutor* executor, CommLink* link);
+
+		void					setSessionInfo			(const SessionInfo& sessionInfo);
+		TestCaseResultPtr		startTestCaseResult		(const char* casePath);
+		void					testCaseResultUpdated	(const TestCaseResultPtr& resultData);
+		void					testCaseResultComplete	(const TestCaseResultPtr& resultData);
+
+		ParallelBatchExecutor*	executor;
+		CommLink*				link;
+		TestLogParser			parser;
+
+		State					state;
+		int						chunkEnd;				//!< End of assigned cases, lowered if cases are stolen.
+		int						sessionEnd;				//!< End of cases given to current test process.
+		int						nextCase;				//!< First case without result.
+		int						numCompletedInSession;
+	};
+
+	typedef de::SharedPtr<Worker> WorkerPtr;
+
+	void					scheduleCases			(void);
+	deInt64					getRangeDuration		(int begin, int end) const { return m_durationPrefix[end] - m_durationPrefix[begin]; }
+	void					sortChunk				(int begin, int end);
+
+	void					assignWork				(Worker& worker);
+	bool					takeChunk				(Worker& worker);
+	bool					stealChunk				(Worker& worker);
+	void					launchChunk				(Worker& worker);
+	void					retireWorker			(Worker& worker, const char* reason);
+	bool					isRunning				(void) const;
+	void					mergeResults			(void);
+
+	void					onCaseComplete			(Worker& worker, const TestCaseResultPtr& result);
+	void					onStateChanged			(Worker& worker, CommLinkState state, const char* message);
+	void					onTestLogData			(Worker& worker, const deUint8* bytes, size_t numBytes);
+	void					onInfoLogData			(const deUint8* bytes, size_t numBytes);
+
+	// Callbacks for CommLink, userPtr is Worker.
+	static void				enqueueStateChanged		(void* userPtr, CommLinkState state, const char* message);
+	static void				enqueueTestLogData		(void* userPtr, const deUint8* bytes, size_t numBytes);
+	static void				enqueueInfoLogData		(void* userPtr, const deUint8* bytes, size_t numBytes);
+
+	// Called in CallQueue dispatch.
+	static void				dispatchStateChanged	(CallReader& data);
+	static void				dispatchTestLogData		(CallReader& data);
+	static void				dispatchInfoLogData		(CallReader& data);
+
+	TargetConfiguration				m_config;
+	const TestNode*					m_root;
+	const TestSet&					m_testSet;
+	BatchResult*					m_batchResult;
+	InfoLog*						m_infoLog;
+	const CaseTimingDatabase*		m_caseTimings;
+
+	std::vector<WorkerPtr>			m_workers;
+
+	std::vector<ScheduledCase>		m_cases;			//!< Cases to execute in schedule order.
+	std::vector<deInt64>			m_durationPrefix;	//!< Prefix sums of expected durations in schedule order.
+	std::map<std::string, int>		m_caseIndex;		//!< Position of case in m_cases.
+	std::vector<TestCaseResultPtr>	m_results;			//!< Indexed by hierarchy position.
+	std::deque<CaseRange>			m_unassigned;
+
+	volatile bool					m_isCanceled;
+	CallQueue						m_dispatcher;
+};
+
 } // xe
 
 #endif // _XEBATCHEXECUTOR_HPP
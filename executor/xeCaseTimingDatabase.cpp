@@ -0,0 +1,149 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Test Executor
+ * ------------------------------------------
+ *
+ * Copyright 2014 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Historical test case duration database.
+ *//*--------------------------------------------------------------------*/
+
+#include "xeCaseTimingDatabase.hpp"
+#include "xeTestResultParser.hpp"
+#include "tcuCaseTimingFile.hpp"
+
+using std::string;
+
+namespace xe
+{
+
+CaseTimingDatabase::CaseTimingDatabase (void)
+{
+}
+
+CaseTimingDatabase::~CaseTimingDatabase (void)
+{
+}
+
+void CaseTimingDatabase::clear (void)
+{
+	m_durations.clear();
+}
+
+bool CaseTimingDatabase::hasCase (const char* casePath) const
+{
+	return m_durations.find(casePath) != m_durations.end();
+}
+
+deInt64 CaseTimingDatabase::getDuration (const char* casePath, deInt64 defaultDuration) const
+{
+	const std::map<string, deInt64>::const_iterator pos = m_durations.find(casePath);
+	return pos != m_durations.end() ? pos->second : defaultDuration;
+}
+
+void CaseTimingDatabase::addMeasurement (const char* casePath, deInt64 duration)
+{
+	const std::map<string, deInt64>::iterator pos = m_durations.find(casePath);
+
+	DE_ASSERT(duration >= 0);
+
+	if (pos != m_durations.end())
+		pos->second = (pos->second + duration) / 2;
+	else
+		m_durations[casePath] = duration;
+}
+
+int CaseTimingDatabase::addBatchResult (const BatchResult& batchResult, const std::set<string>& excludeCases)
+{
+	int numAdded = 0;
+
+	for (int ndx = 0; ndx < batchResult.getNumTestCaseResults(); ndx++)
+	{
+		const ConstTestCaseResultPtr	resultData	= batchResult.getTestCaseResult(ndx);
+
+		// \note Cases carried over from earlier run have already been measured, and folding them in again would skew the average.
+		if (excludeCases.find(resultData->getTestCasePath()) != excludeCases.end())
+			continue;
+
+		const deInt64					duration	= getTestCaseDuration(*resultData);
+
+		if (duration >= 0)
+		{
+			addMeasurement(resultData->getTestCasePath(), duration);
+			numAdded += 1;
+		}
+	}
+
+	return numAdded;
+}
+
+void CaseTimingDatabase::read (const char* filename)
+{
+	tcu::readCaseTimingFile(filename, m_durations);
+}
+
+void CaseTimingDatabase::write (const char* filename) const
+{
+	tcu::writeCaseTimingFile(filename, m_durations);
+}
+
+deInt64 getTestCaseDuration (const TestCaseResultData& resultData)
+{
+	TestCaseResult		result;
+	TestResultParser	parser;
+
+	if (resultData.getDataSize() == 0)
+		return -1;
+
+	try
+	{
+		parseTestCaseResultFromData(&parser, &result, resultData);
+	}
+	catch (const ParseError&)
+	{
+		return -1;
+	}
+
+	// \note TestDuration is logged by the test process at the end of each case.
+	for (int ndx = result.resultItems.getNumItems()-1; ndx >= 0; ndx--)
+	{
+		const ri::Item& item = result.resultItems.getItem(ndx);
+
+		if (item.getType() == ri::TYPE_NUMBER)
+		{
+			const ri::Number& number = static_cast<const ri::Number&>(item);
+
+			if (number.name == "TestDuration" && number.value.getType() == ri::NumericValue::TYPE_INT64)
+				return number.value.getInt64();
+		}
+	}
+
+	return -1;
+}
+
+void getExecutedCases (std::set<string>& dst, const BatchResult& batchResult)
+{
+	for (int ndx = 0; ndx < batchResult.getNumTestCaseResults(); ndx++)
+	{
+		const ConstTestCaseResultPtr	resultData	= batchResult.getTestCaseResult(ndx);
+		const TestStatusCode			statusCode	= resultData->getStatusCode();
+
+		if (statusCode != TESTSTATUSCODE_PENDING && statusCode != TESTSTATUSCODE_RUNNING)
+			dst.insert(resultData->getTestCasePath());
+	}
+}
+
+} // xe
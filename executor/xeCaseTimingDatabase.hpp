@@ -0,0 +1,75 @@
+#ifndef _XECASETIMINGDATABASE_HPP
+#define _XECASETIMINGDATABASE_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Test Executor
+ * ------------------------------------------
+ *
+ * Copyright 2014 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Historical test case duration database.
+ *
+ * Database is stored as a text file with one "<duration in us> <case path>"
+ * line per case, sorted by case path so that it can be kept under version
+ * control.
+ *//*--------------------------------------------------------------------*/
+
+#include "xeDefs.hpp"
+#include "xeBatchResult.hpp"
+
+#include <string>
+#include <map>
+#include <set>
+
+namespace xe
+{
+
+class CaseTimingDatabase
+{
+public:
+							CaseTimingDatabase		(void);
+							~CaseTimingDatabase		(void);
+
+	void					clear					(void);
+
+	int						getNumCases				(void) const	{ return (int)m_durations.size();	}
+	bool					hasCase					(const char* casePath) const;
+
+	//! Get recorded duration in microseconds, or defaultDuration if case is unknown.
+	deInt64					getDuration				(const char* casePath, deInt64 defaultDuration) const;
+
+	//! Record new measurement. Existing duration is averaged with the new one to damp noise.
+	void					addMeasurement			(const char* casePath, deInt64 duration);
+
+	//! Record TestDuration of each completed case in batch result, except cases in excludeCases. Returns number of cases added.
+	int						addBatchResult			(const BatchResult& batchResult, const std::set<std::string>& excludeCases);
+
+	void					read					(const char* filename);
+	void					write					(const char* filename) const;
+
+private:
+	std::map<std::string, deInt64>	m_durations;
+};
+
+//! Get TestDuration from case result data, or -1 if not found.
+deInt64		getTestCaseDuration		(const TestCaseResultData& resultData);
+
+//! Get paths of cases that have already been executed in batch result.
+void		getExecutedCases		(std::set<std::string>& dst, const BatchResult& batchResult);
+
+} // xe
+
+#endif // _XECASETIMINGDATABASE_HPP
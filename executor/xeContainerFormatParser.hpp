@@ -63,6 +63,9 @@ public:
 
 	ContainerElement			getElement					(void) const { return m_element; }
 
+	//! Number of input bytes consumed by current element. Only valid for complete elements.
+	int							getElementLength			(void) const { return m_elementLen; }
+
 	// SESSION_INFO
 	const char*					getSessionInfoAttribute		(void) const;
 	const char*					getSessionInfoValue			(void) const;
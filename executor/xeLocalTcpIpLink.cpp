@@ -46,13 +46,16 @@ LocalTcpIpLink::~LocalTcpIpLink (void)
 	stop();
 }
 
-void LocalTcpIpLink::start (const char* execServerPath, const char* workDir, int port)
+void LocalTcpIpLink::start (const char* execServerPath, const char* workDir, int port, bool parallel)
 {
 	XE_CHECK(!m_process);
 
 	std::ostringstream cmdLine;
 	cmdLine << execServerPath << " --single --port=" << port;
 
+	if (parallel)
+		cmdLine << " --parallel";
+
 	m_process = deProcess_create();
 	XE_CHECK(m_process);
 
@@ -0,0 +1,91 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Test Executor
+ * ------------------------------------------
+ *
+ * Copyright 2014 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Memory-mapped test batch result.
+ *//*--------------------------------------------------------------------*/
+
+#include "xeMappedBatchResult.hpp"
+#include "deMemory.h"
+
+using std::string;
+
+namespace xe
+{
+
+MappedBatchResult::MappedBatchResult (const char* logFilename, const char* indexFilename)
+	: m_file(logFilename)
+{
+	bool indexValid = false;
+
+	if (indexFilename)
+	{
+		try
+		{
+			indexValid = readTestLogIndex(&m_index, indexFilename) && isTestLogIndexUpToDate(m_index, m_file.getPtr(), m_file.getSize());
+		}
+		catch (const TestLogIndexError&)
+		{
+			// Corrupted index, rebuild.
+		}
+	}
+
+	if (!indexValid)
+	{
+		buildTestLogIndex(&m_index, m_file.getPtr(), m_file.getSize());
+
+		if (indexFilename)
+			writeTestLogIndex(m_index, indexFilename);
+	}
+}
+
+MappedBatchResult::~MappedBatchResult (void)
+{
+}
+
+TestCaseResultPtr MappedBatchResult::getTestCaseResult (int ndx) const
+{
+	const TestLogIndexEntry&	entry		= m_index.getEntry(ndx);
+	TestCaseResultPtr			caseResult	(new TestCaseResultData(entry.casePath.c_str()));
+
+	XE_CHECK_MSG(entry.dataOffset+entry.dataSize <= m_file.getSize(), "Case data out of log bounds");
+	XE_CHECK_MSG(entry.dataSize <= (deInt64)0x7fffffff, "Case data too large");
+
+	caseResult->setTestResult(entry.statusCode, entry.statusDetails.c_str());
+	caseResult->setDataSize((int)entry.dataSize);
+
+	if (entry.dataSize > 0)
+		deMemcpy(caseResult->getData(), m_file.getPtr()+entry.dataOffset, (size_t)entry.dataSize);
+
+	return caseResult;
+}
+
+TestCaseResultPtr MappedBatchResult::getTestCaseResult (const char* casePath) const
+{
+	const int ndx = m_index.findEntry(casePath);
+	XE_CHECK_MSG(ndx >= 0, (string("No result for '") + casePath + "' in log").c_str());
+	return getTestCaseResult(ndx);
+}
+
+string getDefaultTestLogIndexFilename (const char* logFilename)
+{
+	return string(logFilename) + ".index";
+}
+
+} // xe
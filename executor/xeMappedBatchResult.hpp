@@ -0,0 +1,73 @@
+#ifndef _XEMAPPEDBATCHRESULT_HPP
+#define _XEMAPPEDBATCHRESULT_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Test Executor
+ * ------------------------------------------
+ *
+ * Copyright 2014 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Memory-mapped test batch result.
+ *//*--------------------------------------------------------------------*/
+
+#include "xeDefs.hpp"
+#include "xeBatchResult.hpp"
+#include "xeTestLogIndex.hpp"
+#include "deMappedFile.hpp"
+
+#include <string>
+
+namespace xe
+{
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Read-only batch result backed by a memory-mapped log file
+ *
+ * Only the case index is kept in memory. Case data is copied out of the
+ * mapping when a case result is requested, so memory use is bounded by
+ * the largest single case instead of the whole log.
+ *//*--------------------------------------------------------------------*/
+class MappedBatchResult
+{
+public:
+	//! Map log. If indexFilename is given, index is read from it if up to date and written to it otherwise.
+										MappedBatchResult		(const char* logFilename, const char* indexFilename = DE_NULL);
+										~MappedBatchResult		(void);
+
+	const SessionInfo&					getSessionInfo			(void) const	{ return m_index.getSessionInfo();					}
+
+	int									getNumTestCaseResults	(void) const	{ return m_index.getNumEntries();					}
+	const char*							getTestCasePath			(int ndx) const	{ return m_index.getEntry(ndx).casePath.c_str();	}
+
+	bool								hasTestCaseResult		(const char* casePath) const	{ return m_index.findEntry(casePath) >= 0;	}
+	int									findTestCaseResult		(const char* casePath) const	{ return m_index.findEntry(casePath);		}
+
+	TestCaseResultPtr					getTestCaseResult		(int ndx) const;
+	TestCaseResultPtr					getTestCaseResult		(const char* casePath) const;
+
+private:
+										MappedBatchResult		(const MappedBatchResult& other);
+	MappedBatchResult&					operator=				(const MappedBatchResult& other);
+
+	de::MappedFile						m_file;
+	TestLogIndex						m_index;
+};
+
+std::string		getDefaultTestLogIndexFilename	(const char* logFilename);
+
+} // xe
+
+#endif // _XEMAPPEDBATCHRESULT_HPP
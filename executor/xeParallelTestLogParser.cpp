@@ -0,0 +1,203 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Test Executor
+ * ------------------------------------------
+ *
+ * Copyright 2014 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Multi-threaded test log parser.
+ *//*--------------------------------------------------------------------*/
+
+#include "xeParallelTestLogParser.hpp"
+#include "deThread.h"
+
+#include <fstream>
+
+namespace xe
+{
+
+enum
+{
+	JOBS_IN_FLIGHT_PER_WORKER	= 8,
+	READ_CHUNK_SIZE				= 64*1024
+};
+
+// Worker
+
+void ParallelTestLogParser::Worker::run (void)
+{
+	for (;;)
+	{
+		Job* const job = m_queue.popBack();
+
+		if (!job)
+			break; // End of work.
+
+		try
+		{
+			parseTestCaseResultFromData(&m_parser, &job->result, *job->data);
+		}
+		catch (const std::exception& e)
+		{
+			job->error = e.what();
+		}
+
+		job->done.increment();
+	}
+}
+
+// ParallelTestLogParser
+
+ParallelTestLogParser::ParallelTestLogParser (ParsedTestLogHandler* handler, int numWorkers)
+	: m_handler			(handler)
+	, m_logParser		(this)
+	, m_maxJobsInFlight	(de::max(numWorkers, 1)*JOBS_IN_FLIGHT_PER_WORKER)
+	, m_jobQueue		(m_maxJobsInFlight)
+{
+	try
+	{
+		for (int ndx = 0; ndx < de::max(numWorkers, 1); ndx++)
+		{
+			m_workers.push_back(WorkerPtr(new Worker(m_jobQueue)));
+			m_workers.back()->start();
+		}
+	}
+	catch (...)
+	{
+		stopWorkers();
+		throw;
+	}
+}
+
+ParallelTestLogParser::~ParallelTestLogParser (void)
+{
+	// \note Workers may still be referencing jobs in flight.
+	stopWorkers();
+}
+
+int ParallelTestLogParser::getDefaultNumWorkers (void)
+{
+	return de::max(1, (int)deGetNumAvailableLogicalCores());
+}
+
+void ParallelTestLogParser::stopWorkers (void)
+{
+	for (size_t ndx = 0; ndx < m_workers.size(); ndx++)
+		m_jobQueue.pushFront(DE_NULL);
+
+	for (size_t ndx = 0; ndx < m_workers.size(); ndx++)
+		m_workers[ndx]->join();
+
+	m_workers.clear();
+}
+
+bool ParallelTestLogParser::deliverNext (bool wait)
+{
+	if (m_jobsInFlight.empty())
+		return false;
+
+	{
+		const JobPtr job = m_jobsInFlight.front();
+
+		if (wait)
+			job->done.decrement();
+		else if (!job->done.tryDecrement())
+			return false;
+
+		m_jobsInFlight.pop_front();
+
+		if (!job->error.empty())
+			throw Error(std::string(job->data->getTestCasePath()) + ": " + job->error);
+
+		m_handler->testCaseResultParsed(*job->data, job->result);
+	}
+
+	return true;
+}
+
+void ParallelTestLogParser::parse (const deUint8* bytes, size_t numBytes)
+{
+	m_logParser.parse(bytes, numBytes);
+
+	// Deliver whatever is ready without blocking.
+	while (deliverNext(false));
+}
+
+void ParallelTestLogParser::finish (void)
+{
+	while (deliverNext(true));
+}
+
+void ParallelTestLogParser::parseFile (const char* filename)
+{
+	std::ifstream			in		(filename, std::ifstream::binary|std::ifstream::in);
+	std::vector<deUint8>	buf		(READ_CHUNK_SIZE);
+
+	if (!in.good())
+		throw Error(std::string("Failed to open '") + filename + "'");
+
+	for (;;)
+	{
+		in.read((char*)&buf[0], (std::streamsize)buf.size());
+
+		const int numRead = (int)in.gcount();
+
+		if (numRead <= 0)
+			break;
+
+		parse(&buf[0], (size_t)numRead);
+	}
+
+	finish();
+}
+
+void ParallelTestLogParser::setSessionInfo (const SessionInfo& sessionInfo)
+{
+	// Session info must not overtake results from previous session.
+	finish();
+	m_handler->setSessionInfo(sessionInfo);
+}
+
+TestCaseResultPtr ParallelTestLogParser::startTestCaseResult (const char* casePath)
+{
+	return TestCaseResultPtr(new TestCaseResultData(casePath));
+}
+
+void ParallelTestLogParser::testCaseResultUpdated (const TestCaseResultPtr&)
+{
+	// Ignored, only complete results are parsed.
+}
+
+void ParallelTestLogParser::testCaseResultComplete (const TestCaseResultPtr& resultData)
+{
+	queueTestCaseResult(resultData);
+}
+
+void ParallelTestLogParser::queueTestCaseResult (const TestCaseResultPtr& resultData)
+{
+	// Bound memory use by waiting for oldest result.
+	while ((int)m_jobsInFlight.size() >= m_maxJobsInFlight)
+		deliverNext(true);
+
+	{
+		const JobPtr job(new Job(resultData));
+
+		m_jobsInFlight.push_back(job);
+		m_jobQueue.pushFront(job.get());
+	}
+}
+
+} // xe
@@ -0,0 +1,124 @@
+#ifndef _XEPARALLELTESTLOGPARSER_HPP
+#define _XEPARALLELTESTLOGPARSER_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Test Executor
+ * ------------------------------------------
+ *
+ * Copyright 2014 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Multi-threaded test log parser.
+ *//*--------------------------------------------------------------------*/
+
+#include "xeDefs.hpp"
+#include "xeTestLogParser.hpp"
+#include "xeTestResultParser.hpp"
+#include "deThread.hpp"
+#include "deThreadSafeRingBuffer.hpp"
+#include "deSemaphore.hpp"
+#include "deSharedPtr.hpp"
+
+#include <vector>
+#include <deque>
+
+namespace xe
+{
+
+class ParsedTestLogHandler
+{
+public:
+	virtual				~ParsedTestLogHandler		(void) {}
+
+	virtual void		setSessionInfo				(const SessionInfo& sessionInfo)										= DE_NULL;
+	virtual void		testCaseResultParsed		(const TestCaseResultData& data, const TestCaseResult& result)			= DE_NULL;
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Parse test log on multiple threads
+ *
+ * Case boundaries are found by TestLogParser on the caller thread and each
+ * complete case result is handed to a pool of worker threads that run
+ * TestResultParser on it. Parsed results are delivered to the handler on
+ * the caller thread in the original log order.
+ *
+ * Case results split by other means (for example MappedBatchResult) can be
+ * queued directly with queueTestCaseResult().
+ *//*--------------------------------------------------------------------*/
+class ParallelTestLogParser : private TestLogHandler
+{
+public:
+								ParallelTestLogParser		(ParsedTestLogHandler* handler, int numWorkers);
+								~ParallelTestLogParser		(void);
+
+	void						parse						(const deUint8* bytes, size_t numBytes);
+	void						queueTestCaseResult			(const TestCaseResultPtr& resultData);
+	void						finish						(void);
+
+	void						parseFile					(const char* filename);
+
+	static int					getDefaultNumWorkers		(void);
+
+private:
+								ParallelTestLogParser		(const ParallelTestLogParser& other);
+	ParallelTestLogParser&		operator=					(const ParallelTestLogParser& other);
+
+	class Job
+	{
+	public:
+									Job				(const TestCaseResultPtr& data_) : data(data_), done(0) {}
+
+		TestCaseResultPtr			data;
+		TestCaseResult				result;
+		std::string					error;
+		de::Semaphore				done;
+	};
+
+	typedef de::SharedPtr<Job>		JobPtr;
+
+	class Worker : public de::Thread
+	{
+	public:
+									Worker			(de::ThreadSafeRingBuffer<Job*>& queue) : m_queue(queue) {}
+		void						run				(void);
+
+	private:
+		de::ThreadSafeRingBuffer<Job*>&	m_queue;
+		TestResultParser				m_parser;
+	};
+
+	typedef de::SharedPtr<Worker>	WorkerPtr;
+
+	// TestLogHandler
+	void						setSessionInfo				(const SessionInfo& sessionInfo);
+	TestCaseResultPtr			startTestCaseResult			(const char* casePath);
+	void						testCaseResultUpdated		(const TestCaseResultPtr& resultData);
+	void						testCaseResultComplete		(const TestCaseResultPtr& resultData);
+
+	bool						deliverNext					(bool wait);
+	void						stopWorkers					(void);
+
+	ParsedTestLogHandler*		m_handler;
+	TestLogParser				m_logParser;
+	const int					m_maxJobsInFlight;
+
+	de::ThreadSafeRingBuffer<Job*>	m_jobQueue;
+	std::vector<WorkerPtr>		m_workers;
+	std::deque<JobPtr>			m_jobsInFlight;				//!< In log order.
+};
+
+} // xe
+
+#endif // _XEPARALLELTESTLOGPARSER_HPP
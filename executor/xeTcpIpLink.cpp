@@ -32,7 +32,11 @@ namespace xe
 enum
 {
 	SEND_BUFFER_BLOCK_SIZE		= 1024,
-	SEND_BUFFER_NUM_BLOCKS		= 64
+	SEND_BUFFER_NUM_BLOCKS		= 64,
+
+	// Times are in milliseconds.
+	SERVER_FEATURES_TIMEOUT		= 3000,	//!< Older execservers don't reply to HELLO at all.
+	SERVER_FEATURES_POLL_INTERVAL	= 10
 };
 
 // Utilities for writing messages out.
@@ -72,12 +76,30 @@ static void writeStopExecution (de::BlockBuffer<deUint8>& dst)
 	dst.flush();
 }
 
+static void writeHello (de::BlockBuffer<deUint8>& dst)
+{
+	std::vector<deUint8> buf;
+	xs::HelloMessage().write(buf);
+	dst.write((int)buf.size(), &buf[0]);
+	dst.flush();
+}
+
+static void writeSetLogCompression (de::BlockBuffer<deUint8>& dst, int level)
+{
+	std::vector<deUint8> buf;
+	xs::SetLogCompressionMessage(level).write(buf);
+	dst.write((int)buf.size(), &buf[0]);
+	dst.flush();
+}
+
 // TcpIpLinkState
 
 TcpIpLinkState::TcpIpLinkState (CommLinkState initialState, const char* initialErr)
 	: m_state					(initialState)
 	, m_error					(initialErr)
 	, m_lastKeepaliveReceived	(0)
+	, m_serverFeaturesReceived	(false)
+	, m_serverFeatures			(0)
 	, m_stateChangedCallback	(DE_NULL)
 	, m_testLogDataCallback		(DE_NULL)
 	, m_infoLogDataCallback		(DE_NULL)
@@ -173,6 +195,27 @@ deUint64 TcpIpLinkState::getLastKeepaliveRecevied (void) const
 	return m_lastKeepaliveReceived;
 }
 
+void TcpIpLinkState::onServerFeaturesReceived (deUint32 features)
+{
+	de::ScopedLock lock(m_lock);
+	m_serverFeatures			= features;
+	m_serverFeaturesReceived	= true;
+}
+
+void TcpIpLinkState::clearServerFeatures (void)
+{
+	de::ScopedLock lock(m_lock);
+	m_serverFeatures			= 0;
+	m_serverFeaturesReceived	= false;
+}
+
+bool TcpIpLinkState::getServerFeatures (deUint32& features) const
+{
+	de::ScopedLock lock(m_lock);
+	features = m_serverFeatures;
+	return m_serverFeaturesReceived;
+}
+
 // TcpIpSendThread
 
 TcpIpSendThread::TcpIpSendThread (de::Socket& socket, TcpIpLinkState& state)
@@ -389,6 +432,22 @@ void TcpIpRecvThread::handleMessage (xs::MessageType messageType, const deUint8*
 			break;
 		}
 
+		case xs::MESSAGETYPE_SERVER_FEATURES:
+		{
+			xs::ServerFeaturesMessage msg(data, dataSize);
+			m_state.onServerFeaturesReceived(msg.features);
+			break;
+		}
+
+		case xs::MESSAGETYPE_PROCESS_LOG_DATA_COMPRESSED:
+		{
+			XE_CHECK_MSG(m_state.getState() == COMMLINKSTATE_TEST_PROCESS_RUNNING, "Unexpected PROCESS_LOG_DATA_COMPRESSED message");
+			xs::CompressedLogDataMessage msg(data, dataSize);
+			if (!msg.logData.empty())
+				m_state.onTestLogData(&msg.logData[0], msg.logData.size());
+			break;
+		}
+
 		case xs::MESSAGETYPE_PROCESS_LOG_DATA:
 		case xs::MESSAGETYPE_INFO:
 			// Ignore leading \0 if such is present. \todo [2012-06-19 pyry] Improve protocol.
@@ -469,11 +528,15 @@ void TcpIpLink::connect (const de::SocketAddress& address)
 		// Clear error and set state to ready.
 		m_state.setState(COMMLINKSTATE_READY, "");
 		m_state.onKeepaliveReceived();
+		m_state.clearServerFeatures();
 
 		// Launch threads.
 		m_sendThread.start();
 		m_recvThread.start();
 
+		// Server replies to HELLO with supported features, see setLogCompression().
+		writeHello(m_sendThread.getBuffer());
+
 		XE_CHECK(deTimer_scheduleInterval(m_keepaliveTimer, xs::KEEPALIVE_SEND_INTERVAL));
 	}
 	catch (const std::exception& e)
@@ -497,6 +560,30 @@ void TcpIpLink::disconnect (void)
 	}
 }
 
+bool TcpIpLink::setLogCompression (int level)
+{
+	const deUint64	waitStart	= deGetMicroseconds();
+	deUint32		features	= 0;
+
+	XE_CHECK(m_socket.getState() == DE_SOCKETSTATE_CONNECTED);
+	XE_CHECK(de::inRange(level, 0, 9));
+
+	// \note Older servers reject SET_LOG_COMPRESSION with a protocol error, so it is sent only if advertised.
+	while (!m_state.getServerFeatures(features))
+	{
+		if (m_state.getState() == COMMLINKSTATE_ERROR || deGetMicroseconds() - waitStart > SERVER_FEATURES_TIMEOUT*1000)
+			return false;
+
+		deSleep(SERVER_FEATURES_POLL_INTERVAL);
+	}
+
+	if ((features & xs::SERVER_FEATURE_LOG_COMPRESSION) == 0)
+		return false;
+
+	writeSetLogCompression(m_sendThread.getBuffer(), level);
+	return true;
+}
+
 void TcpIpLink::reset (void)
 {
 	// \note Just clears error state if we are connected.
@@ -55,6 +55,10 @@ public:
 	void						onKeepaliveReceived			(void);
 	deUint64					getLastKeepaliveRecevied	(void) const;
 
+	void						onServerFeaturesReceived	(deUint32 features);
+	void						clearServerFeatures			(void);
+	bool						getServerFeatures			(deUint32& features) const;
+
 private:
 	mutable de::Mutex					m_lock;
 	volatile CommLinkState				m_state;
@@ -62,6 +66,9 @@ private:
 
 	volatile deUint64					m_lastKeepaliveReceived;
 
+	bool								m_serverFeaturesReceived;
+	deUint32							m_serverFeatures;
+
 	volatile CommLink::StateChangedFunc	m_stateChangedCallback;
 	volatile CommLink::LogDataFunc		m_testLogDataCallback;
 	volatile CommLink::LogDataFunc		m_infoLogDataCallback;
@@ -125,6 +132,10 @@ public:
 	void						connect					(const de::SocketAddress& address);
 	void						disconnect				(void);
 
+	//! Request execserver to send log data compressed with given zlib level (1-9), 0 disables.
+	//! Returns false without sending the request if the server doesn't advertise support for it.
+	bool						setLogCompression		(int level);
+
 	// CommLink API
 	void						reset					(void);
 
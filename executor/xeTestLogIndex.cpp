@@ -0,0 +1,500 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Test Executor
+ * ------------------------------------------
+ *
+ * Copyright 2014 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Test log case index.
+ *//*--------------------------------------------------------------------*/
+
+#include "xeTestLogIndex.hpp"
+#include "xeContainerFormatParser.hpp"
+#include "xeTestResultParser.hpp"
+#include "deString.h"
+#include "deMemory.h"
+#include "deInt32.h"
+
+#include <fstream>
+
+using std::string;
+using std::vector;
+using std::map;
+
+namespace xe
+{
+
+enum
+{
+	TESTLOGINDEX_FEED_CHUNK_SIZE	= 64*1024,
+	TESTLOGINDEX_HASH_WINDOW_SIZE	= 4*1024,
+	TESTLOGINDEX_FORMAT_VERSION		= 2
+};
+
+static const char TESTLOGINDEX_MAGIC[] = { 'X', 'E', 'I', 'X' };
+
+// TestLogIndex
+
+TestLogIndex::TestLogIndex (void)
+	: m_logSize	(0)
+	, m_logHash	(0)
+{
+}
+
+TestLogIndex::~TestLogIndex (void)
+{
+}
+
+void TestLogIndex::clear (void)
+{
+	m_sessionInfo	= SessionInfo();
+	m_logSize		= 0;
+	m_logHash		= 0;
+	m_entries.clear();
+	m_entryMap.clear();
+}
+
+int TestLogIndex::findEntry (const char* casePath) const
+{
+	const map<string, int>::const_iterator pos = m_entryMap.find(casePath);
+	return pos != m_entryMap.end() ? pos->second : -1;
+}
+
+void TestLogIndex::addEntry (const TestLogIndexEntry& entry)
+{
+	const map<string, int>::const_iterator pos = m_entryMap.find(entry.casePath);
+
+	if (pos != m_entryMap.end())
+		m_entries[pos->second] = entry;
+	else
+	{
+		m_entryMap[entry.casePath] = (int)m_entries.size();
+		m_entries.push_back(entry);
+	}
+}
+
+// Index builder
+
+static void setSessionInfoAttribute (SessionInfo& info, const char* attribute, const char* value)
+{
+	if (deStringEqual(attribute, "releaseName"))
+		info.releaseName = value;
+	else if (deStringEqual(attribute, "releaseId"))
+		info.releaseId = value;
+	else if (deStringEqual(attribute, "targetName"))
+		info.targetName = value;
+	else if (deStringEqual(attribute, "candyTargetName"))
+		info.candyTargetName = value;
+	else if (deStringEqual(attribute, "configName"))
+		info.configName = value;
+	else if (deStringEqual(attribute, "resultName"))
+		info.resultName = value;
+	else if (deStringEqual(attribute, "timestamp"))
+		info.timestamp = value;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Build case index from log data
+ *
+ * Log is fed through ContainerFormatParser in fixed-size chunks and byte
+ * offsets are tracked from element lengths, so only container state is
+ * kept in memory regardless of log size. Case data is never copied.
+ *//*--------------------------------------------------------------------*/
+void buildTestLogIndex (TestLogIndex* index, const deUint8* log, deInt64 logSize)
+{
+	ContainerFormatParser	parser;
+	TestLogIndexEntry		curEntry;
+	bool					inCase			= false;
+	bool					inSession		= false;
+	deInt64					feedOffset		= 0;
+	deInt64					elementOffset	= 0;
+
+	index->clear();
+	index->setLogSize(logSize);
+	index->setLogHash(computeTestLogHash(log, logSize));
+
+	while (feedOffset < logSize)
+	{
+		const int numToFeed = (int)de::min<deInt64>(logSize-feedOffset, (deInt64)TESTLOGINDEX_FEED_CHUNK_SIZE);
+
+		parser.feed(log+feedOffset, (size_t)numToFeed);
+		feedOffset += numToFeed;
+
+		for (;;)
+		{
+			const ContainerElement element = parser.getElement();
+
+			if (element == CONTAINERELEMENT_INCOMPLETE)
+				break;
+
+			switch (element)
+			{
+				case CONTAINERELEMENT_BEGIN_SESSION:
+					if (inSession)
+						throw TestLogIndexError("Unexpected #beginSession");
+					inSession = true;
+					break;
+
+				case CONTAINERELEMENT_END_SESSION:
+					if (!inSession)
+						throw TestLogIndexError("Unexpected #endSession");
+					inSession = false;
+					break;
+
+				case CONTAINERELEMENT_SESSION_INFO:
+					if (inSession)
+						throw TestLogIndexError("Unexpected #sessionInfo");
+					setSessionInfoAttribute(index->getSessionInfo(), parser.getSessionInfoAttribute(), parser.getSessionInfoValue());
+					break;
+
+				case CONTAINERELEMENT_BEGIN_TEST_CASE_RESULT:
+					if (!inSession)
+						throw TestLogIndexError("Unexpected #beginTestCaseResult");
+
+					curEntry				= TestLogIndexEntry();
+					curEntry.casePath		= parser.getTestCasePath();
+					curEntry.dataOffset		= elementOffset + parser.getElementLength();
+					inCase					= true;
+					break;
+
+				case CONTAINERELEMENT_END_TEST_CASE_RESULT:
+				case CONTAINERELEMENT_TERMINATE_TEST_CASE_RESULT:
+				case CONTAINERELEMENT_END_OF_STRING:
+					if (inCase)
+					{
+						curEntry.dataSize = elementOffset - curEntry.dataOffset;
+
+						if (element == CONTAINERELEMENT_TERMINATE_TEST_CASE_RESULT)
+						{
+							const char* reason = parser.getTerminateReason();
+
+							curEntry.statusCode		= TESTSTATUSCODE_CRASH;
+							curEntry.statusDetails	= reason;
+
+							try
+							{
+								curEntry.statusCode = getTestStatusCode(reason);
+							}
+							catch (const xe::ParseError&)
+							{
+								// Could not map status code.
+							}
+						}
+						else if (element == CONTAINERELEMENT_END_OF_STRING)
+						{
+							curEntry.statusCode		= TESTSTATUSCODE_TERMINATED;
+							curEntry.statusDetails	= "Unexpected end of string";
+						}
+
+						index->addEntry(curEntry);
+						inCase = false;
+					}
+					break;
+
+				case CONTAINERELEMENT_TEST_LOG_DATA:
+					// Data is located through offsets only.
+					break;
+
+				default:
+					throw ContainerParseError("Unknown container element");
+			}
+
+			elementOffset += parser.getElementLength();
+			parser.advance();
+		}
+	}
+
+	if (inCase)
+	{
+		// Log was cut in the middle of a case.
+		curEntry.dataSize		= logSize - curEntry.dataOffset;
+		curEntry.statusCode		= TESTSTATUSCODE_TERMINATED;
+		curEntry.statusDetails	= "Unexpected end of log";
+		index->addEntry(curEntry);
+	}
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Compute log hash used for detecting stale index
+ *
+ * Only the first and last TESTLOGINDEX_HASH_WINDOW_SIZE bytes are hashed.
+ * Session header catches a log that was rewritten from scratch and tail
+ * catches anything appended or rewritten after the index was built.
+ *//*--------------------------------------------------------------------*/
+deUint32 computeTestLogHash (const deUint8* log, deInt64 logSize)
+{
+	const size_t	headSize	= (size_t)de::min<deInt64>(logSize, (deInt64)TESTLOGINDEX_HASH_WINDOW_SIZE);
+	const deInt64	tailOffset	= de::max<deInt64>(logSize - (deInt64)TESTLOGINDEX_HASH_WINDOW_SIZE, (deInt64)headSize);
+	deUint32		hash		= deInt64Hash(logSize);
+
+	hash ^= deMemoryHash(log, headSize);
+
+	if (tailOffset < logSize)
+		hash = 31u*hash + deMemoryHash(log+tailOffset, (size_t)(logSize-tailOffset));
+
+	return hash;
+}
+
+bool isTestLogIndexUpToDate (const TestLogIndex& index, const deUint8* log, deInt64 logSize)
+{
+	return index.getLogSize() == logSize && index.getLogHash() == computeTestLogHash(log, logSize);
+}
+
+// Index serialization
+
+static void writeUint32 (std::ostream& str, deUint32 value)
+{
+	const deUint8 bytes[] =
+	{
+		(deUint8)(value & 0xff),
+		(deUint8)((value >> 8) & 0xff),
+		(deUint8)((value >> 16) & 0xff),
+		(deUint8)((value >> 24) & 0xff)
+	};
+	str.write((const char*)&bytes[0], sizeof(bytes));
+}
+
+static void writeUint64 (std::ostream& str, deUint64 value)
+{
+	writeUint32(str, (deUint32)(value & 0xffffffffu));
+	writeUint32(str, (deUint32)(value >> 32));
+}
+
+static void writeString (std::ostream& str, const string& value)
+{
+	writeUint32(str, (deUint32)value.size());
+	str.write(value.c_str(), (std::streamsize)value.size());
+}
+
+static deUint32 readUint32 (std::istream& str)
+{
+	deUint8 bytes[4];
+
+	str.read((char*)&bytes[0], sizeof(bytes));
+	if (!str.good())
+		throw TestLogIndexError("Unexpected end of index");
+
+	return (deUint32)bytes[0] | ((deUint32)bytes[1] << 8) | ((deUint32)bytes[2] << 16) | ((deUint32)bytes[3] << 24);
+}
+
+static deUint64 readUint64 (std::istream& str)
+{
+	const deUint64 low	= readUint32(str);
+	const deUint64 high	= readUint32(str);
+	return low | (high << 32);
+}
+
+static string readString (std::istream& str)
+{
+	const deUint32	size	= readUint32(str);
+	string			value	(size, '\0');
+
+	if (size > 0)
+	{
+		str.read(&value[0], (std::streamsize)size);
+		if (!str.good())
+			throw TestLogIndexError("Unexpected end of index");
+	}
+
+	return value;
+}
+
+static void writeSessionInfo (std::ostream& str, const SessionInfo& info)
+{
+	writeString(str, info.releaseName);
+	writeString(str, info.releaseId);
+	writeString(str, info.targetName);
+	writeString(str, info.candyTargetName);
+	writeString(str, info.configName);
+	writeString(str, info.resultName);
+	writeString(str, info.timestamp);
+}
+
+static void readSessionInfo (std::istream& str, SessionInfo& info)
+{
+	info.releaseName		= readString(str);
+	info.releaseId			= readString(str);
+	info.targetName			= readString(str);
+	info.candyTargetName	= readString(str);
+	info.configName			= readString(str);
+	info.resultName			= readString(str);
+	info.timestamp			= readString(str);
+}
+
+void writeTestLogIndex (const TestLogIndex& index, const char* filename)
+{
+	std::ofstream str(filename, std::ofstream::binary|std::ofstream::trunc);
+
+	if (!str.good())
+		throw TestLogIndexError(string("Failed to open '") + filename + "' for writing");
+
+	str.write(&TESTLOGINDEX_MAGIC[0], sizeof(TESTLOGINDEX_MAGIC));
+	writeUint32(str, TESTLOGINDEX_FORMAT_VERSION);
+	writeUint64(str, (deUint64)index.getLogSize());
+	writeUint32(str, index.getLogHash());
+	writeSessionInfo(str, index.getSessionInfo());
+	writeUint32(str, (deUint32)index.getNumEntries());
+
+	for (int ndx = 0; ndx < index.getNumEntries(); ndx++)
+	{
+		const TestLogIndexEntry& entry = index.getEntry(ndx);
+
+		writeString(str, entry.casePath);
+		writeUint64(str, (deUint64)entry.dataOffset);
+		writeUint64(str, (deUint64)entry.dataSize);
+		writeUint32(str, (deUint32)entry.statusCode);
+		writeString(str, entry.statusDetails);
+	}
+
+	if (!str.good())
+		throw TestLogIndexError(string("Failed to write '") + filename + "'");
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Read case index from file
+ * \return False if file doesn't exist or is of unknown version.
+ *//*--------------------------------------------------------------------*/
+bool readTestLogIndex (TestLogIndex* index, const char* filename)
+{
+	std::ifstream	str			(filename, std::ifstream::binary|std::ifstream::in);
+	char			magic[sizeof(TESTLOGINDEX_MAGIC)];
+
+	if (!str.good())
+		return false;
+
+	str.read(&magic[0], sizeof(magic));
+
+	if (!str.good() || deMemCmp(&magic[0], &TESTLOGINDEX_MAGIC[0], sizeof(magic)) != 0)
+		return false;
+
+	if (readUint32(str) != TESTLOGINDEX_FORMAT_VERSION)
+		return false;
+
+	index->clear();
+	index->setLogSize((deInt64)readUint64(str));
+	index->setLogHash(readUint32(str));
+	readSessionInfo(str, index->getSessionInfo());
+
+	{
+		const deUint32 numEntries = readUint32(str);
+
+		for (deUint32 ndx = 0; ndx < numEntries; ndx++)
+		{
+			TestLogIndexEntry entry;
+
+			entry.casePath		= readString(str);
+			entry.dataOffset	= (deInt64)readUint64(str);
+			entry.dataSize		= (deInt64)readUint64(str);
+			entry.statusCode	= (TestStatusCode)readUint32(str);
+			entry.statusDetails	= readString(str);
+
+			if (!de::inRange<int>((int)entry.statusCode, 0, (int)TESTSTATUSCODE_LAST))
+				throw TestLogIndexError("Invalid status code in index");
+
+			index->addEntry(entry);
+		}
+	}
+
+	return true;
+}
+
+// Self-test
+
+static string getCaseData (const string& log, const TestLogIndexEntry& entry)
+{
+	XE_CHECK(entry.dataOffset >= 0 && entry.dataOffset+entry.dataSize <= (deInt64)log.size());
+	return log.substr((size_t)entry.dataOffset, (size_t)entry.dataSize);
+}
+
+void TestLogIndex_selfTest (void)
+{
+	const string caseA	= "<TestCaseResult CasePath=\"dEQP-X.a\">\n<Result StatusCode=\"Pass\">Pass</Result>\n</TestCaseResult>\n";
+	const string caseB	= "<TestCaseResult CasePath=\"dEQP-X.b\">\n";
+	const string caseC	= "<TestCaseResult CasePath=\"dEQP-X.c\">\n";
+	const string log	= string("#sessionInfo releaseName foo\n")
+						+ "#sessionInfo targetName bar\n"
+						+ "#beginSession\n"
+						+ "#beginTestCaseResult dEQP-X.a\n" + caseA + "#endTestCaseResult\n"
+						+ "#beginTestCaseResult dEQP-X.b\n" + caseB + "#terminateTestCaseResult Crash\n"
+						+ "#beginTestCaseResult dEQP-X.c\n" + caseC;
+	const deUint8*	logPtr	= (const deUint8*)log.c_str();
+	const deInt64	logSize	= (deInt64)log.size();
+	TestLogIndex	index;
+
+	buildTestLogIndex(&index, logPtr, logSize);
+
+	// Session info and case lookup
+	{
+		XE_CHECK(index.getSessionInfo().releaseName == "foo");
+		XE_CHECK(index.getSessionInfo().targetName == "bar");
+		XE_CHECK(index.getNumEntries() == 3);
+		XE_CHECK(index.findEntry("dEQP-X.a") == 0);
+		XE_CHECK(index.findEntry("dEQP-X.b") == 1);
+		XE_CHECK(index.findEntry("dEQP-X.c") == 2);
+		XE_CHECK(index.findEntry("dEQP-X.d") < 0);
+
+		XE_CHECK(getCaseData(log, index.getEntry(0)) == caseA);
+		XE_CHECK(index.getEntry(0).statusCode == TESTSTATUSCODE_LAST);
+
+		XE_CHECK(getCaseData(log, index.getEntry(1)) == caseB);
+		XE_CHECK(index.getEntry(1).statusCode == TESTSTATUSCODE_CRASH);
+
+		XE_CHECK(getCaseData(log, index.getEntry(2)) == caseC);
+		XE_CHECK(index.getEntry(2).statusCode == TESTSTATUSCODE_TERMINATED);
+	}
+
+	// Staleness detection
+	{
+		XE_CHECK(isTestLogIndexUpToDate(index, logPtr, logSize));
+
+		// Appended data
+		{
+			const string appended = log + "#endTestCaseResult\n";
+			XE_CHECK(!isTestLogIndexUpToDate(index, (const deUint8*)appended.c_str(), (deInt64)appended.size()));
+		}
+
+		// Rewritten log of same size
+		{
+			string rewritten = log;
+			rewritten[rewritten.size()-2] = 'x';
+			XE_CHECK(!isTestLogIndexUpToDate(index, (const deUint8*)rewritten.c_str(), (deInt64)rewritten.size()));
+		}
+	}
+
+	// Large log, only head and tail are hashed
+	{
+		const string	padding		(3*TESTLOGINDEX_HASH_WINDOW_SIZE, ' ');
+		const string	largeLog	= log + padding;
+		TestLogIndex	largeIndex;
+
+		buildTestLogIndex(&largeIndex, (const deUint8*)largeLog.c_str(), (deInt64)largeLog.size());
+		XE_CHECK(largeIndex.getNumEntries() == 3);
+
+		{
+			string rewritten = largeLog;
+			rewritten[rewritten.find("foo")] = 'g';
+			XE_CHECK(!isTestLogIndexUpToDate(largeIndex, (const deUint8*)rewritten.c_str(), (deInt64)rewritten.size()));
+		}
+
+		{
+			string rewritten = largeLog;
+			rewritten[rewritten.size()-1] = '\n';
+			XE_CHECK(!isTestLogIndexUpToDate(largeIndex, (const deUint8*)rewritten.c_str(), (deInt64)rewritten.size()));
+		}
+	}
+}
+
+} // xe
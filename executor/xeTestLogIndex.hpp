@@ -0,0 +1,107 @@
+#ifndef _XETESTLOGINDEX_HPP
+#define _XETESTLOGINDEX_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Test Executor
+ * ------------------------------------------
+ *
+ * Copyright 2014 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Test log case index.
+ *
+ * Index maps each test case path in a log file to the byte range of its
+ * result data. Index is built in a single streaming pass over the log and
+ * can be stored to disk alongside the log to skip the pass next time.
+ *//*--------------------------------------------------------------------*/
+
+#include "xeDefs.hpp"
+#include "xeBatchResult.hpp"
+
+#include <string>
+#include <vector>
+#include <map>
+
+namespace xe
+{
+
+class TestLogIndexEntry
+{
+public:
+	TestLogIndexEntry (void)
+		: dataOffset	(0)
+		, dataSize		(0)
+		, statusCode	(TESTSTATUSCODE_LAST)
+	{
+	}
+
+	std::string			casePath;
+	deInt64				dataOffset;		//!< Offset of first data byte in log.
+	deInt64				dataSize;		//!< Size of data in bytes.
+	TestStatusCode		statusCode;		//!< Status from container, TESTSTATUSCODE_LAST if it must be parsed from data.
+	std::string			statusDetails;
+};
+
+class TestLogIndex
+{
+public:
+								TestLogIndex		(void);
+								~TestLogIndex		(void);
+
+	void						clear				(void);
+
+	const SessionInfo&			getSessionInfo		(void) const	{ return m_sessionInfo;				}
+	SessionInfo&				getSessionInfo		(void)			{ return m_sessionInfo;				}
+
+	deInt64						getLogSize			(void) const	{ return m_logSize;					}
+	void						setLogSize			(deInt64 size)	{ m_logSize = size;					}
+
+	deUint32					getLogHash			(void) const	{ return m_logHash;					}
+	void						setLogHash			(deUint32 hash)	{ m_logHash = hash;					}
+
+	int							getNumEntries		(void) const	{ return (int)m_entries.size();		}
+	const TestLogIndexEntry&	getEntry			(int ndx) const	{ return m_entries[ndx];			}
+
+	int							findEntry			(const char* casePath) const;
+
+	//! Add entry or replace existing entry for the same case path, keeping original position.
+	void						addEntry			(const TestLogIndexEntry& entry);
+
+private:
+	SessionInfo					m_sessionInfo;
+	deInt64						m_logSize;			//!< Log size at the time index was built.
+	deUint32					m_logHash;			//!< Hash of log head and tail at the time index was built.
+	std::vector<TestLogIndexEntry>	m_entries;
+	std::map<std::string, int>	m_entryMap;
+};
+
+class TestLogIndexError : public Error
+{
+public:
+	TestLogIndexError (const std::string& message) : Error(message) {}
+};
+
+void		buildTestLogIndex		(TestLogIndex* index, const deUint8* log, deInt64 logSize);
+deUint32	computeTestLogHash		(const deUint8* log, deInt64 logSize);
+bool		isTestLogIndexUpToDate	(const TestLogIndex& index, const deUint8* log, deInt64 logSize);
+
+void		writeTestLogIndex		(const TestLogIndex& index, const char* filename);
+bool		readTestLogIndex		(TestLogIndex* index, const char* filename);
+
+void		TestLogIndex_selfTest	(void);
+
+} // xe
+
+#endif // _XETESTLOGINDEX_HPP
@@ -108,11 +108,26 @@ static void writeTestCase (const TestCaseResultData& caseData, std::ostream& str
 		stream << "#endTestCaseResult\n";
 }
 
-void writeTestLog (const BatchResult& result, std::ostream& stream)
+void writeSessionBegin (const SessionInfo& sessionInfo, std::ostream& stream)
 {
-	writeSessionInfo(result.getSessionInfo(), stream);
+	writeSessionInfo(sessionInfo, stream);
 
 	stream << "#beginSession\n";
+}
+
+void writeTestCaseResultData (const TestCaseResultData& caseData, std::ostream& stream)
+{
+	writeTestCase(caseData, stream);
+}
+
+void writeSessionEnd (std::ostream& stream)
+{
+	stream << "\n#endSession\n";
+}
+
+void writeTestLog (const BatchResult& result, std::ostream& stream)
+{
+	writeSessionBegin(result.getSessionInfo(), stream);
 
 	for (int ndx = 0; ndx < result.getNumTestCaseResults(); ndx++)
 	{
@@ -120,7 +135,7 @@ void writeTestLog (const BatchResult& result, std::ostream& stream)
 		writeTestCase(*caseData, stream);
 	}
 
-	stream << "\n#endSession\n";
+	writeSessionEnd(stream);
 }
 
 void writeBatchResultToFile (const BatchResult& result, const char* filename)
@@ -40,6 +40,11 @@ class Writer;
 void	writeTestLog			(const BatchResult& batchResult, std::ostream& stream);
 void	writeBatchResultToFile	(const BatchResult& batchResult, const char* filename);
 
+// Incremental test log writing.
+void	writeSessionBegin		(const SessionInfo& sessionInfo, std::ostream& stream);
+void	writeTestCaseResultData	(const TestCaseResultData& caseData, std::ostream& stream);
+void	writeSessionEnd			(std::ostream& stream);
+
 void	writeTestResult			(const TestCaseResult& result, xe::xml::Writer& writer);
 void	writeTestResult			(const TestCaseResult& result, std::ostream& stream);
 void	writeTestResultToFile	(const TestCaseResult& result, const char* filename);
@@ -26,6 +26,7 @@
 #include "xeBatchResult.hpp"
 #include "deString.h"
 #include "deInt32.h"
+#include "deMemory.h"
 
 #include <sstream>
 #include <stdlib.h>
@@ -164,7 +165,8 @@ static const EnumMapEntry s_logVersionMap[] =
 	{ 0x0b7db0d4,	"0.3.0",		TESTLOGVERSION_0_3_0	},
 	{ 0x0b7db0d5,	"0.3.1",		TESTLOGVERSION_0_3_1	},
 	{ 0x0b7db0d6,	"0.3.2",		TESTLOGVERSION_0_3_2	},
-	{ 0x0b7db0d7,	"0.3.3",		TESTLOGVERSION_0_3_3	}
+	{ 0x0b7db0d7,	"0.3.3",		TESTLOGVERSION_0_3_3	},
+	{ 0x0b7db0d8,	"0.3.4",		TESTLOGVERSION_0_3_4	}
 };
 
 static const EnumMapEntry s_sampleValueTagMap[] =
@@ -308,6 +310,7 @@ void TestResultParser::clear (void)
 	m_curItemList			= DE_NULL;
 	m_base64DecodeOffset	= 0;
 	m_curNumValue.clear();
+	m_imagesByHash.clear();
 }
 
 void TestResultParser::init (TestCaseResult* dstResult)
@@ -529,7 +532,32 @@ void TestResultParser::handleElementStart (void)
 				image->width		= toInt(getAttribute("Width"));
 				image->height		= toInt(getAttribute("Height"));
 				image->format		= getImageFormat(getAttribute("Format"));
-				image->compression	= getImageCompression(getAttribute("CompressionMode"));
+
+				if (m_xmlParser.hasAttribute("Reference"))
+				{
+					// Identical image was already logged in this case, copy data from it.
+					const char* const											hash	= m_xmlParser.getAttribute("Reference");
+					const std::map<string, const ri::Image*>::const_iterator	srcPos	= m_imagesByHash.find(hash);
+
+					if (srcPos == m_imagesByHash.end())
+						throw TestResultParseError(string("Reference to unknown image '") + hash + "'");
+
+					const ri::Image& src = *srcPos->second;
+
+					if (src.width != image->width || src.height != image->height || src.format != image->format)
+						throw TestResultParseError(string("Image '") + image->name + "' doesn't match referenced image");
+
+					image->compression	= src.compression;
+					image->data			= src.data;
+				}
+				else
+				{
+					image->compression	= getImageCompression(getAttribute("CompressionMode"));
+
+					if (m_xmlParser.hasAttribute("Hash"))
+						m_imagesByHash[m_xmlParser.getAttribute("Hash")] = image;
+				}
+
 				item = image;
 				break;
 			}
@@ -897,4 +925,77 @@ void parseTestCaseResultFromData (TestResultParser* parser, TestCaseResult* resu
 	DE_ASSERT(result->statusCode != TESTSTATUSCODE_LAST);
 }
 
+// Self-test
+
+static TestResultParser::ParseResult parseTestCaseResult (TestCaseResult* result, const string& data)
+{
+	TestResultParser parser;
+
+	parser.init(result);
+
+	// \note Terminating null is included.
+	return parser.parse((const deUint8*)data.c_str(), (int)data.size()+1);
+}
+
+static string getImageRefTestLog (const char* referenceImageAttribs)
+{
+	return string("<TestCaseResult Version=\"0.3.4\" CasePath=\"dEQP-X.a\" CaseType=\"SelfValidate\">\n")
+		 + "<ImageSet Name=\"Result\" Description=\"Result\">\n"
+		 + "<Image Name=\"Original\" Description=\"Original\" Width=\"1\" Height=\"1\" Format=\"RGBA8888\" CompressionMode=\"None\" Hash=\"abcd\">AQIDBA==</Image>\n"
+		 + "<Image Name=\"InSet\" Description=\"InSet\" " + referenceImageAttribs + "/>\n"
+		 + "</ImageSet>\n"
+		 + "<Image Name=\"TopLevel\" Description=\"TopLevel\" Width=\"1\" Height=\"1\" Format=\"RGBA8888\" Reference=\"abcd\"/>\n"
+		 + "<Result StatusCode=\"Pass\">Pass</Result>\n"
+		 + "</TestCaseResult>\n";
+}
+
+void TestResultParser_selfTest (void)
+{
+	// Image references are resolved to data of referenced image
+	{
+		TestCaseResult result;
+
+		XE_CHECK(parseTestCaseResult(&result, getImageRefTestLog("Width=\"1\" Height=\"1\" Format=\"RGBA8888\" Reference=\"abcd\"")) == TestResultParser::PARSERESULT_COMPLETE);
+		XE_CHECK(result.statusCode == TESTSTATUSCODE_PASS);
+		XE_CHECK(result.resultItems.getNumItems() == 3);
+		XE_CHECK(result.resultItems.getItem(0).getType() == ri::TYPE_IMAGESET);
+		XE_CHECK(result.resultItems.getItem(1).getType() == ri::TYPE_IMAGE);
+
+		{
+			const ri::ImageSet&	imageSet	= static_cast<const ri::ImageSet&>(result.resultItems.getItem(0));
+			const ri::Image&	original	= static_cast<const ri::Image&>(imageSet.images.getItem(0));
+			const ri::Image&	inSet		= static_cast<const ri::Image&>(imageSet.images.getItem(1));
+			const ri::Image&	topLevel	= static_cast<const ri::Image&>(result.resultItems.getItem(1));
+			const deUint8		expected[]	= { 1, 2, 3, 4 };
+
+			XE_CHECK(imageSet.images.getNumItems() == 2);
+			XE_CHECK(original.data.size() == sizeof(expected) && deMemCmp(&original.data[0], &expected[0], sizeof(expected)) == 0);
+
+			XE_CHECK(inSet.name == "InSet");
+			XE_CHECK(inSet.compression == ri::Image::COMPRESSION_NONE);
+			XE_CHECK(inSet.data == original.data);
+
+			XE_CHECK(topLevel.name == "TopLevel");
+			XE_CHECK(topLevel.compression == ri::Image::COMPRESSION_NONE);
+			XE_CHECK(topLevel.data == original.data);
+		}
+	}
+
+	// Reference to unknown image
+	{
+		TestCaseResult result;
+
+		XE_CHECK(parseTestCaseResult(&result, getImageRefTestLog("Width=\"1\" Height=\"1\" Format=\"RGBA8888\" Reference=\"dcba\"")) == TestResultParser::PARSERESULT_ERROR);
+		XE_CHECK(result.statusCode == TESTSTATUSCODE_INTERNAL_ERROR);
+	}
+
+	// Reference to image of different size
+	{
+		TestCaseResult result;
+
+		XE_CHECK(parseTestCaseResult(&result, getImageRefTestLog("Width=\"2\" Height=\"1\" Format=\"RGBA8888\" Reference=\"abcd\"")) == TestResultParser::PARSERESULT_ERROR);
+		XE_CHECK(result.statusCode == TESTSTATUSCODE_INTERNAL_ERROR);
+	}
+}
+
 } // xe
@@ -28,6 +28,7 @@
 #include "xeTestCaseResult.hpp"
 
 #include <vector>
+#include <map>
 
 namespace xe
 {
@@ -39,6 +40,7 @@ enum TestLogVersion
 	TESTLOGVERSION_0_3_1,
 	TESTLOGVERSION_0_3_2,
 	TESTLOGVERSION_0_3_3,
+	TESTLOGVERSION_0_3_4,
 
 	TESTLOGVERSION_LAST
 };
@@ -108,6 +110,8 @@ private:
 	int						m_base64DecodeOffset;
 
 	std::string				m_curNumValue;
+
+	std::map<std::string, const ri::Image*>	m_imagesByHash;		//!< Images with Hash attribute, for resolving references.
 };
 
 // Helpers exposed to other parsers.
@@ -119,6 +123,8 @@ class TestCaseResultData;
 
 void			parseTestCaseResultFromData	(TestResultParser* parser, TestCaseResult* result, const TestCaseResultData& data);
 
+void			TestResultParser_selfTest	(void);
+
 } // xe
 
 #endif // _XETESTRESULTPARSER_HPP
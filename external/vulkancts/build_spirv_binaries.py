@@ -66,14 +66,14 @@ def cleanDstDir (dstPath):
 		print "Removing %s" % os.path.join(dstPath, binFile)
 		os.remove(os.path.join(dstPath, binFile))
 
-def execBuildPrograms (buildCfg, generator, module, mode, dstPath):
+def execBuildPrograms (buildCfg, generator, module, mode, format, dstPath):
 	workDir = os.path.join(buildCfg.getBuildDir(), "modules", module.dirName)
 
 	pushWorkingDir(workDir)
 
 	try:
 		binPath = generator.getBinaryPath(buildCfg.getBuildType(), os.path.join(".", "vk-build-programs"))
-		execute([binPath, "--mode", mode, "--dst-path", dstPath])
+		execute([binPath, "--mode", mode, "--format", format, "--dst-path", dstPath])
 	finally:
 		popWorkingDir()
 
@@ -99,6 +99,10 @@ def parseArgs ():
 						dest="mode",
 						default="build",
 						help="Build mode (build or verify)")
+	parser.add_argument("--format",
+						dest="format",
+						default="files",
+						help="Registry format (files or packed)")
 	parser.add_argument("-d",
 						"--dst-path",
 						dest="dstPath",
@@ -121,4 +125,4 @@ if __name__ == "__main__":
 		else:
 			os.makedirs(args.dstPath)
 
-	execBuildPrograms(buildCfg, generator, module, args.mode, args.dstPath)
+	execBuildPrograms(buildCfg, generator, module, args.mode, args.format, args.dstPath)
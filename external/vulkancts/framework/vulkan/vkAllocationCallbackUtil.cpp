@@ -29,12 +29,16 @@
  *//*--------------------------------------------------------------------*/
 
 #include "vkAllocationCallbackUtil.hpp"
+#include "vkStrUtil.hpp"
+#include "vkCallStatsWrapper.hpp"
 #include "tcuFormatUtil.hpp"
 #include "tcuTestLog.hpp"
 #include "deSTLUtil.hpp"
 #include "deMemory.h"
+#include "deString.h"
 
 #include <map>
+#include <sstream>
 
 namespace vk
 {
@@ -233,21 +237,167 @@ void ChainedAllocator::notifyInternalFree (size_t size, VkInternalAllocationType
 
 // AllocationCallbackRecorder
 
-AllocationCallbackRecorder::AllocationCallbackRecorder (const VkAllocationCallbacks* allocator, deUint32 callCountHint)
+// AllocationCallbackStats
+
+AllocationCallbackStats::AllocationCallbackStats (void)
+{
+	clear();
+}
+
+void AllocationCallbackStats::clear (void)
+{
+	deMemset(this, 0, sizeof(*this));
+}
+
+int AllocationCallbackStats::getSizeClass (size_t size)
+{
+	int sizeClass = 0;
+
+	size >>= 3;
+
+	while (size > 1 && sizeClass < NUM_SIZE_CLASSES-1)
+	{
+		size >>= 1;
+		sizeClass += 1;
+	}
+
+	return sizeClass;
+}
+
+// AllocationCallbackRecorder
+
+DE_IMPLEMENT_POOL_HASH(LiveAllocationHash, void*, LiveAllocationInfo, dePointerHash, dePointerEqual);
+
+AllocationCallbackRecorder::AllocationCallbackRecorder (const VkAllocationCallbacks* allocator, deUint32 callCountHint, Mode mode)
 	: ChainedAllocator	(allocator)
-	, m_records			(callCountHint)
+	, m_mode			(mode)
+	, m_records			(mode == MODE_RECORD ? callCountHint : 1u)
+	, m_liveAllocations	(DE_NULL)
 {
+	DE_ASSERT(de::inBounds(mode, MODE_RECORD, MODE_LAST));
+
+	m_liveAllocations = LiveAllocationHash_create(m_livePool.getRawPool());
+
+	if (!m_liveAllocations)
+		throw std::bad_alloc();
+
+	// Slot 0 collects callbacks made outside wrapped calls
+	m_stats.numTrackedCalls = 1;
 }
 
 AllocationCallbackRecorder::~AllocationCallbackRecorder (void)
 {
 }
 
+int AllocationCallbackRecorder::findOrAddCall (const char* callName)
+{
+	for (int callNdx = 0; callNdx < m_stats.numTrackedCalls; ++callNdx)
+	{
+		const char* const	name	= m_stats.calls[callNdx].name;
+
+		if (name == callName || (name && callName && deStringEqual(name, callName)))
+			return callNdx;
+	}
+
+	if (m_stats.numTrackedCalls < AllocationCallbackStats::MAX_TRACKED_CALLS)
+	{
+		m_stats.calls[m_stats.numTrackedCalls].name = callName;
+		return m_stats.numTrackedCalls++;
+	}
+
+	return -1;
+}
+
+AllocationCallbackStats::CallCounts& AllocationCallbackRecorder::getCurrentCallCounts (void)
+{
+	const int	callNdx	= findOrAddCall(CallStats::getCurrentCall());
+
+	return callNdx >= 0 ? m_stats.calls[callNdx] : m_stats.otherCalls;
+}
+
+void AllocationCallbackRecorder::appendRecord (const AllocationCallbackRecord& record)
+{
+	if (m_mode == MODE_RECORD)
+		m_records.append(record);
+}
+
+AllocationCallbackStats AllocationCallbackRecorder::getStats (void) const
+{
+	const de::ScopedLock	lock	(m_statsLock);
+
+	return m_stats;
+}
+
+void AllocationCallbackRecorder::addAllocation (void* ptr, size_t size, VkSystemAllocationScope scope)
+{
+	LiveAllocationInfo	allocation;
+
+	allocation.size		= size;
+	allocation.scope	= scope;
+
+	{
+		LiveAllocationInfo* const	existing	= LiveAllocationHash_find(m_liveAllocations, ptr);
+
+		// \note Duplicate pointers are reported by validateAllocationCallbacks()
+		if (existing)
+			*existing = allocation;
+		else if (!LiveAllocationHash_insert(m_liveAllocations, ptr, allocation))
+			throw std::bad_alloc();
+	}
+
+	m_stats.liveBytes		+= size;
+	m_stats.peakBytes		 = de::max(m_stats.peakBytes, m_stats.liveBytes);
+
+	m_stats.sizeClassHistogram[AllocationCallbackStats::getSizeClass(size)] += 1;
+
+	// \note Invalid scopes are reported by validateAllocationCallbacks()
+	if (de::inBounds(scope, (VkSystemAllocationScope)0, VK_SYSTEM_ALLOCATION_SCOPE_LAST))
+	{
+		AllocationCallbackStats::ScopeStats&	scopeStats	= m_stats.scopes[scope];
+
+		scopeStats.numAllocations	+= 1;
+		scopeStats.liveBytes		+= size;
+		scopeStats.peakBytes		 = de::max(scopeStats.peakBytes, scopeStats.liveBytes);
+	}
+}
+
+void AllocationCallbackRecorder::removeAllocation (void* ptr)
+{
+	const LiveAllocationInfo* const	allocation	= LiveAllocationHash_find(m_liveAllocations, ptr);
+
+	// \note Invalid frees are reported by validateAllocationCallbacks()
+	if (!allocation)
+		return;
+
+	m_stats.liveBytes -= allocation->size;
+
+	if (de::inBounds(allocation->scope, (VkSystemAllocationScope)0, VK_SYSTEM_ALLOCATION_SCOPE_LAST))
+		m_stats.scopes[allocation->scope].liveBytes -= allocation->size;
+
+	LiveAllocationHash_delete(m_liveAllocations, ptr);
+}
+
 void* AllocationCallbackRecorder::allocate (size_t size, size_t alignment, VkSystemAllocationScope allocationScope)
 {
 	void* const	ptr	= ChainedAllocator::allocate(size, alignment, allocationScope);
 
-	m_records.append(AllocationCallbackRecord::allocation(size, alignment, allocationScope, ptr));
+	appendRecord(AllocationCallbackRecord::allocation(size, alignment, allocationScope, ptr));
+
+	{
+		const de::ScopedLock					lock	(m_statsLock);
+		AllocationCallbackStats::CallCounts&	call	= getCurrentCallCounts();
+
+		call.numAllocations	+= 1;
+		call.numBytes		+= size;
+
+		if (ptr)
+		{
+			m_stats.numAllocations += 1;
+			addAllocation(ptr, size, allocationScope);
+		}
+		else
+			m_stats.numFailedAllocations += 1;
+	}
 
 	return ptr;
 }
@@ -256,7 +406,43 @@ void* AllocationCallbackRecorder::reallocate (void* original, size_t size, size_
 {
 	void* const	ptr	= ChainedAllocator::reallocate(original, size, alignment, allocationScope);
 
-	m_records.append(AllocationCallbackRecord::reallocation(original, size, alignment, allocationScope, ptr));
+	appendRecord(AllocationCallbackRecord::reallocation(original, size, alignment, allocationScope, ptr));
+
+	{
+		const de::ScopedLock					lock	(m_statsLock);
+		AllocationCallbackStats::CallCounts&	call	= getCurrentCallCounts();
+
+		if (size == 0)
+		{
+			// Equivalent to free
+			if (original)
+			{
+				call.numFrees		+= 1;
+				m_stats.numFrees	+= 1;
+				removeAllocation(original);
+			}
+		}
+		else
+		{
+			call.numAllocations	+= 1;
+			call.numBytes		+= size;
+
+			if (ptr)
+			{
+				if (original)
+				{
+					m_stats.numReallocations += 1;
+					removeAllocation(original);
+				}
+				else
+					m_stats.numAllocations += 1;
+
+				addAllocation(ptr, size, allocationScope);
+			}
+			else
+				m_stats.numFailedAllocations += 1; // Original remains valid
+		}
+	}
 
 	return ptr;
 }
@@ -265,21 +451,45 @@ void AllocationCallbackRecorder::free (void* mem)
 {
 	ChainedAllocator::free(mem);
 
-	m_records.append(AllocationCallbackRecord::free(mem));
+	appendRecord(AllocationCallbackRecord::free(mem));
+
+	if (mem)
+	{
+		const de::ScopedLock					lock	(m_statsLock);
+		AllocationCallbackStats::CallCounts&	call	= getCurrentCallCounts();
+
+		call.numFrees		+= 1;
+		m_stats.numFrees	+= 1;
+		removeAllocation(mem);
+	}
 }
 
 void AllocationCallbackRecorder::notifyInternalAllocation (size_t size, VkInternalAllocationType allocationType, VkSystemAllocationScope allocationScope)
 {
 	ChainedAllocator::notifyInternalAllocation(size, allocationType, allocationScope);
 
-	m_records.append(AllocationCallbackRecord::internalAllocation(size, allocationType, allocationScope));
+	appendRecord(AllocationCallbackRecord::internalAllocation(size, allocationType, allocationScope));
+
+	{
+		const de::ScopedLock	lock	(m_statsLock);
+
+		m_stats.liveInternalBytes	+= size;
+		m_stats.peakInternalBytes	 = de::max(m_stats.peakInternalBytes, m_stats.liveInternalBytes);
+	}
 }
 
 void AllocationCallbackRecorder::notifyInternalFree (size_t size, VkInternalAllocationType allocationType, VkSystemAllocationScope allocationScope)
 {
 	ChainedAllocator::notifyInternalFree(size, allocationType, allocationScope);
 
-	m_records.append(AllocationCallbackRecord::internalFree(size, allocationType, allocationScope));
+	appendRecord(AllocationCallbackRecord::internalFree(size, allocationType, allocationScope));
+
+	{
+		const de::ScopedLock	lock	(m_statsLock);
+
+		// \note Negative totals are reported by validateAllocationCallbacks()
+		m_stats.liveInternalBytes -= de::min(m_stats.liveInternalBytes, size);
+	}
 }
 
 // DeterministicFailAllocator
@@ -364,6 +574,7 @@ void validateAllocationCallbacks (const AllocationCallbackRecorder& recorder, Al
 	std::map<void*, size_t>			ptrToSlotIndex;
 
 	DE_ASSERT(results->liveAllocations.empty() && results->violations.empty());
+	TCU_CHECK_INTERNAL(recorder.getMode() == AllocationCallbackRecorder::MODE_RECORD);
 
 	for (AllocationCallbackRecorder::RecordIterator callbackIter = recorder.getRecordsBegin();
 		 callbackIter != recorder.getRecordsEnd();
@@ -633,6 +844,84 @@ bool validateAndLog (tcu::TestLog& log, const AllocationCallbackRecorder& record
 	return checkAndLog(log, validationResults, allowedLiveAllocScopeBits);
 }
 
+namespace
+{
+
+std::string getSizeClassName (int sizeClass)
+{
+	std::ostringstream	str;
+
+	if (sizeClass == 0)
+		str << "<16";
+	else if (sizeClass == AllocationCallbackStats::NUM_SIZE_CLASSES-1)
+		str << ">=" << (1u << (sizeClass+3));
+	else
+		str << (1u << (sizeClass+3)) << "-" << ((1u << (sizeClass+4))-1u);
+
+	return str.str();
+}
+
+void logCallCounts (tcu::TestLog& log, const char* name, const AllocationCallbackStats::CallCounts& call)
+{
+	if (call.numAllocations == 0 && call.numFrees == 0)
+		return;
+
+	log << tcu::TestLog::Message << name << ": "
+								 << call.numAllocations << " allocations (" << call.numBytes << " bytes), "
+								 << call.numFrees << " frees"
+		<< tcu::TestLog::EndMessage;
+}
+
+} // anonymous
+
+void logAllocationStats (tcu::TestLog& log, const std::string& name, const std::string& description, const AllocationCallbackStats& stats)
+{
+	using tcu::TestLog;
+
+	log << TestLog::Section(name, description)
+		<< TestLog::Integer("NumAllocations",		"Number of allocations",			"",			QP_KEY_TAG_NONE,	(deInt64)stats.numAllocations)
+		<< TestLog::Integer("NumReallocations",		"Number of reallocations",			"",			QP_KEY_TAG_NONE,	(deInt64)stats.numReallocations)
+		<< TestLog::Integer("NumFrees",				"Number of frees",					"",			QP_KEY_TAG_NONE,	(deInt64)stats.numFrees)
+		<< TestLog::Integer("NumFailedAllocations",	"Number of failed allocations",		"",			QP_KEY_TAG_NONE,	(deInt64)stats.numFailedAllocations)
+		<< TestLog::Integer("LiveBytes",			"Bytes still allocated",			"bytes",	QP_KEY_TAG_NONE,	(deInt64)stats.liveBytes)
+		<< TestLog::Integer("PeakBytes",			"Peak allocated bytes",				"bytes",	QP_KEY_TAG_NONE,	(deInt64)stats.peakBytes)
+		<< TestLog::Integer("PeakInternalBytes",	"Peak internal allocation total",	"bytes",	QP_KEY_TAG_NONE,	(deInt64)stats.peakInternalBytes);
+
+	for (int scopeNdx = 0; scopeNdx < VK_SYSTEM_ALLOCATION_SCOPE_LAST; ++scopeNdx)
+	{
+		const AllocationCallbackStats::ScopeStats&	scope	= stats.scopes[scopeNdx];
+
+		if (scope.numAllocations > 0)
+			log << TestLog::Message << getSystemAllocationScopeStr((VkSystemAllocationScope)scopeNdx) << ": "
+									<< scope.numAllocations << " allocations, "
+									<< scope.liveBytes << " bytes live, "
+									<< scope.peakBytes << " bytes peak"
+				<< TestLog::EndMessage;
+	}
+
+	if (stats.numAllocations + stats.numReallocations > 0)
+	{
+		std::ostringstream	histogram;
+
+		histogram << "Allocation sizes:";
+
+		for (int sizeClass = 0; sizeClass < AllocationCallbackStats::NUM_SIZE_CLASSES; ++sizeClass)
+		{
+			if (stats.sizeClassHistogram[sizeClass] > 0)
+				histogram << " " << getSizeClassName(sizeClass) << "=" << stats.sizeClassHistogram[sizeClass];
+		}
+
+		log << TestLog::Message << histogram.str() << TestLog::EndMessage;
+	}
+
+	for (int callNdx = 0; callNdx < stats.numTrackedCalls; ++callNdx)
+		logCallCounts(log, stats.calls[callNdx].name ? stats.calls[callNdx].name : "<unattributed>", stats.calls[callNdx]);
+
+	logCallCounts(log, "<other>", stats.otherCalls);
+
+	log << TestLog::EndSection;
+}
+
 std::ostream& operator<< (std::ostream& str, const AllocationCallbackRecord& record)
 {
 	switch (record.type)
@@ -32,8 +32,12 @@
 
 #include "vkDefs.hpp"
 #include "deAppendList.hpp"
+#include "deMutex.hpp"
+#include "deMemPool.hpp"
+#include "dePoolHash.h"
 
 #include <vector>
+#include <string>
 #include <ostream>
 
 namespace tcu
@@ -137,10 +141,81 @@ private:
 	const VkAllocationCallbacks*	m_nextAllocator;
 };
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Allocation profile collected by AllocationCallbackRecorder
+ *
+ * Statistics are updated as callbacks are made and their size does not
+ * depend on the number of calls. Per-call counts are kept for at most
+ * MAX_TRACKED_CALLS distinct call names; the rest are accumulated into
+ * otherCalls.
+ *//*--------------------------------------------------------------------*/
+struct AllocationCallbackStats
+{
+	enum
+	{
+		NUM_SIZE_CLASSES	= 16,	//!< Class 0: < 16 bytes, class N: [2^(N+3), 2^(N+4)) bytes, last class is unbounded
+		MAX_TRACKED_CALLS	= 32
+	};
+
+	struct ScopeStats
+	{
+		deUint64	numAllocations;
+		size_t		liveBytes;
+		size_t		peakBytes;
+	};
+
+	struct CallCounts
+	{
+		const char*	name;			//!< Entry point given by CallStats::getCurrentCall(), or DE_NULL for callbacks made outside wrapped calls
+		deUint64	numAllocations;
+		deUint64	numFrees;
+		deUint64	numBytes;		//!< Total bytes requested by allocations and reallocations
+	};
+
+	deUint64		numAllocations;		//!< Successful allocations, including reallocations of null pointer
+	deUint64		numReallocations;
+	deUint64		numFrees;			//!< Frees of non-null pointers, including reallocations to size 0
+	deUint64		numFailedAllocations;
+
+	size_t			liveBytes;
+	size_t			peakBytes;
+	size_t			liveInternalBytes;
+	size_t			peakInternalBytes;
+
+	ScopeStats		scopes[VK_SYSTEM_ALLOCATION_SCOPE_LAST];
+	deUint64		sizeClassHistogram[NUM_SIZE_CLASSES];
+
+	CallCounts		calls[MAX_TRACKED_CALLS];
+	int				numTrackedCalls;
+	CallCounts		otherCalls;
+
+					AllocationCallbackStats	(void);
+
+	void			clear					(void);
+
+	static int		getSizeClass			(size_t size);
+};
+
+struct LiveAllocationInfo
+{
+	size_t					size;
+	VkSystemAllocationScope	scope;
+};
+
+DE_DECLARE_POOL_HASH(LiveAllocationHash, void*, LiveAllocationInfo);
+
 class AllocationCallbackRecorder : public ChainedAllocator
 {
 public:
-							AllocationCallbackRecorder	(const VkAllocationCallbacks* allocator, deUint32 callCountHint = 1024);
+	enum Mode
+	{
+		MODE_RECORD = 0,	//!< Keep all callbacks for validateAllocationCallbacks() in addition to statistics
+		MODE_PROFILE,		//!< Collect statistics only, memory use depends on live allocations instead of number of callbacks
+
+		MODE_LAST
+	};
+
+							AllocationCallbackRecorder	(const VkAllocationCallbacks* allocator, deUint32 callCountHint = 1024, Mode mode = MODE_RECORD);
 							~AllocationCallbackRecorder	(void);
 
 	void*					allocate					(size_t size, size_t alignment, VkSystemAllocationScope allocationScope);
@@ -152,13 +227,32 @@ public:
 
 	typedef de::AppendList<AllocationCallbackRecord>::const_iterator	RecordIterator;
 
+	Mode					getMode						(void) const { return m_mode;				}
+
+	//! Records are only available in MODE_RECORD
 	RecordIterator			getRecordsBegin				(void) const { return m_records.begin();	}
 	RecordIterator			getRecordsEnd				(void) const { return m_records.end();		}
 
+	//! Callbacks are attributed to the entry point executing through a call stats wrapper, see CallStats::getCurrentCall()
+	AllocationCallbackStats	getStats					(void) const;
+
 private:
-	typedef de::AppendList<AllocationCallbackRecord> Records;
+	typedef de::AppendList<AllocationCallbackRecord>	Records;
 
+	int						findOrAddCall				(const char* callName);
+	AllocationCallbackStats::CallCounts&	getCurrentCallCounts	(void);
+	void					addAllocation				(void* ptr, size_t size, VkSystemAllocationScope scope);
+	void					removeAllocation			(void* ptr);
+
+	void					appendRecord				(const AllocationCallbackRecord& record);
+
+	const Mode				m_mode;
 	Records					m_records;
+
+	mutable de::Mutex		m_statsLock;
+	AllocationCallbackStats	m_stats;
+	de::MemPool				m_livePool;
+	LiveAllocationHash*		m_liveAllocations;			//!< Pointer -> size and scope, slots are recycled through the pool hash free list
 };
 
 //! Allocator that starts returning null after N allocs
@@ -221,6 +315,8 @@ void							validateAllocationCallbacks	(const AllocationCallbackRecorder& record
 bool							checkAndLog					(tcu::TestLog& log, const AllocationCallbackValidationResults& results, deUint32 allowedLiveAllocScopeBits);
 bool							validateAndLog				(tcu::TestLog& log, const AllocationCallbackRecorder& recorder, deUint32 allowedLiveAllocScopeBits);
 
+void							logAllocationStats			(tcu::TestLog& log, const std::string& name, const std::string& description, const AllocationCallbackStats& stats);
+
 std::ostream&					operator<<					(std::ostream& str, const AllocationCallbackRecord& record);
 std::ostream&					operator<<					(std::ostream& str, const AllocationCallbackViolation& violation);
 
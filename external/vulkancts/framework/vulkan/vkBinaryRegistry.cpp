@@ -35,6 +35,8 @@
 #include "deStringUtil.hpp"
 #include "deString.h"
 #include "deInt32.h"
+#include "deMemory.h"
+#include "tcuPackedArchive.hpp"
 
 #include <sstream>
 #include <fstream>
@@ -62,6 +64,11 @@ string getIndexPath (const std::string& dirName)
 	return de::FilePath::join(dirName, "index.bin").getPath();
 }
 
+string getPackedRegistryPath (const std::string& dirName)
+{
+	return de::FilePath::join(dirName, "registry.bin").getPath();
+}
+
 void writeBinary (const std::string& dstDir, deUint32 index, const ProgramBinary& binary)
 {
 	const de::FilePath	fullPath	= getProgramPath(dstDir, index);
@@ -105,7 +112,8 @@ std::vector<deUint32> getSearchPath (const ProgramIdentifier& id)
 	return words;
 }
 
-const deUint32* findBinaryIndex (BinaryIndexAccess* index, const ProgramIdentifier& id)
+template<typename IndexAccess>
+const deUint32* findBinaryIndex (IndexAccess* index, const ProgramIdentifier& id)
 {
 	const vector<deUint32>	words	= getSearchPath(id);
 	size_t					nodeNdx	= 0;
@@ -296,8 +304,9 @@ void buildFinalIndex (std::vector<BinaryIndexNode>* dst, const SparseIndexNode*
 
 DE_IMPLEMENT_POOL_HASH(BinaryHash, const ProgramBinary*, deUint32, binaryHash, binaryEqual);
 
-BinaryRegistryWriter::BinaryRegistryWriter (const std::string& dstPath)
+BinaryRegistryWriter::BinaryRegistryWriter (const std::string& dstPath, RegistryFormat format)
 	: m_dstPath			(dstPath)
+	, m_format			(format)
 	, m_binaryIndexMap	(DE_NULL)
 {
 	m_binaryIndexMap = BinaryHash_create(m_memPool.getRawPool());
@@ -336,7 +345,8 @@ void BinaryRegistryWriter::storeProgram (const ProgramIdentifier& id, const Prog
 			throw;
 		}
 
-		writeBinary(m_dstPath, index, binary);
+		if (m_format == REGISTRY_FORMAT_FILES)
+			writeBinary(m_dstPath, index, binary);
 
 		if (!BinaryHash_insert(m_binaryIndexMap, binaryClone, index))
 			throw std::bad_alloc();
@@ -368,6 +378,12 @@ void BinaryRegistryWriter::writeIndex (void) const
 	// Even in empty index there is always terminating node for the root group
 	DE_ASSERT(!index.empty());
 
+	if (m_format == REGISTRY_FORMAT_PACKED)
+	{
+		writePackedRegistry(index);
+		return;
+	}
+
 	if (!de::FilePath(indexPath.getDirName()).exists())
 		de::createDirectoryAndParents(indexPath.getDirName().c_str());
 
@@ -381,11 +397,174 @@ void BinaryRegistryWriter::writeIndex (void) const
 	}
 }
 
+void BinaryRegistryWriter::writePackedRegistry (const std::vector<BinaryIndexNode>& index) const
+{
+	const de::FilePath				registryPath	= getPackedRegistryPath(m_dstPath);
+	PackedRegistryHeader			header;
+	std::vector<PackedBinaryEntry>	entries			(m_compactedBinaries.size());
+	size_t							offset			= sizeof(PackedRegistryHeader) + index.size()*sizeof(BinaryIndexNode) + entries.size()*sizeof(PackedBinaryEntry);
+
+	header.magic			= PACKED_REGISTRY_MAGIC;
+	header.version			= PACKED_REGISTRY_VERSION;
+	header.numIndexNodes	= (deUint32)index.size();
+	header.numBinaries		= (deUint32)m_compactedBinaries.size();
+
+	for (size_t binaryNdx = 0; binaryNdx < m_compactedBinaries.size(); binaryNdx++)
+	{
+		offset = deAlignSize(offset, sizeof(deUint32));
+
+		if (offset + m_compactedBinaries[binaryNdx]->getSize() > (size_t)std::numeric_limits<deUint32>::max())
+			throw tcu::InternalError("Packed program registry too large");
+
+		entries[binaryNdx].offset	= (deUint32)offset;
+		entries[binaryNdx].size		= (deUint32)m_compactedBinaries[binaryNdx]->getSize();
+
+		offset += m_compactedBinaries[binaryNdx]->getSize();
+	}
+
+	if (!de::FilePath(registryPath.getDirName()).exists())
+		de::createDirectoryAndParents(registryPath.getDirName().c_str());
+
+	{
+		std::ofstream	out			(registryPath.getPath(), std::ios_base::binary);
+		const deUint8	padding[4]	= { 0, 0, 0, 0 };
+
+		if (!out.is_open() || !out.good())
+			throw tcu::InternalError(string("Failed to open program registry file ") + registryPath.getPath());
+
+		out.write((const char*)&header, sizeof(header));
+		out.write((const char*)&index[0], index.size()*sizeof(BinaryIndexNode));
+
+		if (!entries.empty())
+			out.write((const char*)&entries[0], entries.size()*sizeof(PackedBinaryEntry));
+
+		for (size_t binaryNdx = 0; binaryNdx < m_compactedBinaries.size(); binaryNdx++)
+		{
+			const size_t	curOffset	= (size_t)out.tellp();
+
+			DE_ASSERT(curOffset <= entries[binaryNdx].offset && entries[binaryNdx].offset - curOffset < sizeof(padding));
+			out.write((const char*)&padding[0], entries[binaryNdx].offset - curOffset);
+			out.write((const char*)m_compactedBinaries[binaryNdx]->getBinary(), m_compactedBinaries[binaryNdx]->getSize());
+		}
+
+		out.close();
+
+		if (out.fail())
+			throw tcu::InternalError(string("Failed to write program registry file ") + registryPath.getPath());
+	}
+}
+
+// PackedRegistry
+
+PackedRegistry::PackedRegistry (const tcu::Archive& archive, const std::string& path, de::MovePtr<tcu::Resource> resource)
+	: m_resource		(resource)
+	, m_data			(DE_NULL)
+	, m_size			((size_t)m_resource->getSize())
+	, m_binaryEntries	(DE_NULL)
+	, m_numBinaries		(0)
+{
+	PackedRegistryHeader header;
+
+	if (const tcu::MemoryResource* const memResource = dynamic_cast<const tcu::MemoryResource*>(m_resource.get()))
+	{
+		// Resource in packed archive, already mapped
+		m_data = memResource->getData();
+	}
+	else if (dynamic_cast<const tcu::FileResource*>(m_resource.get()))
+	{
+		// \note File resource name is the full path of the file
+		m_mappedFile	= de::MovePtr<de::MappedFile>(new de::MappedFile(m_resource->getName().c_str()));
+		m_data			= m_mappedFile->getPtr();
+		m_size			= (size_t)m_mappedFile->getSize();
+	}
+
+	if (m_size < sizeof(PackedRegistryHeader))
+		throw tcu::ResourceError("Program registry is truncated", path.c_str(), __FILE__, __LINE__);
+
+	if (m_data)
+		deMemcpy(&header, m_data, sizeof(header));
+	else
+	{
+		m_resource->setPosition(0);
+		m_resource->read((deUint8*)&header, (int)sizeof(header));
+	}
+
+	if (header.magic != (deUint32)PACKED_REGISTRY_MAGIC || header.version != (deUint32)PACKED_REGISTRY_VERSION)
+		throw tcu::ResourceError("Invalid program registry header", path.c_str(), __FILE__, __LINE__);
+
+	{
+		const size_t	indexOffset		= sizeof(PackedRegistryHeader);
+		const size_t	entriesOffset	= indexOffset + (size_t)header.numIndexNodes*sizeof(BinaryIndexNode);
+		const size_t	dataOffset		= entriesOffset + (size_t)header.numBinaries*sizeof(PackedBinaryEntry);
+
+		if (header.numIndexNodes == 0 || dataOffset > m_size)
+			throw tcu::ResourceError("Program registry is truncated", path.c_str(), __FILE__, __LINE__);
+
+		m_numBinaries = header.numBinaries;
+
+		if (m_data)
+		{
+			m_mappedIndex	= de::MovePtr<MappedBinaryIndexAccess>(new MappedBinaryIndexAccess((const BinaryIndexNode*)(m_data + indexOffset), header.numIndexNodes));
+			m_binaryEntries	= (const PackedBinaryEntry*)(m_data + entriesOffset);
+		}
+		else
+		{
+			// Index is paged in on demand through separate resource, binary table is small enough to read at once
+			m_lazyIndex = de::MovePtr<BinaryIndexAccess>(new BinaryIndexAccess(de::MovePtr<tcu::Resource>(archive.getResource(path.c_str())), indexOffset, header.numIndexNodes));
+
+			if (m_numBinaries > 0)
+			{
+				m_binaryEntryStorage.resize(m_numBinaries);
+				m_resource->setPosition((int)entriesOffset);
+				m_resource->read((deUint8*)&m_binaryEntryStorage[0], (int)(m_numBinaries*sizeof(PackedBinaryEntry)));
+				m_binaryEntries = &m_binaryEntryStorage[0];
+			}
+		}
+	}
+}
+
+PackedRegistry::~PackedRegistry (void)
+{
+}
+
+const deUint32* PackedRegistry::findBinaryIndex (const ProgramIdentifier& id)
+{
+	if (m_mappedIndex)
+		return BinaryRegistryDetail::findBinaryIndex(m_mappedIndex.get(), id);
+	else
+		return BinaryRegistryDetail::findBinaryIndex(m_lazyIndex.get(), id);
+}
+
+ProgramBinary* PackedRegistry::loadBinary (deUint32 binaryNdx)
+{
+	TCU_CHECK_INTERNAL((size_t)binaryNdx < m_numBinaries);
+
+	{
+		const PackedBinaryEntry&	entry	= m_binaryEntries[binaryNdx];
+
+		TCU_CHECK_INTERNAL(entry.size > 0 && (size_t)entry.offset <= m_size && (size_t)entry.size <= m_size - (size_t)entry.offset);
+		TCU_CHECK_INTERNAL(entry.offset % sizeof(deUint32) == 0);
+
+		if (m_data)
+			return ProgramBinary::createView(PROGRAM_FORMAT_SPIRV, entry.size, m_data + entry.offset);
+		else
+		{
+			vector<deUint8> bytes (entry.size);
+
+			m_resource->setPosition((int)entry.offset);
+			m_resource->read(&bytes[0], (int)bytes.size());
+
+			return new ProgramBinary(PROGRAM_FORMAT_SPIRV, bytes.size(), &bytes[0]);
+		}
+	}
+}
+
 // BinaryRegistryReader
 
 BinaryRegistryReader::BinaryRegistryReader (const tcu::Archive& archive, const std::string& srcPath)
-	: m_archive	(archive)
-	, m_srcPath	(srcPath)
+	: m_archive			(archive)
+	, m_srcPath			(srcPath)
+	, m_isInitialized	(false)
 {
 }
 
@@ -395,6 +574,49 @@ BinaryRegistryReader::~BinaryRegistryReader (void)
 
 ProgramBinary* BinaryRegistryReader::loadProgram (const ProgramIdentifier& id) const
 {
+	// \note Background program builds (see vkt::TestCaseExecutor::prepareNextCase()) load
+	//		 binaries while the current case may be loading its own.
+	const de::ScopedLock	lock	(m_lock);
+
+	if (!m_isInitialized)
+	{
+		const string				packedPath	= getPackedRegistryPath(m_srcPath);
+		de::MovePtr<tcu::Resource>	packedRes;
+
+		m_isInitialized = true;
+
+		try
+		{
+			packedRes = de::MovePtr<tcu::Resource>(m_archive.getResource(packedPath.c_str()));
+		}
+		catch (const tcu::ResourceError&)
+		{
+			// Not available, use index.bin
+		}
+
+		if (packedRes)
+		{
+			try
+			{
+				m_packedRegistry = PackedRegistryPtr(new PackedRegistry(m_archive, packedPath, packedRes));
+			}
+			catch (const tcu::ResourceError& e)
+			{
+				throw ProgramNotFoundException(id, string("Failed to open program registry (") + e.what() + ")");
+			}
+		}
+	}
+
+	if (m_packedRegistry)
+	{
+		const deUint32* const	indexPos	= m_packedRegistry->findBinaryIndex(id);
+
+		if (indexPos)
+			return m_packedRegistry->loadBinary(*indexPos);
+		else
+			throw ProgramNotFoundException(id, "Program not found in index");
+	}
+
 	if (!m_binaryIndex)
 	{
 		try
@@ -36,6 +36,8 @@
 #include "deMemPool.hpp"
 #include "dePoolHash.h"
 #include "deUniquePtr.hpp"
+#include "deMappedFile.hpp"
+#include "deMutex.hpp"
 
 #include <map>
 #include <vector>
@@ -110,6 +112,7 @@ class LazyResource
 {
 public:
 									LazyResource		(de::MovePtr<tcu::Resource> resource);
+									LazyResource		(de::MovePtr<tcu::Resource> resource, size_t offset, size_t numElements);
 
 	const Element&					operator[]			(size_t ndx);
 	size_t							size				(void) const { return m_elements.size();	}
@@ -126,6 +129,7 @@ private:
 	void							makePageResident	(size_t pageNdx);
 
 	de::UniquePtr<tcu::Resource>	m_resource;
+	const size_t					m_offset;			//!< Offset of first element in resource
 
 	std::vector<Element>			m_elements;
 	std::vector<bool>				m_isPageResident;
@@ -133,7 +137,8 @@ private:
 
 template<typename Element>
 LazyResource<Element>::LazyResource (de::MovePtr<tcu::Resource> resource)
-	: m_resource(resource)
+	: m_resource	(resource)
+	, m_offset		(0)
 {
 	const size_t	resSize		= m_resource->getSize();
 	const size_t	numElements	= resSize/sizeof(Element);
@@ -145,6 +150,19 @@ LazyResource<Element>::LazyResource (de::MovePtr<tcu::Resource> resource)
 	m_isPageResident.resize(numPages, false);
 }
 
+template<typename Element>
+LazyResource<Element>::LazyResource (de::MovePtr<tcu::Resource> resource, size_t offset, size_t numElements)
+	: m_resource	(resource)
+	, m_offset		(offset)
+{
+	const size_t	numPages	= (numElements >> ELEMENTS_PER_PAGE_LOG2) + ((numElements & ((1u<<ELEMENTS_PER_PAGE_LOG2)-1u)) == 0 ? 0 : 1);
+
+	TCU_CHECK_INTERNAL(offset + numElements*sizeof(Element) <= (size_t)m_resource->getSize());
+
+	m_elements.resize(numElements);
+	m_isPageResident.resize(numPages, false);
+}
+
 template<typename Element>
 const Element& LazyResource<Element>::operator[] (size_t ndx)
 {
@@ -168,8 +186,8 @@ void LazyResource<Element>::makePageResident (size_t pageNdx)
 
 	DE_ASSERT(!isPageResident(pageNdx));
 
-	if ((size_t)m_resource->getPosition() != pageOffset)
-		m_resource->setPosition((int)pageOffset);
+	if ((size_t)m_resource->getPosition() != m_offset + pageOffset)
+		m_resource->setPosition((int)(m_offset + pageOffset));
 
 	m_resource->read((deUint8*)&m_elements[pageNdx << ELEMENTS_PER_PAGE_LOG2], (int)numBytesToRead);
 	m_isPageResident[pageNdx] = true;
@@ -177,6 +195,94 @@ void LazyResource<Element>::makePageResident (size_t pageNdx)
 
 typedef LazyResource<BinaryIndexNode> BinaryIndexAccess;
 
+//! Index access for index that is already in memory, such as memory-mapped packed registry.
+class MappedBinaryIndexAccess
+{
+public:
+								MappedBinaryIndexAccess	(const BinaryIndexNode* nodes, size_t numNodes) : m_nodes(nodes), m_numNodes(numNodes) {}
+
+	const BinaryIndexNode&		operator[]				(size_t ndx) const;
+	size_t						size					(void) const { return m_numNodes;	}
+
+private:
+	const BinaryIndexNode*		m_nodes;
+	size_t						m_numNodes;
+};
+
+inline const BinaryIndexNode& MappedBinaryIndexAccess::operator[] (size_t ndx) const
+{
+	if (ndx >= m_numNodes)
+		throw std::out_of_range("");
+
+	return m_nodes[ndx];
+}
+
+// Packed Registry
+// ---------------
+//
+// Deploying and opening tens of thousands of small binary files is slow on
+// many device file systems. Packed registry stores the binary index and all
+// de-duplicated binaries in a single file:
+//
+//   PackedRegistryHeader
+//   BinaryIndexNode[numIndexNodes]		(same trie as in index.bin)
+//   PackedBinaryEntry[numBinaries]
+//   binary data						(each binary aligned to 4 bytes)
+//
+// All values are stored in native byte order, as in index.bin.
+//
+// When the registry file can be memory-mapped (it is stored in a packed
+// archive or a directory), binaries are returned as views into the mapping
+// and no data is copied. Otherwise index pages are read lazily as with
+// index.bin, and binaries are read from the file on demand.
+
+struct PackedRegistryHeader
+{
+	deUint32	magic;				//!< PACKED_REGISTRY_MAGIC
+	deUint32	version;			//!< PACKED_REGISTRY_VERSION
+	deUint32	numIndexNodes;
+	deUint32	numBinaries;
+};
+
+struct PackedBinaryEntry
+{
+	deUint32	offset;				//!< Offset from beginning of file
+	deUint32	size;
+};
+
+enum
+{
+	PACKED_REGISTRY_MAGIC	= 0x52425644,	//!< "DVBR"
+	PACKED_REGISTRY_VERSION	= 1
+};
+
+class PackedRegistry
+{
+public:
+										PackedRegistry		(const tcu::Archive& archive, const std::string& path, de::MovePtr<tcu::Resource> resource);
+										~PackedRegistry		(void);
+
+	//! Get binary index, or DE_NULL if program is not in registry.
+	const deUint32*						findBinaryIndex		(const ProgramIdentifier& id);
+	ProgramBinary*						loadBinary			(deUint32 binaryNdx);
+
+private:
+										PackedRegistry		(const PackedRegistry&);
+	PackedRegistry&						operator=			(const PackedRegistry&);
+
+	de::UniquePtr<tcu::Resource>			m_resource;
+	de::MovePtr<de::MappedFile>				m_mappedFile;
+	const deUint8*							m_data;					//!< Registry contents, or DE_NULL if registry is not mapped
+	size_t									m_size;
+
+	de::MovePtr<MappedBinaryIndexAccess>	m_mappedIndex;			//!< Index access if registry is mapped
+	de::MovePtr<BinaryIndexAccess>			m_lazyIndex;			//!< Index access otherwise
+
+	const PackedBinaryEntry*				m_binaryEntries;
+	size_t									m_numBinaries;
+	std::vector<PackedBinaryEntry>			m_binaryEntryStorage;	//!< Copy of binary table if registry is not mapped
+};
+
 DE_DECLARE_POOL_HASH(BinaryHash, const ProgramBinary*, deUint32);
 
 class BinaryRegistryReader
@@ -185,24 +291,39 @@ public:
 							BinaryRegistryReader	(const tcu::Archive& archive, const std::string& srcPath);
 							~BinaryRegistryReader	(void);
 
+	//! Load program. Returned binary may reference memory owned by registry and must not outlive it.
+	//! \note Can be called from multiple threads.
 	ProgramBinary*			loadProgram				(const ProgramIdentifier& id) const;
 
 private:
-	typedef de::MovePtr<BinaryIndexAccess> BinaryIndexPtr;
+	typedef de::MovePtr<BinaryIndexAccess>	BinaryIndexPtr;
+	typedef de::MovePtr<PackedRegistry>		PackedRegistryPtr;
 
 	const tcu::Archive&		m_archive;
 	const std::string		m_srcPath;
 
-	mutable BinaryIndexPtr	m_binaryIndex;
+	mutable de::Mutex		m_lock;					//!< Protects lazily opened registry and index and reads through them.
+	mutable bool			m_isInitialized;
+	mutable PackedRegistryPtr	m_packedRegistry;	//!< Packed registry, if available
+	mutable BinaryIndexPtr	m_binaryIndex;			//!< index.bin, if packed registry is not available
+};
+
+enum RegistryFormat
+{
+	REGISTRY_FORMAT_FILES = 0,		//!< index.bin and one file per binary
+	REGISTRY_FORMAT_PACKED,			//!< Single registry.bin
+
+	REGISTRY_FORMAT_LAST
 };
 
 class BinaryRegistryWriter
 {
 public:
-						BinaryRegistryWriter	(const std::string& dstPath);
+						BinaryRegistryWriter	(const std::string& dstPath, RegistryFormat format = REGISTRY_FORMAT_FILES);
 						~BinaryRegistryWriter	(void);
 
 	void				storeProgram			(const ProgramIdentifier& id, const ProgramBinary& binary);
+	//! Write index.bin, or registry.bin with all binaries in packed format.
 	void				writeIndex				(void) const;
 
 private:
@@ -221,7 +342,10 @@ private:
 	typedef std::vector<ProgramBinary*>	BinaryVector;
 	typedef std::vector<BinaryIndex>	BinaryIndexVector;
 
+	void				writePackedRegistry		(const std::vector<BinaryIndexNode>& index) const;
+
 	const std::string&	m_dstPath;
+	const RegistryFormat	m_format;
 
 	de::MemPool			m_memPool;
 	BinaryHash*			m_binaryIndexMap;		//!< ProgramBinary -> slot in m_compactedBinaries
@@ -235,6 +359,9 @@ using BinaryRegistryDetail::BinaryRegistryReader;
 using BinaryRegistryDetail::BinaryRegistryWriter;
 using BinaryRegistryDetail::ProgramIdentifier;
 using BinaryRegistryDetail::ProgramNotFoundException;
+using BinaryRegistryDetail::RegistryFormat;
+using BinaryRegistryDetail::REGISTRY_FORMAT_FILES;
+using BinaryRegistryDetail::REGISTRY_FORMAT_PACKED;
 
 } // vk
 
@@ -0,0 +1,267 @@
+/*-------------------------------------------------------------------------
+ * Vulkan CTS Framework
+ * --------------------
+ *
+ * Copyright (c) 2015 Google Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and/or associated documentation files (the
+ * "Materials"), to deal in the Materials without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Materials, and to
+ * permit persons to whom the Materials are furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice(s) and this permission notice shall be
+ * included in all copies or substantial portions of the Materials.
+ *
+ * THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+ *
+ *//*!
+ * \file
+ * \brief Vulkan API call statistics wrappers.
+ *//*--------------------------------------------------------------------*/
+
+#include "vkCallStatsWrapper.hpp"
+#include "tcuTestLog.hpp"
+#include "deClock.h"
+#include "deInt32.h"
+#include "deMemory.h"
+#include "deThreadLocal.hpp"
+
+#include <algorithm>
+#include <sstream>
+#include <iomanip>
+
+namespace vk
+{
+
+using std::vector;
+
+namespace
+{
+
+de::ThreadLocal	s_currentCall;
+
+class CallTimer
+{
+public:
+	CallTimer (CallStats& stats, int functionNdx)
+		: m_stats		(stats)
+		, m_functionNdx	(functionNdx)
+		, m_prevCall	(s_currentCall.get())
+		, m_startTime	(deGetMicroseconds())
+	{
+		s_currentCall.set(const_cast<char*>(stats.getFunctionName(functionNdx)));
+	}
+
+	~CallTimer (void)
+	{
+		m_stats.record(m_functionNdx, deGetMicroseconds() - m_startTime);
+		s_currentCall.set(m_prevCall);
+	}
+
+private:
+	CallStats&		m_stats;
+	const int		m_functionNdx;
+	void* const		m_prevCall;		//!< Restored on exit in case wrappers are nested
+	const deUint64	m_startTime;
+};
+
+struct FunctionEntry
+{
+	int							functionNdx;
+	CallStats::FunctionStats	stats;
+};
+
+bool compareTotalTimeDescending (const FunctionEntry& a, const FunctionEntry& b)
+{
+	if (a.stats.totalTimeUs != b.stats.totalTimeUs)
+		return a.stats.totalTimeUs > b.stats.totalTimeUs;
+	else
+		return a.stats.numCalls > b.stats.numCalls;
+}
+
+std::string getBucketName (int bucketNdx)
+{
+	std::ostringstream	str;
+
+	if (bucketNdx == 0)
+		str << "<1us";
+	else if (bucketNdx == CallStats::NUM_LATENCY_BUCKETS-1)
+		str << ">=" << (1u << (bucketNdx-1)) << "us";
+	else
+		str << (1u << (bucketNdx-1)) << "-" << (1u << bucketNdx) << "us";
+
+	return str.str();
+}
+
+} // anonymous
+
+// CallStats
+
+CallStats::FunctionStats::FunctionStats (void)
+	: numCalls		(0)
+	, totalTimeUs	(0)
+	, maxTimeUs		(0)
+{
+	deMemset(latencyHistogram, 0, sizeof(latencyHistogram));
+}
+
+CallStats::CallStats (const char* apiName, const char* const* functionNames, int numFunctions)
+	: m_apiName			(apiName)
+	, m_functionNames	(functionNames)
+	, m_stats			(numFunctions)
+{
+}
+
+CallStats::~CallStats (void)
+{
+}
+
+int CallStats::getLatencyBucket (deUint64 durationUs)
+{
+	int bucketNdx = 0;
+
+	while (durationUs > 0 && bucketNdx < NUM_LATENCY_BUCKETS-1)
+	{
+		durationUs >>= 1;
+		bucketNdx += 1;
+	}
+
+	return bucketNdx;
+}
+
+const char* CallStats::getCurrentCall (void)
+{
+	return static_cast<const char*>(s_currentCall.get());
+}
+
+void CallStats::record (int functionNdx, deUint64 durationUs)
+{
+	const int				bucketNdx	= getLatencyBucket(durationUs);
+	const de::ScopedLock	lock		(m_lock);
+	FunctionStats&			stats		= m_stats[functionNdx];
+
+	stats.numCalls						+= 1;
+	stats.totalTimeUs					+= durationUs;
+	stats.maxTimeUs						 = de::max(stats.maxTimeUs, durationUs);
+	stats.latencyHistogram[bucketNdx]	+= 1;
+}
+
+void CallStats::reset (void)
+{
+	const de::ScopedLock	lock	(m_lock);
+
+	std::fill(m_stats.begin(), m_stats.end(), FunctionStats());
+}
+
+const char* CallStats::getFunctionName (int functionNdx) const
+{
+	DE_ASSERT(de::inBounds(functionNdx, 0, getNumFunctions()));
+	return m_functionNames[functionNdx];
+}
+
+CallStats::FunctionStats CallStats::getStats (int functionNdx) const
+{
+	const de::ScopedLock	lock	(m_lock);
+
+	return m_stats[functionNdx];
+}
+
+void CallStats::log (tcu::TestLog& log) const
+{
+	vector<FunctionEntry>	entries;
+	deUint64				totalCalls	= 0;
+	deUint64				totalTimeUs	= 0;
+
+	{
+		const de::ScopedLock	lock	(m_lock);
+
+		for (int ndx = 0; ndx < (int)m_stats.size(); ++ndx)
+		{
+			if (m_stats[ndx].numCalls > 0)
+			{
+				FunctionEntry	entry;
+
+				entry.functionNdx	= ndx;
+				entry.stats			= m_stats[ndx];
+
+				entries.push_back(entry);
+
+				totalCalls	+= entry.stats.numCalls;
+				totalTimeUs	+= entry.stats.totalTimeUs;
+			}
+		}
+	}
+
+	std::sort(entries.begin(), entries.end(), compareTotalTimeDescending);
+
+	{
+		const std::string	sectionName	= std::string(m_apiName) + "CallStats";
+		const std::string	sectionDesc	= std::string("Vulkan ") + m_apiName + " API call statistics";
+
+		log << tcu::TestLog::Section(sectionName, sectionDesc)
+			<< tcu::TestLog::Integer("NumCalls", "Total number of calls", "", QP_KEY_TAG_NONE, (deInt64)totalCalls)
+			<< tcu::TestLog::Float("TotalTime", "Total time spent in API calls", "ms", QP_KEY_TAG_TIME, (float)totalTimeUs / 1000.0f);
+
+		for (size_t entryNdx = 0; entryNdx < entries.size(); ++entryNdx)
+		{
+			const FunctionStats&	stats	= entries[entryNdx].stats;
+			std::ostringstream		msg;
+
+			msg << getFunctionName(entries[entryNdx].functionNdx) << ": "
+				<< stats.numCalls << " calls, "
+				<< std::fixed << std::setprecision(3)
+				<< "total " << (double)stats.totalTimeUs / 1000.0 << " ms, "
+				<< "avg " << (double)stats.totalTimeUs / (double)stats.numCalls << " us, "
+				<< "max " << stats.maxTimeUs << " us, latency:";
+
+			for (int bucketNdx = 0; bucketNdx < NUM_LATENCY_BUCKETS; ++bucketNdx)
+			{
+				if (stats.latencyHistogram[bucketNdx] > 0)
+					msg << " " << getBucketName(bucketNdx) << "=" << stats.latencyHistogram[bucketNdx];
+			}
+
+			log << tcu::TestLog::Message << msg.str() << tcu::TestLog::EndMessage;
+		}
+
+		log << tcu::TestLog::EndSection;
+	}
+}
+
+// InstanceCallStatsWrapper
+
+#include "vkInstanceCallStatsWrapperImpl.inl"
+
+InstanceCallStatsWrapper::InstanceCallStatsWrapper (const InstanceInterface& vk)
+	: m_vk		(vk)
+	, m_stats	("Instance", s_instanceFunctionNames, DE_LENGTH_OF_ARRAY(s_instanceFunctionNames))
+{
+}
+
+InstanceCallStatsWrapper::~InstanceCallStatsWrapper (void)
+{
+}
+
+// DeviceCallStatsWrapper
+
+#include "vkDeviceCallStatsWrapperImpl.inl"
+
+DeviceCallStatsWrapper::DeviceCallStatsWrapper (const DeviceInterface& vk)
+	: m_vk		(vk)
+	, m_stats	("Device", s_deviceFunctionNames, DE_LENGTH_OF_ARRAY(s_deviceFunctionNames))
+{
+}
+
+DeviceCallStatsWrapper::~DeviceCallStatsWrapper (void)
+{
+}
+
+} // vk
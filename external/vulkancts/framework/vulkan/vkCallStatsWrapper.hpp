@@ -0,0 +1,135 @@
+#ifndef _VKCALLSTATSWRAPPER_HPP
+#define _VKCALLSTATSWRAPPER_HPP
+/*-------------------------------------------------------------------------
+ * Vulkan CTS Framework
+ * --------------------
+ *
+ * Copyright (c) 2015 Google Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and/or associated documentation files (the
+ * "Materials"), to deal in the Materials without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Materials, and to
+ * permit persons to whom the Materials are furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice(s) and this permission notice shall be
+ * included in all copies or substantial portions of the Materials.
+ *
+ * THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+ *
+ *//*!
+ * \file
+ * \brief Vulkan API call statistics wrappers.
+ *
+ * InstanceCallStatsWrapper and DeviceCallStatsWrapper forward every call
+ * to the wrapped interface and record call count and latency for each
+ * entry point. Latencies are measured with deGetMicroseconds(); calls
+ * shorter than the clock resolution are still accounted for correctly on
+ * average since timer phase is uncorrelated with call start.
+ *
+ * While a wrapped call is executing, its entry point name is available to
+ * code running on the same thread via CallStats::getCurrentCall(). This
+ * is used by AllocationCallbackRecorder to attribute allocation callbacks.
+ *//*--------------------------------------------------------------------*/
+
+#include "vkDefs.hpp"
+#include "deMutex.hpp"
+
+#include <vector>
+
+namespace tcu
+{
+class TestLog;
+}
+
+namespace vk
+{
+
+class CallStats
+{
+public:
+	enum
+	{
+		NUM_LATENCY_BUCKETS	= 16
+	};
+
+	struct FunctionStats
+	{
+		deUint64				numCalls;
+		deUint64				totalTimeUs;
+		deUint64				maxTimeUs;
+		deUint64				latencyHistogram[NUM_LATENCY_BUCKETS];	//!< Bucket 0: < 1us, bucket N: [2^(N-1), 2^N) us, last bucket is unbounded
+
+								FunctionStats	(void);
+	};
+
+								CallStats		(const char* apiName, const char* const* functionNames, int numFunctions);
+								~CallStats		(void);
+
+	void						record			(int functionNdx, deUint64 durationUs);
+	void						reset			(void);
+
+	int							getNumFunctions	(void) const { return (int)m_stats.size();	}
+	const char*					getFunctionName	(int functionNdx) const;
+	FunctionStats				getStats		(int functionNdx) const;
+
+	//! Write statistics of all called functions to log, most expensive first.
+	void						log				(tcu::TestLog& log) const;
+
+	static int					getLatencyBucket	(deUint64 durationUs);
+
+	//! Entry point currently executing through a call stats wrapper on calling thread, or DE_NULL
+	static const char*			getCurrentCall		(void);
+
+private:
+								CallStats		(const CallStats&);
+	CallStats&					operator=		(const CallStats&);
+
+	const char* const			m_apiName;
+	const char* const* const	m_functionNames;
+
+	mutable de::Mutex			m_lock;
+	std::vector<FunctionStats>	m_stats;
+};
+
+class InstanceCallStatsWrapper : public InstanceInterface
+{
+public:
+								InstanceCallStatsWrapper	(const InstanceInterface& vk);
+	virtual						~InstanceCallStatsWrapper	(void);
+
+#include "vkConcreteInstanceInterface.inl"
+
+	CallStats&					getStats					(void) const { return m_stats;	}
+
+private:
+	const InstanceInterface&	m_vk;
+	mutable CallStats			m_stats;
+};
+
+class DeviceCallStatsWrapper : public DeviceInterface
+{
+public:
+								DeviceCallStatsWrapper		(const DeviceInterface& vk);
+	virtual						~DeviceCallStatsWrapper		(void);
+
+#include "vkConcreteDeviceInterface.inl"
+
+	CallStats&					getStats					(void) const { return m_stats;	}
+
+private:
+	const DeviceInterface&		m_vk;
+	mutable CallStats			m_stats;
+};
+
+} // vk
+
+#endif // _VKCALLSTATSWRAPPER_HPP
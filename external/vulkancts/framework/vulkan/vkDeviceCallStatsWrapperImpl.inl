@@ -0,0 +1,854 @@
+/* WARNING: This is auto-generated file. Do not modify, since changes will
+ * be lost! Modify the generating script instead.
+ */
+
+static const char* const s_deviceFunctionNames[] =
+{
+	"vkDestroyDevice",
+	"vkGetDeviceQueue",
+	"vkQueueSubmit",
+	"vkQueueWaitIdle",
+	"vkDeviceWaitIdle",
+	"vkAllocateMemory",
+	"vkFreeMemory",
+	"vkMapMemory",
+	"vkUnmapMemory",
+	"vkFlushMappedMemoryRanges",
+	"vkInvalidateMappedMemoryRanges",
+	"vkGetDeviceMemoryCommitment",
+	"vkBindBufferMemory",
+	"vkBindImageMemory",
+	"vkGetBufferMemoryRequirements",
+	"vkGetImageMemoryRequirements",
+	"vkGetImageSparseMemoryRequirements",
+	"vkGetPhysicalDeviceSparseImageFormatProperties",
+	"vkQueueBindSparse",
+	"vkCreateFence",
+	"vkDestroyFence",
+	"vkResetFences",
+	"vkGetFenceStatus",
+	"vkWaitForFences",
+	"vkCreateSemaphore",
+	"vkDestroySemaphore",
+	"vkCreateEvent",
+	"vkDestroyEvent",
+	"vkGetEventStatus",
+	"vkSetEvent",
+	"vkResetEvent",
+	"vkCreateQueryPool",
+	"vkDestroyQueryPool",
+	"vkGetQueryPoolResults",
+	"vkCreateBuffer",
+	"vkDestroyBuffer",
+	"vkCreateBufferView",
+	"vkDestroyBufferView",
+	"vkCreateImage",
+	"vkDestroyImage",
+	"vkGetImageSubresourceLayout",
+	"vkCreateImageView",
+	"vkDestroyImageView",
+	"vkCreateShaderModule",
+	"vkDestroyShaderModule",
+	"vkCreatePipelineCache",
+	"vkDestroyPipelineCache",
+	"vkGetPipelineCacheData",
+	"vkMergePipelineCaches",
+	"vkCreateGraphicsPipelines",
+	"vkCreateComputePipelines",
+	"vkDestroyPipeline",
+	"vkCreatePipelineLayout",
+	"vkDestroyPipelineLayout",
+	"vkCreateSampler",
+	"vkDestroySampler",
+	"vkCreateDescriptorSetLayout",
+	"vkDestroyDescriptorSetLayout",
+	"vkCreateDescriptorPool",
+	"vkDestroyDescriptorPool",
+	"vkResetDescriptorPool",
+	"vkAllocateDescriptorSets",
+	"vkFreeDescriptorSets",
+	"vkUpdateDescriptorSets",
+	"vkCreateFramebuffer",
+	"vkDestroyFramebuffer",
+	"vkCreateRenderPass",
+	"vkDestroyRenderPass",
+	"vkGetRenderAreaGranularity",
+	"vkCreateCommandPool",
+	"vkDestroyCommandPool",
+	"vkResetCommandPool",
+	"vkAllocateCommandBuffers",
+	"vkFreeCommandBuffers",
+	"vkBeginCommandBuffer",
+	"vkEndCommandBuffer",
+	"vkResetCommandBuffer",
+	"vkCmdBindPipeline",
+	"vkCmdSetViewport",
+	"vkCmdSetScissor",
+	"vkCmdSetLineWidth",
+	"vkCmdSetDepthBias",
+	"vkCmdSetBlendConstants",
+	"vkCmdSetDepthBounds",
+	"vkCmdSetStencilCompareMask",
+	"vkCmdSetStencilWriteMask",
+	"vkCmdSetStencilReference",
+	"vkCmdBindDescriptorSets",
+	"vkCmdBindIndexBuffer",
+	"vkCmdBindVertexBuffers",
+	"vkCmdDraw",
+	"vkCmdDrawIndexed",
+	"vkCmdDrawIndirect",
+	"vkCmdDrawIndexedIndirect",
+	"vkCmdDispatch",
+	"vkCmdDispatchIndirect",
+	"vkCmdCopyBuffer",
+	"vkCmdCopyImage",
+	"vkCmdBlitImage",
+	"vkCmdCopyBufferToImage",
+	"vkCmdCopyImageToBuffer",
+	"vkCmdUpdateBuffer",
+	"vkCmdFillBuffer",
+	"vkCmdClearColorImage",
+	"vkCmdClearDepthStencilImage",
+	"vkCmdClearAttachments",
+	"vkCmdResolveImage",
+	"vkCmdSetEvent",
+	"vkCmdResetEvent",
+	"vkCmdWaitEvents",
+	"vkCmdPipelineBarrier",
+	"vkCmdBeginQuery",
+	"vkCmdEndQuery",
+	"vkCmdResetQueryPool",
+	"vkCmdWriteTimestamp",
+	"vkCmdCopyQueryPoolResults",
+	"vkCmdPushConstants",
+	"vkCmdBeginRenderPass",
+	"vkCmdNextSubpass",
+	"vkCmdEndRenderPass",
+	"vkCmdExecuteCommands",
+};
+
+void DeviceCallStatsWrapper::destroyDevice (VkDevice device, const VkAllocationCallbacks* pAllocator) const
+{
+	const CallTimer	timer	(m_stats, 0);
+	m_vk.destroyDevice(device, pAllocator);
+}
+
+void DeviceCallStatsWrapper::getDeviceQueue (VkDevice device, deUint32 queueFamilyIndex, deUint32 queueIndex, VkQueue* pQueue) const
+{
+	const CallTimer	timer	(m_stats, 1);
+	m_vk.getDeviceQueue(device, queueFamilyIndex, queueIndex, pQueue);
+}
+
+VkResult DeviceCallStatsWrapper::queueSubmit (VkQueue queue, deUint32 submitCount, const VkSubmitInfo* pSubmits, VkFence fence) const
+{
+	const CallTimer	timer	(m_stats, 2);
+	return m_vk.queueSubmit(queue, submitCount, pSubmits, fence);
+}
+
+VkResult DeviceCallStatsWrapper::queueWaitIdle (VkQueue queue) const
+{
+	const CallTimer	timer	(m_stats, 3);
+	return m_vk.queueWaitIdle(queue);
+}
+
+VkResult DeviceCallStatsWrapper::deviceWaitIdle (VkDevice device) const
+{
+	const CallTimer	timer	(m_stats, 4);
+	return m_vk.deviceWaitIdle(device);
+}
+
+VkResult DeviceCallStatsWrapper::allocateMemory (VkDevice device, const VkMemoryAllocateInfo* pAllocateInfo, const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory) const
+{
+	const CallTimer	timer	(m_stats, 5);
+	return m_vk.allocateMemory(device, pAllocateInfo, pAllocator, pMemory);
+}
+
+void DeviceCallStatsWrapper::freeMemory (VkDevice device, VkDeviceMemory memory, const VkAllocationCallbacks* pAllocator) const
+{
+	const CallTimer	timer	(m_stats, 6);
+	m_vk.freeMemory(device, memory, pAllocator);
+}
+
+VkResult DeviceCallStatsWrapper::mapMemory (VkDevice device, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size, VkMemoryMapFlags flags, void** ppData) const
+{
+	const CallTimer	timer	(m_stats, 7);
+	return m_vk.mapMemory(device, memory, offset, size, flags, ppData);
+}
+
+void DeviceCallStatsWrapper::unmapMemory (VkDevice device, VkDeviceMemory memory) const
+{
+	const CallTimer	timer	(m_stats, 8);
+	m_vk.unmapMemory(device, memory);
+}
+
+VkResult DeviceCallStatsWrapper::flushMappedMemoryRanges (VkDevice device, deUint32 memoryRangeCount, const VkMappedMemoryRange* pMemoryRanges) const
+{
+	const CallTimer	timer	(m_stats, 9);
+	return m_vk.flushMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
+}
+
+VkResult DeviceCallStatsWrapper::invalidateMappedMemoryRanges (VkDevice device, deUint32 memoryRangeCount, const VkMappedMemoryRange* pMemoryRanges) const
+{
+	const CallTimer	timer	(m_stats, 10);
+	return m_vk.invalidateMappedMemoryRanges(device, memoryRangeCount, pMemoryRanges);
+}
+
+void DeviceCallStatsWrapper::getDeviceMemoryCommitment (VkDevice device, VkDeviceMemory memory, VkDeviceSize* pCommittedMemoryInBytes) const
+{
+	const CallTimer	timer	(m_stats, 11);
+	m_vk.getDeviceMemoryCommitment(device, memory, pCommittedMemoryInBytes);
+}
+
+VkResult DeviceCallStatsWrapper::bindBufferMemory (VkDevice device, VkBuffer buffer, VkDeviceMemory memory, VkDeviceSize memoryOffset) const
+{
+	const CallTimer	timer	(m_stats, 12);
+	return m_vk.bindBufferMemory(device, buffer, memory, memoryOffset);
+}
+
+VkResult DeviceCallStatsWrapper::bindImageMemory (VkDevice device, VkImage image, VkDeviceMemory memory, VkDeviceSize memoryOffset) const
+{
+	const CallTimer	timer	(m_stats, 13);
+	return m_vk.bindImageMemory(device, image, memory, memoryOffset);
+}
+
+void DeviceCallStatsWrapper::getBufferMemoryRequirements (VkDevice device, VkBuffer buffer, VkMemoryRequirements* pMemoryRequirements) const
+{
+	const CallTimer	timer	(m_stats, 14);
+	m_vk.getBufferMemoryRequirements(device, buffer, pMemoryRequirements);
+}
+
+void DeviceCallStatsWrapper::getImageMemoryRequirements (VkDevice device, VkImage image, VkMemoryRequirements* pMemoryRequirements) const
+{
+	const CallTimer	timer	(m_stats, 15);
+	m_vk.getImageMemoryRequirements(device, image, pMemoryRequirements);
+}
+
+void DeviceCallStatsWrapper::getImageSparseMemoryRequirements (VkDevice device, VkImage image, deUint32* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements* pSparseMemoryRequirements) const
+{
+	const CallTimer	timer	(m_stats, 16);
+	m_vk.getImageSparseMemoryRequirements(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+}
+
+void DeviceCallStatsWrapper::getPhysicalDeviceSparseImageFormatProperties (VkPhysicalDevice physicalDevice, VkFormat format, VkImageType type, VkSampleCountFlagBits samples, VkImageUsageFlags usage, VkImageTiling tiling, deUint32* pPropertyCount, VkSparseImageFormatProperties* pProperties) const
+{
+	const CallTimer	timer	(m_stats, 17);
+	m_vk.getPhysicalDeviceSparseImageFormatProperties(physicalDevice, format, type, samples, usage, tiling, pPropertyCount, pProperties);
+}
+
+VkResult DeviceCallStatsWrapper::queueBindSparse (VkQueue queue, deUint32 bindInfoCount, const VkBindSparseInfo* pBindInfo, VkFence fence) const
+{
+	const CallTimer	timer	(m_stats, 18);
+	return m_vk.queueBindSparse(queue, bindInfoCount, pBindInfo, fence);
+}
+
+VkResult DeviceCallStatsWrapper::createFence (VkDevice device, const VkFenceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkFence* pFence) const
+{
+	const CallTimer	timer	(m_stats, 19);
+	return m_vk.createFence(device, pCreateInfo, pAllocator, pFence);
+}
+
+void DeviceCallStatsWrapper::destroyFence (VkDevice device, VkFence fence, const VkAllocationCallbacks* pAllocator) const
+{
+	const CallTimer	timer	(m_stats, 20);
+	m_vk.destroyFence(device, fence, pAllocator);
+}
+
+VkResult DeviceCallStatsWrapper::resetFences (VkDevice device, deUint32 fenceCount, const VkFence* pFences) const
+{
+	const CallTimer	timer	(m_stats, 21);
+	return m_vk.resetFences(device, fenceCount, pFences);
+}
+
+VkResult DeviceCallStatsWrapper::getFenceStatus (VkDevice device, VkFence fence) const
+{
+	const CallTimer	timer	(m_stats, 22);
+	return m_vk.getFenceStatus(device, fence);
+}
+
+VkResult DeviceCallStatsWrapper::waitForFences (VkDevice device, deUint32 fenceCount, const VkFence* pFences, VkBool32 waitAll, deUint64 timeout) const
+{
+	const CallTimer	timer	(m_stats, 23);
+	return m_vk.waitForFences(device, fenceCount, pFences, waitAll, timeout);
+}
+
+VkResult DeviceCallStatsWrapper::createSemaphore (VkDevice device, const VkSemaphoreCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSemaphore* pSemaphore) const
+{
+	const CallTimer	timer	(m_stats, 24);
+	return m_vk.createSemaphore(device, pCreateInfo, pAllocator, pSemaphore);
+}
+
+void DeviceCallStatsWrapper::destroySemaphore (VkDevice device, VkSemaphore semaphore, const VkAllocationCallbacks* pAllocator) const
+{
+	const CallTimer	timer	(m_stats, 25);
+	m_vk.destroySemaphore(device, semaphore, pAllocator);
+}
+
+VkResult DeviceCallStatsWrapper::createEvent (VkDevice device, const VkEventCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkEvent* pEvent) const
+{
+	const CallTimer	timer	(m_stats, 26);
+	return m_vk.createEvent(device, pCreateInfo, pAllocator, pEvent);
+}
+
+void DeviceCallStatsWrapper::destroyEvent (VkDevice device, VkEvent event, const VkAllocationCallbacks* pAllocator) const
+{
+	const CallTimer	timer	(m_stats, 27);
+	m_vk.destroyEvent(device, event, pAllocator);
+}
+
+VkResult DeviceCallStatsWrapper::getEventStatus (VkDevice device, VkEvent event) const
+{
+	const CallTimer	timer	(m_stats, 28);
+	return m_vk.getEventStatus(device, event);
+}
+
+VkResult DeviceCallStatsWrapper::setEvent (VkDevice device, VkEvent event) const
+{
+	const CallTimer	timer	(m_stats, 29);
+	return m_vk.setEvent(device, event);
+}
+
+VkResult DeviceCallStatsWrapper::resetEvent (VkDevice device, VkEvent event) const
+{
+	const CallTimer	timer	(m_stats, 30);
+	return m_vk.resetEvent(device, event);
+}
+
+VkResult DeviceCallStatsWrapper::createQueryPool (VkDevice device, const VkQueryPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkQueryPool* pQueryPool) const
+{
+	const CallTimer	timer	(m_stats, 31);
+	return m_vk.createQueryPool(device, pCreateInfo, pAllocator, pQueryPool);
+}
+
+void DeviceCallStatsWrapper::destroyQueryPool (VkDevice device, VkQueryPool queryPool, const VkAllocationCallbacks* pAllocator) const
+{
+	const CallTimer	timer	(m_stats, 32);
+	m_vk.destroyQueryPool(device, queryPool, pAllocator);
+}
+
+VkResult DeviceCallStatsWrapper::getQueryPoolResults (VkDevice device, VkQueryPool queryPool, deUint32 firstQuery, deUint32 queryCount, deUintptr dataSize, void* pData, VkDeviceSize stride, VkQueryResultFlags flags) const
+{
+	const CallTimer	timer	(m_stats, 33);
+	return m_vk.getQueryPoolResults(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
+}
+
+VkResult DeviceCallStatsWrapper::createBuffer (VkDevice device, const VkBufferCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBuffer* pBuffer) const
+{
+	const CallTimer	timer	(m_stats, 34);
+	return m_vk.createBuffer(device, pCreateInfo, pAllocator, pBuffer);
+}
+
+void DeviceCallStatsWrapper::destroyBuffer (VkDevice device, VkBuffer buffer, const VkAllocationCallbacks* pAllocator) const
+{
+	const CallTimer	timer	(m_stats, 35);
+	m_vk.destroyBuffer(device, buffer, pAllocator);
+}
+
+VkResult DeviceCallStatsWrapper::createBufferView (VkDevice device, const VkBufferViewCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkBufferView* pView) const
+{
+	const CallTimer	timer	(m_stats, 36);
+	return m_vk.createBufferView(device, pCreateInfo, pAllocator, pView);
+}
+
+void DeviceCallStatsWrapper::destroyBufferView (VkDevice device, VkBufferView bufferView, const VkAllocationCallbacks* pAllocator) const
+{
+	const CallTimer	timer	(m_stats, 37);
+	m_vk.destroyBufferView(device, bufferView, pAllocator);
+}
+
+VkResult DeviceCallStatsWrapper::createImage (VkDevice device, const VkImageCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkImage* pImage) const
+{
+	const CallTimer	timer	(m_stats, 38);
+	return m_vk.createImage(device, pCreateInfo, pAllocator, pImage);
+}
+
+void DeviceCallStatsWrapper::destroyImage (VkDevice device, VkImage image, const VkAllocationCallbacks* pAllocator) const
+{
+	const CallTimer	timer	(m_stats, 39);
+	m_vk.destroyImage(device, image, pAllocator);
+}
+
+void DeviceCallStatsWrapper::getImageSubresourceLayout (VkDevice device, VkImage image, const VkImageSubresource* pSubresource, VkSubresourceLayout* pLayout) const
+{
+	const CallTimer	timer	(m_stats, 40);
+	m_vk.getImageSubresourceLayout(device, image, pSubresource, pLayout);
+}
+
+VkResult DeviceCallStatsWrapper::createImageView (VkDevice device, const VkImageViewCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkImageView* pView) const
+{
+	const CallTimer	timer	(m_stats, 41);
+	return m_vk.createImageView(device, pCreateInfo, pAllocator, pView);
+}
+
+void DeviceCallStatsWrapper::destroyImageView (VkDevice device, VkImageView imageView, const VkAllocationCallbacks* pAllocator) const
+{
+	const CallTimer	timer	(m_stats, 42);
+	m_vk.destroyImageView(device, imageView, pAllocator);
+}
+
+VkResult DeviceCallStatsWrapper::createShaderModule (VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule) const
+{
+	const CallTimer	timer	(m_stats, 43);
+	return m_vk.createShaderModule(device, pCreateInfo, pAllocator, pShaderModule);
+}
+
+void DeviceCallStatsWrapper::destroyShaderModule (VkDevice device, VkShaderModule shaderModule, const VkAllocationCallbacks* pAllocator) const
+{
+	const CallTimer	timer	(m_stats, 44);
+	m_vk.destroyShaderModule(device, shaderModule, pAllocator);
+}
+
+VkResult DeviceCallStatsWrapper::createPipelineCache (VkDevice device, const VkPipelineCacheCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineCache* pPipelineCache) const
+{
+	const CallTimer	timer	(m_stats, 45);
+	return m_vk.createPipelineCache(device, pCreateInfo, pAllocator, pPipelineCache);
+}
+
+void DeviceCallStatsWrapper::destroyPipelineCache (VkDevice device, VkPipelineCache pipelineCache, const VkAllocationCallbacks* pAllocator) const
+{
+	const CallTimer	timer	(m_stats, 46);
+	m_vk.destroyPipelineCache(device, pipelineCache, pAllocator);
+}
+
+VkResult DeviceCallStatsWrapper::getPipelineCacheData (VkDevice device, VkPipelineCache pipelineCache, deUintptr* pDataSize, void* pData) const
+{
+	const CallTimer	timer	(m_stats, 47);
+	return m_vk.getPipelineCacheData(device, pipelineCache, pDataSize, pData);
+}
+
+VkResult DeviceCallStatsWrapper::mergePipelineCaches (VkDevice device, VkPipelineCache dstCache, deUint32 srcCacheCount, const VkPipelineCache* pSrcCaches) const
+{
+	const CallTimer	timer	(m_stats, 48);
+	return m_vk.mergePipelineCaches(device, dstCache, srcCacheCount, pSrcCaches);
+}
+
+VkResult DeviceCallStatsWrapper::createGraphicsPipelines (VkDevice device, VkPipelineCache pipelineCache, deUint32 createInfoCount, const VkGraphicsPipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) const
+{
+	const CallTimer	timer	(m_stats, 49);
+	return m_vk.createGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+}
+
+VkResult DeviceCallStatsWrapper::createComputePipelines (VkDevice device, VkPipelineCache pipelineCache, deUint32 createInfoCount, const VkComputePipelineCreateInfo* pCreateInfos, const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) const
+{
+	const CallTimer	timer	(m_stats, 50);
+	return m_vk.createComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+}
+
+void DeviceCallStatsWrapper::destroyPipeline (VkDevice device, VkPipeline pipeline, const VkAllocationCallbacks* pAllocator) const
+{
+	const CallTimer	timer	(m_stats, 51);
+	m_vk.destroyPipeline(device, pipeline, pAllocator);
+}
+
+VkResult DeviceCallStatsWrapper::createPipelineLayout (VkDevice device, const VkPipelineLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkPipelineLayout* pPipelineLayout) const
+{
+	const CallTimer	timer	(m_stats, 52);
+	return m_vk.createPipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout);
+}
+
+void DeviceCallStatsWrapper::destroyPipelineLayout (VkDevice device, VkPipelineLayout pipelineLayout, const VkAllocationCallbacks* pAllocator) const
+{
+	const CallTimer	timer	(m_stats, 53);
+	m_vk.destroyPipelineLayout(device, pipelineLayout, pAllocator);
+}
+
+VkResult DeviceCallStatsWrapper::createSampler (VkDevice device, const VkSamplerCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkSampler* pSampler) const
+{
+	const CallTimer	timer	(m_stats, 54);
+	return m_vk.createSampler(device, pCreateInfo, pAllocator, pSampler);
+}
+
+void DeviceCallStatsWrapper::destroySampler (VkDevice device, VkSampler sampler, const VkAllocationCallbacks* pAllocator) const
+{
+	const CallTimer	timer	(m_stats, 55);
+	m_vk.destroySampler(device, sampler, pAllocator);
+}
+
+VkResult DeviceCallStatsWrapper::createDescriptorSetLayout (VkDevice device, const VkDescriptorSetLayoutCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorSetLayout* pSetLayout) const
+{
+	const CallTimer	timer	(m_stats, 56);
+	return m_vk.createDescriptorSetLayout(device, pCreateInfo, pAllocator, pSetLayout);
+}
+
+void DeviceCallStatsWrapper::destroyDescriptorSetLayout (VkDevice device, VkDescriptorSetLayout descriptorSetLayout, const VkAllocationCallbacks* pAllocator) const
+{
+	const CallTimer	timer	(m_stats, 57);
+	m_vk.destroyDescriptorSetLayout(device, descriptorSetLayout, pAllocator);
+}
+
+VkResult DeviceCallStatsWrapper::createDescriptorPool (VkDevice device, const VkDescriptorPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDescriptorPool* pDescriptorPool) const
+{
+	const CallTimer	timer	(m_stats, 58);
+	return m_vk.createDescriptorPool(device, pCreateInfo, pAllocator, pDescriptorPool);
+}
+
+void DeviceCallStatsWrapper::destroyDescriptorPool (VkDevice device, VkDescriptorPool descriptorPool, const VkAllocationCallbacks* pAllocator) const
+{
+	const CallTimer	timer	(m_stats, 59);
+	m_vk.destroyDescriptorPool(device, descriptorPool, pAllocator);
+}
+
+VkResult DeviceCallStatsWrapper::resetDescriptorPool (VkDevice device, VkDescriptorPool descriptorPool, VkDescriptorPoolResetFlags flags) const
+{
+	const CallTimer	timer	(m_stats, 60);
+	return m_vk.resetDescriptorPool(device, descriptorPool, flags);
+}
+
+VkResult DeviceCallStatsWrapper::allocateDescriptorSets (VkDevice device, const VkDescriptorSetAllocateInfo* pAllocateInfo, VkDescriptorSet* pDescriptorSets) const
+{
+	const CallTimer	timer	(m_stats, 61);
+	return m_vk.allocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
+}
+
+VkResult DeviceCallStatsWrapper::freeDescriptorSets (VkDevice device, VkDescriptorPool descriptorPool, deUint32 descriptorSetCount, const VkDescriptorSet* pDescriptorSets) const
+{
+	const CallTimer	timer	(m_stats, 62);
+	return m_vk.freeDescriptorSets(device, descriptorPool, descriptorSetCount, pDescriptorSets);
+}
+
+void DeviceCallStatsWrapper::updateDescriptorSets (VkDevice device, deUint32 descriptorWriteCount, const VkWriteDescriptorSet* pDescriptorWrites, deUint32 descriptorCopyCount, const VkCopyDescriptorSet* pDescriptorCopies) const
+{
+	const CallTimer	timer	(m_stats, 63);
+	m_vk.updateDescriptorSets(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
+}
+
+VkResult DeviceCallStatsWrapper::createFramebuffer (VkDevice device, const VkFramebufferCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkFramebuffer* pFramebuffer) const
+{
+	const CallTimer	timer	(m_stats, 64);
+	return m_vk.createFramebuffer(device, pCreateInfo, pAllocator, pFramebuffer);
+}
+
+void DeviceCallStatsWrapper::destroyFramebuffer (VkDevice device, VkFramebuffer framebuffer, const VkAllocationCallbacks* pAllocator) const
+{
+	const CallTimer	timer	(m_stats, 65);
+	m_vk.destroyFramebuffer(device, framebuffer, pAllocator);
+}
+
+VkResult DeviceCallStatsWrapper::createRenderPass (VkDevice device, const VkRenderPassCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass) const
+{
+	const CallTimer	timer	(m_stats, 66);
+	return m_vk.createRenderPass(device, pCreateInfo, pAllocator, pRenderPass);
+}
+
+void DeviceCallStatsWrapper::destroyRenderPass (VkDevice device, VkRenderPass renderPass, const VkAllocationCallbacks* pAllocator) const
+{
+	const CallTimer	timer	(m_stats, 67);
+	m_vk.destroyRenderPass(device, renderPass, pAllocator);
+}
+
+void DeviceCallStatsWrapper::getRenderAreaGranularity (VkDevice device, VkRenderPass renderPass, VkExtent2D* pGranularity) const
+{
+	const CallTimer	timer	(m_stats, 68);
+	m_vk.getRenderAreaGranularity(device, renderPass, pGranularity);
+}
+
+VkResult DeviceCallStatsWrapper::createCommandPool (VkDevice device, const VkCommandPoolCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkCommandPool* pCommandPool) const
+{
+	const CallTimer	timer	(m_stats, 69);
+	return m_vk.createCommandPool(device, pCreateInfo, pAllocator, pCommandPool);
+}
+
+void DeviceCallStatsWrapper::destroyCommandPool (VkDevice device, VkCommandPool commandPool, const VkAllocationCallbacks* pAllocator) const
+{
+	const CallTimer	timer	(m_stats, 70);
+	m_vk.destroyCommandPool(device, commandPool, pAllocator);
+}
+
+VkResult DeviceCallStatsWrapper::resetCommandPool (VkDevice device, VkCommandPool commandPool, VkCommandPoolResetFlags flags) const
+{
+	const CallTimer	timer	(m_stats, 71);
+	return m_vk.resetCommandPool(device, commandPool, flags);
+}
+
+VkResult DeviceCallStatsWrapper::allocateCommandBuffers (VkDevice device, const VkCommandBufferAllocateInfo* pAllocateInfo, VkCommandBuffer* pCommandBuffers) const
+{
+	const CallTimer	timer	(m_stats, 72);
+	return m_vk.allocateCommandBuffers(device, pAllocateInfo, pCommandBuffers);
+}
+
+void DeviceCallStatsWrapper::freeCommandBuffers (VkDevice device, VkCommandPool commandPool, deUint32 commandBufferCount, const VkCommandBuffer* pCommandBuffers) const
+{
+	const CallTimer	timer	(m_stats, 73);
+	m_vk.freeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
+}
+
+VkResult DeviceCallStatsWrapper::beginCommandBuffer (VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo* pBeginInfo) const
+{
+	const CallTimer	timer	(m_stats, 74);
+	return m_vk.beginCommandBuffer(commandBuffer, pBeginInfo);
+}
+
+VkResult DeviceCallStatsWrapper::endCommandBuffer (VkCommandBuffer commandBuffer) const
+{
+	const CallTimer	timer	(m_stats, 75);
+	return m_vk.endCommandBuffer(commandBuffer);
+}
+
+VkResult DeviceCallStatsWrapper::resetCommandBuffer (VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags) const
+{
+	const CallTimer	timer	(m_stats, 76);
+	return m_vk.resetCommandBuffer(commandBuffer, flags);
+}
+
+void DeviceCallStatsWrapper::cmdBindPipeline (VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline) const
+{
+	const CallTimer	timer	(m_stats, 77);
+	m_vk.cmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
+}
+
+void DeviceCallStatsWrapper::cmdSetViewport (VkCommandBuffer commandBuffer, deUint32 firstViewport, deUint32 viewportCount, const VkViewport* pViewports) const
+{
+	const CallTimer	timer	(m_stats, 78);
+	m_vk.cmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
+}
+
+void DeviceCallStatsWrapper::cmdSetScissor (VkCommandBuffer commandBuffer, deUint32 firstScissor, deUint32 scissorCount, const VkRect2D* pScissors) const
+{
+	const CallTimer	timer	(m_stats, 79);
+	m_vk.cmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
+}
+
+void DeviceCallStatsWrapper::cmdSetLineWidth (VkCommandBuffer commandBuffer, float lineWidth) const
+{
+	const CallTimer	timer	(m_stats, 80);
+	m_vk.cmdSetLineWidth(commandBuffer, lineWidth);
+}
+
+void DeviceCallStatsWrapper::cmdSetDepthBias (VkCommandBuffer commandBuffer, float depthBiasConstantFactor, float depthBiasClamp, float depthBiasSlopeFactor) const
+{
+	const CallTimer	timer	(m_stats, 81);
+	m_vk.cmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
+}
+
+void DeviceCallStatsWrapper::cmdSetBlendConstants (VkCommandBuffer commandBuffer, const float blendConstants[4]) const
+{
+	const CallTimer	timer	(m_stats, 82);
+	m_vk.cmdSetBlendConstants(commandBuffer, blendConstants);
+}
+
+void DeviceCallStatsWrapper::cmdSetDepthBounds (VkCommandBuffer commandBuffer, float minDepthBounds, float maxDepthBounds) const
+{
+	const CallTimer	timer	(m_stats, 83);
+	m_vk.cmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds);
+}
+
+void DeviceCallStatsWrapper::cmdSetStencilCompareMask (VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, deUint32 compareMask) const
+{
+	const CallTimer	timer	(m_stats, 84);
+	m_vk.cmdSetStencilCompareMask(commandBuffer, faceMask, compareMask);
+}
+
+void DeviceCallStatsWrapper::cmdSetStencilWriteMask (VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, deUint32 writeMask) const
+{
+	const CallTimer	timer	(m_stats, 85);
+	m_vk.cmdSetStencilWriteMask(commandBuffer, faceMask, writeMask);
+}
+
+void DeviceCallStatsWrapper::cmdSetStencilReference (VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, deUint32 reference) const
+{
+	const CallTimer	timer	(m_stats, 86);
+	m_vk.cmdSetStencilReference(commandBuffer, faceMask, reference);
+}
+
+void DeviceCallStatsWrapper::cmdBindDescriptorSets (VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, deUint32 firstSet, deUint32 descriptorSetCount, const VkDescriptorSet* pDescriptorSets, deUint32 dynamicOffsetCount, const deUint32* pDynamicOffsets) const
+{
+	const CallTimer	timer	(m_stats, 87);
+	m_vk.cmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
+}
+
+void DeviceCallStatsWrapper::cmdBindIndexBuffer (VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkIndexType indexType) const
+{
+	const CallTimer	timer	(m_stats, 88);
+	m_vk.cmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
+}
+
+void DeviceCallStatsWrapper::cmdBindVertexBuffers (VkCommandBuffer commandBuffer, deUint32 firstBinding, deUint32 bindingCount, const VkBuffer* pBuffers, const VkDeviceSize* pOffsets) const
+{
+	const CallTimer	timer	(m_stats, 89);
+	m_vk.cmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
+}
+
+void DeviceCallStatsWrapper::cmdDraw (VkCommandBuffer commandBuffer, deUint32 vertexCount, deUint32 instanceCount, deUint32 firstVertex, deUint32 firstInstance) const
+{
+	const CallTimer	timer	(m_stats, 90);
+	m_vk.cmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
+}
+
+void DeviceCallStatsWrapper::cmdDrawIndexed (VkCommandBuffer commandBuffer, deUint32 indexCount, deUint32 instanceCount, deUint32 firstIndex, deInt32 vertexOffset, deUint32 firstInstance) const
+{
+	const CallTimer	timer	(m_stats, 91);
+	m_vk.cmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
+}
+
+void DeviceCallStatsWrapper::cmdDrawIndirect (VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, deUint32 drawCount, deUint32 stride) const
+{
+	const CallTimer	timer	(m_stats, 92);
+	m_vk.cmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
+}
+
+void DeviceCallStatsWrapper::cmdDrawIndexedIndirect (VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, deUint32 drawCount, deUint32 stride) const
+{
+	const CallTimer	timer	(m_stats, 93);
+	m_vk.cmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
+}
+
+void DeviceCallStatsWrapper::cmdDispatch (VkCommandBuffer commandBuffer, deUint32 x, deUint32 y, deUint32 z) const
+{
+	const CallTimer	timer	(m_stats, 94);
+	m_vk.cmdDispatch(commandBuffer, x, y, z);
+}
+
+void DeviceCallStatsWrapper::cmdDispatchIndirect (VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset) const
+{
+	const CallTimer	timer	(m_stats, 95);
+	m_vk.cmdDispatchIndirect(commandBuffer, buffer, offset);
+}
+
+void DeviceCallStatsWrapper::cmdCopyBuffer (VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, deUint32 regionCount, const VkBufferCopy* pRegions) const
+{
+	const CallTimer	timer	(m_stats, 96);
+	m_vk.cmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
+}
+
+void DeviceCallStatsWrapper::cmdCopyImage (VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, deUint32 regionCount, const VkImageCopy* pRegions) const
+{
+	const CallTimer	timer	(m_stats, 97);
+	m_vk.cmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+}
+
+void DeviceCallStatsWrapper::cmdBlitImage (VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, deUint32 regionCount, const VkImageBlit* pRegions, VkFilter filter) const
+{
+	const CallTimer	timer	(m_stats, 98);
+	m_vk.cmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
+}
+
+void DeviceCallStatsWrapper::cmdCopyBufferToImage (VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkImage dstImage, VkImageLayout dstImageLayout, deUint32 regionCount, const VkBufferImageCopy* pRegions) const
+{
+	const CallTimer	timer	(m_stats, 99);
+	m_vk.cmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
+}
+
+void DeviceCallStatsWrapper::cmdCopyImageToBuffer (VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkBuffer dstBuffer, deUint32 regionCount, const VkBufferImageCopy* pRegions) const
+{
+	const CallTimer	timer	(m_stats, 100);
+	m_vk.cmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
+}
+
+void DeviceCallStatsWrapper::cmdUpdateBuffer (VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize dataSize, const deUint32* pData) const
+{
+	const CallTimer	timer	(m_stats, 101);
+	m_vk.cmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
+}
+
+void DeviceCallStatsWrapper::cmdFillBuffer (VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize size, deUint32 data) const
+{
+	const CallTimer	timer	(m_stats, 102);
+	m_vk.cmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
+}
+
+void DeviceCallStatsWrapper::cmdClearColorImage (VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const VkClearColorValue* pColor, deUint32 rangeCount, const VkImageSubresourceRange* pRanges) const
+{
+	const CallTimer	timer	(m_stats, 103);
+	m_vk.cmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
+}
+
+void DeviceCallStatsWrapper::cmdClearDepthStencilImage (VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const VkClearDepthStencilValue* pDepthStencil, deUint32 rangeCount, const VkImageSubresourceRange* pRanges) const
+{
+	const CallTimer	timer	(m_stats, 104);
+	m_vk.cmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
+}
+
+void DeviceCallStatsWrapper::cmdClearAttachments (VkCommandBuffer commandBuffer, deUint32 attachmentCount, const VkClearAttachment* pAttachments, deUint32 rectCount, const VkClearRect* pRects) const
+{
+	const CallTimer	timer	(m_stats, 105);
+	m_vk.cmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
+}
+
+void DeviceCallStatsWrapper::cmdResolveImage (VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, deUint32 regionCount, const VkImageResolve* pRegions) const
+{
+	const CallTimer	timer	(m_stats, 106);
+	m_vk.cmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+}
+
+void DeviceCallStatsWrapper::cmdSetEvent (VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) const
+{
+	const CallTimer	timer	(m_stats, 107);
+	m_vk.cmdSetEvent(commandBuffer, event, stageMask);
+}
+
+void DeviceCallStatsWrapper::cmdResetEvent (VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) const
+{
+	const CallTimer	timer	(m_stats, 108);
+	m_vk.cmdResetEvent(commandBuffer, event, stageMask);
+}
+
+void DeviceCallStatsWrapper::cmdWaitEvents (VkCommandBuffer commandBuffer, deUint32 eventCount, const VkEvent* pEvents, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, deUint32 memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers, deUint32 bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers, deUint32 imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers) const
+{
+	const CallTimer	timer	(m_stats, 109);
+	m_vk.cmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+}
+
+void DeviceCallStatsWrapper::cmdPipelineBarrier (VkCommandBuffer commandBuffer, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, VkDependencyFlags dependencyFlags, deUint32 memoryBarrierCount, const VkMemoryBarrier* pMemoryBarriers, deUint32 bufferMemoryBarrierCount, const VkBufferMemoryBarrier* pBufferMemoryBarriers, deUint32 imageMemoryBarrierCount, const VkImageMemoryBarrier* pImageMemoryBarriers) const
+{
+	const CallTimer	timer	(m_stats, 110);
+	m_vk.cmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+}
+
+void DeviceCallStatsWrapper::cmdBeginQuery (VkCommandBuffer commandBuffer, VkQueryPool queryPool, deUint32 query, VkQueryControlFlags flags) const
+{
+	const CallTimer	timer	(m_stats, 111);
+	m_vk.cmdBeginQuery(commandBuffer, queryPool, query, flags);
+}
+
+void DeviceCallStatsWrapper::cmdEndQuery (VkCommandBuffer commandBuffer, VkQueryPool queryPool, deUint32 query) const
+{
+	const CallTimer	timer	(m_stats, 112);
+	m_vk.cmdEndQuery(commandBuffer, queryPool, query);
+}
+
+void DeviceCallStatsWrapper::cmdResetQueryPool (VkCommandBuffer commandBuffer, VkQueryPool queryPool, deUint32 firstQuery, deUint32 queryCount) const
+{
+	const CallTimer	timer	(m_stats, 113);
+	m_vk.cmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
+}
+
+void DeviceCallStatsWrapper::cmdWriteTimestamp (VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage, VkQueryPool queryPool, deUint32 query) const
+{
+	const CallTimer	timer	(m_stats, 114);
+	m_vk.cmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
+}
+
+void DeviceCallStatsWrapper::cmdCopyQueryPoolResults (VkCommandBuffer commandBuffer, VkQueryPool queryPool, deUint32 firstQuery, deUint32 queryCount, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize stride, VkQueryResultFlags flags) const
+{
+	const CallTimer	timer	(m_stats, 115);
+	m_vk.cmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
+}
+
+void DeviceCallStatsWrapper::cmdPushConstants (VkCommandBuffer commandBuffer, VkPipelineLayout layout, VkShaderStageFlags stageFlags, deUint32 offset, deUint32 size, const void* pValues) const
+{
+	const CallTimer	timer	(m_stats, 116);
+	m_vk.cmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
+}
+
+void DeviceCallStatsWrapper::cmdBeginRenderPass (VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin, VkSubpassContents contents) const
+{
+	const CallTimer	timer	(m_stats, 117);
+	m_vk.cmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
+}
+
+void DeviceCallStatsWrapper::cmdNextSubpass (VkCommandBuffer commandBuffer, VkSubpassContents contents) const
+{
+	const CallTimer	timer	(m_stats, 118);
+	m_vk.cmdNextSubpass(commandBuffer, contents);
+}
+
+void DeviceCallStatsWrapper::cmdEndRenderPass (VkCommandBuffer commandBuffer) const
+{
+	const CallTimer	timer	(m_stats, 119);
+	m_vk.cmdEndRenderPass(commandBuffer);
+}
+
+void DeviceCallStatsWrapper::cmdExecuteCommands (VkCommandBuffer commandBuffer, deUint32 commandBufferCount, const VkCommandBuffer* pCommandBuffers) const
+{
+	const CallTimer	timer	(m_stats, 120);
+	m_vk.cmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
+}
@@ -32,6 +32,7 @@
 #include "deArrayUtil.hpp"
 #include "deMemory.h"
 #include "deClock.h"
+#include "deStringUtil.hpp"
 #include "qpDebugOut.h"
 
 #if defined(DEQP_HAVE_GLSLANG)
@@ -56,6 +57,12 @@ using std::vector;
 
 #if defined(DEQP_HAVE_GLSLANG)
 
+enum
+{
+	//! \note Bump whenever built-in resources, compile options or glslang revision in external/fetch_sources.py change.
+	GLSL_TO_SPIRV_OPTIONS_VERSION	= 1
+};
+
 namespace
 {
 
@@ -74,7 +81,10 @@ EShLanguage getGlslangStage (glu::ShaderType type)
 }
 
 static volatile deSingletonState	s_glslangInitState	= DE_SINGLETON_STATE_NOT_INITIALIZED;
+
+#if !defined(DEQP_GLSLANG_CONCURRENT_COMPILE)
 static de::Mutex					s_glslangLock;
+#endif
 
 void initGlslang (void*)
 {
@@ -215,7 +225,11 @@ void glslToSpirV (const glu::ProgramSources& program, std::vector<deUint8>* dst,
 	{
 		if (!program.sources[shaderType].empty())
 		{
+#if !defined(DEQP_GLSLANG_CONCURRENT_COMPILE)
+			// \note Thread safety of glslang is only trusted for revisions that
+			//		 have been verified, see DEQP_GLSLANG_CONCURRENT_COMPILE.
 			const de::ScopedLock	compileLock			(s_glslangLock);
+#endif
 			const std::string&		srcText				= program.sources[shaderType][0];
 			const char*				srcPtrs[]			= { srcText.c_str() };
 			const int				srcLengths[]		= { (int)srcText.size() };
@@ -275,6 +289,11 @@ void glslToSpirV (const glu::ProgramSources& program, std::vector<deUint8>* dst,
 	TCU_THROW(InternalError, "Can't compile empty program");
 }
 
+std::string getGlslToSpirVCompilerId (void)
+{
+	return string("glslang (") + glslang::GetGlslVersionString() + ", " + glslang::GetEsslVersionString() + ") options " + de::toString((int)GLSL_TO_SPIRV_OPTIONS_VERSION);
+}
+
 void disassembleSpirV (size_t binarySize, const deUint8* binary, std::ostream* dst)
 {
 	std::vector<deUint32>	binForDisasm	(binarySize/4);
@@ -297,6 +316,11 @@ void glslToSpirV (const glu::ProgramSources&, std::vector<deUint8>*, glu::Shader
 	TCU_THROW(NotSupportedError, "GLSL to SPIR-V compilation not supported (DEQP_HAVE_GLSLANG not defined)");
 }
 
+std::string getGlslToSpirVCompilerId (void)
+{
+	return "none";
+}
+
 void disassembleSpirV (size_t, const deUint8*, std::ostream*)
 {
 	TCU_THROW(NotSupportedError, "SPIR-V disassembling not supported (DEQP_HAVE_GLSLANG not defined)");
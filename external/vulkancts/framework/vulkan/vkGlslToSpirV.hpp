@@ -35,13 +35,18 @@
 #include "gluShaderProgram.hpp"
 
 #include <ostream>
+#include <string>
 
 namespace vk
 {
 
 //! Compile GLSL program to SPIR-V. Will fail with NotSupportedError if compiler is not available.
+//! \note Calls are serialized unless built with DEQP_GLSLANG_CONCURRENT_COMPILE.
 void	glslToSpirV			(const glu::ProgramSources& src, std::vector<deUint8>* dst, glu::ShaderProgramInfo* buildInfo);
 
+//! Get identifier of compiler and compile options used by glslToSpirV(). Identifier changes whenever output may change.
+std::string	getGlslToSpirVCompilerId	(void);
+
 //! Disassemble SPIR-V binary
 void	disassembleSpirV	(size_t binarySize, const deUint8* binary, std::ostream* dst);
 
@@ -0,0 +1,91 @@
+/* WARNING: This is auto-generated file. Do not modify, since changes will
+ * be lost! Modify the generating script instead.
+ */
+
+static const char* const s_instanceFunctionNames[] =
+{
+	"vkDestroyInstance",
+	"vkEnumeratePhysicalDevices",
+	"vkGetPhysicalDeviceFeatures",
+	"vkGetPhysicalDeviceFormatProperties",
+	"vkGetPhysicalDeviceImageFormatProperties",
+	"vkGetPhysicalDeviceProperties",
+	"vkGetPhysicalDeviceQueueFamilyProperties",
+	"vkGetPhysicalDeviceMemoryProperties",
+	"vkGetDeviceProcAddr",
+	"vkCreateDevice",
+	"vkEnumerateDeviceExtensionProperties",
+	"vkEnumerateDeviceLayerProperties",
+};
+
+void InstanceCallStatsWrapper::destroyInstance (VkInstance instance, const VkAllocationCallbacks* pAllocator) const
+{
+	const CallTimer	timer	(m_stats, 0);
+	m_vk.destroyInstance(instance, pAllocator);
+}
+
+VkResult InstanceCallStatsWrapper::enumeratePhysicalDevices (VkInstance instance, deUint32* pPhysicalDeviceCount, VkPhysicalDevice* pPhysicalDevices) const
+{
+	const CallTimer	timer	(m_stats, 1);
+	return m_vk.enumeratePhysicalDevices(instance, pPhysicalDeviceCount, pPhysicalDevices);
+}
+
+void InstanceCallStatsWrapper::getPhysicalDeviceFeatures (VkPhysicalDevice physicalDevice, VkPhysicalDeviceFeatures* pFeatures) const
+{
+	const CallTimer	timer	(m_stats, 2);
+	m_vk.getPhysicalDeviceFeatures(physicalDevice, pFeatures);
+}
+
+void InstanceCallStatsWrapper::getPhysicalDeviceFormatProperties (VkPhysicalDevice physicalDevice, VkFormat format, VkFormatProperties* pFormatProperties) const
+{
+	const CallTimer	timer	(m_stats, 3);
+	m_vk.getPhysicalDeviceFormatProperties(physicalDevice, format, pFormatProperties);
+}
+
+VkResult InstanceCallStatsWrapper::getPhysicalDeviceImageFormatProperties (VkPhysicalDevice physicalDevice, VkFormat format, VkImageType type, VkImageTiling tiling, VkImageUsageFlags usage, VkImageCreateFlags flags, VkImageFormatProperties* pImageFormatProperties) const
+{
+	const CallTimer	timer	(m_stats, 4);
+	return m_vk.getPhysicalDeviceImageFormatProperties(physicalDevice, format, type, tiling, usage, flags, pImageFormatProperties);
+}
+
+void InstanceCallStatsWrapper::getPhysicalDeviceProperties (VkPhysicalDevice physicalDevice, VkPhysicalDeviceProperties* pProperties) const
+{
+	const CallTimer	timer	(m_stats, 5);
+	m_vk.getPhysicalDeviceProperties(physicalDevice, pProperties);
+}
+
+void InstanceCallStatsWrapper::getPhysicalDeviceQueueFamilyProperties (VkPhysicalDevice physicalDevice, deUint32* pQueueFamilyPropertyCount, VkQueueFamilyProperties* pQueueFamilyProperties) const
+{
+	const CallTimer	timer	(m_stats, 6);
+	m_vk.getPhysicalDeviceQueueFamilyProperties(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
+}
+
+void InstanceCallStatsWrapper::getPhysicalDeviceMemoryProperties (VkPhysicalDevice physicalDevice, VkPhysicalDeviceMemoryProperties* pMemoryProperties) const
+{
+	const CallTimer	timer	(m_stats, 7);
+	m_vk.getPhysicalDeviceMemoryProperties(physicalDevice, pMemoryProperties);
+}
+
+PFN_vkVoidFunction InstanceCallStatsWrapper::getDeviceProcAddr (VkDevice device, const char* pName) const
+{
+	const CallTimer	timer	(m_stats, 8);
+	return m_vk.getDeviceProcAddr(device, pName);
+}
+
+VkResult InstanceCallStatsWrapper::createDevice (VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator, VkDevice* pDevice) const
+{
+	const CallTimer	timer	(m_stats, 9);
+	return m_vk.createDevice(physicalDevice, pCreateInfo, pAllocator, pDevice);
+}
+
+VkResult InstanceCallStatsWrapper::enumerateDeviceExtensionProperties (VkPhysicalDevice physicalDevice, const char* pLayerName, deUint32* pPropertyCount, VkExtensionProperties* pProperties) const
+{
+	const CallTimer	timer	(m_stats, 10);
+	return m_vk.enumerateDeviceExtensionProperties(physicalDevice, pLayerName, pPropertyCount, pProperties);
+}
+
+VkResult InstanceCallStatsWrapper::enumerateDeviceLayerProperties (VkPhysicalDevice physicalDevice, deUint32* pPropertyCount, VkLayerProperties* pProperties) const
+{
+	const CallTimer	timer	(m_stats, 11);
+	return m_vk.enumerateDeviceLayerProperties(physicalDevice, pPropertyCount, pProperties);
+}
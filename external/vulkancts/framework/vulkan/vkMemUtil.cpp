@@ -36,6 +36,9 @@
 #include "deInt32.h"
 
 #include <sstream>
+#include <set>
+#include <map>
+#include <algorithm>
 
 namespace vk
 {
@@ -217,6 +220,500 @@ MovePtr<Allocation> SimpleAllocator::allocate (const VkMemoryRequirements& memRe
 	return MovePtr<Allocation>(new SimpleAllocation(mem, hostPtr));
 }
 
+// PoolAllocator
+
+namespace
+{
+
+enum
+{
+	POOL_MIN_NODE_SIZE	= 256	//!< Smallest sub-allocation size
+};
+
+VkDeviceSize roundUpToPowerOfTwo (VkDeviceSize value)
+{
+	VkDeviceSize result = 1;
+
+	while (result < value)
+		result <<= 1;
+
+	return result;
+}
+
+Move<VkDeviceMemory> allocateMemoryBlock (const DeviceInterface& vkd, VkDevice device, deUint32 memoryTypeNdx, VkDeviceSize size)
+{
+	const VkMemoryAllocateInfo	allocInfo	=
+	{
+		VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,	//	VkStructureType			sType;
+		DE_NULL,								//	const void*				pNext;
+		size,									//	VkDeviceSize			allocationSize;
+		memoryTypeNdx,							//	deUint32				memoryTypeIndex;
+	};
+
+	return allocateMemory(vkd, device, &allocInfo);
+}
+
+} // anonymous
+
+//! Buddy allocator managing a single VkDeviceMemory block
+class PoolAllocator::MemoryBlock
+{
+public:
+											MemoryBlock			(const DeviceInterface& vkd, VkDevice device, deUint32 memoryTypeNdx, VkDeviceSize size, VkDeviceSize minNodeSize, bool isHostVisible);
+
+	bool									allocate			(VkDeviceSize size, VkDeviceSize alignment, VkDeviceSize* offset);
+	void									free				(VkDeviceSize offset);
+
+	VkDeviceMemory							getMemory			(void) const { return *m_memory;									}
+	void*									getHostPtr			(VkDeviceSize offset) const;
+	VkDeviceSize							getSize				(void) const { return m_size;										}
+	VkDeviceSize							getUsedBytes		(void) const { return m_usedBytes;									}
+	VkDeviceSize							getLargestFreeRange	(void) const;
+	deUint32								getNumAllocations	(void) const { return (deUint32)m_allocatedNodes.size();			}
+	bool									isEmpty				(void) const { return m_allocatedNodes.empty();						}
+
+private:
+	VkDeviceSize							getNodeSize			(int order) const { return m_minNodeSize << order;					}
+
+	static int								getNumOrders		(VkDeviceSize size, VkDeviceSize minNodeSize);
+
+	const Unique<VkDeviceMemory>			m_memory;
+	const UniquePtr<HostPtr>				m_hostPtr;
+	const VkDeviceSize						m_size;
+	const VkDeviceSize						m_minNodeSize;
+	const int								m_numOrders;
+
+	std::vector<std::set<VkDeviceSize> >	m_freeNodes;		//!< Offsets of free nodes, indexed by order
+	std::map<VkDeviceSize, int>				m_allocatedNodes;	//!< Orders of allocated nodes, indexed by offset
+	VkDeviceSize							m_usedBytes;
+};
+
+PoolAllocator::MemoryBlock::MemoryBlock (const DeviceInterface& vkd, VkDevice device, deUint32 memoryTypeNdx, VkDeviceSize size, VkDeviceSize minNodeSize, bool isHostVisible)
+	: m_memory		(allocateMemoryBlock(vkd, device, memoryTypeNdx, size))
+	, m_hostPtr		(isHostVisible ? new HostPtr(vkd, device, *m_memory, 0u, size, 0u) : DE_NULL)
+	, m_size		(size)
+	, m_minNodeSize	(minNodeSize)
+	, m_numOrders	(getNumOrders(size, minNodeSize))
+	, m_freeNodes	(m_numOrders)
+	, m_usedBytes	(0u)
+{
+	DE_ASSERT(deIsPowerOfTwo64(size) && deIsPowerOfTwo64(minNodeSize));
+
+	// Whole block is initially a single free node
+	m_freeNodes[m_numOrders-1].insert(0u);
+}
+
+int PoolAllocator::MemoryBlock::getNumOrders (VkDeviceSize size, VkDeviceSize minNodeSize)
+{
+	int numOrders = 1;
+
+	while ((minNodeSize << (numOrders-1)) < size)
+		numOrders++;
+
+	return numOrders;
+}
+
+void* PoolAllocator::MemoryBlock::getHostPtr (VkDeviceSize offset) const
+{
+	return m_hostPtr ? (deUint8*)m_hostPtr->get() + offset : DE_NULL;
+}
+
+VkDeviceSize PoolAllocator::MemoryBlock::getLargestFreeRange (void) const
+{
+	for (int order = m_numOrders-1; order >= 0; order--)
+	{
+		if (!m_freeNodes[order].empty())
+			return getNodeSize(order);
+	}
+
+	return 0u;
+}
+
+bool PoolAllocator::MemoryBlock::allocate (VkDeviceSize size, VkDeviceSize alignment, VkDeviceSize* offset)
+{
+	// Nodes are aligned to their size, so requesting a node at least as large as alignment is enough.
+	const VkDeviceSize	minSize		= de::max(de::max(size, alignment), m_minNodeSize);
+	int					order		= 0;
+	int					freeOrder;
+
+	while (getNodeSize(order) < minSize)
+	{
+		if (++order >= m_numOrders)
+			return false;
+	}
+
+	for (freeOrder = order; freeOrder < m_numOrders; freeOrder++)
+	{
+		if (!m_freeNodes[freeOrder].empty())
+			break;
+	}
+
+	if (freeOrder == m_numOrders)
+		return false;
+
+	{
+		const VkDeviceSize nodeOffset = *m_freeNodes[freeOrder].begin();
+
+		m_freeNodes[freeOrder].erase(m_freeNodes[freeOrder].begin());
+
+		// Split until node is of requested order, freeing upper halves
+		while (freeOrder > order)
+		{
+			freeOrder--;
+			m_freeNodes[freeOrder].insert(nodeOffset + getNodeSize(freeOrder));
+		}
+
+		m_allocatedNodes[nodeOffset]	 = order;
+		m_usedBytes						+= getNodeSize(order);
+		*offset							 = nodeOffset;
+	}
+
+	return true;
+}
+
+void PoolAllocator::MemoryBlock::free (VkDeviceSize offset)
+{
+	const std::map<VkDeviceSize, int>::iterator	allocatedNode	= m_allocatedNodes.find(offset);
+	VkDeviceSize								nodeOffset		= offset;
+	int											order;
+
+	DE_ASSERT(allocatedNode != m_allocatedNodes.end());
+
+	order = allocatedNode->second;
+	m_allocatedNodes.erase(allocatedNode);
+	m_usedBytes -= getNodeSize(order);
+
+	// Merge with free buddies
+	while (order < m_numOrders-1)
+	{
+		const VkDeviceSize							buddyOffset	= nodeOffset ^ getNodeSize(order);
+		const std::set<VkDeviceSize>::iterator		buddy		= m_freeNodes[order].find(buddyOffset);
+
+		if (buddy == m_freeNodes[order].end())
+			break;
+
+		m_freeNodes[order].erase(buddy);
+		nodeOffset = de::min(nodeOffset, buddyOffset);
+		order++;
+	}
+
+	m_freeNodes[order].insert(nodeOffset);
+}
+
+//! Blocks of a single memory type
+class PoolAllocator::MemoryTypePool
+{
+public:
+									MemoryTypePool		(const DeviceInterface& vkd, VkDevice device, deUint32 memoryTypeNdx, VkDeviceSize blockSize, VkDeviceSize minNodeSize, bool isHostVisible);
+									~MemoryTypePool		(void);
+
+	//! Sub-allocate, or return DE_NULL if allocation doesn't fit in a block
+	MemoryBlock*					allocate			(VkDeviceSize size, VkDeviceSize alignment, VkDeviceSize* offset);
+	void							free				(MemoryBlock* block, VkDeviceSize offset, VkDeviceSize size);
+
+	void							addStats			(Stats* stats) const;
+
+private:
+									MemoryTypePool		(const MemoryTypePool&);
+	MemoryTypePool&					operator=			(const MemoryTypePool&);
+
+	const DeviceInterface&			m_vkd;
+	const VkDevice					m_device;
+	const deUint32					m_memoryTypeNdx;
+	const VkDeviceSize				m_blockSize;
+	const VkDeviceSize				m_minNodeSize;
+	const bool						m_isHostVisible;
+
+	std::vector<MemoryBlock*>		m_blocks;
+	VkDeviceSize					m_requestedBytes;
+};
+
+PoolAllocator::MemoryTypePool::MemoryTypePool (const DeviceInterface& vkd, VkDevice device, deUint32 memoryTypeNdx, VkDeviceSize blockSize, VkDeviceSize minNodeSize, bool isHostVisible)
+	: m_vkd				(vkd)
+	, m_device			(device)
+	, m_memoryTypeNdx	(memoryTypeNdx)
+	, m_blockSize		(blockSize)
+	, m_minNodeSize		(minNodeSize)
+	, m_isHostVisible	(isHostVisible)
+	, m_requestedBytes	(0u)
+{
+}
+
+PoolAllocator::MemoryTypePool::~MemoryTypePool (void)
+{
+	for (size_t blockNdx = 0; blockNdx < m_blocks.size(); blockNdx++)
+	{
+		DE_ASSERT(m_blocks[blockNdx]->isEmpty());
+		delete m_blocks[blockNdx];
+	}
+}
+
+PoolAllocator::MemoryBlock* PoolAllocator::MemoryTypePool::allocate (VkDeviceSize size, VkDeviceSize alignment, VkDeviceSize* offset)
+{
+	if (size > m_blockSize || alignment > m_blockSize)
+		return DE_NULL;
+
+	for (size_t blockNdx = 0; blockNdx < m_blocks.size(); blockNdx++)
+	{
+		if (m_blocks[blockNdx]->allocate(size, alignment, offset))
+		{
+			m_requestedBytes += size;
+			return m_blocks[blockNdx];
+		}
+	}
+
+	{
+		MovePtr<MemoryBlock>	newBlock;
+
+		try
+		{
+			newBlock = MovePtr<MemoryBlock>(new MemoryBlock(m_vkd, m_device, m_memoryTypeNdx, m_blockSize, m_minNodeSize, m_isHostVisible));
+		}
+		catch (const OutOfMemoryError&)
+		{
+			// Let caller try allocating exact size instead
+			return DE_NULL;
+		}
+
+		m_blocks.push_back(newBlock.get());
+
+		{
+			MemoryBlock* const	block	= newBlock.release();
+			const bool			isOk	= block->allocate(size, alignment, offset);
+
+			DE_ASSERT(isOk);
+			DE_UNREF(isOk);
+
+			m_requestedBytes += size;
+			return block;
+		}
+	}
+}
+
+void PoolAllocator::MemoryTypePool::free (MemoryBlock* block, VkDeviceSize offset, VkDeviceSize size)
+{
+	block->free(offset);
+	m_requestedBytes -= size;
+
+	// Keep one empty block around to avoid re-allocating memory when allocations come and go
+	if (block->isEmpty() && m_blocks.size() > 1)
+	{
+		const std::vector<MemoryBlock*>::iterator	pos		= std::find(m_blocks.begin(), m_blocks.end(), block);
+
+		DE_ASSERT(pos != m_blocks.end());
+
+		m_blocks.erase(pos);
+		delete block;
+	}
+}
+
+void PoolAllocator::MemoryTypePool::addStats (Stats* stats) const
+{
+	for (size_t blockNdx = 0; blockNdx < m_blocks.size(); blockNdx++)
+	{
+		const MemoryBlock&	block	= *m_blocks[blockNdx];
+
+		stats->numBlocks			+= 1u;
+		stats->numSubAllocations	+= block.getNumAllocations();
+		stats->blockBytes			+= block.getSize();
+		stats->usedBytes			+= block.getUsedBytes();
+		stats->largestFreeRange		 = de::max(stats->largestFreeRange, block.getLargestFreeRange());
+	}
+
+	stats->requestedBytes += m_requestedBytes;
+}
+
+class PoolAllocator::PooledAllocation : public Allocation
+{
+public:
+									PooledAllocation	(MemoryTypePool& pool, MemoryBlock& block, VkDeviceSize offset, VkDeviceSize size);
+	virtual							~PooledAllocation	(void);
+
+private:
+	MemoryTypePool&					m_pool;
+	MemoryBlock&					m_block;
+	const VkDeviceSize				m_size;
+};
+
+PoolAllocator::PooledAllocation::PooledAllocation (MemoryTypePool& pool, MemoryBlock& block, VkDeviceSize offset, VkDeviceSize size)
+	: Allocation	(block.getMemory(), offset, block.getHostPtr(offset))
+	, m_pool		(pool)
+	, m_block		(block)
+	, m_size		(size)
+{
+}
+
+PoolAllocator::PooledAllocation::~PooledAllocation (void)
+{
+	m_pool.free(&m_block, getOffset(), m_size);
+}
+
+class PoolAllocator::DedicatedAllocation : public SimpleAllocation
+{
+public:
+									DedicatedAllocation		(Move<VkDeviceMemory> mem, MovePtr<HostPtr> hostPtr, deUint32* numAllocations);
+	virtual							~DedicatedAllocation	(void);
+
+private:
+	deUint32* const					m_numAllocations;
+};
+
+PoolAllocator::DedicatedAllocation::DedicatedAllocation (Move<VkDeviceMemory> mem, MovePtr<HostPtr> hostPtr, deUint32* numAllocations)
+	: SimpleAllocation	(mem, hostPtr)
+	, m_numAllocations	(numAllocations)
+{
+	*m_numAllocations += 1u;
+}
+
+PoolAllocator::DedicatedAllocation::~DedicatedAllocation (void)
+{
+	*m_numAllocations -= 1u;
+}
+
+PoolAllocator::Stats::Stats (void)
+	: numBlocks					(0u)
+	, numSubAllocations			(0u)
+	, numDedicatedAllocations	(0u)
+	, blockBytes				(0u)
+	, usedBytes					(0u)
+	, requestedBytes			(0u)
+	, largestFreeRange			(0u)
+{
+}
+
+PoolAllocator::PoolAllocator (const DeviceInterface&					vk,
+							  VkDevice									device,
+							  const VkPhysicalDeviceMemoryProperties&	deviceMemProps,
+							  const VkPhysicalDeviceLimits&				deviceLimits,
+							  VkDeviceSize								blockSize)
+	: m_vk						(vk)
+	, m_device					(device)
+	, m_memProps				(deviceMemProps)
+	, m_pools					(deviceMemProps.memoryTypeCount, (MemoryTypePool*)DE_NULL)
+	, m_numDedicatedAllocations	(0u)
+{
+	DE_ASSERT(deIsPowerOfTwo64(blockSize));
+
+	try
+	{
+		for (deUint32 memoryTypeNdx = 0; memoryTypeNdx < deviceMemProps.memoryTypeCount; memoryTypeNdx++)
+		{
+			const VkMemoryPropertyFlags	propertyFlags	= deviceMemProps.memoryTypes[memoryTypeNdx].propertyFlags;
+			const VkDeviceSize			heapSize		= deviceMemProps.memoryHeaps[deviceMemProps.memoryTypes[memoryTypeNdx].heapIndex].size;
+			const bool					isHostVisible	= (propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) != 0u;
+			const bool					isNonCoherent	= isHostVisible && (propertyFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) == 0u;
+			VkDeviceSize				minNodeSize		= (VkDeviceSize)POOL_MIN_NODE_SIZE;
+			VkDeviceSize				typeBlockSize	= blockSize;
+
+			// Lazily allocated memory is pointless to pool, as pooled blocks are always fully committed
+			if ((propertyFlags & VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT) != 0u)
+				continue;
+
+			// Separate sub-allocations so that linear and non-linear resources and non-coherent flushes never overlap
+			minNodeSize = de::max(minNodeSize, deviceLimits.bufferImageGranularity);
+
+			if (isNonCoherent)
+				minNodeSize = de::max(minNodeSize, deviceLimits.nonCoherentAtomSize);
+
+			minNodeSize = roundUpToPowerOfTwo(minNodeSize);
+
+			// Don't let a single block take over small heaps
+			while (typeBlockSize > heapSize / 4u && typeBlockSize > minNodeSize)
+				typeBlockSize >>= 1u;
+
+			if (typeBlockSize <= minNodeSize)
+				continue;
+
+			m_pools[memoryTypeNdx] = new MemoryTypePool(vk, device, memoryTypeNdx, typeBlockSize, minNodeSize, isHostVisible);
+		}
+	}
+	catch (...)
+	{
+		for (size_t poolNdx = 0; poolNdx < m_pools.size(); poolNdx++)
+			delete m_pools[poolNdx];
+		throw;
+	}
+}
+
+PoolAllocator::~PoolAllocator (void)
+{
+	DE_ASSERT(m_numDedicatedAllocations == 0u);
+
+	for (size_t poolNdx = 0; poolNdx < m_pools.size(); poolNdx++)
+		delete m_pools[poolNdx];
+}
+
+MovePtr<Allocation> PoolAllocator::allocateDedicated (const VkMemoryAllocateInfo& allocInfo)
+{
+	Move<VkDeviceMemory>	mem		= allocateMemory(m_vk, m_device, &allocInfo);
+	MovePtr<HostPtr>		hostPtr;
+
+	if (isHostVisibleMemory(m_memProps, allocInfo.memoryTypeIndex))
+		hostPtr = MovePtr<HostPtr>(new HostPtr(m_vk, m_device, *mem, 0u, allocInfo.allocationSize, 0u));
+
+	return MovePtr<Allocation>(new DedicatedAllocation(mem, hostPtr, &m_numDedicatedAllocations));
+}
+
+MovePtr<Allocation> PoolAllocator::allocate (const VkMemoryAllocateInfo& allocInfo, VkDeviceSize alignment)
+{
+	DE_ASSERT(allocInfo.memoryTypeIndex < m_memProps.memoryTypeCount);
+
+	if (MemoryTypePool* const pool = m_pools[allocInfo.memoryTypeIndex])
+	{
+		VkDeviceSize		offset	= 0u;
+		MemoryBlock* const	block	= pool->allocate(allocInfo.allocationSize, de::max(alignment, (VkDeviceSize)1u), &offset);
+
+		if (block)
+			return MovePtr<Allocation>(new PooledAllocation(*pool, *block, offset, allocInfo.allocationSize));
+	}
+
+	return allocateDedicated(allocInfo);
+}
+
+MovePtr<Allocation> PoolAllocator::allocate (const VkMemoryRequirements& memReqs, MemoryRequirement requirement)
+{
+	const deUint32				memoryTypeNdx	= selectMatchingMemoryType(m_memProps, memReqs.memoryTypeBits, requirement);
+	const VkMemoryAllocateInfo	allocInfo		=
+	{
+		VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,	//	VkStructureType			sType;
+		DE_NULL,								//	const void*				pNext;
+		memReqs.size,							//	VkDeviceSize			allocationSize;
+		memoryTypeNdx,							//	deUint32				memoryTypeIndex;
+	};
+
+	DE_ASSERT(!(requirement & MemoryRequirement::HostVisible) || isHostVisibleMemory(m_memProps, memoryTypeNdx));
+
+	return allocate(allocInfo, memReqs.alignment);
+}
+
+PoolAllocator::Stats PoolAllocator::getStats (void) const
+{
+	Stats stats;
+
+	for (size_t poolNdx = 0; poolNdx < m_pools.size(); poolNdx++)
+	{
+		if (m_pools[poolNdx])
+			m_pools[poolNdx]->addStats(&stats);
+	}
+
+	stats.numDedicatedAllocations = m_numDedicatedAllocations;
+
+	return stats;
+}
+
+std::ostream& operator<< (std::ostream& str, const PoolAllocator::Stats& stats)
+{
+	const VkDeviceSize	freeBytes		= stats.blockBytes - stats.usedBytes;
+	// \note Fragmentation is the portion of free memory not usable for the largest possible allocation
+	const int			fragmentation	= freeBytes > 0u ? (int)(100u - (stats.largestFreeRange * 100u) / freeBytes) : 0;
+
+	return str << stats.numBlocks << " blocks (" << stats.blockBytes << " bytes), "
+			   << stats.numSubAllocations << " sub-allocations using " << stats.usedBytes << " bytes (" << stats.requestedBytes << " requested), "
+			   << stats.numDedicatedAllocations << " dedicated allocations, "
+			   << "largest free range " << stats.largestFreeRange << " bytes, "
+			   << "free memory fragmentation " << fragmentation << "%";
+}
+
 void flushMappedMemoryRange (const DeviceInterface& vkd, VkDevice device, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size)
 {
 	const VkMappedMemoryRange	range	=
@@ -33,6 +33,9 @@
 #include "vkDefs.hpp"
 #include "deUniquePtr.hpp"
 
+#include <vector>
+#include <ostream>
+
 namespace vk
 {
 
@@ -140,6 +143,79 @@ private:
 	const VkPhysicalDeviceMemoryProperties	m_memProps;
 };
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Allocator that sub-allocates from large VkDeviceMemory blocks
+ *
+ * Each memory type has its own pool of blocks, which are managed with a
+ * buddy allocator. Sub-allocations are aligned to their size rounded up to
+ * a power of two, and never share a bufferImageGranularity page (or, in
+ * non-coherent memory, a nonCoherentAtomSize range) with another
+ * allocation. Thus buffers and images can be bound to any allocation and
+ * allocations can be flushed independently.
+ *
+ * Host-visible blocks are mapped once when created and stay mapped until
+ * the block is freed.
+ *
+ * Allocations larger than block size, and allocations from lazily
+ * allocated memory types, get their own VkDeviceMemory like in
+ * SimpleAllocator.
+ *
+ * Allocator is not thread-safe. All allocations must be freed before the
+ * allocator is destroyed.
+ *//*--------------------------------------------------------------------*/
+class PoolAllocator : public Allocator
+{
+public:
+	enum
+	{
+		DEFAULT_BLOCK_SIZE	= 32*1024*1024	//!< Default size of pooled VkDeviceMemory blocks
+	};
+
+	struct Stats
+	{
+		deUint32		numBlocks;					//!< Number of pooled VkDeviceMemory blocks
+		deUint32		numSubAllocations;			//!< Number of live sub-allocations
+		deUint32		numDedicatedAllocations;	//!< Number of live allocations with own VkDeviceMemory
+		VkDeviceSize	blockBytes;					//!< Total size of pooled blocks
+		VkDeviceSize	usedBytes;					//!< Bytes of pooled blocks reserved by sub-allocations, including padding
+		VkDeviceSize	requestedBytes;				//!< Bytes requested by sub-allocations
+		VkDeviceSize	largestFreeRange;			//!< Largest range that can be sub-allocated without a new block
+
+						Stats						(void);
+	};
+
+															PoolAllocator		(const DeviceInterface&						vk,
+																				 VkDevice									device,
+																				 const VkPhysicalDeviceMemoryProperties&	deviceMemProps,
+																				 const VkPhysicalDeviceLimits&				deviceLimits,
+																				 VkDeviceSize								blockSize = (VkDeviceSize)DEFAULT_BLOCK_SIZE);
+															~PoolAllocator		(void);
+
+	de::MovePtr<Allocation>									allocate			(const VkMemoryAllocateInfo& allocInfo, VkDeviceSize alignment);
+	de::MovePtr<Allocation>									allocate			(const VkMemoryRequirements& memRequirements, MemoryRequirement requirement);
+
+	Stats													getStats			(void) const;
+
+private:
+	class MemoryBlock;
+	class MemoryTypePool;
+	class PooledAllocation;
+	class DedicatedAllocation;
+
+															PoolAllocator		(const PoolAllocator&);
+	PoolAllocator&											operator=			(const PoolAllocator&);
+
+	de::MovePtr<Allocation>									allocateDedicated	(const VkMemoryAllocateInfo& allocInfo);
+
+	const DeviceInterface&									m_vk;
+	const VkDevice											m_device;
+	const VkPhysicalDeviceMemoryProperties					m_memProps;
+	std::vector<MemoryTypePool*>							m_pools;			//!< Pool per memory type, or null if memory type is not pooled
+	deUint32												m_numDedicatedAllocations;
+};
+
+std::ostream&	operator<<					(std::ostream& str, const PoolAllocator::Stats& stats);
+
 void	flushMappedMemoryRange		(const DeviceInterface& vkd, VkDevice device, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size);
 void	invalidateMappedMemoryRange	(const DeviceInterface& vkd, VkDevice device, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size);
 
@@ -32,7 +32,15 @@
 #include "vkPlatform.hpp"
 #include "vkImageUtil.hpp"
 #include "tcuFunctionLibrary.hpp"
+#include "tcuTextureUtil.hpp"
+#include "tcuVectorUtil.hpp"
+#include "deUniquePtr.hpp"
+#include "deAtomic.h"
+#include "deThread.h"
+#include "deThreadLocal.h"
 #include "deMemory.h"
+#include "deInt32.h"
+#include "deMath.h"
 
 #include <stdexcept>
 #include <algorithm>
@@ -61,6 +69,281 @@ void freeSystemMem (const VkAllocationCallbacks* pAllocator, void* mem)
 	pAllocator->pfnFree(pAllocator->pUserData, mem);
 }
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Fixed-size object allocator
+ *
+ * Hands out equally sized slots carved from larger slabs. Each thread
+ * keeps a small cache of free slots so that the common allocate / free
+ * path takes no locks; caches are refilled from and flushed to a shared
+ * free list in batches. Slabs are only released when the allocator
+ * itself is destroyed.
+ *//*--------------------------------------------------------------------*/
+class SlabAllocator
+{
+public:
+							SlabAllocator		(size_t objectSize);
+							~SlabAllocator		(void);
+
+	void*					allocate			(void);
+	void					free				(void* ptr);
+
+private:
+							SlabAllocator		(const SlabAllocator&);
+	SlabAllocator&			operator=			(const SlabAllocator&);
+
+	enum
+	{
+		SLOT_ALIGNMENT	= 16,
+		SLAB_SIZE		= 16*1024,
+		BATCH_SIZE		= 32		//!< Number of slots moved between thread cache and shared list at once
+	};
+
+	struct FreeSlot
+	{
+		FreeSlot*			next;
+	};
+
+	struct ThreadCache
+	{
+		FreeSlot*			freeList;
+		deUint32			numFreeSlots;
+	};
+
+	void					lock				(void);
+	void					unlock				(void);
+
+	ThreadCache*			getThreadCache		(void);
+	void					refill				(ThreadCache* cache);
+	void					flush				(ThreadCache* cache, deUint32 numSlots);
+	void					addSlab				(void);
+
+	const size_t			m_slotSize;
+	const size_t			m_slotsPerSlab;
+	const deThreadLocal		m_threadCache;
+
+	volatile deUint32		m_lock;
+	vector<void*>			m_slabs;
+	vector<ThreadCache*>	m_threadCaches;
+	FreeSlot*				m_freeList;			//!< Shared free list
+};
+
+SlabAllocator::SlabAllocator (size_t objectSize)
+	: m_slotSize		(deAlignSize(de::max(objectSize, sizeof(FreeSlot)), (size_t)SLOT_ALIGNMENT))
+	, m_slotsPerSlab	(de::max<size_t>(SLAB_SIZE / m_slotSize, 1))
+	, m_threadCache		(deThreadLocal_create())
+	, m_lock			(0u)
+	, m_freeList		(DE_NULL)
+{
+	if (!m_threadCache)
+		throw std::bad_alloc();
+}
+
+SlabAllocator::~SlabAllocator (void)
+{
+	deThreadLocal_destroy(m_threadCache);
+
+	for (size_t ndx = 0; ndx < m_threadCaches.size(); ++ndx)
+		delete m_threadCaches[ndx];
+
+	for (size_t ndx = 0; ndx < m_slabs.size(); ++ndx)
+		deAlignedFree(m_slabs[ndx]);
+}
+
+// \note Critical sections are only a few instructions long, so a spin lock is much cheaper than a mutex here
+inline void SlabAllocator::lock (void)
+{
+	while (deAtomicCompareExchangeUint32(&m_lock, 0u, 1u) != 0u)
+		deYield();
+}
+
+inline void SlabAllocator::unlock (void)
+{
+	deAtomicCompareExchangeUint32(&m_lock, 1u, 0u);
+}
+
+SlabAllocator::ThreadCache* SlabAllocator::getThreadCache (void)
+{
+	ThreadCache*	cache	= reinterpret_cast<ThreadCache*>(deThreadLocal_get(m_threadCache));
+
+	if (!cache)
+	{
+		// \note Caches of exited threads are not recycled; at most 2*BATCH_SIZE slots per thread are lost that way
+		de::MovePtr<ThreadCache>	newCache	(new ThreadCache());
+
+		newCache->freeList		= DE_NULL;
+		newCache->numFreeSlots	= 0;
+
+		lock();
+
+		try
+		{
+			m_threadCaches.push_back(newCache.get());
+		}
+		catch (...)
+		{
+			unlock();
+			throw;
+		}
+
+		unlock();
+
+		cache = newCache.release();
+		deThreadLocal_set(m_threadCache, cache);
+	}
+
+	return cache;
+}
+
+void SlabAllocator::addSlab (void)
+{
+	deUint8* const	slab	= (deUint8*)deAlignedMalloc(m_slotSize*m_slotsPerSlab, (size_t)SLOT_ALIGNMENT);
+
+	if (!slab)
+		throw std::bad_alloc();
+
+	try
+	{
+		m_slabs.push_back(slab);
+	}
+	catch (...)
+	{
+		deAlignedFree(slab);
+		throw;
+	}
+
+	// Thread slots in address order so that consecutive allocations are adjacent in memory
+	for (size_t slotNdx = m_slotsPerSlab; slotNdx > 0; --slotNdx)
+	{
+		FreeSlot* const	slot	= reinterpret_cast<FreeSlot*>(slab + (slotNdx-1)*m_slotSize);
+
+		slot->next	= m_freeList;
+		m_freeList	= slot;
+	}
+}
+
+void SlabAllocator::refill (ThreadCache* cache)
+{
+	lock();
+
+	try
+	{
+		if (!m_freeList)
+			addSlab();
+	}
+	catch (...)
+	{
+		unlock();
+		throw;
+	}
+
+	while (m_freeList && cache->numFreeSlots < (deUint32)BATCH_SIZE)
+	{
+		FreeSlot* const	slot	= m_freeList;
+
+		m_freeList			= slot->next;
+		slot->next			= cache->freeList;
+		cache->freeList		= slot;
+		cache->numFreeSlots	+= 1;
+	}
+
+	unlock();
+}
+
+void SlabAllocator::flush (ThreadCache* cache, deUint32 numSlots)
+{
+	lock();
+
+	while (cache->freeList && numSlots > 0)
+	{
+		FreeSlot* const	slot	= cache->freeList;
+
+		cache->freeList		= slot->next;
+		cache->numFreeSlots	-= 1;
+		slot->next			= m_freeList;
+		m_freeList			= slot;
+		numSlots			-= 1;
+	}
+
+	unlock();
+}
+
+void* SlabAllocator::allocate (void)
+{
+	ThreadCache* const	cache	= getThreadCache();
+	FreeSlot*			slot	= DE_NULL;
+
+	if (!cache->freeList)
+		refill(cache);
+
+	slot				= cache->freeList;
+	cache->freeList		= slot->next;
+	cache->numFreeSlots	-= 1;
+
+	return slot;
+}
+
+void SlabAllocator::free (void* ptr)
+{
+	ThreadCache*	cache	= DE_NULL;
+
+	if (!ptr)
+		return;
+
+	try
+	{
+		cache = getThreadCache();
+	}
+	catch (const std::bad_alloc&)
+	{
+		// Can't create cache for this thread, return slot directly to shared list
+		FreeSlot* const	slot	= reinterpret_cast<FreeSlot*>(ptr);
+
+		lock();
+		slot->next	= m_freeList;
+		m_freeList	= slot;
+		unlock();
+
+		return;
+	}
+
+	{
+		FreeSlot* const	slot	= reinterpret_cast<FreeSlot*>(ptr);
+
+		slot->next			= cache->freeList;
+		cache->freeList		= slot;
+		cache->numFreeSlots	+= 1;
+	}
+
+	if (cache->numFreeSlots > 2u*(deUint32)BATCH_SIZE)
+		flush(cache, (deUint32)BATCH_SIZE);
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Base class for driver objects allocated from per-type slabs
+ *
+ * Objects created without VkAllocationCallbacks are served from a slab
+ * shared by all objects of the same type, which keeps the driver's own
+ * malloc traffic out of framework overhead measurements. Objects created
+ * with callbacks are constructed with placement new into memory obtained
+ * from the application, as before.
+ *//*--------------------------------------------------------------------*/
+template<typename Object>
+class SlabAllocated
+{
+public:
+	static void*			operator new	(size_t size)				{ DE_ASSERT(size == sizeof(Object)); DE_UNREF(size); return s_slab.allocate();	}
+	static void				operator delete	(void* ptr)					{ s_slab.free(ptr);																}
+
+	static void*			operator new	(size_t, void* ptr)			{ return ptr;																	}
+	static void				operator delete	(void*, void*)				{}
+
+private:
+	static SlabAllocator	s_slab;
+};
+
+template<typename Object>
+SlabAllocator SlabAllocated<Object>::s_slab (sizeof(Object));
+
 template<typename Object, typename Handle, typename Parent, typename CreateInfo>
 Handle allocateHandle (Parent parent, const CreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator)
 {
@@ -152,11 +435,24 @@ void freeNonDispHandle (Handle handle, const VkAllocationCallbacks* pAllocator)
 		}										\
 	} while (deGetFalse())
 
+//! Record command to command buffer; failures are reported by vkEndCommandBuffer()
+#define VK_NULL_RECORD(COMMAND_BUFFER, NEW_COMMAND)										\
+	do {																				\
+		CommandBuffer* const cmdBuf__ = reinterpret_cast<CommandBuffer*>(COMMAND_BUFFER);	\
+		try {																			\
+			cmdBuf__->record(de::MovePtr<Command>(NEW_COMMAND));						\
+		} catch (const std::bad_alloc&) {												\
+			cmdBuf__->setRecordingFailed(VK_ERROR_OUT_OF_HOST_MEMORY);					\
+		} catch (const UnsupportedTransferFormat&) {									\
+			DE_FATAL("Transfer command on format without transfer support");			\
+		}																				\
+	} while (deGetFalse())
+
 // \todo [2015-07-14 pyry] Check FUNC type by checkedCastToPtr<T>() or similar
 #define VK_NULL_FUNC_ENTRY(NAME, FUNC)	{ #NAME, (deFunctionPtr)FUNC }
 
 #define VK_NULL_DEFINE_DEVICE_OBJ(NAME)				\
-struct NAME											\
+struct NAME : public SlabAllocated<NAME>			\
 {													\
 	NAME (VkDevice, const Vk##NAME##CreateInfo*) {}	\
 }
@@ -176,7 +472,7 @@ VK_NULL_DEFINE_DEVICE_OBJ(Sampler);
 VK_NULL_DEFINE_DEVICE_OBJ(Framebuffer);
 VK_NULL_DEFINE_DEVICE_OBJ(CommandPool);
 
-class Instance
+class Instance : public SlabAllocated<Instance>
 {
 public:
 										Instance		(const VkInstanceCreateInfo* instanceInfo);
@@ -188,7 +484,7 @@ private:
 	const tcu::StaticFunctionLibrary	m_functions;
 };
 
-class Device
+class Device : public SlabAllocated<Device>
 {
 public:
 										Device			(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo* deviceInfo);
@@ -200,7 +496,7 @@ private:
 	const tcu::StaticFunctionLibrary	m_functions;
 };
 
-class Pipeline
+class Pipeline : public SlabAllocated<Pipeline>
 {
 public:
 	Pipeline (VkDevice, const VkGraphicsPipelineCreateInfo*) {}
@@ -227,7 +523,7 @@ void freeHeap (void* ptr)
 	deFree(ptr);
 }
 
-class DeviceMemory
+class DeviceMemory : public SlabAllocated<DeviceMemory>
 {
 public:
 						DeviceMemory	(VkDevice, const VkMemoryAllocateInfo* pAllocInfo)
@@ -245,55 +541,665 @@ private:
 	void* const			m_memory;
 };
 
-class Buffer
+class Buffer : public SlabAllocated<Buffer>
 {
 public:
 						Buffer		(VkDevice, const VkBufferCreateInfo* pCreateInfo)
-							: m_size(pCreateInfo->size)
+							: m_size	(pCreateInfo->size)
+							, m_memory	(DE_NULL)
+							, m_offset	(0)
 						{}
 
 	VkDeviceSize		getSize		(void) const { return m_size;	}
 
+	void				bindMemory	(const DeviceMemory* memory, VkDeviceSize offset) { m_memory = memory; m_offset = offset; }
+	bool				isBound		(void) const { return m_memory != DE_NULL && m_memory->getPtr() != DE_NULL; }
+	deUint8*			getPtr		(void) const { DE_ASSERT(isBound()); return (deUint8*)m_memory->getPtr() + m_offset; }
+
 private:
 	const VkDeviceSize	m_size;
+
+	const DeviceMemory*	m_memory;
+	VkDeviceSize		m_offset;
 };
 
-class Image
+VkDeviceSize getPackedImageDataSize (VkFormat format, VkExtent3D extent, VkSampleCountFlagBits samples)
+{
+	return (VkDeviceSize)getPixelSize(mapVkFormat(format))
+			* (VkDeviceSize)extent.width
+			* (VkDeviceSize)extent.height
+			* (VkDeviceSize)extent.depth
+			* (VkDeviceSize)samples;
+}
+
+//! Get extent in compressed blocks. Extent is returned as is for uncompressed formats.
+VkExtent3D getBlockExtent (VkFormat format, VkExtent3D extent)
+{
+	if (isCompressedFormat(format))
+	{
+		const tcu::IVec3	blockPixelSize	= tcu::getBlockPixelSize(mapVkCompressedFormat(format));
+		const VkExtent3D	blockExtent		=
+		{
+			(deUint32)deDivRoundUp32((int)extent.width, blockPixelSize.x()),
+			(deUint32)deDivRoundUp32((int)extent.height, blockPixelSize.y()),
+			(deUint32)deDivRoundUp32((int)extent.depth, blockPixelSize.z())
+		};
+
+		return blockExtent;
+	}
+	else
+		return extent;
+}
+
+VkDeviceSize getCompressedImageDataSize (VkFormat format, VkExtent3D extent)
+{
+	try
+	{
+		const VkExtent3D	blockExtent	= getBlockExtent(format, extent);
+
+		return (VkDeviceSize)tcu::getBlockSize(mapVkCompressedFormat(format))
+				* (VkDeviceSize)blockExtent.width
+				* (VkDeviceSize)blockExtent.height
+				* (VkDeviceSize)blockExtent.depth;
+	}
+	catch (...)
+	{
+		return 0; // Unsupported compressed format
+	}
+}
+
+//! Thrown when recording a transfer command on a format that doesn't report transfer features.
+class UnsupportedTransferFormat
+{
+};
+
+//! Get tcu::TextureFormat for accessing image data in transfer commands. Throws UnsupportedTransferFormat if not available.
+tcu::TextureFormat getTransferFormat (VkFormat format)
+{
+	if (isCompressedFormat(format))
+		throw UnsupportedTransferFormat();
+
+	try
+	{
+		return mapVkFormat(format);
+	}
+	catch (const tcu::Exception&)
+	{
+		throw UnsupportedTransferFormat();
+	}
+}
+
+bool isTransferFormatSupported (VkFormat format)
+{
+	try
+	{
+		getTransferFormat(format);
+		return true;
+	}
+	catch (const UnsupportedTransferFormat&)
+	{
+		return false;
+	}
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Image
+ *
+ * Image data is stored linearly regardless of tiling. Subresources are
+ * tightly packed one after another, ordered by mip level first and then by
+ * array layer. Multisampled images store all samples of a pixel next to
+ * each other, but transfer commands only access the first sample.
+ *//*--------------------------------------------------------------------*/
+class Image : public SlabAllocated<Image>
 {
 public:
-								Image			(VkDevice, const VkImageCreateInfo* pCreateInfo)
+								Image					(VkDevice, const VkImageCreateInfo* pCreateInfo)
 									: m_imageType	(pCreateInfo->imageType)
 									, m_format		(pCreateInfo->format)
 									, m_extent		(pCreateInfo->extent)
+									, m_mipLevels	(pCreateInfo->mipLevels)
+									, m_arrayLayers	(pCreateInfo->arrayLayers)
 									, m_samples		(pCreateInfo->samples)
+									, m_memory		(DE_NULL)
+									, m_offset		(0)
 								{}
 
-	VkImageType					getImageType	(void) const { return m_imageType;	}
-	VkFormat					getFormat		(void) const { return m_format;		}
-	VkExtent3D					getExtent		(void) const { return m_extent;		}
-	VkSampleCountFlagBits		getSamples		(void) const { return m_samples;	}
+	VkImageType					getImageType			(void) const { return m_imageType;		}
+	VkFormat					getFormat				(void) const { return m_format;			}
+	VkExtent3D					getExtent				(void) const { return m_extent;			}
+	deUint32					getMipLevels			(void) const { return m_mipLevels;		}
+	deUint32					getArrayLayers			(void) const { return m_arrayLayers;	}
+	VkSampleCountFlagBits		getSamples				(void) const { return m_samples;		}
+
+	VkExtent3D					getLevelExtent			(deUint32 mipLevel) const;
+	VkDeviceSize				getLayerSize			(deUint32 mipLevel) const;
+	VkDeviceSize				getSubresourceOffset	(deUint32 mipLevel, deUint32 arrayLayer) const;
+	VkDeviceSize				getDataSize				(void) const;
+
+	void						bindMemory				(const DeviceMemory* memory, VkDeviceSize offset) { m_memory = memory; m_offset = offset; }
+	bool						isBound					(void) const { return m_memory != DE_NULL && m_memory->getPtr() != DE_NULL; }
+
+	tcu::PixelBufferAccess		getSubresourceAccess	(deUint32 mipLevel, deUint32 arrayLayer) const;
 
 private:
 	const VkImageType			m_imageType;
 	const VkFormat				m_format;
 	const VkExtent3D			m_extent;
+	const deUint32				m_mipLevels;
+	const deUint32				m_arrayLayers;
 	const VkSampleCountFlagBits	m_samples;
+
+	const DeviceMemory*			m_memory;
+	VkDeviceSize				m_offset;
 };
 
-class CommandBuffer
+VkExtent3D Image::getLevelExtent (deUint32 mipLevel) const
+{
+	const VkExtent3D	extent	=
+	{
+		de::max(m_extent.width >> mipLevel, 1u),
+		de::max(m_extent.height >> mipLevel, 1u),
+		de::max(m_extent.depth >> mipLevel, 1u)
+	};
+
+	return extent;
+}
+
+VkDeviceSize Image::getLayerSize (deUint32 mipLevel) const
+{
+	if (isCompressedFormat(m_format))
+		return getCompressedImageDataSize(m_format, getLevelExtent(mipLevel));
+	else
+		return getPackedImageDataSize(m_format, getLevelExtent(mipLevel), m_samples);
+}
+
+VkDeviceSize Image::getSubresourceOffset (deUint32 mipLevel, deUint32 arrayLayer) const
+{
+	VkDeviceSize	offset	= 0;
+
+	DE_ASSERT(mipLevel < m_mipLevels && arrayLayer < m_arrayLayers);
+
+	for (deUint32 levelNdx = 0; levelNdx < mipLevel; ++levelNdx)
+		offset += getLayerSize(levelNdx) * m_arrayLayers;
+
+	return offset + getLayerSize(mipLevel) * arrayLayer;
+}
+
+VkDeviceSize Image::getDataSize (void) const
+{
+	VkDeviceSize	size	= 0;
+
+	for (deUint32 levelNdx = 0; levelNdx < m_mipLevels; ++levelNdx)
+		size += getLayerSize(levelNdx) * m_arrayLayers;
+
+	return size;
+}
+
+tcu::PixelBufferAccess Image::getSubresourceAccess (deUint32 mipLevel, deUint32 arrayLayer) const
+{
+	const tcu::TextureFormat	format		= mapVkFormat(m_format);
+	const VkExtent3D			extent		= getLevelExtent(mipLevel);
+	const int					pixelPitch	= format.getPixelSize() * (int)m_samples;
+
+	DE_ASSERT(isBound());
+
+	return tcu::PixelBufferAccess(format,
+								  tcu::IVec3((int)extent.width, (int)extent.height, (int)extent.depth),
+								  tcu::IVec3(pixelPitch, pixelPitch*(int)extent.width, pixelPitch*(int)extent.width*(int)extent.height),
+								  (deUint8*)m_memory->getPtr() + m_offset + getSubresourceOffset(mipLevel, arrayLayer));
+}
+
+// Command execution
+
+//! Recorded command, executed when command buffer is submitted to a queue
+class Command
 {
 public:
-						CommandBuffer(VkDevice, VkCommandPool, VkCommandBufferLevel)
-						{}
+	virtual			~Command	(void) {}
+	virtual void	execute		(void) const = 0;
+};
+
+class CommandBuffer : public SlabAllocated<CommandBuffer>
+{
+public:
+							CommandBuffer	(VkDevice, VkCommandPool, VkCommandBufferLevel)
+								: m_recordingResult(VK_SUCCESS)
+							{}
+							~CommandBuffer	(void)
+							{
+								reset();
+							}
+
+	void					record			(de::MovePtr<Command> command);
+	void					setRecordingFailed	(VkResult result) { if (m_recordingResult == VK_SUCCESS) m_recordingResult = result; }
+	VkResult				getRecordingResult	(void) const { return m_recordingResult; }
+
+	void					reset			(void);
+	void					execute			(void) const;
+
+private:
+	vector<Command*>		m_commands;
+	VkResult				m_recordingResult;
+};
+
+void CommandBuffer::record (de::MovePtr<Command> command)
+{
+	m_commands.push_back(command.get());
+	command.release();
+}
+
+void CommandBuffer::reset (void)
+{
+	for (size_t ndx = 0; ndx < m_commands.size(); ++ndx)
+		delete m_commands[ndx];
+	m_commands.clear();
+	m_recordingResult = VK_SUCCESS;
+}
+
+void CommandBuffer::execute (void) const
+{
+	// \note Formats are checked when commands are recorded, so commands don't fail here
+	for (size_t ndx = 0; ndx < m_commands.size(); ++ndx)
+		m_commands[ndx]->execute();
+}
+
+tcu::PixelBufferAccess getAspectAccess (const tcu::PixelBufferAccess& access, VkImageAspectFlags aspectMask)
+{
+	if (access.getFormat().order == tcu::TextureFormat::DS)
+	{
+		if (aspectMask == VK_IMAGE_ASPECT_DEPTH_BIT)
+			return tcu::getEffectiveDepthStencilAccess(access, tcu::Sampler::MODE_DEPTH);
+		else if (aspectMask == VK_IMAGE_ASPECT_STENCIL_BIT)
+			return tcu::getEffectiveDepthStencilAccess(access, tcu::Sampler::MODE_STENCIL);
+	}
+
+	return access;
+}
+
+bool isIntegerFormat (const tcu::TextureFormat& format)
+{
+	const tcu::TextureChannelClass	channelClass	= tcu::getTextureChannelClass(format.type);
+
+	return channelClass == tcu::TEXTURECHANNELCLASS_SIGNED_INTEGER || channelClass == tcu::TEXTURECHANNELCLASS_UNSIGNED_INTEGER;
+}
+
+void copyPixel (const tcu::PixelBufferAccess& dst, int dstX, int dstY, int dstZ, const tcu::ConstPixelBufferAccess& src, int srcX, int srcY, int srcZ)
+{
+	const tcu::TextureFormat::ChannelOrder	order	= src.getFormat().order;
+
+	if (order == tcu::TextureFormat::D || order == tcu::TextureFormat::DS)
+		dst.setPixDepth(src.getPixDepth(srcX, srcY, srcZ), dstX, dstY, dstZ);
+
+	if (order == tcu::TextureFormat::S || order == tcu::TextureFormat::DS)
+		dst.setPixStencil(src.getPixStencil(srcX, srcY, srcZ), dstX, dstY, dstZ);
+
+	if (!tcu::isCombinedDepthStencilType(src.getFormat().type) && order != tcu::TextureFormat::D && order != tcu::TextureFormat::S)
+	{
+		if (isIntegerFormat(src.getFormat()))
+			dst.setPixel(src.getPixelInt(srcX, srcY, srcZ), dstX, dstY, dstZ);
+		else
+			dst.setPixel(src.getPixel(srcX, srcY, srcZ), dstX, dstY, dstZ);
+	}
+}
+
+class CopyBufferCommand : public Command
+{
+public:
+	CopyBufferCommand (const Buffer* src, const Buffer* dst, deUint32 regionCount, const VkBufferCopy* pRegions)
+		: m_src		(src)
+		, m_dst		(dst)
+		, m_regions	(pRegions, pRegions + regionCount)
+	{}
+
+	void execute (void) const
+	{
+		if (!m_src->isBound() || !m_dst->isBound())
+			return;
+
+		for (size_t ndx = 0; ndx < m_regions.size(); ++ndx)
+			deMemmove(m_dst->getPtr() + m_regions[ndx].dstOffset, m_src->getPtr() + m_regions[ndx].srcOffset, (size_t)m_regions[ndx].size);
+	}
+
+private:
+	const Buffer* const		m_src;
+	const Buffer* const		m_dst;
+	const vector<VkBufferCopy>	m_regions;
+};
+
+class CopyImageCommand : public Command
+{
+public:
+	CopyImageCommand (const Image* src, const Image* dst, deUint32 regionCount, const VkImageCopy* pRegions)
+		: m_src		(src)
+		, m_dst		(dst)
+		, m_regions	(pRegions, pRegions + regionCount)
+	{
+		getTransferFormat(src->getFormat());
+		getTransferFormat(dst->getFormat());
+	}
+
+	void execute (void) const
+	{
+		if (!m_src->isBound() || !m_dst->isBound())
+			return;
+
+		for (size_t regionNdx = 0; regionNdx < m_regions.size(); ++regionNdx)
+		{
+			const VkImageCopy&	region	= m_regions[regionNdx];
+
+			for (deUint32 layerNdx = 0; layerNdx < region.srcSubresource.layerCount; ++layerNdx)
+			{
+				const tcu::PixelBufferAccess	srcAccess	= getAspectAccess(m_src->getSubresourceAccess(region.srcSubresource.mipLevel, region.srcSubresource.baseArrayLayer + layerNdx), region.srcSubresource.aspectMask);
+				const tcu::PixelBufferAccess	dstAccess	= getAspectAccess(m_dst->getSubresourceAccess(region.dstSubresource.mipLevel, region.dstSubresource.baseArrayLayer + layerNdx), region.dstSubresource.aspectMask);
+				// \note Copies between compatible formats are bit-exact, so destination is accessed with source format
+				const tcu::PixelBufferAccess	dstAsSrc	(srcAccess.getFormat(), dstAccess.getSize(), dstAccess.getPitch(), dstAccess.getDataPtr());
+
+				tcu::copy(tcu::getSubregion(dstAsSrc, region.dstOffset.x, region.dstOffset.y, region.dstOffset.z, (int)region.extent.width, (int)region.extent.height, (int)region.extent.depth),
+						  tcu::getSubregion(srcAccess, region.srcOffset.x, region.srcOffset.y, region.srcOffset.z, (int)region.extent.width, (int)region.extent.height, (int)region.extent.depth));
+			}
+		}
+	}
+
+private:
+	const Image* const			m_src;
+	const Image* const			m_dst;
+	const vector<VkImageCopy>	m_regions;
+};
+
+class BlitImageCommand : public Command
+{
+public:
+	BlitImageCommand (const Image* src, const Image* dst, deUint32 regionCount, const VkImageBlit* pRegions, VkFilter filter)
+		: m_src		(src)
+		, m_dst		(dst)
+		, m_regions	(pRegions, pRegions + regionCount)
+		, m_filter	(filter)
+	{
+		getTransferFormat(src->getFormat());
+		getTransferFormat(dst->getFormat());
+	}
+
+	void execute (void) const
+	{
+		if (!m_src->isBound() || !m_dst->isBound())
+			return;
+
+		for (size_t regionNdx = 0; regionNdx < m_regions.size(); ++regionNdx)
+		{
+			const VkImageBlit&	region	= m_regions[regionNdx];
+
+			for (deUint32 layerNdx = 0; layerNdx < region.srcSubresource.layerCount; ++layerNdx)
+			{
+				const tcu::PixelBufferAccess	srcAccess	= getAspectAccess(m_src->getSubresourceAccess(region.srcSubresource.mipLevel, region.srcSubresource.baseArrayLayer + layerNdx), region.srcSubresource.aspectMask);
+				const tcu::PixelBufferAccess	dstAccess	= getAspectAccess(m_dst->getSubresourceAccess(region.dstSubresource.mipLevel, region.dstSubresource.baseArrayLayer + layerNdx), region.dstSubresource.aspectMask);
+
+				blitLayer(srcAccess, region.srcOffsets, dstAccess, region.dstOffsets);
+			}
+		}
+	}
+
+private:
+	void blitLayer (const tcu::ConstPixelBufferAccess& src, const VkOffset3D* srcOffsets, const tcu::PixelBufferAccess& dst, const VkOffset3D* dstOffsets) const
+	{
+		const tcu::TextureFormat::ChannelOrder	order		= src.getFormat().order;
+		const bool								useLinear	= m_filter == VK_FILTER_LINEAR
+															  && order != tcu::TextureFormat::D && order != tcu::TextureFormat::S && order != tcu::TextureFormat::DS
+															  && !isIntegerFormat(src.getFormat());
+		const tcu::Sampler						sampler		(tcu::Sampler::CLAMP_TO_EDGE, tcu::Sampler::CLAMP_TO_EDGE, tcu::Sampler::CLAMP_TO_EDGE,
+															 tcu::Sampler::LINEAR, tcu::Sampler::LINEAR, 0.0f, false /* non-normalized coords */);
+		const tcu::Vec3							srcMin		((float)srcOffsets[0].x, (float)srcOffsets[0].y, (float)srcOffsets[0].z);
+		const tcu::Vec3							srcMax		((float)srcOffsets[1].x, (float)srcOffsets[1].y, (float)srcOffsets[1].z);
+		const tcu::IVec3						dstMin		(dstOffsets[0].x, dstOffsets[0].y, dstOffsets[0].z);
+		const tcu::IVec3						dstMax		(dstOffsets[1].x, dstOffsets[1].y, dstOffsets[1].z);
+		const tcu::IVec3						dstStart	= tcu::min(dstMin, dstMax);
+		const tcu::IVec3						dstEnd		= tcu::max(dstMin, dstMax);
+
+		for (int z = dstStart.z(); z < dstEnd.z(); ++z)
+		for (int y = dstStart.y(); y < dstEnd.y(); ++y)
+		for (int x = dstStart.x(); x < dstEnd.x(); ++x)
+		{
+			// Map destination pixel center to source; mirrored regions are handled by signed extents.
+			const tcu::Vec3		dstCoord	= tcu::Vec3((float)x, (float)y, (float)z) + 0.5f;
+			const tcu::Vec3		srcCoord	= srcMin + (dstCoord - dstMin.asFloat()) / (dstMax - dstMin).asFloat() * (srcMax - srcMin);
+
+			if (useLinear)
+				dst.setPixel(src.sample3D(sampler, tcu::Sampler::LINEAR, srcCoord.x(), srcCoord.y(), srcCoord.z()), x, y, z);
+			else
+			{
+				const int	srcX	= de::clamp(deFloorFloatToInt32(srcCoord.x()), 0, src.getWidth() - 1);
+				const int	srcY	= de::clamp(deFloorFloatToInt32(srcCoord.y()), 0, src.getHeight() - 1);
+				const int	srcZ	= de::clamp(deFloorFloatToInt32(srcCoord.z()), 0, src.getDepth() - 1);
+
+				copyPixel(dst, x, y, z, src, srcX, srcY, srcZ);
+			}
+		}
+	}
+
+	const Image* const			m_src;
+	const Image* const			m_dst;
+	const vector<VkImageBlit>	m_regions;
+	const VkFilter				m_filter;
+};
+
+class CopyBufferImageCommand : public Command
+{
+public:
+	enum Direction
+	{
+		BUFFER_TO_IMAGE = 0,
+		IMAGE_TO_BUFFER
+	};
+
+	CopyBufferImageCommand (Direction direction, const Buffer* buffer, const Image* image, deUint32 regionCount, const VkBufferImageCopy* pRegions)
+		: m_direction	(direction)
+		, m_buffer		(buffer)
+		, m_image		(image)
+		, m_regions		(pRegions, pRegions + regionCount)
+	{
+		getTransferFormat(image->getFormat());
+
+		for (deUint32 regionNdx = 0; regionNdx < regionCount; ++regionNdx)
+			m_bufferFormats.push_back(getBufferFormat(image->getFormat(), pRegions[regionNdx].imageSubresource.aspectMask));
+	}
+
+	void execute (void) const
+	{
+		if (!m_buffer->isBound() || !m_image->isBound())
+			return;
+
+		for (size_t regionNdx = 0; regionNdx < m_regions.size(); ++regionNdx)
+		{
+			const VkBufferImageCopy&	region			= m_regions[regionNdx];
+			const VkImageAspectFlags	aspectMask		= region.imageSubresource.aspectMask;
+			const tcu::TextureFormat&	bufferFormat	= m_bufferFormats[regionNdx];
+			const tcu::IVec3			size			((int)region.imageExtent.width, (int)region.imageExtent.height, (int)region.imageExtent.depth);
+			const int					rowLength		= region.bufferRowLength != 0 ? (int)region.bufferRowLength : size.x();
+			const int					imageHeight		= region.bufferImageHeight != 0 ? (int)region.bufferImageHeight : size.y();
+			const int					pixelSize		= bufferFormat.getPixelSize();
+			const tcu::IVec3			bufferPitch		(pixelSize, pixelSize*rowLength, pixelSize*rowLength*imageHeight);
+
+			for (deUint32 layerNdx = 0; layerNdx < region.imageSubresource.layerCount; ++layerNdx)
+			{
+				const tcu::PixelBufferAccess	imageAccess		= getAspectAccess(m_image->getSubresourceAccess(region.imageSubresource.mipLevel, region.imageSubresource.baseArrayLayer + layerNdx), aspectMask);
+				const tcu::PixelBufferAccess	imageRegion		= tcu::getSubregion(imageAccess, region.imageOffset.x, region.imageOffset.y, region.imageOffset.z, size.x(), size.y(), size.z());
+				const tcu::PixelBufferAccess	bufferRegion	(bufferFormat, size, bufferPitch, m_buffer->getPtr() + region.bufferOffset + layerNdx*bufferPitch.z()*size.z());
+
+				if (m_direction == BUFFER_TO_IMAGE)
+					tcu::copy(imageRegion, bufferRegion);
+				else
+					tcu::copy(bufferRegion, imageRegion);
+			}
+		}
+	}
+
+private:
+	static tcu::TextureFormat getBufferFormat (VkFormat format, VkImageAspectFlags aspectMask)
+	{
+		try
+		{
+			if (aspectMask == VK_IMAGE_ASPECT_DEPTH_BIT)
+				return getDepthCopyFormat(format);
+			else if (aspectMask == VK_IMAGE_ASPECT_STENCIL_BIT)
+				return getStencilCopyFormat(format);
+			else
+				return mapVkFormat(format);
+		}
+		catch (const tcu::Exception&)
+		{
+			throw UnsupportedTransferFormat();
+		}
+	}
+
+	const Direction						m_direction;
+	const Buffer* const					m_buffer;
+	const Image* const					m_image;
+	const vector<VkBufferImageCopy>		m_regions;
+	vector<tcu::TextureFormat>			m_bufferFormats;	//!< Buffer data format per region
+};
+
+class UpdateBufferCommand : public Command
+{
+public:
+	UpdateBufferCommand (const Buffer* dst, VkDeviceSize dstOffset, VkDeviceSize dataSize, const void* pData)
+		: m_dst			(dst)
+		, m_dstOffset	(dstOffset)
+		, m_data		((const deUint8*)pData, (const deUint8*)pData + dataSize)
+	{}
+
+	void execute (void) const
+	{
+		if (!m_dst->isBound() || m_data.empty())
+			return;
+
+		deMemcpy(m_dst->getPtr() + m_dstOffset, &m_data[0], m_data.size());
+	}
+
+private:
+	const Buffer* const		m_dst;
+	const VkDeviceSize		m_dstOffset;
+	const vector<deUint8>	m_data;
+};
+
+class FillBufferCommand : public Command
+{
+public:
+	FillBufferCommand (const Buffer* dst, VkDeviceSize dstOffset, VkDeviceSize size, deUint32 data)
+		: m_dst			(dst)
+		, m_dstOffset	(dstOffset)
+		, m_size		(size == VK_WHOLE_SIZE ? ((dst->getSize() - dstOffset) & ~(VkDeviceSize)3) : size)
+		, m_data		(data)
+	{}
+
+	void execute (void) const
+	{
+		if (!m_dst->isBound())
+			return;
+
+		for (VkDeviceSize offset = 0; offset + sizeof(deUint32) <= m_size; offset += sizeof(deUint32))
+			deMemcpy(m_dst->getPtr() + m_dstOffset + offset, &m_data, sizeof(deUint32));
+	}
+
+private:
+	const Buffer* const		m_dst;
+	const VkDeviceSize		m_dstOffset;
+	const VkDeviceSize		m_size;
+	const deUint32			m_data;
+};
+
+class ClearImageCommand : public Command
+{
+public:
+	ClearImageCommand (const Image* image, const VkClearColorValue& color, deUint32 rangeCount, const VkImageSubresourceRange* pRanges)
+		: m_image	(image)
+		, m_ranges	(pRanges, pRanges + rangeCount)
+	{
+		getTransferFormat(image->getFormat());
+		m_value.color = color;
+	}
+
+	ClearImageCommand (const Image* image, const VkClearDepthStencilValue& depthStencil, deUint32 rangeCount, const VkImageSubresourceRange* pRanges)
+		: m_image	(image)
+		, m_ranges	(pRanges, pRanges + rangeCount)
+	{
+		getTransferFormat(image->getFormat());
+		m_value.depthStencil = depthStencil;
+	}
+
+	void execute (void) const
+	{
+		if (!m_image->isBound())
+			return;
+
+		for (size_t rangeNdx = 0; rangeNdx < m_ranges.size(); ++rangeNdx)
+		{
+			const VkImageSubresourceRange&	range	= m_ranges[rangeNdx];
+
+			for (deUint32 levelNdx = range.baseMipLevel; levelNdx < range.baseMipLevel + range.levelCount; ++levelNdx)
+			for (deUint32 layerNdx = range.baseArrayLayer; layerNdx < range.baseArrayLayer + range.layerCount; ++layerNdx)
+				clearSubresource(m_image->getSubresourceAccess(levelNdx, layerNdx), range.aspectMask);
+		}
+	}
+
+private:
+	void clearSubresource (const tcu::PixelBufferAccess& access, VkImageAspectFlags aspectMask) const
+	{
+		if (aspectMask & VK_IMAGE_ASPECT_COLOR_BIT)
+		{
+			switch (tcu::getTextureChannelClass(access.getFormat().type))
+			{
+				case tcu::TEXTURECHANNELCLASS_SIGNED_INTEGER:
+					tcu::clear(access, tcu::IVec4(m_value.color.int32));
+					break;
+
+				case tcu::TEXTURECHANNELCLASS_UNSIGNED_INTEGER:
+					tcu::clear(access, tcu::UVec4(m_value.color.uint32));
+					break;
+
+				default:
+					tcu::clear(access, tcu::Vec4(m_value.color.float32));
+					break;
+			}
+		}
+
+		if (aspectMask & VK_IMAGE_ASPECT_DEPTH_BIT)
+			tcu::clearDepth(access, m_value.depthStencil.depth);
+
+		if (aspectMask & VK_IMAGE_ASPECT_STENCIL_BIT)
+			tcu::clearStencil(access, (int)m_value.depthStencil.stencil);
+	}
+
+	const Image* const						m_image;
+	const vector<VkImageSubresourceRange>	m_ranges;
+	VkClearValue							m_value;
+};
+
+class ExecuteCommandsCommand : public Command
+{
+public:
+	ExecuteCommandsCommand (deUint32 commandBufferCount, const VkCommandBuffer* pCommandBuffers)
+		: m_commandBuffers	(commandBufferCount)
+	{
+		for (deUint32 ndx = 0; ndx < commandBufferCount; ++ndx)
+			m_commandBuffers[ndx] = reinterpret_cast<const CommandBuffer*>(pCommandBuffers[ndx]);
+	}
+
+	void execute (void) const
+	{
+		for (size_t ndx = 0; ndx < m_commandBuffers.size(); ++ndx)
+			m_commandBuffers[ndx]->execute();
+	}
+
+private:
+	vector<const CommandBuffer*>	m_commandBuffers;
 };
 
-class DescriptorSet
+class DescriptorSet : public SlabAllocated<DescriptorSet>
 {
 public:
 	DescriptorSet (VkDevice, VkDescriptorPool, VkDescriptorSetLayout) {}
 };
 
-class DescriptorPool
+class DescriptorPool : public SlabAllocated<DescriptorPool>
 {
 public:
 										DescriptorPool	(VkDevice device, const VkDescriptorPoolCreateInfo* pCreateInfo)
@@ -480,24 +1386,27 @@ VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceMemoryProperties (VkPhysicalDevice,
 	props->memoryHeaps[0].flags			= 0u;
 }
 
-VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceFormatProperties (VkPhysicalDevice, VkFormat, VkFormatProperties* pFormatProperties)
+VKAPI_ATTR void VKAPI_CALL getPhysicalDeviceFormatProperties (VkPhysicalDevice, VkFormat format, VkFormatProperties* pFormatProperties)
 {
-	const VkFormatFeatureFlags	allFeatures	= VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT
-											| VK_FORMAT_FEATURE_STORAGE_IMAGE_BIT
-											| VK_FORMAT_FEATURE_STORAGE_IMAGE_ATOMIC_BIT
-											| VK_FORMAT_FEATURE_UNIFORM_TEXEL_BUFFER_BIT
-											| VK_FORMAT_FEATURE_STORAGE_TEXEL_BUFFER_BIT
-											| VK_FORMAT_FEATURE_STORAGE_TEXEL_BUFFER_ATOMIC_BIT
-											| VK_FORMAT_FEATURE_VERTEX_BUFFER_BIT
-											| VK_FORMAT_FEATURE_COLOR_ATTACHMENT_BIT
-											| VK_FORMAT_FEATURE_COLOR_ATTACHMENT_BLEND_BIT
-											| VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT
-											| VK_FORMAT_FEATURE_BLIT_SRC_BIT
-											| VK_FORMAT_FEATURE_BLIT_DST_BIT;
-
-	pFormatProperties->linearTilingFeatures		= allFeatures;
-	pFormatProperties->optimalTilingFeatures	= allFeatures;
-	pFormatProperties->bufferFeatures			= allFeatures;
+	const VkFormatFeatureFlags	blitFeatures	= VK_FORMAT_FEATURE_BLIT_SRC_BIT
+												| VK_FORMAT_FEATURE_BLIT_DST_BIT;
+	const VkFormatFeatureFlags	allFeatures		= VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT
+												| VK_FORMAT_FEATURE_STORAGE_IMAGE_BIT
+												| VK_FORMAT_FEATURE_STORAGE_IMAGE_ATOMIC_BIT
+												| VK_FORMAT_FEATURE_UNIFORM_TEXEL_BUFFER_BIT
+												| VK_FORMAT_FEATURE_STORAGE_TEXEL_BUFFER_BIT
+												| VK_FORMAT_FEATURE_STORAGE_TEXEL_BUFFER_ATOMIC_BIT
+												| VK_FORMAT_FEATURE_VERTEX_BUFFER_BIT
+												| VK_FORMAT_FEATURE_COLOR_ATTACHMENT_BIT
+												| VK_FORMAT_FEATURE_COLOR_ATTACHMENT_BLEND_BIT
+												| VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT
+												| blitFeatures;
+	// Transfer commands can only access formats with a tcu::TextureFormat equivalent
+	const VkFormatFeatureFlags	features		= isTransferFormatSupported(format) ? allFeatures : (allFeatures & ~blitFeatures);
+
+	pFormatProperties->linearTilingFeatures		= features;
+	pFormatProperties->optimalTilingFeatures	= features;
+	pFormatProperties->bufferFeatures			= features;
 }
 
 VKAPI_ATTR void VKAPI_CALL getBufferMemoryRequirements (VkDevice, VkBuffer bufferHandle, VkMemoryRequirements* requirements)
@@ -509,45 +1418,13 @@ VKAPI_ATTR void VKAPI_CALL getBufferMemoryRequirements (VkDevice, VkBuffer buffe
 	requirements->alignment			= (VkDeviceSize)1u;
 }
 
-VkDeviceSize getPackedImageDataSize (VkFormat format, VkExtent3D extent, VkSampleCountFlagBits samples)
-{
-	return (VkDeviceSize)getPixelSize(mapVkFormat(format))
-			* (VkDeviceSize)extent.width
-			* (VkDeviceSize)extent.height
-			* (VkDeviceSize)extent.depth
-			* (VkDeviceSize)samples;
-}
-
-VkDeviceSize getCompressedImageDataSize (VkFormat format, VkExtent3D extent)
-{
-	try
-	{
-		const tcu::CompressedTexFormat	tcuFormat		= mapVkCompressedFormat(format);
-		const size_t					blockSize		= tcu::getBlockSize(tcuFormat);
-		const tcu::IVec3				blockPixelSize	= tcu::getBlockPixelSize(tcuFormat);
-		const int						numBlocksX		= deDivRoundUp32((int)extent.width, blockPixelSize.x());
-		const int						numBlocksY		= deDivRoundUp32((int)extent.height, blockPixelSize.y());
-		const int						numBlocksZ		= deDivRoundUp32((int)extent.depth, blockPixelSize.z());
-
-		return blockSize*numBlocksX*numBlocksY*numBlocksZ;
-	}
-	catch (...)
-	{
-		return 0; // Unsupported compressed format
-	}
-}
-
 VKAPI_ATTR void VKAPI_CALL getImageMemoryRequirements (VkDevice, VkImage imageHandle, VkMemoryRequirements* requirements)
 {
 	const Image*	image	= reinterpret_cast<const Image*>(imageHandle.getInternal());
 
 	requirements->memoryTypeBits	= 1u;
 	requirements->alignment			= 16u;
-
-	if (isCompressedFormat(image->getFormat()))
-		requirements->size = getCompressedImageDataSize(image->getFormat(), image->getExtent());
-	else
-		requirements->size = getPackedImageDataSize(image->getFormat(), image->getExtent(), image->getSamples());
+	requirements->size				= image->getDataSize();
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL mapMemory (VkDevice, VkDeviceMemory memHandle, VkDeviceSize offset, VkDeviceSize size, VkMemoryMapFlags flags, void** ppData)
@@ -630,6 +1507,137 @@ VKAPI_ATTR void VKAPI_CALL freeCommandBuffers (VkDevice device, VkCommandPool co
 		delete reinterpret_cast<CommandBuffer*>(pCommandBuffers[ndx]);
 }
 
+VKAPI_ATTR VkResult VKAPI_CALL bindBufferMemory (VkDevice, VkBuffer bufferHandle, VkDeviceMemory memHandle, VkDeviceSize memoryOffset)
+{
+	reinterpret_cast<Buffer*>(bufferHandle.getInternal())->bindMemory(reinterpret_cast<const DeviceMemory*>(memHandle.getInternal()), memoryOffset);
+	return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL bindImageMemory (VkDevice, VkImage imageHandle, VkDeviceMemory memHandle, VkDeviceSize memoryOffset)
+{
+	reinterpret_cast<Image*>(imageHandle.getInternal())->bindMemory(reinterpret_cast<const DeviceMemory*>(memHandle.getInternal()), memoryOffset);
+	return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL getImageSubresourceLayout (VkDevice, VkImage imageHandle, const VkImageSubresource* pSubresource, VkSubresourceLayout* pLayout)
+{
+	const Image*		image		= reinterpret_cast<const Image*>(imageHandle.getInternal());
+	const VkDeviceSize	layerSize	= image->getLayerSize(pSubresource->mipLevel);
+
+	pLayout->offset		= image->getSubresourceOffset(pSubresource->mipLevel, pSubresource->arrayLayer);
+	pLayout->size		= layerSize;
+	pLayout->arrayPitch	= layerSize;
+	pLayout->rowPitch	= 0;
+	pLayout->depthPitch	= 0;
+
+	if (layerSize > 0)
+	{
+		// \note Rows of compressed images are rows of blocks
+		const VkExtent3D	blockExtent	= getBlockExtent(image->getFormat(), image->getLevelExtent(pSubresource->mipLevel));
+
+		pLayout->rowPitch	= layerSize / (VkDeviceSize)(blockExtent.height * blockExtent.depth);
+		pLayout->depthPitch	= layerSize / (VkDeviceSize)blockExtent.depth;
+	}
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL queueSubmit (VkQueue, deUint32 submitCount, const VkSubmitInfo* pSubmits, VkFence)
+{
+	// \note Commands are executed immediately, so queue is always idle after submit
+	try
+	{
+		for (deUint32 submitNdx = 0; submitNdx < submitCount; ++submitNdx)
+		{
+			for (deUint32 cmdBufNdx = 0; cmdBufNdx < pSubmits[submitNdx].commandBufferCount; ++cmdBufNdx)
+				reinterpret_cast<const CommandBuffer*>(pSubmits[submitNdx].pCommandBuffers[cmdBufNdx])->execute();
+		}
+	}
+	catch (const std::bad_alloc&)
+	{
+		return VK_ERROR_OUT_OF_HOST_MEMORY;
+	}
+
+	return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL beginCommandBuffer (VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo*)
+{
+	reinterpret_cast<CommandBuffer*>(commandBuffer)->reset();
+	return VK_SUCCESS;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL endCommandBuffer (VkCommandBuffer commandBuffer)
+{
+	return reinterpret_cast<const CommandBuffer*>(commandBuffer)->getRecordingResult();
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL resetCommandBuffer (VkCommandBuffer commandBuffer, VkCommandBufferResetFlags)
+{
+	reinterpret_cast<CommandBuffer*>(commandBuffer)->reset();
+	return VK_SUCCESS;
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdCopyBuffer (VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, deUint32 regionCount, const VkBufferCopy* pRegions)
+{
+	VK_NULL_RECORD(commandBuffer, new CopyBufferCommand(reinterpret_cast<const Buffer*>(srcBuffer.getInternal()),
+														reinterpret_cast<const Buffer*>(dstBuffer.getInternal()),
+														regionCount, pRegions));
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdCopyImage (VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout, VkImage dstImage, VkImageLayout, deUint32 regionCount, const VkImageCopy* pRegions)
+{
+	VK_NULL_RECORD(commandBuffer, new CopyImageCommand(reinterpret_cast<const Image*>(srcImage.getInternal()),
+													   reinterpret_cast<const Image*>(dstImage.getInternal()),
+													   regionCount, pRegions));
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdBlitImage (VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout, VkImage dstImage, VkImageLayout, deUint32 regionCount, const VkImageBlit* pRegions, VkFilter filter)
+{
+	VK_NULL_RECORD(commandBuffer, new BlitImageCommand(reinterpret_cast<const Image*>(srcImage.getInternal()),
+													   reinterpret_cast<const Image*>(dstImage.getInternal()),
+													   regionCount, pRegions, filter));
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdCopyBufferToImage (VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkImage dstImage, VkImageLayout, deUint32 regionCount, const VkBufferImageCopy* pRegions)
+{
+	VK_NULL_RECORD(commandBuffer, new CopyBufferImageCommand(CopyBufferImageCommand::BUFFER_TO_IMAGE,
+															 reinterpret_cast<const Buffer*>(srcBuffer.getInternal()),
+															 reinterpret_cast<const Image*>(dstImage.getInternal()),
+															 regionCount, pRegions));
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdCopyImageToBuffer (VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout, VkBuffer dstBuffer, deUint32 regionCount, const VkBufferImageCopy* pRegions)
+{
+	VK_NULL_RECORD(commandBuffer, new CopyBufferImageCommand(CopyBufferImageCommand::IMAGE_TO_BUFFER,
+															 reinterpret_cast<const Buffer*>(dstBuffer.getInternal()),
+															 reinterpret_cast<const Image*>(srcImage.getInternal()),
+															 regionCount, pRegions));
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdUpdateBuffer (VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize dataSize, const deUint32* pData)
+{
+	VK_NULL_RECORD(commandBuffer, new UpdateBufferCommand(reinterpret_cast<const Buffer*>(dstBuffer.getInternal()), dstOffset, dataSize, pData));
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdFillBuffer (VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize size, deUint32 data)
+{
+	VK_NULL_RECORD(commandBuffer, new FillBufferCommand(reinterpret_cast<const Buffer*>(dstBuffer.getInternal()), dstOffset, size, data));
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdClearColorImage (VkCommandBuffer commandBuffer, VkImage image, VkImageLayout, const VkClearColorValue* pColor, deUint32 rangeCount, const VkImageSubresourceRange* pRanges)
+{
+	VK_NULL_RECORD(commandBuffer, new ClearImageCommand(reinterpret_cast<const Image*>(image.getInternal()), *pColor, rangeCount, pRanges));
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdClearDepthStencilImage (VkCommandBuffer commandBuffer, VkImage image, VkImageLayout, const VkClearDepthStencilValue* pDepthStencil, deUint32 rangeCount, const VkImageSubresourceRange* pRanges)
+{
+	VK_NULL_RECORD(commandBuffer, new ClearImageCommand(reinterpret_cast<const Image*>(image.getInternal()), *pDepthStencil, rangeCount, pRanges));
+}
+
+VKAPI_ATTR void VKAPI_CALL cmdExecuteCommands (VkCommandBuffer commandBuffer, deUint32 commandBufferCount, const VkCommandBuffer* pCommandBuffers)
+{
+	VK_NULL_RECORD(commandBuffer, new ExecuteCommandsCommand(commandBufferCount, pCommandBuffers));
+}
+
 #include "vkNullDriverImpl.inl"
 
 } // extern "C"
@@ -0,0 +1,214 @@
+/*-------------------------------------------------------------------------
+ * Vulkan CTS Framework
+ * --------------------
+ *
+ * Copyright (c) 2015 Google Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and/or associated documentation files (the
+ * "Materials"), to deal in the Materials without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Materials, and to
+ * permit persons to whom the Materials are furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice(s) and this permission notice shall be
+ * included in all copies or substantial portions of the Materials.
+ *
+ * THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+ *
+ *//*!
+ * \file
+ * \brief On-disk cache of compiled program binaries.
+ *//*--------------------------------------------------------------------*/
+
+#include "vkProgramBinaryCache.hpp"
+#include "vkGlslToSpirV.hpp"
+#include "vkSpirVAsm.hpp"
+#include "tcuFormatUtil.hpp"
+#include "deFilePath.hpp"
+#include "deStringUtil.hpp"
+#include "deFile.h"
+#include "deMemory.h"
+#include "deClock.h"
+#include "deInt32.h"
+
+#include <fstream>
+#include <cstdio>
+
+namespace vk
+{
+
+using std::string;
+using std::vector;
+
+namespace
+{
+
+enum
+{
+	//! \note Bump whenever key computation or file layout changes.
+	CACHE_FORMAT_VERSION	= 1
+};
+
+enum
+{
+	SPIRV_MAGIC				= 0x07230203
+};
+
+enum SourceKind
+{
+	SOURCE_KIND_GLSL		= 0,
+	SOURCE_KIND_SPIRV_ASM
+};
+
+string getCacheEntryPath (const string& cacheDir, const de::Sha1& key)
+{
+	return de::FilePath::join(cacheDir, key.toString() + ".spv").getPath();
+}
+
+bool isValidSpirVBinary (const vector<deUint8>& bytes)
+{
+	deUint32 magic = 0;
+
+	if (bytes.size() < sizeof(deUint32) || (bytes.size() % sizeof(deUint32)) != 0)
+		return false;
+
+	deMemcpy(&magic, &bytes[0], sizeof(magic));
+
+	return magic == (deUint32)SPIRV_MAGIC;
+}
+
+} // anonymous
+
+de::Sha1 getProgramCacheKey (const glu::ProgramSources& source, ProgramFormat format)
+{
+	de::Sha1Stream stream;
+
+	stream << (deUint32)CACHE_FORMAT_VERSION
+		   << (deUint32)SOURCE_KIND_GLSL
+		   << getGlslToSpirVCompilerId()
+		   << (deUint32)format;
+
+	for (int shaderType = 0; shaderType < glu::SHADERTYPE_LAST; shaderType++)
+		stream << source.sources[shaderType];
+
+	stream << (deUint64)source.attribLocationBindings.size();
+
+	for (size_t ndx = 0; ndx < source.attribLocationBindings.size(); ndx++)
+		stream << source.attribLocationBindings[ndx].name << source.attribLocationBindings[ndx].location;
+
+	stream << source.transformFeedbackBufferMode
+		   << source.transformFeedbackVaryings
+		   << source.separable;
+
+	return stream.finalize();
+}
+
+de::Sha1 getProgramCacheKey (const SpirVAsmSource& source)
+{
+	de::Sha1Stream stream;
+
+	stream << (deUint32)CACHE_FORMAT_VERSION
+		   << (deUint32)SOURCE_KIND_SPIRV_ASM
+		   << getSpirVAssemblerId()
+		   << source.program.str();
+
+	return stream.finalize();
+}
+
+// ProgramBinaryCache
+
+ProgramBinaryCache::ProgramBinaryCache (const std::string& cacheDir)
+	: m_cacheDir	(cacheDir)
+	, m_rnd			(deInt32Hash((deInt32)deGetMicroseconds()) ^ deInt32Hash((deInt32)(deUintptr)this))
+{
+}
+
+ProgramBinaryCache::~ProgramBinaryCache (void)
+{
+}
+
+ProgramBinary* ProgramBinaryCache::loadProgram (const de::Sha1& key) const
+{
+	const string	path	= getCacheEntryPath(m_cacheDir, key);
+	std::ifstream	in		(path.c_str(), std::ios_base::binary);
+	vector<deUint8>	bytes;
+
+	if (!in.is_open())
+		return DE_NULL;
+
+	in.seekg(0, std::ios_base::end);
+
+	{
+		const std::streamoff size = in.tellg();
+
+		if (size <= 0)
+			return DE_NULL;
+
+		bytes.resize((size_t)size);
+	}
+
+	in.seekg(0, std::ios_base::beg);
+	in.read((char*)&bytes[0], (std::streamsize)bytes.size());
+
+	// \note Corrupted entries are treated as misses and simply overwritten by storeProgram().
+	if (in.fail() || !isValidSpirVBinary(bytes))
+		return DE_NULL;
+
+	return new ProgramBinary(PROGRAM_FORMAT_SPIRV, bytes.size(), &bytes[0]);
+}
+
+bool ProgramBinaryCache::storeProgram (const de::Sha1& key, const ProgramBinary& binary)
+{
+	const string	path	= getCacheEntryPath(m_cacheDir, key);
+	const string	tmpPath	= path + "." + de::toString(tcu::toHex(m_rnd.getUint32())) + ".tmp";
+
+	if (binary.getFormat() != PROGRAM_FORMAT_SPIRV || binary.getSize() == 0)
+		return false;
+
+	try
+	{
+		if (!de::FilePath(m_cacheDir).exists())
+			de::createDirectoryAndParents(m_cacheDir.c_str());
+	}
+	catch (const std::exception&)
+	{
+		// Another process may have created it concurrently
+		if (!de::FilePath(m_cacheDir).exists())
+			return false;
+	}
+
+	{
+		std::ofstream out (tmpPath.c_str(), std::ios_base::binary|std::ios_base::trunc);
+
+		if (!out.is_open())
+			return false;
+
+		out.write((const char*)binary.getBinary(), (std::streamsize)binary.getSize());
+		out.close();
+
+		if (out.fail())
+		{
+			deDeleteFile(tmpPath.c_str());
+			return false;
+		}
+	}
+
+	// \note Rename is atomic on POSIX. On Windows it fails if another process stored the same entry first, which is fine.
+	if (std::rename(tmpPath.c_str(), path.c_str()) != 0)
+	{
+		deDeleteFile(tmpPath.c_str());
+		return de::FilePath(path).exists();
+	}
+
+	return true;
+}
+
+} // vk
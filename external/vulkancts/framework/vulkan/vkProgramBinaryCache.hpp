@@ -0,0 +1,81 @@
+#ifndef _VKPROGRAMBINARYCACHE_HPP
+#define _VKPROGRAMBINARYCACHE_HPP
+/*-------------------------------------------------------------------------
+ * Vulkan CTS Framework
+ * --------------------
+ *
+ * Copyright (c) 2015 Google Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and/or associated documentation files (the
+ * "Materials"), to deal in the Materials without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Materials, and to
+ * permit persons to whom the Materials are furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice(s) and this permission notice shall be
+ * included in all copies or substantial portions of the Materials.
+ *
+ * THE MATERIALS ARE PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * MATERIALS OR THE USE OR OTHER DEALINGS IN THE MATERIALS.
+ *
+ *//*!
+ * \file
+ * \brief On-disk cache of compiled program binaries.
+ *
+ * Binaries are stored as <cache dir>/<key>.spv where key is SHA-1 of the
+ * program sources, build options and compiler identifier. Since the key
+ * covers everything that affects the output, entries never need to be
+ * invalidated and the same directory can be shared by several builds.
+ *
+ * Entries are written to a temporary file first and then renamed into
+ * place, so concurrent processes sharing the cache never observe partially
+ * written binaries.
+ *//*--------------------------------------------------------------------*/
+
+#include "vkDefs.hpp"
+#include "vkPrograms.hpp"
+#include "gluShaderProgram.hpp"
+#include "deSha1.hpp"
+#include "deRandom.hpp"
+
+#include <string>
+
+namespace vk
+{
+
+//! Compute cache key for GLSL program compiled with buildProgram().
+de::Sha1			getProgramCacheKey		(const glu::ProgramSources& source, ProgramFormat format);
+
+//! Compute cache key for SPIR-V assembly program assembled with assembleProgram().
+de::Sha1			getProgramCacheKey		(const SpirVAsmSource& source);
+
+class ProgramBinaryCache
+{
+public:
+						ProgramBinaryCache		(const std::string& cacheDir);
+						~ProgramBinaryCache		(void);
+
+	//! Load cached binary, or return DE_NULL if binary is not in cache.
+	ProgramBinary*		loadProgram				(const de::Sha1& key) const;
+
+	//! Store binary to cache. Failures are not fatal; returns false if binary couldn't be stored.
+	bool				storeProgram			(const de::Sha1& key, const ProgramBinary& binary);
+
+private:
+						ProgramBinaryCache		(const ProgramBinaryCache&);
+	ProgramBinaryCache&	operator=				(const ProgramBinaryCache&);
+
+	const std::string	m_cacheDir;
+	de::Random			m_rnd;					//!< Used for temporary file names
+};
+
+} // vk
+
+#endif // _VKPROGRAMBINARYCACHE_HPP
@@ -49,10 +49,33 @@ using tcu::TestLog;
 
 ProgramBinary::ProgramBinary (ProgramFormat format, size_t binarySize, const deUint8* binary)
 	: m_format	(format)
-	, m_binary	(binary, binary+binarySize)
+	, m_storage	(binary, binary+binarySize)
+	, m_size	(binarySize)
+	, m_data	(m_storage.empty() ? DE_NULL : &m_storage[0])
 {
 }
 
+ProgramBinary::ProgramBinary (const ProgramBinary& other)
+	: m_format	(other.m_format)
+	, m_storage	(other.m_data, other.m_data+other.m_size)
+	, m_size	(other.m_size)
+	, m_data	(m_storage.empty() ? DE_NULL : &m_storage[0])
+{
+}
+
+ProgramBinary::ProgramBinary (ProgramFormat format, size_t binarySize, const deUint8* binary, bool copyData)
+	: m_format	(format)
+	, m_storage	(copyData ? binary : DE_NULL, copyData ? binary+binarySize : DE_NULL)
+	, m_size	(binarySize)
+	, m_data	(copyData ? (m_storage.empty() ? DE_NULL : &m_storage[0]) : (binarySize > 0 ? binary : DE_NULL))
+{
+}
+
+ProgramBinary* ProgramBinary::createView (ProgramFormat format, size_t binarySize, const deUint8* binary)
+{
+	return new ProgramBinary(format, binarySize, binary, false);
+}
+
 // Utils
 
 ProgramBinary* buildProgram (const glu::ProgramSources& program, ProgramFormat binaryFormat, glu::ShaderProgramInfo* buildInfo)
@@ -59,14 +59,23 @@ class ProgramBinary
 {
 public:
 								ProgramBinary	(ProgramFormat format, size_t binarySize, const deUint8* binary);
+								ProgramBinary	(const ProgramBinary& other);
 
-	ProgramFormat				getFormat		(void) const { return m_format;										}
-	size_t						getSize			(void) const { return m_binary.size();								}
-	const deUint8*				getBinary		(void) const { return m_binary.empty() ? DE_NULL : &m_binary[0];	}
+	//! Create binary that references data owned by someone else. Data must outlive the binary.
+	static ProgramBinary*		createView		(ProgramFormat format, size_t binarySize, const deUint8* binary);
+
+	ProgramFormat				getFormat		(void) const { return m_format;		}
+	size_t						getSize			(void) const { return m_size;		}
+	const deUint8*				getBinary		(void) const { return m_data;		}
 
 private:
+								ProgramBinary	(ProgramFormat format, size_t binarySize, const deUint8* binary, bool copyData);
+	ProgramBinary&				operator=		(const ProgramBinary& other);
+
 	const ProgramFormat			m_format;
-	const std::vector<deUint8>	m_binary;
+	const std::vector<deUint8>	m_storage;		//!< Copy of data, empty for views
+	const size_t				m_size;
+	const deUint8* const		m_data;
 };
 
 template<typename Program>
@@ -77,6 +86,7 @@ public:
 								~ProgramCollection	(void);
 
 	void						clear				(void);
+	void						swap				(ProgramCollection& other);
 
 	Program&					add					(const std::string& name);
 	void						add					(const std::string& name, de::MovePtr<Program>& program);
@@ -134,6 +144,12 @@ void ProgramCollection<Program>::clear (void)
 	m_programs.clear();
 }
 
+template<typename Program>
+void ProgramCollection<Program>::swap (ProgramCollection& other)
+{
+	m_programs.swap(other.m_programs);
+}
+
 template<typename Program>
 Program& ProgramCollection<Program>::add (const std::string& name)
 {
@@ -33,6 +33,7 @@
 #include "deArrayUtil.hpp"
 #include "deMemory.h"
 #include "deClock.h"
+#include "deStringUtil.hpp"
 #include "qpDebugOut.h"
 
 #if defined(DEQP_HAVE_SPIRV_TOOLS)
@@ -49,6 +50,11 @@ using std::vector;
 
 #if defined(DEQP_HAVE_SPIRV_TOOLS)
 
+enum
+{
+	//! \note spirv-tools doesn't expose its version. Bump whenever spirv-tools revision in external/fetch_sources.py changes.
+	SPIRV_TOOLS_VERSION	= 1
+};
 
 void assembleSpirV (const SpirVAsmSource* program, std::vector<deUint8>* dst, SpirVProgramInfo* buildInfo)
 {
@@ -82,6 +88,11 @@ void assembleSpirV (const SpirVAsmSource* program, std::vector<deUint8>* dst, Sp
 	return;
 }
 
+std::string getSpirVAssemblerId (void)
+{
+	return "spirv-tools " + de::toString((int)SPIRV_TOOLS_VERSION);
+}
+
 #else // defined(DEQP_HAVE_SPIRV_TOOLS)
 
 void assembleSpirV (const SpirVAsmSource*, std::vector<deUint8>*, SpirVProgramInfo*)
@@ -89,6 +100,11 @@ void assembleSpirV (const SpirVAsmSource*, std::vector<deUint8>*, SpirVProgramIn
 	TCU_THROW(NotSupportedError, "SPIR-V assembly not supported (DEQP_HAVE_SPIRV_TOOLS not defined)");
 }
 
+std::string getSpirVAssemblerId (void)
+{
+	return "none";
+}
+
 #endif
 
 } // vk
@@ -33,12 +33,17 @@
 #include "vkDefs.hpp"
 #include "vkPrograms.hpp"
 
+#include <string>
+
 namespace vk
 {
 
 //! Assemble SPIR-V program. Will fail with NotSupportedError if compiler is not available.
 void assembleSpirV (const SpirVAsmSource* program, std::vector<deUint8>* dst, SpirVProgramInfo* buildInfo);
 
+//! Get identifier of assembler used by assembleSpirV(). Identifier changes whenever output may change.
+std::string getSpirVAssemblerId (void);
+
 } // vk
 
 #endif // _VKSPIRVASM_HPP
@@ -477,6 +477,27 @@ def writeFuncPtrInterfaceImpl (api, filename, functionTypes, className):
 
 	writeInlFile(filename, INL_HEADER, makeFuncPtrInterfaceImpl())
 
+def writeCallStatsWrapperImpl (api, filename, functionTypes, className, namesTableName):
+	def makeCallStatsWrapperImpl ():
+		functions = [f for f in api.functions if f.getType() in functionTypes]
+
+		yield ""
+		yield "static const char* const %s[] =" % namesTableName
+		yield "{"
+		for function in functions:
+			yield "\t\"%s\"," % function.name
+		yield "};"
+
+		for ndx, function in enumerate(functions):
+			yield ""
+			yield "%s %s::%s (%s) const" % (function.returnType, className, getInterfaceName(function), argListToStr(function.arguments))
+			yield "{"
+			yield "	const CallTimer	timer	(m_stats, %d);" % ndx
+			yield "	%sm_vk.%s(%s);" % ("return " if function.returnType != "void" else "", getInterfaceName(function), ", ".join(a.name for a in function.arguments))
+			yield "}"
+
+	writeInlFile(filename, INL_HEADER, makeCallStatsWrapperImpl())
+
 def writeStrUtilProto (api, filename):
 	def makeStrUtilProto ():
 		for line in indentLines(["const char*\tget%sName\t(%s value);" % (enum.name[2:], enum.name) for enum in api.enums]):
@@ -658,7 +679,24 @@ def writeNullDriverImpl (api, filename):
 				"vkFreeDescriptorSets",
 				"vkResetDescriptorPool",
 				"vkAllocateCommandBuffers",
-				"vkFreeCommandBuffers"
+				"vkFreeCommandBuffers",
+				"vkBindBufferMemory",
+				"vkBindImageMemory",
+				"vkGetImageSubresourceLayout",
+				"vkQueueSubmit",
+				"vkBeginCommandBuffer",
+				"vkEndCommandBuffer",
+				"vkResetCommandBuffer",
+				"vkCmdCopyBuffer",
+				"vkCmdCopyImage",
+				"vkCmdBlitImage",
+				"vkCmdCopyBufferToImage",
+				"vkCmdCopyImageToBuffer",
+				"vkCmdUpdateBuffer",
+				"vkCmdFillBuffer",
+				"vkCmdClearColorImage",
+				"vkCmdClearDepthStencilImage",
+				"vkCmdExecuteCommands"
 			]
 		specialFuncs		= [f for f in api.functions if f.name in specialFuncNames]
 		createFuncs			= [f for f in api.functions if (f.name[:8] == "vkCreate" or f.name == "vkAllocateMemory") and not f in specialFuncs]
@@ -811,6 +849,8 @@ if __name__ == "__main__":
 	writeFuncPtrInterfaceImpl	(api, os.path.join(VULKAN_DIR, "vkPlatformDriverImpl.inl"),				functionTypes = platformFuncs,	className = "PlatformDriver")
 	writeFuncPtrInterfaceImpl	(api, os.path.join(VULKAN_DIR, "vkInstanceDriverImpl.inl"),				functionTypes = instanceFuncs,	className = "InstanceDriver")
 	writeFuncPtrInterfaceImpl	(api, os.path.join(VULKAN_DIR, "vkDeviceDriverImpl.inl"),				functionTypes = deviceFuncs,	className = "DeviceDriver")
+	writeCallStatsWrapperImpl	(api, os.path.join(VULKAN_DIR, "vkInstanceCallStatsWrapperImpl.inl"),	functionTypes = instanceFuncs,	className = "InstanceCallStatsWrapper",	namesTableName = "s_instanceFunctionNames")
+	writeCallStatsWrapperImpl	(api, os.path.join(VULKAN_DIR, "vkDeviceCallStatsWrapperImpl.inl"),		functionTypes = deviceFuncs,	className = "DeviceCallStatsWrapper",	namesTableName = "s_deviceFunctionNames")
 	writeStrUtilProto			(api, os.path.join(VULKAN_DIR, "vkStrUtil.inl"))
 	writeStrUtilImpl			(api, os.path.join(VULKAN_DIR, "vkStrUtilImpl.inl"))
 	writeRefUtilProto			(api, os.path.join(VULKAN_DIR, "vkRefUtil.inl"))
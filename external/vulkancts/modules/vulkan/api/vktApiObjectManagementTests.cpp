@@ -41,6 +41,7 @@
 #include "vkPlatform.hpp"
 #include "vkStrUtil.hpp"
 #include "vkAllocationCallbackUtil.hpp"
+#include "vkCallStatsWrapper.hpp"
 
 #include "tcuVector.hpp"
 #include "tcuResultCollector.hpp"
@@ -53,6 +54,8 @@
 #include "deSpinBarrier.hpp"
 #include "deThread.hpp"
 #include "deInt32.h"
+#include "deClock.h"
+#include "deStringUtil.hpp"
 
 namespace vkt
 {
@@ -1977,6 +1980,61 @@ tcu::TestStatus createMaxConcurrentTest (Context& context, typename Object::Para
 	return tcu::TestStatus::pass("Ok");
 }
 
+template<typename Object>
+tcu::TestStatus createDestroyThroughputTest (Context& context, typename Object::Parameters params)
+{
+	// \note Objects are created and destroyed in small batches until the time budget is spent,
+	//		 so that slow objects (instances, devices) don't stall the run on real drivers.
+	enum
+	{
+		BATCH_SIZE		= 4,
+		MIN_DURATION_US	= 500000
+	};
+
+	typedef Move<typename Object::Type>	ObjectMove;
+
+	TestLog&							log				= context.getTestContext().getLog();
+	const Environment					env				(context, (deUint32)BATCH_SIZE);
+	const typename Object::Resources	res				(env, params);
+	ObjectMove							objects			[BATCH_SIZE];
+	deUint64							numObjects		= 0;
+	deUint64							createTimeUs	= 0;
+	deUint64							destroyTimeUs	= 0;
+
+	while (createTimeUs + destroyTimeUs < (deUint64)MIN_DURATION_US)
+	{
+		const deUint64	createStart		= deGetMicroseconds();
+
+		for (int ndx = 0; ndx < BATCH_SIZE; ndx++)
+			objects[ndx] = Object::create(env, res, params);
+
+		{
+			const deUint64	destroyStart	= deGetMicroseconds();
+
+			for (int ndx = 0; ndx < BATCH_SIZE; ndx++)
+				objects[ndx] = ObjectMove();
+
+			createTimeUs	+= destroyStart - createStart;
+			destroyTimeUs	+= deGetMicroseconds() - destroyStart;
+		}
+
+		numObjects += BATCH_SIZE;
+	}
+
+	{
+		const float	createTimeAvgUs		= (float)createTimeUs / (float)numObjects;
+		const float	destroyTimeAvgUs	= (float)destroyTimeUs / (float)numObjects;
+		const float	objectsPerSecond	= (float)numObjects * 1000000.0f / (float)(createTimeUs + destroyTimeUs);
+
+		log << TestLog::Integer("NumObjects", "Number of " + string(getTypeName<typename Object::Type>()) + "s created and destroyed", "", QP_KEY_TAG_NONE, (deInt64)numObjects)
+			<< TestLog::Float("CreateTime", "Average create time", "us", QP_KEY_TAG_TIME, createTimeAvgUs)
+			<< TestLog::Float("DestroyTime", "Average destroy time", "us", QP_KEY_TAG_TIME, destroyTimeAvgUs)
+			<< TestLog::Float("Throughput", "Objects created and destroyed per second", "1/s", QP_KEY_TAG_PERFORMANCE, objectsPerSecond);
+
+		return tcu::TestStatus::pass(de::floatToString(objectsPerSecond, 1));
+	}
+}
+
 template<typename Object>
 class CreateThread : public ThreadGroupThread
 {
@@ -2114,10 +2172,12 @@ tcu::TestStatus createSingleAllocCallbacksTest (Context& context, typename Objec
 		const EnvClone						resEnv		(rootEnv, getDefaulDeviceParameters(context), 1u);
 		const typename Object::Resources	res			(resEnv.env, params);
 
-		// Supply a separate callback recorder just for object construction
+		// Supply a separate callback recorder just for object construction. Calls are
+		// made through a call stats wrapper so that callbacks are attributed to entry points.
 		AllocationCallbackRecorder			objCallbacks(getSystemAllocator(), 128);
+		const DeviceCallStatsWrapper		objVkd		(resEnv.env.vkd);
 		const Environment					objEnv		(resEnv.env.vkp,
-														 resEnv.env.vkd,
+														 objVkd,
 														 resEnv.env.device,
 														 resEnv.env.queueFamilyIndex,
 														 resEnv.env.programBinaries,
@@ -2132,11 +2192,15 @@ tcu::TestStatus createSingleAllocCallbacksTest (Context& context, typename Objec
 				return tcu::TestStatus::fail("Invalid allocation callback");
 		}
 
+		logAllocationStats(context.getTestContext().getLog(), "ObjectAllocations", "Allocations made by object construction and destruction", objCallbacks.getStats());
+
 		// At this point all allocations made against object callbacks must have been freed
 		if (!validateAndLog(context.getTestContext().getLog(), objCallbacks, 0u))
 			return tcu::TestStatus::fail("Invalid allocation callback");
 	}
 
+	logAllocationStats(context.getTestContext().getLog(), "ResourceAllocations", "Allocations made by instance, device and other resources", resCallbacks.getStats());
+
 	if (!validateAndLog(context.getTestContext().getLog(), resCallbacks, 0u))
 		return tcu::TestStatus::fail("Invalid allocation callback");
 
@@ -2706,6 +2770,37 @@ tcu::TestCaseGroup* createObjectManagementTests (tcu::TestContext& testCtx)
 	};
 	objectMgmtTests->addChild(createGroup(testCtx, "alloc_callback_fail", "Allocation callback failure", s_allocCallbackFailGroup));
 
+	static const CaseDescriptions	s_createDestroyThroughputGroup	=
+	{
+		CASE_DESC(createDestroyThroughputTest	<Instance>,				s_instanceCases),
+		CASE_DESC(createDestroyThroughputTest	<Device>,				s_deviceCases),
+		CASE_DESC(createDestroyThroughputTest	<DeviceMemory>,			s_deviceMemCases),
+		CASE_DESC(createDestroyThroughputTest	<Buffer>,				s_bufferCases),
+		CASE_DESC(createDestroyThroughputTest	<BufferView>,			s_bufferViewCases),
+		CASE_DESC(createDestroyThroughputTest	<Image>,				s_imageCases),
+		CASE_DESC(createDestroyThroughputTest	<ImageView>,			s_imageViewCases),
+		CASE_DESC(createDestroyThroughputTest	<Semaphore>,			s_semaphoreCases),
+		CASE_DESC(createDestroyThroughputTest	<Event>,				s_eventCases),
+		CASE_DESC(createDestroyThroughputTest	<Fence>,				s_fenceCases),
+		CASE_DESC(createDestroyThroughputTest	<QueryPool>,			s_queryPoolCases),
+		CASE_DESC(createDestroyThroughputTest	<ShaderModule>,			s_shaderModuleCases),
+		CASE_DESC(createDestroyThroughputTest	<PipelineCache>,		s_pipelineCacheCases),
+		CASE_DESC(createDestroyThroughputTest	<PipelineLayout>,		s_pipelineLayoutCases),
+		CASE_DESC(createDestroyThroughputTest	<RenderPass>,			s_renderPassCases),
+		CASE_DESC(createDestroyThroughputTest	<GraphicsPipeline>,		s_graphicsPipelineCases),
+		CASE_DESC(createDestroyThroughputTest	<ComputePipeline>,		s_computePipelineCases),
+		CASE_DESC(createDestroyThroughputTest	<DescriptorSetLayout>,	s_descriptorSetLayoutCases),
+		CASE_DESC(createDestroyThroughputTest	<Sampler>,				s_samplerCases),
+		CASE_DESC(createDestroyThroughputTest	<DescriptorPool>,		s_descriptorPoolCases),
+		CASE_DESC(createDestroyThroughputTest	<DescriptorSet>,		s_descriptorSetCases),
+		CASE_DESC(createDestroyThroughputTest	<Framebuffer>,			s_framebufferCases),
+		CASE_DESC(createDestroyThroughputTest	<CommandPool>,			s_commandPoolCases),
+		CASE_DESC(createDestroyThroughputTest	<CommandBuffer>,		s_commandBufferCases),
+	};
+	// \note Benchmarks don't verify anything and take a while, so they are only included on request
+	if (testCtx.getCommandLine().isVKBenchmarksEnabled())
+		objectMgmtTests->addChild(createGroup(testCtx, "create_destroy_throughput", "Object create and destroy throughput benchmark", s_createDestroyThroughputGroup));
+
 	return objectMgmtTests.release();
 }
 
@@ -42,6 +42,7 @@
 #include "deUniquePtr.hpp"
 #include "deStringUtil.hpp"
 #include "deSharedPtr.hpp"
+#include "deMemory.h"
 
 #include "vkMemUtil.hpp"
 #include "vkRef.hpp"
@@ -91,6 +92,454 @@ static void checkSupported (const Context& ctx, glu::ShaderType shaderType)
 		TCU_THROW(NotSupportedError, "Tessellation shader type not supported by device");
 }
 
+// Objects shared between executors
+
+//! Host-visible buffer that stays mapped for its whole lifetime.
+class HostBuffer
+{
+public:
+									HostBuffer		(const Context& ctx, VkBufferUsageFlags usage, VkDeviceSize size);
+
+	VkBuffer						get				(void) const { return *m_buffer;	}
+	Allocation&						getAllocation	(void) const { return *m_alloc;		}
+	VkDeviceSize					getSize			(void) const { return m_size;		}
+
+private:
+	const VkDeviceSize				m_size;
+	const Unique<VkBuffer>			m_buffer;
+	const de::UniquePtr<Allocation>	m_alloc;
+};
+
+static Move<VkBuffer> createHostBuffer (const Context& ctx, VkBufferUsageFlags usage, VkDeviceSize size)
+{
+	const deUint32				queueFamilyIndex	= ctx.getUniversalQueueFamilyIndex();
+	const VkBufferCreateInfo	bufferParams		=
+	{
+		VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,		// VkStructureType		sType;
+		DE_NULL,									// const void*			pNext;
+		0u,											// VkBufferCreateFlags	flags;
+		size,										// VkDeviceSize			size;
+		usage,										// VkBufferUsageFlags	usage;
+		VK_SHARING_MODE_EXCLUSIVE,					// VkSharingMode		sharingMode;
+		1u,											// deUint32				queueFamilyCount;
+		&queueFamilyIndex							// const deUint32*		pQueueFamilyIndices;
+	};
+
+	return createBuffer(ctx.getDeviceInterface(), ctx.getDevice(), &bufferParams);
+}
+
+static de::MovePtr<Allocation> allocateAndBindHostMemory (const Context& ctx, VkBuffer buffer)
+{
+	const DeviceInterface&	vk		= ctx.getDeviceInterface();
+	const VkDevice			device	= ctx.getDevice();
+	de::MovePtr<Allocation>	alloc	= ctx.getDefaultAllocator().allocate(getBufferMemoryRequirements(vk, device, buffer), MemoryRequirement::HostVisible);
+
+	VK_CHECK(vk.bindBufferMemory(device, buffer, alloc->getMemory(), alloc->getOffset()));
+
+	return alloc;
+}
+
+HostBuffer::HostBuffer (const Context& ctx, VkBufferUsageFlags usage, VkDeviceSize size)
+	: m_size	(size)
+	, m_buffer	(createHostBuffer(ctx, usage, size))
+	, m_alloc	(allocateAndBindHostMemory(ctx, *m_buffer))
+{
+}
+
+//! Descriptor set layout, pipeline layout and a single descriptor set.
+class DescriptorObjects
+{
+public:
+										DescriptorObjects		(const Context& ctx, const DescriptorSetLayoutBuilder& layoutBuilder, const DescriptorPoolBuilder& poolBuilder);
+
+	VkDescriptorSet						getDescriptorSet		(void) const { return *m_descriptorSet;		}
+	VkPipelineLayout					getPipelineLayout		(void) const { return *m_pipelineLayout;	}
+
+private:
+	const Unique<VkDescriptorSetLayout>	m_descriptorSetLayout;
+	const Unique<VkPipelineLayout>		m_pipelineLayout;
+	const Unique<VkDescriptorPool>		m_descriptorPool;
+	const Unique<VkDescriptorSet>		m_descriptorSet;
+};
+
+static Move<VkPipelineLayout> createSingleSetPipelineLayout (const DeviceInterface& vk, VkDevice device, VkDescriptorSetLayout descriptorSetLayout)
+{
+	const VkPipelineLayoutCreateInfo pipelineLayoutParams =
+	{
+		VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,		// VkStructureType				sType;
+		DE_NULL,											// const void*					pNext;
+		(VkPipelineLayoutCreateFlags)0,						// VkPipelineLayoutCreateFlags	flags;
+		1u,													// deUint32						descriptorSetCount;
+		&descriptorSetLayout,								// const VkDescriptorSetLayout*	pSetLayouts;
+		0u,													// deUint32						pushConstantRangeCount;
+		DE_NULL												// const VkPushConstantRange*	pPushConstantRanges;
+	};
+
+	return createPipelineLayout(vk, device, &pipelineLayoutParams);
+}
+
+static Move<VkDescriptorSet> allocateSingleDescriptorSet (const DeviceInterface& vk, VkDevice device, VkDescriptorPool descriptorPool, VkDescriptorSetLayout descriptorSetLayout)
+{
+	const VkDescriptorSetAllocateInfo allocInfo =
+	{
+		VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
+		DE_NULL,
+		descriptorPool,
+		1u,
+		&descriptorSetLayout
+	};
+
+	return allocateDescriptorSet(vk, device, &allocInfo);
+}
+
+DescriptorObjects::DescriptorObjects (const Context& ctx, const DescriptorSetLayoutBuilder& layoutBuilder, const DescriptorPoolBuilder& poolBuilder)
+	: m_descriptorSetLayout	(layoutBuilder.build(ctx.getDeviceInterface(), ctx.getDevice()))
+	, m_pipelineLayout		(createSingleSetPipelineLayout(ctx.getDeviceInterface(), ctx.getDevice(), *m_descriptorSetLayout))
+	, m_descriptorPool		(poolBuilder.build(ctx.getDeviceInterface(), ctx.getDevice(), VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT, 1u))
+	, m_descriptorSet		(allocateSingleDescriptorSet(ctx.getDeviceInterface(), ctx.getDevice(), *m_descriptorPool, *m_descriptorSetLayout))
+{
+}
+
+//! Single-sampled color image with view and framebuffer.
+class RenderTarget
+{
+public:
+									RenderTarget		(const Context& ctx, VkRenderPass renderPass, VkFormat format, const tcu::UVec2& size);
+
+	VkImage							getImage			(void) const { return *m_image;			}
+	VkFramebuffer					getFramebuffer		(void) const { return *m_framebuffer;	}
+
+private:
+	Move<VkImage>					m_image;
+	de::MovePtr<Allocation>			m_imageAlloc;
+	Move<VkImageView>				m_imageView;
+	Move<VkFramebuffer>				m_framebuffer;
+};
+
+RenderTarget::RenderTarget (const Context& ctx, VkRenderPass renderPass, VkFormat format, const tcu::UVec2& size)
+{
+	const VkDevice			vkDevice			= ctx.getDevice();
+	const DeviceInterface&	vk					= ctx.getDeviceInterface();
+	const deUint32			queueFamilyIndex	= ctx.getUniversalQueueFamilyIndex();
+
+	// Create color image
+	{
+		const VkImageCreateInfo colorImageParams =
+		{
+			VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,										// VkStructureType			sType;
+			DE_NULL,																	// const void*				pNext;
+			0u,																			// VkImageCreateFlags		flags;
+			VK_IMAGE_TYPE_2D,															// VkImageType				imageType;
+			format,																		// VkFormat					format;
+			{ size.x(), size.y(), 1u },													// VkExtent3D				extent;
+			1u,																			// deUint32					mipLevels;
+			1u,																			// deUint32					arraySize;
+			VK_SAMPLE_COUNT_1_BIT,														// VkSampleCountFlagBits	samples;
+			VK_IMAGE_TILING_OPTIMAL,													// VkImageTiling			tiling;
+			VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT,		// VkImageUsageFlags		usage;
+			VK_SHARING_MODE_EXCLUSIVE,													// VkSharingMode			sharingMode;
+			1u,																			// deUint32					queueFamilyCount;
+			&queueFamilyIndex,															// const deUint32*			pQueueFamilyIndices;
+			VK_IMAGE_LAYOUT_UNDEFINED													// VkImageLayout			initialLayout;
+		};
+
+		m_image			= createImage(vk, vkDevice, &colorImageParams);
+		m_imageAlloc	= ctx.getDefaultAllocator().allocate(getImageMemoryRequirements(vk, vkDevice, *m_image), MemoryRequirement::Any);
+
+		VK_CHECK(vk.bindImageMemory(vkDevice, *m_image, m_imageAlloc->getMemory(), m_imageAlloc->getOffset()));
+	}
+
+	// Create color attachment view
+	{
+		const VkImageViewCreateInfo colorImageViewParams =
+		{
+			VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,			// VkStructureType			sType;
+			DE_NULL,											// const void*				pNext;
+			0u,													// VkImageViewCreateFlags	flags;
+			*m_image,											// VkImage					image;
+			VK_IMAGE_VIEW_TYPE_2D,								// VkImageViewType			viewType;
+			format,												// VkFormat					format;
+			{
+				VK_COMPONENT_SWIZZLE_R,							// VkComponentSwizzle		r;
+				VK_COMPONENT_SWIZZLE_G,							// VkComponentSwizzle		g;
+				VK_COMPONENT_SWIZZLE_B,							// VkComponentSwizzle		b;
+				VK_COMPONENT_SWIZZLE_A							// VkComponentSwizzle		a;
+			},													// VkComponentsMapping		components;
+			{
+				VK_IMAGE_ASPECT_COLOR_BIT,						// VkImageAspectFlags		aspectMask;
+				0u,												// deUint32					baseMipLevel;
+				1u,												// deUint32					mipLevels;
+				0u,												// deUint32					baseArraylayer;
+				1u												// deUint32					layerCount;
+			}													// VkImageSubresourceRange	subresourceRange;
+		};
+
+		m_imageView = createImageView(vk, vkDevice, &colorImageViewParams);
+	}
+
+	// Create framebuffer
+	{
+		const VkFramebufferCreateInfo framebufferParams =
+		{
+			VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO,			// VkStructureType				sType;
+			DE_NULL,											// const void*					pNext;
+			0u,													// VkFramebufferCreateFlags		flags;
+			renderPass,											// VkRenderPass					renderPass;
+			1u,													// deUint32						attachmentCount;
+			&*m_imageView,										// const VkAttachmentBindInfo*	pAttachments;
+			size.x(),											// deUint32						width;
+			size.y(),											// deUint32						height;
+			1u													// deUint32						layers;
+		};
+
+		m_framebuffer = createFramebuffer(vk, vkDevice, &framebufferParams);
+	}
+}
+
+static Move<VkRenderPass> createColorRenderPass (const DeviceInterface& vk, VkDevice device, const std::vector<VkFormat>& colorFormats)
+{
+	std::vector<VkAttachmentDescription>	attachments;
+	std::vector<VkAttachmentReference>		colorAttachmentReferences;
+
+	for (size_t attachmentNdx = 0; attachmentNdx < colorFormats.size(); ++attachmentNdx)
+	{
+		const VkAttachmentDescription colorAttachmentDescription =
+		{
+			0u,													// VkAttachmentDescriptorFlags	flags;
+			colorFormats[attachmentNdx],						// VkFormat						format;
+			VK_SAMPLE_COUNT_1_BIT,								// VkSampleCountFlagBits		samples;
+			VK_ATTACHMENT_LOAD_OP_CLEAR,						// VkAttachmentLoadOp			loadOp;
+			VK_ATTACHMENT_STORE_OP_STORE,						// VkAttachmentStoreOp			storeOp;
+			VK_ATTACHMENT_LOAD_OP_DONT_CARE,					// VkAttachmentLoadOp			stencilLoadOp;
+			VK_ATTACHMENT_STORE_OP_DONT_CARE,					// VkAttachmentStoreOp			stencilStoreOp;
+			VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,			// VkImageLayout				initialLayout;
+			VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL			// VkImageLayout				finalLayout
+		};
+
+		const VkAttachmentReference colorAttachmentReference =
+		{
+			(deUint32)attachmentNdx,							// deUint32			attachment;
+			VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL			// VkImageLayout	layout;
+		};
+
+		attachments.push_back(colorAttachmentDescription);
+		colorAttachmentReferences.push_back(colorAttachmentReference);
+	}
+
+	{
+		const VkSubpassDescription subpassDescription =
+		{
+			0u,													// VkSubpassDescriptionFlags	flags;
+			VK_PIPELINE_BIND_POINT_GRAPHICS,					// VkPipelineBindPoint			pipelineBindPoint;
+			0u,													// deUint32						inputCount;
+			DE_NULL,											// const VkAttachmentReference*	pInputAttachments;
+			(deUint32)colorAttachmentReferences.size(),			// deUint32						colorCount;
+			&colorAttachmentReferences[0],						// const VkAttachmentReference*	pColorAttachments;
+			DE_NULL,											// const VkAttachmentReference*	pResolveAttachments;
+			DE_NULL,											// VkAttachmentReference		depthStencilAttachment;
+			0u,													// deUint32						preserveCount;
+			DE_NULL												// const VkAttachmentReference* pPreserveAttachments;
+		};
+
+		const VkRenderPassCreateInfo renderPassParams =
+		{
+			VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO,			// VkStructureType					sType;
+			DE_NULL,											// const void*						pNext;
+			(VkRenderPassCreateFlags)0,							// VkRenderPassCreateFlags			flags;
+			(deUint32)attachments.size(),						// deUint32							attachmentCount;
+			&attachments[0],									// const VkAttachmentDescription*	pAttachments;
+			1u,													// deUint32							subpassCount;
+			&subpassDescription,								// const VkSubpassDescription*		pSubpasses;
+			0u,													// deUint32							dependencyCount;
+			DE_NULL												// const VkSubpassDependency*		pDependencies;
+		};
+
+		return createRenderPass(vk, device, &renderPassParams);
+	}
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Objects shared by all executors running on the same context
+ *
+ * Every precision and common function case creates its own executor and
+ * executes it once, so setting up render passes, layouts, descriptor
+ * pools and I/O buffers used to dominate the run time. Those don't depend
+ * on the shader itself and are kept here instead. Buffers are grown to the
+ * largest size requested so far and stay mapped.
+ *
+ * Executions are serialized (every execute() waits for its submissions to
+ * complete) so objects can be reused without further synchronization.
+ *//*--------------------------------------------------------------------*/
+class ExecutorObjectCache : public ContextResource
+{
+public:
+	enum BufferSlot
+	{
+		BUFFER_SLOT_INPUT		= 0,
+		BUFFER_SLOT_OUTPUT,
+		BUFFER_SLOT_READBACK,
+		BUFFER_SLOT_VERTEX,		//!< First vertex buffer, binding N uses slot BUFFER_SLOT_VERTEX+N
+
+		BUFFER_SLOT_LAST
+	};
+
+	static ExecutorObjectCache&		get						(const Context& ctx);
+
+									ExecutorObjectCache		(const Context& ctx);
+									~ExecutorObjectCache	(void);
+
+	VkCommandPool					getCommandPool			(void) const { return *m_cmdPool;	}
+	VkFence							getFence				(void) const { return *m_fence;		}
+
+	VkRenderPass					getRenderPass			(const std::vector<VkFormat>& colorFormats);
+	const DescriptorObjects&		getDescriptorObjects	(const std::string& key, const DescriptorSetLayoutBuilder& layoutBuilder, const DescriptorPoolBuilder& poolBuilder);
+	const RenderTarget&				getRenderTarget			(VkRenderPass renderPass, VkFormat format, const tcu::UVec2& size);
+	const HostBuffer&				getBuffer				(int slot, VkBufferUsageFlags usage, VkDeviceSize minSize);
+
+private:
+	typedef std::map<std::vector<VkFormat>, de::SharedPtr<Unique<VkRenderPass> > >	RenderPassMap;
+	typedef std::map<std::string, de::SharedPtr<DescriptorObjects> >				DescriptorObjectsMap;
+	typedef std::map<std::pair<int, VkBufferUsageFlags>, de::SharedPtr<HostBuffer> >	BufferMap;
+
+	const Context&					m_context;
+	const Unique<VkCommandPool>		m_cmdPool;
+	const Unique<VkFence>			m_fence;
+
+	RenderPassMap					m_renderPasses;
+	DescriptorObjectsMap			m_descriptorObjects;
+	de::SharedPtr<RenderTarget>		m_renderTarget;
+	VkRenderPass					m_renderTargetPass;
+	BufferMap						m_buffers;
+};
+
+static Move<VkCommandPool> createResettableCommandPool (const Context& ctx)
+{
+	const VkCommandPoolCreateInfo cmdPoolParams =
+	{
+		VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,											// VkStructureType		sType;
+		DE_NULL,																			// const void*			pNext;
+		VK_COMMAND_POOL_CREATE_TRANSIENT_BIT|VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT,	// VkCmdPoolCreateFlags	flags;
+		ctx.getUniversalQueueFamilyIndex()													// deUint32				queueFamilyIndex;
+	};
+
+	return createCommandPool(ctx.getDeviceInterface(), ctx.getDevice(), &cmdPoolParams);
+}
+
+static Move<VkFence> createUnsignaledFence (const Context& ctx)
+{
+	const VkFenceCreateInfo fenceParams =
+	{
+		VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,	// VkStructureType		sType;
+		DE_NULL,								// const void*			pNext;
+		0u										// VkFenceCreateFlags	flags;
+	};
+
+	return createFence(ctx.getDeviceInterface(), ctx.getDevice(), &fenceParams);
+}
+
+ExecutorObjectCache::ExecutorObjectCache (const Context& ctx)
+	: m_context				(ctx)
+	, m_cmdPool				(createResettableCommandPool(ctx))
+	, m_fence				(createUnsignaledFence(ctx))
+	, m_renderTargetPass	(0)
+{
+}
+
+ExecutorObjectCache::~ExecutorObjectCache (void)
+{
+}
+
+ExecutorObjectCache& ExecutorObjectCache::get (const Context& ctx)
+{
+	static const char* const	s_name		= "shaderexecutor.objects";
+	ContextResource* const		resource	= ctx.getResource(s_name);
+
+	if (resource)
+		return *static_cast<ExecutorObjectCache*>(resource);
+	else
+		return static_cast<ExecutorObjectCache&>(ctx.addResource(s_name, de::MovePtr<ContextResource>(new ExecutorObjectCache(ctx))));
+}
+
+VkRenderPass ExecutorObjectCache::getRenderPass (const std::vector<VkFormat>& colorFormats)
+{
+	const RenderPassMap::const_iterator	pos	= m_renderPasses.find(colorFormats);
+
+	if (pos != m_renderPasses.end())
+		return **pos->second;
+
+	{
+		const de::SharedPtr<Unique<VkRenderPass> >	renderPass	(new Unique<VkRenderPass>(createColorRenderPass(m_context.getDeviceInterface(), m_context.getDevice(), colorFormats)));
+
+		m_renderPasses[colorFormats] = renderPass;
+
+		return **renderPass;
+	}
+}
+
+const DescriptorObjects& ExecutorObjectCache::getDescriptorObjects (const std::string& key, const DescriptorSetLayoutBuilder& layoutBuilder, const DescriptorPoolBuilder& poolBuilder)
+{
+	const DescriptorObjectsMap::const_iterator	pos	= m_descriptorObjects.find(key);
+
+	if (pos != m_descriptorObjects.end())
+		return *pos->second;
+
+	{
+		const de::SharedPtr<DescriptorObjects>	objects	(new DescriptorObjects(m_context, layoutBuilder, poolBuilder));
+
+		m_descriptorObjects[key] = objects;
+
+		return *objects;
+	}
+}
+
+const RenderTarget& ExecutorObjectCache::getRenderTarget (VkRenderPass renderPass, VkFormat format, const tcu::UVec2& size)
+{
+	// \note Only one render target is kept; there is only one user (tessellation executors) with fixed format and size.
+	if (!m_renderTarget || m_renderTargetPass != renderPass)
+	{
+		m_renderTarget.clear();
+		m_renderTarget		= de::SharedPtr<RenderTarget>(new RenderTarget(m_context, renderPass, format, size));
+		m_renderTargetPass	= renderPass;
+	}
+
+	return *m_renderTarget;
+}
+
+const HostBuffer& ExecutorObjectCache::getBuffer (int slot, VkBufferUsageFlags usage, VkDeviceSize minSize)
+{
+	de::SharedPtr<HostBuffer>&	buffer	= m_buffers[std::make_pair(slot, usage)];
+
+	DE_ASSERT(minSize > 0);
+
+	if (!buffer || buffer->getSize() < minSize)
+	{
+		// Grow geometrically to avoid reallocating for every slightly larger request
+		const VkDeviceSize	newSize	= buffer ? de::max(minSize, 2*buffer->getSize()) : minSize;
+
+		buffer.clear();
+		buffer = de::SharedPtr<HostBuffer>(new HostBuffer(m_context, usage, newSize));
+	}
+
+	return *buffer;
+}
+
+//! Use shared descriptor objects if executor has no uniforms, otherwise create new ones.
+static const DescriptorObjects& getExecDescriptorObjects (const Context&						ctx,
+														  const std::string&					key,
+														  bool									isShareable,
+														  const DescriptorSetLayoutBuilder&		layoutBuilder,
+														  const DescriptorPoolBuilder&			poolBuilder,
+														  de::MovePtr<DescriptorObjects>&		ownedObjects)
+{
+	if (isShareable)
+		return ExecutorObjectCache::get(ctx).getDescriptorObjects(key, layoutBuilder, poolBuilder);
+	else
+	{
+		ownedObjects = de::MovePtr<DescriptorObjects>(new DescriptorObjects(ctx, layoutBuilder, poolBuilder));
+		return *ownedObjects;
+	}
+}
+
 static std::string generateEmptyFragmentSource ()
 {
 	std::ostringstream src;
@@ -464,12 +913,10 @@ protected:
 	const FragmentOutputLayout							m_outputLayout;
 private:
 	void												bindAttributes			(const Context&			ctx,
-																				 Allocator&				memAlloc,
 																				 int					numValues,
 																				 const void* const*		inputs);
 
 	void												addAttribute			(const Context&			ctx,
-																				 Allocator&				memAlloc,
 																				 deUint32				bindingLocation,
 																				 VkFormat				format,
 																				 deUint32				sizePerElement,
@@ -480,13 +927,11 @@ private:
 
 	typedef de::SharedPtr<Unique<VkImage> >				VkImageSp;
 	typedef de::SharedPtr<Unique<VkImageView> >			VkImageViewSp;
-	typedef de::SharedPtr<Unique<VkBuffer> >			VkBufferSp;
 	typedef de::SharedPtr<de::UniquePtr<Allocation> >	AllocationSp;
 
 	std::vector<VkVertexInputBindingDescription>		m_vertexBindingDescriptions;
 	std::vector<VkVertexInputAttributeDescription>		m_vertexAttributeDescriptions;
-	std::vector<VkBufferSp>								m_vertexBuffers;
-	std::vector<AllocationSp>							m_vertexBufferAllocs;
+	std::vector<VkBuffer>								m_vertexBuffers;		//!< Owned by ExecutorObjectCache
 };
 
 static FragmentOutputLayout computeFragmentOutputLayout (const std::vector<Symbol>& symbols)
@@ -598,7 +1043,7 @@ static VkFormat getAttributeFormat (const glu::DataType dataType)
 	}
 }
 
-void FragmentOutExecutor::addAttribute (const Context& ctx, Allocator& memAlloc, deUint32 bindingLocation, VkFormat format, deUint32 sizePerElement, deUint32 count, const void* dataPtr)
+void FragmentOutExecutor::addAttribute (const Context& ctx, deUint32 bindingLocation, VkFormat format, deUint32 sizePerElement, deUint32 count, const void* dataPtr)
 {
 	// Add binding specification
 	const deUint32 binding = (deUint32)m_vertexBindingDescriptions.size();
@@ -625,33 +1070,17 @@ void FragmentOutExecutor::addAttribute (const Context& ctx, Allocator& memAlloc,
 	// Upload data to buffer
 	const VkDevice				vkDevice			= ctx.getDevice();
 	const DeviceInterface&		vk					= ctx.getDeviceInterface();
-	const deUint32				queueFamilyIndex	= ctx.getUniversalQueueFamilyIndex();
-
-	const VkDeviceSize inputSize = sizePerElement * count;
-	const VkBufferCreateInfo vertexBufferParams =
-	{
-		VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,		// VkStructureType		sType;
-		DE_NULL,									// const void*			pNext;
-		0u,											// VkBufferCreateFlags	flags;
-		inputSize,									// VkDeviceSize			size;
-		VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,			// VkBufferUsageFlags	usage;
-		VK_SHARING_MODE_EXCLUSIVE,					// VkSharingMode		sharingMode;
-		1u,											// deUint32				queueFamilyCount;
-		&queueFamilyIndex							// const deUint32*		pQueueFamilyIndices;
-	};
-
-	Move<VkBuffer> buffer = createBuffer(vk, vkDevice, &vertexBufferParams);
-	de::MovePtr<Allocation> alloc = memAlloc.allocate(getBufferMemoryRequirements(vk, vkDevice, *buffer), MemoryRequirement::HostVisible);
-	VK_CHECK(vk.bindBufferMemory(vkDevice, *buffer, alloc->getMemory(), alloc->getOffset()));
+	const VkDeviceSize			inputSize			= sizePerElement * count;
+	const HostBuffer&			buffer				= ExecutorObjectCache::get(ctx).getBuffer(ExecutorObjectCache::BUFFER_SLOT_VERTEX + (int)binding, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT, inputSize);
+	Allocation&					alloc				= buffer.getAllocation();
 
-	deMemcpy(alloc->getHostPtr(), dataPtr, (size_t)inputSize);
-	flushMappedMemoryRange(vk, vkDevice, alloc->getMemory(), alloc->getOffset(), inputSize);
+	deMemcpy(alloc.getHostPtr(), dataPtr, (size_t)inputSize);
+	flushMappedMemoryRange(vk, vkDevice, alloc.getMemory(), alloc.getOffset(), inputSize);
 
-	m_vertexBuffers.push_back(de::SharedPtr<Unique<VkBuffer> >(new Unique<VkBuffer>(buffer)));
-	m_vertexBufferAllocs.push_back(de::SharedPtr<de::UniquePtr<Allocation> >(new de::UniquePtr<Allocation>(alloc)));
+	m_vertexBuffers.push_back(buffer.get());
 }
 
-void FragmentOutExecutor::bindAttributes (const Context& ctx, Allocator& memAlloc, int numValues, const void* const* inputs)
+void FragmentOutExecutor::bindAttributes (const Context& ctx, int numValues, const void* const* inputs)
 {
 	// Input attributes
 	for (int inputNdx = 0; inputNdx < (int)m_shaderSpec.inputs.size(); inputNdx++)
@@ -684,7 +1113,7 @@ void FragmentOutExecutor::bindAttributes (const Context& ctx, Allocator& memAllo
 		// add attributes, in case of matrix every column is binded as an attribute
 		for (int attrNdx = 0; attrNdx < numAttrsToAdd; attrNdx++)
 		{
-			addAttribute(ctx, memAlloc, (deUint32)m_vertexBindingDescriptions.size(), format, elementSize * vecSize, numValues, ptr);
+			addAttribute(ctx, (deUint32)m_vertexBindingDescriptions.size(), format, elementSize * vecSize, numValues, ptr);
 		}
 	}
 }
@@ -694,7 +1123,6 @@ void FragmentOutExecutor::clearRenderData (void)
 	m_vertexBindingDescriptions.clear();
 	m_vertexAttributeDescriptions.clear();
 	m_vertexBuffers.clear();
-	m_vertexBufferAllocs.clear();
 }
 
 void FragmentOutExecutor::execute (const Context& ctx, int numValues, const void* const* inputs, void* const* outputs)
@@ -706,6 +1134,8 @@ void FragmentOutExecutor::execute (const Context& ctx, int numValues, const void
 	const VkQueue										queue					= ctx.getUniversalQueue();
 	const deUint32										queueFamilyIndex		= ctx.getUniversalQueueFamilyIndex();
 	Allocator&											memAlloc				= ctx.getDefaultAllocator();
+	ExecutorObjectCache&								cache					= ExecutorObjectCache::get(ctx);
+	const VkFence										fence					= cache.getFence();
 
 	const deUint32										renderSizeX				= de::min(static_cast<deUint32>(DEFAULT_RENDER_WIDTH), (deUint32)numValues);
 	const deUint32										renderSizeY				= ((deUint32)numValues / renderSizeX) + (((deUint32)numValues % renderSizeX != 0) ? 1u : 0u);
@@ -718,30 +1148,25 @@ void FragmentOutExecutor::execute (const Context& ctx, int numValues, const void
 	std::vector<VkImageMemoryBarrier>					colorImagePreRenderBarriers;
 	std::vector<VkImageMemoryBarrier>					colorImagePostRenderBarriers;
 	std::vector<AllocationSp>							colorImageAllocs;
-	std::vector<VkAttachmentDescription>				attachments;
+	std::vector<VkFormat>								colorFormats;
 	std::vector<VkClearValue>							attachmentClearValues;
 	std::vector<VkImageViewSp>							colorImageViews;
 
 	std::vector<VkPipelineColorBlendAttachmentState>	colorBlendAttachmentStates;
-	std::vector<VkAttachmentReference>					colorAttachmentReferences;
 
-	Move<VkRenderPass>									renderPass;
+	VkRenderPass										renderPass				= 0;
 	Move<VkFramebuffer>									framebuffer;
-	Move<VkPipelineLayout>								pipelineLayout;
+	VkPipelineLayout									pipelineLayout			= 0;
 	Move<VkPipeline>									graphicsPipeline;
 
 	Move<VkShaderModule>								vertexShaderModule;
 	Move<VkShaderModule>								geometryShaderModule;
 	Move<VkShaderModule>								fragmentShaderModule;
 
-	Move<VkCommandPool>									cmdPool;
 	Move<VkCommandBuffer>								cmdBuffer;
 
-	Move<VkFence>										fence;
-
-	Move<VkDescriptorPool>								descriptorPool;
-	Move<VkDescriptorSetLayout>							descriptorSetLayout;
-	Move<VkDescriptorSet>								descriptorSet;
+	VkDescriptorSet										descriptorSet			= 0;
+	de::MovePtr<DescriptorObjects>						ownedDescriptorObjects;
 
 	clearRenderData();
 
@@ -749,8 +1174,8 @@ void FragmentOutExecutor::execute (const Context& ctx, int numValues, const void
 	positions = computeVertexPositions(numValues, renderSize.cast<int>());
 
 	// Bind attributes
-	addAttribute(ctx, memAlloc, 0u, VK_FORMAT_R32G32_SFLOAT, sizeof(tcu::Vec2), (deUint32)positions.size(), &positions[0]);
-	bindAttributes(ctx, memAlloc, numValues, inputs);
+	addAttribute(ctx, 0u, VK_FORMAT_R32G32_SFLOAT, sizeof(tcu::Vec2), (deUint32)positions.size(), &positions[0]);
+	bindAttributes(ctx, numValues, inputs);
 
 	// Create color images
 	{
@@ -794,19 +1219,6 @@ void FragmentOutExecutor::execute (const Context& ctx, int numValues, const void
 				VK_IMAGE_LAYOUT_UNDEFINED,													// VkImageLayout				initialLayout;
 			};
 
-			const VkAttachmentDescription colorAttachmentDescription =
-			{
-				0u,																			// VkAttachmentDescriptorFlags	flags;
-				colorFormat,																// VkFormat						format;
-				VK_SAMPLE_COUNT_1_BIT,														// VkSampleCountFlagBits		samples;
-				VK_ATTACHMENT_LOAD_OP_CLEAR,												// VkAttachmentLoadOp			loadOp;
-				VK_ATTACHMENT_STORE_OP_STORE,												// VkAttachmentStoreOp			storeOp;
-				VK_ATTACHMENT_LOAD_OP_DONT_CARE,											// VkAttachmentLoadOp			stencilLoadOp;
-				VK_ATTACHMENT_STORE_OP_DONT_CARE,											// VkAttachmentStoreOp			stencilStoreOp;
-				VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,									// VkImageLayout				initialLayout;
-				VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,									// VkImageLayout				finalLayout;
-			};
-
 			Move<VkImage> colorImage = createImage(vk, vkDevice, &colorImageParams);
 			colorImages.push_back(de::SharedPtr<Unique<VkImage> >(new Unique<VkImage>(colorImage)));
 			attachmentClearValues.push_back(getDefaultClearColor());
@@ -817,15 +1229,8 @@ void FragmentOutExecutor::execute (const Context& ctx, int numValues, const void
 				VK_CHECK(vk.bindImageMemory(vkDevice, colorImages.back().get()->get(), colorImageAlloc->getMemory(), colorImageAlloc->getOffset()));
 				colorImageAllocs.push_back(de::SharedPtr<de::UniquePtr<Allocation> >(new de::UniquePtr<Allocation>(colorImageAlloc)));
 
-				attachments.push_back(colorAttachmentDescription);
+				colorFormats.push_back(colorFormat);
 				colorBlendAttachmentStates.push_back(colorBlendAttachmentState);
-
-				const VkAttachmentReference colorAttachmentReference = {
-					(deUint32) (colorImages.size() - 1),			//	deUint32		attachment;
-					VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL		//	VkImageLayout	layout;
-				};
-
-				colorAttachmentReferences.push_back(colorAttachmentReference);
 			}
 
 			// Create color attachment view
@@ -900,41 +1305,12 @@ void FragmentOutExecutor::execute (const Context& ctx, int numValues, const void
 				};
 				colorImagePostRenderBarriers.push_back(colorImagePostRenderBarrier);
 			}
-		}
-	}
-
-	// Create render pass
-	{
-		const VkSubpassDescription subpassDescription =
-		{
-			0u,													// VkSubpassDescriptionFlags	flags;
-			VK_PIPELINE_BIND_POINT_GRAPHICS,					// VkPipelineBindPoint			pipelineBindPoint;
-			0u,													// deUint32						inputCount;
-			DE_NULL,											// const VkAttachmentReference*	pInputAttachments;
-			(deUint32)colorImages.size(),						// deUint32						colorCount;
-			&colorAttachmentReferences[0],						// const VkAttachmentReference*	colorAttachments;
-			DE_NULL,											// const VkAttachmentReference*	resolveAttachments;
-			DE_NULL,											// VkAttachmentReference		depthStencilAttachment;
-			0u,													// deUint32						preserveCount;
-			DE_NULL												// const VkAttachmentReference*	pPreserveAttachments;
-		};
-
-		const VkRenderPassCreateInfo renderPassParams =
-		{
-			VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO,			// VkStructureType					sType;
-			DE_NULL,											// const void*						pNext;
-			(VkRenderPassCreateFlags)0,							// VkRenderPassCreateFlags			flags;
-			(deUint32)attachments.size(),						// deUint32							attachmentCount;
-			&attachments[0],									// const VkAttachmentDescription*	pAttachments;
-			1u,													// deUint32							subpassCount;
-			&subpassDescription,								// const VkSubpassDescription*		pSubpasses;
-			0u,													// deUint32							dependencyCount;
-			DE_NULL												// const VkSubpassDependency*		pDependencies;
-		};
-
-		renderPass = createRenderPass(vk, vkDevice, &renderPassParams);
+		}
 	}
 
+	// Create render pass
+	renderPass = cache.getRenderPass(colorFormats);
+
 	// Create framebuffer
 	{
 		std::vector<VkImageView> views(colorImageViews.size());
@@ -948,7 +1324,7 @@ void FragmentOutExecutor::execute (const Context& ctx, int numValues, const void
 			VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO,			// VkStructureType				sType;
 			DE_NULL,											// const void*					pNext;
 			0u,													// VkFramebufferCreateFlags		flags;
-			*renderPass,										// VkRenderPass					renderPass;
+			renderPass,											// VkRenderPass					renderPass;
 			(deUint32)views.size(),								// deUint32						attachmentCount;
 			&views[0],											// const VkImageView*			pAttachments;
 			(deUint32)renderSize.x(),							// deUint32						width;
@@ -963,62 +1339,28 @@ void FragmentOutExecutor::execute (const Context& ctx, int numValues, const void
 	{
 		addUniforms(vkDevice, vk, queue, queueFamilyIndex, memAlloc);
 
-		descriptorSetLayout = m_descriptorSetLayoutBuilder.build(vk, vkDevice);
-		if (!m_uniformInfos.empty())
-			descriptorPool = m_descriptorPoolBuilder.build(vk, vkDevice, VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT, 1u);
-		else 
-		{
-			const VkDescriptorPoolSize 			poolSizeCount 	= { vk::VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1 };
-			const VkDescriptorPoolCreateInfo	createInfo 		=
-			{
-				VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
-				DE_NULL,
-				VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT,
-				1u,
-				1u,
-				&poolSizeCount,
-			};
-
-			descriptorPool = createDescriptorPool(vk, vkDevice, &createInfo);
-		}
+		// \note Pool must have at least one descriptor type even if layout is empty
+		DescriptorPoolBuilder		emptyPoolBuilder;
+		emptyPoolBuilder.addType(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
 
-		const VkDescriptorSetAllocateInfo allocInfo =
 		{
-			VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
-			DE_NULL,
-			*descriptorPool,
-			1u,
-			&*descriptorSetLayout
-		};
+			const bool					isShareable			= m_uniformInfos.empty();
+			const DescriptorObjects&	descriptorObjects	= getExecDescriptorObjects(ctx, "fragment", isShareable, m_descriptorSetLayoutBuilder, isShareable ? emptyPoolBuilder : m_descriptorPoolBuilder, ownedDescriptorObjects);
 
-		descriptorSet = allocateDescriptorSet(vk, vkDevice, &allocInfo);
+			descriptorSet	= descriptorObjects.getDescriptorSet();
+			pipelineLayout	= descriptorObjects.getPipelineLayout();
+		}
 
 		// Update descriptors
 		{
 			vk::DescriptorSetUpdateBuilder descriptorSetUpdateBuilder;
 
-			uploadUniforms(descriptorSetUpdateBuilder, *descriptorSet);
+			uploadUniforms(descriptorSetUpdateBuilder, descriptorSet);
 
 			descriptorSetUpdateBuilder.update(vk, vkDevice);
 		}
 	}
 
-	// Create pipeline layout
-	{
-		const VkPipelineLayoutCreateInfo pipelineLayoutParams =
-		{
-			VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,		// VkStructureType				sType;
-			DE_NULL,											// const void*					pNext;
-			(VkPipelineLayoutCreateFlags)0,						// VkPipelineLayoutCreateFlags	flags;
-			1,													// deUint32						descriptorSetCount;
-			&*descriptorSetLayout,								// const VkDescriptorSetLayout*	pSetLayouts;
-			0u,													// deUint32						pushConstantRangeCount;
-			DE_NULL												// const VkPushConstantRange*	pPushConstantRanges;
-		};
-
-		pipelineLayout = createPipelineLayout(vk, vkDevice, &pipelineLayoutParams);
-	}
-
 	// Create shaders
 	{
 		vertexShaderModule		= createShaderModule(vk, vkDevice, ctx.getBinaryCollection().get("vert"), 0);
@@ -1195,8 +1537,8 @@ void FragmentOutExecutor::execute (const Context& ctx, int numValues, const void
 			DE_NULL,											// const VkPipelineDepthStencilStateCreateInfo*		pDepthStencilState;
 			&colorBlendStateParams,								// const VkPipelineColorBlendStateCreateInfo*		pColorBlendState;
 			&dynamicStateInfo,									// const VkPipelineDynamicStateCreateInfo*			pDynamicState;
-			*pipelineLayout,									// VkPipelineLayout									layout;
-			*renderPass,										// VkRenderPass										renderPass;
+			pipelineLayout,										// VkPipelineLayout									layout;
+			renderPass,											// VkRenderPass										renderPass;
 			0u,													// deUint32											subpass;
 			0u,													// VkPipeline										basePipelineHandle;
 			0u													// deInt32											basePipelineIndex;
@@ -1205,26 +1547,13 @@ void FragmentOutExecutor::execute (const Context& ctx, int numValues, const void
 		graphicsPipeline = createGraphicsPipeline(vk, vkDevice, DE_NULL, &graphicsPipelineParams);
 	}
 
-	// Create command pool
-	{
-		const VkCommandPoolCreateInfo cmdPoolParams =
-		{
-			VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,			// VkStructureType		sType;
-			DE_NULL,											// const void*			pNext;
-			VK_COMMAND_POOL_CREATE_TRANSIENT_BIT,				// VkCmdPoolCreateFlags	flags;
-			queueFamilyIndex,									// deUint32				queueFamilyIndex;
-		};
-
-		cmdPool = createCommandPool(vk, vkDevice, &cmdPoolParams);
-	}
-
 	// Create command buffer
 	{
 		const VkCommandBufferAllocateInfo cmdBufferParams =
 		{
 			VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,	// VkStructureType			sType;
 			DE_NULL,										// const void*				pNext;
-			*cmdPool,										// VkCmdPool				cmdPool;
+			cache.getCommandPool(),							// VkCmdPool				cmdPool;
 			VK_COMMAND_BUFFER_LEVEL_PRIMARY,				// VkCmdBufferLevel			level;
 			1												// deUint32					bufferCount;
 		};
@@ -1241,7 +1570,7 @@ void FragmentOutExecutor::execute (const Context& ctx, int numValues, const void
 		{
 			VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,				// VkStructureType		sType;
 			DE_NULL,												// const void*			pNext;
-			*renderPass,											// VkRenderPass			renderPass;
+			renderPass,												// VkRenderPass			renderPass;
 			*framebuffer,											// VkFramebuffer		framebuffer;
 			{ { 0, 0 }, { renderSize.x(), renderSize.y() } },		// VkRect2D				renderArea;
 			(deUint32)attachmentClearValues.size(),					// deUint32				attachmentCount;
@@ -1259,7 +1588,7 @@ void FragmentOutExecutor::execute (const Context& ctx, int numValues, const void
 		vk.cmdBeginRenderPass(*cmdBuffer, &renderPassBeginInfo, VK_SUBPASS_CONTENTS_INLINE);
 
 		vk.cmdBindPipeline(*cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, *graphicsPipeline);
-		vk.cmdBindDescriptorSets(*cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, *pipelineLayout, 0u, 1u, &*descriptorSet, 0u, DE_NULL);
+		vk.cmdBindDescriptorSets(*cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout, 0u, 1u, &descriptorSet, 0u, DE_NULL);
 
 		const deUint32 numberOfVertexAttributes = (deUint32)m_vertexBuffers.size();
 
@@ -1268,7 +1597,7 @@ void FragmentOutExecutor::execute (const Context& ctx, int numValues, const void
 		std::vector<VkBuffer> buffers(numberOfVertexAttributes);
 		for (size_t i = 0; i < numberOfVertexAttributes; i++)
 		{
-			buffers[i] = m_vertexBuffers[i].get()->get();
+			buffers[i] = m_vertexBuffers[i];
 		}
 
 		vk.cmdBindVertexBuffers(*cmdBuffer, 0, numberOfVertexAttributes, &buffers[0], &offsets[0]);
@@ -1283,18 +1612,6 @@ void FragmentOutExecutor::execute (const Context& ctx, int numValues, const void
 		VK_CHECK(vk.endCommandBuffer(*cmdBuffer));
 	}
 
-	// Create fence
-	{
-		const VkFenceCreateInfo fenceParams =
-		{
-			VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,	// VkStructureType		sType;
-			DE_NULL,								// const void*			pNext;
-			0u										// VkFenceCreateFlags	flags;
-		};
-
-		fence = createFence(vk, vkDevice, &fenceParams);
-	}
-
 	// Execute Draw
 	{
 
@@ -1311,43 +1628,24 @@ void FragmentOutExecutor::execute (const Context& ctx, int numValues, const void
 			DE_NULL									// pSignalSemaphores
 		};
 
-		VK_CHECK(vk.resetFences(vkDevice, 1, &fence.get()));
-		VK_CHECK(vk.queueSubmit(queue, 1, &submitInfo, *fence));
-		VK_CHECK(vk.waitForFences(vkDevice, 1, &fence.get(), DE_TRUE, ~(0ull) /* infinity*/));
+		VK_CHECK(vk.resetFences(vkDevice, 1, &fence));
+		VK_CHECK(vk.queueSubmit(queue, 1, &submitInfo, fence));
+		VK_CHECK(vk.waitForFences(vkDevice, 1, &fence, DE_TRUE, ~(0ull) /* infinity*/));
 	}
 
 	// Read back result and output
 	{
 		const VkDeviceSize imageSizeBytes = (VkDeviceSize)(4 * sizeof(deUint32) * renderSize.x() * renderSize.y());
-		const VkBufferCreateInfo readImageBufferParams =
-		{
-			VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,		// VkStructureType		sType;
-			DE_NULL,									// const void*			pNext;
-			0u,											// VkBufferCreateFlags	flags;
-			imageSizeBytes,								// VkDeviceSize			size;
-			VK_BUFFER_USAGE_TRANSFER_DST_BIT,			// VkBufferUsageFlags	usage;
-			VK_SHARING_MODE_EXCLUSIVE,					// VkSharingMode		sharingMode;
-			1u,											// deUint32				queueFamilyCount;
-			&queueFamilyIndex,							// const deUint32*		pQueueFamilyIndices;
-		};
+		const HostBuffer&	readImageBuffer			= cache.getBuffer(ExecutorObjectCache::BUFFER_SLOT_READBACK, VK_BUFFER_USAGE_TRANSFER_DST_BIT, imageSizeBytes);
+		Allocation&			readImageBufferMemory	= readImageBuffer.getAllocation();
 
 		// constants for image copy
 
-		const VkCommandPoolCreateInfo cmdPoolParams =
-		{
-			VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,	// VkStructureType		sType;
-			DE_NULL,									// const void*			pNext;
-			VK_COMMAND_POOL_CREATE_TRANSIENT_BIT,		// VkCmdPoolCreateFlags	flags;
-			queueFamilyIndex							// deUint32				queueFamilyIndex;
-		};
-
-		Move<VkCommandPool>	copyCmdPool = createCommandPool(vk, vkDevice, &cmdPoolParams);
-
 		const VkCommandBufferAllocateInfo cmdBufferParams =
 		{
 			VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,	// VkStructureType			sType;
 			DE_NULL,										// const void*				pNext;
-			*copyCmdPool,									// VkCmdPool				cmdPool;
+			cache.getCommandPool(),							// VkCmdPool				cmdPool;
 			VK_COMMAND_BUFFER_LEVEL_PRIMARY,				// VkCmdBufferLevel			level;
 			1u												// deUint32					bufferCount;
 		};
@@ -1390,10 +1688,6 @@ void FragmentOutExecutor::execute (const Context& ctx, int numValues, const void
 				tcu::TextureLevel			tmpBuf;
 				const tcu::TextureFormat	format = getRenderbufferFormatForOutput(output.varType, false);
 				const tcu::TextureFormat	readFormat (tcu::TextureFormat::RGBA, format.type);
-				const Unique<VkBuffer>		readImageBuffer(createBuffer(vk, vkDevice, &readImageBufferParams));
-				const de::UniquePtr<Allocation> readImageBufferMemory(memAlloc.allocate(getBufferMemoryRequirements(vk, vkDevice, *readImageBuffer), MemoryRequirement::HostVisible));
-
-				VK_CHECK(vk.bindBufferMemory(vkDevice, *readImageBuffer, readImageBufferMemory->getMemory(), readImageBufferMemory->getOffset()));
 
 				// Copy image to buffer
 				{
@@ -1414,29 +1708,20 @@ void FragmentOutExecutor::execute (const Context& ctx, int numValues, const void
 					};
 
 					VK_CHECK(vk.beginCommandBuffer(*copyCmdBuffer, &cmdBufferBeginInfo));
-					vk.cmdCopyImageToBuffer(*copyCmdBuffer, colorImages[outLocation + locNdx].get()->get(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, *readImageBuffer, 1u, &copyParams);
+					vk.cmdCopyImageToBuffer(*copyCmdBuffer, colorImages[outLocation + locNdx].get()->get(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, readImageBuffer.get(), 1u, &copyParams);
 					VK_CHECK(vk.endCommandBuffer(*copyCmdBuffer));
 
-					VK_CHECK(vk.resetFences(vkDevice, 1, &fence.get()));
-					VK_CHECK(vk.queueSubmit(queue, 1, &submitInfo, *fence));
-					VK_CHECK(vk.waitForFences(vkDevice, 1, &fence.get(), true, ~(0ull) /* infinity */));
+					VK_CHECK(vk.resetFences(vkDevice, 1, &fence));
+					VK_CHECK(vk.queueSubmit(queue, 1, &submitInfo, fence));
+					VK_CHECK(vk.waitForFences(vkDevice, 1, &fence, true, ~(0ull) /* infinity */));
 				}
 
-				const VkMappedMemoryRange range =
-				{
-					VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE,	// VkStructureType	sType;
-					DE_NULL,								// const void*		pNext;
-					readImageBufferMemory->getMemory(),		// VkDeviceMemory	mem;
-					0,										// VkDeviceSize		offset;
-					imageSizeBytes,							// VkDeviceSize		size;
-				};
-
-				VK_CHECK(vk.invalidateMappedMemoryRanges(vkDevice, 1u, &range));
+				invalidateMappedMemoryRange(vk, vkDevice, readImageBufferMemory.getMemory(), readImageBufferMemory.getOffset(), imageSizeBytes);
 
 				tmpBuf.setStorage(readFormat, renderSize.x(), renderSize.y());
 
 				const tcu::TextureFormat resultFormat(tcu::TextureFormat::RGBA, format.type);
-				const tcu::ConstPixelBufferAccess resultAccess(resultFormat, renderSize.x(), renderSize.y(), 1, readImageBufferMemory->getHostPtr());
+				const tcu::ConstPixelBufferAccess resultAccess(resultFormat, renderSize.x(), renderSize.y(), 1, readImageBufferMemory.getHostPtr());
 
 				tcu::copy(tmpBuf.getAccess(), resultAccess);
 
@@ -1581,9 +1866,15 @@ protected:
 		OUTPUT_BUFFER_BINDING	= 1,
 	};
 
+	enum
+	{
+		OUTPUT_SENTINEL_BYTE	= 0xcd	//!< Output buffer fill pattern written before every execution
+	};
+
+	//! Get I/O buffers and fill output with sentinel pattern. Called by every execute() before its first submission.
 	void					initBuffers			(const Context& ctx, int numValues);
-	VkBuffer				getInputBuffer		(void) const		{ return *m_inputBuffer;					}
-	VkBuffer				getOutputBuffer		(void) const		{ return *m_outputBuffer;					}
+	VkBuffer				getInputBuffer		(void) const		{ return m_inputBuffer;						}
+	VkBuffer				getOutputBuffer		(void) const		{ return m_outputBuffer;					}
 	deUint32				getInputStride		(void) const		{ return getLayoutStride(m_inputLayout);	}
 	deUint32				getOutputStride		(void) const		{ return getLayoutStride(m_outputLayout);	}
 
@@ -1594,8 +1885,8 @@ protected:
 	static void				generateExecBufferIo(std::ostream& src, const ShaderSpec& spec, const char* invocationNdxName);
 
 protected:
-	Move<VkBuffer>			m_inputBuffer;
-	Move<VkBuffer>			m_outputBuffer;
+	VkBuffer				m_inputBuffer;		//!< Owned by ExecutorObjectCache
+	VkBuffer				m_outputBuffer;		//!< Owned by ExecutorObjectCache
 
 private:
 	struct VarLayout
@@ -1613,15 +1904,19 @@ private:
 	static void				copyToBuffer		(const glu::VarType& varType, const VarLayout& layout, int numValues, const void* srcBasePtr, void* dstBasePtr);
 	static void				copyFromBuffer		(const glu::VarType& varType, const VarLayout& layout, int numValues, const void* srcBasePtr, void* dstBasePtr);
 
-	de::MovePtr<Allocation>	m_inputAlloc;
-	de::MovePtr<Allocation>	m_outputAlloc;
+	Allocation*				m_inputAlloc;
+	Allocation*				m_outputAlloc;
 
 	vector<VarLayout>		m_inputLayout;
 	vector<VarLayout>		m_outputLayout;
 };
 
 BufferIoExecutor::BufferIoExecutor (const ShaderSpec& shaderSpec, glu::ShaderType shaderType)
-	: ShaderExecutor (shaderSpec, shaderType)
+	: ShaderExecutor	(shaderSpec, shaderType)
+	, m_inputBuffer		(0)
+	, m_outputBuffer	(0)
+	, m_inputAlloc		(DE_NULL)
+	, m_outputAlloc		(DE_NULL)
 {
 	computeVarLayout(m_shaderSpec.inputs, &m_inputLayout);
 	computeVarLayout(m_shaderSpec.outputs, &m_outputLayout);
@@ -1856,45 +2151,19 @@ void BufferIoExecutor::initBuffers (const Context& ctx, int numValues)
 	const size_t				inputBufferSize		= numValues * inputStride ? (numValues * inputStride) : 1;
 	const size_t				outputBufferSize	= numValues * outputStride;
 
-	// Upload data to buffer
-	const VkDevice				vkDevice			= ctx.getDevice();
-	const DeviceInterface&		vk					= ctx.getDeviceInterface();
-	const deUint32				queueFamilyIndex	= ctx.getUniversalQueueFamilyIndex();
-	Allocator&					memAlloc			= ctx.getDefaultAllocator();
-
-	const VkBufferCreateInfo inputBufferParams =
-	{
-		VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,		// VkStructureType		sType;
-		DE_NULL,									// const void*			pNext;
-		0u,											// VkBufferCreateFlags	flags;
-		inputBufferSize,							// VkDeviceSize			size;
-		VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,			// VkBufferUsageFlags	usage;
-		VK_SHARING_MODE_EXCLUSIVE,					// VkSharingMode		sharingMode;
-		1u,											// deUint32				queueFamilyCount;
-		&queueFamilyIndex							// const deUint32*		pQueueFamilyIndices;
-	};
-
-	m_inputBuffer = createBuffer(vk, vkDevice, &inputBufferParams);
-	m_inputAlloc = memAlloc.allocate(getBufferMemoryRequirements(vk, vkDevice, *m_inputBuffer), MemoryRequirement::HostVisible);
-
-	VK_CHECK(vk.bindBufferMemory(vkDevice, *m_inputBuffer, m_inputAlloc->getMemory(), m_inputAlloc->getOffset()));
-
-	const VkBufferCreateInfo outputBufferParams =
-	{
-		VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,		// VkStructureType		sType;
-		DE_NULL,									// const void*			pNext;
-		0u,											// VkBufferCreateFlags	flags;
-		outputBufferSize,							// VkDeviceSize			size;
-		VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,			// VkBufferUsageFlags	usage;
-		VK_SHARING_MODE_EXCLUSIVE,					// VkSharingMode		sharingMode;
-		1u,											// deUint32				queueFamilyCount;
-		&queueFamilyIndex							// const deUint32*		pQueueFamilyIndices;
-	};
+	ExecutorObjectCache&		cache				= ExecutorObjectCache::get(ctx);
+	const HostBuffer&			inputBuffer			= cache.getBuffer(ExecutorObjectCache::BUFFER_SLOT_INPUT, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, inputBufferSize);
+	const HostBuffer&			outputBuffer		= cache.getBuffer(ExecutorObjectCache::BUFFER_SLOT_OUTPUT, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, outputBufferSize);
 
-	m_outputBuffer = createBuffer(vk, vkDevice, &outputBufferParams);
-	m_outputAlloc = memAlloc.allocate(getBufferMemoryRequirements(vk, vkDevice, *m_outputBuffer), MemoryRequirement::HostVisible);
+	m_inputBuffer	= inputBuffer.get();
+	m_inputAlloc	= &inputBuffer.getAllocation();
+	m_outputBuffer	= outputBuffer.get();
+	m_outputAlloc	= &outputBuffer.getAllocation();
 
-	VK_CHECK(vk.bindBufferMemory(vkDevice, *m_outputBuffer, m_outputAlloc->getMemory(), m_outputAlloc->getOffset()));
+	// Output buffer is shared between executions. Fill it with a sentinel so that values
+	// the shader fails to write can't pass as results left over from a previous case.
+	deMemset(m_outputAlloc->getHostPtr(), OUTPUT_SENTINEL_BYTE, outputBufferSize);
+	flushMappedMemoryRange(ctx.getDeviceInterface(), ctx.getDevice(), m_outputAlloc->getMemory(), m_outputAlloc->getOffset(), outputBufferSize);
 }
 
 // ComputeShaderExecutor
@@ -1961,40 +2230,24 @@ void ComputeShaderExecutor::execute (const Context& ctx, int numValues, const vo
 	const VkQueue					queue					= ctx.getUniversalQueue();
 	const deUint32					queueFamilyIndex		= ctx.getUniversalQueueFamilyIndex();
 	Allocator&						memAlloc				= ctx.getDefaultAllocator();
+	ExecutorObjectCache&			cache					= ExecutorObjectCache::get(ctx);
+	const VkFence					fence					= cache.getFence();
 
 	Move<VkShaderModule>			computeShaderModule;
 	Move<VkPipeline>				computePipeline;
-	Move<VkPipelineLayout>			pipelineLayout;
-	Move<VkCommandPool>				cmdPool;
-	Move<VkDescriptorPool>			descriptorPool;
-	Move<VkDescriptorSetLayout>		descriptorSetLayout;
-	Move<VkDescriptorSet>			descriptorSet;
-	Move<VkFence>					fence;
+	de::MovePtr<DescriptorObjects>	ownedDescriptorObjects;
 
 	initBuffers(ctx, numValues);
 
 	// Setup input buffer & copy data
 	uploadInputBuffer(ctx, inputs, numValues);
 
-	// Create command pool
-	{
-		const VkCommandPoolCreateInfo cmdPoolParams =
-		{
-			VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,		// VkStructureType		sType;
-			DE_NULL,										// const void*			pNext;
-			VK_COMMAND_POOL_CREATE_TRANSIENT_BIT,			// VkCmdPoolCreateFlags	flags;
-			queueFamilyIndex								// deUint32				queueFamilyIndex;
-		};
-
-		cmdPool = createCommandPool(vk, vkDevice, &cmdPoolParams);
-	}
-
 	// Create command buffer
 	const VkCommandBufferAllocateInfo cmdBufferParams =
 	{
 		VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,	// VkStructureType			sType;
 		DE_NULL,										// const void*				pNext;
-		*cmdPool,										// VkCmdPool				cmdPool;
+		cache.getCommandPool(),							// VkCmdPool				cmdPool;
 		VK_COMMAND_BUFFER_LEVEL_PRIMARY,				// VkCmdBufferLevel			level;
 		1u												// deUint32					bufferCount;
 	};
@@ -2014,35 +2267,9 @@ void ComputeShaderExecutor::execute (const Context& ctx, int numValues, const vo
 
 	addUniforms(vkDevice, vk, queue, queueFamilyIndex, memAlloc);
 
-	descriptorSetLayout = m_descriptorSetLayoutBuilder.build(vk, vkDevice);
-	descriptorPool = m_descriptorPoolBuilder.build(vk, vkDevice, VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT, 1u);
-
-	const VkDescriptorSetAllocateInfo allocInfo =
-	{
-		VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
-		DE_NULL,
-		*descriptorPool,
-		1u,
-		&*descriptorSetLayout
-	};
-
-	descriptorSet = allocateDescriptorSet(vk, vkDevice, &allocInfo);
-
-	// Create pipeline layout
-	{
-		const VkPipelineLayoutCreateInfo pipelineLayoutParams =
-		{
-			VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,		// VkStructureType				sType;
-			DE_NULL,											// const void*					pNext;
-			(VkPipelineLayoutCreateFlags)0,						// VkPipelineLayoutCreateFlags	flags;
-			1u,													// deUint32						CdescriptorSetCount;
-			&*descriptorSetLayout,								// const VkDescriptorSetLayout*	pSetLayouts;
-			0u,													// deUint32						pushConstantRangeCount;
-			DE_NULL												// const VkPushConstantRange*	pPushConstantRanges;
-		};
-
-		pipelineLayout = createPipelineLayout(vk, vkDevice, &pipelineLayoutParams);
-	}
+	const DescriptorObjects&		descriptorObjects		= getExecDescriptorObjects(ctx, "compute", m_uniformInfos.empty(), m_descriptorSetLayoutBuilder, m_descriptorPoolBuilder, ownedDescriptorObjects);
+	const VkDescriptorSet			descriptorSet			= descriptorObjects.getDescriptorSet();
+	const VkPipelineLayout			pipelineLayout			= descriptorObjects.getPipelineLayout();
 
 	// Create shaders
 	{
@@ -2070,7 +2297,7 @@ void ComputeShaderExecutor::execute (const Context& ctx, int numValues, const vo
 			DE_NULL,											// const void*										pNext;
 			(VkPipelineCreateFlags)0,							// VkPipelineCreateFlags							flags;
 			*shaderStageParams,									// VkPipelineShaderStageCreateInfo					cs;
-			*pipelineLayout,									// VkPipelineLayout									layout;
+			pipelineLayout,										// VkPipelineLayout									layout;
 			0u,													// VkPipeline										basePipelineHandle;
 			0u,													// int32_t											basePipelineIndex;
 		};
@@ -2078,17 +2305,6 @@ void ComputeShaderExecutor::execute (const Context& ctx, int numValues, const vo
 		computePipeline = createComputePipeline(vk, vkDevice, DE_NULL, &computePipelineParams);
 	}
 
-	// Create fence
-	{
-		const VkFenceCreateInfo fenceParams =
-		{
-			VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,	// VkStructureType		sType;
-			DE_NULL,								// const void*			pNext;
-			0u										// VkFenceCreateFlags	flags;
-		};
-		fence = createFence(vk, vkDevice, &fenceParams);
-	}
-
 	const int maxValuesPerInvocation	= ctx.getDeviceProperties().limits.maxComputeWorkGroupSize[0];
 	int					curOffset		= 0;
 	const deUint32		inputStride		= getInputStride();
@@ -2105,26 +2321,26 @@ void ComputeShaderExecutor::execute (const Context& ctx, int numValues, const vo
 
 			const VkDescriptorBufferInfo outputDescriptorBufferInfo =
 			{
-				*m_outputBuffer,				// VkBuffer			buffer;
+				m_outputBuffer,					// VkBuffer			buffer;
 				curOffset * outputStride,		// VkDeviceSize		offset;
 				numToExec * outputStride		// VkDeviceSize		range;
 			};
 
-			descriptorSetUpdateBuilder.writeSingle(*descriptorSet, vk::DescriptorSetUpdateBuilder::Location::binding((deUint32)OUTPUT_BUFFER_BINDING), VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, &outputDescriptorBufferInfo);
+			descriptorSetUpdateBuilder.writeSingle(descriptorSet, vk::DescriptorSetUpdateBuilder::Location::binding((deUint32)OUTPUT_BUFFER_BINDING), VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, &outputDescriptorBufferInfo);
 
 			if (inputStride)
 			{
 				const VkDescriptorBufferInfo inputDescriptorBufferInfo =
 				{
-					*m_inputBuffer,					// VkBuffer			buffer;
+					m_inputBuffer,					// VkBuffer			buffer;
 					curOffset * inputStride,		// VkDeviceSize		offset;
 					numToExec * inputStride			// VkDeviceSize		range;
 				};
 
-				descriptorSetUpdateBuilder.writeSingle(*descriptorSet, vk::DescriptorSetUpdateBuilder::Location::binding((deUint32)INPUT_BUFFER_BINDING), VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, &inputDescriptorBufferInfo);
+				descriptorSetUpdateBuilder.writeSingle(descriptorSet, vk::DescriptorSetUpdateBuilder::Location::binding((deUint32)INPUT_BUFFER_BINDING), VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, &inputDescriptorBufferInfo);
 			}
 
-			uploadUniforms(descriptorSetUpdateBuilder, *descriptorSet);
+			uploadUniforms(descriptorSetUpdateBuilder, descriptorSet);
 
 			descriptorSetUpdateBuilder.update(vk, vkDevice);
 		}
@@ -2133,7 +2349,7 @@ void ComputeShaderExecutor::execute (const Context& ctx, int numValues, const vo
 		VK_CHECK(vk.beginCommandBuffer(*cmdBuffer, &cmdBufferBeginInfo));
 		vk.cmdBindPipeline(*cmdBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, *computePipeline);
 
-		vk.cmdBindDescriptorSets(*cmdBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, *pipelineLayout, 0u, 1u, &*descriptorSet, 0u, DE_NULL);
+		vk.cmdBindDescriptorSets(*cmdBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipelineLayout, 0u, 1u, &descriptorSet, 0u, DE_NULL);
 
 		vk.cmdDispatch(*cmdBuffer, numToExec, 1, 1);
 
@@ -2143,7 +2359,7 @@ void ComputeShaderExecutor::execute (const Context& ctx, int numValues, const vo
 
 		// Execute
 		{
-			VK_CHECK(vk.resetFences(vkDevice, 1, &fence.get()));
+			VK_CHECK(vk.resetFences(vkDevice, 1, &fence));
 
 			const VkSubmitInfo submitInfo =
 			{
@@ -2158,8 +2374,8 @@ void ComputeShaderExecutor::execute (const Context& ctx, int numValues, const vo
 				(const VkSemaphore*)DE_NULL,
 			};
 
-			VK_CHECK(vk.queueSubmit(queue, 1, &submitInfo, *fence));
-			VK_CHECK(vk.waitForFences(vkDevice, 1, &fence.get(), true, ~(0ull) /* infinity*/));
+			VK_CHECK(vk.queueSubmit(queue, 1, &submitInfo, fence));
+			VK_CHECK(vk.waitForFences(vkDevice, 1, &fence, true, ~(0ull) /* infinity*/));
 		}
 	}
 
@@ -2206,17 +2422,16 @@ void TessellationExecutor::renderTess (const Context& ctx, deUint32 vertexCount)
 	const VkQueue						queue						= ctx.getUniversalQueue();
 	const deUint32						queueFamilyIndex			= ctx.getUniversalQueueFamilyIndex();
 	Allocator&							memAlloc					= ctx.getDefaultAllocator();
+	ExecutorObjectCache&				cache						= ExecutorObjectCache::get(ctx);
+	const VkFence						fence						= cache.getFence();
 
 	const tcu::UVec2					renderSize					(DEFAULT_RENDER_WIDTH, DEFAULT_RENDER_HEIGHT);
 
-	Move<VkImage>						colorImage;
-	de::MovePtr<Allocation>				colorImageAlloc;
-	VkFormat							colorFormat					= VK_FORMAT_R8G8B8A8_UNORM;
-	Move<VkImageView>					colorImageView;
+	const VkFormat						colorFormat					= VK_FORMAT_R8G8B8A8_UNORM;
+	const VkRenderPass					renderPass					= cache.getRenderPass(std::vector<VkFormat>(1, colorFormat));
+	const VkFramebuffer					framebuffer					= cache.getRenderTarget(renderPass, colorFormat, renderSize).getFramebuffer();
 
-	Move<VkRenderPass>					renderPass;
-	Move<VkFramebuffer>					framebuffer;
-	Move<VkPipelineLayout>				pipelineLayout;
+	VkPipelineLayout					pipelineLayout				= 0;
 	Move<VkPipeline>					graphicsPipeline;
 
 	Move<VkShaderModule>				vertexShaderModule;
@@ -2224,144 +2439,10 @@ void TessellationExecutor::renderTess (const Context& ctx, deUint32 vertexCount)
 	Move<VkShaderModule>				tessEvalShaderModule;
 	Move<VkShaderModule>				fragmentShaderModule;
 
-	Move<VkCommandPool>					cmdPool;
 	Move<VkCommandBuffer>				cmdBuffer;
 
-	Move<VkFence>						fence;
-
-	Move<VkDescriptorPool>				descriptorPool;
-	Move<VkDescriptorSetLayout>			descriptorSetLayout;
-	Move<VkDescriptorSet>				descriptorSet;
-
-	// Create color image
-	{
-		const VkImageCreateInfo colorImageParams =
-		{
-			VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,										// VkStructureType			sType;
-			DE_NULL,																	// const void*				pNext;
-			0u,																			// VkImageCreateFlags		flags;
-			VK_IMAGE_TYPE_2D,															// VkImageType				imageType;
-			colorFormat,																// VkFormat					format;
-			{ renderSize.x(), renderSize.y(), 1u },										// VkExtent3D				extent;
-			1u,																			// deUint32					mipLevels;
-			1u,																			// deUint32					arraySize;
-			VK_SAMPLE_COUNT_1_BIT,														// VkSampleCountFlagBits	samples;
-			VK_IMAGE_TILING_OPTIMAL,													// VkImageTiling			tiling;
-			VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT,		// VkImageUsageFlags		usage;
-			VK_SHARING_MODE_EXCLUSIVE,													// VkSharingMode			sharingMode;
-			1u,																			// deUint32					queueFamilyCount;
-			&queueFamilyIndex,															// const deUint32*			pQueueFamilyIndices;
-			VK_IMAGE_LAYOUT_UNDEFINED													// VkImageLayout			initialLayout;
-		};
-
-		colorImage = createImage(vk, vkDevice, &colorImageParams);
-
-		// Allocate and bind color image memory
-		colorImageAlloc = memAlloc.allocate(getImageMemoryRequirements(vk, vkDevice, *colorImage), MemoryRequirement::Any);
-		VK_CHECK(vk.bindImageMemory(vkDevice, *colorImage, colorImageAlloc->getMemory(), colorImageAlloc->getOffset()));
-	}
-
-	// Create color attachment view
-	{
-		const VkImageViewCreateInfo colorImageViewParams =
-		{
-			VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,			// VkStructureType			sType;
-			DE_NULL,											// const void*				pNext;
-			0u,													// VkImageViewCreateFlags	flags;
-			*colorImage,										// VkImage					image;
-			VK_IMAGE_VIEW_TYPE_2D,								// VkImageViewType			viewType;
-			colorFormat,										// VkFormat					format;
-			{
-				VK_COMPONENT_SWIZZLE_R,							// VkComponentSwizzle		r;
-				VK_COMPONENT_SWIZZLE_G,							// VkComponentSwizzle		g;
-				VK_COMPONENT_SWIZZLE_B,							// VkComponentSwizzle		b;
-				VK_COMPONENT_SWIZZLE_A							// VkComponentSwizzle		a;
-			},													// VkComponentsMapping		components;
-			{
-				VK_IMAGE_ASPECT_COLOR_BIT,						// VkImageAspectFlags		aspectMask;
-				0u,												// deUint32					baseMipLevel;
-				1u,												// deUint32					mipLevels;
-				0u,												// deUint32					baseArraylayer;
-				1u												// deUint32					layerCount;
-			}													// VkImageSubresourceRange	subresourceRange;
-		};
-
-		colorImageView = createImageView(vk, vkDevice, &colorImageViewParams);
-	}
-
-	// Create render pass
-	{
-		const VkAttachmentDescription colorAttachmentDescription =
-		{
-			0u,													// VkAttachmentDescriptorFlags	flags;
-			colorFormat,										// VkFormat						format;
-			VK_SAMPLE_COUNT_1_BIT,								// VkSampleCountFlagBits		samples;
-			VK_ATTACHMENT_LOAD_OP_CLEAR,						// VkAttachmentLoadOp			loadOp;
-			VK_ATTACHMENT_STORE_OP_STORE,						// VkAttachmentStoreOp			storeOp;
-			VK_ATTACHMENT_LOAD_OP_DONT_CARE,					// VkAttachmentLoadOp			stencilLoadOp;
-			VK_ATTACHMENT_STORE_OP_DONT_CARE,					// VkAttachmentStoreOp			stencilStoreOp;
-			VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,			// VkImageLayout				initialLayout;
-			VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL			// VkImageLayout				finalLayout
-		};
-
-		const VkAttachmentDescription attachments[1] =
-		{
-			colorAttachmentDescription
-		};
-
-		const VkAttachmentReference colorAttachmentReference =
-		{
-			0u,													// deUint32			attachment;
-			VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL			// VkImageLayout	layout;
-		};
-
-		const VkSubpassDescription subpassDescription =
-		{
-			0u,													// VkSubpassDescriptionFlags	flags;
-			VK_PIPELINE_BIND_POINT_GRAPHICS,					// VkPipelineBindPoint			pipelineBindPoint;
-			0u,													// deUint32						inputCount;
-			DE_NULL,											// const VkAttachmentReference*	pInputAttachments;
-			1u,													// deUint32						colorCount;
-			&colorAttachmentReference,							// const VkAttachmentReference*	pColorAttachments;
-			DE_NULL,											// const VkAttachmentReference*	pResolveAttachments;
-			DE_NULL,											// VkAttachmentReference		depthStencilAttachment;
-			0u,													// deUint32						preserveCount;
-			DE_NULL												// const VkAttachmentReference* pPreserveAttachments;
-		};
-
-		const VkRenderPassCreateInfo renderPassParams =
-		{
-			VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO,			// VkStructureType					sType;
-			DE_NULL,											// const void*						pNext;
-			0u,													// VkRenderPassCreateFlags			flags;
-			1u,													// deUint32							attachmentCount;
-			attachments,										// const VkAttachmentDescription*	pAttachments;
-			1u,													// deUint32							subpassCount;
-			&subpassDescription,								// const VkSubpassDescription*		pSubpasses;
-			0u,													// deUint32							dependencyCount;
-			DE_NULL												// const VkSubpassDependency*		pDependencies;
-		};
-
-		renderPass = createRenderPass(vk, vkDevice, &renderPassParams);
-	}
-
-	// Create framebuffer
-	{
-		const VkFramebufferCreateInfo framebufferParams =
-		{
-			VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO,			// VkStructureType				sType;
-			DE_NULL,											// const void*					pNext;
-			0u,													// VkFramebufferCreateFlags		flags;
-			*renderPass,										// VkRenderPass					renderPass;
-			1u,													// deUint32						attachmentCount;
-			&*colorImageView,									// const VkAttachmentBindInfo*	pAttachments;
-			(deUint32)renderSize.x(),							// deUint32						width;
-			(deUint32)renderSize.y(),							// deUint32						height;
-			1u													// deUint32						layers;
-		};
-
-		framebuffer = createFramebuffer(vk, vkDevice, &framebufferParams);
-	}
+	VkDescriptorSet						descriptorSet				= 0;
+	de::MovePtr<DescriptorObjects>		ownedDescriptorObjects;
 
 	// Create descriptors
 	{
@@ -2372,30 +2453,23 @@ void TessellationExecutor::renderTess (const Context& ctx, deUint32 vertexCount)
 
 		addUniforms(vkDevice, vk, queue, queueFamilyIndex, memAlloc);
 
-		descriptorSetLayout = m_descriptorSetLayoutBuilder.build(vk, vkDevice);
-		descriptorPool = m_descriptorPoolBuilder.build(vk, vkDevice, VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT, 1u);
+		const DescriptorObjects&	descriptorObjects	= getExecDescriptorObjects(ctx, "tess", m_uniformInfos.empty(), m_descriptorSetLayoutBuilder, m_descriptorPoolBuilder, ownedDescriptorObjects);
+
+		descriptorSet	= descriptorObjects.getDescriptorSet();
+		pipelineLayout	= descriptorObjects.getPipelineLayout();
 
-		const VkDescriptorSetAllocateInfo allocInfo =
-		{
-			VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
-			DE_NULL,
-			*descriptorPool,
-			1u,
-			&*descriptorSetLayout
-		};
 
-		descriptorSet = allocateDescriptorSet(vk, vkDevice, &allocInfo);
 		// Update descriptors
 		{
 			DescriptorSetUpdateBuilder descriptorSetUpdateBuilder;
 			const VkDescriptorBufferInfo outputDescriptorBufferInfo =
 			{
-				*m_outputBuffer,				// VkBuffer			buffer;
+				m_outputBuffer,					// VkBuffer			buffer;
 				0u,								// VkDeviceSize		offset;
 				VK_WHOLE_SIZE					// VkDeviceSize		range;
 			};
 
-			descriptorSetUpdateBuilder.writeSingle(*descriptorSet, vk::DescriptorSetUpdateBuilder::Location::binding((deUint32)OUTPUT_BUFFER_BINDING), VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, &outputDescriptorBufferInfo);
+			descriptorSetUpdateBuilder.writeSingle(descriptorSet, vk::DescriptorSetUpdateBuilder::Location::binding((deUint32)OUTPUT_BUFFER_BINDING), VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, &outputDescriptorBufferInfo);
 
 			VkDescriptorBufferInfo inputDescriptorBufferInfo =
 			{
@@ -2405,33 +2479,17 @@ void TessellationExecutor::renderTess (const Context& ctx, deUint32 vertexCount)
 			};
 			if (inputBufferSize)
 			{
-				inputDescriptorBufferInfo.buffer = *m_inputBuffer;
+				inputDescriptorBufferInfo.buffer = m_inputBuffer;
 
-				descriptorSetUpdateBuilder.writeSingle(*descriptorSet, vk::DescriptorSetUpdateBuilder::Location::binding((deUint32)INPUT_BUFFER_BINDING), VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, &inputDescriptorBufferInfo);
+				descriptorSetUpdateBuilder.writeSingle(descriptorSet, vk::DescriptorSetUpdateBuilder::Location::binding((deUint32)INPUT_BUFFER_BINDING), VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, &inputDescriptorBufferInfo);
 			}
 
-			uploadUniforms(descriptorSetUpdateBuilder, *descriptorSet);
+			uploadUniforms(descriptorSetUpdateBuilder, descriptorSet);
 
 			descriptorSetUpdateBuilder.update(vk, vkDevice);
 		}
 	}
 
-	// Create pipeline layout
-	{
-		const VkPipelineLayoutCreateInfo pipelineLayoutParams =
-		{
-			VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,		// VkStructureType				sType;
-			DE_NULL,											// const void*					pNext;
-			(VkPipelineLayoutCreateFlags)0,						// VkPipelineLayoutCreateFlags	flags;
-			1u,													// deUint32						descriptorSetCount;
-			&*descriptorSetLayout,								// const VkDescriptorSetLayout*	pSetLayouts;
-			0u,													// deUint32						pushConstantRangeCount;
-			DE_NULL												// const VkPushConstantRange*	pPushConstantRanges;
-		};
-
-		pipelineLayout = createPipelineLayout(vk, vkDevice, &pipelineLayoutParams);
-	}
-
 	// Create shader modules
 	{
 		vertexShaderModule		= createShaderModule(vk, vkDevice, ctx.getBinaryCollection().get("vert"), 0);
@@ -2625,8 +2683,8 @@ void TessellationExecutor::renderTess (const Context& ctx, deUint32 vertexCount)
 			DE_NULL,											// const VkPipelineDepthStencilStateCreateInfo*		pDepthStencilState;
 			&colorBlendStateParams,								// const VkPipelineColorBlendStateCreateInfo*		pColorBlendState;
 			&dynamicStateInfo,									// const VkPipelineDynamicStateCreateInfo*			pDynamicState;
-			*pipelineLayout,									// VkPipelineLayout									layout;
-			*renderPass,										// VkRenderPass										renderPass;
+			pipelineLayout,										// VkPipelineLayout									layout;
+			renderPass,											// VkRenderPass										renderPass;
 			0u,													// deUint32											subpass;
 			0u,													// VkPipeline										basePipelineHandle;
 			0u													// deInt32											basePipelineIndex;
@@ -2635,26 +2693,13 @@ void TessellationExecutor::renderTess (const Context& ctx, deUint32 vertexCount)
 		graphicsPipeline = createGraphicsPipeline(vk, vkDevice, DE_NULL, &graphicsPipelineParams);
 	}
 
-	// Create command pool
-	{
-		const VkCommandPoolCreateInfo cmdPoolParams =
-		{
-			VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,		// VkStructureType		sType;
-			DE_NULL,										// const void*			pNext;
-			VK_COMMAND_POOL_CREATE_TRANSIENT_BIT,			// VkCmdPoolCreateFlags	flags;
-			queueFamilyIndex,								// deUint32				queueFamilyIndex;
-		};
-
-		cmdPool = createCommandPool(vk, vkDevice, &cmdPoolParams);
-	}
-
 	// Create command buffer
 	{
 		const VkCommandBufferAllocateInfo cmdBufferParams =
 		{
 			VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,	// VkStructureType			sType;
 			DE_NULL,										// const void*				pNext;
-			*cmdPool,										// VkCmdPool				cmdPool;
+			cache.getCommandPool(),							// VkCmdPool				cmdPool;
 			VK_COMMAND_BUFFER_LEVEL_PRIMARY,				// VkCmdBufferLevel			level;
 			1u												// uint32_t					bufferCount;
 		};
@@ -2676,8 +2721,8 @@ void TessellationExecutor::renderTess (const Context& ctx, deUint32 vertexCount)
 		{
 			VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,				// VkStructureType		sType;
 			DE_NULL,												// const void*			pNext;
-			*renderPass,											// VkRenderPass			renderPass;
-			*framebuffer,											// VkFramebuffer		framebuffer;
+			renderPass,												// VkRenderPass			renderPass;
+			framebuffer,											// VkFramebuffer		framebuffer;
 			{ { 0, 0 }, { renderSize.x(), renderSize.y() } },		// VkRect2D				renderArea;
 			1,														// deUint32				attachmentCount;
 			clearValues												// const VkClearValue*	pClearValues;
@@ -2691,7 +2736,7 @@ void TessellationExecutor::renderTess (const Context& ctx, deUint32 vertexCount)
 
 		vk.cmdBindPipeline(*cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, *graphicsPipeline);
 
-		vk.cmdBindDescriptorSets(*cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, *pipelineLayout, 0u, 1u, &*descriptorSet, 0u, DE_NULL);
+		vk.cmdBindDescriptorSets(*cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout, 0u, 1u, &descriptorSet, 0u, DE_NULL);
 
 		vk.cmdDraw(*cmdBuffer, vertexCount, 1, 0, 0);
 
@@ -2699,20 +2744,9 @@ void TessellationExecutor::renderTess (const Context& ctx, deUint32 vertexCount)
 		VK_CHECK(vk.endCommandBuffer(*cmdBuffer));
 	}
 
-	// Create fence
-	{
-		const VkFenceCreateInfo fenceParams =
-		{
-			VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,	// VkStructureType		sType;
-			DE_NULL,								// const void*			pNext;
-			0u										// VkFenceCreateFlags	flags;
-		};
-		fence = createFence(vk, vkDevice, &fenceParams);
-	}
-
 	// Execute Draw
 	{
-		VK_CHECK(vk.resetFences(vkDevice, 1, &fence.get()));
+		VK_CHECK(vk.resetFences(vkDevice, 1, &fence));
 		const VkSubmitInfo submitInfo =
 		{
 			VK_STRUCTURE_TYPE_SUBMIT_INFO,
@@ -2725,8 +2759,8 @@ void TessellationExecutor::renderTess (const Context& ctx, deUint32 vertexCount)
 			0u,
 			(const VkSemaphore*)0,
 		};
-		VK_CHECK(vk.queueSubmit(queue, 1, &submitInfo, *fence));
-		VK_CHECK(vk.waitForFences(vkDevice, 1, &fence.get(), true, ~(0ull) /* infinity*/));
+		VK_CHECK(vk.queueSubmit(queue, 1, &submitInfo, fence));
+		VK_CHECK(vk.waitForFences(vkDevice, 1, &fence, true, ~(0ull) /* infinity*/));
 	}
 }
 
@@ -164,9 +164,9 @@ static const char* const s_InputOutputBufferTraits =
 	"OpDecorate %f32arr ArrayStride 4\n"
 	"OpMemberDecorate %buf 0 Offset 0\n";
 
-tcu::TestCaseGroup* createOpNopGroup (tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createOpNopGroup (tcu::TestContext& testCtx, const char* name)
 {
-	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, "opnop", "Test the OpNop instruction"));
+	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, name, "Test the OpNop instruction"));
 	ComputeShaderSpec				spec;
 	de::Random						rnd				(deStringHash(group->getName()));
 	const int						numElements		= 100;
@@ -217,9 +217,9 @@ tcu::TestCaseGroup* createOpNopGroup (tcu::TestContext& testCtx)
 	return group.release();
 }
 
-tcu::TestCaseGroup* createOpLineGroup (tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createOpLineGroup (tcu::TestContext& testCtx, const char* name)
 {
-	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, "opline", "Test the OpLine instruction"));
+	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, name, "Test the OpLine instruction"));
 	ComputeShaderSpec				spec;
 	de::Random						rnd				(deStringHash(group->getName()));
 	const int						numElements		= 100;
@@ -281,9 +281,9 @@ tcu::TestCaseGroup* createOpLineGroup (tcu::TestContext& testCtx)
 	return group.release();
 }
 
-tcu::TestCaseGroup* createOpNoLineGroup (tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createOpNoLineGroup (tcu::TestContext& testCtx, const char* name)
 {
-	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, "opnoline", "Test the OpNoLine instruction"));
+	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, name, "Test the OpNoLine instruction"));
 	ComputeShaderSpec				spec;
 	de::Random						rnd				(deStringHash(group->getName()));
 	const int						numElements		= 100;
@@ -368,9 +368,9 @@ bool compareNoContractCase(const std::vector<BufferSp>&, const vector<Allocation
 	return true;
 }
 
-tcu::TestCaseGroup* createNoContractionGroup (tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createNoContractionGroup (tcu::TestContext& testCtx, const char* name)
 {
-	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, "nocontraction", "Test the NoContraction decoration"));
+	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, name, "Test the NoContraction decoration"));
 	vector<CaseParameter>			cases;
 	const int						numElements		= 100;
 	vector<float>					inputFloats1	(numElements, 0);
@@ -480,9 +480,9 @@ bool compareFRem(const std::vector<BufferSp>&, const vector<AllocationSp>& outpu
 	return true;
 }
 
-tcu::TestCaseGroup* createOpFRemGroup (tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createOpFRemGroup (tcu::TestContext& testCtx, const char* name)
 {
-	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, "opfrem", "Test the OpFRem instruction"));
+	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, name, "Test the OpFRem instruction"));
 	ComputeShaderSpec				spec;
 	de::Random						rnd				(deStringHash(group->getName()));
 	const int						numElements		= 200;
@@ -558,9 +558,9 @@ tcu::TestCaseGroup* createOpFRemGroup (tcu::TestContext& testCtx)
 }
 
 // Copy contents in the input buffer to the output buffer.
-tcu::TestCaseGroup* createOpCopyMemoryGroup (tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createOpCopyMemoryGroup (tcu::TestContext& testCtx, const char* name)
 {
-	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, "opcopymemory", "Test the OpCopyMemory instruction"));
+	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, name, "Test the OpCopyMemory instruction"));
 	de::Random						rnd				(deStringHash(group->getName()));
 	const int						numElements		= 100;
 
@@ -766,9 +766,9 @@ tcu::TestCaseGroup* createOpCopyMemoryGroup (tcu::TestContext& testCtx)
 	return group.release();
 }
 
-tcu::TestCaseGroup* createOpCopyObjectGroup (tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createOpCopyObjectGroup (tcu::TestContext& testCtx, const char* name)
 {
-	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, "opcopyobject", "Test the OpCopyObject instruction"));
+	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, name, "Test the OpCopyObject instruction"));
 	ComputeShaderSpec				spec;
 	de::Random						rnd				(deStringHash(group->getName()));
 	const int						numElements		= 100;
@@ -879,9 +879,9 @@ tcu::TestCaseGroup* createOpCopyObjectGroup (tcu::TestContext& testCtx)
 //   }
 // }
 
-tcu::TestCaseGroup* createOpUnreachableGroup (tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createOpUnreachableGroup (tcu::TestContext& testCtx, const char* name)
 {
-	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, "opunreachable", "Test the OpUnreachable instruction"));
+	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, name, "Test the OpUnreachable instruction"));
 	ComputeShaderSpec				spec;
 	de::Random						rnd				(deStringHash(group->getName()));
 	const int						numElements		= 100;
@@ -1018,9 +1018,9 @@ tcu::TestCaseGroup* createOpUnreachableGroup (tcu::TestContext& testCtx)
 //   uint x = gl_GlobalInvocationID.x;
 //   output_data.elements[x] = input_data0.elements[x] + input_data1.elements[x] + input_data2.elements[x] + input_data3.elements[x] + input_data4.elements[x];
 // }
-tcu::TestCaseGroup* createDecorationGroupGroup (tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createDecorationGroupGroup (tcu::TestContext& testCtx, const char* name)
 {
-	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, "decoration_group", "Test the OpDecorationGroup & OpGroupDecorate instruction"));
+	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, name, "Test the OpDecorationGroup & OpGroupDecorate instruction"));
 	ComputeShaderSpec				spec;
 	de::Random						rnd				(deStringHash(group->getName()));
 	const int						numElements		= 100;
@@ -1194,9 +1194,9 @@ struct SpecConstantTwoIntCase
 						, expectedOutput	(output) {}
 };
 
-tcu::TestCaseGroup* createSpecConstantGroup (tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createSpecConstantGroup (tcu::TestContext& testCtx, const char* name)
 {
-	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, "opspecconstantop", "Test the OpSpecConstantOp instruction"));
+	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, name, "Test the OpSpecConstantOp instruction"));
 	vector<SpecConstantTwoIntCase>	cases;
 	de::Random						rnd				(deStringHash(group->getName()));
 	const int						numElements		= 100;
@@ -1381,9 +1381,9 @@ tcu::TestCaseGroup* createSpecConstantGroup (tcu::TestContext& testCtx)
 	return group.release();
 }
 
-tcu::TestCaseGroup* createOpPhiGroup (tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createOpPhiGroup (tcu::TestContext& testCtx, const char* name)
 {
-	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, "opphi", "Test the OpPhi instruction"));
+	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, name, "Test the OpPhi instruction"));
 	ComputeShaderSpec				spec1;
 	ComputeShaderSpec				spec2;
 	ComputeShaderSpec				spec3;
@@ -1587,9 +1587,9 @@ tcu::TestCaseGroup* createOpPhiGroup (tcu::TestContext& testCtx)
 //     output_data.elements[x] = -input_data.elements[x];
 //   }
 // }
-tcu::TestCaseGroup* createBlockOrderGroup (tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createBlockOrderGroup (tcu::TestContext& testCtx, const char* name)
 {
-	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, "block_order", "Test block orders"));
+	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, name, "Test block orders"));
 	ComputeShaderSpec				spec;
 	de::Random						rnd				(deStringHash(group->getName()));
 	const int						numElements		= 100;
@@ -1723,9 +1723,9 @@ tcu::TestCaseGroup* createBlockOrderGroup (tcu::TestContext& testCtx)
 	return group.release();
 }
 
-tcu::TestCaseGroup* createMultipleShaderGroup (tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createMultipleShaderGroup (tcu::TestContext& testCtx, const char* name)
 {
-	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, "multiple_shaders", "Test multiple shaders in the same module"));
+	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, name, "Test multiple shaders in the same module"));
 	ComputeShaderSpec				spec1;
 	ComputeShaderSpec				spec2;
 	de::Random						rnd				(deStringHash(group->getName()));
@@ -1859,9 +1859,9 @@ inline std::string makeLongUTF8String (size_t num4ByteChars)
 	return longString;
 }
 
-tcu::TestCaseGroup* createOpSourceGroup (tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createOpSourceGroup (tcu::TestContext& testCtx, const char* name)
 {
-	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, "opsource", "Tests the OpSource & OpSourceContinued instruction"));
+	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, name, "Tests the OpSource & OpSourceContinued instruction"));
 	vector<CaseParameter>			cases;
 	de::Random						rnd				(deStringHash(group->getName()));
 	const int						numElements		= 100;
@@ -1955,9 +1955,9 @@ tcu::TestCaseGroup* createOpSourceGroup (tcu::TestContext& testCtx)
 	return group.release();
 }
 
-tcu::TestCaseGroup* createOpSourceExtensionGroup (tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createOpSourceExtensionGroup (tcu::TestContext& testCtx, const char* name)
 {
-	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, "opsourceextension", "Tests the OpSource instruction"));
+	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, name, "Tests the OpSource instruction"));
 	vector<CaseParameter>			cases;
 	de::Random						rnd				(deStringHash(group->getName()));
 	const int						numElements		= 100;
@@ -2019,9 +2019,9 @@ tcu::TestCaseGroup* createOpSourceExtensionGroup (tcu::TestContext& testCtx)
 }
 
 // Checks that a compute shader can generate a constant null value of various types, without exercising a computation on it.
-tcu::TestCaseGroup* createOpConstantNullGroup (tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createOpConstantNullGroup (tcu::TestContext& testCtx, const char* name)
 {
-	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, "opconstantnull", "Tests the OpConstantNull instruction"));
+	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, name, "Tests the OpConstantNull instruction"));
 	vector<CaseParameter>			cases;
 	de::Random						rnd				(deStringHash(group->getName()));
 	const int						numElements		= 100;
@@ -2092,9 +2092,9 @@ tcu::TestCaseGroup* createOpConstantNullGroup (tcu::TestContext& testCtx)
 }
 
 // Checks that a compute shader can generate a constant composite value of various types, without exercising a computation on it.
-tcu::TestCaseGroup* createOpConstantCompositeGroup (tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createOpConstantCompositeGroup (tcu::TestContext& testCtx, const char* name)
 {
-	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, "opconstantcomposite", "Tests the OpConstantComposite instruction"));
+	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, name, "Tests the OpConstantComposite instruction"));
 	vector<CaseParameter>			cases;
 	de::Random						rnd				(deStringHash(group->getName()));
 	const int						numElements		= 100;
@@ -2258,9 +2258,9 @@ bool compareNan (const std::vector<BufferSp>&, const vector<AllocationSp>& outpu
 }
 
 // Checks that a compute shader can generate a constant composite value of various types, without exercising a computation on it.
-tcu::TestCaseGroup* createOpQuantizeToF16Group (tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createOpQuantizeToF16Group (tcu::TestContext& testCtx, const char* name)
 {
-	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, "opquantize", "Tests the OpQuantizeToF16 instruction"));
+	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, name, "Tests the OpQuantizeToF16 instruction"));
 
 	const std::string shader (
 		string(s_ShaderPreamble) +
@@ -2459,9 +2459,9 @@ Dest bitwiseCast(Src source)
   return dest;
 }
 
-tcu::TestCaseGroup* createSpecConstantOpQuantizeToF16Group (tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createSpecConstantOpQuantizeToF16Group (tcu::TestContext& testCtx, const char* name)
 {
-	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, "opspecconstantop_opquantize", "Tests the OpQuantizeToF16 opcode for the OpSpecConstantOp instruction"));
+	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, name, "Tests the OpQuantizeToF16 opcode for the OpSpecConstantOp instruction"));
 
 	const std::string shader (
 		string(s_ShaderPreamble) +
@@ -2667,9 +2667,9 @@ tcu::TestCaseGroup* createSpecConstantOpQuantizeToF16Group (tcu::TestContext& te
 }
 
 // Checks that constant null/composite values can be used in computation.
-tcu::TestCaseGroup* createOpConstantUsageGroup (tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createOpConstantUsageGroup (tcu::TestContext& testCtx, const char* name)
 {
-	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, "opconstantnullcomposite", "Spotcheck the OpConstantNull & OpConstantComposite instruction"));
+	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, name, "Spotcheck the OpConstantNull & OpConstantComposite instruction"));
 	ComputeShaderSpec				spec;
 	de::Random						rnd				(deStringHash(group->getName()));
 	const int						numElements		= 100;
@@ -2772,9 +2772,9 @@ tcu::TestCaseGroup* createOpConstantUsageGroup (tcu::TestContext& testCtx)
 //   for (uint i = 0; i < 4; ++i)
 //     output_data.elements[x] += 1.f;
 // }
-tcu::TestCaseGroup* createLoopControlGroup (tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createLoopControlGroup (tcu::TestContext& testCtx, const char* name)
 {
-	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, "loop_control", "Tests loop control cases"));
+	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, name, "Tests loop control cases"));
 	vector<CaseParameter>			cases;
 	de::Random						rnd				(deStringHash(group->getName()));
 	const int						numElements		= 100;
@@ -2874,9 +2874,9 @@ tcu::TestCaseGroup* createLoopControlGroup (tcu::TestContext& testCtx)
 //   else
 //     output_data.elements[x] = val - 1.f;
 // }
-tcu::TestCaseGroup* createSelectionControlGroup (tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createSelectionControlGroup (tcu::TestContext& testCtx, const char* name)
 {
-	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, "selection_control", "Tests selection control cases"));
+	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, name, "Tests selection control cases"));
 	vector<CaseParameter>			cases;
 	de::Random						rnd				(deStringHash(group->getName()));
 	const int						numElements		= 100;
@@ -2965,9 +2965,9 @@ tcu::TestCaseGroup* createSelectionControlGroup (tcu::TestContext& testCtx)
 //   uint x = gl_GlobalInvocationID.x;
 //   output_data.elements[x] = input_data.elements[x] + const10();
 // }
-tcu::TestCaseGroup* createFunctionControlGroup (tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createFunctionControlGroup (tcu::TestContext& testCtx, const char* name)
 {
-	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, "function_control", "Tests function control cases"));
+	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, name, "Tests function control cases"));
 	vector<CaseParameter>			cases;
 	de::Random						rnd				(deStringHash(group->getName()));
 	const int						numElements		= 100;
@@ -3040,9 +3040,9 @@ tcu::TestCaseGroup* createFunctionControlGroup (tcu::TestContext& testCtx)
 	return group.release();
 }
 
-tcu::TestCaseGroup* createMemoryAccessGroup (tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createMemoryAccessGroup (tcu::TestContext& testCtx, const char* name)
 {
-	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, "memory_access", "Tests memory access cases"));
+	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, name, "Tests memory access cases"));
 	vector<CaseParameter>			cases;
 	de::Random						rnd				(deStringHash(group->getName()));
 	const int						numElements		= 100;
@@ -3111,9 +3111,9 @@ tcu::TestCaseGroup* createMemoryAccessGroup (tcu::TestContext& testCtx)
 }
 
 // Checks that we can get undefined values for various types, without exercising a computation with it.
-tcu::TestCaseGroup* createOpUndefGroup (tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createOpUndefGroup (tcu::TestContext& testCtx, const char* name)
 {
-	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, "opundef", "Tests the OpUndef instruction"));
+	de::MovePtr<tcu::TestCaseGroup>	group			(new tcu::TestCaseGroup(testCtx, name, "Tests the OpUndef instruction"));
 	vector<CaseParameter>			cases;
 	de::Random						rnd				(deStringHash(group->getName()));
 	const int						numElements		= 100;
@@ -5382,11 +5382,11 @@ inline void createTestsForAllStages (const std::string& name, const RGBA (&input
 
 } // anonymous
 
-tcu::TestCaseGroup* createOpSourceTests (tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createOpSourceTests (tcu::TestContext& testCtx, const char* name)
 {
 	struct NameCodePair { string name, code; };
 	RGBA							defaultColors[4];
-	de::MovePtr<tcu::TestCaseGroup> opSourceTests			(new tcu::TestCaseGroup(testCtx, "opsource", "OpSource instruction"));
+	de::MovePtr<tcu::TestCaseGroup> opSourceTests			(new tcu::TestCaseGroup(testCtx, name, "OpSource instruction"));
 	const std::string				opsourceGLSLWithFile	= "%opsrcfile = OpString \"foo.vert\"\nOpSource GLSL 450 %opsrcfile ";
 	map<string, string>				fragments				= passthruFragments();
 	const NameCodePair				tests[]					=
@@ -5416,11 +5416,11 @@ tcu::TestCaseGroup* createOpSourceTests (tcu::TestContext& testCtx)
 	return opSourceTests.release();
 }
 
-tcu::TestCaseGroup* createOpSourceContinuedTests (tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createOpSourceContinuedTests (tcu::TestContext& testCtx, const char* name)
 {
 	struct NameCodePair { string name, code; };
 	RGBA								defaultColors[4];
-	de::MovePtr<tcu::TestCaseGroup>		opSourceTests		(new tcu::TestCaseGroup(testCtx, "opsourcecontinued", "OpSourceContinued instruction"));
+	de::MovePtr<tcu::TestCaseGroup>		opSourceTests		(new tcu::TestCaseGroup(testCtx, name, "OpSourceContinued instruction"));
 	map<string, string>					fragments			= passthruFragments();
 	const std::string					opsource			= "%opsrcfile = OpString \"foo.vert\"\nOpSource GLSL 450 %opsrcfile \"void main(){}\"\n";
 	const NameCodePair					tests[]				=
@@ -5445,10 +5445,10 @@ tcu::TestCaseGroup* createOpSourceContinuedTests (tcu::TestContext& testCtx)
 	return opSourceTests.release();
 }
 
-tcu::TestCaseGroup* createOpNoLineTests(tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createOpNoLineTests(tcu::TestContext& testCtx, const char* name)
 {
 	RGBA								 defaultColors[4];
-	de::MovePtr<tcu::TestCaseGroup>		 opLineTests		 (new tcu::TestCaseGroup(testCtx, "opnoline", "OpNoLine instruction"));
+	de::MovePtr<tcu::TestCaseGroup>		 opLineTests		 (new tcu::TestCaseGroup(testCtx, name, "OpNoLine instruction"));
 	map<string, string>					 fragments;
 	getDefaultColors(defaultColors);
 	fragments["debug"]			=
@@ -5501,10 +5501,10 @@ tcu::TestCaseGroup* createOpNoLineTests(tcu::TestContext& testCtx)
 }
 
 
-tcu::TestCaseGroup* createOpLineTests(tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createOpLineTests(tcu::TestContext& testCtx, const char* name)
 {
 	RGBA													defaultColors[4];
-	de::MovePtr<tcu::TestCaseGroup>							opLineTests			(new tcu::TestCaseGroup(testCtx, "opline", "OpLine instruction"));
+	de::MovePtr<tcu::TestCaseGroup>							opLineTests			(new tcu::TestCaseGroup(testCtx, name, "OpLine instruction"));
 	map<string, string>										fragments;
 	std::vector<std::pair<std::string, std::string> >		problemStrings;
 
@@ -5563,9 +5563,9 @@ tcu::TestCaseGroup* createOpLineTests(tcu::TestContext& testCtx)
 	return opLineTests.release();
 }
 
-tcu::TestCaseGroup* createOpConstantNullTests(tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createOpConstantNullTests(tcu::TestContext& testCtx, const char* name)
 {
-	de::MovePtr<tcu::TestCaseGroup> opConstantNullTests		(new tcu::TestCaseGroup(testCtx, "opconstantnull", "OpConstantNull instruction"));
+	de::MovePtr<tcu::TestCaseGroup> opConstantNullTests		(new tcu::TestCaseGroup(testCtx, name, "OpConstantNull instruction"));
 	RGBA							colors[4];
 
 
@@ -5679,9 +5679,9 @@ tcu::TestCaseGroup* createOpConstantNullTests(tcu::TestContext& testCtx)
 	}
 	return opConstantNullTests.release();
 }
-tcu::TestCaseGroup* createOpConstantCompositeTests(tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createOpConstantCompositeTests(tcu::TestContext& testCtx, const char* name)
 {
-	de::MovePtr<tcu::TestCaseGroup> opConstantCompositeTests		(new tcu::TestCaseGroup(testCtx, "opconstantcomposite", "OpConstantComposite instruction"));
+	de::MovePtr<tcu::TestCaseGroup> opConstantCompositeTests		(new tcu::TestCaseGroup(testCtx, name, "OpConstantComposite instruction"));
 	RGBA							inputColors[4];
 	RGBA							outputColors[4];
 
@@ -5822,9 +5822,9 @@ tcu::TestCaseGroup* createOpConstantCompositeTests(tcu::TestContext& testCtx)
 	return opConstantCompositeTests.release();
 }
 
-tcu::TestCaseGroup* createSelectionBlockOrderTests(tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createSelectionBlockOrderTests(tcu::TestContext& testCtx, const char* name)
 {
-	de::MovePtr<tcu::TestCaseGroup> group				(new tcu::TestCaseGroup(testCtx, "selection_block_order", "Out-of-order blocks for selection"));
+	de::MovePtr<tcu::TestCaseGroup> group				(new tcu::TestCaseGroup(testCtx, name, "Out-of-order blocks for selection"));
 	RGBA							inputColors[4];
 	RGBA							outputColors[4];
 	map<string, string>				fragments;
@@ -5903,9 +5903,9 @@ tcu::TestCaseGroup* createSelectionBlockOrderTests(tcu::TestContext& testCtx)
 	return group.release();
 }
 
-tcu::TestCaseGroup* createSwitchBlockOrderTests(tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createSwitchBlockOrderTests(tcu::TestContext& testCtx, const char* name)
 {
-	de::MovePtr<tcu::TestCaseGroup> group				(new tcu::TestCaseGroup(testCtx, "switch_block_order", "Out-of-order blocks for switch"));
+	de::MovePtr<tcu::TestCaseGroup> group				(new tcu::TestCaseGroup(testCtx, name, "Out-of-order blocks for switch"));
 	RGBA							inputColors[4];
 	RGBA							outputColors[4];
 	map<string, string>				fragments;
@@ -6007,9 +6007,9 @@ tcu::TestCaseGroup* createSwitchBlockOrderTests(tcu::TestContext& testCtx)
 	return group.release();
 }
 
-tcu::TestCaseGroup* createDecorationGroupTests(tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createDecorationGroupTests(tcu::TestContext& testCtx, const char* name)
 {
-	de::MovePtr<tcu::TestCaseGroup> group				(new tcu::TestCaseGroup(testCtx, "decoration_group", "Decoration group tests"));
+	de::MovePtr<tcu::TestCaseGroup> group				(new tcu::TestCaseGroup(testCtx, name, "Decoration group tests"));
 	RGBA							inputColors[4];
 	RGBA							outputColors[4];
 	map<string, string>				fragments;
@@ -6157,9 +6157,9 @@ struct SpecConstantTwoIntGraphicsCase
 	}
 };
 
-tcu::TestCaseGroup* createSpecConstantTests (tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createSpecConstantTests (tcu::TestContext& testCtx, const char* name)
 {
-	de::MovePtr<tcu::TestCaseGroup> group				(new tcu::TestCaseGroup(testCtx, "opspecconstantop", "Test the OpSpecConstantOp instruction"));
+	de::MovePtr<tcu::TestCaseGroup> group				(new tcu::TestCaseGroup(testCtx, name, "Test the OpSpecConstantOp instruction"));
 	vector<SpecConstantTwoIntGraphicsCase>	cases;
 	RGBA							inputColors[4];
 	RGBA							outputColors0[4];
@@ -6328,9 +6328,9 @@ tcu::TestCaseGroup* createSpecConstantTests (tcu::TestContext& testCtx)
 	return group.release();
 }
 
-tcu::TestCaseGroup* createOpPhiTests(tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createOpPhiTests(tcu::TestContext& testCtx, const char* name)
 {
-	de::MovePtr<tcu::TestCaseGroup> group				(new tcu::TestCaseGroup(testCtx, "opphi", "Test the OpPhi instruction"));
+	de::MovePtr<tcu::TestCaseGroup> group				(new tcu::TestCaseGroup(testCtx, name, "Test the OpPhi instruction"));
 	RGBA							inputColors[4];
 	RGBA							outputColors1[4];
 	RGBA							outputColors2[4];
@@ -6506,9 +6506,9 @@ tcu::TestCaseGroup* createOpPhiTests(tcu::TestContext& testCtx)
 	return group.release();
 }
 
-tcu::TestCaseGroup* createNoContractionTests(tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createNoContractionTests(tcu::TestContext& testCtx, const char* name)
 {
-	de::MovePtr<tcu::TestCaseGroup> group			(new tcu::TestCaseGroup(testCtx, "nocontraction", "Test the NoContraction decoration"));
+	de::MovePtr<tcu::TestCaseGroup> group			(new tcu::TestCaseGroup(testCtx, name, "Test the NoContraction decoration"));
 	RGBA							inputColors[4];
 	RGBA							outputColors[4];
 
@@ -6580,9 +6580,9 @@ tcu::TestCaseGroup* createNoContractionTests(tcu::TestContext& testCtx)
 	return group.release();
 }
 
-tcu::TestCaseGroup* createMemoryAccessTests(tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createMemoryAccessTests(tcu::TestContext& testCtx, const char* name)
 {
-	de::MovePtr<tcu::TestCaseGroup> memoryAccessTests (new tcu::TestCaseGroup(testCtx, "opmemoryaccess", "Memory Semantics"));
+	de::MovePtr<tcu::TestCaseGroup> memoryAccessTests (new tcu::TestCaseGroup(testCtx, name, "Memory Semantics"));
 	RGBA							colors[4];
 
 	const char						constantsAndTypes[]	 =
@@ -6661,9 +6661,9 @@ tcu::TestCaseGroup* createMemoryAccessTests(tcu::TestContext& testCtx)
 	}
 	return memoryAccessTests.release();
 }
-tcu::TestCaseGroup* createOpUndefTests(tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createOpUndefTests(tcu::TestContext& testCtx, const char* name)
 {
-	de::MovePtr<tcu::TestCaseGroup>		opUndefTests		 (new tcu::TestCaseGroup(testCtx, "opundef", "Test OpUndef"));
+	de::MovePtr<tcu::TestCaseGroup>		opUndefTests		 (new tcu::TestCaseGroup(testCtx, name, "Test OpUndef"));
 	RGBA								defaultColors[4];
 	map<string, string>					fragments;
 	getDefaultColors(defaultColors);
@@ -7093,9 +7093,9 @@ void createOpQuantizeTwoPossibilityTests(tcu::TestCaseGroup* testCtx)
 	}
 }
 
-tcu::TestCaseGroup* createOpQuantizeTests(tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createOpQuantizeTests(tcu::TestContext& testCtx, const char* name)
 {
-	de::MovePtr<tcu::TestCaseGroup> opQuantizeTests (new tcu::TestCaseGroup(testCtx, "opquantize", "Test OpQuantizeToF16"));
+	de::MovePtr<tcu::TestCaseGroup> opQuantizeTests (new tcu::TestCaseGroup(testCtx, name, "Test OpQuantizeToF16"));
 	createOpQuantizeSingleOptionTests(opQuantizeTests.get());
 	createOpQuantizeTwoPossibilityTests(opQuantizeTests.get());
 	return opQuantizeTests.release();
@@ -7123,11 +7123,11 @@ ShaderPermutation getShaderPermutation(deUint8 inputValue)
 	return permutation;
 }
 
-tcu::TestCaseGroup* createModuleTests(tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createModuleTests(tcu::TestContext& testCtx, const char* name)
 {
 	RGBA								defaultColors[4];
 	RGBA								invertedColors[4];
-	de::MovePtr<tcu::TestCaseGroup>		moduleTests			(new tcu::TestCaseGroup(testCtx, "module", "Multiple entry points into shaders"));
+	de::MovePtr<tcu::TestCaseGroup>		moduleTests			(new tcu::TestCaseGroup(testCtx, name, "Multiple entry points into shaders"));
 
 	const ShaderElement					combinedPipeline[]	=
 	{
@@ -7174,9 +7174,9 @@ tcu::TestCaseGroup* createModuleTests(tcu::TestContext& testCtx)
 	return moduleTests.release();
 }
 
-tcu::TestCaseGroup* createLoopTests(tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createLoopTests(tcu::TestContext& testCtx, const char* name)
 {
-	de::MovePtr<tcu::TestCaseGroup> testGroup(new tcu::TestCaseGroup(testCtx, "loop", "Looping control flow"));
+	de::MovePtr<tcu::TestCaseGroup> testGroup(new tcu::TestCaseGroup(testCtx, name, "Looping control flow"));
 	RGBA defaultColors[4];
 	getDefaultColors(defaultColors);
 	map<string, string> fragments;
@@ -7426,9 +7426,9 @@ void addTessCtrlTest(tcu::TestCaseGroup* group, const char* name, const map<stri
 }
 
 // A collection of tests putting OpControlBarrier in places GLSL forbids but SPIR-V allows.
-tcu::TestCaseGroup* createBarrierTests(tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createBarrierTests(tcu::TestContext& testCtx, const char* name)
 {
-	de::MovePtr<tcu::TestCaseGroup> testGroup(new tcu::TestCaseGroup(testCtx, "barrier", "OpControlBarrier"));
+	de::MovePtr<tcu::TestCaseGroup> testGroup(new tcu::TestCaseGroup(testCtx, name, "OpControlBarrier"));
 	map<string, string> fragments;
 
 	// A barrier inside a function body.
@@ -7569,9 +7569,9 @@ tcu::TestCaseGroup* createBarrierTests(tcu::TestContext& testCtx)
 }
 
 // Test for the OpFRem instruction.
-tcu::TestCaseGroup* createFRemTests(tcu::TestContext& testCtx)
+tcu::TestCaseGroup* createFRemTests(tcu::TestContext& testCtx, const char* name)
 {
-	de::MovePtr<tcu::TestCaseGroup>		testGroup(new tcu::TestCaseGroup(testCtx, "frem", "OpFRem"));
+	de::MovePtr<tcu::TestCaseGroup>		testGroup(new tcu::TestCaseGroup(testCtx, name, "OpFRem"));
 	map<string, string>					fragments;
 	RGBA								inputColors[4];
 	RGBA								outputColors[4];
@@ -7622,30 +7622,30 @@ tcu::TestCaseGroup* createInstructionTests (tcu::TestContext& testCtx)
 	de::MovePtr<tcu::TestCaseGroup> computeTests		(new tcu::TestCaseGroup(testCtx, "compute", "Compute Instructions with special opcodes/operands"));
 	de::MovePtr<tcu::TestCaseGroup> graphicsTests		(new tcu::TestCaseGroup(testCtx, "graphics", "Graphics Instructions with special opcodes/operands"));
 
-	computeTests->addChild(createOpNopGroup(testCtx));
-	computeTests->addChild(createOpLineGroup(testCtx));
-	computeTests->addChild(createOpNoLineGroup(testCtx));
-	computeTests->addChild(createOpConstantNullGroup(testCtx));
-	computeTests->addChild(createOpConstantCompositeGroup(testCtx));
-	computeTests->addChild(createOpConstantUsageGroup(testCtx));
-	computeTests->addChild(createSpecConstantGroup(testCtx));
-	computeTests->addChild(createOpSourceGroup(testCtx));
-	computeTests->addChild(createOpSourceExtensionGroup(testCtx));
-	computeTests->addChild(createDecorationGroupGroup(testCtx));
-	computeTests->addChild(createOpPhiGroup(testCtx));
-	computeTests->addChild(createLoopControlGroup(testCtx));
-	computeTests->addChild(createFunctionControlGroup(testCtx));
-	computeTests->addChild(createSelectionControlGroup(testCtx));
-	computeTests->addChild(createBlockOrderGroup(testCtx));
-	computeTests->addChild(createMultipleShaderGroup(testCtx));
-	computeTests->addChild(createMemoryAccessGroup(testCtx));
-	computeTests->addChild(createOpCopyMemoryGroup(testCtx));
-	computeTests->addChild(createOpCopyObjectGroup(testCtx));
-	computeTests->addChild(createNoContractionGroup(testCtx));
-	computeTests->addChild(createOpUndefGroup(testCtx));
-	computeTests->addChild(createOpUnreachableGroup(testCtx));
-	computeTests ->addChild(createOpQuantizeToF16Group(testCtx));
-	computeTests ->addChild(createOpFRemGroup(testCtx));
+	computeTests->addChild(new tcu::LazyTestGroup(testCtx, "opnop", createOpNopGroup));
+	computeTests->addChild(new tcu::LazyTestGroup(testCtx, "opline", createOpLineGroup));
+	computeTests->addChild(new tcu::LazyTestGroup(testCtx, "opnoline", createOpNoLineGroup));
+	computeTests->addChild(new tcu::LazyTestGroup(testCtx, "opconstantnull", createOpConstantNullGroup));
+	computeTests->addChild(new tcu::LazyTestGroup(testCtx, "opconstantcomposite", createOpConstantCompositeGroup));
+	computeTests->addChild(new tcu::LazyTestGroup(testCtx, "opconstantnullcomposite", createOpConstantUsageGroup));
+	computeTests->addChild(new tcu::LazyTestGroup(testCtx, "opspecconstantop", createSpecConstantGroup));
+	computeTests->addChild(new tcu::LazyTestGroup(testCtx, "opsource", createOpSourceGroup));
+	computeTests->addChild(new tcu::LazyTestGroup(testCtx, "opsourceextension", createOpSourceExtensionGroup));
+	computeTests->addChild(new tcu::LazyTestGroup(testCtx, "decoration_group", createDecorationGroupGroup));
+	computeTests->addChild(new tcu::LazyTestGroup(testCtx, "opphi", createOpPhiGroup));
+	computeTests->addChild(new tcu::LazyTestGroup(testCtx, "loop_control", createLoopControlGroup));
+	computeTests->addChild(new tcu::LazyTestGroup(testCtx, "function_control", createFunctionControlGroup));
+	computeTests->addChild(new tcu::LazyTestGroup(testCtx, "selection_control", createSelectionControlGroup));
+	computeTests->addChild(new tcu::LazyTestGroup(testCtx, "block_order", createBlockOrderGroup));
+	computeTests->addChild(new tcu::LazyTestGroup(testCtx, "multiple_shaders", createMultipleShaderGroup));
+	computeTests->addChild(new tcu::LazyTestGroup(testCtx, "memory_access", createMemoryAccessGroup));
+	computeTests->addChild(new tcu::LazyTestGroup(testCtx, "opcopymemory", createOpCopyMemoryGroup));
+	computeTests->addChild(new tcu::LazyTestGroup(testCtx, "opcopyobject", createOpCopyObjectGroup));
+	computeTests->addChild(new tcu::LazyTestGroup(testCtx, "nocontraction", createNoContractionGroup));
+	computeTests->addChild(new tcu::LazyTestGroup(testCtx, "opundef", createOpUndefGroup));
+	computeTests->addChild(new tcu::LazyTestGroup(testCtx, "opunreachable", createOpUnreachableGroup));
+	computeTests->addChild(new tcu::LazyTestGroup(testCtx, "opquantize", createOpQuantizeToF16Group));
+	computeTests->addChild(new tcu::LazyTestGroup(testCtx, "opfrem", createOpFRemGroup));
 
 	RGBA defaultColors[4];
 	getDefaultColors(defaultColors);
@@ -7678,26 +7678,26 @@ tcu::TestCaseGroup* createInstructionTests (tcu::TestContext& testCtx)
 
 
 	graphicsTests->addChild(opnopTests.release());
-	graphicsTests->addChild(createOpSourceTests(testCtx));
-	graphicsTests->addChild(createOpSourceContinuedTests(testCtx));
-	graphicsTests->addChild(createOpLineTests(testCtx));
-	graphicsTests->addChild(createOpNoLineTests(testCtx));
-	graphicsTests->addChild(createOpConstantNullTests(testCtx));
-	graphicsTests->addChild(createOpConstantCompositeTests(testCtx));
-	graphicsTests->addChild(createMemoryAccessTests(testCtx));
-	graphicsTests->addChild(createOpUndefTests(testCtx));
-	graphicsTests->addChild(createSelectionBlockOrderTests(testCtx));
-	graphicsTests->addChild(createModuleTests(testCtx));
-	graphicsTests->addChild(createSwitchBlockOrderTests(testCtx));
-	graphicsTests->addChild(createOpPhiTests(testCtx));
-	graphicsTests->addChild(createNoContractionTests(testCtx));
-	graphicsTests->addChild(createOpQuantizeTests(testCtx));
-	graphicsTests->addChild(createLoopTests(testCtx));
-	graphicsTests->addChild(createSpecConstantTests(testCtx));
-	graphicsTests->addChild(createSpecConstantOpQuantizeToF16Group(testCtx));
-	graphicsTests->addChild(createBarrierTests(testCtx));
-	graphicsTests->addChild(createDecorationGroupTests(testCtx));
-	graphicsTests->addChild(createFRemTests(testCtx));
+	graphicsTests->addChild(new tcu::LazyTestGroup(testCtx, "opsource", createOpSourceTests));
+	graphicsTests->addChild(new tcu::LazyTestGroup(testCtx, "opsourcecontinued", createOpSourceContinuedTests));
+	graphicsTests->addChild(new tcu::LazyTestGroup(testCtx, "opline", createOpLineTests));
+	graphicsTests->addChild(new tcu::LazyTestGroup(testCtx, "opnoline", createOpNoLineTests));
+	graphicsTests->addChild(new tcu::LazyTestGroup(testCtx, "opconstantnull", createOpConstantNullTests));
+	graphicsTests->addChild(new tcu::LazyTestGroup(testCtx, "opconstantcomposite", createOpConstantCompositeTests));
+	graphicsTests->addChild(new tcu::LazyTestGroup(testCtx, "opmemoryaccess", createMemoryAccessTests));
+	graphicsTests->addChild(new tcu::LazyTestGroup(testCtx, "opundef", createOpUndefTests));
+	graphicsTests->addChild(new tcu::LazyTestGroup(testCtx, "selection_block_order", createSelectionBlockOrderTests));
+	graphicsTests->addChild(new tcu::LazyTestGroup(testCtx, "module", createModuleTests));
+	graphicsTests->addChild(new tcu::LazyTestGroup(testCtx, "switch_block_order", createSwitchBlockOrderTests));
+	graphicsTests->addChild(new tcu::LazyTestGroup(testCtx, "opphi", createOpPhiTests));
+	graphicsTests->addChild(new tcu::LazyTestGroup(testCtx, "nocontraction", createNoContractionTests));
+	graphicsTests->addChild(new tcu::LazyTestGroup(testCtx, "opquantize", createOpQuantizeTests));
+	graphicsTests->addChild(new tcu::LazyTestGroup(testCtx, "loop", createLoopTests));
+	graphicsTests->addChild(new tcu::LazyTestGroup(testCtx, "opspecconstantop", createSpecConstantTests));
+	graphicsTests->addChild(new tcu::LazyTestGroup(testCtx, "opspecconstantop_opquantize", createSpecConstantOpQuantizeToF16Group));
+	graphicsTests->addChild(new tcu::LazyTestGroup(testCtx, "barrier", createBarrierTests));
+	graphicsTests->addChild(new tcu::LazyTestGroup(testCtx, "decoration_group", createDecorationGroupTests));
+	graphicsTests->addChild(new tcu::LazyTestGroup(testCtx, "frem", createFRemTests));
 
 	instructionTests->addChild(computeTests.release());
 	instructionTests->addChild(graphicsTests.release());
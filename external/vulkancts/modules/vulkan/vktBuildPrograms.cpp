@@ -41,8 +41,12 @@
 #include "vktTestPackage.hpp"
 #include "deUniquePtr.hpp"
 #include "deCommandLine.hpp"
+#include "deSharedPtr.hpp"
+#include "deThread.hpp"
+#include "deAtomic.h"
 
 #include <iostream>
+#include <sstream>
 
 using std::vector;
 using std::string;
@@ -82,6 +86,11 @@ struct BuildStats
 namespace // anonymous
 {
 
+enum
+{
+	BUILD_BATCH_SIZE	= 256		//!< Number of programs collected before compiling them in parallel
+};
+
 vk::ProgramBinary* compileProgram (const glu::ProgramSources& source, glu::ShaderProgramInfo* buildInfo)
 {
 	return vk::buildProgram(source, vk::PROGRAM_FORMAT_SPIRV, buildInfo);
@@ -92,105 +101,243 @@ vk::ProgramBinary* compileProgram (const vk::SpirVAsmSource& source, vk::SpirVPr
 	return vk::assembleProgram(source, buildInfo);
 }
 
-void writeVerboseLogs (const glu::ShaderProgramInfo& buildInfo)
+string getVerboseLogs (const glu::ShaderProgramInfo& buildInfo)
 {
+	std::ostringstream str;
+
 	for (size_t shaderNdx = 0; shaderNdx < buildInfo.shaders.size(); shaderNdx++)
 	{
 		const glu::ShaderInfo&	shaderInfo	= buildInfo.shaders[shaderNdx];
 		const char* const		shaderName	= getShaderTypeName(shaderInfo.type);
 
-		tcu::print("%s source:\n---\n%s\n---\n", shaderName, shaderInfo.source.c_str());
-		tcu::print("%s compile log:\n---\n%s\n---\n", shaderName, shaderInfo.infoLog.c_str());
+		str << shaderName << " source:\n---\n" << shaderInfo.source << "\n---\n";
+		str << shaderName << " compile log:\n---\n" << shaderInfo.infoLog << "\n---\n";
 	}
+
+	return str.str();
 }
 
-void writeVerboseLogs (const vk::SpirVProgramInfo& buildInfo)
+string getVerboseLogs (const vk::SpirVProgramInfo& buildInfo)
 {
-	tcu::print("source:\n---\n%s\n---\n", buildInfo.source->program.str().c_str());
-	tcu::print("compile log:\n---\n%s\n---\n", buildInfo.infoLog.c_str());
+	std::ostringstream str;
+
+	str << "source:\n---\n" << (buildInfo.source ? buildInfo.source->program.str() : string()) << "\n---\n";
+	str << "compile log:\n---\n" << buildInfo.infoLog << "\n---\n";
+
+	return str.str();
 }
 
-template <typename InfoType, typename IteratorType>
-void buildProgram (const std::string&			casePath,
-				   bool							printLogs,
-				   IteratorType					iter,
-				   BuildMode					mode,
-				   BuildStats*					stats,
-				   vk::BinaryRegistryReader*	reader,
-				   vk::BinaryRegistryWriter*	writer)
+//! Program build job. Compiled in worker thread, results consumed in main thread in job order.
+struct Program
+{
+	vk::ProgramIdentifier					id;
+	glu::ProgramSources						glslSource;
+	de::SharedPtr<vk::SpirVAsmSource>		spirvAsmSource;		//!< Set for SPIR-V assembly programs, SpirVAsmSource is not copyable
+
+	de::SharedPtr<vk::ProgramBinary>		binary;
+	string									error;
+	string									verboseLogs;
+
+	Program (const vk::ProgramIdentifier& id_, const glu::ProgramSources& source)
+		: id			(id_)
+		, glslSource	(source)
+	{
+	}
+
+	Program (const vk::ProgramIdentifier& id_, const vk::SpirVAsmSource& source)
+		: id				(id_)
+		, spirvAsmSource	(new vk::SpirVAsmSource())
+	{
+		spirvAsmSource->program << source.program.str();
+	}
+};
+
+struct CasePrograms
+{
+	string		casePath;
+	int			numPrograms;
+
+	CasePrograms (const string& casePath_, int numPrograms_)
+		: casePath		(casePath_)
+		, numPrograms	(numPrograms_)
+	{
+	}
+};
+
+template <typename InfoType, typename SourceType>
+void compileProgram (const SourceType& source, Program* program)
 {
-	InfoType							buildInfo;
+	InfoType buildInfo;
+
 	try
 	{
-		const vk::ProgramIdentifier			progId		(casePath, iter.getName());
-		const UniquePtr<vk::ProgramBinary>	binary		(compileProgram(iter.getProgram(), &buildInfo));
+		program->binary = de::SharedPtr<vk::ProgramBinary>(compileProgram(source, &buildInfo));
+	}
+	catch (const std::exception& e)
+	{
+		program->error = e.what();
+	}
+
+	program->verboseLogs = getVerboseLogs(buildInfo);
+}
+
+void compileProgram (Program* program)
+{
+	if (program->spirvAsmSource)
+		compileProgram<vk::SpirVProgramInfo>(*program->spirvAsmSource, program);
+	else
+		compileProgram<glu::ShaderProgramInfo>(program->glslSource, program);
+}
+
+class BuildWorker : public de::Thread
+{
+public:
+	BuildWorker (vector<Program>& programs, volatile deInt32* nextProgramNdx)
+		: m_programs		(programs)
+		, m_nextProgramNdx	(nextProgramNdx)
+	{
+	}
+
+	void run (void)
+	{
+		for (;;)
+		{
+			const int programNdx = (int)deAtomicIncrement32(m_nextProgramNdx) - 1;
+
+			if (programNdx >= (int)m_programs.size())
+				break;
+
+			compileProgram(&m_programs[programNdx]);
+		}
+	}
+
+private:
+	vector<Program>&	m_programs;
+	volatile deInt32*	m_nextProgramNdx;
+};
+
+void compilePrograms (vector<Program>& programs, int numThreads)
+{
+	const int numWorkers = de::min(numThreads, (int)programs.size());
+
+	if (numWorkers <= 1)
+	{
+		for (vector<Program>::iterator program = programs.begin(); program != programs.end(); ++program)
+			compileProgram(&*program);
+	}
+	else
+	{
+		volatile deInt32						nextProgramNdx	= 0;
+		vector<de::SharedPtr<BuildWorker> >		workers;
+
+		for (int workerNdx = 0; workerNdx < numWorkers; workerNdx++)
+		{
+			workers.push_back(de::SharedPtr<BuildWorker>(new BuildWorker(programs, &nextProgramNdx)));
+			workers.back()->start();
+		}
+
+		for (int workerNdx = 0; workerNdx < numWorkers; workerNdx++)
+			workers[workerNdx]->join();
+	}
+}
+
+void commitProgram (Program& program, bool printLogs, BuildMode mode, BuildStats* stats, vk::BinaryRegistryReader* reader, vk::BinaryRegistryWriter* writer)
+{
+	try
+	{
+		if (!program.binary)
+			throw tcu::Exception(program.error);
 
 		if (mode == BUILDMODE_BUILD)
-			writer->storeProgram(progId, *binary);
+			writer->storeProgram(program.id, *program.binary);
 		else
 		{
 			DE_ASSERT(mode == BUILDMODE_VERIFY);
 
-			const UniquePtr<vk::ProgramBinary>	storedBinary	(reader->loadProgram(progId));
+			const UniquePtr<vk::ProgramBinary>	storedBinary	(reader->loadProgram(program.id));
 
-			if (binary->getSize() != storedBinary->getSize())
+			if (program.binary->getSize() != storedBinary->getSize())
 				throw tcu::Exception("Binary size doesn't match");
 
-			if (deMemCmp(binary->getBinary(), storedBinary->getBinary(), binary->getSize()))
+			if (deMemCmp(program.binary->getBinary(), storedBinary->getBinary(), program.binary->getSize()))
 				throw tcu::Exception("Binary contents don't match");
 		}
 
-		tcu::print("  OK: %s\n", iter.getName().c_str());
+		tcu::print("  OK: %s\n", program.id.programName.c_str());
 		stats->numSucceeded += 1;
 	}
 	catch (const std::exception& e)
 	{
-		tcu::print("  ERROR: %s: %s\n", iter.getName().c_str(), e.what());
+		tcu::print("  ERROR: %s: %s\n", program.id.programName.c_str(), e.what());
 		if (printLogs)
 		{
-			writeVerboseLogs(buildInfo);
+			tcu::print("%s", program.verboseLogs.c_str());
 		}
 		stats->numFailed += 1;
 	}
+
+	program.binary.clear();
 }
 
 } // anonymous
-BuildStats buildPrograms (tcu::TestContext& testCtx, const std::string& dstPath, BuildMode mode, bool verbose)
+
+BuildStats buildPrograms (tcu::TestContext& testCtx, const std::string& dstPath, BuildMode mode, vk::RegistryFormat format, bool verbose, int numThreads)
 {
 	const UniquePtr<tcu::TestPackageRoot>	root		(createRoot(testCtx));
 	tcu::DefaultHierarchyInflater			inflater	(testCtx);
 	tcu::TestHierarchyIterator				iterator	(*root, inflater, testCtx.getCommandLine());
 	const tcu::DirArchive					srcArchive	(dstPath.c_str());
-	UniquePtr<vk::BinaryRegistryWriter>		writer		(mode == BUILDMODE_BUILD	? new vk::BinaryRegistryWriter(dstPath)			: DE_NULL);
+	UniquePtr<vk::BinaryRegistryWriter>		writer		(mode == BUILDMODE_BUILD	? new vk::BinaryRegistryWriter(dstPath, format)	: DE_NULL);
 	UniquePtr<vk::BinaryRegistryReader>		reader		(mode == BUILDMODE_VERIFY	? new vk::BinaryRegistryReader(srcArchive, "")	: DE_NULL);
 	BuildStats								stats;
 	const bool								printLogs	= verbose;
 
 	while (iterator.getState() != tcu::TestHierarchyIterator::STATE_FINISHED)
 	{
-		if (iterator.getState() == tcu::TestHierarchyIterator::STATE_ENTER_NODE &&
-			tcu::isTestNodeTypeExecutable(iterator.getNode()->getNodeType()))
+		vector<CasePrograms>	cases;
+		vector<Program>			programs;
+
+		// Collect programs from consecutive cases. Hierarchy traversal and initPrograms() are kept in main thread.
+		while (iterator.getState() != tcu::TestHierarchyIterator::STATE_FINISHED && programs.size() < (size_t)BUILD_BATCH_SIZE)
 		{
-			const TestCase* const		testCase	= dynamic_cast<TestCase*>(iterator.getNode());
-			const string				casePath	= iterator.getNodePath();
-			vk::SourceCollections		progs;
+			if (iterator.getState() == tcu::TestHierarchyIterator::STATE_ENTER_NODE &&
+				tcu::isTestNodeTypeExecutable(iterator.getNode()->getNodeType()))
+			{
+				const TestCase* const		testCase	= dynamic_cast<TestCase*>(iterator.getNode());
+				const string				casePath	= iterator.getNodePath();
+				const size_t				firstNdx	= programs.size();
+				vk::SourceCollections		progs;
 
-			tcu::print("%s\n", casePath.c_str());
+				testCase->initPrograms(progs);
 
-			testCase->initPrograms(progs);
+				for (vk::GlslSourceCollection::Iterator progIter = progs.glslSources.begin(); progIter != progs.glslSources.end(); ++progIter)
+					programs.push_back(Program(vk::ProgramIdentifier(casePath, progIter.getName()), progIter.getProgram()));
 
-			for (vk::GlslSourceCollection::Iterator progIter = progs.glslSources.begin(); progIter != progs.glslSources.end(); ++progIter)
-			{
-				buildProgram<glu::ShaderProgramInfo, vk::GlslSourceCollection::Iterator>(casePath, printLogs, progIter, mode, &stats, reader.get(), writer.get());
+				for (vk::SpirVAsmCollection::Iterator progIter = progs.spirvAsmSources.begin(); progIter != progs.spirvAsmSources.end(); ++progIter)
+					programs.push_back(Program(vk::ProgramIdentifier(casePath, progIter.getName()), progIter.getProgram()));
+
+				cases.push_back(CasePrograms(casePath, (int)(programs.size() - firstNdx)));
 			}
 
-			for (vk::SpirVAsmCollection::Iterator progIter = progs.spirvAsmSources.begin(); progIter != progs.spirvAsmSources.end(); ++progIter)
+			iterator.next();
+		}
+
+		compilePrograms(programs, numThreads);
+
+		// Results are committed in traversal order so that registry output doesn't depend on thread timing.
+		{
+			size_t programNdx = 0;
+
+			for (vector<CasePrograms>::const_iterator casePrograms = cases.begin(); casePrograms != cases.end(); ++casePrograms)
 			{
-				buildProgram<vk::SpirVProgramInfo, vk::SpirVAsmCollection::Iterator>(casePath, printLogs, progIter, mode, &stats, reader.get(), writer.get());
+				tcu::print("%s\n", casePrograms->casePath.c_str());
+
+				for (int ndx = 0; ndx < casePrograms->numPrograms; ndx++)
+					commitProgram(programs[programNdx++], printLogs, mode, &stats, reader.get(), writer.get());
 			}
-		}
 
-		iterator.next();
+			DE_ASSERT(programNdx == programs.size());
+		}
 	}
 
 	if (mode == BUILDMODE_BUILD)
@@ -206,8 +353,10 @@ namespace opt
 
 DE_DECLARE_COMMAND_LINE_OPT(DstPath,	std::string);
 DE_DECLARE_COMMAND_LINE_OPT(Mode,		vkt::BuildMode);
+DE_DECLARE_COMMAND_LINE_OPT(Format,		vk::RegistryFormat);
 DE_DECLARE_COMMAND_LINE_OPT(Verbose,	bool);
 DE_DECLARE_COMMAND_LINE_OPT(Cases,		std::string);
+DE_DECLARE_COMMAND_LINE_OPT(Jobs,		int);
 
 } // opt
 
@@ -222,10 +371,18 @@ void registerOptions (de::cmdline::Parser& parser)
 		{ "verify",	vkt::BUILDMODE_VERIFY	}
 	};
 
+	static const NamedValue<vk::RegistryFormat> s_formats[] =
+	{
+		{ "files",	vk::REGISTRY_FORMAT_FILES	},
+		{ "packed",	vk::REGISTRY_FORMAT_PACKED	}
+	};
+
 	parser << Option<opt::DstPath>	("d", "dst-path",	"Destination path",	"out")
 		   << Option<opt::Mode>		("m", "mode",		"Build mode",		s_modes,	"build")
+		   << Option<opt::Format>	("f", "format",		"Registry format (verify mode detects format automatically)",	s_formats,	"files")
 		   << Option<opt::Verbose>	("v", "verbose",	"Verbose output")
-		   << Option<opt::Cases>	("n", "deqp-case",	"Case path filter (works as in test binaries)");
+		   << Option<opt::Cases>	("n", "deqp-case",	"Case path filter (works as in test binaries)")
+		   << Option<opt::Jobs>		("j", "jobs",		"Number of parallel compile threads (0 = number of CPU cores)",	"1");
 }
 
 int main (int argc, const char* argv[])
@@ -265,10 +422,13 @@ int main (int argc, const char* argv[])
 		tcu::Platform			platform;
 		tcu::TestContext		testCtx			(platform, archive, log, deqpCmdLine, DE_NULL);
 
+		const int				numJobs			= cmdLine.getOption<opt::Jobs>();
 		const vkt::BuildStats	stats			= vkt::buildPrograms(testCtx,
 																	 cmdLine.getOption<opt::DstPath>(),
 																	 cmdLine.getOption<opt::Mode>(),
-																	 cmdLine.getOption<opt::Verbose>());
+																	 cmdLine.getOption<opt::Format>(),
+																	 cmdLine.getOption<opt::Verbose>(),
+																	 numJobs > 0 ? numJobs : (int)deGetNumAvailableLogicalCores());
 
 		tcu::print("DONE: %d passed, %d failed\n", stats.numSucceeded, stats.numFailed);
 
@@ -36,6 +36,9 @@
 #include "vkDeviceUtil.hpp"
 #include "vkMemUtil.hpp"
 #include "vkPlatform.hpp"
+#include "vkCallStatsWrapper.hpp"
+
+#include "tcuCommandLine.hpp"
 
 #include "deMemory.h"
 
@@ -96,17 +99,20 @@ public:
 										~DefaultDevice					(void);
 
 	VkInstance							getInstance						(void) const	{ return *m_instance;					}
-	const InstanceInterface&			getInstanceInterface			(void) const	{ return m_instanceInterface;			}
+	const InstanceInterface&			getInstanceInterface			(void) const;
 
 	VkPhysicalDevice					getPhysicalDevice				(void) const	{ return m_physicalDevice;				}
 	const VkPhysicalDeviceFeatures&		getDeviceFeatures				(void) const	{ return m_deviceFeatures;				}
 	VkDevice							getDevice						(void) const	{ return *m_device;						}
-	const DeviceInterface&				getDeviceInterface				(void) const	{ return m_deviceInterface;				}
+	const DeviceInterface&				getDeviceInterface				(void) const;
 	const VkPhysicalDeviceProperties&	getDeviceProperties				(void) const	{ return m_deviceProperties;			}
 
 	deUint32							getUniversalQueueFamilyIndex	(void) const	{ return m_universalQueueFamilyIndex;	}
 	VkQueue								getUniversalQueue				(void) const;
 
+	void								resetCallStats					(void);
+	void								logCallStats					(tcu::TestLog& log) const;
+
 private:
 	static VkPhysicalDeviceFeatures		filterDefaultDeviceFeatures		(const VkPhysicalDeviceFeatures& deviceFeatures);
 
@@ -121,6 +127,10 @@ private:
 
 	const Unique<VkDevice>				m_device;
 	const DeviceDriver					m_deviceInterface;
+
+	// Enabled with --deqp-vk-call-stats
+	const de::UniquePtr<InstanceCallStatsWrapper>	m_instanceCallStats;
+	const de::UniquePtr<DeviceCallStatsWrapper>		m_deviceCallStats;
 };
 
 DefaultDevice::DefaultDevice (const PlatformInterface& vkPlatform, const tcu::CommandLine& cmdLine)
@@ -132,6 +142,8 @@ DefaultDevice::DefaultDevice (const PlatformInterface& vkPlatform, const tcu::Co
 	, m_deviceProperties			(getPhysicalDeviceProperties(m_instanceInterface, m_physicalDevice)) // \note All supported features are enabled
 	, m_device						(createDefaultDevice(m_instanceInterface, m_physicalDevice, m_universalQueueFamilyIndex, m_deviceFeatures))
 	, m_deviceInterface				(m_instanceInterface, *m_device)
+	, m_instanceCallStats			(cmdLine.isVKCallStatsEnabled() ? new InstanceCallStatsWrapper(m_instanceInterface) : DE_NULL)
+	, m_deviceCallStats				(cmdLine.isVKCallStatsEnabled() ? new DeviceCallStatsWrapper(m_deviceInterface) : DE_NULL)
 {
 }
 
@@ -139,13 +151,47 @@ DefaultDevice::~DefaultDevice (void)
 {
 }
 
+const InstanceInterface& DefaultDevice::getInstanceInterface (void) const
+{
+	if (m_instanceCallStats)
+		return *m_instanceCallStats;
+	else
+		return m_instanceInterface;
+}
+
+const DeviceInterface& DefaultDevice::getDeviceInterface (void) const
+{
+	if (m_deviceCallStats)
+		return *m_deviceCallStats;
+	else
+		return m_deviceInterface;
+}
+
 VkQueue DefaultDevice::getUniversalQueue (void) const
 {
 	VkQueue	queue	= 0;
-	m_deviceInterface.getDeviceQueue(*m_device, m_universalQueueFamilyIndex, 0, &queue);
+	getDeviceInterface().getDeviceQueue(*m_device, m_universalQueueFamilyIndex, 0, &queue);
 	return queue;
 }
 
+void DefaultDevice::resetCallStats (void)
+{
+	if (m_instanceCallStats)
+		m_instanceCallStats->getStats().reset();
+
+	if (m_deviceCallStats)
+		m_deviceCallStats->getStats().reset();
+}
+
+void DefaultDevice::logCallStats (tcu::TestLog& log) const
+{
+	if (m_instanceCallStats)
+		m_instanceCallStats->getStats().log(log);
+
+	if (m_deviceCallStats)
+		m_deviceCallStats->getStats().log(log);
+}
+
 VkPhysicalDeviceFeatures DefaultDevice::filterDefaultDeviceFeatures (const VkPhysicalDeviceFeatures& deviceFeatures)
 {
 	VkPhysicalDeviceFeatures enabledDeviceFeatures = deviceFeatures;
@@ -158,12 +204,18 @@ VkPhysicalDeviceFeatures DefaultDevice::filterDefaultDeviceFeatures (const VkPhy
 
 // Allocator utilities
 
-vk::Allocator* createAllocator (DefaultDevice* device)
+vk::Allocator* createAllocator (DefaultDevice* device, const tcu::CommandLine& cmdLine)
 {
 	const VkPhysicalDeviceMemoryProperties memoryProperties = vk::getPhysicalDeviceMemoryProperties(device->getInstanceInterface(), device->getPhysicalDevice());
 
-	// \todo [2015-07-24 jarkko] support allocator selection/configuration from command line (or compile time)
-	return new SimpleAllocator(device->getDeviceInterface(), device->getDevice(), memoryProperties);
+	switch (cmdLine.getVKAllocatorType())
+	{
+		case tcu::VKALLOCATORTYPE_SIMPLE:	return new SimpleAllocator(device->getDeviceInterface(), device->getDevice(), memoryProperties);
+		case tcu::VKALLOCATORTYPE_POOL:		return new PoolAllocator(device->getDeviceInterface(), device->getDevice(), memoryProperties, device->getDeviceProperties().limits);
+		default:
+			DE_FATAL("Unknown allocator type");
+			return DE_NULL;
+	}
 }
 
 // Context
@@ -175,12 +227,13 @@ Context::Context (tcu::TestContext&							testCtx,
 	, m_platformInterface	(platformInterface)
 	, m_progCollection		(progCollection)
 	, m_device				(new DefaultDevice(m_platformInterface, testCtx.getCommandLine()))
-	, m_allocator			(createAllocator(m_device.get()))
+	, m_allocator			(createAllocator(m_device.get(), testCtx.getCommandLine()))
 {
 }
 
 Context::~Context (void)
 {
+	releaseResources();
 }
 
 vk::VkInstance						Context::getInstance					(void) const { return m_device->getInstance();					}
@@ -194,6 +247,35 @@ deUint32							Context::getUniversalQueueFamilyIndex	(void) const { return m_dev
 vk::VkQueue							Context::getUniversalQueue				(void) const { return m_device->getUniversalQueue();			}
 vk::Allocator&						Context::getDefaultAllocator			(void) const { return *m_allocator;								}
 
+void Context::resetCallStats (void)
+{
+	m_device->resetCallStats();
+}
+
+void Context::logCallStats (tcu::TestLog& log) const
+{
+	m_device->logCallStats(log);
+}
+
+ContextResource* Context::getResource (const std::string& name) const
+{
+	const ResourceMap::const_iterator	pos	= m_resources.find(name);
+
+	return pos != m_resources.end() ? pos->second.get() : DE_NULL;
+}
+
+ContextResource& Context::addResource (const std::string& name, de::MovePtr<ContextResource> resource) const
+{
+	DE_ASSERT(m_resources.find(name) == m_resources.end());
+
+	return *(m_resources[name] = de::SharedPtr<ContextResource>(resource.release()));
+}
+
+void Context::releaseResources (void)
+{
+	m_resources.clear();
+}
+
 // TestCase
 
 void TestCase::initPrograms (SourceCollections&) const
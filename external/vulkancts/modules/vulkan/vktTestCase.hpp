@@ -34,6 +34,10 @@
 #include "tcuTestCase.hpp"
 #include "vkDefs.hpp"
 #include "deUniquePtr.hpp"
+#include "deSharedPtr.hpp"
+
+#include <map>
+#include <string>
 
 namespace glu
 {
@@ -54,6 +58,13 @@ namespace vkt
 
 class DefaultDevice;
 
+//! Base class for objects cached in Context, see Context::getResource().
+class ContextResource
+{
+public:
+	virtual										~ContextResource				(void) {}
+};
+
 class Context
 {
 public:
@@ -79,6 +90,15 @@ public:
 
 	vk::Allocator&								getDefaultAllocator				(void) const;
 
+	// API call statistics of default instance & device, enabled with --deqp-vk-call-stats
+	void										resetCallStats					(void);
+	void										logCallStats					(tcu::TestLog& log) const;
+
+	// Objects shared between test instances, created on default device. Returns DE_NULL if resource has not been added.
+	ContextResource*							getResource						(const std::string& name) const;
+	ContextResource&							addResource						(const std::string& name, de::MovePtr<ContextResource> resource) const;
+	void										releaseResources				(void);
+
 protected:
 	tcu::TestContext&							m_testCtx;
 	const vk::PlatformInterface&				m_platformInterface;
@@ -87,6 +107,10 @@ protected:
 	const de::UniquePtr<DefaultDevice>			m_device;
 	const de::UniquePtr<vk::Allocator>			m_allocator;
 
+	// \note Declared after device and allocator so that resources are destroyed first
+	typedef std::map<std::string, de::SharedPtr<ContextResource> >	ResourceMap;
+	mutable ResourceMap							m_resources;
+
 private:
 												Context							(const Context&); // Not allowed
 	Context&									operator=						(const Context&); // Not allowed
@@ -33,14 +33,17 @@
 #include "tcuPlatform.hpp"
 #include "tcuTestCase.hpp"
 #include "tcuTestLog.hpp"
+#include "tcuCommandLine.hpp"
 
 #include "vkPlatform.hpp"
 #include "vkPrograms.hpp"
 #include "vkBinaryRegistry.hpp"
+#include "vkProgramBinaryCache.hpp"
 #include "vkGlslToSpirV.hpp"
 #include "vkSpirVAsm.hpp"
 
 #include "deUniquePtr.hpp"
+#include "deThread.hpp"
 
 #include "vktTestGroupUtil.hpp"
 #include "vktApiTests.hpp"
@@ -85,15 +88,23 @@ vk::ProgramBinary* compileProgram (const vk::SpirVAsmSource& source, vk::SpirVPr
 	return vk::assembleProgram(source, buildInfo);
 }
 
+de::Sha1 getCacheKey (const glu::ProgramSources& source)
+{
+	return vk::getProgramCacheKey(source, vk::PROGRAM_FORMAT_SPIRV);
+}
+
+de::Sha1 getCacheKey (const vk::SpirVAsmSource& source)
+{
+	return vk::getProgramCacheKey(source);
+}
+
 template <typename InfoType, typename IteratorType>
-vk::ProgramBinary* buildProgram (const std::string&					casePath,
-								 IteratorType						iter,
-								 const vk::BinaryRegistryReader&	prebuiltBinRegistry,
-								 tcu::TestLog&						log,
-								 vk::BinaryCollection*				progCollection)
+de::MovePtr<vk::ProgramBinary> compileOrLoadPrebuiltProgram (const vk::ProgramIdentifier&		progId,
+															 IteratorType						iter,
+															 const vk::BinaryRegistryReader&	prebuiltBinRegistry,
+															 tcu::TestLog&						log,
+															 bool*								isCompiled)
 {
-	const vk::ProgramIdentifier		progId		(casePath, iter.getName());
-	const tcu::ScopedLogSection		progSection	(log, iter.getName(), "Program: " + iter.getName());
 	de::MovePtr<vk::ProgramBinary>	binProg;
 	InfoType						buildInfo;
 
@@ -101,6 +112,9 @@ vk::ProgramBinary* buildProgram (const std::string&					casePath,
 	{
 		binProg	= de::MovePtr<vk::ProgramBinary>(compileProgram(iter.getProgram(), &buildInfo));
 		log << buildInfo;
+
+		if (isCompiled)
+			*isCompiled = true;
 	}
 	catch (const tcu::NotSupportedError& err)
 	{
@@ -118,6 +132,46 @@ vk::ProgramBinary* buildProgram (const std::string&					casePath,
 		throw;
 	}
 
+	return binProg;
+}
+
+template <typename InfoType, typename IteratorType>
+vk::ProgramBinary* buildProgram (const std::string&					casePath,
+								 IteratorType						iter,
+								 const vk::BinaryRegistryReader&	prebuiltBinRegistry,
+								 vk::ProgramBinaryCache*			binaryCache,
+								 tcu::TestLog&						log,
+								 vk::BinaryCollection*				progCollection)
+{
+	const vk::ProgramIdentifier		progId		(casePath, iter.getName());
+	const tcu::ScopedLogSection		progSection	(log, iter.getName(), "Program: " + iter.getName());
+	de::MovePtr<vk::ProgramBinary>	binProg;
+
+	if (binaryCache)
+	{
+		const de::Sha1	cacheKey	= getCacheKey(iter.getProgram());
+
+		binProg = de::MovePtr<vk::ProgramBinary>(binaryCache->loadProgram(cacheKey));
+
+		if (binProg)
+		{
+			log << tcu::TestLog::Message << "Using cached binary " << cacheKey.toString() << tcu::TestLog::EndMessage;
+			log << iter.getProgram();
+		}
+		else
+		{
+			bool isCompiled = false;
+
+			binProg = compileOrLoadPrebuiltProgram<InfoType, IteratorType>(progId, iter, prebuiltBinRegistry, log, &isCompiled);
+
+			// \note Failing to populate cache is not fatal
+			if (isCompiled && !binaryCache->storeProgram(cacheKey, *binProg))
+				log << tcu::TestLog::Message << "WARNING: Failed to store binary " << cacheKey.toString() << " to cache" << tcu::TestLog::EndMessage;
+		}
+	}
+	else
+		binProg = compileOrLoadPrebuiltProgram<InfoType, IteratorType>(progId, iter, prebuiltBinRegistry, log, DE_NULL);
+
 	TCU_CHECK_INTERNAL(binProg);
 
 	{
@@ -139,6 +193,119 @@ using de::UniquePtr;
 using de::MovePtr;
 using tcu::TestLog;
 
+static void buildCasePrograms (const TestCase&					vktCase,
+							   const std::string&				casePath,
+							   const vk::BinaryRegistryReader&	prebuiltBinRegistry,
+							   vk::ProgramBinaryCache*			binaryCache,
+							   TestLog&							log,
+							   vk::BinaryCollection*			progCollection)
+{
+	vk::SourceCollections	sourceProgs;
+
+	vktCase.initPrograms(sourceProgs);
+
+	for (vk::GlslSourceCollection::Iterator progIter = sourceProgs.glslSources.begin(); progIter != sourceProgs.glslSources.end(); ++progIter)
+	{
+		vk::ProgramBinary* binProg = buildProgram<glu::ShaderProgramInfo, vk::GlslSourceCollection::Iterator>(casePath, progIter, prebuiltBinRegistry, binaryCache, log, progCollection);
+
+		try
+		{
+			std::ostringstream disasm;
+
+			vk::disassembleSpirV(binProg->getSize(), binProg->getBinary(), &disasm);
+
+			log << TestLog::KernelSource(disasm.str());
+		}
+		catch (const tcu::NotSupportedError& err)
+		{
+			log << err;
+		}
+	}
+
+	for (vk::SpirVAsmCollection::Iterator asmIterator = sourceProgs.spirvAsmSources.begin(); asmIterator != sourceProgs.spirvAsmSources.end(); ++asmIterator)
+	{
+		buildProgram<vk::SpirVProgramInfo, vk::SpirVAsmCollection::Iterator>(casePath, asmIterator, prebuiltBinRegistry, binaryCache, log, progCollection);
+		log << TestLog::KernelSource((*asmIterator).program.str());
+	}
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Builds programs of the next test case while current case executes
+ *
+ * Build log is written into a buffer log and copied to the main log only
+ * when the programs are taken into use. Failed builds are discarded, and
+ * the case builds its programs again in init() so that errors are reported
+ * the usual way.
+ *
+ * \note Binary registry and cache are not thread-safe. Executor must join
+ *		 the thread before accessing them itself.
+ *//*--------------------------------------------------------------------*/
+class ProgramBuildThread : public de::Thread
+{
+public:
+	ProgramBuildThread (const TestCase&					testCase,
+						const std::string&				casePath,
+						const vk::BinaryRegistryReader&	prebuiltBinRegistry,
+						vk::ProgramBinaryCache*			binaryCache,
+						const TestLog&					mainLog)
+		: m_testCase			(testCase)
+		, m_casePath			(casePath)
+		, m_prebuiltBinRegistry	(prebuiltBinRegistry)
+		, m_binaryCache			(binaryCache)
+		, m_log					(mainLog.createBufferLog())
+		, m_isOk				(false)
+	{
+	}
+
+	~ProgramBuildThread (void)
+	{
+		if (isStarted())
+			join();
+	}
+
+	void run (void)
+	{
+		try
+		{
+			buildCasePrograms(m_testCase, m_casePath, m_prebuiltBinRegistry, m_binaryCache, *m_log, &m_programs);
+			m_isOk = true;
+		}
+		catch (const std::exception&)
+		{
+			// Error is reported when case builds its programs again in init().
+		}
+	}
+
+	bool isForCase (const TestCase* testCase, const std::string& casePath) const
+	{
+		return &m_testCase == testCase && m_casePath == casePath;
+	}
+
+	//! Move built programs to progCollection and build log to log. Returns false if build failed. Thread must be joined first.
+	bool takePrograms (TestLog& log, vk::BinaryCollection* progCollection)
+	{
+		DE_ASSERT(!isStarted());
+
+		if (!m_isOk)
+			return false;
+
+		log.appendBufferLog(*m_log);
+		progCollection->swap(m_programs);
+
+		return true;
+	}
+
+private:
+	const TestCase&						m_testCase;
+	const std::string					m_casePath;
+	const vk::BinaryRegistryReader&		m_prebuiltBinRegistry;
+	vk::ProgramBinaryCache* const		m_binaryCache;
+
+	const UniquePtr<TestLog>			m_log;
+	vk::BinaryCollection				m_programs;
+	bool								m_isOk;
+};
+
 // TestCaseExecutor
 
 class TestCaseExecutor : public tcu::TestCaseExecutor
@@ -152,14 +319,19 @@ public:
 
 	virtual tcu::TestNode::IterateResult	iterate				(tcu::TestCase* testCase);
 
+	virtual void							prepareNextCase		(tcu::TestCase* nextCase, const std::string& nextCasePath);
+
 private:
 	vk::BinaryCollection					m_progCollection;
 	vk::BinaryRegistryReader				m_prebuiltBinRegistry;
+	de::UniquePtr<vk::ProgramBinaryCache>	m_binaryCache;		//!< Compiled binary cache, or null if disabled
 
 	de::UniquePtr<vk::Library>				m_library;
 	Context									m_context;
 
 	TestInstance*							m_instance;			//!< Current test case instance
+	MovePtr<ProgramBuildThread>				m_nextCasePrograms;	//!< Programs of the next case being built in background, or null
+	std::string								m_resourceGroup;	//!< Top-level group that owns context resources
 };
 
 static MovePtr<vk::Library> createLibrary (tcu::TestContext& testCtx)
@@ -167,8 +339,25 @@ static MovePtr<vk::Library> createLibrary (tcu::TestContext& testCtx)
 	return MovePtr<vk::Library>(testCtx.getPlatform().getVulkanPlatform().createLibrary());
 }
 
+static MovePtr<vk::ProgramBinaryCache> createBinaryCache (tcu::TestContext& testCtx)
+{
+	const char* const	cacheDir	= testCtx.getCommandLine().getVKProgramCacheDir();
+
+	return MovePtr<vk::ProgramBinaryCache>(cacheDir ? new vk::ProgramBinaryCache(cacheDir) : DE_NULL);
+}
+
+//! Get path of top-level group (e.g. dEQP-VK.glsl) containing case.
+static std::string getTopLevelGroupPath (const std::string& casePath)
+{
+	const size_t	packageEnd	= casePath.find('.');
+	const size_t	groupEnd	= packageEnd != std::string::npos ? casePath.find('.', packageEnd+1) : std::string::npos;
+
+	return casePath.substr(0, groupEnd);
+}
+
 TestCaseExecutor::TestCaseExecutor (tcu::TestContext& testCtx)
 	: m_prebuiltBinRegistry	(testCtx.getArchive(), "vulkan/prebuilt")
+	, m_binaryCache			(createBinaryCache(testCtx))
 	, m_library				(createLibrary(testCtx))
 	, m_context				(testCtx, m_library->getPlatformInterface(), m_progCollection)
 	, m_instance			(DE_NULL)
@@ -177,55 +366,70 @@ TestCaseExecutor::TestCaseExecutor (tcu::TestContext& testCtx)
 
 TestCaseExecutor::~TestCaseExecutor (void)
 {
+	// Build thread must finish before registry and cache are destroyed.
+	m_nextCasePrograms.clear();
+
 	delete m_instance;
 }
 
 void TestCaseExecutor::init (tcu::TestCase* testCase, const std::string& casePath)
 {
-	const TestCase*			vktCase		= dynamic_cast<TestCase*>(testCase);
-	tcu::TestLog&			log			= m_context.getTestContext().getLog();
-	vk::SourceCollections	sourceProgs;
-
-	DE_UNREF(casePath); // \todo [2015-03-13 pyry] Use this to identify ProgramCollection storage path
+	const TestCase*			vktCase			= dynamic_cast<TestCase*>(testCase);
+	tcu::TestLog&			log				= m_context.getTestContext().getLog();
+	bool					isPrepared		= false;
 
 	if (!vktCase)
 		TCU_THROW(InternalError, "Test node not an instance of vkt::TestCase");
 
 	m_progCollection.clear();
-	vktCase->initPrograms(sourceProgs);
 
-	for (vk::GlslSourceCollection::Iterator progIter = sourceProgs.glslSources.begin(); progIter != sourceProgs.glslSources.end(); ++progIter)
+	if (m_nextCasePrograms)
 	{
-		vk::ProgramBinary* binProg = buildProgram<glu::ShaderProgramInfo, vk::GlslSourceCollection::Iterator>(casePath, progIter, m_prebuiltBinRegistry, log, &m_progCollection);
+		MovePtr<ProgramBuildThread>	preparedPrograms	= m_nextCasePrograms;
 
-		try
-		{
-			std::ostringstream disasm;
+		preparedPrograms->join();
+		isPrepared = preparedPrograms->isForCase(vktCase, casePath) && preparedPrograms->takePrograms(log, &m_progCollection);
+	}
 
-			vk::disassembleSpirV(binProg->getSize(), binProg->getBinary(), &disasm);
+	if (!isPrepared)
+		buildCasePrograms(*vktCase, casePath, m_prebuiltBinRegistry, m_binaryCache.get(), log, &m_progCollection);
 
-			log << TestLog::KernelSource(disasm.str());
-		}
-		catch (const tcu::NotSupportedError& err)
+	// Objects cached by one group of tests are not useful to other groups and would only hold on to device memory
+	{
+		const std::string	resourceGroup	= getTopLevelGroupPath(casePath);
+
+		if (resourceGroup != m_resourceGroup)
 		{
-			log << err;
+			m_context.releaseResources();
+			m_resourceGroup = resourceGroup;
 		}
 	}
 
-	for (vk::SpirVAsmCollection::Iterator asmIterator = sourceProgs.spirvAsmSources.begin(); asmIterator != sourceProgs.spirvAsmSources.end(); ++asmIterator)
-	{
-		buildProgram<vk::SpirVProgramInfo, vk::SpirVAsmCollection::Iterator>(casePath, asmIterator, m_prebuiltBinRegistry, log, &m_progCollection);
-		log << TestLog::KernelSource((*asmIterator).program.str());
-	}
-
 	DE_ASSERT(!m_instance);
+	m_context.resetCallStats();
 	m_instance = vktCase->createInstance(m_context);
 }
 
+void TestCaseExecutor::prepareNextCase (tcu::TestCase* nextCase, const std::string& nextCasePath)
+{
+	const TestCase* const	vktCase		= dynamic_cast<TestCase*>(nextCase);
+
+	DE_ASSERT(!m_nextCasePrograms);
+
+	if (!vktCase)
+		return;
+
+	m_nextCasePrograms = MovePtr<ProgramBuildThread>(new ProgramBuildThread(*vktCase, nextCasePath, m_prebuiltBinRegistry, m_binaryCache.get(), m_context.getTestContext().getLog()));
+	m_nextCasePrograms->start();
+}
+
 void TestCaseExecutor::deinit (tcu::TestCase*)
 {
 	delete m_instance;
 	m_instance = DE_NULL;
+
+	// \note Logged after instance is destroyed so that object destruction is accounted for
+	m_context.logCallStats(m_context.getTestContext().getLog());
 }
 
 tcu::TestNode::IterateResult TestCaseExecutor::iterate (tcu::TestCase*)
@@ -26,13 +26,16 @@
 #include "tcuTestContext.hpp"
 #include "tcuTestSessionExecutor.hpp"
 #include "tcuTestHierarchyUtil.hpp"
+#include "tcuTestHierarchyCache.hpp"
 #include "tcuCommandLine.hpp"
+#include "tcuCallTrace.hpp"
 #include "tcuTestLog.hpp"
 
 #include "qpInfo.h"
 #include "qpDebugOut.h"
 
 #include "deMath.h"
+#include "deUniquePtr.hpp"
 
 #include <iostream>
 
@@ -104,6 +107,9 @@ App::App (Platform& platform, Archive& archive, TestLog& log, const CommandLine&
 		if (cmdLine.isCrashHandlingEnabled())
 			TCU_CHECK_INTERNAL(m_crashHandler = qpCrashHandler_create(onCrash, this));
 
+		// Enable API call tracing
+		setDefaultCallTraceBufferSize((size_t)de::max(cmdLine.getCallTraceBufferSize(), 0));
+
 		// Create test context
 		m_testCtx = new TestContext(m_platform, archive, log, cmdLine, m_watchDog);
 
@@ -113,14 +119,21 @@ App::App (Platform& platform, Archive& archive, TestLog& log, const CommandLine&
 		// \note No executor is created if runmode is not EXECUTE
 		if (runMode == RUNMODE_EXECUTE)
 			m_testExecutor = new TestSessionExecutor(*m_testRoot, *m_testCtx);
-		else if (runMode == RUNMODE_DUMP_STDOUT_CASELIST)
-			writeCaselistsToStdout(*m_testRoot, *m_testCtx, cmdLine);
-		else if (runMode == RUNMODE_DUMP_XML_CASELIST)
-			writeXmlCaselistsToFiles(*m_testRoot, *m_testCtx, cmdLine);
-		else if (runMode == RUNMODE_DUMP_TEXT_CASELIST)
-			writeTxtCaselistsToFiles(*m_testRoot, *m_testCtx, cmdLine);
 		else
-			DE_ASSERT(false);
+		{
+			// Case lists can be exported from cached hierarchy instead of inflating all packages.
+			const de::UniquePtr<TestPackageRoot>	cachedRoot	(cmdLine.getCaseListCacheFile() ? createCachedTestHierarchy(*m_testRoot, *m_testCtx, cmdLine) : DE_NULL);
+			TestPackageRoot&						caseRoot	= cachedRoot ? *cachedRoot : *m_testRoot;
+
+			if (runMode == RUNMODE_DUMP_STDOUT_CASELIST)
+				writeCaselistsToStdout(caseRoot, *m_testCtx, cmdLine);
+			else if (runMode == RUNMODE_DUMP_XML_CASELIST)
+				writeXmlCaselistsToFiles(caseRoot, *m_testCtx, cmdLine);
+			else if (runMode == RUNMODE_DUMP_TEXT_CASELIST)
+				writeTxtCaselistsToFiles(caseRoot, *m_testCtx, cmdLine);
+			else
+				DE_ASSERT(false);
+		}
 	}
 	catch (const std::exception& e)
 	{
@@ -222,7 +235,10 @@ void App::onWatchdogTimeout (void)
 
 	m_crashed = true;
 
-	m_testCtx->getLog().terminateCase(QP_TEST_RESULT_TIMEOUT);
+	if (m_testExecutor)
+		m_testExecutor->openInterruptedCase();
+
+	m_testCtx->getMainLog().terminateCase(QP_TEST_RESULT_TIMEOUT);
 	die("Watchdog timer timeout");
 }
 
@@ -253,8 +269,9 @@ void App::onCrash (void)
 
 	if (isInCase)
 	{
-		qpCrashHandler_writeCrashInfo(m_crashHandler, writeCrashToLog, &m_testCtx->getLog());
-		m_testCtx->getLog().terminateCase(QP_TEST_RESULT_CRASH);
+		m_testExecutor->openInterruptedCase();
+		qpCrashHandler_writeCrashInfo(m_crashHandler, writeCrashToLog, &m_testCtx->getMainLog());
+		m_testCtx->getMainLog().terminateCase(QP_TEST_RESULT_CRASH);
 	}
 	else
 		qpCrashHandler_writeCrashInfo(m_crashHandler, writeCrashToConsole, DE_NULL);
@@ -0,0 +1,638 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright 2014 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Binary API call trace.
+ *
+ * Binary trace layout (writeBinary()), all integers are little-endian:
+ *
+ *  u8[4]	magic ("dECT")
+ *  u32		version
+ *  string	API name
+ *  u32		number of functions
+ *  functions:
+ *   string	name
+ *   string	argument types
+ *  u32		number of calls
+ *  calls:
+ *   u32	function index
+ *   u64	timestamp in microseconds
+ *   u64[]	argument values, count given by argument types
+ *
+ * Strings are stored as u32 length followed by characters.
+ * scripts/call_trace_to_text.py converts binary traces to text.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuCallTrace.hpp"
+#include "tcuTestLog.hpp"
+#include "deClock.h"
+#include "deMutex.hpp"
+#include "deThread.hpp"
+#include "deThreadLocal.hpp"
+#include "deAtomic.h"
+#include "deRandom.hpp"
+#include "deUniquePtr.hpp"
+
+#include <algorithm>
+#include <sstream>
+#include <cstring>
+
+namespace tcu
+{
+
+namespace
+{
+
+enum
+{
+	CALL_TRACE_VERSION	= 1
+};
+
+const deUint64	PADDING_HEADER		= ~(deUint64)0;
+const char		CALL_TRACE_MAGIC[]	= { 'd', 'E', 'C', 'T' };
+
+// Live buffer registry
+
+de::Mutex						s_registryLock;
+std::vector<CallTraceBuffer*>	s_buffers;
+size_t							s_defaultBufferSize	= 0;
+
+de::ThreadLocal					s_threadId;
+volatile deUint32				s_lastThreadId		= 0;
+
+void registerBuffer (CallTraceBuffer* buffer)
+{
+	de::ScopedLock lock(s_registryLock);
+	s_buffers.push_back(buffer);
+}
+
+void unregisterBuffer (CallTraceBuffer* buffer)
+{
+	de::ScopedLock lock(s_registryLock);
+	s_buffers.erase(std::find(s_buffers.begin(), s_buffers.end(), buffer));
+}
+
+// Record visitors
+
+class TextWriter
+{
+public:
+	TextWriter (const CallTraceFunction* functions)
+		: m_functions		(functions)
+		, m_firstTimestamp	(0)
+		, m_numCalls		(0)
+	{
+	}
+
+	void operator() (int functionNdx, deUint64 timestamp, const deUint64* args)
+	{
+		const CallTraceFunction&	function	= m_functions[functionNdx];
+		const int					numArgs		= (int)strlen(function.argTypes);
+
+		if (m_numCalls == 0)
+			m_firstTimestamp = timestamp;
+
+		m_str << "+" << (timestamp - m_firstTimestamp) << "us " << function.name << "(";
+
+		for (int argNdx = 0; argNdx < numArgs; argNdx++)
+		{
+			if (argNdx > 0)
+				m_str << ", ";
+
+			switch (function.argTypes[argNdx])
+			{
+				case 'i':	m_str << (deInt64)args[argNdx];		break;
+				case 'u':	m_str << args[argNdx];				break;
+				case 'f':
+				{
+					const deUint32	bits	= (deUint32)args[argNdx];
+					float			value;
+					deMemcpy(&value, &bits, sizeof(value));
+					m_str << value;
+					break;
+				}
+				case 'd':
+				{
+					double value;
+					deMemcpy(&value, &args[argNdx], sizeof(value));
+					m_str << value;
+					break;
+				}
+				default:
+					m_str << "0x" << std::hex << args[argNdx] << std::dec;
+					break;
+			}
+		}
+
+		m_str << ")\n";
+		m_numCalls += 1;
+	}
+
+	std::string		getText			(void) const { return m_str.str();	}
+	int				getNumCalls		(void) const { return m_numCalls;	}
+
+private:
+	const CallTraceFunction*	m_functions;
+	std::ostringstream			m_str;
+	deUint64					m_firstTimestamp;
+	int							m_numCalls;
+};
+
+void writeUint32 (std::ostream& str, deUint32 value)
+{
+	const deUint8 bytes[] =
+	{
+		(deUint8)(value & 0xff),
+		(deUint8)((value >> 8) & 0xff),
+		(deUint8)((value >> 16) & 0xff),
+		(deUint8)((value >> 24) & 0xff)
+	};
+	str.write((const char*)&bytes[0], sizeof(bytes));
+}
+
+void writeUint64 (std::ostream& str, deUint64 value)
+{
+	writeUint32(str, (deUint32)(value & 0xffffffffu));
+	writeUint32(str, (deUint32)(value >> 32));
+}
+
+void writeString (std::ostream& str, const char* value)
+{
+	const size_t len = strlen(value);
+	writeUint32(str, (deUint32)len);
+	str.write(value, (std::streamsize)len);
+}
+
+class BinaryWriter
+{
+public:
+	BinaryWriter (std::ostream& str, const CallTraceFunction* functions)
+		: m_str			(str)
+		, m_functions	(functions)
+	{
+	}
+
+	void operator() (int functionNdx, deUint64 timestamp, const deUint64* args)
+	{
+		const int numArgs = (int)strlen(m_functions[functionNdx].argTypes);
+
+		writeUint32(m_str, (deUint32)functionNdx);
+		writeUint64(m_str, timestamp);
+
+		for (int argNdx = 0; argNdx < numArgs; argNdx++)
+			writeUint64(m_str, args[argNdx]);
+	}
+
+private:
+	std::ostream&				m_str;
+	const CallTraceFunction*	m_functions;
+};
+
+class CallCounter
+{
+public:
+	CallCounter (void) : m_numCalls(0) {}
+
+	void	operator()		(int, deUint64, const deUint64*)	{ m_numCalls += 1;		}
+	int		getNumCalls		(void) const						{ return m_numCalls;	}
+
+private:
+	int		m_numCalls;
+};
+
+} // anonymous
+
+// CallTraceBuffer
+
+CallTraceBuffer::CallTraceBuffer (const char* apiName, const CallTraceFunction* functions, int numFunctions, size_t bufferSize)
+	: m_apiName			(apiName)
+	, m_functions		(functions)
+	, m_numFunctions	(numFunctions)
+	, m_capacity		((int)de::clamp<size_t>(bufferSize / sizeof(deUint64), MIN_CAPACITY, 0x7fffffff))
+	, m_ownerThread		(getCallTraceThreadId())
+	, m_head			(0)
+	, m_tail			(0)
+	, m_numRecords		(0)
+{
+	registerBuffer(this);
+}
+
+CallTraceBuffer::~CallTraceBuffer (void)
+{
+	unregisterBuffer(this);
+}
+
+void CallTraceBuffer::clear (void)
+{
+	m_head			= 0;
+	m_tail			= 0;
+	m_numRecords	= 0;
+}
+
+void CallTraceBuffer::discardOldest (void)
+{
+	const deUint64 header = m_words[m_tail];
+
+	DE_ASSERT(m_numRecords > 0);
+
+	if (header == PADDING_HEADER)
+		m_tail = 0;
+	else
+	{
+		m_tail += RECORD_HEADER_SIZE + (int)(header >> 32);
+		if (m_tail == m_capacity)
+			m_tail = 0;
+	}
+
+	m_numRecords -= 1;
+
+	if (m_numRecords == 0)
+		m_tail = m_head;
+}
+
+deUint64* CallTraceBuffer::makeRoom (int recordSize)
+{
+	if (m_words.empty())
+		m_words.resize((size_t)m_capacity);
+
+	DE_ASSERT(recordSize <= m_capacity);
+
+	if (m_head + recordSize > m_capacity)
+	{
+		// Discard records between head and end of buffer and wrap around.
+		while (m_numRecords > 0 && m_tail >= m_head)
+			discardOldest();
+
+		if (m_numRecords == 0)
+			m_tail = 0;
+		else if (m_head < m_capacity)
+		{
+			m_words[m_head]	= PADDING_HEADER;
+			m_numRecords	+= 1;
+		}
+
+		m_head = 0;
+	}
+
+	// Discard records overlapping with the new record.
+	while (m_numRecords > 0 && m_tail >= m_head && m_tail < m_head + recordSize)
+		discardOldest();
+
+	if (m_numRecords == 0)
+		m_tail = m_head;
+
+	{
+		deUint64* const record = &m_words[m_head];
+
+		m_head			+= recordSize;
+		m_numRecords	+= 1;
+
+		return record;
+	}
+}
+
+template <typename Visitor>
+void CallTraceBuffer::visitRecords (Visitor& visitor) const
+{
+	int pos = m_tail;
+
+	for (int recordNdx = 0; recordNdx < m_numRecords; recordNdx++)
+	{
+		const deUint64 header = m_words[pos];
+
+		if (header == PADDING_HEADER)
+		{
+			pos = 0;
+			continue;
+		}
+
+		visitor((int)(header & 0xffffffffu), m_words[pos+1], &m_words[pos+RECORD_HEADER_SIZE]);
+
+		pos += RECORD_HEADER_SIZE + (int)(header >> 32);
+		if (pos == m_capacity)
+			pos = 0;
+	}
+}
+
+void CallTraceBuffer::log (TestLog& log) const
+{
+	TextWriter writer(m_functions);
+
+	visitRecords(writer);
+
+	log << TestLog::Section("CallTrace", std::string(m_apiName) + " call trace")
+		<< TestLog::Message << "Last " << writer.getNumCalls() << " calls:\n" << writer.getText() << TestLog::EndMessage
+		<< TestLog::EndSection;
+}
+
+void CallTraceBuffer::writeBinary (std::ostream& str) const
+{
+	CallCounter counter;
+
+	visitRecords(counter);
+
+	str.write(&CALL_TRACE_MAGIC[0], sizeof(CALL_TRACE_MAGIC));
+	writeUint32(str, CALL_TRACE_VERSION);
+	writeString(str, m_apiName);
+	writeUint32(str, (deUint32)m_numFunctions);
+
+	for (int ndx = 0; ndx < m_numFunctions; ndx++)
+	{
+		writeString(str, m_functions[ndx].name);
+		writeString(str, m_functions[ndx].argTypes);
+	}
+
+	writeUint32(str, (deUint32)counter.getNumCalls());
+
+	{
+		BinaryWriter writer(str, m_functions);
+		visitRecords(writer);
+	}
+}
+
+deUint64 getCallTraceTimestamp (void)
+{
+	return deGetMicroseconds();
+}
+
+deUint32 getCallTraceThreadId (void)
+{
+	deUint32 threadId = (deUint32)(deUintptr)s_threadId.get();
+
+	if (threadId == 0)
+	{
+		threadId = deAtomicIncrementUint32(&s_lastThreadId);
+		s_threadId.set((void*)(deUintptr)threadId);
+	}
+
+	return threadId;
+}
+
+// Global trace control
+
+void setDefaultCallTraceBufferSize (size_t bufferSize)
+{
+	de::ScopedLock lock(s_registryLock);
+	s_defaultBufferSize = bufferSize;
+}
+
+size_t getDefaultCallTraceBufferSize (void)
+{
+	de::ScopedLock lock(s_registryLock);
+	return s_defaultBufferSize;
+}
+
+namespace
+{
+
+void logThreadCallTraces (TestLog& log, deUint32 threadId)
+{
+	for (size_t ndx = 0; ndx < s_buffers.size(); ndx++)
+	{
+		if (s_buffers[ndx]->getOwnerThread() == threadId && !s_buffers[ndx]->empty())
+			s_buffers[ndx]->log(log);
+	}
+}
+
+} // anonymous
+
+void clearCallTraces (void)
+{
+	const deUint32	threadId	= getCallTraceThreadId();
+	de::ScopedLock	lock		(s_registryLock);
+
+	for (size_t ndx = 0; ndx < s_buffers.size(); ndx++)
+	{
+		if (s_buffers[ndx]->getOwnerThread() == threadId)
+			s_buffers[ndx]->clear();
+	}
+}
+
+void logCallTraces (TestLog& log)
+{
+	const deUint32	threadId	= getCallTraceThreadId();
+	de::ScopedLock	lock		(s_registryLock);
+
+	logThreadCallTraces(log, threadId);
+}
+
+void logInterruptedCallTraces (TestLog& log, deUint32 threadId)
+{
+	// \note Interrupted thread may hold the lock, waiting for it could deadlock.
+	if (!s_registryLock.tryLock())
+		return;
+
+	try
+	{
+		logThreadCallTraces(log, threadId);
+	}
+	catch (...)
+	{
+		s_registryLock.unlock();
+		throw;
+	}
+
+	s_registryLock.unlock();
+}
+
+// Self-test
+
+namespace
+{
+
+class BinaryTraceReader
+{
+public:
+	BinaryTraceReader (const std::string& data) : m_data(data), m_pos(0) {}
+
+	std::string readBytes (size_t numBytes)
+	{
+		TCU_CHECK(m_pos + numBytes <= m_data.size());
+		m_pos += numBytes;
+		return m_data.substr(m_pos - numBytes, numBytes);
+	}
+
+	deUint32 readUint32 (void)
+	{
+		const std::string	bytes	= readBytes(4);
+		deUint32			value	= 0;
+
+		for (int ndx = 0; ndx < 4; ndx++)
+			value |= (deUint32)(deUint8)bytes[ndx] << (8*ndx);
+
+		return value;
+	}
+
+	deUint64 readUint64 (void)
+	{
+		const deUint64 low = readUint32();
+		return low | ((deUint64)readUint32() << 32);
+	}
+
+	std::string	readString	(void)			{ return readBytes(readUint32());		}
+	bool		isAtEnd		(void) const	{ return m_pos == m_data.size();	}
+
+private:
+	const std::string&	m_data;
+	size_t				m_pos;
+};
+
+deUint64 getSelfTestArg (int callNdx, int argNdx)
+{
+	return ((deUint64)callNdx << 32) | (deUint64)argNdx;
+}
+
+void checkSelfTestTrace (const CallTraceBuffer& trace, const CallTraceFunction* functions, int numFunctions, const std::vector<int>& calls, int minCalls)
+{
+	std::ostringstream	str;
+
+	trace.writeBinary(str);
+
+	{
+		const std::string	data		= str.str();
+		BinaryTraceReader	reader		(data);
+
+		TCU_CHECK(reader.readBytes(sizeof(CALL_TRACE_MAGIC)) == std::string(&CALL_TRACE_MAGIC[0], sizeof(CALL_TRACE_MAGIC)));
+		TCU_CHECK(reader.readUint32() == CALL_TRACE_VERSION);
+		TCU_CHECK(reader.readString() == "Test");
+		TCU_CHECK(reader.readUint32() == (deUint32)numFunctions);
+
+		for (int ndx = 0; ndx < numFunctions; ndx++)
+		{
+			TCU_CHECK(reader.readString() == functions[ndx].name);
+			TCU_CHECK(reader.readString() == functions[ndx].argTypes);
+		}
+
+		{
+			const int	numCalls	= (int)reader.readUint32();
+			deUint64	prevTime	= 0;
+
+			// Most recent calls must be retained in order.
+			TCU_CHECK(numCalls <= (int)calls.size());
+			TCU_CHECK(numCalls >= de::min(minCalls, (int)calls.size()));
+
+			for (int ndx = 0; ndx < numCalls; ndx++)
+			{
+				const int		callNdx		= (int)calls.size() - numCalls + ndx;
+				const int		functionNdx	= (int)reader.readUint32();
+				const deUint64	timestamp	= reader.readUint64();
+
+				TCU_CHECK(functionNdx == calls[callNdx]);
+				TCU_CHECK(timestamp >= prevTime);
+
+				for (int argNdx = 0; argNdx < (int)strlen(functions[functionNdx].argTypes); argNdx++)
+					TCU_CHECK(reader.readUint64() == getSelfTestArg(callNdx, argNdx));
+
+				prevTime = timestamp;
+			}
+		}
+
+		TCU_CHECK(reader.isAtEnd());
+	}
+}
+
+//! Creates a buffer and records a call in a separate thread.
+class OtherThreadTrace : public de::Thread
+{
+public:
+	OtherThreadTrace (const CallTraceFunction* functions, int numFunctions)
+		: m_functions		(functions)
+		, m_numFunctions	(numFunctions)
+	{
+	}
+
+	void run (void)
+	{
+		m_trace = de::MovePtr<CallTraceBuffer>(new CallTraceBuffer("Other", m_functions, m_numFunctions, 1024));
+		m_trace->recordCall(0, 0);
+	}
+
+	const CallTraceBuffer& getTrace (void) const { return *m_trace; }
+
+private:
+	const CallTraceFunction* const	m_functions;
+	const int						m_numFunctions;
+	de::MovePtr<CallTraceBuffer>	m_trace;
+};
+
+} // anonymous
+
+void CallTraceBuffer_selfTest (void)
+{
+	static const CallTraceFunction s_functions[] =
+	{
+		{ "none",	""			},
+		{ "one",	"i"			},
+		{ "two",	"uf"		},
+		{ "five",	"xdpiu"		},
+		{ "eight",	"iiiiiiii"	},
+	};
+
+	const int			numFunctions	= DE_LENGTH_OF_ARRAY(s_functions);
+	const int			maxRecordSize	= 2 + 8;
+	const size_t		bufferSize		= 1024;
+	const int			minCalls		= (int)(bufferSize / sizeof(deUint64)) / maxRecordSize - 1;
+	CallTraceBuffer		trace			("Test", s_functions, numFunctions, bufferSize);
+	de::Random			rnd				(0x2ce31f02);
+	std::vector<int>	calls;
+
+	TCU_CHECK(trace.empty());
+
+	for (int callNdx = 0; callNdx < 2000; callNdx++)
+	{
+		const int			functionNdx	= rnd.getInt(0, numFunctions-1);
+		const int			numArgs		= (int)strlen(s_functions[functionNdx].argTypes);
+		deUint64* const		args		= trace.recordCall(functionNdx, numArgs);
+
+		for (int argNdx = 0; argNdx < numArgs; argNdx++)
+			args[argNdx] = getSelfTestArg(callNdx, argNdx);
+
+		calls.push_back(functionNdx);
+
+		if (callNdx < 200 || callNdx % 97 == 0)
+			checkSelfTestTrace(trace, s_functions, numFunctions, calls, minCalls);
+	}
+
+	trace.clear();
+	calls.clear();
+
+	TCU_CHECK(trace.empty());
+	checkSelfTestTrace(trace, s_functions, numFunctions, calls, 0);
+
+	// Buffers owned by other threads are not cleared
+	{
+		OtherThreadTrace	otherThread	(s_functions, numFunctions);
+
+		otherThread.start();
+		otherThread.join();
+
+		trace.recordCall(0, 0);
+		TCU_CHECK(otherThread.getTrace().getOwnerThread() != trace.getOwnerThread());
+
+		clearCallTraces();
+
+		TCU_CHECK(trace.empty());
+		TCU_CHECK(!otherThread.getTrace().empty());
+	}
+
+	TCU_CHECK(callTraceArg(1.0f) == 0x3f800000u);
+	TCU_CHECK(callTraceArg(-1) == ~(deUint64)0);
+}
+
+} // tcu
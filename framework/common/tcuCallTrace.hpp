@@ -0,0 +1,190 @@
+#ifndef _TCUCALLTRACE_HPP
+#define _TCUCALLTRACE_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright 2014 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Binary API call trace.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuDefs.hpp"
+#include "deMemory.h"
+
+#include <ostream>
+#include <vector>
+
+namespace tcu
+{
+
+class TestLog;
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Traced function description
+ *
+ * Argument types are given as a string with one character per argument:
+ *  'i'	signed integer
+ *  'u'	unsigned integer
+ *  'x'	enum or bitfield, shown in hex
+ *  'f'	float
+ *  'd'	double
+ *  'p'	pointer or handle
+ *//*--------------------------------------------------------------------*/
+struct CallTraceFunction
+{
+	const char*		name;
+	const char*		argTypes;
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Ring buffer of recent API calls
+ *
+ * Each call is stored as function index, timestamp and raw argument
+ * values. No formatting is done until the trace is written out, so
+ * tracing is cheap enough to be left on.
+ *
+ * Buffer memory is allocated on first recorded call. Once the buffer is
+ * full, oldest calls are discarded. Recording is not synchronized; calls
+ * must be recorded only by the thread that created the buffer.
+ *
+ * All live buffers are tracked so that traces can be dumped to the test
+ * log when a test case fails (see logCallTraces()). Buffers are logged and
+ * cleared only by their owning thread, so that cases running in other
+ * threads don't see each other's calls.
+ *//*--------------------------------------------------------------------*/
+class CallTraceBuffer
+{
+public:
+								CallTraceBuffer		(const char* apiName, const CallTraceFunction* functions, int numFunctions, size_t bufferSize);
+								~CallTraceBuffer	(void);
+
+	//! Record call and return storage for numArgs argument values.
+	inline deUint64*			recordCall			(int functionNdx, int numArgs);
+
+	void						clear				(void);
+	bool						empty				(void) const { return m_numRecords == 0; }
+	deUint32					getOwnerThread		(void) const { return m_ownerThread; }
+
+	void						log					(TestLog& log) const;
+	void						writeBinary			(std::ostream& str) const;
+
+private:
+								CallTraceBuffer		(const CallTraceBuffer& other);
+	CallTraceBuffer&			operator=			(const CallTraceBuffer& other);
+
+	enum
+	{
+		RECORD_HEADER_SIZE	= 2,	//!< Function index & argument count, timestamp
+		MIN_CAPACITY		= 256	//!< Large enough for any call
+	};
+
+	deUint64*					makeRoom			(int recordSize);
+	void						discardOldest		(void);
+
+	template <typename Visitor>
+	void						visitRecords		(Visitor& visitor) const;
+
+	const char* const			m_apiName;
+	const CallTraceFunction*	m_functions;
+	const int					m_numFunctions;
+	const int					m_capacity;			//!< In 64-bit words.
+	const deUint32				m_ownerThread;		//!< getCallTraceThreadId() of creating thread.
+
+	std::vector<deUint64>		m_words;
+	int							m_head;				//!< Next record is written here.
+	int							m_tail;				//!< Oldest record.
+	int							m_numRecords;		//!< Includes padding records.
+};
+
+deUint64	getCallTraceTimestamp	(void);
+
+//! Get non-zero id of calling thread for matching buffers to their owners.
+deUint32	getCallTraceThreadId	(void);
+
+inline deUint64* CallTraceBuffer::recordCall (int functionNdx, int numArgs)
+{
+	const int	recordSize	= RECORD_HEADER_SIZE + numArgs;
+	deUint64*	record;
+
+	DE_ASSERT(de::inBounds(functionNdx, 0, m_numFunctions));
+
+	// Fast path: space is available without wrapping or discarding old records.
+	if (!m_words.empty() && m_head + recordSize <= m_capacity && (m_numRecords == 0 || m_tail < m_head))
+	{
+		record = &m_words[m_head];
+		m_head			+= recordSize;
+		m_numRecords	+= 1;
+	}
+	else
+		record = makeRoom(recordSize);
+
+	record[0] = (deUint64)(deUint32)functionNdx | ((deUint64)(deUint32)numArgs << 32);
+	record[1] = getCallTraceTimestamp();
+
+	return record + RECORD_HEADER_SIZE;
+}
+
+// Argument value conversion.
+
+template <typename T>
+inline deUint64 callTraceArg (T value)
+{
+	return (deUint64)value;
+}
+
+template <typename T>
+inline deUint64 callTraceArg (T* value)
+{
+	return (deUint64)(deUintptr)value;
+}
+
+inline deUint64 callTraceArg (float value)
+{
+	deUint32 bits;
+	deMemcpy(&bits, &value, sizeof(bits));
+	return (deUint64)bits;
+}
+
+inline deUint64 callTraceArg (double value)
+{
+	deUint64 bits;
+	deMemcpy(&bits, &value, sizeof(bits));
+	return bits;
+}
+
+// Global trace control.
+
+//! Set buffer size for traces enabled by default. 0 disables tracing by default.
+void		setDefaultCallTraceBufferSize	(size_t bufferSize);
+size_t		getDefaultCallTraceBufferSize	(void);
+
+//! Clear live call trace buffers owned by calling thread.
+void		clearCallTraces					(void);
+
+//! Write non-empty live call trace buffers owned by calling thread to log.
+void		logCallTraces					(TestLog& log);
+
+//! Write non-empty live call trace buffers owned by given thread to log.
+//! \note For crash and watchdog handlers. Nothing is written if buffer registry is locked.
+void		logInterruptedCallTraces		(TestLog& log, deUint32 threadId);
+
+void		CallTraceBuffer_selfTest		(void);
+
+} // tcu
+
+#endif // _TCUCALLTRACE_HPP
@@ -0,0 +1,81 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright 2014 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Test case timing file.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuCaseTimingFile.hpp"
+#include "deStringUtil.hpp"
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+using std::string;
+
+namespace tcu
+{
+
+void readCaseTimingFile (const char* filename, CaseTimingMap& dst)
+{
+	std::ifstream	in		(filename, std::ifstream::in);
+	string			line;
+	int				lineNdx	= 0;
+
+	if (!in.good())
+		throw std::runtime_error(string("Failed to open '") + filename + "'");
+
+	while (std::getline(in, line))
+	{
+		std::istringstream	lineStr		(line);
+		deInt64				duration	= 0;
+		string				casePath;
+
+		lineNdx += 1;
+
+		if (line.empty() || line[0] == '#')
+			continue;
+
+		lineStr >> duration >> casePath;
+
+		if (lineStr.fail() || duration < 0 || casePath.empty())
+			throw std::runtime_error(string(filename) + ":" + de::toString(lineNdx) + ": invalid timing entry");
+
+		dst[casePath] = duration;
+	}
+}
+
+void writeCaseTimingFile (const char* filename, const CaseTimingMap& src)
+{
+	std::ofstream out(filename, std::ofstream::out|std::ofstream::trunc);
+
+	if (!out.good())
+		throw std::runtime_error(string("Failed to open '") + filename + "' for writing");
+
+	for (CaseTimingMap::const_iterator iter = src.begin(); iter != src.end(); ++iter)
+		out << iter->second << " " << iter->first << "\n";
+
+	out.close();
+
+	if (out.fail())
+		throw std::runtime_error(string("Failed to write '") + filename + "'");
+}
+
+} // tcu
@@ -0,0 +1,52 @@
+#ifndef _TCUCASETIMINGFILE_HPP
+#define _TCUCASETIMINGFILE_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright 2014 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Test case timing file.
+ *
+ * File has one "<duration in us> <case path>" line per case. Empty lines
+ * and lines starting with '#' are ignored. Written by the executor
+ * --timings option and read by the test binary for watchdog limits
+ * (--deqp-watchdog-timings).
+ *
+ * \note Used by the executor too, so this must not depend on the rest of
+ *       the test framework.
+ *//*--------------------------------------------------------------------*/
+
+#include "deDefs.hpp"
+
+#include <map>
+#include <string>
+
+namespace tcu
+{
+
+typedef std::map<std::string, deInt64> CaseTimingMap;	//!< Case path -> duration in microseconds
+
+//! Read timing file into dst. Existing entries for the same cases are replaced. Throws std::runtime_error on failure.
+void	readCaseTimingFile		(const char* filename, CaseTimingMap& dst);
+
+//! Write timings sorted by case path. Throws std::runtime_error on failure.
+void	writeCaseTimingFile		(const char* filename, const CaseTimingMap& src);
+
+} // tcu
+
+#endif // _TCUCASETIMINGFILE_HPP
@@ -28,6 +28,7 @@
 #include "deStringUtil.hpp"
 #include "deString.h"
 #include "deInt32.h"
+#include "deMemory.h"
 #include "deCommandLine.h"
 #include "qpTestLog.h"
 #include "qpDebugOut.h"
@@ -37,6 +38,7 @@
 #include <sstream>
 #include <fstream>
 #include <iostream>
+#include <cstring>
 
 using std::string;
 using std::vector;
@@ -84,6 +86,19 @@ DE_DECLARE_COMMAND_LINE_OPT(LogImages,					bool);
 DE_DECLARE_COMMAND_LINE_OPT(LogShaderSources,			bool);
 DE_DECLARE_COMMAND_LINE_OPT(TestOOM,					bool);
 DE_DECLARE_COMMAND_LINE_OPT(VKDeviceID,					int);
+DE_DECLARE_COMMAND_LINE_OPT(VKProgramCacheDir,			std::string);
+DE_DECLARE_COMMAND_LINE_OPT(VKAllocator,				tcu::VKAllocatorType);
+DE_DECLARE_COMMAND_LINE_OPT(VKCallStats,				bool);
+DE_DECLARE_COMMAND_LINE_OPT(VKBenchmarks,				bool);
+DE_DECLARE_COMMAND_LINE_OPT(ResourceArchive,			std::string);
+DE_DECLARE_COMMAND_LINE_OPT(CallTraceBufferSize,		int);
+DE_DECLARE_COMMAND_LINE_OPT(ShardCount,					int);
+DE_DECLARE_COMMAND_LINE_OPT(ShardIndex,					int);
+DE_DECLARE_COMMAND_LINE_OPT(ShardMode,					tcu::ShardMode);
+DE_DECLARE_COMMAND_LINE_OPT(CaseListCacheFile,			std::string);
+DE_DECLARE_COMMAND_LINE_OPT(ForkServer,					bool);
+DE_DECLARE_COMMAND_LINE_OPT(WatchDogTimingsFile,		std::string);
+DE_DECLARE_COMMAND_LINE_OPT(WorkerThreads,				int);
 
 static void parseIntList (const char* src, std::vector<int>* dst)
 {
@@ -136,6 +151,16 @@ void registerOptions (de::cmdline::Parser& parser)
 		{ "180",			SCREENROTATION_180			},
 		{ "270",			SCREENROTATION_270			}
 	};
+	static const NamedValue<tcu::ShardMode> s_shardModes[] =
+	{
+		{ "hash",			SHARDMODE_HASH				},
+		{ "round-robin",	SHARDMODE_ROUND_ROBIN		}
+	};
+	static const NamedValue<tcu::VKAllocatorType> s_vkAllocatorTypes[] =
+	{
+		{ "simple",			VKALLOCATORTYPE_SIMPLE		},
+		{ "pool",			VKALLOCATORTYPE_POOL		}
+	};
 
 	parser
 		<< Option<CasePath>				("n",		"deqp-case",					"Test case(s) to run, supports wildcards (e.g. dEQP-GLES2.info.*)")
@@ -147,6 +172,7 @@ void registerOptions (de::cmdline::Parser& parser)
 																																		s_runModes,			"execute")
 		<< Option<ExportFilenamePattern>(DE_NULL,	"deqp-caselist-export-file",	"Set the target file name pattern for caselist export",					"${packageName}-cases.${typeExtension}")
 		<< Option<WatchDog>				(DE_NULL,	"deqp-watchdog",				"Enable test watchdog",								s_enableNames,		"disable")
+		<< Option<WatchDogTimingsFile>	(DE_NULL,	"deqp-watchdog-timings",		"Derive per-case watchdog limits from case duration file (as written by executor --timings)")
 		<< Option<CrashHandler>			(DE_NULL,	"deqp-crashhandler",			"Enable crash handling",							s_enableNames,		"disable")
 		<< Option<BaseSeed>				(DE_NULL,	"deqp-base-seed",				"Base seed for test cases that use randomization",						"0")
 		<< Option<TestIterationCount>	(DE_NULL,	"deqp-test-iteration-count",	"Iteration count for cases that support variable number of iterations",	"0")
@@ -166,9 +192,21 @@ void registerOptions (de::cmdline::Parser& parser)
 		<< Option<EGLWindowType>		(DE_NULL,	"deqp-egl-window-type",			"EGL native window type")
 		<< Option<EGLPixmapType>		(DE_NULL,	"deqp-egl-pixmap-type",			"EGL native pixmap type")
 		<< Option<VKDeviceID>			(DE_NULL,	"deqp-vk-device-id",			"Vulkan device ID (IDs start from 1)",									"1")
+		<< Option<VKProgramCacheDir>	(DE_NULL,	"deqp-vk-program-cache-dir",	"Cache compiled SPIR-V binaries in given directory")
+		<< Option<VKAllocator>			(DE_NULL,	"deqp-vk-allocator",			"Default device memory allocator for Vulkan tests",	s_vkAllocatorTypes,	"simple")
+		<< Option<VKCallStats>			(DE_NULL,	"deqp-vk-call-stats",			"Log Vulkan API call counts and latencies per case",	s_enableNames,		"disable")
+		<< Option<VKBenchmarks>			(DE_NULL,	"deqp-vk-benchmarks",			"Include Vulkan benchmark groups in test hierarchy",	s_enableNames,		"disable")
 		<< Option<LogImages>			(DE_NULL,	"deqp-log-images",				"Enable or disable logging of result images",		s_enableNames,		"enable")
 		<< Option<LogShaderSources>		(DE_NULL,	"deqp-log-shader-sources",		"Enable or disable logging of shader sources",		s_enableNames,		"enable")
-		<< Option<TestOOM>				(DE_NULL,	"deqp-test-oom",				"Run tests that exhaust memory on purpose",			s_enableNames,		TEST_OOM_DEFAULT);
+		<< Option<TestOOM>				(DE_NULL,	"deqp-test-oom",				"Run tests that exhaust memory on purpose",			s_enableNames,		TEST_OOM_DEFAULT)
+		<< Option<ResourceArchive>		(DE_NULL,	"deqp-resource-archive",		"Load test resources from given packed archive instead of directory")
+		<< Option<CallTraceBufferSize>	(DE_NULL,	"deqp-call-trace-buffer-size",	"Size of API call trace buffers in bytes, traces are logged for failed, crashed and timed out cases (0 = disabled)",	"0")
+		<< Option<ShardCount>			(DE_NULL,	"deqp-shard-count",				"Divide matching test cases into given number of shards",				"1")
+		<< Option<ShardIndex>			(DE_NULL,	"deqp-shard-index",				"Run only cases in given shard (0 to shard count - 1)",					"0")
+		<< Option<ShardMode>			(DE_NULL,	"deqp-shard-mode",				"How cases are divided into shards",				s_shardModes,		"hash")
+		<< Option<CaseListCacheFile>	(DE_NULL,	"deqp-caselist-cache",			"Serve case list export from given test hierarchy cache file, updating it if needed")
+		<< Option<ForkServer>			(DE_NULL,	"deqp-fork-server",				"Serve execution requests from stdin by forking a test process for each (used by execserver)")
+		<< Option<WorkerThreads>		(DE_NULL,	"deqp-worker-threads",			"Execute thread-safe cases concurrently in given number of threads (0 = number of CPU cores)",	"1");
 }
 
 void registerLegacyOptions (de::cmdline::Parser& parser)
@@ -240,10 +278,17 @@ void DebugOutStreambuf::flushLine (void)
 	m_curLine.str("");
 }
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Case list trie node
+ *
+ * Children are kept in insertion order. Nodes with more than a few
+ * children also maintain an open addressing hash index of child positions
+ * so that lookups stay O(1) for groups with thousands of children.
+ *//*--------------------------------------------------------------------*/
 class CaseTreeNode
 {
 public:
-										CaseTreeNode		(const std::string& name) : m_name(name) {}
+										CaseTreeNode		(const std::string& name) : m_name(name), m_nameHash(deStringHash(name.c_str())) {}
 										~CaseTreeNode		(void);
 
 	const std::string&					getName				(void) const { return m_name;				}
@@ -253,19 +298,29 @@ public:
 	const CaseTreeNode*					getChild			(const std::string& name) const;
 	CaseTreeNode*						getChild			(const std::string& name);
 
-	void								addChild			(CaseTreeNode* child) { m_children.push_back(child); }
+	//! Find child by name given as length-delimited string.
+	const CaseTreeNode*					getChild			(const char* name, int nameLen) const;
+
+	void								addChild			(CaseTreeNode* child);
 
 private:
 										CaseTreeNode		(const CaseTreeNode&);
 	CaseTreeNode&						operator=			(const CaseTreeNode&);
 
-	enum { NOT_FOUND = -1 };
+	enum
+	{
+		NOT_FOUND				= -1,
+		MIN_INDEXED_CHILDREN	= 8		//!< Nodes with fewer children are searched linearly.
+	};
 
-	// \todo [2014-10-30 pyry] Speed up with hash / sorting
-	int									findChildNdx		(const std::string& name) const;
+	int									findChildNdx		(const char* name, int nameLen) const;
+	void								addToIndex			(int childNdx);
+	void								rebuildIndex		(void);
 
 	std::string							m_name;
+	deUint32							m_nameHash;
 	std::vector<CaseTreeNode*>			m_children;
+	std::vector<int>					m_childIndex;		//!< Child positions by name hash, size is power of two or zero.
 };
 
 CaseTreeNode::~CaseTreeNode (void)
@@ -274,30 +329,100 @@ CaseTreeNode::~CaseTreeNode (void)
 		delete *i;
 }
 
-int CaseTreeNode::findChildNdx (const std::string& name) const
+int CaseTreeNode::findChildNdx (const char* name, int nameLen) const
 {
-	for (int ndx = 0; ndx < (int)m_children.size(); ++ndx)
+	if (m_childIndex.empty())
+	{
+		for (int ndx = 0; ndx < (int)m_children.size(); ++ndx)
+		{
+			const std::string& childName = m_children[ndx]->getName();
+
+			if ((int)childName.size() == nameLen && deMemCmp(childName.c_str(), name, (size_t)nameLen) == 0)
+				return ndx;
+		}
+	}
+	else
 	{
-		if (m_children[ndx]->getName() == name)
-			return ndx;
+		const deUint32	hash	= deStringHashLeading(name, nameLen);
+		const deUint32	mask	= (deUint32)m_childIndex.size()-1;
+
+		for (deUint32 slot = hash & mask; m_childIndex[slot] != NOT_FOUND; slot = (slot+1) & mask)
+		{
+			const CaseTreeNode* const child = m_children[m_childIndex[slot]];
+
+			if (child->m_nameHash == hash && (int)child->m_name.size() == nameLen && deMemCmp(child->m_name.c_str(), name, (size_t)nameLen) == 0)
+				return m_childIndex[slot];
+		}
 	}
+
 	return NOT_FOUND;
 }
 
+void CaseTreeNode::addToIndex (int childNdx)
+{
+	const deUint32	mask	= (deUint32)m_childIndex.size()-1;
+	deUint32		slot	= m_children[childNdx]->m_nameHash & mask;
+
+	while (m_childIndex[slot] != NOT_FOUND)
+		slot = (slot+1) & mask;
+
+	m_childIndex[slot] = childNdx;
+}
+
+void CaseTreeNode::rebuildIndex (void)
+{
+	// Keep load factor at most 1/2.
+	const size_t indexSize = (size_t)1 << deLog2Ceil32((deInt32)m_children.size()*4);
+
+	m_childIndex.clear();
+	m_childIndex.resize(indexSize, (int)NOT_FOUND);
+
+	for (int ndx = 0; ndx < (int)m_children.size(); ++ndx)
+		addToIndex(ndx);
+}
+
+void CaseTreeNode::addChild (CaseTreeNode* child)
+{
+	m_children.push_back(child);
+
+	try
+	{
+		if (m_children.size()*2 > m_childIndex.size())
+		{
+			if (m_children.size() >= MIN_INDEXED_CHILDREN)
+				rebuildIndex();
+		}
+		else
+			addToIndex((int)m_children.size()-1);
+	}
+	catch (...)
+	{
+		// Caller retains ownership on failure.
+		m_children.pop_back();
+		m_childIndex.clear();
+		throw;
+	}
+}
+
 inline bool CaseTreeNode::hasChild (const std::string& name) const
 {
-	return findChildNdx(name) != NOT_FOUND;
+	return findChildNdx(name.c_str(), (int)name.size()) != NOT_FOUND;
 }
 
 inline const CaseTreeNode* CaseTreeNode::getChild (const std::string& name) const
 {
-	const int ndx = findChildNdx(name);
+	return getChild(name.c_str(), (int)name.size());
+}
+
+inline const CaseTreeNode* CaseTreeNode::getChild (const char* name, int nameLen) const
+{
+	const int ndx = findChildNdx(name, nameLen);
 	return ndx == NOT_FOUND ? DE_NULL : m_children[ndx];
 }
 
 inline CaseTreeNode* CaseTreeNode::getChild (const std::string& name)
 {
-	const int ndx = findChildNdx(name);
+	const int ndx = findChildNdx(name.c_str(), (int)name.size());
 	return ndx == NOT_FOUND ? DE_NULL : m_children[ndx];
 }
 
@@ -316,7 +441,7 @@ static const CaseTreeNode* findNode (const CaseTreeNode* root, const char* path)
 
 	for (;;)
 	{
-		curNode = curNode->getChild(std::string(curPath, curPath+curLen));
+		curNode = curNode->getChild(curPath, curLen);
 
 		if (!curNode)
 			break;
@@ -677,6 +802,8 @@ void CommandLine::clear (void)
 {
 	m_cmdLine.clear();
 	m_logFlags = 0;
+	m_binaryPath.clear();
+	m_args.clear();
 
 	delete m_caseTree;
 	m_caseTree = DE_NULL;
@@ -710,6 +837,12 @@ bool CommandLine::parse (int argc, const char* const* argv)
 
 	clear();
 
+	if (argc > 0)
+		m_binaryPath = argv[0];
+
+	for (int argNdx = 1; argNdx < argc; argNdx++)
+		m_args.push_back(argv[argNdx]);
+
 	if (!parser.parse(argc-1, argv+1, &m_cmdLine, std::cerr))
 	{
 		debugOut << "\n" << de::FilePath(argv[0]).getBaseName() << " [options]\n\n";
@@ -735,6 +868,21 @@ bool CommandLine::parse (int argc, const char* const* argv)
 		return false;
 	}
 
+	if (m_cmdLine.getOption<opt::ShardCount>() < 1 ||
+		!de::inBounds(m_cmdLine.getOption<opt::ShardIndex>(), 0, m_cmdLine.getOption<opt::ShardCount>()))
+	{
+		debugOut << "ERROR: invalid shard index " << m_cmdLine.getOption<opt::ShardIndex>() << " for shard count " << m_cmdLine.getOption<opt::ShardCount>() << "!\n" << std::endl;
+		clear();
+		return false;
+	}
+
+	if (m_cmdLine.getOption<opt::WorkerThreads>() < 0)
+	{
+		debugOut << "ERROR: invalid worker thread count " << m_cmdLine.getOption<opt::WorkerThreads>() << "!\n" << std::endl;
+		clear();
+		return false;
+	}
+
 	try
 	{
 		if (m_cmdLine.hasOption<opt::CaseList>())
@@ -812,7 +960,16 @@ int						CommandLine::getGLConfigId				(void) const	{ return m_cmdLine.getOption
 int						CommandLine::getCLPlatformId			(void) const	{ return m_cmdLine.getOption<opt::CLPlatformID>();					}
 const std::vector<int>&	CommandLine::getCLDeviceIds				(void) const	{ return m_cmdLine.getOption<opt::CLDeviceIDs>();					}
 int						CommandLine::getVKDeviceId				(void) const	{ return m_cmdLine.getOption<opt::VKDeviceID>();					}
+VKAllocatorType			CommandLine::getVKAllocatorType			(void) const	{ return m_cmdLine.getOption<opt::VKAllocator>();					}
+bool					CommandLine::isVKCallStatsEnabled		(void) const	{ return m_cmdLine.getOption<opt::VKCallStats>();					}
+bool					CommandLine::isVKBenchmarksEnabled		(void) const	{ return m_cmdLine.getOption<opt::VKBenchmarks>();					}
 bool					CommandLine::isOutOfMemoryTestEnabled	(void) const	{ return m_cmdLine.getOption<opt::TestOOM>();						}
+int						CommandLine::getCallTraceBufferSize		(void) const	{ return m_cmdLine.getOption<opt::CallTraceBufferSize>();			}
+int						CommandLine::getShardCount				(void) const	{ return m_cmdLine.getOption<opt::ShardCount>();					}
+int						CommandLine::getShardIndex				(void) const	{ return m_cmdLine.getOption<opt::ShardIndex>();					}
+ShardMode				CommandLine::getShardMode				(void) const	{ return m_cmdLine.getOption<opt::ShardMode>();						}
+bool					CommandLine::isForkServerEnabled		(void) const	{ return m_cmdLine.getOption<opt::ForkServer>();					}
+int						CommandLine::getNumWorkerThreads		(void) const	{ return m_cmdLine.getOption<opt::WorkerThreads>();					}
 
 const char* CommandLine::getGLContextType (void) const
 {
@@ -821,6 +978,42 @@ const char* CommandLine::getGLContextType (void) const
 	else
 		return DE_NULL;
 }
+const char* CommandLine::getResourceArchive (void) const
+{
+	if (m_cmdLine.hasOption<opt::ResourceArchive>())
+		return m_cmdLine.getOption<opt::ResourceArchive>().c_str();
+	else
+		return DE_NULL;
+}
+
+const char* CommandLine::getCaseListCacheFile (void) const
+{
+	if (m_cmdLine.hasOption<opt::CaseListCacheFile>())
+		return m_cmdLine.getOption<opt::CaseListCacheFile>().c_str();
+	else
+		return DE_NULL;
+}
+
+const char* CommandLine::getVKProgramCacheDir (void) const
+{
+	if (m_cmdLine.hasOption<opt::VKProgramCacheDir>())
+		return m_cmdLine.getOption<opt::VKProgramCacheDir>().c_str();
+	else
+		return DE_NULL;
+}
+
+const char* CommandLine::getWatchDogTimingsFile (void) const
+{
+	if (m_cmdLine.hasOption<opt::WatchDogTimingsFile>())
+		return m_cmdLine.getOption<opt::WatchDogTimingsFile>().c_str();
+	else
+		return DE_NULL;
+}
+
+const char* CommandLine::getBinaryPath (void) const
+{
+	return m_binaryPath.c_str();
+}
 const char* CommandLine::getGLConfigName (void) const
 {
 	if (m_cmdLine.hasOption<opt::GLConfigName>())
@@ -891,6 +1084,14 @@ bool CommandLine::checkTestGroupName (const char* groupName) const
 		return true;
 }
 
+const CaseTreeNode* CommandLine::findCaseListNode (const CaseTreeNode* parent, const char* name, bool isCase)
+{
+	const CaseTreeNode* const node = parent->getChild(name, (int)std::strlen(name));
+
+	// Groups must have children and cases must not.
+	return node && node->hasChildren() != isCase ? node : DE_NULL;
+}
+
 bool CommandLine::checkTestCaseName (const char* caseName) const
 {
 	if (m_casePaths)
@@ -901,4 +1102,35 @@ bool CommandLine::checkTestCaseName (const char* caseName) const
 		return true;
 }
 
+static deUint32 getCaseShardHash (const char* casePath)
+{
+	// \note Final mix spreads string hash to low bits used by modulo.
+	deUint32 hash = deStringHash(casePath);
+
+	hash ^= hash >> 16;
+	hash *= 0x85ebca6bu;
+	hash ^= hash >> 13;
+	hash *= 0xc2b2ae35u;
+	hash ^= hash >> 16;
+
+	return hash;
+}
+
+bool CommandLine::checkTestCaseShard (const char* caseName, int caseNdx) const
+{
+	const int shardCount = getShardCount();
+
+	if (shardCount <= 1)
+		return true;
+
+	switch (getShardMode())
+	{
+		case SHARDMODE_HASH:		return (int)(getCaseShardHash(caseName) % (deUint32)shardCount) == getShardIndex();
+		case SHARDMODE_ROUND_ROBIN:	return caseNdx % shardCount == getShardIndex();
+		default:
+			DE_ASSERT(false);
+			return true;
+	}
+}
+
 } // tcu
@@ -86,6 +86,28 @@ enum ScreenRotation
 	SCREENROTATION_LAST
 };
 
+/*--------------------------------------------------------------------*//*!
+ * \brief How test cases are divided into shards.
+ *//*--------------------------------------------------------------------*/
+enum ShardMode
+{
+	SHARDMODE_HASH = 0,				//!< By hash of case path. Case stays in the same shard when others are added or removed.
+	SHARDMODE_ROUND_ROBIN,			//!< By index of case in traversal order. Shards are balanced by case count.
+
+	SHARDMODE_LAST
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Device memory allocator used by Vulkan tests.
+ *//*--------------------------------------------------------------------*/
+enum VKAllocatorType
+{
+	VKALLOCATORTYPE_SIMPLE = 0,		//!< Every allocation gets its own device memory object.
+	VKALLOCATORTYPE_POOL,			//!< Allocations are sub-allocated from large device memory blocks.
+
+	VKALLOCATORTYPE_LAST
+};
+
 class CaseTreeNode;
 class CasePaths;
 
@@ -124,6 +146,9 @@ public:
 	//! Get watchdog enable status (--deqp-watchdog)
 	bool							isWatchDogEnabled			(void) const;
 
+	//! Get case duration file for adaptive watchdog limits (--deqp-watchdog-timings)
+	const char*						getWatchDogTimingsFile		(void) const;
+
 	//! Get crash handling enable status (--deqp-crashhandler)
 	bool							isCrashHandlingEnabled		(void) const;
 
@@ -179,15 +204,66 @@ public:
 	//! Get Vulkan device ID (--deqp-vk-device-id)
 	int								getVKDeviceId				(void) const;
 
+	//! Get directory for caching compiled Vulkan programs (--deqp-vk-program-cache-dir)
+	const char*						getVKProgramCacheDir		(void) const;
+
+	//! Get Vulkan default allocator type (--deqp-vk-allocator)
+	VKAllocatorType					getVKAllocatorType			(void) const;
+
+	//! Is Vulkan API call statistics logging enabled (--deqp-vk-call-stats)
+	bool							isVKCallStatsEnabled		(void) const;
+
+	//! Are Vulkan benchmark groups included in test hierarchy (--deqp-vk-benchmarks)
+	bool							isVKBenchmarksEnabled		(void) const;
+
 	//! Should we run tests that exhaust memory (--deqp-test-oom)
 	bool							isOutOfMemoryTestEnabled(void) const;
 
+	//! Get packed resource archive file (--deqp-resource-archive)
+	const char*						getResourceArchive			(void) const;
+
+	//! Get API call trace buffer size in bytes (--deqp-call-trace-buffer-size)
+	int								getCallTraceBufferSize		(void) const;
+
+	//! Get number of shards (--deqp-shard-count)
+	int								getShardCount				(void) const;
+
+	//! Get index of shard to run (--deqp-shard-index)
+	int								getShardIndex				(void) const;
+
+	//! Get shard mode (--deqp-shard-mode)
+	ShardMode						getShardMode				(void) const;
+
+	//! Get test hierarchy cache file for case list export (--deqp-caselist-cache)
+	const char*						getCaseListCacheFile		(void) const;
+
+	//! Should test binary run as execserver fork server (--deqp-fork-server)
+	bool							isForkServerEnabled			(void) const;
+
+	//! Get number of threads for executing thread-safe cases (--deqp-worker-threads), 0 means number of CPU cores
+	int								getNumWorkerThreads			(void) const;
+
+	//! Get path of test binary as given in first argument, empty if not known
+	const char*						getBinaryPath				(void) const;
+
+	//! Get command line arguments following binary path
+	const std::vector<std::string>&	getArguments				(void) const	{ return m_args; }
+
 	//! Check if test group is in supplied test case list.
 	bool							checkTestGroupName			(const char* groupName) const;
 
 	//! Check if test case is in supplied test case list.
 	bool							checkTestCaseName			(const char* caseName) const;
 
+	//! Get case list trie root for incremental matching, DE_NULL if case list was not given as trie or list.
+	const CaseTreeNode*				getCaseListRoot				(void) const { return m_caseTree; }
+
+	//! Find case list trie node for child group or case of given trie node, DE_NULL if child is not in case list.
+	static const CaseTreeNode*		findCaseListNode			(const CaseTreeNode* parent, const char* name, bool isCase);
+
+	//! Check if test case belongs to selected shard. caseNdx is the index of the case among matching cases in traversal order.
+	bool							checkTestCaseShard			(const char* caseName, int caseNdx) const;
+
 protected:
 	const de::cmdline::CommandLine&	getCommandLine				(void) const;
 
@@ -201,6 +277,8 @@ private:
 
 	de::cmdline::CommandLine		m_cmdLine;
 	deUint32						m_logFlags;
+	std::string						m_binaryPath;
+	std::vector<std::string>		m_args;
 	CaseTreeNode*					m_caseTree;
 	de::MovePtr<const CasePaths>	m_casePaths;
 };
@@ -0,0 +1,307 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright 2014 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Packed resource archive.
+ *
+ * Archive layout, all integers are little-endian:
+ *
+ *  u8[4]	magic ("dEPA")
+ *  u32		version
+ *  u32		number of entries
+ *  entries:
+ *   u32	name length
+ *   u8[]	name (not null-terminated)
+ *   u64	data offset from beginning of file
+ *   u32	data size
+ *  resource data
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuPackedArchive.hpp"
+#include "deMemory.h"
+#include "deUniquePtr.hpp"
+#include "deFile.h"
+
+#include <fstream>
+#include <vector>
+
+namespace tcu
+{
+
+namespace
+{
+
+enum
+{
+	PACKED_ARCHIVE_VERSION	= 1
+};
+
+static const deUint8 s_packedArchiveMagic[] = { 'd', 'E', 'P', 'A' };
+
+class IndexReader
+{
+public:
+	IndexReader (const deUint8* data, deUint64 size)
+		: m_data	(data)
+		, m_size	(size)
+		, m_pos		(0)
+	{
+	}
+
+	const deUint8* getBytes (deUint64 numBytes)
+	{
+		if (numBytes > m_size - m_pos)
+			throw ResourceError("Unexpected end of archive index");
+
+		const deUint8* const ptr = m_data + m_pos;
+		m_pos += numBytes;
+		return ptr;
+	}
+
+	deUint32 getUint32 (void)
+	{
+		const deUint8* const b = getBytes(4);
+		return (deUint32)b[0] | ((deUint32)b[1] << 8) | ((deUint32)b[2] << 16) | ((deUint32)b[3] << 24);
+	}
+
+	deUint64 getUint64 (void)
+	{
+		const deUint64 low	= getUint32();
+		const deUint64 high	= getUint32();
+		return low | (high << 32);
+	}
+
+private:
+	const deUint8*	m_data;
+	deUint64		m_size;
+	deUint64		m_pos;
+};
+
+} // anonymous
+
+// MemoryResource
+
+MemoryResource::MemoryResource (const std::string& name, const deUint8* data, int size)
+	: Resource		(name)
+	, m_data		(data)
+	, m_size		(size)
+	, m_position	(0)
+{
+}
+
+MemoryResource::~MemoryResource (void)
+{
+}
+
+void MemoryResource::read (deUint8* dst, int numBytes)
+{
+	TCU_CHECK(numBytes >= 0 && numBytes <= m_size - m_position);
+
+	if (numBytes > 0)
+		deMemcpy(dst, m_data + m_position, (size_t)numBytes);
+
+	m_position += numBytes;
+}
+
+void MemoryResource::setPosition (int position)
+{
+	m_position = de::clamp(position, 0, m_size);
+}
+
+// PackedArchive
+
+PackedArchive::PackedArchive (const char* filename)
+	: m_file(filename)
+{
+	const deUint64	fileSize	= (deUint64)m_file.getSize();
+	IndexReader		reader		(m_file.getPtr(), fileSize);
+
+	if (deMemCmp(reader.getBytes(sizeof(s_packedArchiveMagic)), &s_packedArchiveMagic[0], sizeof(s_packedArchiveMagic)) != 0)
+		throw ResourceError("Not a packed archive", filename, __FILE__, __LINE__);
+
+	if (reader.getUint32() != PACKED_ARCHIVE_VERSION)
+		throw ResourceError("Unsupported packed archive version", filename, __FILE__, __LINE__);
+
+	{
+		const deUint32 numEntries = reader.getUint32();
+
+		for (deUint32 ndx = 0; ndx < numEntries; ndx++)
+		{
+			const deUint32		nameLen	= reader.getUint32();
+			const std::string	name	((const char*)reader.getBytes(nameLen), (size_t)nameLen);
+			Entry				entry;
+
+			entry.offset	= reader.getUint64();
+			entry.size		= reader.getUint32();
+
+			if (entry.offset > fileSize || (deUint64)entry.size > fileSize - entry.offset || entry.size > 0x7fffffffu)
+				throw ResourceError("Resource data out of archive bounds", name.c_str(), __FILE__, __LINE__);
+
+			m_entries[name] = entry;
+		}
+	}
+}
+
+PackedArchive::~PackedArchive (void)
+{
+}
+
+bool PackedArchive::hasResource (const char* name) const
+{
+	return m_entries.find(name) != m_entries.end();
+}
+
+Resource* PackedArchive::getResource (const char* name) const
+{
+	const EntryMap::const_iterator pos = m_entries.find(name);
+
+	if (pos == m_entries.end())
+		throw ResourceError("Resource not found in archive", name, __FILE__, __LINE__);
+
+	return new MemoryResource(pos->first, m_file.getPtr() + pos->second.offset, (int)pos->second.size);
+}
+
+// Self-test
+
+namespace
+{
+
+void writeUint32 (std::ostream& str, deUint32 value)
+{
+	const deUint8 bytes[] =
+	{
+		(deUint8)(value & 0xff),
+		(deUint8)((value >> 8) & 0xff),
+		(deUint8)((value >> 16) & 0xff),
+		(deUint8)((value >> 24) & 0xff)
+	};
+	str.write((const char*)&bytes[0], sizeof(bytes));
+}
+
+void writeTestArchive (const char* filename, int numResources, const char* const* names, const char* const* contents)
+{
+	std::ofstream	str			(filename, std::ofstream::binary|std::ofstream::trunc);
+	deUint64		dataOffset	= sizeof(s_packedArchiveMagic) + 2*sizeof(deUint32);
+
+	for (int ndx = 0; ndx < numResources; ndx++)
+		dataOffset += sizeof(deUint32) + std::string(names[ndx]).size() + sizeof(deUint64) + sizeof(deUint32);
+
+	str.write((const char*)&s_packedArchiveMagic[0], sizeof(s_packedArchiveMagic));
+	writeUint32(str, PACKED_ARCHIVE_VERSION);
+	writeUint32(str, (deUint32)numResources);
+
+	for (int ndx = 0; ndx < numResources; ndx++)
+	{
+		const deUint32	nameLen	= (deUint32)std::string(names[ndx]).size();
+		const deUint32	dataLen	= (deUint32)std::string(contents[ndx]).size();
+
+		writeUint32(str, nameLen);
+		str.write(names[ndx], nameLen);
+		writeUint32(str, (deUint32)(dataOffset & 0xffffffffu));
+		writeUint32(str, (deUint32)(dataOffset >> 32));
+		writeUint32(str, dataLen);
+
+		dataOffset += dataLen;
+	}
+
+	for (int ndx = 0; ndx < numResources; ndx++)
+		str.write(contents[ndx], (std::streamsize)std::string(contents[ndx]).size());
+
+	TCU_CHECK(str.good());
+}
+
+std::string readResource (const Archive& archive, const char* name)
+{
+	const de::UniquePtr<Resource>	resource	(archive.getResource(name));
+	std::vector<char>				data		((size_t)resource->getSize() + 1, 0);
+
+	resource->read((deUint8*)&data[0], resource->getSize());
+	TCU_CHECK(resource->getPosition() == resource->getSize());
+
+	return std::string(&data[0]);
+}
+
+} // anonymous
+
+void PackedArchive_selfTest (void)
+{
+	const char* const	filename		= "tcu-packed-archive-selftest.pack";
+	const char* const	names[]			= { "foo.txt",	"dir/bar.bin",	"empty"	};
+	const char* const	contents[]		= { "Foo",		"Bar data",		""		};
+
+	writeTestArchive(filename, DE_LENGTH_OF_ARRAY(names), &names[0], &contents[0]);
+
+	try
+	{
+		const PackedArchive archive (filename);
+
+		TCU_CHECK(archive.hasResource("foo.txt"));
+		TCU_CHECK(archive.hasResource("dir/bar.bin"));
+		TCU_CHECK(archive.hasResource("empty"));
+		TCU_CHECK(!archive.hasResource("bar.bin"));
+
+		TCU_CHECK(readResource(archive, "foo.txt") == "Foo");
+		TCU_CHECK(readResource(archive, "dir/bar.bin") == "Bar data");
+		TCU_CHECK(readResource(archive, "empty") == "");
+
+		// Seeking and partial reads
+		{
+			const de::UniquePtr<Resource>	resource	(archive.getResource("dir/bar.bin"));
+			deUint8							buf[4];
+
+			resource->setPosition(4);
+			resource->read(&buf[0], 4);
+			TCU_CHECK(deMemCmp(&buf[0], "data", 4) == 0);
+			TCU_CHECK(resource->getPosition() == resource->getSize());
+		}
+
+		// Resources are views into the mapping
+		{
+			const de::UniquePtr<Resource>	resource	(archive.getResource("foo.txt"));
+			const MemoryResource* const		memResource	= dynamic_cast<const MemoryResource*>(resource.get());
+
+			TCU_CHECK(memResource && deMemCmp(memResource->getData(), "Foo", 3) == 0);
+		}
+
+		// Missing resource
+		{
+			bool threw = false;
+
+			try
+			{
+				delete archive.getResource("missing");
+			}
+			catch (const ResourceError&)
+			{
+				threw = true;
+			}
+
+			TCU_CHECK(threw);
+		}
+	}
+	catch (...)
+	{
+		deDeleteFile(filename);
+		throw;
+	}
+
+	deDeleteFile(filename);
+}
+
+} // tcu
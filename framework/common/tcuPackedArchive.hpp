@@ -0,0 +1,103 @@
+#ifndef _TCUPACKEDARCHIVE_HPP
+#define _TCUPACKEDARCHIVE_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright 2014 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Packed resource archive.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuDefs.hpp"
+#include "tcuResource.hpp"
+#include "deMappedFile.hpp"
+
+#include <map>
+#include <string>
+
+namespace tcu
+{
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Resource backed by memory owned by someone else
+ *
+ * Data is not copied, so the memory must outlive the resource. read()
+ * still copies to the destination as required by Resource interface;
+ * use getData() to access resource contents in place.
+ *//*--------------------------------------------------------------------*/
+class MemoryResource : public Resource
+{
+public:
+						MemoryResource	(const std::string& name, const deUint8* data, int size);
+						~MemoryResource	(void);
+
+	void				read			(deUint8* dst, int numBytes);
+	int					getSize			(void) const	{ return m_size;		}
+	int					getPosition		(void) const	{ return m_position;	}
+	void				setPosition		(int position);
+
+	const deUint8*		getData			(void) const	{ return m_data;		}
+
+private:
+						MemoryResource	(const MemoryResource& other);
+	MemoryResource&		operator=		(const MemoryResource& other);
+
+	const deUint8*		m_data;
+	int					m_size;
+	int					m_position;
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Archive stored in a single packed file
+ *
+ * Archive file consists of an index followed by the contents of all
+ * resources. File is memory-mapped and resources returned by
+ * getResource() are views into the mapping, so accessing resources
+ * doesn't require any file system operations. Archives are built with
+ * scripts/build_resource_archive.py.
+ *//*--------------------------------------------------------------------*/
+class PackedArchive : public Archive
+{
+public:
+						PackedArchive		(const char* filename);
+						~PackedArchive		(void);
+
+	Resource*			getResource			(const char* name) const;
+	bool				hasResource			(const char* name) const;
+
+private:
+						PackedArchive		(const PackedArchive& other);
+	PackedArchive&		operator=			(const PackedArchive& other);
+
+	struct Entry
+	{
+		deUint64		offset;
+		deUint32		size;
+	};
+
+	typedef std::map<std::string, Entry> EntryMap;
+
+	de::MappedFile		m_file;
+	EntryMap			m_entries;
+};
+
+void PackedArchive_selfTest (void);
+
+} // tcu
+
+#endif // _TCUPACKEDARCHIVE_HPP
@@ -130,6 +130,62 @@ TestCase::IterateResult TestCaseGroup::iterate (void)
 	throw InternalError("TestCaseGroup::iterate() called!", "", __FILE__, __LINE__);
 }
 
+// LazyTestNode
+
+LazyTestNode::LazyTestNode (TestContext& testCtx, TestNodeType nodeType, const char* name)
+	: TestNode	(testCtx, nodeType, name, "")
+	, m_node	(DE_NULL)
+{
+}
+
+LazyTestNode::~LazyTestNode (void)
+{
+	LazyTestNode::deinit();
+}
+
+TestNode* LazyTestNode::getNode (void)
+{
+	if (!m_node)
+	{
+		TestNode* const node = createNode();
+
+		if (!node || node->getNodeType() != getNodeType() || !deStringEqual(node->getName(), getName()))
+		{
+			delete node;
+			throw InternalError(std::string("Lazily created node doesn't match placeholder '") + getName() + "'");
+		}
+
+		m_node = node;
+	}
+
+	return m_node;
+}
+
+void LazyTestNode::deinit (void)
+{
+	delete m_node;
+	m_node = DE_NULL;
+}
+
+TestNode::IterateResult LazyTestNode::iterate (void)
+{
+	DE_ASSERT(DE_FALSE); // should never be here!
+	throw InternalError("LazyTestNode::iterate() called!", "", __FILE__, __LINE__);
+}
+
+// LazyTestGroup
+
+LazyTestGroup::LazyTestGroup (TestContext& testCtx, const char* name, CreateGroupFunc createGroup)
+	: LazyTestNode	(testCtx, NODETYPE_GROUP, name)
+	, m_createGroup	(createGroup)
+{
+}
+
+TestNode* LazyTestGroup::createNode (void)
+{
+	return m_createGroup(m_testCtx, getName());
+}
+
 // TestCase
 
 TestCase::TestCase (TestContext& testCtx, const char* name, const char* description)
@@ -134,7 +134,9 @@ private:
  *
  * Test case group implementations must inherit this class. To save resources
  * during test execution the group must delay creation of any child groups
- * until init() is called.
+ * until init() is called. Children with large subtrees can be added as
+ * LazyTestNode placeholders to avoid constructing them at all if they are
+ * filtered out.
  *
  * Default deinit() for test group will destroy all child nodes.
  *//*--------------------------------------------------------------------*/
@@ -148,6 +150,60 @@ public:
 	virtual IterateResult	iterate			(void);
 };
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Lazily created test node
+ *
+ * Lightweight placeholder that carries only the name and type of a child
+ * node. The actual node is created by createNode() when TestHierarchyIterator
+ * enters the placeholder, i.e. only if the node path passes the case filter.
+ * Groups with large subtrees can use this to avoid constructing case objects
+ * that will never be executed.
+ *
+ * Created node must have the same name and node type as the placeholder.
+ * Created node is owned by the placeholder and destroyed along with it.
+ *//*--------------------------------------------------------------------*/
+class LazyTestNode : public TestNode
+{
+public:
+							LazyTestNode	(TestContext& testCtx, TestNodeType nodeType, const char* name);
+	virtual					~LazyTestNode	(void);
+
+	TestNode*				getNode			(void);
+
+	virtual void			deinit			(void);
+	virtual IterateResult	iterate			(void);
+
+protected:
+	virtual TestNode*		createNode		(void) = 0;
+
+private:
+							LazyTestNode	(const LazyTestNode& other);
+	LazyTestNode&			operator=		(const LazyTestNode& other);
+
+	TestNode*				m_node;
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Lazily created test group
+ *
+ * Group is created by calling createGroup only once the group is entered.
+ * Placeholder name is passed to createGroup so that the name is given only
+ * once, where the group is added to its parent.
+ *//*--------------------------------------------------------------------*/
+class LazyTestGroup : public LazyTestNode
+{
+public:
+	typedef TestCaseGroup* (*CreateGroupFunc) (TestContext& testCtx, const char* name);
+
+							LazyTestGroup	(TestContext& testCtx, const char* name, CreateGroupFunc createGroup);
+
+protected:
+	TestNode*				createNode		(void);
+
+private:
+	const CreateGroupFunc	m_createGroup;
+};
+
 /*--------------------------------------------------------------------*//*!
  * \brief Test case class
  *
@@ -167,6 +223,14 @@ public:
  * Test case can also signal error condition by throwing an exception. In
  * that case the framework will set result code and details based on the
  * exception.
+ *
+ * Cases that only do CPU work and touch no shared state can return true
+ * from isThreadSafe(). When --deqp-worker-threads is given, consecutive
+ * thread-safe sibling cases are executed concurrently, each with a private
+ * log and result in m_testCtx. Package TestCaseExecutor must tolerate
+ * concurrent calls for such cases. Each such case is watched against its
+ * own watchdog limits, but API call traces are not logged for it, as the
+ * trace buffers are shared by all threads.
  *//*--------------------------------------------------------------------*/
 class TestCase : public TestNode
 {
@@ -174,6 +238,8 @@ public:
 					TestCase			(TestContext& testCtx, const char* name, const char* description);
 					TestCase			(TestContext& testCtx, TestNodeType nodeType, const char* name, const char* description);
 	virtual			~TestCase			(void);
+
+	virtual bool	isThreadSafe		(void) const { return false; }
 };
 
 class TestStatus
@@ -25,6 +25,9 @@
 
 #include "tcuTestLog.hpp"
 
+#include "deAtomic.h"
+#include "deClock.h"
+
 namespace tcu
 {
 
@@ -36,26 +39,75 @@ TestContext::TestContext (
 	qpWatchDog*			watchDog)
 	: m_platform		(platform)
 	, m_rootArchive		(rootArchive)
-	, m_log				(log)
 	, m_cmdLine			(cmdLine)
 	, m_watchDog		(watchDog)
 	, m_curArchive		(DE_NULL)
-	, m_testResult		(QP_TEST_RESULT_LAST)
-	, m_terminateAfter	(false)
+	, m_mainState		(&log, DE_NULL)
+	, m_numThreadScopes	(0)
 {
 	setCurrentArchive(m_rootArchive);
 }
 
 void TestContext::touchWatchdog (void)
 {
-	if (m_watchDog)
+	ThreadWatchDog* const threadWatchDog = getCaseState().watchDog;
+
+	if (threadWatchDog)
+		threadWatchDog->lastTouchTime = deGetMicroseconds();
+	else if (m_watchDog)
 		qpWatchDog_touch(m_watchDog);
 }
 
+void TestContext::setWatchdogLimits (int totalTimeLimitMs, int intervalTimeLimitMs)
+{
+	ThreadWatchDog* const threadWatchDog = getCaseState().watchDog;
+
+	if (threadWatchDog)
+	{
+		threadWatchDog->totalTimeLimitMs	= totalTimeLimitMs;
+		threadWatchDog->intervalTimeLimitMs	= intervalTimeLimitMs;
+	}
+	else if (m_watchDog)
+		qpWatchDog_setCaseTimeLimits(m_watchDog, totalTimeLimitMs, intervalTimeLimitMs);
+}
+
 void TestContext::setTestResult (qpTestResult testResult, const char* description)
 {
-	m_testResult		= testResult;
-	m_testResultDesc	= description;
+	CaseState& state = getCaseState();
+
+	state.testResult		= testResult;
+	state.testResultDesc	= description;
+}
+
+TestContext::CaseState& TestContext::getThreadCaseState (void)
+{
+	CaseState* const threadState = static_cast<CaseState*>(m_threadState.get());
+	return threadState ? *threadState : m_mainState;
+}
+
+TestContext::CaseState::CaseState (TestLog* log_, ThreadWatchDog* watchDog_)
+	: log				(log_)
+	, testResult		(QP_TEST_RESULT_LAST)
+	, terminateAfter	(false)
+	, watchDog			(watchDog_)
+{
+}
+
+// TestContext::ThreadCaseScope
+
+TestContext::ThreadCaseScope::ThreadCaseScope (TestContext& testCtx, TestLog& log, ThreadWatchDog& watchDog)
+	: m_testCtx	(testCtx)
+	, m_state	(&log, &watchDog)
+{
+	DE_ASSERT(!m_testCtx.m_threadState.get());
+	m_testCtx.m_threadState.set(&m_state);
+	deAtomicIncrement32(&m_testCtx.m_numThreadScopes);
+}
+
+TestContext::ThreadCaseScope::~ThreadCaseScope (void)
+{
+	deAtomicDecrement32(&m_testCtx.m_numThreadScopes);
+	m_testCtx.m_threadState.set(DE_NULL);
 }
 
 } // tcu
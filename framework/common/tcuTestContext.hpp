@@ -26,6 +26,7 @@
 #include "tcuDefs.hpp"
 #include "qpWatchDog.h"
 #include "qpTestLog.h"
+#include "deThreadLocal.hpp"
 
 #include <string>
 
@@ -51,39 +52,91 @@ public:
 							TestContext			(Platform& platform, Archive& rootArchive, TestLog& log, const CommandLine& cmdLine, qpWatchDog* watchDog);
 							~TestContext		(void) {}
 
+	class ThreadCaseScope;
+
+	//! Watchdog state of a case executed in ThreadCaseScope. Limits of such cases are checked by the executor instead of the process watchdog.
+	struct ThreadWatchDog
+	{
+		volatile deUint64	lastTouchTime;			//!< Time of last touchWatchdog() in microseconds.
+		volatile int		totalTimeLimitMs;		//!< Set with setWatchdogLimits(), 0 = default.
+		volatile int		intervalTimeLimitMs;	//!< Set with setWatchdogLimits(), 0 = default.
+
+							ThreadWatchDog		(void) : lastTouchTime(0), totalTimeLimitMs(0), intervalTimeLimitMs(0) {}
+	};
+
 	// API for test cases
-	TestLog&				getLog				(void)			{ return m_log;			}
+	TestLog&				getLog				(void)			{ return *getCaseState().log;	}
+	TestLog&				getMainLog			(void)			{ return *m_mainState.log;		} //!< Session log regardless of ThreadCaseScope, for crash handlers.
 	Archive&				getArchive			(void)			{ return *m_curArchive;	} //!< \note Do not access in TestNode constructors.
 	Platform&				getPlatform			(void)			{ return m_platform;	}
 	void					setTestResult		(qpTestResult result, const char* description);
 	void					touchWatchdog		(void);
+	void					setWatchdogLimits	(int totalTimeLimitMs, int intervalTimeLimitMs); //!< Override watchdog limits (0 = default) for current case, e.g. in init().
 	const CommandLine&		getCommandLine		(void) const	{ return m_cmdLine;		}
 
 	// API for test framework
-	qpTestResult			getTestResult		(void) const	{ return m_testResult;				}
-	const char*				getTestResultDesc	(void) const	{ return m_testResultDesc.c_str();	}
-	qpWatchDog*				getWatchDog			(void)			{ return m_watchDog;				}
+	qpTestResult			getTestResult		(void) const	{ return getCaseState().testResult;				}
+	const char*				getTestResultDesc	(void) const	{ return getCaseState().testResultDesc.c_str();	}
+	qpWatchDog*				getWatchDog			(void)			{ return m_watchDog;							}
+	ThreadWatchDog*			getThreadWatchDog	(void)			{ return getCaseState().watchDog;				} //!< Watchdog state of ThreadCaseScope in calling thread, if any.
 
 	Archive&				getRootArchive		(void) const		{ return m_rootArchive;		}
 	void					setCurrentArchive	(Archive& archive)	{ m_curArchive = &archive;	}
 
-	void					setTerminateAfter	(bool terminate)	{ m_terminateAfter = terminate;	}
-	bool					getTerminateAfter	(void) const		{ return m_terminateAfter; 		}
+	void					setTerminateAfter	(bool terminate)	{ getCaseState().terminateAfter = terminate;	}
+	bool					getTerminateAfter	(void) const		{ return getCaseState().terminateAfter; 		}
 
 protected:
 							TestContext			(const TestContext&);
 	TestContext&			operator=			(const TestContext&);
 
+	struct CaseState
+	{
+		TestLog*			log;				//!< Log for current case.
+		qpTestResult		testResult;			//!< Latest test result.
+		std::string			testResultDesc;		//!< Latest test result description.
+		bool				terminateAfter;		//!< Should tester terminate after execution of the current test
+		ThreadWatchDog*		watchDog;			//!< Watchdog state of ThreadCaseScope, null if process watchdog is used.
+
+							CaseState			(TestLog* log_, ThreadWatchDog* watchDog_);
+	};
+
+	CaseState&				getCaseState		(void)			{ return m_numThreadScopes == 0 ? m_mainState : getThreadCaseState();								}
+	const CaseState&		getCaseState		(void) const	{ return m_numThreadScopes == 0 ? m_mainState : const_cast<TestContext*>(this)->getThreadCaseState();	}
+	CaseState&				getThreadCaseState	(void);
+
 	Platform&				m_platform;			//!< Platform port implementation.
 	Archive&				m_rootArchive;		//!< Root archive.
-	TestLog&				m_log;				//!< Test log.
 	const CommandLine&		m_cmdLine;			//!< Command line.
 	qpWatchDog*				m_watchDog;			//!< Watchdog (can be null).
 
 	Archive*				m_curArchive;		//!< Current archive for test cases.
-	qpTestResult			m_testResult;		//!< Latest test result.
-	std::string				m_testResultDesc;	//!< Latest test result description.
-	bool					m_terminateAfter;	//!< Should tester terminate after execution of the current test
+	CaseState				m_mainState;		//!< Case state used outside ThreadCaseScopes.
+
+	de::ThreadLocal			m_threadState;		//!< CaseState of ThreadCaseScope in calling thread, if any.
+	volatile deInt32		m_numThreadScopes;	//!< Number of live ThreadCaseScopes.
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Thread-private test case state
+ *
+ * While the scope is alive, log, test result and watchdog accessed through
+ * the test context by the creating thread are private to the scope. This allows
+ * executing thread-safe test cases concurrently in worker threads; the
+ * framework writes the buffered log to the main log in case order.
+ *//*--------------------------------------------------------------------*/
+class TestContext::ThreadCaseScope
+{
+public:
+							ThreadCaseScope		(TestContext& testCtx, TestLog& log, ThreadWatchDog& watchDog);
+							~ThreadCaseScope	(void);
+
+private:
+							ThreadCaseScope		(const ThreadCaseScope&);
+	ThreadCaseScope&		operator=			(const ThreadCaseScope&);
+
+	TestContext&			m_testCtx;
+	CaseState				m_state;
 };
 
 } // tcu
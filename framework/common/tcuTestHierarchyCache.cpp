@@ -0,0 +1,644 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright 2014 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Serialized test hierarchy cache.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuTestHierarchyCache.hpp"
+#include "tcuTestHierarchyIterator.hpp"
+#include "tcuCommandLine.hpp"
+#include "tcuFormatUtil.hpp"
+
+#include "qpInfo.h"
+#include "deFile.h"
+#include "deMemory.h"
+#include "deInt32.h"
+#include "deUniquePtr.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#if (DE_OS == DE_OS_UNIX) || (DE_OS == DE_OS_ANDROID)
+#	include <link.h>
+#	include <elf.h>
+#	define TCU_HAVE_ELF_BUILD_ID
+#	if !defined(NT_GNU_BUILD_ID)
+#		define NT_GNU_BUILD_ID 3
+#	endif
+#endif
+
+namespace tcu
+{
+
+using std::string;
+using std::vector;
+
+namespace
+{
+
+// \note Bump version if the format changes.
+static const char* const	CACHE_MAGIC		= "dEQP-HierarchyCache-2";
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Parsed cache file
+ *
+ * Cache file starts with a header identifying the test binary and the
+ * command line options that may affect the hierarchy, followed by one
+ * "<depth> <node type> <name> <description>" line per
+ * node in depth-first order. Records point into the file data and know
+ * where their subtree ends, so that groups can be inflated one level at
+ * a time.
+ *//*--------------------------------------------------------------------*/
+class HierarchyCache
+{
+public:
+	struct NodeRecord
+	{
+		int				depth;			//!< 0 for packages
+		TestNodeType	nodeType;
+		const char*		name;
+		int				nameLen;
+		const char*		description;	//!< Escaped
+		int				descriptionLen;
+		int				subtreeEnd;		//!< Index of first record after this node's subtree
+	};
+
+								HierarchyCache		(void) {}
+
+	bool						parse				(const string& cacheKey);
+
+	std::vector<char>&			getData				(void)				{ return m_data;				}
+	int							getNumRecords		(void) const		{ return (int)m_records.size();	}
+	const NodeRecord&			getRecord			(int ndx) const		{ return m_records[ndx];		}
+
+private:
+								HierarchyCache		(const HierarchyCache&);
+	HierarchyCache&				operator=			(const HierarchyCache&);
+
+	std::vector<char>			m_data;
+	std::vector<NodeRecord>		m_records;
+};
+
+bool parseInt (const char*& pos, const char* end, int* dst)
+{
+	int value = 0;
+
+	if (pos == end || !de::inRange(*pos, '0', '9'))
+		return false;
+
+	for (; pos != end && de::inRange(*pos, '0', '9'); ++pos)
+	{
+		if (value > 100000)
+			return false;
+		value = value*10 + (*pos - '0');
+	}
+
+	*dst = value;
+	return true;
+}
+
+bool HierarchyCache::parse (const string& cacheKey)
+{
+	const string		header		= string(CACHE_MAGIC) + " " + cacheKey + "\n";
+	const char* const	end			= m_data.empty() ? DE_NULL : &m_data[0] + m_data.size();
+	const char*			pos			= m_data.empty() ? DE_NULL : &m_data[0];
+	std::vector<int>	nodeStack;	//!< Indices of currently open records
+
+	m_records.clear();
+
+	if (m_data.size() < header.size() || !std::equal(header.begin(), header.end(), pos))
+		return false;
+
+	pos += header.size();
+
+	while (pos != end)
+	{
+		const char* const	lineEnd		= std::find(pos, end, '\n');
+		NodeRecord			record;
+		int					nodeType	= -1;
+
+		if (lineEnd == end)
+			return false; // Truncated
+
+		if (!parseInt(pos, lineEnd, &record.depth) || pos == lineEnd || *pos++ != ' ' ||
+			!parseInt(pos, lineEnd, &nodeType) || pos == lineEnd || *pos++ != ' ')
+			return false;
+
+		record.name		= pos;
+		while (pos != lineEnd && *pos != ' ')
+		{
+			if (!isValidTestCaseNameChar(*pos))
+				return false;
+			++pos;
+		}
+		record.nameLen	= (int)(pos - record.name);
+
+		if (pos != lineEnd)
+			++pos; // Skip separator
+
+		record.description		= pos;
+		record.descriptionLen	= (int)(lineEnd - pos);
+		record.subtreeEnd		= -1;
+
+		if (record.nameLen == 0 || !de::inRange(nodeType, (int)NODETYPE_PACKAGE, (int)NODETYPE_ACCURACY))
+			return false;
+
+		record.nodeType = (TestNodeType)nodeType;
+
+		// Packages must be at top level and everything else under group-class nodes.
+		if (record.depth > (int)nodeStack.size() || (record.depth == 0) != (record.nodeType == NODETYPE_PACKAGE))
+			return false;
+
+		while ((int)nodeStack.size() > record.depth)
+		{
+			m_records[nodeStack.back()].subtreeEnd = (int)m_records.size();
+			nodeStack.pop_back();
+		}
+
+		if (!nodeStack.empty() && isTestNodeTypeExecutable(m_records[nodeStack.back()].nodeType))
+			return false;
+
+		nodeStack.push_back((int)m_records.size());
+		m_records.push_back(record);
+
+		pos = lineEnd+1;
+	}
+
+	for (std::vector<int>::const_iterator iter = nodeStack.begin(); iter != nodeStack.end(); ++iter)
+		m_records[*iter].subtreeEnd = (int)m_records.size();
+
+	return true;
+}
+
+#if defined(TCU_HAVE_ELF_BUILD_ID)
+
+struct ElfBuildIdQuery
+{
+	const void*		address;	//!< Address within object to query
+	string			buildId;	//!< Hex encoded build id, empty if not found
+};
+
+bool containsAddress (const struct dl_phdr_info* info, const void* address)
+{
+	const deUintptr addr = (deUintptr)address;
+
+	for (int phNdx = 0; phNdx < (int)info->dlpi_phnum; phNdx++)
+	{
+		const ElfW(Phdr)&	phdr	= info->dlpi_phdr[phNdx];
+		const deUintptr		start	= (deUintptr)(info->dlpi_addr + phdr.p_vaddr);
+
+		if (phdr.p_type == PT_LOAD && de::inRange(addr, start, start + (deUintptr)phdr.p_memsz - 1))
+			return true;
+	}
+
+	return false;
+}
+
+int findElfBuildId (struct dl_phdr_info* info, size_t infoSize, void* userPtr)
+{
+	ElfBuildIdQuery* const query = static_cast<ElfBuildIdQuery*>(userPtr);
+
+	DE_UNREF(infoSize);
+
+	if (!containsAddress(info, query->address))
+		return 0; // Continue to next object
+
+	for (int phNdx = 0; phNdx < (int)info->dlpi_phnum; phNdx++)
+	{
+		const ElfW(Phdr)&		phdr	= info->dlpi_phdr[phNdx];
+		const deUint8*			pos		= (const deUint8*)(info->dlpi_addr + phdr.p_vaddr);
+		const deUint8* const	end		= pos + phdr.p_memsz;
+
+		if (phdr.p_type != PT_NOTE)
+			continue;
+
+		while (pos + sizeof(ElfW(Nhdr)) <= end)
+		{
+			const ElfW(Nhdr)* const	note	= (const ElfW(Nhdr)*)pos;
+			const deUint8* const	name	= pos + sizeof(ElfW(Nhdr));
+			const deUint8* const	desc	= name + deAlign32((deInt32)note->n_namesz, 4);
+			const deUint8* const	next	= desc + deAlign32((deInt32)note->n_descsz, 4);
+
+			if (next > end)
+				break;
+
+			if (note->n_type == NT_GNU_BUILD_ID && note->n_namesz == 4 && deMemCmp(name, "GNU", 4) == 0)
+			{
+				static const char s_hexDigits[] = "0123456789abcdef";
+
+				for (deUint32 byteNdx = 0; byteNdx < note->n_descsz; byteNdx++)
+				{
+					query->buildId += s_hexDigits[desc[byteNdx] >> 4];
+					query->buildId += s_hexDigits[desc[byteNdx] & 0xf];
+				}
+
+				return 1;
+			}
+
+			pos = next;
+		}
+	}
+
+	return 1; // Object found, but it has no build id
+}
+
+//! Get GNU build id of the binary containing this code, embedded by linker.
+string getElfBuildId (void)
+{
+	ElfBuildIdQuery query;
+
+	query.address = (const void*)&getElfBuildId;
+	dl_iterate_phdr(findElfBuildId, &query);
+
+	return query.buildId;
+}
+
+#endif // TCU_HAVE_ELF_BUILD_ID
+
+//! Identify binary by file size and modification time, used when build id is not available.
+string getFileStatBuildId (const char* filename)
+{
+	struct stat st;
+
+	if (!filename[0] || stat(filename, &st) != 0)
+		return "";
+
+	{
+		std::ostringstream str;
+		str << "stat-" << (deInt64)st.st_size << "-" << (deInt64)st.st_mtime;
+		return str.str();
+	}
+}
+
+// Options that only control which cases are run or how results are logged. Anything else
+// may affect test hierarchy and is included in cache key.
+static const char* const s_hierarchyIndependentOptions[] =
+{
+	"-n",
+	"--deqp-case",
+	"--deqp-caselist",
+	"--deqp-caselist-file",
+	"--deqp-stdin-caselist",
+	"--deqp-log-filename",
+	"--deqp-runmode",
+	"--deqp-caselist-export-file",
+	"--deqp-caselist-cache",
+	"--deqp-watchdog",
+	"--deqp-watchdog-timings",
+	"--deqp-crashhandler",
+	"--deqp-log-images",
+	"--deqp-log-shader-sources",
+	"--deqp-call-trace-buffer-size",
+	"--deqp-shard-count",
+	"--deqp-shard-index",
+	"--deqp-shard-mode",
+	"--deqp-fork-server",
+	"--deqp-worker-threads",
+};
+
+// Options that don't take a value.
+static const char* const s_flagOptions[] =
+{
+	"--deqp-stdin-caselist",
+	"--deqp-fork-server",
+};
+
+bool isInList (const string& name, const char* const* list, int listSize)
+{
+	for (int ndx = 0; ndx < listSize; ndx++)
+	{
+		if (name == list[ndx])
+			return true;
+	}
+	return false;
+}
+
+//! Get command line options that may affect test hierarchy.
+string getHierarchyOptions (const CommandLine& cmdLine)
+{
+	const vector<string>&	args	= cmdLine.getArguments();
+	std::ostringstream		str;
+
+	for (size_t argNdx = 0; argNdx < args.size(); argNdx++)
+	{
+		const string&	arg			= args[argNdx];
+		const size_t	valuePos	= arg.find('=');
+		const string	name		= arg.substr(0, valuePos);
+		const bool		takesValue	= valuePos == string::npos && !isInList(name, s_flagOptions, DE_LENGTH_OF_ARRAY(s_flagOptions)) && arg[0] == '-';
+		const bool		include		= !isInList(name, s_hierarchyIndependentOptions, DE_LENGTH_OF_ARRAY(s_hierarchyIndependentOptions));
+
+		if (include)
+			str << " " << arg;
+
+		if (takesValue && argNdx+1 < args.size())
+		{
+			argNdx += 1;
+
+			if (include)
+				str << " " << args[argNdx];
+		}
+	}
+
+	return str.str();
+}
+
+void escapeDescription (const char* str, std::ostream& dst)
+{
+	for (const char* pos = str; *pos; ++pos)
+	{
+		switch (*pos)
+		{
+			case '\\':	dst << "\\\\";	break;
+			case '\n':	dst << "\\n";	break;
+			case '\r':	dst << "\\r";	break;
+			default:	dst << *pos;	break;
+		}
+	}
+}
+
+string unescapeDescription (const char* str, int len)
+{
+	string res;
+
+	res.reserve(len);
+
+	for (int ndx = 0; ndx < len; ndx++)
+	{
+		if (str[ndx] == '\\' && ndx+1 < len)
+		{
+			switch (str[++ndx])
+			{
+				case 'n':	res += '\n';		break;
+				case 'r':	res += '\r';		break;
+				default:	res += str[ndx];	break;
+			}
+		}
+		else
+			res += str[ndx];
+	}
+
+	return res;
+}
+
+// Placeholder nodes. Children of packages and groups are created from
+// cache records in init() and destroyed in deinit() like normal groups.
+
+void createCachedChildren (TestNode* parent, const HierarchyCache& cache, int recordNdx);
+
+class CachedTestPackage : public TestPackage
+{
+public:
+								CachedTestPackage	(TestContext& testCtx, const HierarchyCache& cache, int recordNdx, const string& name, const string& description)
+									: TestPackage	(testCtx, name.c_str(), description.c_str())
+									, m_cache		(cache)
+									, m_recordNdx	(recordNdx)
+								{
+								}
+
+	void						init				(void) { createCachedChildren(this, m_cache, m_recordNdx); }
+
+	TestCaseExecutor*			createExecutor		(void) const
+	{
+		throw InternalError("Cached test hierarchy can't be executed");
+	}
+
+private:
+	const HierarchyCache&		m_cache;
+	const int					m_recordNdx;
+};
+
+class CachedTestGroup : public TestCaseGroup
+{
+public:
+								CachedTestGroup		(TestContext& testCtx, const HierarchyCache& cache, int recordNdx, const string& name, const string& description)
+									: TestCaseGroup	(testCtx, name.c_str(), description.c_str())
+									, m_cache		(cache)
+									, m_recordNdx	(recordNdx)
+								{
+								}
+
+	void						init				(void) { createCachedChildren(this, m_cache, m_recordNdx); }
+
+private:
+	const HierarchyCache&		m_cache;
+	const int					m_recordNdx;
+};
+
+class CachedTestCase : public TestCase
+{
+public:
+								CachedTestCase		(TestContext& testCtx, TestNodeType nodeType, const string& name, const string& description)
+									: TestCase(testCtx, nodeType, name.c_str(), description.c_str())
+								{
+								}
+
+	IterateResult				iterate				(void)
+	{
+		throw InternalError("Cached test hierarchy can't be executed");
+	}
+};
+
+TestNode* createCachedNode (TestContext& testCtx, const HierarchyCache& cache, int recordNdx)
+{
+	const HierarchyCache::NodeRecord&	record		= cache.getRecord(recordNdx);
+	const string						name		(record.name, record.name + record.nameLen);
+	const string						description	= unescapeDescription(record.description, record.descriptionLen);
+
+	switch (record.nodeType)
+	{
+		case NODETYPE_PACKAGE:	return new CachedTestPackage(testCtx, cache, recordNdx, name, description);
+		case NODETYPE_GROUP:	return new CachedTestGroup(testCtx, cache, recordNdx, name, description);
+		default:
+			DE_ASSERT(isTestNodeTypeExecutable(record.nodeType));
+			return new CachedTestCase(testCtx, record.nodeType, name, description);
+	}
+}
+
+void createCachedChildren (TestNode* parent, const HierarchyCache& cache, int recordNdx)
+{
+	const int end = cache.getRecord(recordNdx).subtreeEnd;
+
+	for (int childNdx = recordNdx+1; childNdx < end; childNdx = cache.getRecord(childNdx).subtreeEnd)
+	{
+		de::MovePtr<TestNode> child (createCachedNode(parent->getTestContext(), cache, childNdx));
+		parent->addChild(child.get());
+		child.release();
+	}
+}
+
+class CachedTestPackageRoot : public TestPackageRoot
+{
+public:
+								CachedTestPackageRoot	(TestContext& testCtx, de::MovePtr<HierarchyCache> cache)
+									: TestPackageRoot	(testCtx)
+									, m_cache			(cache)
+								{
+									for (int ndx = 0; ndx < m_cache->getNumRecords(); ndx = m_cache->getRecord(ndx).subtreeEnd)
+									{
+										de::MovePtr<TestNode> package (createCachedNode(testCtx, *m_cache, ndx));
+										addChild(package.get());
+										package.release();
+									}
+								}
+
+								~CachedTestPackageRoot	(void)
+								{
+									// Packages refer to cache.
+									TestNode::deinit();
+								}
+
+private:
+	const de::UniquePtr<HierarchyCache>	m_cache;
+};
+
+bool readFile (const char* filename, std::vector<char>& dst)
+{
+	std::ifstream in (filename, std::ios_base::binary);
+
+	if (!in.is_open() || !in.good())
+		return false;
+
+	in.seekg(0, std::ios_base::end);
+	dst.resize((size_t)in.tellg());
+	in.seekg(0, std::ios_base::beg);
+
+	if (!dst.empty())
+		in.read(&dst[0], (std::streamsize)dst.size());
+
+	return in.good();
+}
+
+void serializeHierarchy (TestPackageRoot& root, TestContext& testCtx, const string& cacheKey, std::vector<char>& dst)
+{
+	// \note Whole hierarchy is cached regardless of case filters on actual command line.
+	const CommandLine			allCases	("deqp");
+	DefaultHierarchyInflater	inflater	(testCtx);
+	TestHierarchyIterator		iter		(root, inflater, allCases);
+	std::ostringstream			str;
+
+	str << CACHE_MAGIC << " " << cacheKey << "\n";
+
+	for (; iter.getState() != TestHierarchyIterator::STATE_FINISHED; iter.next())
+	{
+		if (iter.getState() == TestHierarchyIterator::STATE_ENTER_NODE)
+		{
+			const TestNode* const	node	= iter.getNode();
+			const string&			path	= iter.getNodePath();
+
+			str << std::count(path.begin(), path.end(), '.') << " " << (int)node->getNodeType() << " " << node->getName() << " ";
+			escapeDescription(node->getDescription(), str);
+			str << "\n";
+		}
+	}
+
+	{
+		const string data = str.str();
+		dst.assign(data.begin(), data.end());
+	}
+}
+
+void writeFile (const char* filename, const std::vector<char>& data)
+{
+	// Write to temporary file first so that interrupted writes never leave a valid-looking cache behind.
+	const string tmpFilename = string(filename) + ".tmp";
+
+	{
+		std::ofstream out (tmpFilename.c_str(), std::ios_base::binary|std::ios_base::trunc);
+
+		if (!out.is_open() || !out.good())
+			throw Exception("Failed to open " + tmpFilename);
+
+		if (!data.empty())
+			out.write(&data[0], (std::streamsize)data.size());
+
+		out.close();
+
+		if (out.fail())
+			throw Exception("Failed to write " + tmpFilename);
+	}
+
+	if (deFileExists(filename))
+		deDeleteFile(filename);
+
+	if (std::rename(tmpFilename.c_str(), filename) != 0)
+		throw Exception("Failed to rename " + tmpFilename + " to " + filename);
+}
+
+} // anonymous
+
+std::string getTestBinaryBuildId (const CommandLine& cmdLine)
+{
+#if defined(TCU_HAVE_ELF_BUILD_ID)
+	string binaryId = getElfBuildId();
+#else
+	string binaryId;
+#endif
+
+	if (binaryId.empty())
+		binaryId = getFileStatBuildId(cmdLine.getBinaryPath());
+
+	if (binaryId.empty())
+		return "";
+
+	{
+		std::ostringstream str;
+		str << qpGetReleaseName() << "-" << toHex(qpGetReleaseId()) << "-" << qpGetTargetName() << "-" << binaryId;
+		return str.str();
+	}
+}
+
+TestPackageRoot* createCachedTestHierarchy (TestPackageRoot& root, TestContext& testCtx, const CommandLine& cmdLine)
+{
+	const char* const			cacheFilename	= cmdLine.getCaseListCacheFile();
+	const string				buildId			= getTestBinaryBuildId(cmdLine);
+	de::MovePtr<HierarchyCache>	cache			(new HierarchyCache());
+
+	DE_ASSERT(cacheFilename);
+
+	if (buildId.empty())
+	{
+		print("WARNING: Failed to determine build id of test binary '%s', not using test hierarchy cache\n", cmdLine.getBinaryPath());
+		return DE_NULL;
+	}
+
+	{
+		const string cacheKey = buildId + "\n" + getHierarchyOptions(cmdLine);
+
+		if (!readFile(cacheFilename, cache->getData()) || !cache->parse(cacheKey))
+		{
+			print("Test hierarchy cache '%s' is missing or out of date, updating..\n", cacheFilename);
+
+			serializeHierarchy(root, testCtx, cacheKey, cache->getData());
+			writeFile(cacheFilename, cache->getData());
+
+			if (!cache->parse(cacheKey))
+				throw InternalError("Failed to parse generated test hierarchy cache");
+		}
+	}
+
+	return new CachedTestPackageRoot(testCtx, cache);
+}
+
+} // tcu
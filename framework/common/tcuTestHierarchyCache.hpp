@@ -0,0 +1,64 @@
+#ifndef _TCUTESTHIERARCHYCACHE_HPP
+#define _TCUTESTHIERARCHYCACHE_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright 2014 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Serialized test hierarchy cache.
+ *
+ * Exporting case lists requires the full test hierarchy, i.e. calling
+ * init() of every group in every package. The cache stores the name,
+ * type and description of every node into a file keyed by the build id
+ * of the test binary (GNU build id embedded by the linker where available)
+ * and the command line options that may affect the hierarchy. Later
+ * exports with the same binary and options are served from the file
+ * without inflating any package.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuDefs.hpp"
+#include "tcuTestPackage.hpp"
+
+#include <string>
+
+namespace tcu
+{
+
+class CommandLine;
+
+//! Get build id of the running test binary, or empty string if it can't be determined.
+std::string			getTestBinaryBuildId			(const CommandLine& cmdLine);
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Create test hierarchy from cache file
+ *
+ * Reads hierarchy from cache file given with --deqp-caselist-cache. If the
+ * file is missing or was written by another build, all packages in root
+ * are inflated once and the cache file is rewritten.
+ *
+ * Returned hierarchy contains only placeholder nodes that can be walked
+ * with TestHierarchyIterator (including case filtering) but not executed.
+ *
+ * \return New test package root, or DE_NULL if the build id of the binary
+ *		   can't be determined and cache can't be used.
+ *//*--------------------------------------------------------------------*/
+TestPackageRoot*	createCachedTestHierarchy		(TestPackageRoot& root, TestContext& testCtx, const CommandLine& cmdLine);
+
+} // tcu
+
+#endif // _TCUTESTHIERARCHYCACHE_HPP
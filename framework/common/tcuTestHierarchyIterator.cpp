@@ -88,12 +88,14 @@ void DefaultHierarchyInflater::leaveGroupNode (TestCaseGroup* testGroup)
 TestHierarchyIterator::TestHierarchyIterator (TestPackageRoot&			rootNode,
 											  TestHierarchyInflater&	inflater,
 											  const CommandLine&		cmdLine)
-	: m_inflater	(inflater)
-	, m_cmdLine		(cmdLine)
+	: m_inflater			(inflater)
+	, m_cmdLine				(cmdLine)
+	, m_numMatchingCases	(0)
 {
 	// Init traverse state and "seek" to first reportable node.
 	NodeIter iter(&rootNode);
 	iter.setState(NodeIter::STATE_ENTER); // Root is never reported
+	iter.caseListNode = cmdLine.getCaseListRoot();
 	m_sessionStack.push_back(iter);
 	next();
 }
@@ -144,17 +146,70 @@ const std::string& TestHierarchyIterator::getNodePath (void) const
 	return m_nodePath;
 }
 
-std::string TestHierarchyIterator::buildNodePath (const vector<NodeIter>& nodeStack)
+bool TestHierarchyIterator::matchNode (const std::string& nodePath, bool isLeaf)
 {
-	string nodePath;
-	for (size_t ndx = 1; ndx < nodeStack.size(); ndx++)
+	NodeIter&		iter	= m_sessionStack.back();
+	const NodeIter&	parent	= m_sessionStack[m_sessionStack.size()-2];
+
+	if (parent.caseListNode)
 	{
-		const NodeIter& iter = nodeStack[ndx];
-		if (ndx > 1) // ignore root package
-			nodePath += ".";
-		nodePath += iter.node->getName();
+		// Case list trie is matched one level at a time.
+		iter.caseListNode = CommandLine::findCaseListNode(parent.caseListNode, iter.node->getName(), isLeaf);
+		return iter.caseListNode != DE_NULL;
 	}
-	return nodePath;
+	else
+		return isLeaf ? m_cmdLine.checkTestCaseName(nodePath.c_str()) : m_cmdLine.checkTestGroupName(nodePath.c_str());
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Find test case that will be entered after current one
+ *
+ * Only siblings of current test case are considered, since finding cases
+ * in other groups would require inflating them. Iterator state is not
+ * changed, but lazily constructed node of returned case is created.
+ *
+ * \param casePath Full path of returned case
+ * \return Next test case in the same group, or DE_NULL if iterator will
+ *		   leave the group or enter a sub-group next.
+ *//*--------------------------------------------------------------------*/
+TestCase* TestHierarchyIterator::peekNextCase (std::string* casePath)
+{
+	DE_ASSERT(getState() != STATE_FINISHED && isTestNodeTypeExecutable(getNode()->getNodeType()));
+	DE_ASSERT(m_sessionStack.size() >= 2);
+
+	const NodeIter&		parent				= m_sessionStack[m_sessionStack.size()-2];
+	const size_t		sepPos				= m_nodePath.rfind('.');
+	const string		parentPath			= sepPos != string::npos ? m_nodePath.substr(0, sepPos) : string();
+	int					numMatchingCases	= m_numMatchingCases;
+
+	for (int childNdx = parent.curChildNdx+1; childNdx < (int)parent.children.size(); childNdx++)
+	{
+		TestNode* const		child		= parent.children[childNdx];
+		const bool			isLeaf		= isTestNodeTypeExecutable(child->getNodeType());
+		const string		childPath	= parentPath.empty() ? string(child->getName()) : parentPath + "." + child->getName();
+		const bool			isMatch		= parent.caseListNode ? CommandLine::findCaseListNode(parent.caseListNode, child->getName(), isLeaf) != DE_NULL
+										: isLeaf ? m_cmdLine.checkTestCaseName(childPath.c_str())
+										: m_cmdLine.checkTestGroupName(childPath.c_str());
+
+		if (!isMatch)
+			continue;
+
+		if (!isLeaf)
+			return DE_NULL;
+
+		// Same shard selection as in next().
+		if (!m_cmdLine.checkTestCaseShard(childPath.c_str(), numMatchingCases++))
+			continue;
+
+		*casePath = childPath;
+
+		if (LazyTestNode* const lazyNode = dynamic_cast<LazyTestNode*>(child))
+			return static_cast<TestCase*>(lazyNode->getNode());
+		else
+			return static_cast<TestCase*>(child);
+	}
+
+	return DE_NULL;
 }
 
 void TestHierarchyIterator::next (void)
@@ -169,15 +224,27 @@ void TestHierarchyIterator::next (void)
 		{
 			case NodeIter::STATE_INIT:
 			{
-				const std::string nodePath = buildNodePath(m_sessionStack);
+				// \note m_nodePath is path of parent node at this point.
+				const std::string nodePath = m_nodePath.empty() ? string(node->getName()) : m_nodePath + "." + node->getName();
 
 				// Return to parent if name doesn't match filter.
-				if (!(isLeaf ? m_cmdLine.checkTestCaseName(nodePath.c_str()) : m_cmdLine.checkTestGroupName(nodePath.c_str())))
+				if (!matchNode(nodePath, isLeaf))
+				{
+					m_sessionStack.pop_back();
+					break;
+				}
+
+				// Return to parent if case belongs to another shard.
+				if (isLeaf && !m_cmdLine.checkTestCaseShard(nodePath.c_str(), m_numMatchingCases++))
 				{
 					m_sessionStack.pop_back();
 					break;
 				}
 
+				// Create lazily constructed node only now that it is known to be needed.
+				if (LazyTestNode* const lazyNode = dynamic_cast<LazyTestNode*>(node))
+					iter.node = lazyNode->getNode();
+
 				m_nodePath = nodePath;
 				iter.setState(NodeIter::STATE_ENTER);
 				return; // Yield enter event
@@ -243,7 +310,13 @@ void TestHierarchyIterator::next (void)
 				}
 
 				m_sessionStack.pop_back();
-				m_nodePath = buildNodePath(m_sessionStack);
+
+				// Strip last component to get back to parent path.
+				{
+					const size_t sepPos = m_nodePath.rfind('.');
+					m_nodePath.erase(sepPos != string::npos ? sepPos : 0);
+				}
+
 				break;
 			}
 
@@ -34,6 +34,7 @@ namespace tcu
 {
 
 class CommandLine;
+class CaseTreeNode;
 
 /*--------------------------------------------------------------------*//*!
  * \brief Test hierarchy inflater
@@ -97,12 +98,23 @@ protected:
  * Root node is never reported, but instead iteration will start on first
  * matching test package node, if there is any.
  *
+ * If sharding is requested on command line, test cases outside selected
+ * shard are skipped like cases not matching the case list. Groups are still
+ * entered even if none of their cases end up in the shard.
+ *
  * Test hierarchy is created on demand with help of TestHierarchyInflater.
  * Upon entering a group node, after STATE_ENTER_NODE has been signaled,
  * inflater is called to construct the list of child nodes for that group.
  * Upon exiting a group node, before STATE_LEAVE_NODE is called, inflater
  * is asked to clean up any resources by calling leaveGroupNode() or
  * leaveTestPackage() depending on the type of the node.
+ *
+ * Child nodes that are LazyTestNode placeholders are matched against the
+ * filter by name and replaced with the actual node only if they are
+ * entered. getNode() never returns a placeholder.
+ *
+ * While iterator is at a test case node, peekNextCase() can be used to find
+ * out which sibling case will be entered next without advancing iterator.
  *//*--------------------------------------------------------------------*/
 class TestHierarchyIterator
 {
@@ -126,6 +138,8 @@ public:
 
 	void					next					(void);
 
+	TestCase*				peekNextCase			(std::string* casePath);
+
 private:
 	struct NodeIter
 	{
@@ -142,6 +156,7 @@ private:
 		NodeIter (void)
 			: node			(DE_NULL)
 			, curChildNdx	(-1)
+			, caseListNode	(DE_NULL)
 			, m_state		(STATE_LAST)
 		{
 		}
@@ -149,6 +164,7 @@ private:
 		NodeIter (TestNode* node_)
 			: node			(node_)
 			, curChildNdx	(-1)
+			, caseListNode	(DE_NULL)
 			, m_state		(STATE_INIT)
 		{
 		}
@@ -176,6 +192,7 @@ private:
 		TestNode*				node;
 		std::vector<TestNode*>	children;
 		int						curChildNdx;
+		const CaseTreeNode*		caseListNode;		//!< Matching case list trie node if case list is a trie.
 
 	private:
 		State					m_state;
@@ -187,7 +204,7 @@ private:
 	bool					matchFolderName			(const std::string& folderName) const;
 	bool					matchCaseName			(const std::string& caseName) const;
 
-	static std::string		buildNodePath			(const std::vector<NodeIter>& nodeStack);
+	bool					matchNode				(const std::string& nodePath, bool isLeaf);
 
 	TestHierarchyInflater&	m_inflater;
 	const CommandLine&		m_cmdLine;
@@ -195,6 +212,7 @@ private:
 	// Current session state.
 	std::vector<NodeIter>	m_sessionStack;
 	std::string				m_nodePath;
+	int						m_numMatchingCases;		//!< Cases matching case list so far, used for sharding.
 };
 
 } // tcu
@@ -187,11 +187,47 @@ TestLog::TestLog (const char* fileName, deUint32 flags)
 		throw ResourceError(std::string("Failed to open test log file '") + fileName + "'");
 }
 
+TestLog::TestLog (qpTestLog* log)
+	: m_log(log)
+{
+	DE_ASSERT(m_log);
+}
+
 TestLog::~TestLog (void)
 {
 	qpTestLog_destroy(m_log);
 }
 
+TestLog* TestLog::createBufferLog (void) const
+{
+	qpTestLog* const log = qpTestLog_createBufferLog(m_log);
+
+	if (!log)
+		throw ResourceError("Failed to create buffered test log file in test log directory");
+
+	try
+	{
+		return new TestLog(log);
+	}
+	catch (...)
+	{
+		qpTestLog_destroy(log);
+		throw;
+	}
+}
+
+void TestLog::appendBufferLog (TestLog& bufferLog)
+{
+	if (qpTestLog_appendBufferLog(m_log, bufferLog.m_log) == DE_FALSE)
+		throw LogWriteFailedError();
+}
+
+void TestLog::appendInterruptedBufferLog (TestLog& bufferLog)
+{
+	if (qpTestLog_appendInterruptedBufferLog(m_log, bufferLog.m_log) == DE_FALSE)
+		throw LogWriteFailedError();
+}
+
 void TestLog::writeMessage (const char* msgStr)
 {
 	if (qpTestLog_writeText(m_log, DE_NULL, DE_NULL, QP_KEY_TAG_LAST, msgStr) == DE_FALSE)
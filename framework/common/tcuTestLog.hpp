@@ -103,6 +103,12 @@ public:
 	explicit			TestLog					(const char* fileName, deUint32 flags = 0);
 						~TestLog				(void);
 
+	//! Create log with same flags that buffers case results until they are written to this log with appendBufferLog().
+	TestLog*			createBufferLog			(void) const;
+	void				appendBufferLog			(TestLog& bufferLog);
+	//! Append partial results of a case interrupted in bufferLog and leave the case open for terminateCase(). For crash and timeout handlers.
+	void				appendInterruptedBufferLog	(TestLog& bufferLog);
+
 	MessageBuilder		operator<<				(const BeginMessageToken&);
 	MessageBuilder		message					(void);
 
@@ -169,6 +175,7 @@ public:
 	void				endSampleList			(void);
 
 private:
+	explicit			TestLog					(qpTestLog* log);
 						TestLog					(const TestLog& other); // Not allowed!
 	TestLog&			operator=				(const TestLog& other); // Not allowed!
 
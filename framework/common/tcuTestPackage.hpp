@@ -58,6 +58,15 @@ public:
 	virtual void						init				(TestCase* testCase, const std::string& path) = 0;
 	virtual void						deinit				(TestCase* testCase) = 0;
 	virtual TestNode::IterateResult		iterate				(TestCase* testCase) = 0;
+
+	/*--------------------------------------------------------------------*//*!
+	 * \brief Hint that nextCase is likely to be executed after current case
+	 *
+	 * Called after init() of current case has succeeded. Executor may start
+	 * preparing nextCase in the background while current case executes, but
+	 * must not rely on nextCase actually being passed to init() next.
+	 *//*--------------------------------------------------------------------*/
+	virtual void						prepareNextCase		(TestCase* nextCase, const std::string& nextCasePath) { DE_UNREF(nextCase); DE_UNREF(nextCasePath); }
 };
 
 /*--------------------------------------------------------------------*//*!
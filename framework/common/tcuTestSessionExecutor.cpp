@@ -23,13 +23,48 @@
 
 #include "tcuTestSessionExecutor.hpp"
 #include "tcuTestLog.hpp"
+#include "tcuCallTrace.hpp"
+#include "tcuCaseTimingFile.hpp"
+#include "tcuCommandLine.hpp"
 
 #include "deClock.h"
+#include "deAtomic.h"
+#include "deThread.hpp"
+#include "deSharedPtr.hpp"
 
 namespace tcu
 {
 
 using std::vector;
+using std::string;
+
+enum
+{
+	//! Adaptive watchdog limit is WATCHDOG_DURATION_FACTOR * historical duration + WATCHDOG_DURATION_MARGIN_MS.
+	WATCHDOG_DURATION_FACTOR		= 4,
+	WATCHDOG_DURATION_MARGIN_MS		= 5000,
+
+	//! Maximum number of thread-safe cases executed concurrently before results are written to log.
+	MAX_PARALLEL_BATCH_SIZE			= 64,
+
+	//! Interval for checking watchdog limits of cases executed in worker threads.
+	PARALLEL_WATCHDOG_POLL_INTERVAL_MS	= 10
+};
+
+static bool isFailureResult (qpTestResult result)
+{
+	switch (result)
+	{
+		case QP_TEST_RESULT_PASS:
+		case QP_TEST_RESULT_NOT_SUPPORTED:
+		case QP_TEST_RESULT_QUALITY_WARNING:
+		case QP_TEST_RESULT_COMPATIBILITY_WARNING:
+			return false;
+
+		default:
+			return true;
+	}
+}
 
 static qpTestCaseType nodeTypeToTestCaseType (TestNodeType nodeType)
 {
@@ -53,7 +88,13 @@ TestSessionExecutor::TestSessionExecutor (TestPackageRoot& root, TestContext& te
 	, m_abortSession	(false)
 	, m_isInTestCase	(false)
 	, m_testStartTime	(0)
+	, m_caseThreadId	(0)
+	, m_parallelCases	(DE_NULL)
+	, m_timedOutCaseNdx	(-1)
+	, m_numWorkerThreads(testCtx.getCommandLine().getNumWorkerThreads() > 0 ? testCtx.getCommandLine().getNumWorkerThreads() : (int)deGetNumAvailableLogicalCores())
 {
+	if (testCtx.getWatchDog() && testCtx.getCommandLine().getWatchDogTimingsFile())
+		readCaseTimingFile(testCtx.getCommandLine().getWatchDogTimingsFile(), m_caseDurations);
 }
 
 TestSessionExecutor::~TestSessionExecutor (void)
@@ -96,7 +137,13 @@ bool TestSessionExecutor::iterate (void)
 						{
 							TestCase* const testCase = static_cast<TestCase*>(curNode);
 
-							if (isEnter)
+							if (isEnter && isParallelCase(testCase))
+							{
+								// Consumes iterator events of executed cases.
+								executeParallelCases();
+								return true;
+							}
+							else if (isEnter)
 							{
 								if (enterTestCase(testCase, m_iterator.getNodePath()))
 									m_state = STATE_EXECUTE_TEST_CASE;
@@ -164,7 +211,6 @@ bool TestSessionExecutor::enterTestCase (TestCase* testCase, const std::string&
 {
 	TestLog&				log			= m_testCtx.getLog();
 	const qpTestCaseType	caseType	= nodeTypeToTestCaseType(testCase->getNodeType());
-	bool					initOk		= false;
 
 	print("\nTest case '%s'..\n", casePath.c_str());
 
@@ -174,6 +220,39 @@ bool TestSessionExecutor::enterTestCase (TestCase* testCase, const std::string&
 
 	m_isInTestCase	= true;
 	m_testStartTime	= deGetMicroseconds();
+	m_caseThreadId	= getCallTraceThreadId();
+
+	// Traces from previous cases are not relevant.
+	clearCallTraces();
+
+	// \note Set before init() so that case can still declare its own limits.
+	setCaseWatchdogLimits(casePath);
+
+	if (!initTestCase(testCase, casePath))
+		return false;
+
+	// Let executor prepare the next case while this one runs.
+	try
+	{
+		std::string		nextCasePath;
+		TestCase* const	nextCase	= m_iterator.peekNextCase(&nextCasePath);
+
+		// \note Cases executed in worker threads call init() concurrently and are not prepared.
+		if (nextCase && !(m_numWorkerThreads > 1 && nextCase->isThreadSafe()))
+			m_caseExecutor->prepareNextCase(nextCase, nextCasePath);
+	}
+	catch (const std::exception&)
+	{
+		// Preparation is only an optimization. Errors are reported when next case is entered.
+	}
+
+	return true;
+}
+
+bool TestSessionExecutor::initTestCase (TestCase* testCase, const std::string& casePath)
+{
+	TestLog&	log		= m_testCtx.getLog();
+	bool		initOk	= false;
 
 	try
 	{
@@ -206,20 +285,53 @@ bool TestSessionExecutor::enterTestCase (TestCase* testCase, const std::string&
 	return initOk;
 }
 
-void TestSessionExecutor::leaveTestCase (TestCase* testCase)
+void TestSessionExecutor::getCaseWatchdogLimits (const string& casePath, int* totalLimitMs, int* intervalLimitMs) const
 {
-	TestLog&	log		= m_testCtx.getLog();
+	const std::map<string, deInt64>::const_iterator	pos	= m_caseDurations.find(casePath);
 
-	// De-init case.
-	try
-	{
-		m_caseExecutor->deinit(testCase);
-	}
-	catch (const tcu::Exception& e)
+	*totalLimitMs		= 0;
+	*intervalLimitMs	= 0;
+
+	if (pos == m_caseDurations.end())
+		return;
+
+	// Known-slow cases get room beyond the default total limit, while a hang
+	// in a known-fast case is detected within seconds instead of minutes.
+	// Interval limit is never raised: a known-slow case must still make progress.
 	{
-		log << e << TestLog::Message << "Error in test case deinit, test program will terminate." << TestLog::EndMessage;
-		m_testCtx.setTerminateAfter(true);
+		const deInt64	limitMs	= pos->second / 1000 * WATCHDOG_DURATION_FACTOR + WATCHDOG_DURATION_MARGIN_MS;
+
+		*totalLimitMs		= (int)de::min<deInt64>(limitMs, 0x7fffffff);
+		*intervalLimitMs	= de::min(*totalLimitMs, qpWatchDog_getDefaultIntervalTimeLimit(m_testCtx.getWatchDog()));
 	}
+}
+
+void TestSessionExecutor::setCaseWatchdogLimits (const string& casePath)
+{
+	int totalLimitMs	= 0;
+	int intervalLimitMs	= 0;
+
+	if (!m_testCtx.getWatchDog())
+		return;
+
+	// Time spent traversing hierarchy since previous case must not count against this case.
+	qpWatchDog_reset(m_testCtx.getWatchDog());
+
+	getCaseWatchdogLimits(casePath, &totalLimitMs, &intervalLimitMs);
+
+	if (totalLimitMs > 0)
+		m_testCtx.setWatchdogLimits(totalLimitMs, intervalLimitMs);
+}
+
+void TestSessionExecutor::leaveTestCase (TestCase* testCase)
+{
+	TestLog&	log		= m_testCtx.getLog();
+
+	// \note Traces must be logged before deinit destroys the tracing wrappers.
+	if (isFailureResult(m_testCtx.getTestResult()))
+		logCallTraces(log);
+
+	deinitTestCase(testCase);
 
 	{
 		const deInt64 duration = deGetMicroseconds()-m_testStartTime;
@@ -236,28 +348,45 @@ void TestSessionExecutor::leaveTestCase (TestCase* testCase)
 		m_isInTestCase = false;
 		m_testCtx.getLog().endCase(testResult, testResultDesc);
 
-		// Update statistics.
-		print("  %s (%s)\n", qpGetTestResultName(testResult), testResultDesc);
-
-		m_status.numExecuted += 1;
-		switch (testResult)
-		{
-			case QP_TEST_RESULT_PASS:					m_status.numPassed			+= 1;	break;
-			case QP_TEST_RESULT_NOT_SUPPORTED:			m_status.numNotSupported	+= 1;	break;
-			case QP_TEST_RESULT_QUALITY_WARNING:		m_status.numWarnings		+= 1;	break;
-			case QP_TEST_RESULT_COMPATIBILITY_WARNING:	m_status.numWarnings		+= 1;	break;
-			default:									m_status.numFailed			+= 1;	break;
-		}
-
-		// terminateAfter, Resource error or any error in deinit means that execution should end
-		if (terminateAfter || testResult == QP_TEST_RESULT_RESOURCE_ERROR)
-			m_abortSession = true;
+		updateStatus(testResult, testResultDesc, terminateAfter);
 	}
 
 	if (m_testCtx.getWatchDog())
 		qpWatchDog_reset(m_testCtx.getWatchDog());
 }
 
+void TestSessionExecutor::deinitTestCase (TestCase* testCase)
+{
+	try
+	{
+		m_caseExecutor->deinit(testCase);
+	}
+	catch (const tcu::Exception& e)
+	{
+		m_testCtx.getLog() << e << TestLog::Message << "Error in test case deinit, test program will terminate." << TestLog::EndMessage;
+		m_testCtx.setTerminateAfter(true);
+	}
+}
+
+void TestSessionExecutor::updateStatus (qpTestResult testResult, const char* testResultDesc, bool terminateAfter)
+{
+	print("  %s (%s)\n", qpGetTestResultName(testResult), testResultDesc);
+
+	m_status.numExecuted += 1;
+	switch (testResult)
+	{
+		case QP_TEST_RESULT_PASS:					m_status.numPassed			+= 1;	break;
+		case QP_TEST_RESULT_NOT_SUPPORTED:			m_status.numNotSupported	+= 1;	break;
+		case QP_TEST_RESULT_QUALITY_WARNING:		m_status.numWarnings		+= 1;	break;
+		case QP_TEST_RESULT_COMPATIBILITY_WARNING:	m_status.numWarnings		+= 1;	break;
+		default:									m_status.numFailed			+= 1;	break;
+	}
+
+	// terminateAfter, Resource error or any error in deinit means that execution should end
+	if (terminateAfter || testResult == QP_TEST_RESULT_RESOURCE_ERROR)
+		m_abortSession = true;
+}
+
 TestCase::IterateResult TestSessionExecutor::iterateTestCase (TestCase* testCase)
 {
 	TestLog&				log				= m_testCtx.getLog();
@@ -289,4 +418,338 @@ TestCase::IterateResult TestSessionExecutor::iterateTestCase (TestCase* testCase
 	return iterateResult;
 }
 
+// Parallel execution
+
+struct TestSessionExecutor::ParallelCase
+{
+	enum Status
+	{
+		STATUS_PENDING = 0,
+		STATUS_RUNNING,
+		STATUS_FINISHED		//!< Log is complete and no longer written by worker
+	};
+
+	TestCase*						testCase;
+	std::string						casePath;
+	de::SharedPtr<TestLog>			log;
+	qpTestResult					testResult;
+	std::string						testResultDesc;
+	bool							terminateAfter;
+
+	volatile deUint32				status;
+	volatile deUint64				startTime;
+	volatile deUint32				threadId;		//!< getCallTraceThreadId() of worker thread
+	TestContext::ThreadWatchDog		watchDog;
+
+	ParallelCase (TestCase* testCase_, const std::string& casePath_)
+		: testCase			(testCase_)
+		, casePath			(casePath_)
+		, testResult		(QP_TEST_RESULT_LAST)
+		, terminateAfter	(false)
+		, status			(STATUS_PENDING)
+		, startTime			(0)
+		, threadId			(0)
+	{
+	}
+};
+
+class TestSessionExecutor::ParallelCaseWorker : public de::Thread
+{
+public:
+	ParallelCaseWorker (TestSessionExecutor& executor, vector<ParallelCase>& cases, volatile deInt32* nextCaseNdx)
+		: m_executor	(executor)
+		, m_cases		(cases)
+		, m_nextCaseNdx	(nextCaseNdx)
+	{
+	}
+
+	void run (void)
+	{
+		for (;;)
+		{
+			const int caseNdx = (int)deAtomicIncrement32(m_nextCaseNdx) - 1;
+
+			if (caseNdx >= (int)m_cases.size())
+				break;
+
+			m_executor.executeCaseInThread(m_cases[caseNdx]);
+		}
+	}
+
+private:
+	TestSessionExecutor&	m_executor;
+	vector<ParallelCase>&	m_cases;
+	volatile deInt32*		m_nextCaseNdx;
+};
+
+bool TestSessionExecutor::isParallelCase (const TestNode* node) const
+{
+	return m_numWorkerThreads > 1									&&
+		   m_iterator.getState() == TestHierarchyIterator::STATE_ENTER_NODE	&&
+		   isTestNodeTypeExecutable(node->getNodeType())			&&
+		   static_cast<const TestCase*>(node)->isThreadSafe();
+}
+
+void TestSessionExecutor::executeParallelCases (void)
+{
+	vector<ParallelCase> cases;
+
+	// Collect consecutive thread-safe siblings. Cases are owned by the parent
+	// group and stay alive until the iterator leaves the group, which happens
+	// only on next() after the group leave event.
+	while (cases.size() < (size_t)MAX_PARALLEL_BATCH_SIZE && isParallelCase(m_iterator.getNode()))
+	{
+		cases.push_back(ParallelCase(static_cast<TestCase*>(m_iterator.getNode()), m_iterator.getNodePath()));
+		cases.back().log = de::SharedPtr<TestLog>(m_testCtx.getLog().createBufferLog());
+
+		m_iterator.next();
+		DE_ASSERT(m_iterator.getState() == TestHierarchyIterator::STATE_LEAVE_NODE && m_iterator.getNode() == cases.back().testCase);
+		m_iterator.next();
+	}
+
+	DE_ASSERT(!cases.empty());
+
+	// Run cases in worker threads.
+	{
+		const int									numWorkers		= de::min(m_numWorkerThreads, (int)cases.size());
+		volatile deInt32							nextCaseNdx		= 0;
+		vector<de::SharedPtr<ParallelCaseWorker> >	workers;
+
+		// \note Crash and watchdog handlers find running and finished cases through m_parallelCases.
+		m_timedOutCaseNdx	= -1;
+		m_parallelCases		= &cases;
+
+		for (int workerNdx = 0; workerNdx < numWorkers; workerNdx++)
+		{
+			workers.push_back(de::SharedPtr<ParallelCaseWorker>(new ParallelCaseWorker(*this, cases, &nextCaseNdx)));
+			workers.back()->start();
+		}
+
+		if (m_testCtx.getWatchDog())
+			watchParallelCases(cases);
+
+		for (int workerNdx = 0; workerNdx < numWorkers; workerNdx++)
+			workers[workerNdx]->join();
+
+		m_parallelCases = DE_NULL;
+	}
+
+	// Commit results in case order. Results after a case that terminates
+	// the session are dropped, just like those cases would not have run.
+	for (vector<ParallelCase>::iterator parallelCase = cases.begin(); parallelCase != cases.end() && !m_abortSession; ++parallelCase)
+	{
+		print("\nTest case '%s'..\n", parallelCase->casePath.c_str());
+
+		m_testCtx.getLog().appendBufferLog(*parallelCase->log);
+		parallelCase->log.clear();
+
+		updateStatus(parallelCase->testResult, parallelCase->testResultDesc.c_str(), parallelCase->terminateAfter);
+	}
+
+	if (m_testCtx.getWatchDog())
+		qpWatchDog_reset(m_testCtx.getWatchDog());
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Check watchdog limits of cases running in worker threads
+ *
+ * Each case has its own deadlines, so a hang in one case is not hidden
+ * by its siblings making progress. Process watchdog is kept from firing
+ * while all running cases are within their limits; it still fires if
+ * the calling thread itself hangs. When a case exceeds its limits, the
+ * process watchdog is made to fire right away so that the timeout is
+ * handled (and serialized with crash handling) in the usual way.
+ *//*--------------------------------------------------------------------*/
+void TestSessionExecutor::watchParallelCases (const vector<ParallelCase>& cases)
+{
+	qpWatchDog* const	watchDog				= m_testCtx.getWatchDog();
+	const deUint64		defaultTotalLimitUs		= (deUint64)qpWatchDog_getDefaultTotalTimeLimit(watchDog) * 1000ull;
+	const deUint64		defaultIntervalLimitUs	= (deUint64)qpWatchDog_getDefaultIntervalTimeLimit(watchDog) * 1000ull;
+
+	for (;;)
+	{
+		const deUint64	curTime			= deGetMicroseconds();
+		bool			allFinished		= true;
+
+		for (int caseNdx = 0; caseNdx < (int)cases.size(); caseNdx++)
+		{
+			const ParallelCase&	parallelCase	= cases[caseNdx];
+
+			if (parallelCase.status != ParallelCase::STATUS_FINISHED)
+				allFinished = false;
+
+			if (parallelCase.status == ParallelCase::STATUS_RUNNING)
+			{
+				const deUint64	totalLimitUs	= parallelCase.watchDog.totalTimeLimitMs > 0	? (deUint64)parallelCase.watchDog.totalTimeLimitMs * 1000ull	: defaultTotalLimitUs;
+				const deUint64	intervalLimitUs	= parallelCase.watchDog.intervalTimeLimitMs > 0	? (deUint64)parallelCase.watchDog.intervalTimeLimitMs * 1000ull	: defaultIntervalLimitUs;
+				const deUint64	startTime		= parallelCase.startTime;
+				const deUint64	lastTouchTime	= parallelCase.watchDog.lastTouchTime;
+
+				if ((curTime > startTime && curTime - startTime > totalLimitUs) ||
+					(curTime > lastTouchTime && curTime - lastTouchTime > intervalLimitUs))
+				{
+					m_timedOutCaseNdx = caseNdx;
+					qpWatchDog_setCaseTimeLimits(watchDog, 1, 1);
+					return;
+				}
+			}
+		}
+
+		if (allFinished)
+			break;
+
+		qpWatchDog_reset(watchDog);
+		deSleep(PARALLEL_WATCHDOG_POLL_INTERVAL_MS);
+	}
+}
+
+void TestSessionExecutor::executeCaseInThread (ParallelCase& parallelCase)
+{
+	TestContext::ThreadCaseScope	caseScope	(m_testCtx, *parallelCase.log, parallelCase.watchDog);
+	TestLog&						log			= m_testCtx.getLog();
+	const deUint64					startTime	= deGetMicroseconds();
+
+	// Traces from previous cases run by this thread are not relevant.
+	clearCallTraces();
+
+	{
+		int totalLimitMs	= 0;
+		int intervalLimitMs	= 0;
+
+		getCaseWatchdogLimits(parallelCase.casePath, &totalLimitMs, &intervalLimitMs);
+
+		parallelCase.watchDog.totalTimeLimitMs		= totalLimitMs;
+		parallelCase.watchDog.intervalTimeLimitMs	= intervalLimitMs;
+		parallelCase.watchDog.lastTouchTime			= startTime;
+		parallelCase.startTime						= startTime;
+		parallelCase.threadId						= getCallTraceThreadId();
+
+		deMemoryReadWriteFence();
+		parallelCase.status = ParallelCase::STATUS_RUNNING;
+	}
+
+	log.startCase(parallelCase.casePath.c_str(), nodeTypeToTestCaseType(parallelCase.testCase->getNodeType()));
+
+	if (initTestCase(parallelCase.testCase, parallelCase.casePath))
+	{
+		while (iterateTestCase(parallelCase.testCase) == TestCase::CONTINUE)
+			;
+	}
+
+	// \note Only buffers created by this thread are logged.
+	if (isFailureResult(m_testCtx.getTestResult()))
+		logCallTraces(log);
+
+	deinitTestCase(parallelCase.testCase);
+
+	log << TestLog::Integer("TestDuration", "Test case duration in microseconds", "us", QP_KEY_TAG_TIME, (deInt64)(deGetMicroseconds()-startTime));
+
+	parallelCase.testResult		= m_testCtx.getTestResult();
+	parallelCase.testResultDesc	= m_testCtx.getTestResultDesc();
+	parallelCase.terminateAfter	= m_testCtx.getTerminateAfter();
+
+	DE_ASSERT(parallelCase.testResult != QP_TEST_RESULT_LAST);
+	log.endCase(parallelCase.testResult, parallelCase.testResultDesc.c_str());
+
+	deMemoryReadWriteFence();
+	parallelCase.status = ParallelCase::STATUS_FINISHED;
+}
+
+void TestSessionExecutor::openInterruptedCase (void)
+{
+	// \note THIS MAY BE CALLED BY SIGNAL HANDLER!
+	vector<ParallelCase>* const				cases			= m_parallelCases;
+	const TestContext::ThreadWatchDog*	const	threadWatchDog	= m_testCtx.getThreadWatchDog();
+	TestLog&								log				= m_testCtx.getMainLog();
+	int										interruptedNdx	= -1;
+
+	if (!cases)
+	{
+		// Sequential case is already open in log.
+		if (m_isInTestCase)
+		{
+			try
+			{
+				logInterruptedCallTraces(log, m_caseThreadId);
+			}
+			catch (const std::exception&)
+			{
+				// Can't do much in error handler.
+			}
+		}
+
+		return;
+	}
+
+	// Case that timed out, case run by the calling thread, or the longest running case.
+	if (m_timedOutCaseNdx >= 0)
+		interruptedNdx = m_timedOutCaseNdx;
+	else
+	{
+		for (int caseNdx = 0; caseNdx < (int)cases->size(); caseNdx++)
+		{
+			const ParallelCase& parallelCase = (*cases)[caseNdx];
+
+			if (threadWatchDog == &parallelCase.watchDog)
+			{
+				interruptedNdx = caseNdx;
+				break;
+			}
+			else if (parallelCase.status == ParallelCase::STATUS_RUNNING &&
+					 (interruptedNdx < 0 || parallelCase.startTime < (*cases)[interruptedNdx].startTime))
+				interruptedNdx = caseNdx;
+		}
+	}
+
+	// Keep results of finished cases. Other running cases are left out of the log and can be executed again.
+	for (int caseNdx = 0; caseNdx < (int)cases->size(); caseNdx++)
+	{
+		ParallelCase& parallelCase = (*cases)[caseNdx];
+
+		if (caseNdx != interruptedNdx && parallelCase.status == ParallelCase::STATUS_FINISHED)
+		{
+			try
+			{
+				log.appendBufferLog(*parallelCase.log);
+			}
+			catch (const std::exception&)
+			{
+				// Can't do much in error handler.
+			}
+		}
+	}
+
+	if (interruptedNdx >= 0)
+	{
+		ParallelCase& parallelCase = (*cases)[interruptedNdx];
+
+		print("\nTest case '%s'..\n", parallelCase.casePath.c_str());
+
+		try
+		{
+			log.appendInterruptedBufferLog(*parallelCase.log);
+		}
+		catch (const std::exception&)
+		{
+			// Case didn't get to write anything.
+			try
+			{
+				log.startCase(parallelCase.casePath.c_str(), nodeTypeToTestCaseType(parallelCase.testCase->getNodeType()));
+			}
+			catch (const std::exception&)
+			{
+			}
+		}
+
+		try
+		{
+			logInterruptedCallTraces(log, parallelCase.threadId);
+		}
+		catch (const std::exception&)
+		{
+			// Can't do much in error handler.
+		}
+	}
+}
+
 } // tcu
@@ -30,6 +30,8 @@
 #include "tcuTestHierarchyIterator.hpp"
 #include "deUniquePtr.hpp"
 
+#include <map>
+
 namespace tcu
 {
 
@@ -65,7 +67,20 @@ public:
 
 	bool							iterate				(void);
 
-	bool							isInTestCase		(void) const { return m_isInTestCase;	}
+	bool							isInTestCase		(void) const { return m_isInTestCase || m_parallelCases != DE_NULL;	}
+
+	/*--------------------------------------------------------------------*//*!
+	 * \brief Open interrupted case in main log for TestLog::terminateCase()
+	 *
+	 * Called from crash and watchdog handlers when isInTestCase() is true.
+	 * If thread-safe cases are being executed in worker threads, results of
+	 * finished cases are written to the main log and the interrupted case
+	 * (the one that timed out, the one run by the calling thread, or else
+	 * the longest running one) is opened with its partial results. Other
+	 * running cases are left out of the log.
+	 *//*--------------------------------------------------------------------*/
+	void							openInterruptedCase	(void);
+
 	const TestRunStatus&			getStatus			(void) const { return m_status;			}
 
 private:
@@ -76,6 +91,21 @@ private:
 	TestCase::IterateResult			iterateTestCase		(TestCase* testCase);
 	void							leaveTestCase		(TestCase* testCase);
 
+	bool							initTestCase		(TestCase* testCase, const std::string& casePath);
+	void							deinitTestCase		(TestCase* testCase);
+	void							updateStatus		(qpTestResult testResult, const char* testResultDesc, bool terminateAfter);
+
+	void							getCaseWatchdogLimits	(const std::string& casePath, int* totalLimitMs, int* intervalLimitMs) const;
+	void							setCaseWatchdogLimits	(const std::string& casePath);
+
+	struct ParallelCase;
+	class ParallelCaseWorker;
+
+	bool							isParallelCase		(const TestNode* node) const;
+	void							executeParallelCases(void);
+	void							executeCaseInThread	(ParallelCase& parallelCase);
+	void							watchParallelCases	(const std::vector<ParallelCase>& cases);
+
 	enum State
 	{
 		STATE_TRAVERSE_HIERARCHY = 0,
@@ -95,6 +125,12 @@ private:
 	bool							m_abortSession;
 	bool							m_isInTestCase;
 	deUint64						m_testStartTime;
+	deUint32						m_caseThreadId;		//!< getCallTraceThreadId() of thread executing sequential cases, for crash and watchdog handlers.
+	std::vector<ParallelCase>* volatile	m_parallelCases;	//!< Cases being executed in worker threads, for crash and watchdog handlers.
+	volatile int					m_timedOutCaseNdx;	//!< Parallel case that exceeded its watchdog limits, or -1.
+	const int						m_numWorkerThreads;	//!< Threads for executing thread-safe cases, 1 disables parallel execution.
+
+	std::map<std::string, deInt64>	m_caseDurations;	//!< Historical case durations in microseconds (--deqp-watchdog-timings).
 };
 
 } // tcu
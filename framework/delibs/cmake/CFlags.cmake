@@ -49,6 +49,12 @@ if (DE_COMPILER_IS_GCC OR DE_COMPILER_IS_CLANG)
 	set(CMAKE_C_FLAGS			"${CMAKE_C_FLAGS} ${TARGET_FLAGS} ${WARNING_FLAGS} -ansi -pedantic ")
 	set(CMAKE_CXX_FLAGS			"${CMAKE_CXX_FLAGS} ${TARGET_FLAGS} ${WARNING_FLAGS}")
 
+	if (DE_OS_IS_UNIX OR DE_OS_IS_ANDROID)
+		# Embed GNU build id note, used to identify test binary at runtime (see tcuTestHierarchyCache.cpp)
+		set(CMAKE_EXE_LINKER_FLAGS		"${CMAKE_EXE_LINKER_FLAGS} -Wl,--build-id")
+		set(CMAKE_SHARED_LINKER_FLAGS	"${CMAKE_SHARED_LINKER_FLAGS} -Wl,--build-id")
+	endif ()
+
 elseif (DE_COMPILER_IS_MSC)
 	# Compiler flags for msc
 
@@ -0,0 +1,45 @@
+/*-------------------------------------------------------------------------
+ * drawElements C++ Base Library
+ * -----------------------------
+ *
+ * Copyright 2014 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief deMappedFile C++ wrapper.
+ *//*--------------------------------------------------------------------*/
+
+#include "deMappedFile.hpp"
+
+#include <string>
+#include <stdexcept>
+
+namespace de
+{
+
+MappedFile::MappedFile (const char* fileName)
+	: m_file(DE_NULL)
+{
+	m_file = deMappedFile_create(fileName);
+	if (!m_file)
+		throw std::runtime_error(std::string("Failed to map file: '") + fileName + "'");
+}
+
+MappedFile::~MappedFile (void)
+{
+	deMappedFile_destroy(m_file);
+}
+
+} // de
@@ -0,0 +1,53 @@
+#ifndef _DEMAPPEDFILE_HPP
+#define _DEMAPPEDFILE_HPP
+/*-------------------------------------------------------------------------
+ * drawElements C++ Base Library
+ * -----------------------------
+ *
+ * Copyright 2014 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief deMappedFile C++ wrapper.
+ *//*--------------------------------------------------------------------*/
+
+#include "deDefs.hpp"
+#include "deMappedFile.h"
+
+namespace de
+{
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Read-only memory-mapped file
+ *//*--------------------------------------------------------------------*/
+class MappedFile
+{
+public:
+						MappedFile		(const char* fileName);
+						~MappedFile		(void);
+
+	const deUint8*		getPtr			(void) const { return (const deUint8*)deMappedFile_getPtr(m_file);	}
+	deInt64				getSize			(void) const { return deMappedFile_getSize(m_file);					}
+
+private:
+						MappedFile		(const MappedFile& other); // Not allowed!
+	MappedFile&			operator=		(const MappedFile& other); // Not allowed!
+
+	deMappedFile*		m_file;
+};
+
+} // de
+
+#endif // _DEMAPPEDFILE_HPP
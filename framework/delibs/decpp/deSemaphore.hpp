@@ -48,6 +48,7 @@ public:
 	void			increment		(void) throw();
 	void			decrement		(void) throw();
 	bool			tryDecrement	(void) throw();
+	bool			timedDecrement	(deUint32 timeoutMs) throw();
 
 private:
 					Semaphore		(const Semaphore& other); // Not allowed!
@@ -101,6 +102,17 @@ inline bool Semaphore::tryDecrement (void) throw()
 	return deSemaphore_tryDecrement(m_semaphore) == DE_TRUE;
 }
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Decrement semaphore value with timeout.
+ * \param timeoutMs Maximum time to wait in milliseconds
+ * \return true if decrementing was successful, false if timeout expired
+ *		   before semaphore value became positive.
+ *//*--------------------------------------------------------------------*/
+inline bool Semaphore::timedDecrement (deUint32 timeoutMs) throw()
+{
+	return deSemaphore_timedDecrement(m_semaphore, timeoutMs) == DE_TRUE;
+}
+
 } // de
 
 #endif // _DESEMAPHORE_HPP
@@ -45,6 +45,7 @@ void			deSemaphore_increment		(deSemaphore semaphore);
 void			deSemaphore_decrement		(deSemaphore semaphore);
 
 deBool			deSemaphore_tryDecrement	(deSemaphore semaphore);
+deBool			deSemaphore_timedDecrement	(deSemaphore semaphore, deUint32 timeoutMs);
 
 DE_END_EXTERN_C
 
@@ -27,15 +27,24 @@
 
 #include "deMemory.h"
 #include "deString.h"
+#include "deThread.h"
 
 #include <semaphore.h>
 #include <unistd.h>
+#include <sys/time.h>
 
 typedef struct NamedSemaphore_s
 {
 	sem_t*	semaphore;
 } NamedSemaphore;
 
+static deUint64 getMicroseconds (void)
+{
+	struct timeval tv;
+	gettimeofday(&tv, DE_NULL);
+	return (deUint64)tv.tv_sec*1000000ull + (deUint64)tv.tv_usec;
+}
+
 static void NamedSemaphore_getName (const NamedSemaphore* sem, char* buf, int bufSize)
 {
 	deSprintf(buf, bufSize, "/desem-%d-%p", getpid(), (void*)sem);
@@ -105,4 +114,22 @@ deBool deSemaphore_tryDecrement (deSemaphore semaphore)
 	return (sem_trywait(sem) == 0);
 }
 
+deBool deSemaphore_timedDecrement (deSemaphore semaphore, deUint32 timeoutMs)
+{
+	/* \note sem_timedwait() is not available on OS X / iOS. Poll instead. */
+	sem_t*			sem			= ((NamedSemaphore*)semaphore)->semaphore;
+	const deUint64	deadline	= getMicroseconds() + (deUint64)timeoutMs*1000ull;
+
+	for (;;)
+	{
+		if (sem_trywait(sem) == 0)
+			return DE_TRUE;
+
+		if (getMicroseconds() >= deadline)
+			return DE_FALSE;
+
+		deSleep(1);
+	}
+}
+
 #endif /* DE_OS */
@@ -28,6 +28,8 @@
 #include "deMemory.h"
 
 #include <semaphore.h>
+#include <time.h>
+#include <errno.h>
 
 DE_STATIC_ASSERT(sizeof(deSemaphore) >= sizeof(sem_t*));
 
@@ -81,4 +83,34 @@ deBool deSemaphore_tryDecrement (deSemaphore semaphore)
 	return (sem_trywait(sem) == 0);
 }
 
+deBool deSemaphore_timedDecrement (deSemaphore semaphore, deUint32 timeoutMs)
+{
+	sem_t*			sem		= (sem_t*)semaphore;
+	struct timespec	absTime;
+	int				ret;
+
+	DE_ASSERT(sem);
+
+	/* sem_timedwait() only accepts absolute CLOCK_REALTIME deadline. */
+	clock_gettime(CLOCK_REALTIME, &absTime);
+
+	absTime.tv_sec	+= (time_t)(timeoutMs / 1000);
+	absTime.tv_nsec	+= (long)(timeoutMs % 1000) * 1000000l;
+
+	if (absTime.tv_nsec >= 1000000000l)
+	{
+		absTime.tv_sec	+= 1;
+		absTime.tv_nsec	-= 1000000000l;
+	}
+
+	do
+	{
+		ret = sem_timedwait(sem, &absTime);
+	} while (ret != 0 && errno == EINTR);
+
+	DE_ASSERT(ret == 0 || errno == ETIMEDOUT);
+
+	return (ret == 0);
+}
+
 #endif /* DE_OS */
@@ -77,4 +77,12 @@ deBool deSemaphore_tryDecrement (deSemaphore semaphore)
 	return (ret == WAIT_OBJECT_0);
 }
 
+deBool deSemaphore_timedDecrement (deSemaphore semaphore, deUint32 timeoutMs)
+{
+	HANDLE	handle	= (HANDLE)semaphore;
+	DWORD	ret		= WaitForSingleObject(handle, (DWORD)timeoutMs);
+	DE_ASSERT(ret == WAIT_OBJECT_0 || ret == WAIT_TIMEOUT);
+	return (ret == WAIT_OBJECT_0);
+}
+
 #endif /* DE_OS */
@@ -0,0 +1,169 @@
+/*-------------------------------------------------------------------------
+ * drawElements Utility Library
+ * ----------------------------
+ *
+ * Copyright 2014 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Read-only memory-mapped file.
+ *//*--------------------------------------------------------------------*/
+
+#include "deMappedFile.h"
+#include "deMemory.h"
+
+#if (DE_OS == DE_OS_UNIX) || (DE_OS == DE_OS_OSX) || (DE_OS == DE_OS_IOS) || (DE_OS == DE_OS_ANDROID) || (DE_OS == DE_OS_SYMBIAN)
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+struct deMappedFile_s
+{
+	void*		ptr;
+	deInt64		size;
+};
+
+deMappedFile* deMappedFile_create (const char* filename)
+{
+	deMappedFile*	file	= DE_NULL;
+	struct stat		st;
+	int				fd		= open(filename, O_RDONLY);
+
+	if (fd < 0)
+		return DE_NULL;
+
+	if (fstat(fd, &st) != 0)
+	{
+		close(fd);
+		return DE_NULL;
+	}
+
+	file = (deMappedFile*)deCalloc(sizeof(deMappedFile));
+	if (!file)
+	{
+		close(fd);
+		return DE_NULL;
+	}
+
+	file->size = (deInt64)st.st_size;
+
+	if (file->size > 0)
+	{
+		file->ptr = mmap(DE_NULL, (size_t)file->size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+		if (file->ptr == MAP_FAILED)
+		{
+			deFree(file);
+			close(fd);
+			return DE_NULL;
+		}
+	}
+
+	/* Mapping keeps its own reference to the file. */
+	close(fd);
+
+	return file;
+}
+
+void deMappedFile_destroy (deMappedFile* file)
+{
+	if (file->ptr)
+		munmap(file->ptr, (size_t)file->size);
+
+	deFree(file);
+}
+
+#elif (DE_OS == DE_OS_WIN32)
+
+#define VC_EXTRALEAN
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+struct deMappedFile_s
+{
+	void*		ptr;
+	deInt64		size;
+};
+
+deMappedFile* deMappedFile_create (const char* filename)
+{
+	deMappedFile*	file		= DE_NULL;
+	HANDLE			handle		= CreateFile(filename, GENERIC_READ, FILE_SHARE_DELETE|FILE_SHARE_READ|FILE_SHARE_WRITE, DE_NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, DE_NULL);
+	HANDLE			mapping		= DE_NULL;
+	DWORD			highBits	= 0;
+	DWORD			lowBits		= 0;
+
+	if (handle == INVALID_HANDLE_VALUE)
+		return DE_NULL;
+
+	lowBits = GetFileSize(handle, &highBits);
+
+	file = (deMappedFile*)deCalloc(sizeof(deMappedFile));
+	if (!file)
+	{
+		CloseHandle(handle);
+		return DE_NULL;
+	}
+
+	file->size = (deInt64)(((deUint64)highBits << 32) | (deUint64)lowBits);
+
+	if (file->size > 0)
+	{
+		mapping = CreateFileMapping(handle, DE_NULL, PAGE_READONLY, 0, 0, DE_NULL);
+
+		if (mapping)
+		{
+			file->ptr = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+			CloseHandle(mapping);
+		}
+
+		if (!file->ptr)
+		{
+			deFree(file);
+			CloseHandle(handle);
+			return DE_NULL;
+		}
+	}
+
+	/* View keeps its own reference to the file. */
+	CloseHandle(handle);
+
+	return file;
+}
+
+void deMappedFile_destroy (deMappedFile* file)
+{
+	if (file->ptr)
+		UnmapViewOfFile(file->ptr);
+
+	deFree(file);
+}
+
+#else
+#	error Implement deMappedFile for your OS.
+#endif
+
+const void* deMappedFile_getPtr (const deMappedFile* file)
+{
+	return file->ptr;
+}
+
+deInt64 deMappedFile_getSize (const deMappedFile* file)
+{
+	return file->size;
+}
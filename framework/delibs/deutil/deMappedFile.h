@@ -0,0 +1,44 @@
+#ifndef _DEMAPPEDFILE_H
+#define _DEMAPPEDFILE_H
+/*-------------------------------------------------------------------------
+ * drawElements Utility Library
+ * ----------------------------
+ *
+ * Copyright 2014 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Read-only memory-mapped file.
+ *//*--------------------------------------------------------------------*/
+
+#include "deDefs.h"
+
+DE_BEGIN_EXTERN_C
+
+/* Mapped file type. */
+typedef struct deMappedFile_s deMappedFile;
+
+/* Mapped file API. */
+
+deMappedFile*	deMappedFile_create		(const char* filename);
+void			deMappedFile_destroy	(deMappedFile* file);
+
+/* \note Pointer is DE_NULL for empty files. */
+const void*		deMappedFile_getPtr		(const deMappedFile* file);
+deInt64			deMappedFile_getSize	(const deMappedFile* file);
+
+DE_END_EXTERN_C
+
+#endif /* _DEMAPPEDFILE_H */
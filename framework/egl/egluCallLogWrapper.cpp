@@ -25,6 +25,7 @@
 #include "egluStrUtil.hpp"
 #include "eglwLibrary.hpp"
 #include "eglwEnums.hpp"
+#include "tcuCallTrace.hpp"
 #include "deStringUtil.hpp"
 #include "deInt32.h"
 
@@ -34,15 +35,42 @@ namespace eglu
 using tcu::toHex;
 using tcu::TestLog;
 
+static const tcu::CallTraceFunction s_callTraceFunctions[] =
+{
+#include "egluCallLogWrapperTrace.inl"
+};
+
 CallLogWrapper::CallLogWrapper (const eglw::Library& egl, TestLog& log)
 	: m_egl			(egl)
 	, m_log			(log)
 	, m_enableLog	(false)
+	, m_trace		(DE_NULL)
 {
+	if (tcu::getDefaultCallTraceBufferSize() > 0)
+		enableTracing(tcu::getDefaultCallTraceBufferSize());
 }
 
 CallLogWrapper::~CallLogWrapper (void)
 {
+	disableTracing();
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Record calls to a ring buffer
+ *
+ * Recorded calls are written to the test log if the test case fails.
+ * Tracing is enabled by default if --deqp-call-trace-buffer-size is given.
+ *//*--------------------------------------------------------------------*/
+void CallLogWrapper::enableTracing (size_t bufferSize)
+{
+	disableTracing();
+	m_trace = new tcu::CallTraceBuffer("EGL", s_callTraceFunctions, DE_LENGTH_OF_ARRAY(s_callTraceFunctions), bufferSize);
+}
+
+void CallLogWrapper::disableTracing (void)
+{
+	delete m_trace;
+	m_trace = DE_NULL;
 }
 
 // Pointer formatter.
@@ -32,6 +32,11 @@ namespace eglw
 class Library;
 }
 
+namespace tcu
+{
+class CallTraceBuffer;
+}
+
 namespace eglu
 {
 
@@ -46,10 +51,18 @@ public:
 
 	void					enableLogging			(bool enable)	{ m_enableLog = enable; }
 
+	void					enableTracing			(size_t bufferSize);
+	void					disableTracing			(void);
+	tcu::CallTraceBuffer*	getTrace				(void)			{ return m_trace; }
+
 private:
+							CallLogWrapper			(const CallLogWrapper& other);
+	CallLogWrapper&			operator=				(const CallLogWrapper& other);
+
 	const eglw::Library&	m_egl;
 	tcu::TestLog&			m_log;
 	bool					m_enableLog;
+	tcu::CallTraceBuffer*	m_trace;
 };
 
 } // eglu
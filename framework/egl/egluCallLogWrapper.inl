@@ -8,6 +8,11 @@ eglw::EGLBoolean CallLogWrapper::eglBindAPI (eglw::EGLenum api)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglBindAPI(" << getAPIStr(api) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(0, 1);
+		args[0] = tcu::callTraceArg(api);
+	}
 	eglw::EGLBoolean returnValue = m_egl.bindAPI(api);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -18,6 +23,13 @@ eglw::EGLBoolean CallLogWrapper::eglBindTexImage (eglw::EGLDisplay dpy, eglw::EG
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglBindTexImage(" << dpy << ", " << toHex(surface) << ", " << buffer << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(1, 3);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(surface);
+		args[2] = tcu::callTraceArg(buffer);
+	}
 	eglw::EGLBoolean returnValue = m_egl.bindTexImage(dpy, surface, buffer);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -28,6 +40,15 @@ eglw::EGLBoolean CallLogWrapper::eglChooseConfig (eglw::EGLDisplay dpy, const eg
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglChooseConfig(" << dpy << ", " << getConfigAttribListStr(attrib_list) << ", " << configs << ", " << config_size << ", " << num_config << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(2, 5);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(attrib_list);
+		args[2] = tcu::callTraceArg(configs);
+		args[3] = tcu::callTraceArg(config_size);
+		args[4] = tcu::callTraceArg(num_config);
+	}
 	eglw::EGLBoolean returnValue = m_egl.chooseConfig(dpy, attrib_list, configs, config_size, num_config);
 	if (m_enableLog)
 	{
@@ -43,6 +64,14 @@ eglw::EGLint CallLogWrapper::eglClientWaitSync (eglw::EGLDisplay dpy, eglw::EGLS
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglClientWaitSync(" << dpy << ", " << sync << ", " << flags << ", " << timeout << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(3, 4);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(sync);
+		args[2] = tcu::callTraceArg(flags);
+		args[3] = tcu::callTraceArg(timeout);
+	}
 	eglw::EGLint returnValue = m_egl.clientWaitSync(dpy, sync, flags, timeout);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -53,6 +82,14 @@ eglw::EGLint CallLogWrapper::eglClientWaitSyncKHR (eglw::EGLDisplay dpy, eglw::E
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglClientWaitSyncKHR(" << dpy << ", " << sync << ", " << flags << ", " << timeout << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(4, 4);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(sync);
+		args[2] = tcu::callTraceArg(flags);
+		args[3] = tcu::callTraceArg(timeout);
+	}
 	eglw::EGLint returnValue = m_egl.clientWaitSyncKHR(dpy, sync, flags, timeout);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -63,6 +100,13 @@ eglw::EGLBoolean CallLogWrapper::eglCopyBuffers (eglw::EGLDisplay dpy, eglw::EGL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglCopyBuffers(" << dpy << ", " << toHex(surface) << ", " << toHex(target) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(5, 3);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(surface);
+		args[2] = tcu::callTraceArg(target);
+	}
 	eglw::EGLBoolean returnValue = m_egl.copyBuffers(dpy, surface, target);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -73,6 +117,14 @@ eglw::EGLContext CallLogWrapper::eglCreateContext (eglw::EGLDisplay dpy, eglw::E
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglCreateContext(" << dpy << ", " << toHex(config) << ", " << share_context << ", " << getContextAttribListStr(attrib_list) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(6, 4);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(config);
+		args[2] = tcu::callTraceArg(share_context);
+		args[3] = tcu::callTraceArg(attrib_list);
+	}
 	eglw::EGLContext returnValue = m_egl.createContext(dpy, config, share_context, attrib_list);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -83,6 +135,15 @@ eglw::EGLImage CallLogWrapper::eglCreateImage (eglw::EGLDisplay dpy, eglw::EGLCo
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglCreateImage(" << dpy << ", " << ctx << ", " << toHex(target) << ", " << toHex(buffer) << ", " << attrib_list << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(7, 5);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(ctx);
+		args[2] = tcu::callTraceArg(target);
+		args[3] = tcu::callTraceArg(buffer);
+		args[4] = tcu::callTraceArg(attrib_list);
+	}
 	eglw::EGLImage returnValue = m_egl.createImage(dpy, ctx, target, buffer, attrib_list);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -93,6 +154,15 @@ eglw::EGLImageKHR CallLogWrapper::eglCreateImageKHR (eglw::EGLDisplay dpy, eglw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglCreateImageKHR(" << dpy << ", " << ctx << ", " << toHex(target) << ", " << toHex(buffer) << ", " << attrib_list << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(8, 5);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(ctx);
+		args[2] = tcu::callTraceArg(target);
+		args[3] = tcu::callTraceArg(buffer);
+		args[4] = tcu::callTraceArg(attrib_list);
+	}
 	eglw::EGLImageKHR returnValue = m_egl.createImageKHR(dpy, ctx, target, buffer, attrib_list);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -103,6 +173,15 @@ eglw::EGLSurface CallLogWrapper::eglCreatePbufferFromClientBuffer (eglw::EGLDisp
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglCreatePbufferFromClientBuffer(" << dpy << ", " << toHex(buftype) << ", " << toHex(buffer) << ", " << toHex(config) << ", " << attrib_list << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(9, 5);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(buftype);
+		args[2] = tcu::callTraceArg(buffer);
+		args[3] = tcu::callTraceArg(config);
+		args[4] = tcu::callTraceArg(attrib_list);
+	}
 	eglw::EGLSurface returnValue = m_egl.createPbufferFromClientBuffer(dpy, buftype, buffer, config, attrib_list);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << toHex(returnValue) << " returned" << TestLog::EndMessage;
@@ -113,6 +192,13 @@ eglw::EGLSurface CallLogWrapper::eglCreatePbufferSurface (eglw::EGLDisplay dpy,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglCreatePbufferSurface(" << dpy << ", " << toHex(config) << ", " << getSurfaceAttribListStr(attrib_list) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(10, 3);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(config);
+		args[2] = tcu::callTraceArg(attrib_list);
+	}
 	eglw::EGLSurface returnValue = m_egl.createPbufferSurface(dpy, config, attrib_list);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << toHex(returnValue) << " returned" << TestLog::EndMessage;
@@ -123,6 +209,14 @@ eglw::EGLSurface CallLogWrapper::eglCreatePixmapSurface (eglw::EGLDisplay dpy, e
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglCreatePixmapSurface(" << dpy << ", " << toHex(config) << ", " << toHex(pixmap) << ", " << getSurfaceAttribListStr(attrib_list) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(11, 4);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(config);
+		args[2] = tcu::callTraceArg(pixmap);
+		args[3] = tcu::callTraceArg(attrib_list);
+	}
 	eglw::EGLSurface returnValue = m_egl.createPixmapSurface(dpy, config, pixmap, attrib_list);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << toHex(returnValue) << " returned" << TestLog::EndMessage;
@@ -133,6 +227,14 @@ eglw::EGLSurface CallLogWrapper::eglCreatePlatformPixmapSurface (eglw::EGLDispla
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglCreatePlatformPixmapSurface(" << dpy << ", " << toHex(config) << ", " << native_pixmap << ", " << attrib_list << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(12, 4);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(config);
+		args[2] = tcu::callTraceArg(native_pixmap);
+		args[3] = tcu::callTraceArg(attrib_list);
+	}
 	eglw::EGLSurface returnValue = m_egl.createPlatformPixmapSurface(dpy, config, native_pixmap, attrib_list);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << toHex(returnValue) << " returned" << TestLog::EndMessage;
@@ -143,6 +245,14 @@ eglw::EGLSurface CallLogWrapper::eglCreatePlatformPixmapSurfaceEXT (eglw::EGLDis
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglCreatePlatformPixmapSurfaceEXT(" << dpy << ", " << toHex(config) << ", " << native_pixmap << ", " << attrib_list << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(13, 4);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(config);
+		args[2] = tcu::callTraceArg(native_pixmap);
+		args[3] = tcu::callTraceArg(attrib_list);
+	}
 	eglw::EGLSurface returnValue = m_egl.createPlatformPixmapSurfaceEXT(dpy, config, native_pixmap, attrib_list);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << toHex(returnValue) << " returned" << TestLog::EndMessage;
@@ -153,6 +263,14 @@ eglw::EGLSurface CallLogWrapper::eglCreatePlatformWindowSurface (eglw::EGLDispla
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglCreatePlatformWindowSurface(" << dpy << ", " << toHex(config) << ", " << native_window << ", " << attrib_list << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(14, 4);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(config);
+		args[2] = tcu::callTraceArg(native_window);
+		args[3] = tcu::callTraceArg(attrib_list);
+	}
 	eglw::EGLSurface returnValue = m_egl.createPlatformWindowSurface(dpy, config, native_window, attrib_list);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << toHex(returnValue) << " returned" << TestLog::EndMessage;
@@ -163,6 +281,14 @@ eglw::EGLSurface CallLogWrapper::eglCreatePlatformWindowSurfaceEXT (eglw::EGLDis
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglCreatePlatformWindowSurfaceEXT(" << dpy << ", " << toHex(config) << ", " << native_window << ", " << attrib_list << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(15, 4);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(config);
+		args[2] = tcu::callTraceArg(native_window);
+		args[3] = tcu::callTraceArg(attrib_list);
+	}
 	eglw::EGLSurface returnValue = m_egl.createPlatformWindowSurfaceEXT(dpy, config, native_window, attrib_list);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << toHex(returnValue) << " returned" << TestLog::EndMessage;
@@ -173,6 +299,13 @@ eglw::EGLSync CallLogWrapper::eglCreateSync (eglw::EGLDisplay dpy, eglw::EGLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglCreateSync(" << dpy << ", " << toHex(type) << ", " << attrib_list << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(16, 3);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(type);
+		args[2] = tcu::callTraceArg(attrib_list);
+	}
 	eglw::EGLSync returnValue = m_egl.createSync(dpy, type, attrib_list);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -183,6 +316,13 @@ eglw::EGLSyncKHR CallLogWrapper::eglCreateSyncKHR (eglw::EGLDisplay dpy, eglw::E
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglCreateSyncKHR(" << dpy << ", " << toHex(type) << ", " << attrib_list << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(17, 3);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(type);
+		args[2] = tcu::callTraceArg(attrib_list);
+	}
 	eglw::EGLSyncKHR returnValue = m_egl.createSyncKHR(dpy, type, attrib_list);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -193,6 +333,14 @@ eglw::EGLSurface CallLogWrapper::eglCreateWindowSurface (eglw::EGLDisplay dpy, e
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglCreateWindowSurface(" << dpy << ", " << toHex(config) << ", " << toHex(win) << ", " << getSurfaceAttribListStr(attrib_list) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(18, 4);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(config);
+		args[2] = tcu::callTraceArg(win);
+		args[3] = tcu::callTraceArg(attrib_list);
+	}
 	eglw::EGLSurface returnValue = m_egl.createWindowSurface(dpy, config, win, attrib_list);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << toHex(returnValue) << " returned" << TestLog::EndMessage;
@@ -203,6 +351,12 @@ eglw::EGLBoolean CallLogWrapper::eglDestroyContext (eglw::EGLDisplay dpy, eglw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglDestroyContext(" << dpy << ", " << ctx << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(19, 2);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(ctx);
+	}
 	eglw::EGLBoolean returnValue = m_egl.destroyContext(dpy, ctx);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -213,6 +367,12 @@ eglw::EGLBoolean CallLogWrapper::eglDestroyImage (eglw::EGLDisplay dpy, eglw::EG
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglDestroyImage(" << dpy << ", " << image << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(20, 2);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(image);
+	}
 	eglw::EGLBoolean returnValue = m_egl.destroyImage(dpy, image);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -223,6 +383,12 @@ eglw::EGLBoolean CallLogWrapper::eglDestroyImageKHR (eglw::EGLDisplay dpy, eglw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglDestroyImageKHR(" << dpy << ", " << image << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(21, 2);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(image);
+	}
 	eglw::EGLBoolean returnValue = m_egl.destroyImageKHR(dpy, image);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -233,6 +399,12 @@ eglw::EGLBoolean CallLogWrapper::eglDestroySurface (eglw::EGLDisplay dpy, eglw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglDestroySurface(" << dpy << ", " << toHex(surface) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(22, 2);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(surface);
+	}
 	eglw::EGLBoolean returnValue = m_egl.destroySurface(dpy, surface);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -243,6 +415,12 @@ eglw::EGLBoolean CallLogWrapper::eglDestroySync (eglw::EGLDisplay dpy, eglw::EGL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglDestroySync(" << dpy << ", " << sync << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(23, 2);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(sync);
+	}
 	eglw::EGLBoolean returnValue = m_egl.destroySync(dpy, sync);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -253,6 +431,12 @@ eglw::EGLBoolean CallLogWrapper::eglDestroySyncKHR (eglw::EGLDisplay dpy, eglw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglDestroySyncKHR(" << dpy << ", " << sync << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(24, 2);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(sync);
+	}
 	eglw::EGLBoolean returnValue = m_egl.destroySyncKHR(dpy, sync);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -263,6 +447,14 @@ eglw::EGLBoolean CallLogWrapper::eglGetConfigAttrib (eglw::EGLDisplay dpy, eglw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglGetConfigAttrib(" << dpy << ", " << toHex(config) << ", " << getConfigAttribStr(attribute) << ", " << value << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(25, 4);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(config);
+		args[2] = tcu::callTraceArg(attribute);
+		args[3] = tcu::callTraceArg(value);
+	}
 	eglw::EGLBoolean returnValue = m_egl.getConfigAttrib(dpy, config, attribute, value);
 	if (m_enableLog)
 	{
@@ -277,6 +469,14 @@ eglw::EGLBoolean CallLogWrapper::eglGetConfigs (eglw::EGLDisplay dpy, eglw::EGLC
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglGetConfigs(" << dpy << ", " << configs << ", " << config_size << ", " << num_config << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(26, 4);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(configs);
+		args[2] = tcu::callTraceArg(config_size);
+		args[3] = tcu::callTraceArg(num_config);
+	}
 	eglw::EGLBoolean returnValue = m_egl.getConfigs(dpy, configs, config_size, num_config);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -287,6 +487,8 @@ eglw::EGLContext CallLogWrapper::eglGetCurrentContext ()
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglGetCurrentContext(" << ");" << TestLog::EndMessage;
+	if (m_trace)
+		m_trace->recordCall(27, 0);
 	eglw::EGLContext returnValue = m_egl.getCurrentContext();
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -297,6 +499,8 @@ eglw::EGLDisplay CallLogWrapper::eglGetCurrentDisplay ()
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglGetCurrentDisplay(" << ");" << TestLog::EndMessage;
+	if (m_trace)
+		m_trace->recordCall(28, 0);
 	eglw::EGLDisplay returnValue = m_egl.getCurrentDisplay();
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -307,6 +511,11 @@ eglw::EGLSurface CallLogWrapper::eglGetCurrentSurface (eglw::EGLint readdraw)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglGetCurrentSurface(" << getSurfaceTargetStr(readdraw) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(29, 1);
+		args[0] = tcu::callTraceArg(readdraw);
+	}
 	eglw::EGLSurface returnValue = m_egl.getCurrentSurface(readdraw);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << toHex(returnValue) << " returned" << TestLog::EndMessage;
@@ -317,6 +526,11 @@ eglw::EGLDisplay CallLogWrapper::eglGetDisplay (eglw::EGLNativeDisplayType displ
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglGetDisplay(" << toHex(display_id) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(30, 1);
+		args[0] = tcu::callTraceArg(display_id);
+	}
 	eglw::EGLDisplay returnValue = m_egl.getDisplay(display_id);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -327,6 +541,8 @@ eglw::EGLint CallLogWrapper::eglGetError ()
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglGetError(" << ");" << TestLog::EndMessage;
+	if (m_trace)
+		m_trace->recordCall(31, 0);
 	eglw::EGLint returnValue = m_egl.getError();
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getErrorStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -337,6 +553,13 @@ eglw::EGLDisplay CallLogWrapper::eglGetPlatformDisplay (eglw::EGLenum platform,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglGetPlatformDisplay(" << toHex(platform) << ", " << native_display << ", " << attrib_list << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(32, 3);
+		args[0] = tcu::callTraceArg(platform);
+		args[1] = tcu::callTraceArg(native_display);
+		args[2] = tcu::callTraceArg(attrib_list);
+	}
 	eglw::EGLDisplay returnValue = m_egl.getPlatformDisplay(platform, native_display, attrib_list);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -347,6 +570,13 @@ eglw::EGLDisplay CallLogWrapper::eglGetPlatformDisplayEXT (eglw::EGLenum platfor
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglGetPlatformDisplayEXT(" << toHex(platform) << ", " << native_display << ", " << attrib_list << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(33, 3);
+		args[0] = tcu::callTraceArg(platform);
+		args[1] = tcu::callTraceArg(native_display);
+		args[2] = tcu::callTraceArg(attrib_list);
+	}
 	eglw::EGLDisplay returnValue = m_egl.getPlatformDisplayEXT(platform, native_display, attrib_list);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -357,6 +587,11 @@ eglw::__eglMustCastToProperFunctionPointerType CallLogWrapper::eglGetProcAddress
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglGetProcAddress(" << getStringStr(procname) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(34, 1);
+		args[0] = tcu::callTraceArg(procname);
+	}
 	eglw::__eglMustCastToProperFunctionPointerType returnValue = m_egl.getProcAddress(procname);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << tcu::toHex(returnValue) << " returned" << TestLog::EndMessage;
@@ -367,6 +602,14 @@ eglw::EGLBoolean CallLogWrapper::eglGetSyncAttrib (eglw::EGLDisplay dpy, eglw::E
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglGetSyncAttrib(" << dpy << ", " << sync << ", " << attribute << ", " << value << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(35, 4);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(sync);
+		args[2] = tcu::callTraceArg(attribute);
+		args[3] = tcu::callTraceArg(value);
+	}
 	eglw::EGLBoolean returnValue = m_egl.getSyncAttrib(dpy, sync, attribute, value);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -377,6 +620,14 @@ eglw::EGLBoolean CallLogWrapper::eglGetSyncAttribKHR (eglw::EGLDisplay dpy, eglw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglGetSyncAttribKHR(" << dpy << ", " << sync << ", " << attribute << ", " << value << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(36, 4);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(sync);
+		args[2] = tcu::callTraceArg(attribute);
+		args[3] = tcu::callTraceArg(value);
+	}
 	eglw::EGLBoolean returnValue = m_egl.getSyncAttribKHR(dpy, sync, attribute, value);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -387,6 +638,13 @@ eglw::EGLBoolean CallLogWrapper::eglInitialize (eglw::EGLDisplay dpy, eglw::EGLi
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglInitialize(" << dpy << ", " << major << ", " << minor << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(37, 3);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(major);
+		args[2] = tcu::callTraceArg(minor);
+	}
 	eglw::EGLBoolean returnValue = m_egl.initialize(dpy, major, minor);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -397,6 +655,13 @@ eglw::EGLBoolean CallLogWrapper::eglLockSurfaceKHR (eglw::EGLDisplay dpy, eglw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglLockSurfaceKHR(" << dpy << ", " << toHex(surface) << ", " << attrib_list << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(38, 3);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(surface);
+		args[2] = tcu::callTraceArg(attrib_list);
+	}
 	eglw::EGLBoolean returnValue = m_egl.lockSurfaceKHR(dpy, surface, attrib_list);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -407,6 +672,14 @@ eglw::EGLBoolean CallLogWrapper::eglMakeCurrent (eglw::EGLDisplay dpy, eglw::EGL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglMakeCurrent(" << dpy << ", " << toHex(draw) << ", " << toHex(read) << ", " << ctx << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(39, 4);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(draw);
+		args[2] = tcu::callTraceArg(read);
+		args[3] = tcu::callTraceArg(ctx);
+	}
 	eglw::EGLBoolean returnValue = m_egl.makeCurrent(dpy, draw, read, ctx);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -417,6 +690,8 @@ eglw::EGLenum CallLogWrapper::eglQueryAPI ()
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglQueryAPI(" << ");" << TestLog::EndMessage;
+	if (m_trace)
+		m_trace->recordCall(40, 0);
 	eglw::EGLenum returnValue = m_egl.queryAPI();
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getAPIStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -427,6 +702,14 @@ eglw::EGLBoolean CallLogWrapper::eglQueryContext (eglw::EGLDisplay dpy, eglw::EG
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglQueryContext(" << dpy << ", " << ctx << ", " << getContextAttribStr(attribute) << ", " << value << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(41, 4);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(ctx);
+		args[2] = tcu::callTraceArg(attribute);
+		args[3] = tcu::callTraceArg(value);
+	}
 	eglw::EGLBoolean returnValue = m_egl.queryContext(dpy, ctx, attribute, value);
 	if (m_enableLog)
 	{
@@ -441,6 +724,12 @@ const char * CallLogWrapper::eglQueryString (eglw::EGLDisplay dpy, eglw::EGLint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglQueryString(" << dpy << ", " << name << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(42, 2);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(name);
+	}
 	const char * returnValue = m_egl.queryString(dpy, name);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getStringStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -451,6 +740,14 @@ eglw::EGLBoolean CallLogWrapper::eglQuerySurface (eglw::EGLDisplay dpy, eglw::EG
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglQuerySurface(" << dpy << ", " << toHex(surface) << ", " << getSurfaceAttribStr(attribute) << ", " << value << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(43, 4);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(surface);
+		args[2] = tcu::callTraceArg(attribute);
+		args[3] = tcu::callTraceArg(value);
+	}
 	eglw::EGLBoolean returnValue = m_egl.querySurface(dpy, surface, attribute, value);
 	if (m_enableLog)
 	{
@@ -465,6 +762,13 @@ eglw::EGLBoolean CallLogWrapper::eglReleaseTexImage (eglw::EGLDisplay dpy, eglw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglReleaseTexImage(" << dpy << ", " << toHex(surface) << ", " << buffer << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(44, 3);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(surface);
+		args[2] = tcu::callTraceArg(buffer);
+	}
 	eglw::EGLBoolean returnValue = m_egl.releaseTexImage(dpy, surface, buffer);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -475,6 +779,8 @@ eglw::EGLBoolean CallLogWrapper::eglReleaseThread ()
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglReleaseThread(" << ");" << TestLog::EndMessage;
+	if (m_trace)
+		m_trace->recordCall(45, 0);
 	eglw::EGLBoolean returnValue = m_egl.releaseThread();
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -485,6 +791,14 @@ eglw::EGLBoolean CallLogWrapper::eglSetDamageRegionKHR (eglw::EGLDisplay dpy, eg
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglSetDamageRegionKHR(" << dpy << ", " << toHex(surface) << ", " << rects << ", " << n_rects << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(46, 4);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(surface);
+		args[2] = tcu::callTraceArg(rects);
+		args[3] = tcu::callTraceArg(n_rects);
+	}
 	eglw::EGLBoolean returnValue = m_egl.setDamageRegionKHR(dpy, surface, rects, n_rects);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -495,6 +809,13 @@ eglw::EGLBoolean CallLogWrapper::eglSignalSyncKHR (eglw::EGLDisplay dpy, eglw::E
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglSignalSyncKHR(" << dpy << ", " << sync << ", " << toHex(mode) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(47, 3);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(sync);
+		args[2] = tcu::callTraceArg(mode);
+	}
 	eglw::EGLBoolean returnValue = m_egl.signalSyncKHR(dpy, sync, mode);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -505,6 +826,14 @@ eglw::EGLBoolean CallLogWrapper::eglSurfaceAttrib (eglw::EGLDisplay dpy, eglw::E
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglSurfaceAttrib(" << dpy << ", " << toHex(surface) << ", " << getSurfaceAttribStr(attribute) << ", " << getSurfaceAttribValueStr(attribute, value) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(48, 4);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(surface);
+		args[2] = tcu::callTraceArg(attribute);
+		args[3] = tcu::callTraceArg(value);
+	}
 	eglw::EGLBoolean returnValue = m_egl.surfaceAttrib(dpy, surface, attribute, value);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -515,6 +844,12 @@ eglw::EGLBoolean CallLogWrapper::eglSwapBuffers (eglw::EGLDisplay dpy, eglw::EGL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglSwapBuffers(" << dpy << ", " << toHex(surface) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(49, 2);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(surface);
+	}
 	eglw::EGLBoolean returnValue = m_egl.swapBuffers(dpy, surface);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -525,6 +860,14 @@ eglw::EGLBoolean CallLogWrapper::eglSwapBuffersWithDamageKHR (eglw::EGLDisplay d
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglSwapBuffersWithDamageKHR(" << dpy << ", " << toHex(surface) << ", " << rects << ", " << n_rects << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(50, 4);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(surface);
+		args[2] = tcu::callTraceArg(rects);
+		args[3] = tcu::callTraceArg(n_rects);
+	}
 	eglw::EGLBoolean returnValue = m_egl.swapBuffersWithDamageKHR(dpy, surface, rects, n_rects);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -535,6 +878,12 @@ eglw::EGLBoolean CallLogWrapper::eglSwapInterval (eglw::EGLDisplay dpy, eglw::EG
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglSwapInterval(" << dpy << ", " << interval << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(51, 2);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(interval);
+	}
 	eglw::EGLBoolean returnValue = m_egl.swapInterval(dpy, interval);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -545,6 +894,11 @@ eglw::EGLBoolean CallLogWrapper::eglTerminate (eglw::EGLDisplay dpy)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglTerminate(" << dpy << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(52, 1);
+		args[0] = tcu::callTraceArg(dpy);
+	}
 	eglw::EGLBoolean returnValue = m_egl.terminate(dpy);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -555,6 +909,12 @@ eglw::EGLBoolean CallLogWrapper::eglUnlockSurfaceKHR (eglw::EGLDisplay dpy, eglw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglUnlockSurfaceKHR(" << dpy << ", " << toHex(surface) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(53, 2);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(surface);
+	}
 	eglw::EGLBoolean returnValue = m_egl.unlockSurfaceKHR(dpy, surface);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -565,6 +925,8 @@ eglw::EGLBoolean CallLogWrapper::eglWaitClient ()
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglWaitClient(" << ");" << TestLog::EndMessage;
+	if (m_trace)
+		m_trace->recordCall(54, 0);
 	eglw::EGLBoolean returnValue = m_egl.waitClient();
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -575,6 +937,8 @@ eglw::EGLBoolean CallLogWrapper::eglWaitGL ()
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglWaitGL(" << ");" << TestLog::EndMessage;
+	if (m_trace)
+		m_trace->recordCall(55, 0);
 	eglw::EGLBoolean returnValue = m_egl.waitGL();
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -585,6 +949,11 @@ eglw::EGLBoolean CallLogWrapper::eglWaitNative (eglw::EGLint engine)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglWaitNative(" << engine << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(56, 1);
+		args[0] = tcu::callTraceArg(engine);
+	}
 	eglw::EGLBoolean returnValue = m_egl.waitNative(engine);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -595,6 +964,13 @@ eglw::EGLBoolean CallLogWrapper::eglWaitSync (eglw::EGLDisplay dpy, eglw::EGLSyn
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglWaitSync(" << dpy << ", " << sync << ", " << flags << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(57, 3);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(sync);
+		args[2] = tcu::callTraceArg(flags);
+	}
 	eglw::EGLBoolean returnValue = m_egl.waitSync(dpy, sync, flags);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -605,6 +981,13 @@ eglw::EGLint CallLogWrapper::eglWaitSyncKHR (eglw::EGLDisplay dpy, eglw::EGLSync
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "eglWaitSyncKHR(" << dpy << ", " << sync << ", " << flags << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(58, 3);
+		args[0] = tcu::callTraceArg(dpy);
+		args[1] = tcu::callTraceArg(sync);
+		args[2] = tcu::callTraceArg(flags);
+	}
 	eglw::EGLint returnValue = m_egl.waitSyncKHR(dpy, sync, flags);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
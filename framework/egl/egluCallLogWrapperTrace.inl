@@ -0,0 +1,64 @@
+/* WARNING: This is auto-generated file. Do not modify, since changes will
+ * be lost! Modify the generating script instead.
+ *
+ * Generated from Khronos EGL API description (egl.xml) revision 31042.
+ */
+{ "eglBindAPI",							"x"		},
+{ "eglBindTexImage",					"ppi"	},
+{ "eglChooseConfig",					"pppip"	},
+{ "eglClientWaitSync",					"ppiu"	},
+{ "eglClientWaitSyncKHR",				"ppiu"	},
+{ "eglCopyBuffers",						"ppp"	},
+{ "eglCreateContext",					"pppp"	},
+{ "eglCreateImage",						"ppxpp"	},
+{ "eglCreateImageKHR",					"ppxpp"	},
+{ "eglCreatePbufferFromClientBuffer",	"pxppp"	},
+{ "eglCreatePbufferSurface",			"ppp"	},
+{ "eglCreatePixmapSurface",				"pppp"	},
+{ "eglCreatePlatformPixmapSurface",		"pppp"	},
+{ "eglCreatePlatformPixmapSurfaceEXT",	"pppp"	},
+{ "eglCreatePlatformWindowSurface",		"pppp"	},
+{ "eglCreatePlatformWindowSurfaceEXT",	"pppp"	},
+{ "eglCreateSync",						"pxp"	},
+{ "eglCreateSyncKHR",					"pxp"	},
+{ "eglCreateWindowSurface",				"pppp"	},
+{ "eglDestroyContext",					"pp"	},
+{ "eglDestroyImage",					"pp"	},
+{ "eglDestroyImageKHR",					"pp"	},
+{ "eglDestroySurface",					"pp"	},
+{ "eglDestroySync",						"pp"	},
+{ "eglDestroySyncKHR",					"pp"	},
+{ "eglGetConfigAttrib",					"ppip"	},
+{ "eglGetConfigs",						"ppip"	},
+{ "eglGetCurrentContext",				""		},
+{ "eglGetCurrentDisplay",				""		},
+{ "eglGetCurrentSurface",				"i"		},
+{ "eglGetDisplay",						"p"		},
+{ "eglGetError",						""		},
+{ "eglGetPlatformDisplay",				"xpp"	},
+{ "eglGetPlatformDisplayEXT",			"xpp"	},
+{ "eglGetProcAddress",					"p"		},
+{ "eglGetSyncAttrib",					"ppip"	},
+{ "eglGetSyncAttribKHR",				"ppip"	},
+{ "eglInitialize",						"ppp"	},
+{ "eglLockSurfaceKHR",					"ppp"	},
+{ "eglMakeCurrent",						"pppp"	},
+{ "eglQueryAPI",						""		},
+{ "eglQueryContext",					"ppip"	},
+{ "eglQueryString",						"pi"	},
+{ "eglQuerySurface",					"ppip"	},
+{ "eglReleaseTexImage",					"ppi"	},
+{ "eglReleaseThread",					""		},
+{ "eglSetDamageRegionKHR",				"pppi"	},
+{ "eglSignalSyncKHR",					"ppx"	},
+{ "eglSurfaceAttrib",					"ppii"	},
+{ "eglSwapBuffers",						"pp"	},
+{ "eglSwapBuffersWithDamageKHR",		"pppi"	},
+{ "eglSwapInterval",					"pi"	},
+{ "eglTerminate",						"p"		},
+{ "eglUnlockSurfaceKHR",				"pp"	},
+{ "eglWaitClient",						""		},
+{ "eglWaitGL",							""		},
+{ "eglWaitNative",						"i"		},
+{ "eglWaitSync",						"ppi"	},
+{ "eglWaitSyncKHR",						"ppi"	},
@@ -0,0 +1,290 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Test Process Fork Server
+ * -----------------------------------------------------
+ *
+ * Copyright 2014 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Test process fork server for Unix-like systems.
+ *//*--------------------------------------------------------------------*/
+
+#include "fsForkServer.hpp"
+#include "fsProtocol.hpp"
+#include "deCommandLine.h"
+
+#include <vector>
+#include <string>
+
+#include <stdio.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+using std::string;
+using std::vector;
+
+namespace fs
+{
+
+namespace
+{
+
+enum
+{
+	// Times are in milliseconds.
+	CHILD_POLL_INTERVAL		= 10
+};
+
+void sendMessage (const Message& msg)
+{
+	vector<deUint8>	buf;
+	size_t			pos		= 0;
+
+	writeMessage(msg, buf);
+
+	while (pos < buf.size())
+	{
+		const ssize_t numWritten = ::write(STDOUT_FILENO, &buf[pos], buf.size()-pos);
+
+		if (numWritten < 0)
+		{
+			if (errno == EINTR)
+				continue;
+
+			throw ProtocolError("Failed to write message");
+		}
+
+		pos += (size_t)numWritten;
+	}
+}
+
+//! Read exactly size bytes from stdin. Returns false on end of file.
+bool readFully (deUint8* dst, size_t size)
+{
+	size_t pos = 0;
+
+	while (pos < size)
+	{
+		const ssize_t numRead = ::read(STDIN_FILENO, dst+pos, size-pos);
+
+		if (numRead < 0)
+		{
+			if (errno == EINTR)
+				continue;
+
+			throw ProtocolError("Failed to read message");
+		}
+		else if (numRead == 0)
+			return false;
+
+		pos += (size_t)numRead;
+	}
+
+	return true;
+}
+
+//! Read next request from stdin. Returns false if stdin was closed.
+bool readMessage (Message& dst)
+{
+	vector<deUint8>	buf			(MESSAGE_HEADER_SIZE);
+	MessageType		type		= MESSAGETYPE_NONE;
+	size_t			messageSize	= 0;
+
+	if (!readFully(&buf[0], buf.size()))
+		return false;
+
+	parseHeader(&buf[0], buf.size(), type, messageSize);
+
+	buf.resize(messageSize);
+
+	if (messageSize > MESSAGE_HEADER_SIZE && !readFully(&buf[MESSAGE_HEADER_SIZE], messageSize - MESSAGE_HEADER_SIZE))
+		return false;
+
+	parseMessage(&buf[0], buf.size(), dst);
+
+	return true;
+}
+
+Message makeLaunchFailedMessage (const char* reason)
+{
+	Message msg (MESSAGETYPE_PROCESS_LAUNCH_FAILED);
+	msg.reason = reason;
+	return msg;
+}
+
+Message makeFinishedMessage (int exitCode)
+{
+	Message msg (MESSAGETYPE_PROCESS_FINISHED);
+	msg.exitCode = exitCode;
+	return msg;
+}
+
+bool hasPendingInput (int timeoutMs)
+{
+	struct pollfd fd;
+
+	fd.fd		= STDIN_FILENO;
+	fd.events	= POLLIN;
+	fd.revents	= 0;
+
+	return ::poll(&fd, 1, timeoutMs) > 0;
+}
+
+int getExitCode (int status)
+{
+	if (WIFEXITED(status))
+		return WEXITSTATUS(status);
+	else if (WIFSIGNALED(status))
+		return 128 + WTERMSIG(status); // Same convention as in shells.
+	else
+		return -1;
+}
+
+void runChild (const char* binaryName, const Message& request, ForkServerSessionFunc sessionFunc, void* userPtr)
+{
+	// Stdin and stdout are reserved for server.
+	{
+		const int nullFd = ::open("/dev/null", O_RDONLY);
+
+		if (nullFd >= 0)
+		{
+			dup2(nullFd, STDIN_FILENO);
+			close(nullFd);
+		}
+
+		dup2(STDERR_FILENO, STDOUT_FILENO);
+	}
+
+	signal(SIGPIPE, SIG_DFL);
+
+	{
+		deCommandLine* const	params		= deCommandLine_parse(request.params.c_str());
+		const string			caseListArg	= string("--deqp-caselist=") + request.caseList;
+		vector<const char*>		argv;
+		int						exitCode	= -1;
+
+		if (!params)
+		{
+			fprintf(stderr, "Failed to parse command line '%s'\n", request.params.c_str());
+			_exit(-1);
+		}
+
+		argv.push_back(binaryName);
+
+		for (int argNdx = 0; argNdx < params->numArgs; argNdx++)
+			argv.push_back(params->args[argNdx]);
+
+		if (!request.caseList.empty())
+			argv.push_back(caseListArg.c_str());
+
+		argv.push_back(DE_NULL);
+
+		exitCode = sessionFunc((int)argv.size()-1, &argv[0], userPtr);
+
+		fflush(stdout);
+		fflush(stderr);
+
+		// \note Exit handlers and destructors of the server must not run in the child.
+		_exit(exitCode);
+	}
+}
+
+} // anonymous
+
+void runForkServer (const char* binaryName, ForkServerSessionFunc sessionFunc, void* userPtr)
+{
+	Message request;
+
+	// Write errors are handled when executor goes away.
+	signal(SIGPIPE, SIG_IGN);
+
+	while (readMessage(request))
+	{
+		pid_t	pid			= -1;
+		bool	stdInOpen	= true;
+		bool	waitFailed	= false;
+		int		status		= 0;
+
+		if (request.type == MESSAGETYPE_STOP)
+			continue; // Nothing running.
+
+		if (request.type != MESSAGETYPE_EXECUTE)
+			throw ProtocolError("Unexpected message");
+
+		// Make sure no buffered output gets duplicated to child.
+		fflush(DE_NULL);
+
+		pid = fork();
+
+		if (pid == 0)
+			runChild(binaryName, request, sessionFunc, userPtr);
+
+		if (pid < 0)
+		{
+			sendMessage(makeLaunchFailedMessage("fork() failed"));
+			continue;
+		}
+
+		sendMessage(Message(MESSAGETYPE_PROCESS_STARTED));
+
+		for (;;)
+		{
+			const pid_t waitResult = waitpid(pid, &status, WNOHANG);
+
+			if (waitResult == pid)
+				break;
+			else if (waitResult < 0 && errno != EINTR)
+			{
+				// \note Exit status of the child is lost (for example ECHILD if SIGCHLD is ignored),
+				//		 it must not be reported as a clean exit.
+				fprintf(stderr, "waitpid() failed (errno = %d), exit status of test process is unknown\n", errno);
+				waitFailed = true;
+				break;
+			}
+
+			if (stdInOpen && hasPendingInput(CHILD_POLL_INTERVAL))
+			{
+				Message message;
+
+				if (!readMessage(message))
+				{
+					// Client went away, don't leave the child running.
+					kill(pid, SIGKILL);
+					stdInOpen = false;
+				}
+				else if (message.type == MESSAGETYPE_STOP)
+					kill(pid, SIGKILL);
+				else if (message.type == MESSAGETYPE_EXECUTE)
+					sendMessage(makeLaunchFailedMessage("Previous process is still running"));
+				else
+					throw ProtocolError("Unexpected message");
+			}
+			else if (!stdInOpen)
+				usleep(CHILD_POLL_INTERVAL*1000);
+		}
+
+		if (!stdInOpen)
+			break;
+
+		sendMessage(makeFinishedMessage(waitFailed ? -1 : getExitCode(status)));
+	}
+}
+
+} // fs
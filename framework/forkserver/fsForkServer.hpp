@@ -0,0 +1,62 @@
+#ifndef _FSFORKSERVER_HPP
+#define _FSFORKSERVER_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Test Process Fork Server
+ * -----------------------------------------------------
+ *
+ * Copyright 2014 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Test process fork server for Unix-like systems.
+ *
+ * Fork server runs inside a test binary and serves execution requests
+ * sent by ForkServerTestProcess. Each request is executed in a child
+ * forked from the server, so that anything the test binary set up before
+ * entering the server loop (dynamic linking, resource archives, etc.) is
+ * paid for only once instead of once per batch.
+ *
+ * Requests (Execute, Stop) are read from stdin and responses
+ * (ProcessStarted, ProcessLaunchFailed, ProcessFinished) are written to
+ * stdout, see fsProtocol.hpp. Stdout of the children is redirected to
+ * stderr.
+ *
+ * \note Only state set up before runForkServer() is shared. The test
+ *		 package hierarchy depends on the per-session command line, log and
+ *		 platform, so each child still creates its platform and test
+ *		 packages and inflates the groups it runs.
+ *//*--------------------------------------------------------------------*/
+
+#include "deDefs.hpp"
+
+namespace fs
+{
+
+//! Run one test session in forked child. argv[0] is binary name. Returns process exit code.
+typedef int (*ForkServerSessionFunc) (int argc, const char* const* argv, void* userPtr);
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Serve execution requests until stdin is closed
+ *
+ * For each Execute request a child is forked and sessionFunc is
+ * called in the child with argv formed from binaryName, request
+ * parameters and case list (--deqp-caselist). Child exits with the value
+ * returned by sessionFunc. Only one request is served at a time.
+ *//*--------------------------------------------------------------------*/
+void	runForkServer	(const char* binaryName, ForkServerSessionFunc sessionFunc, void* userPtr);
+
+} // fs
+
+#endif // _FSFORKSERVER_HPP
@@ -0,0 +1,192 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Test Process Fork Server
+ * -----------------------------------------------------
+ *
+ * Copyright 2014 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Fork server message framing.
+ *//*--------------------------------------------------------------------*/
+
+#include "fsProtocol.hpp"
+
+using std::string;
+using std::vector;
+
+namespace fs
+{
+
+namespace
+{
+
+void putInt (vector<deUint8>& dst, deUint32 value)
+{
+	dst.push_back((deUint8)(value >> 24));
+	dst.push_back((deUint8)(value >> 16));
+	dst.push_back((deUint8)(value >>  8));
+	dst.push_back((deUint8)(value >>  0));
+}
+
+void putString (vector<deUint8>& dst, const string& value)
+{
+	putInt(dst, (deUint32)value.size());
+	dst.insert(dst.end(), value.begin(), value.end());
+}
+
+class MessageParser
+{
+public:
+	MessageParser (const deUint8* data, size_t dataSize)
+		: m_data	(data)
+		, m_size	(dataSize)
+		, m_pos		(0)
+	{
+	}
+
+	deUint32 getInt (void)
+	{
+		if (m_size - m_pos < 4)
+			throw ProtocolError("Invalid payload size");
+
+		const deUint32 value = ((deUint32)m_data[m_pos+0] << 24)
+							 | ((deUint32)m_data[m_pos+1] << 16)
+							 | ((deUint32)m_data[m_pos+2] <<  8)
+							 | ((deUint32)m_data[m_pos+3] <<  0);
+
+		m_pos += 4;
+		return value;
+	}
+
+	string getString (void)
+	{
+		const size_t length = (size_t)getInt();
+
+		if (m_size - m_pos < length)
+			throw ProtocolError("Invalid string length");
+
+		m_pos += length;
+		return string((const char*)m_data + m_pos - length, length);
+	}
+
+	void assumeEnd (void)
+	{
+		if (m_pos != m_size)
+			throw ProtocolError("Invalid payload size");
+	}
+
+private:
+	const deUint8*	m_data;
+	size_t			m_size;
+	size_t			m_pos;
+};
+
+} // anonymous
+
+void writeMessage (const Message& message, vector<deUint8>& dst)
+{
+	const size_t start = dst.size();
+
+	// Size is patched in when payload is known.
+	putInt(dst, 0);
+	putInt(dst, (deUint32)message.type);
+
+	switch (message.type)
+	{
+		case MESSAGETYPE_EXECUTE:
+			putString(dst, message.params);
+			putString(dst, message.caseList);
+			break;
+
+		case MESSAGETYPE_PROCESS_LAUNCH_FAILED:
+			putString(dst, message.reason);
+			break;
+
+		case MESSAGETYPE_PROCESS_FINISHED:
+			putInt(dst, (deUint32)message.exitCode);
+			break;
+
+		case MESSAGETYPE_STOP:
+		case MESSAGETYPE_PROCESS_STARTED:
+			break;
+
+		default:
+			throw ProtocolError("Unknown message type");
+	}
+
+	{
+		const deUint32 size = (deUint32)(dst.size() - start);
+
+		dst[start+0] = (deUint8)(size >> 24);
+		dst[start+1] = (deUint8)(size >> 16);
+		dst[start+2] = (deUint8)(size >>  8);
+		dst[start+3] = (deUint8)(size >>  0);
+	}
+}
+
+void parseHeader (const deUint8* data, size_t dataSize, MessageType& type, size_t& messageSize)
+{
+	MessageParser parser (data, dataSize);
+
+	messageSize	= (size_t)parser.getInt();
+	type		= (MessageType)parser.getInt();
+
+	if (messageSize < MESSAGE_HEADER_SIZE)
+		throw ProtocolError("Invalid message size");
+}
+
+void parseMessage (const deUint8* data, size_t messageSize, Message& dst)
+{
+	MessageType	type		= MESSAGETYPE_NONE;
+	size_t		headerSize	= 0;
+
+	parseHeader(data, messageSize, type, headerSize);
+
+	if (headerSize != messageSize)
+		throw ProtocolError("Invalid message size");
+
+	{
+		MessageParser parser (data + MESSAGE_HEADER_SIZE, messageSize - MESSAGE_HEADER_SIZE);
+
+		dst = Message(type);
+
+		switch (type)
+		{
+			case MESSAGETYPE_EXECUTE:
+				dst.params		= parser.getString();
+				dst.caseList	= parser.getString();
+				break;
+
+			case MESSAGETYPE_PROCESS_LAUNCH_FAILED:
+				dst.reason		= parser.getString();
+				break;
+
+			case MESSAGETYPE_PROCESS_FINISHED:
+				dst.exitCode	= (int)parser.getInt();
+				break;
+
+			case MESSAGETYPE_STOP:
+			case MESSAGETYPE_PROCESS_STARTED:
+				break;
+
+			default:
+				throw ProtocolError("Unknown message type");
+		}
+
+		parser.assumeEnd();
+	}
+}
+
+} // fs
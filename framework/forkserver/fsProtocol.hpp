@@ -0,0 +1,91 @@
+#ifndef _FSPROTOCOL_HPP
+#define _FSPROTOCOL_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Test Process Fork Server
+ * -----------------------------------------------------
+ *
+ * Copyright 2014 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Fork server message framing.
+ *
+ * Fork server and its client (xs::ForkServerTestProcess) exchange
+ * messages over the stdin and stdout pipes of the server. Each message
+ * starts with a header of two 32-bit big-endian integers: total message
+ * size including the header, and message type. Strings are sent as a
+ * 32-bit length followed by the characters.
+ *//*--------------------------------------------------------------------*/
+
+#include "deDefs.hpp"
+
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+namespace fs
+{
+
+class ProtocolError : public std::runtime_error
+{
+public:
+	ProtocolError (const std::string& message) : std::runtime_error(message) {}
+};
+
+enum MessageType
+{
+	MESSAGETYPE_NONE					= 0,
+
+	// Requests, sent to server.
+	MESSAGETYPE_EXECUTE					= 1,	//!< Run test session in forked child.
+	MESSAGETYPE_STOP					= 2,	//!< Kill running child.
+
+	// Responses, sent by server.
+	MESSAGETYPE_PROCESS_STARTED			= 3,
+	MESSAGETYPE_PROCESS_LAUNCH_FAILED	= 4,
+	MESSAGETYPE_PROCESS_FINISHED		= 5,
+
+	MESSAGETYPE_LAST
+};
+
+enum
+{
+	MESSAGE_HEADER_SIZE		= 8
+};
+
+struct Message
+{
+	MessageType		type;
+
+	std::string		params;		//!< MESSAGETYPE_EXECUTE: Command line parameters for the session.
+	std::string		caseList;	//!< MESSAGETYPE_EXECUTE: Case list, passed as --deqp-caselist if not empty.
+	std::string		reason;		//!< MESSAGETYPE_PROCESS_LAUNCH_FAILED: Failure reason.
+	int				exitCode;	//!< MESSAGETYPE_PROCESS_FINISHED: Exit code of the child.
+
+	explicit		Message		(MessageType type_ = MESSAGETYPE_NONE) : type(type_), exitCode(0) {}
+};
+
+//! Append serialized message to dst.
+void	writeMessage	(const Message& message, std::vector<deUint8>& dst);
+
+//! Parse header. dataSize must be at least MESSAGE_HEADER_SIZE. Returned size includes header.
+void	parseHeader		(const deUint8* data, size_t dataSize, MessageType& type, size_t& messageSize);
+
+//! Parse complete message of messageSize bytes (as given by parseHeader()).
+void	parseMessage	(const deUint8* data, size_t messageSize, Message& dst);
+
+} // fs
+
+#endif // _FSPROTOCOL_HPP
@@ -25,6 +25,7 @@
 #include "gluStrUtil.hpp"
 #include "glwFunctions.hpp"
 #include "glwEnums.hpp"
+#include "tcuCallTrace.hpp"
 
 using tcu::TestLog;
 using tcu::toHex;
@@ -32,15 +33,42 @@ using tcu::toHex;
 namespace glu
 {
 
+static const tcu::CallTraceFunction s_callTraceFunctions[] =
+{
+#include "gluCallLogWrapperTrace.inl"
+};
+
 CallLogWrapper::CallLogWrapper (const glw::Functions& gl, tcu::TestLog& log)
 	: m_gl			(gl)
 	, m_log			(log)
 	, m_enableLog	(false)
+	, m_trace		(DE_NULL)
 {
+	if (tcu::getDefaultCallTraceBufferSize() > 0)
+		enableTracing(tcu::getDefaultCallTraceBufferSize());
 }
 
 CallLogWrapper::~CallLogWrapper (void)
 {
+	disableTracing();
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Record calls to a ring buffer
+ *
+ * Recorded calls are written to the test log if the test case fails.
+ * Tracing is enabled by default if --deqp-call-trace-buffer-size is given.
+ *//*--------------------------------------------------------------------*/
+void CallLogWrapper::enableTracing (size_t bufferSize)
+{
+	disableTracing();
+	m_trace = new tcu::CallTraceBuffer("GL", s_callTraceFunctions, DE_LENGTH_OF_ARRAY(s_callTraceFunctions), bufferSize);
+}
+
+void CallLogWrapper::disableTracing (void)
+{
+	delete m_trace;
+	m_trace = DE_NULL;
 }
 
 template <typename T>
@@ -32,6 +32,11 @@ namespace glw
 class Functions;
 }
 
+namespace tcu
+{
+class CallTraceBuffer;
+}
+
 namespace glu
 {
 
@@ -48,10 +53,18 @@ public:
 	bool					isLoggingEnabled		(void)			{ return m_enableLog; }
 	tcu::TestLog&			getLog					(void)			{ return m_log; }
 
+	void					enableTracing			(size_t bufferSize);
+	void					disableTracing			(void);
+	tcu::CallTraceBuffer*	getTrace				(void)			{ return m_trace; }
+
 private:
+							CallLogWrapper			(const CallLogWrapper& other);
+	CallLogWrapper&			operator=				(const CallLogWrapper& other);
+
 	const glw::Functions&	m_gl;
 	tcu::TestLog&			m_log;
 	bool					m_enableLog;
+	tcu::CallTraceBuffer*	m_trace;
 } DE_WARN_UNUSED_TYPE;
 
 } // glu
@@ -8,6 +8,12 @@ void CallLogWrapper::glActiveShaderProgram (glw::GLuint pipeline, glw::GLuint pr
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glActiveShaderProgram(" << pipeline << ", " << program << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(0, 2);
+		args[0] = tcu::callTraceArg(pipeline);
+		args[1] = tcu::callTraceArg(program);
+	}
 	m_gl.activeShaderProgram(pipeline, program);
 }
 
@@ -15,6 +21,11 @@ void CallLogWrapper::glActiveTexture (glw::GLenum texture)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glActiveTexture(" << getTextureUnitStr(texture) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(1, 1);
+		args[0] = tcu::callTraceArg(texture);
+	}
 	m_gl.activeTexture(texture);
 }
 
@@ -22,6 +33,12 @@ void CallLogWrapper::glAttachShader (glw::GLuint program, glw::GLuint shader)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glAttachShader(" << program << ", " << shader << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(2, 2);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(shader);
+	}
 	m_gl.attachShader(program, shader);
 }
 
@@ -29,6 +46,12 @@ void CallLogWrapper::glBeginConditionalRender (glw::GLuint id, glw::GLenum mode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBeginConditionalRender(" << id << ", " << toHex(mode) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(3, 2);
+		args[0] = tcu::callTraceArg(id);
+		args[1] = tcu::callTraceArg(mode);
+	}
 	m_gl.beginConditionalRender(id, mode);
 }
 
@@ -36,6 +59,12 @@ void CallLogWrapper::glBeginQuery (glw::GLenum target, glw::GLuint id)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBeginQuery(" << getQueryTargetStr(target) << ", " << id << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(4, 2);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(id);
+	}
 	m_gl.beginQuery(target, id);
 }
 
@@ -43,6 +72,13 @@ void CallLogWrapper::glBeginQueryIndexed (glw::GLenum target, glw::GLuint index,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBeginQueryIndexed(" << toHex(target) << ", " << index << ", " << id << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(5, 3);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(index);
+		args[2] = tcu::callTraceArg(id);
+	}
 	m_gl.beginQueryIndexed(target, index, id);
 }
 
@@ -50,6 +86,11 @@ void CallLogWrapper::glBeginTransformFeedback (glw::GLenum primitiveMode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBeginTransformFeedback(" << getPrimitiveTypeStr(primitiveMode) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(6, 1);
+		args[0] = tcu::callTraceArg(primitiveMode);
+	}
 	m_gl.beginTransformFeedback(primitiveMode);
 }
 
@@ -57,6 +98,13 @@ void CallLogWrapper::glBindAttribLocation (glw::GLuint program, glw::GLuint inde
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindAttribLocation(" << program << ", " << index << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(7, 3);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(index);
+		args[2] = tcu::callTraceArg(name);
+	}
 	m_gl.bindAttribLocation(program, index, name);
 }
 
@@ -64,6 +112,12 @@ void CallLogWrapper::glBindBuffer (glw::GLenum target, glw::GLuint buffer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindBuffer(" << getBufferTargetStr(target) << ", " << buffer << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(8, 2);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(buffer);
+	}
 	m_gl.bindBuffer(target, buffer);
 }
 
@@ -71,6 +125,13 @@ void CallLogWrapper::glBindBufferBase (glw::GLenum target, glw::GLuint index, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindBufferBase(" << getBufferTargetStr(target) << ", " << index << ", " << buffer << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(9, 3);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(index);
+		args[2] = tcu::callTraceArg(buffer);
+	}
 	m_gl.bindBufferBase(target, index, buffer);
 }
 
@@ -78,6 +139,15 @@ void CallLogWrapper::glBindBufferRange (glw::GLenum target, glw::GLuint index, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindBufferRange(" << getBufferTargetStr(target) << ", " << index << ", " << buffer << ", " << offset << ", " << size << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(10, 5);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(index);
+		args[2] = tcu::callTraceArg(buffer);
+		args[3] = tcu::callTraceArg(offset);
+		args[4] = tcu::callTraceArg(size);
+	}
 	m_gl.bindBufferRange(target, index, buffer, offset, size);
 }
 
@@ -85,6 +155,14 @@ void CallLogWrapper::glBindBuffersBase (glw::GLenum target, glw::GLuint first, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindBuffersBase(" << toHex(target) << ", " << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(11, 4);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(first);
+		args[2] = tcu::callTraceArg(count);
+		args[3] = tcu::callTraceArg(buffers);
+	}
 	m_gl.bindBuffersBase(target, first, count, buffers);
 }
 
@@ -92,6 +170,16 @@ void CallLogWrapper::glBindBuffersRange (glw::GLenum target, glw::GLuint first,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindBuffersRange(" << toHex(target) << ", " << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(offsets))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(sizes))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(12, 6);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(first);
+		args[2] = tcu::callTraceArg(count);
+		args[3] = tcu::callTraceArg(buffers);
+		args[4] = tcu::callTraceArg(offsets);
+		args[5] = tcu::callTraceArg(sizes);
+	}
 	m_gl.bindBuffersRange(target, first, count, buffers, offsets, sizes);
 }
 
@@ -99,6 +187,13 @@ void CallLogWrapper::glBindFragDataLocation (glw::GLuint program, glw::GLuint co
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindFragDataLocation(" << program << ", " << color << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(13, 3);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(color);
+		args[2] = tcu::callTraceArg(name);
+	}
 	m_gl.bindFragDataLocation(program, color, name);
 }
 
@@ -106,6 +201,14 @@ void CallLogWrapper::glBindFragDataLocationIndexed (glw::GLuint program, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindFragDataLocationIndexed(" << program << ", " << colorNumber << ", " << index << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(14, 4);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(colorNumber);
+		args[2] = tcu::callTraceArg(index);
+		args[3] = tcu::callTraceArg(name);
+	}
 	m_gl.bindFragDataLocationIndexed(program, colorNumber, index, name);
 }
 
@@ -113,6 +216,12 @@ void CallLogWrapper::glBindFramebuffer (glw::GLenum target, glw::GLuint framebuf
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindFramebuffer(" << getFramebufferTargetStr(target) << ", " << framebuffer << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(15, 2);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(framebuffer);
+	}
 	m_gl.bindFramebuffer(target, framebuffer);
 }
 
@@ -120,6 +229,17 @@ void CallLogWrapper::glBindImageTexture (glw::GLuint unit, glw::GLuint texture,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindImageTexture(" << unit << ", " << texture << ", " << level << ", " << getBooleanStr(layered) << ", " << layer << ", " << getImageAccessStr(access) << ", " << getUncompressedTextureFormatStr(format) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(16, 7);
+		args[0] = tcu::callTraceArg(unit);
+		args[1] = tcu::callTraceArg(texture);
+		args[2] = tcu::callTraceArg(level);
+		args[3] = tcu::callTraceArg(layered);
+		args[4] = tcu::callTraceArg(layer);
+		args[5] = tcu::callTraceArg(access);
+		args[6] = tcu::callTraceArg(format);
+	}
 	m_gl.bindImageTexture(unit, texture, level, layered, layer, access, format);
 }
 
@@ -127,6 +247,13 @@ void CallLogWrapper::glBindImageTextures (glw::GLuint first, glw::GLsizei count,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindImageTextures(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(textures))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(17, 3);
+		args[0] = tcu::callTraceArg(first);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(textures);
+	}
 	m_gl.bindImageTextures(first, count, textures);
 }
 
@@ -134,6 +261,11 @@ void CallLogWrapper::glBindProgramPipeline (glw::GLuint pipeline)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindProgramPipeline(" << pipeline << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(18, 1);
+		args[0] = tcu::callTraceArg(pipeline);
+	}
 	m_gl.bindProgramPipeline(pipeline);
 }
 
@@ -141,6 +273,12 @@ void CallLogWrapper::glBindRenderbuffer (glw::GLenum target, glw::GLuint renderb
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindRenderbuffer(" << getFramebufferTargetStr(target) << ", " << renderbuffer << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(19, 2);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(renderbuffer);
+	}
 	m_gl.bindRenderbuffer(target, renderbuffer);
 }
 
@@ -148,6 +286,12 @@ void CallLogWrapper::glBindSampler (glw::GLuint unit, glw::GLuint sampler)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindSampler(" << unit << ", " << sampler << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(20, 2);
+		args[0] = tcu::callTraceArg(unit);
+		args[1] = tcu::callTraceArg(sampler);
+	}
 	m_gl.bindSampler(unit, sampler);
 }
 
@@ -155,6 +299,13 @@ void CallLogWrapper::glBindSamplers (glw::GLuint first, glw::GLsizei count, cons
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindSamplers(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(samplers))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(21, 3);
+		args[0] = tcu::callTraceArg(first);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(samplers);
+	}
 	m_gl.bindSamplers(first, count, samplers);
 }
 
@@ -162,6 +313,12 @@ void CallLogWrapper::glBindTexture (glw::GLenum target, glw::GLuint texture)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindTexture(" << getTextureTargetStr(target) << ", " << texture << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(22, 2);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(texture);
+	}
 	m_gl.bindTexture(target, texture);
 }
 
@@ -169,6 +326,12 @@ void CallLogWrapper::glBindTextureUnit (glw::GLuint unit, glw::GLuint texture)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindTextureUnit(" << unit << ", " << texture << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(23, 2);
+		args[0] = tcu::callTraceArg(unit);
+		args[1] = tcu::callTraceArg(texture);
+	}
 	m_gl.bindTextureUnit(unit, texture);
 }
 
@@ -176,6 +339,13 @@ void CallLogWrapper::glBindTextures (glw::GLuint first, glw::GLsizei count, cons
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindTextures(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(textures))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(24, 3);
+		args[0] = tcu::callTraceArg(first);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(textures);
+	}
 	m_gl.bindTextures(first, count, textures);
 }
 
@@ -183,6 +353,12 @@ void CallLogWrapper::glBindTransformFeedback (glw::GLenum target, glw::GLuint id
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindTransformFeedback(" << getTransformFeedbackTargetStr(target) << ", " << id << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(25, 2);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(id);
+	}
 	m_gl.bindTransformFeedback(target, id);
 }
 
@@ -190,6 +366,11 @@ void CallLogWrapper::glBindVertexArray (glw::GLuint array)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindVertexArray(" << array << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(26, 1);
+		args[0] = tcu::callTraceArg(array);
+	}
 	m_gl.bindVertexArray(array);
 }
 
@@ -197,6 +378,14 @@ void CallLogWrapper::glBindVertexBuffer (glw::GLuint bindingindex, glw::GLuint b
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindVertexBuffer(" << bindingindex << ", " << buffer << ", " << offset << ", " << stride << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(27, 4);
+		args[0] = tcu::callTraceArg(bindingindex);
+		args[1] = tcu::callTraceArg(buffer);
+		args[2] = tcu::callTraceArg(offset);
+		args[3] = tcu::callTraceArg(stride);
+	}
 	m_gl.bindVertexBuffer(bindingindex, buffer, offset, stride);
 }
 
@@ -204,6 +393,15 @@ void CallLogWrapper::glBindVertexBuffers (glw::GLuint first, glw::GLsizei count,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBindVertexBuffers(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(offsets))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(strides))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(28, 5);
+		args[0] = tcu::callTraceArg(first);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(buffers);
+		args[3] = tcu::callTraceArg(offsets);
+		args[4] = tcu::callTraceArg(strides);
+	}
 	m_gl.bindVertexBuffers(first, count, buffers, offsets, strides);
 }
 
@@ -211,6 +409,8 @@ void CallLogWrapper::glBlendBarrierKHR (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlendBarrierKHR(" << ");" << TestLog::EndMessage;
+	if (m_trace)
+		m_trace->recordCall(29, 0);
 	m_gl.blendBarrierKHR();
 }
 
@@ -218,6 +418,14 @@ void CallLogWrapper::glBlendColor (glw::GLfloat red, glw::GLfloat green, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlendColor(" << red << ", " << green << ", " << blue << ", " << alpha << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(30, 4);
+		args[0] = tcu::callTraceArg(red);
+		args[1] = tcu::callTraceArg(green);
+		args[2] = tcu::callTraceArg(blue);
+		args[3] = tcu::callTraceArg(alpha);
+	}
 	m_gl.blendColor(red, green, blue, alpha);
 }
 
@@ -225,6 +433,11 @@ void CallLogWrapper::glBlendEquation (glw::GLenum mode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlendEquation(" << getBlendEquationStr(mode) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(31, 1);
+		args[0] = tcu::callTraceArg(mode);
+	}
 	m_gl.blendEquation(mode);
 }
 
@@ -232,6 +445,12 @@ void CallLogWrapper::glBlendEquationSeparate (glw::GLenum modeRGB, glw::GLenum m
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlendEquationSeparate(" << getBlendEquationStr(modeRGB) << ", " << getBlendEquationStr(modeAlpha) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(32, 2);
+		args[0] = tcu::callTraceArg(modeRGB);
+		args[1] = tcu::callTraceArg(modeAlpha);
+	}
 	m_gl.blendEquationSeparate(modeRGB, modeAlpha);
 }
 
@@ -239,6 +458,13 @@ void CallLogWrapper::glBlendEquationSeparatei (glw::GLuint buf, glw::GLenum mode
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlendEquationSeparatei(" << buf << ", " << getBlendEquationStr(modeRGB) << ", " << getBlendEquationStr(modeAlpha) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(33, 3);
+		args[0] = tcu::callTraceArg(buf);
+		args[1] = tcu::callTraceArg(modeRGB);
+		args[2] = tcu::callTraceArg(modeAlpha);
+	}
 	m_gl.blendEquationSeparatei(buf, modeRGB, modeAlpha);
 }
 
@@ -246,6 +472,12 @@ void CallLogWrapper::glBlendEquationi (glw::GLuint buf, glw::GLenum mode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlendEquationi(" << buf << ", " << getBlendEquationStr(mode) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(34, 2);
+		args[0] = tcu::callTraceArg(buf);
+		args[1] = tcu::callTraceArg(mode);
+	}
 	m_gl.blendEquationi(buf, mode);
 }
 
@@ -253,6 +485,12 @@ void CallLogWrapper::glBlendFunc (glw::GLenum sfactor, glw::GLenum dfactor)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlendFunc(" << getBlendFactorStr(sfactor) << ", " << getBlendFactorStr(dfactor) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(35, 2);
+		args[0] = tcu::callTraceArg(sfactor);
+		args[1] = tcu::callTraceArg(dfactor);
+	}
 	m_gl.blendFunc(sfactor, dfactor);
 }
 
@@ -260,6 +498,14 @@ void CallLogWrapper::glBlendFuncSeparate (glw::GLenum sfactorRGB, glw::GLenum df
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlendFuncSeparate(" << getBlendFactorStr(sfactorRGB) << ", " << getBlendFactorStr(dfactorRGB) << ", " << getBlendFactorStr(sfactorAlpha) << ", " << getBlendFactorStr(dfactorAlpha) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(36, 4);
+		args[0] = tcu::callTraceArg(sfactorRGB);
+		args[1] = tcu::callTraceArg(dfactorRGB);
+		args[2] = tcu::callTraceArg(sfactorAlpha);
+		args[3] = tcu::callTraceArg(dfactorAlpha);
+	}
 	m_gl.blendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
 }
 
@@ -267,6 +513,15 @@ void CallLogWrapper::glBlendFuncSeparatei (glw::GLuint buf, glw::GLenum srcRGB,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlendFuncSeparatei(" << buf << ", " << toHex(srcRGB) << ", " << toHex(dstRGB) << ", " << toHex(srcAlpha) << ", " << toHex(dstAlpha) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(37, 5);
+		args[0] = tcu::callTraceArg(buf);
+		args[1] = tcu::callTraceArg(srcRGB);
+		args[2] = tcu::callTraceArg(dstRGB);
+		args[3] = tcu::callTraceArg(srcAlpha);
+		args[4] = tcu::callTraceArg(dstAlpha);
+	}
 	m_gl.blendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
 }
 
@@ -274,6 +529,13 @@ void CallLogWrapper::glBlendFunci (glw::GLuint buf, glw::GLenum src, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlendFunci(" << buf << ", " << toHex(src) << ", " << toHex(dst) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(38, 3);
+		args[0] = tcu::callTraceArg(buf);
+		args[1] = tcu::callTraceArg(src);
+		args[2] = tcu::callTraceArg(dst);
+	}
 	m_gl.blendFunci(buf, src, dst);
 }
 
@@ -281,6 +543,20 @@ void CallLogWrapper::glBlitFramebuffer (glw::GLint srcX0, glw::GLint srcY0, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlitFramebuffer(" << srcX0 << ", " << srcY0 << ", " << srcX1 << ", " << srcY1 << ", " << dstX0 << ", " << dstY0 << ", " << dstX1 << ", " << dstY1 << ", " << getBufferMaskStr(mask) << ", " << getTextureFilterStr(filter) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(39, 10);
+		args[0] = tcu::callTraceArg(srcX0);
+		args[1] = tcu::callTraceArg(srcY0);
+		args[2] = tcu::callTraceArg(srcX1);
+		args[3] = tcu::callTraceArg(srcY1);
+		args[4] = tcu::callTraceArg(dstX0);
+		args[5] = tcu::callTraceArg(dstY0);
+		args[6] = tcu::callTraceArg(dstX1);
+		args[7] = tcu::callTraceArg(dstY1);
+		args[8] = tcu::callTraceArg(mask);
+		args[9] = tcu::callTraceArg(filter);
+	}
 	m_gl.blitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
 }
 
@@ -288,6 +564,22 @@ void CallLogWrapper::glBlitNamedFramebuffer (glw::GLuint readFramebuffer, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBlitNamedFramebuffer(" << readFramebuffer << ", " << drawFramebuffer << ", " << srcX0 << ", " << srcY0 << ", " << srcX1 << ", " << srcY1 << ", " << dstX0 << ", " << dstY0 << ", " << dstX1 << ", " << dstY1 << ", " << toHex(mask) << ", " << toHex(filter) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(40, 12);
+		args[0] = tcu::callTraceArg(readFramebuffer);
+		args[1] = tcu::callTraceArg(drawFramebuffer);
+		args[2] = tcu::callTraceArg(srcX0);
+		args[3] = tcu::callTraceArg(srcY0);
+		args[4] = tcu::callTraceArg(srcX1);
+		args[5] = tcu::callTraceArg(srcY1);
+		args[6] = tcu::callTraceArg(dstX0);
+		args[7] = tcu::callTraceArg(dstY0);
+		args[8] = tcu::callTraceArg(dstX1);
+		args[9] = tcu::callTraceArg(dstY1);
+		args[10] = tcu::callTraceArg(mask);
+		args[11] = tcu::callTraceArg(filter);
+	}
 	m_gl.blitNamedFramebuffer(readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
 }
 
@@ -295,6 +587,14 @@ void CallLogWrapper::glBufferData (glw::GLenum target, glw::GLsizeiptr size, con
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBufferData(" << getBufferTargetStr(target) << ", " << size << ", " << data << ", " << getUsageStr(usage) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(41, 4);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(size);
+		args[2] = tcu::callTraceArg(data);
+		args[3] = tcu::callTraceArg(usage);
+	}
 	m_gl.bufferData(target, size, data, usage);
 }
 
@@ -302,6 +602,14 @@ void CallLogWrapper::glBufferStorage (glw::GLenum target, glw::GLsizeiptr size,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBufferStorage(" << toHex(target) << ", " << size << ", " << data << ", " << toHex(flags) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(42, 4);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(size);
+		args[2] = tcu::callTraceArg(data);
+		args[3] = tcu::callTraceArg(flags);
+	}
 	m_gl.bufferStorage(target, size, data, flags);
 }
 
@@ -309,6 +617,14 @@ void CallLogWrapper::glBufferSubData (glw::GLenum target, glw::GLintptr offset,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glBufferSubData(" << getBufferTargetStr(target) << ", " << offset << ", " << size << ", " << data << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(43, 4);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(offset);
+		args[2] = tcu::callTraceArg(size);
+		args[3] = tcu::callTraceArg(data);
+	}
 	m_gl.bufferSubData(target, offset, size, data);
 }
 
@@ -316,6 +632,11 @@ glw::GLenum CallLogWrapper::glCheckFramebufferStatus (glw::GLenum target)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCheckFramebufferStatus(" << getFramebufferTargetStr(target) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(44, 1);
+		args[0] = tcu::callTraceArg(target);
+	}
 	glw::GLenum returnValue = m_gl.checkFramebufferStatus(target);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getFramebufferStatusStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -326,6 +647,12 @@ glw::GLenum CallLogWrapper::glCheckNamedFramebufferStatus (glw::GLuint framebuff
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCheckNamedFramebufferStatus(" << framebuffer << ", " << toHex(target) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(45, 2);
+		args[0] = tcu::callTraceArg(framebuffer);
+		args[1] = tcu::callTraceArg(target);
+	}
 	glw::GLenum returnValue = m_gl.checkNamedFramebufferStatus(framebuffer, target);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << toHex(returnValue) << " returned" << TestLog::EndMessage;
@@ -336,6 +663,12 @@ void CallLogWrapper::glClampColor (glw::GLenum target, glw::GLenum clamp)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClampColor(" << toHex(target) << ", " << toHex(clamp) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(46, 2);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(clamp);
+	}
 	m_gl.clampColor(target, clamp);
 }
 
@@ -343,6 +676,11 @@ void CallLogWrapper::glClear (glw::GLbitfield mask)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClear(" << getBufferMaskStr(mask) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(47, 1);
+		args[0] = tcu::callTraceArg(mask);
+	}
 	m_gl.clear(mask);
 }
 
@@ -350,6 +688,15 @@ void CallLogWrapper::glClearBufferData (glw::GLenum target, glw::GLenum internal
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearBufferData(" << toHex(target) << ", " << toHex(internalformat) << ", " << toHex(format) << ", " << toHex(type) << ", " << data << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(48, 5);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(internalformat);
+		args[2] = tcu::callTraceArg(format);
+		args[3] = tcu::callTraceArg(type);
+		args[4] = tcu::callTraceArg(data);
+	}
 	m_gl.clearBufferData(target, internalformat, format, type, data);
 }
 
@@ -357,6 +704,17 @@ void CallLogWrapper::glClearBufferSubData (glw::GLenum target, glw::GLenum inter
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearBufferSubData(" << toHex(target) << ", " << toHex(internalformat) << ", " << offset << ", " << size << ", " << toHex(format) << ", " << toHex(type) << ", " << data << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(49, 7);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(internalformat);
+		args[2] = tcu::callTraceArg(offset);
+		args[3] = tcu::callTraceArg(size);
+		args[4] = tcu::callTraceArg(format);
+		args[5] = tcu::callTraceArg(type);
+		args[6] = tcu::callTraceArg(data);
+	}
 	m_gl.clearBufferSubData(target, internalformat, offset, size, format, type, data);
 }
 
@@ -364,6 +722,14 @@ void CallLogWrapper::glClearBufferfi (glw::GLenum buffer, glw::GLint drawbuffer,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearBufferfi(" << getBufferStr(buffer) << ", " << drawbuffer << ", " << depth << ", " << stencil << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(50, 4);
+		args[0] = tcu::callTraceArg(buffer);
+		args[1] = tcu::callTraceArg(drawbuffer);
+		args[2] = tcu::callTraceArg(depth);
+		args[3] = tcu::callTraceArg(stencil);
+	}
 	m_gl.clearBufferfi(buffer, drawbuffer, depth, stencil);
 }
 
@@ -371,6 +737,13 @@ void CallLogWrapper::glClearBufferfv (glw::GLenum buffer, glw::GLint drawbuffer,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearBufferfv(" << getBufferStr(buffer) << ", " << drawbuffer << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(51, 3);
+		args[0] = tcu::callTraceArg(buffer);
+		args[1] = tcu::callTraceArg(drawbuffer);
+		args[2] = tcu::callTraceArg(value);
+	}
 	m_gl.clearBufferfv(buffer, drawbuffer, value);
 }
 
@@ -378,6 +751,13 @@ void CallLogWrapper::glClearBufferiv (glw::GLenum buffer, glw::GLint drawbuffer,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearBufferiv(" << getBufferStr(buffer) << ", " << drawbuffer << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(52, 3);
+		args[0] = tcu::callTraceArg(buffer);
+		args[1] = tcu::callTraceArg(drawbuffer);
+		args[2] = tcu::callTraceArg(value);
+	}
 	m_gl.clearBufferiv(buffer, drawbuffer, value);
 }
 
@@ -385,6 +765,13 @@ void CallLogWrapper::glClearBufferuiv (glw::GLenum buffer, glw::GLint drawbuffer
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearBufferuiv(" << getBufferStr(buffer) << ", " << drawbuffer << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(53, 3);
+		args[0] = tcu::callTraceArg(buffer);
+		args[1] = tcu::callTraceArg(drawbuffer);
+		args[2] = tcu::callTraceArg(value);
+	}
 	m_gl.clearBufferuiv(buffer, drawbuffer, value);
 }
 
@@ -392,6 +779,14 @@ void CallLogWrapper::glClearColor (glw::GLfloat red, glw::GLfloat green, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearColor(" << red << ", " << green << ", " << blue << ", " << alpha << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(54, 4);
+		args[0] = tcu::callTraceArg(red);
+		args[1] = tcu::callTraceArg(green);
+		args[2] = tcu::callTraceArg(blue);
+		args[3] = tcu::callTraceArg(alpha);
+	}
 	m_gl.clearColor(red, green, blue, alpha);
 }
 
@@ -399,6 +794,11 @@ void CallLogWrapper::glClearDepth (glw::GLdouble depth)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearDepth(" << depth << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(55, 1);
+		args[0] = tcu::callTraceArg(depth);
+	}
 	m_gl.clearDepth(depth);
 }
 
@@ -406,6 +806,11 @@ void CallLogWrapper::glClearDepthf (glw::GLfloat d)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearDepthf(" << d << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(56, 1);
+		args[0] = tcu::callTraceArg(d);
+	}
 	m_gl.clearDepthf(d);
 }
 
@@ -413,6 +818,15 @@ void CallLogWrapper::glClearNamedBufferData (glw::GLuint buffer, glw::GLenum int
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearNamedBufferData(" << buffer << ", " << toHex(internalformat) << ", " << toHex(format) << ", " << toHex(type) << ", " << data << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(57, 5);
+		args[0] = tcu::callTraceArg(buffer);
+		args[1] = tcu::callTraceArg(internalformat);
+		args[2] = tcu::callTraceArg(format);
+		args[3] = tcu::callTraceArg(type);
+		args[4] = tcu::callTraceArg(data);
+	}
 	m_gl.clearNamedBufferData(buffer, internalformat, format, type, data);
 }
 
@@ -420,6 +834,17 @@ void CallLogWrapper::glClearNamedBufferSubData (glw::GLuint buffer, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearNamedBufferSubData(" << buffer << ", " << toHex(internalformat) << ", " << offset << ", " << size << ", " << toHex(format) << ", " << toHex(type) << ", " << data << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(58, 7);
+		args[0] = tcu::callTraceArg(buffer);
+		args[1] = tcu::callTraceArg(internalformat);
+		args[2] = tcu::callTraceArg(offset);
+		args[3] = tcu::callTraceArg(size);
+		args[4] = tcu::callTraceArg(format);
+		args[5] = tcu::callTraceArg(type);
+		args[6] = tcu::callTraceArg(data);
+	}
 	m_gl.clearNamedBufferSubData(buffer, internalformat, offset, size, format, type, data);
 }
 
@@ -427,6 +852,14 @@ void CallLogWrapper::glClearNamedFramebufferfi (glw::GLuint framebuffer, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearNamedFramebufferfi(" << framebuffer << ", " << toHex(buffer) << ", " << depth << ", " << stencil << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(59, 4);
+		args[0] = tcu::callTraceArg(framebuffer);
+		args[1] = tcu::callTraceArg(buffer);
+		args[2] = tcu::callTraceArg(depth);
+		args[3] = tcu::callTraceArg(stencil);
+	}
 	m_gl.clearNamedFramebufferfi(framebuffer, buffer, depth, stencil);
 }
 
@@ -434,6 +867,14 @@ void CallLogWrapper::glClearNamedFramebufferfv (glw::GLuint framebuffer, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearNamedFramebufferfv(" << framebuffer << ", " << toHex(buffer) << ", " << drawbuffer << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(60, 4);
+		args[0] = tcu::callTraceArg(framebuffer);
+		args[1] = tcu::callTraceArg(buffer);
+		args[2] = tcu::callTraceArg(drawbuffer);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.clearNamedFramebufferfv(framebuffer, buffer, drawbuffer, value);
 }
 
@@ -441,6 +882,14 @@ void CallLogWrapper::glClearNamedFramebufferiv (glw::GLuint framebuffer, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearNamedFramebufferiv(" << framebuffer << ", " << toHex(buffer) << ", " << drawbuffer << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(61, 4);
+		args[0] = tcu::callTraceArg(framebuffer);
+		args[1] = tcu::callTraceArg(buffer);
+		args[2] = tcu::callTraceArg(drawbuffer);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.clearNamedFramebufferiv(framebuffer, buffer, drawbuffer, value);
 }
 
@@ -448,6 +897,14 @@ void CallLogWrapper::glClearNamedFramebufferuiv (glw::GLuint framebuffer, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearNamedFramebufferuiv(" << framebuffer << ", " << toHex(buffer) << ", " << drawbuffer << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(62, 4);
+		args[0] = tcu::callTraceArg(framebuffer);
+		args[1] = tcu::callTraceArg(buffer);
+		args[2] = tcu::callTraceArg(drawbuffer);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.clearNamedFramebufferuiv(framebuffer, buffer, drawbuffer, value);
 }
 
@@ -455,6 +912,11 @@ void CallLogWrapper::glClearStencil (glw::GLint s)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearStencil(" << s << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(63, 1);
+		args[0] = tcu::callTraceArg(s);
+	}
 	m_gl.clearStencil(s);
 }
 
@@ -462,6 +924,15 @@ void CallLogWrapper::glClearTexImage (glw::GLuint texture, glw::GLint level, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearTexImage(" << texture << ", " << level << ", " << toHex(format) << ", " << toHex(type) << ", " << data << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(64, 5);
+		args[0] = tcu::callTraceArg(texture);
+		args[1] = tcu::callTraceArg(level);
+		args[2] = tcu::callTraceArg(format);
+		args[3] = tcu::callTraceArg(type);
+		args[4] = tcu::callTraceArg(data);
+	}
 	m_gl.clearTexImage(texture, level, format, type, data);
 }
 
@@ -469,6 +940,21 @@ void CallLogWrapper::glClearTexSubImage (glw::GLuint texture, glw::GLint level,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClearTexSubImage(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << toHex(type) << ", " << data << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(65, 11);
+		args[0] = tcu::callTraceArg(texture);
+		args[1] = tcu::callTraceArg(level);
+		args[2] = tcu::callTraceArg(xoffset);
+		args[3] = tcu::callTraceArg(yoffset);
+		args[4] = tcu::callTraceArg(zoffset);
+		args[5] = tcu::callTraceArg(width);
+		args[6] = tcu::callTraceArg(height);
+		args[7] = tcu::callTraceArg(depth);
+		args[8] = tcu::callTraceArg(format);
+		args[9] = tcu::callTraceArg(type);
+		args[10] = tcu::callTraceArg(data);
+	}
 	m_gl.clearTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data);
 }
 
@@ -476,6 +962,13 @@ glw::GLenum CallLogWrapper::glClientWaitSync (glw::GLsync sync, glw::GLbitfield
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClientWaitSync(" << sync << ", " << toHex(flags) << ", " << timeout << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(66, 3);
+		args[0] = tcu::callTraceArg(sync);
+		args[1] = tcu::callTraceArg(flags);
+		args[2] = tcu::callTraceArg(timeout);
+	}
 	glw::GLenum returnValue = m_gl.clientWaitSync(sync, flags, timeout);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << toHex(returnValue) << " returned" << TestLog::EndMessage;
@@ -486,6 +979,12 @@ void CallLogWrapper::glClipControl (glw::GLenum origin, glw::GLenum depth)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glClipControl(" << toHex(origin) << ", " << toHex(depth) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(67, 2);
+		args[0] = tcu::callTraceArg(origin);
+		args[1] = tcu::callTraceArg(depth);
+	}
 	m_gl.clipControl(origin, depth);
 }
 
@@ -493,6 +992,14 @@ void CallLogWrapper::glColorMask (glw::GLboolean red, glw::GLboolean green, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glColorMask(" << getBooleanStr(red) << ", " << getBooleanStr(green) << ", " << getBooleanStr(blue) << ", " << getBooleanStr(alpha) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(68, 4);
+		args[0] = tcu::callTraceArg(red);
+		args[1] = tcu::callTraceArg(green);
+		args[2] = tcu::callTraceArg(blue);
+		args[3] = tcu::callTraceArg(alpha);
+	}
 	m_gl.colorMask(red, green, blue, alpha);
 }
 
@@ -500,6 +1007,15 @@ void CallLogWrapper::glColorMaski (glw::GLuint index, glw::GLboolean r, glw::GLb
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glColorMaski(" << index << ", " << getBooleanStr(r) << ", " << getBooleanStr(g) << ", " << getBooleanStr(b) << ", " << getBooleanStr(a) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(69, 5);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(r);
+		args[2] = tcu::callTraceArg(g);
+		args[3] = tcu::callTraceArg(b);
+		args[4] = tcu::callTraceArg(a);
+	}
 	m_gl.colorMaski(index, r, g, b, a);
 }
 
@@ -507,6 +1023,11 @@ void CallLogWrapper::glCompileShader (glw::GLuint shader)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompileShader(" << shader << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(70, 1);
+		args[0] = tcu::callTraceArg(shader);
+	}
 	m_gl.compileShader(shader);
 }
 
@@ -514,6 +1035,17 @@ void CallLogWrapper::glCompressedTexImage1D (glw::GLenum target, glw::GLint leve
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTexImage1D(" << toHex(target) << ", " << level << ", " << toHex(internalformat) << ", " << width << ", " << border << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(71, 7);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(level);
+		args[2] = tcu::callTraceArg(internalformat);
+		args[3] = tcu::callTraceArg(width);
+		args[4] = tcu::callTraceArg(border);
+		args[5] = tcu::callTraceArg(imageSize);
+		args[6] = tcu::callTraceArg(data);
+	}
 	m_gl.compressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
 }
 
@@ -521,6 +1053,18 @@ void CallLogWrapper::glCompressedTexImage2D (glw::GLenum target, glw::GLint leve
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTexImage2D(" << getTextureTargetStr(target) << ", " << level << ", " << getCompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << border << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(72, 8);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(level);
+		args[2] = tcu::callTraceArg(internalformat);
+		args[3] = tcu::callTraceArg(width);
+		args[4] = tcu::callTraceArg(height);
+		args[5] = tcu::callTraceArg(border);
+		args[6] = tcu::callTraceArg(imageSize);
+		args[7] = tcu::callTraceArg(data);
+	}
 	m_gl.compressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
 }
 
@@ -528,6 +1072,19 @@ void CallLogWrapper::glCompressedTexImage3D (glw::GLenum target, glw::GLint leve
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTexImage3D(" << getTextureTargetStr(target) << ", " << level << ", " << getCompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(73, 9);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(level);
+		args[2] = tcu::callTraceArg(internalformat);
+		args[3] = tcu::callTraceArg(width);
+		args[4] = tcu::callTraceArg(height);
+		args[5] = tcu::callTraceArg(depth);
+		args[6] = tcu::callTraceArg(border);
+		args[7] = tcu::callTraceArg(imageSize);
+		args[8] = tcu::callTraceArg(data);
+	}
 	m_gl.compressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
 }
 
@@ -535,6 +1092,17 @@ void CallLogWrapper::glCompressedTexSubImage1D (glw::GLenum target, glw::GLint l
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTexSubImage1D(" << toHex(target) << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(74, 7);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(level);
+		args[2] = tcu::callTraceArg(xoffset);
+		args[3] = tcu::callTraceArg(width);
+		args[4] = tcu::callTraceArg(format);
+		args[5] = tcu::callTraceArg(imageSize);
+		args[6] = tcu::callTraceArg(data);
+	}
 	m_gl.compressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
 }
 
@@ -542,6 +1110,19 @@ void CallLogWrapper::glCompressedTexSubImage2D (glw::GLenum target, glw::GLint l
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTexSubImage2D(" << getTextureTargetStr(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << getCompressedTextureFormatStr(format) << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(75, 9);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(level);
+		args[2] = tcu::callTraceArg(xoffset);
+		args[3] = tcu::callTraceArg(yoffset);
+		args[4] = tcu::callTraceArg(width);
+		args[5] = tcu::callTraceArg(height);
+		args[6] = tcu::callTraceArg(format);
+		args[7] = tcu::callTraceArg(imageSize);
+		args[8] = tcu::callTraceArg(data);
+	}
 	m_gl.compressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
 }
 
@@ -549,6 +1130,21 @@ void CallLogWrapper::glCompressedTexSubImage3D (glw::GLenum target, glw::GLint l
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTexSubImage3D(" << getTextureTargetStr(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << getCompressedTextureFormatStr(format) << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(76, 11);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(level);
+		args[2] = tcu::callTraceArg(xoffset);
+		args[3] = tcu::callTraceArg(yoffset);
+		args[4] = tcu::callTraceArg(zoffset);
+		args[5] = tcu::callTraceArg(width);
+		args[6] = tcu::callTraceArg(height);
+		args[7] = tcu::callTraceArg(depth);
+		args[8] = tcu::callTraceArg(format);
+		args[9] = tcu::callTraceArg(imageSize);
+		args[10] = tcu::callTraceArg(data);
+	}
 	m_gl.compressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
 }
 
@@ -556,6 +1152,17 @@ void CallLogWrapper::glCompressedTextureSubImage1D (glw::GLuint texture, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTextureSubImage1D(" << texture << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(77, 7);
+		args[0] = tcu::callTraceArg(texture);
+		args[1] = tcu::callTraceArg(level);
+		args[2] = tcu::callTraceArg(xoffset);
+		args[3] = tcu::callTraceArg(width);
+		args[4] = tcu::callTraceArg(format);
+		args[5] = tcu::callTraceArg(imageSize);
+		args[6] = tcu::callTraceArg(data);
+	}
 	m_gl.compressedTextureSubImage1D(texture, level, xoffset, width, format, imageSize, data);
 }
 
@@ -563,6 +1170,19 @@ void CallLogWrapper::glCompressedTextureSubImage2D (glw::GLuint texture, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTextureSubImage2D(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << toHex(format) << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(78, 9);
+		args[0] = tcu::callTraceArg(texture);
+		args[1] = tcu::callTraceArg(level);
+		args[2] = tcu::callTraceArg(xoffset);
+		args[3] = tcu::callTraceArg(yoffset);
+		args[4] = tcu::callTraceArg(width);
+		args[5] = tcu::callTraceArg(height);
+		args[6] = tcu::callTraceArg(format);
+		args[7] = tcu::callTraceArg(imageSize);
+		args[8] = tcu::callTraceArg(data);
+	}
 	m_gl.compressedTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, imageSize, data);
 }
 
@@ -570,6 +1190,21 @@ void CallLogWrapper::glCompressedTextureSubImage3D (glw::GLuint texture, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCompressedTextureSubImage3D(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << imageSize << ", " << data << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(79, 11);
+		args[0] = tcu::callTraceArg(texture);
+		args[1] = tcu::callTraceArg(level);
+		args[2] = tcu::callTraceArg(xoffset);
+		args[3] = tcu::callTraceArg(yoffset);
+		args[4] = tcu::callTraceArg(zoffset);
+		args[5] = tcu::callTraceArg(width);
+		args[6] = tcu::callTraceArg(height);
+		args[7] = tcu::callTraceArg(depth);
+		args[8] = tcu::callTraceArg(format);
+		args[9] = tcu::callTraceArg(imageSize);
+		args[10] = tcu::callTraceArg(data);
+	}
 	m_gl.compressedTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
 }
 
@@ -577,6 +1212,15 @@ void CallLogWrapper::glCopyBufferSubData (glw::GLenum readTarget, glw::GLenum wr
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyBufferSubData(" << toHex(readTarget) << ", " << toHex(writeTarget) << ", " << readOffset << ", " << writeOffset << ", " << size << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(80, 5);
+		args[0] = tcu::callTraceArg(readTarget);
+		args[1] = tcu::callTraceArg(writeTarget);
+		args[2] = tcu::callTraceArg(readOffset);
+		args[3] = tcu::callTraceArg(writeOffset);
+		args[4] = tcu::callTraceArg(size);
+	}
 	m_gl.copyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
 }
 
@@ -584,6 +1228,25 @@ void CallLogWrapper::glCopyImageSubData (glw::GLuint srcName, glw::GLenum srcTar
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyImageSubData(" << srcName << ", " << toHex(srcTarget) << ", " << srcLevel << ", " << srcX << ", " << srcY << ", " << srcZ << ", " << dstName << ", " << toHex(dstTarget) << ", " << dstLevel << ", " << dstX << ", " << dstY << ", " << dstZ << ", " << srcWidth << ", " << srcHeight << ", " << srcDepth << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(81, 15);
+		args[0] = tcu::callTraceArg(srcName);
+		args[1] = tcu::callTraceArg(srcTarget);
+		args[2] = tcu::callTraceArg(srcLevel);
+		args[3] = tcu::callTraceArg(srcX);
+		args[4] = tcu::callTraceArg(srcY);
+		args[5] = tcu::callTraceArg(srcZ);
+		args[6] = tcu::callTraceArg(dstName);
+		args[7] = tcu::callTraceArg(dstTarget);
+		args[8] = tcu::callTraceArg(dstLevel);
+		args[9] = tcu::callTraceArg(dstX);
+		args[10] = tcu::callTraceArg(dstY);
+		args[11] = tcu::callTraceArg(dstZ);
+		args[12] = tcu::callTraceArg(srcWidth);
+		args[13] = tcu::callTraceArg(srcHeight);
+		args[14] = tcu::callTraceArg(srcDepth);
+	}
 	m_gl.copyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
 }
 
@@ -591,6 +1254,15 @@ void CallLogWrapper::glCopyNamedBufferSubData (glw::GLuint readBuffer, glw::GLui
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyNamedBufferSubData(" << readBuffer << ", " << writeBuffer << ", " << readOffset << ", " << writeOffset << ", " << size << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(82, 5);
+		args[0] = tcu::callTraceArg(readBuffer);
+		args[1] = tcu::callTraceArg(writeBuffer);
+		args[2] = tcu::callTraceArg(readOffset);
+		args[3] = tcu::callTraceArg(writeOffset);
+		args[4] = tcu::callTraceArg(size);
+	}
 	m_gl.copyNamedBufferSubData(readBuffer, writeBuffer, readOffset, writeOffset, size);
 }
 
@@ -598,6 +1270,17 @@ void CallLogWrapper::glCopyTexImage1D (glw::GLenum target, glw::GLint level, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTexImage1D(" << getTextureTargetStr(target) << ", " << level << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << x << ", " << y << ", " << width << ", " << border << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(83, 7);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(level);
+		args[2] = tcu::callTraceArg(internalformat);
+		args[3] = tcu::callTraceArg(x);
+		args[4] = tcu::callTraceArg(y);
+		args[5] = tcu::callTraceArg(width);
+		args[6] = tcu::callTraceArg(border);
+	}
 	m_gl.copyTexImage1D(target, level, internalformat, x, y, width, border);
 }
 
@@ -605,6 +1288,18 @@ void CallLogWrapper::glCopyTexImage2D (glw::GLenum target, glw::GLint level, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTexImage2D(" << getTextureTargetStr(target) << ", " << level << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << x << ", " << y << ", " << width << ", " << height << ", " << border << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(84, 8);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(level);
+		args[2] = tcu::callTraceArg(internalformat);
+		args[3] = tcu::callTraceArg(x);
+		args[4] = tcu::callTraceArg(y);
+		args[5] = tcu::callTraceArg(width);
+		args[6] = tcu::callTraceArg(height);
+		args[7] = tcu::callTraceArg(border);
+	}
 	m_gl.copyTexImage2D(target, level, internalformat, x, y, width, height, border);
 }
 
@@ -612,6 +1307,16 @@ void CallLogWrapper::glCopyTexSubImage1D (glw::GLenum target, glw::GLint level,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTexSubImage1D(" << toHex(target) << ", " << level << ", " << xoffset << ", " << x << ", " << y << ", " << width << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(85, 6);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(level);
+		args[2] = tcu::callTraceArg(xoffset);
+		args[3] = tcu::callTraceArg(x);
+		args[4] = tcu::callTraceArg(y);
+		args[5] = tcu::callTraceArg(width);
+	}
 	m_gl.copyTexSubImage1D(target, level, xoffset, x, y, width);
 }
 
@@ -619,6 +1324,18 @@ void CallLogWrapper::glCopyTexSubImage2D (glw::GLenum target, glw::GLint level,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTexSubImage2D(" << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(86, 8);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(level);
+		args[2] = tcu::callTraceArg(xoffset);
+		args[3] = tcu::callTraceArg(yoffset);
+		args[4] = tcu::callTraceArg(x);
+		args[5] = tcu::callTraceArg(y);
+		args[6] = tcu::callTraceArg(width);
+		args[7] = tcu::callTraceArg(height);
+	}
 	m_gl.copyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
 }
 
@@ -626,6 +1343,19 @@ void CallLogWrapper::glCopyTexSubImage3D (glw::GLenum target, glw::GLint level,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTexSubImage3D(" << toHex(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(87, 9);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(level);
+		args[2] = tcu::callTraceArg(xoffset);
+		args[3] = tcu::callTraceArg(yoffset);
+		args[4] = tcu::callTraceArg(zoffset);
+		args[5] = tcu::callTraceArg(x);
+		args[6] = tcu::callTraceArg(y);
+		args[7] = tcu::callTraceArg(width);
+		args[8] = tcu::callTraceArg(height);
+	}
 	m_gl.copyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
 }
 
@@ -633,6 +1363,16 @@ void CallLogWrapper::glCopyTextureSubImage1D (glw::GLuint texture, glw::GLint le
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTextureSubImage1D(" << texture << ", " << level << ", " << xoffset << ", " << x << ", " << y << ", " << width << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(88, 6);
+		args[0] = tcu::callTraceArg(texture);
+		args[1] = tcu::callTraceArg(level);
+		args[2] = tcu::callTraceArg(xoffset);
+		args[3] = tcu::callTraceArg(x);
+		args[4] = tcu::callTraceArg(y);
+		args[5] = tcu::callTraceArg(width);
+	}
 	m_gl.copyTextureSubImage1D(texture, level, xoffset, x, y, width);
 }
 
@@ -640,6 +1380,18 @@ void CallLogWrapper::glCopyTextureSubImage2D (glw::GLuint texture, glw::GLint le
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTextureSubImage2D(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(89, 8);
+		args[0] = tcu::callTraceArg(texture);
+		args[1] = tcu::callTraceArg(level);
+		args[2] = tcu::callTraceArg(xoffset);
+		args[3] = tcu::callTraceArg(yoffset);
+		args[4] = tcu::callTraceArg(x);
+		args[5] = tcu::callTraceArg(y);
+		args[6] = tcu::callTraceArg(width);
+		args[7] = tcu::callTraceArg(height);
+	}
 	m_gl.copyTextureSubImage2D(texture, level, xoffset, yoffset, x, y, width, height);
 }
 
@@ -647,6 +1399,19 @@ void CallLogWrapper::glCopyTextureSubImage3D (glw::GLuint texture, glw::GLint le
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCopyTextureSubImage3D(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(90, 9);
+		args[0] = tcu::callTraceArg(texture);
+		args[1] = tcu::callTraceArg(level);
+		args[2] = tcu::callTraceArg(xoffset);
+		args[3] = tcu::callTraceArg(yoffset);
+		args[4] = tcu::callTraceArg(zoffset);
+		args[5] = tcu::callTraceArg(x);
+		args[6] = tcu::callTraceArg(y);
+		args[7] = tcu::callTraceArg(width);
+		args[8] = tcu::callTraceArg(height);
+	}
 	m_gl.copyTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, x, y, width, height);
 }
 
@@ -654,6 +1419,12 @@ void CallLogWrapper::glCreateBuffers (glw::GLsizei n, glw::GLuint *buffers)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateBuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(91, 2);
+		args[0] = tcu::callTraceArg(n);
+		args[1] = tcu::callTraceArg(buffers);
+	}
 	m_gl.createBuffers(n, buffers);
 }
 
@@ -661,6 +1432,12 @@ void CallLogWrapper::glCreateFramebuffers (glw::GLsizei n, glw::GLuint *framebuf
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateFramebuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(framebuffers))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(92, 2);
+		args[0] = tcu::callTraceArg(n);
+		args[1] = tcu::callTraceArg(framebuffers);
+	}
 	m_gl.createFramebuffers(n, framebuffers);
 }
 
@@ -668,6 +1445,8 @@ glw::GLuint CallLogWrapper::glCreateProgram (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateProgram(" << ");" << TestLog::EndMessage;
+	if (m_trace)
+		m_trace->recordCall(93, 0);
 	glw::GLuint returnValue = m_gl.createProgram();
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -678,6 +1457,12 @@ void CallLogWrapper::glCreateProgramPipelines (glw::GLsizei n, glw::GLuint *pipe
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateProgramPipelines(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pipelines))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(94, 2);
+		args[0] = tcu::callTraceArg(n);
+		args[1] = tcu::callTraceArg(pipelines);
+	}
 	m_gl.createProgramPipelines(n, pipelines);
 }
 
@@ -685,6 +1470,13 @@ void CallLogWrapper::glCreateQueries (glw::GLenum target, glw::GLsizei n, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateQueries(" << toHex(target) << ", " << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(95, 3);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(n);
+		args[2] = tcu::callTraceArg(ids);
+	}
 	m_gl.createQueries(target, n, ids);
 }
 
@@ -692,6 +1484,12 @@ void CallLogWrapper::glCreateRenderbuffers (glw::GLsizei n, glw::GLuint *renderb
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateRenderbuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(renderbuffers))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(96, 2);
+		args[0] = tcu::callTraceArg(n);
+		args[1] = tcu::callTraceArg(renderbuffers);
+	}
 	m_gl.createRenderbuffers(n, renderbuffers);
 }
 
@@ -699,6 +1497,12 @@ void CallLogWrapper::glCreateSamplers (glw::GLsizei n, glw::GLuint *samplers)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateSamplers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(samplers))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(97, 2);
+		args[0] = tcu::callTraceArg(n);
+		args[1] = tcu::callTraceArg(samplers);
+	}
 	m_gl.createSamplers(n, samplers);
 }
 
@@ -706,6 +1510,11 @@ glw::GLuint CallLogWrapper::glCreateShader (glw::GLenum type)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateShader(" << getShaderTypeStr(type) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(98, 1);
+		args[0] = tcu::callTraceArg(type);
+	}
 	glw::GLuint returnValue = m_gl.createShader(type);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -716,6 +1525,13 @@ glw::GLuint CallLogWrapper::glCreateShaderProgramv (glw::GLenum type, glw::GLsiz
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateShaderProgramv(" << toHex(type) << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(strings))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(99, 3);
+		args[0] = tcu::callTraceArg(type);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(strings);
+	}
 	glw::GLuint returnValue = m_gl.createShaderProgramv(type, count, strings);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -726,6 +1542,13 @@ void CallLogWrapper::glCreateTextures (glw::GLenum target, glw::GLsizei n, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateTextures(" << toHex(target) << ", " << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(textures))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(100, 3);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(n);
+		args[2] = tcu::callTraceArg(textures);
+	}
 	m_gl.createTextures(target, n, textures);
 }
 
@@ -733,6 +1556,12 @@ void CallLogWrapper::glCreateTransformFeedbacks (glw::GLsizei n, glw::GLuint *id
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateTransformFeedbacks(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(101, 2);
+		args[0] = tcu::callTraceArg(n);
+		args[1] = tcu::callTraceArg(ids);
+	}
 	m_gl.createTransformFeedbacks(n, ids);
 }
 
@@ -740,6 +1569,12 @@ void CallLogWrapper::glCreateVertexArrays (glw::GLsizei n, glw::GLuint *arrays)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCreateVertexArrays(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(arrays))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(102, 2);
+		args[0] = tcu::callTraceArg(n);
+		args[1] = tcu::callTraceArg(arrays);
+	}
 	m_gl.createVertexArrays(n, arrays);
 }
 
@@ -747,6 +1582,11 @@ void CallLogWrapper::glCullFace (glw::GLenum mode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glCullFace(" << getFaceStr(mode) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(103, 1);
+		args[0] = tcu::callTraceArg(mode);
+	}
 	m_gl.cullFace(mode);
 }
 
@@ -754,6 +1594,12 @@ void CallLogWrapper::glDebugMessageCallback (glw::GLDEBUGPROC callback, const vo
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDebugMessageCallback(" << toHex(reinterpret_cast<deUintptr>(callback)) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(userParam))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(104, 2);
+		args[0] = tcu::callTraceArg(callback);
+		args[1] = tcu::callTraceArg(userParam);
+	}
 	m_gl.debugMessageCallback(callback, userParam);
 }
 
@@ -761,6 +1607,16 @@ void CallLogWrapper::glDebugMessageControl (glw::GLenum source, glw::GLenum type
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDebugMessageControl(" << getDebugMessageSourceStr(source) << ", " << getDebugMessageTypeStr(type) << ", " << getDebugMessageSeverityStr(severity) << ", " << count << ", " << getPointerStr(ids, (count)) << ", " << getBooleanStr(enabled) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(105, 6);
+		args[0] = tcu::callTraceArg(source);
+		args[1] = tcu::callTraceArg(type);
+		args[2] = tcu::callTraceArg(severity);
+		args[3] = tcu::callTraceArg(count);
+		args[4] = tcu::callTraceArg(ids);
+		args[5] = tcu::callTraceArg(enabled);
+	}
 	m_gl.debugMessageControl(source, type, severity, count, ids, enabled);
 }
 
@@ -768,6 +1624,16 @@ void CallLogWrapper::glDebugMessageInsert (glw::GLenum source, glw::GLenum type,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDebugMessageInsert(" << getDebugMessageSourceStr(source) << ", " << getDebugMessageTypeStr(type) << ", " << id << ", " << getDebugMessageSeverityStr(severity) << ", " << length << ", " << getStringStr(buf) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(106, 6);
+		args[0] = tcu::callTraceArg(source);
+		args[1] = tcu::callTraceArg(type);
+		args[2] = tcu::callTraceArg(id);
+		args[3] = tcu::callTraceArg(severity);
+		args[4] = tcu::callTraceArg(length);
+		args[5] = tcu::callTraceArg(buf);
+	}
 	m_gl.debugMessageInsert(source, type, id, severity, length, buf);
 }
 
@@ -775,6 +1641,12 @@ void CallLogWrapper::glDeleteBuffers (glw::GLsizei n, const glw::GLuint *buffers
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteBuffers(" << n << ", " << getPointerStr(buffers, n) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(107, 2);
+		args[0] = tcu::callTraceArg(n);
+		args[1] = tcu::callTraceArg(buffers);
+	}
 	m_gl.deleteBuffers(n, buffers);
 }
 
@@ -782,6 +1654,12 @@ void CallLogWrapper::glDeleteFramebuffers (glw::GLsizei n, const glw::GLuint *fr
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteFramebuffers(" << n << ", " << getPointerStr(framebuffers, n) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(108, 2);
+		args[0] = tcu::callTraceArg(n);
+		args[1] = tcu::callTraceArg(framebuffers);
+	}
 	m_gl.deleteFramebuffers(n, framebuffers);
 }
 
@@ -789,6 +1667,11 @@ void CallLogWrapper::glDeleteProgram (glw::GLuint program)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteProgram(" << program << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(109, 1);
+		args[0] = tcu::callTraceArg(program);
+	}
 	m_gl.deleteProgram(program);
 }
 
@@ -796,6 +1679,12 @@ void CallLogWrapper::glDeleteProgramPipelines (glw::GLsizei n, const glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteProgramPipelines(" << n << ", " << getPointerStr(pipelines, n) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(110, 2);
+		args[0] = tcu::callTraceArg(n);
+		args[1] = tcu::callTraceArg(pipelines);
+	}
 	m_gl.deleteProgramPipelines(n, pipelines);
 }
 
@@ -803,6 +1692,12 @@ void CallLogWrapper::glDeleteQueries (glw::GLsizei n, const glw::GLuint *ids)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteQueries(" << n << ", " << getPointerStr(ids, n) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(111, 2);
+		args[0] = tcu::callTraceArg(n);
+		args[1] = tcu::callTraceArg(ids);
+	}
 	m_gl.deleteQueries(n, ids);
 }
 
@@ -810,6 +1705,12 @@ void CallLogWrapper::glDeleteRenderbuffers (glw::GLsizei n, const glw::GLuint *r
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteRenderbuffers(" << n << ", " << getPointerStr(renderbuffers, n) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(112, 2);
+		args[0] = tcu::callTraceArg(n);
+		args[1] = tcu::callTraceArg(renderbuffers);
+	}
 	m_gl.deleteRenderbuffers(n, renderbuffers);
 }
 
@@ -817,6 +1718,12 @@ void CallLogWrapper::glDeleteSamplers (glw::GLsizei count, const glw::GLuint *sa
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteSamplers(" << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(samplers))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(113, 2);
+		args[0] = tcu::callTraceArg(count);
+		args[1] = tcu::callTraceArg(samplers);
+	}
 	m_gl.deleteSamplers(count, samplers);
 }
 
@@ -824,6 +1731,11 @@ void CallLogWrapper::glDeleteShader (glw::GLuint shader)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteShader(" << shader << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(114, 1);
+		args[0] = tcu::callTraceArg(shader);
+	}
 	m_gl.deleteShader(shader);
 }
 
@@ -831,6 +1743,11 @@ void CallLogWrapper::glDeleteSync (glw::GLsync sync)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteSync(" << sync << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(115, 1);
+		args[0] = tcu::callTraceArg(sync);
+	}
 	m_gl.deleteSync(sync);
 }
 
@@ -838,6 +1755,12 @@ void CallLogWrapper::glDeleteTextures (glw::GLsizei n, const glw::GLuint *textur
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteTextures(" << n << ", " << getPointerStr(textures, n) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(116, 2);
+		args[0] = tcu::callTraceArg(n);
+		args[1] = tcu::callTraceArg(textures);
+	}
 	m_gl.deleteTextures(n, textures);
 }
 
@@ -845,6 +1768,12 @@ void CallLogWrapper::glDeleteTransformFeedbacks (glw::GLsizei n, const glw::GLui
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteTransformFeedbacks(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(117, 2);
+		args[0] = tcu::callTraceArg(n);
+		args[1] = tcu::callTraceArg(ids);
+	}
 	m_gl.deleteTransformFeedbacks(n, ids);
 }
 
@@ -852,6 +1781,12 @@ void CallLogWrapper::glDeleteVertexArrays (glw::GLsizei n, const glw::GLuint *ar
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDeleteVertexArrays(" << n << ", " << getPointerStr(arrays, n) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(118, 2);
+		args[0] = tcu::callTraceArg(n);
+		args[1] = tcu::callTraceArg(arrays);
+	}
 	m_gl.deleteVertexArrays(n, arrays);
 }
 
@@ -859,6 +1794,11 @@ void CallLogWrapper::glDepthFunc (glw::GLenum func)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDepthFunc(" << getCompareFuncStr(func) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(119, 1);
+		args[0] = tcu::callTraceArg(func);
+	}
 	m_gl.depthFunc(func);
 }
 
@@ -866,6 +1806,11 @@ void CallLogWrapper::glDepthMask (glw::GLboolean flag)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDepthMask(" << getBooleanStr(flag) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(120, 1);
+		args[0] = tcu::callTraceArg(flag);
+	}
 	m_gl.depthMask(flag);
 }
 
@@ -873,6 +1818,12 @@ void CallLogWrapper::glDepthRange (glw::GLdouble near, glw::GLdouble far)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDepthRange(" << near << ", " << far << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(121, 2);
+		args[0] = tcu::callTraceArg(near);
+		args[1] = tcu::callTraceArg(far);
+	}
 	m_gl.depthRange(near, far);
 }
 
@@ -880,6 +1831,13 @@ void CallLogWrapper::glDepthRangeArrayv (glw::GLuint first, glw::GLsizei count,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDepthRangeArrayv(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(122, 3);
+		args[0] = tcu::callTraceArg(first);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(v);
+	}
 	m_gl.depthRangeArrayv(first, count, v);
 }
 
@@ -887,6 +1845,13 @@ void CallLogWrapper::glDepthRangeIndexed (glw::GLuint index, glw::GLdouble n, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDepthRangeIndexed(" << index << ", " << n << ", " << f << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(123, 3);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(n);
+		args[2] = tcu::callTraceArg(f);
+	}
 	m_gl.depthRangeIndexed(index, n, f);
 }
 
@@ -894,6 +1859,12 @@ void CallLogWrapper::glDepthRangef (glw::GLfloat n, glw::GLfloat f)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDepthRangef(" << n << ", " << f << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(124, 2);
+		args[0] = tcu::callTraceArg(n);
+		args[1] = tcu::callTraceArg(f);
+	}
 	m_gl.depthRangef(n, f);
 }
 
@@ -901,6 +1872,12 @@ void CallLogWrapper::glDetachShader (glw::GLuint program, glw::GLuint shader)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDetachShader(" << program << ", " << shader << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(125, 2);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(shader);
+	}
 	m_gl.detachShader(program, shader);
 }
 
@@ -908,6 +1885,11 @@ void CallLogWrapper::glDisable (glw::GLenum cap)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDisable(" << getEnableCapStr(cap) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(126, 1);
+		args[0] = tcu::callTraceArg(cap);
+	}
 	m_gl.disable(cap);
 }
 
@@ -915,6 +1897,12 @@ void CallLogWrapper::glDisableVertexArrayAttrib (glw::GLuint vaobj, glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDisableVertexArrayAttrib(" << vaobj << ", " << index << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(127, 2);
+		args[0] = tcu::callTraceArg(vaobj);
+		args[1] = tcu::callTraceArg(index);
+	}
 	m_gl.disableVertexArrayAttrib(vaobj, index);
 }
 
@@ -922,6 +1910,11 @@ void CallLogWrapper::glDisableVertexAttribArray (glw::GLuint index)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDisableVertexAttribArray(" << index << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(128, 1);
+		args[0] = tcu::callTraceArg(index);
+	}
 	m_gl.disableVertexAttribArray(index);
 }
 
@@ -929,6 +1922,12 @@ void CallLogWrapper::glDisablei (glw::GLenum target, glw::GLuint index)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDisablei(" << getIndexedEnableCapStr(target) << ", " << index << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(129, 2);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(index);
+	}
 	m_gl.disablei(target, index);
 }
 
@@ -936,6 +1935,13 @@ void CallLogWrapper::glDispatchCompute (glw::GLuint num_groups_x, glw::GLuint nu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDispatchCompute(" << num_groups_x << ", " << num_groups_y << ", " << num_groups_z << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(130, 3);
+		args[0] = tcu::callTraceArg(num_groups_x);
+		args[1] = tcu::callTraceArg(num_groups_y);
+		args[2] = tcu::callTraceArg(num_groups_z);
+	}
 	m_gl.dispatchCompute(num_groups_x, num_groups_y, num_groups_z);
 }
 
@@ -943,6 +1949,11 @@ void CallLogWrapper::glDispatchComputeIndirect (glw::GLintptr indirect)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDispatchComputeIndirect(" << indirect << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(131, 1);
+		args[0] = tcu::callTraceArg(indirect);
+	}
 	m_gl.dispatchComputeIndirect(indirect);
 }
 
@@ -950,6 +1961,13 @@ void CallLogWrapper::glDrawArrays (glw::GLenum mode, glw::GLint first, glw::GLsi
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawArrays(" << getPrimitiveTypeStr(mode) << ", " << first << ", " << count << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(132, 3);
+		args[0] = tcu::callTraceArg(mode);
+		args[1] = tcu::callTraceArg(first);
+		args[2] = tcu::callTraceArg(count);
+	}
 	m_gl.drawArrays(mode, first, count);
 }
 
@@ -957,6 +1975,12 @@ void CallLogWrapper::glDrawArraysIndirect (glw::GLenum mode, const void *indirec
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawArraysIndirect(" << getPrimitiveTypeStr(mode) << ", " << indirect << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(133, 2);
+		args[0] = tcu::callTraceArg(mode);
+		args[1] = tcu::callTraceArg(indirect);
+	}
 	m_gl.drawArraysIndirect(mode, indirect);
 }
 
@@ -964,6 +1988,14 @@ void CallLogWrapper::glDrawArraysInstanced (glw::GLenum mode, glw::GLint first,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawArraysInstanced(" << getPrimitiveTypeStr(mode) << ", " << first << ", " << count << ", " << instancecount << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(134, 4);
+		args[0] = tcu::callTraceArg(mode);
+		args[1] = tcu::callTraceArg(first);
+		args[2] = tcu::callTraceArg(count);
+		args[3] = tcu::callTraceArg(instancecount);
+	}
 	m_gl.drawArraysInstanced(mode, first, count, instancecount);
 }
 
@@ -971,6 +2003,15 @@ void CallLogWrapper::glDrawArraysInstancedBaseInstance (glw::GLenum mode, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawArraysInstancedBaseInstance(" << toHex(mode) << ", " << first << ", " << count << ", " << instancecount << ", " << baseinstance << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(135, 5);
+		args[0] = tcu::callTraceArg(mode);
+		args[1] = tcu::callTraceArg(first);
+		args[2] = tcu::callTraceArg(count);
+		args[3] = tcu::callTraceArg(instancecount);
+		args[4] = tcu::callTraceArg(baseinstance);
+	}
 	m_gl.drawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance);
 }
 
@@ -978,6 +2019,11 @@ void CallLogWrapper::glDrawBuffer (glw::GLenum buf)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawBuffer(" << toHex(buf) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(136, 1);
+		args[0] = tcu::callTraceArg(buf);
+	}
 	m_gl.drawBuffer(buf);
 }
 
@@ -985,6 +2031,12 @@ void CallLogWrapper::glDrawBuffers (glw::GLsizei n, const glw::GLenum *bufs)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawBuffers(" << n << ", " << getEnumPointerStr(bufs, n, getDrawReadBufferName) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(137, 2);
+		args[0] = tcu::callTraceArg(n);
+		args[1] = tcu::callTraceArg(bufs);
+	}
 	m_gl.drawBuffers(n, bufs);
 }
 
@@ -992,6 +2044,14 @@ void CallLogWrapper::glDrawElements (glw::GLenum mode, glw::GLsizei count, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawElements(" << getPrimitiveTypeStr(mode) << ", " << count << ", " << getTypeStr(type) << ", " << indices << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(138, 4);
+		args[0] = tcu::callTraceArg(mode);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(type);
+		args[3] = tcu::callTraceArg(indices);
+	}
 	m_gl.drawElements(mode, count, type, indices);
 }
 
@@ -999,6 +2059,15 @@ void CallLogWrapper::glDrawElementsBaseVertex (glw::GLenum mode, glw::GLsizei co
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawElementsBaseVertex(" << getPrimitiveTypeStr(mode) << ", " << count << ", " << getTypeStr(type) << ", " << indices << ", " << basevertex << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(139, 5);
+		args[0] = tcu::callTraceArg(mode);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(type);
+		args[3] = tcu::callTraceArg(indices);
+		args[4] = tcu::callTraceArg(basevertex);
+	}
 	m_gl.drawElementsBaseVertex(mode, count, type, indices, basevertex);
 }
 
@@ -1006,6 +2075,13 @@ void CallLogWrapper::glDrawElementsIndirect (glw::GLenum mode, glw::GLenum type,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawElementsIndirect(" << getPrimitiveTypeStr(mode) << ", " << getTypeStr(type) << ", " << indirect << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(140, 3);
+		args[0] = tcu::callTraceArg(mode);
+		args[1] = tcu::callTraceArg(type);
+		args[2] = tcu::callTraceArg(indirect);
+	}
 	m_gl.drawElementsIndirect(mode, type, indirect);
 }
 
@@ -1013,6 +2089,15 @@ void CallLogWrapper::glDrawElementsInstanced (glw::GLenum mode, glw::GLsizei cou
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawElementsInstanced(" << getPrimitiveTypeStr(mode) << ", " << count << ", " << getTypeStr(type) << ", " << indices << ", " << instancecount << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(141, 5);
+		args[0] = tcu::callTraceArg(mode);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(type);
+		args[3] = tcu::callTraceArg(indices);
+		args[4] = tcu::callTraceArg(instancecount);
+	}
 	m_gl.drawElementsInstanced(mode, count, type, indices, instancecount);
 }
 
@@ -1020,6 +2105,16 @@ void CallLogWrapper::glDrawElementsInstancedBaseInstance (glw::GLenum mode, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawElementsInstancedBaseInstance(" << toHex(mode) << ", " << count << ", " << toHex(type) << ", " << indices << ", " << instancecount << ", " << baseinstance << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(142, 6);
+		args[0] = tcu::callTraceArg(mode);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(type);
+		args[3] = tcu::callTraceArg(indices);
+		args[4] = tcu::callTraceArg(instancecount);
+		args[5] = tcu::callTraceArg(baseinstance);
+	}
 	m_gl.drawElementsInstancedBaseInstance(mode, count, type, indices, instancecount, baseinstance);
 }
 
@@ -1027,6 +2122,16 @@ void CallLogWrapper::glDrawElementsInstancedBaseVertex (glw::GLenum mode, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawElementsInstancedBaseVertex(" << getPrimitiveTypeStr(mode) << ", " << count << ", " << getTypeStr(type) << ", " << indices << ", " << instancecount << ", " << basevertex << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(143, 6);
+		args[0] = tcu::callTraceArg(mode);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(type);
+		args[3] = tcu::callTraceArg(indices);
+		args[4] = tcu::callTraceArg(instancecount);
+		args[5] = tcu::callTraceArg(basevertex);
+	}
 	m_gl.drawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
 }
 
@@ -1034,6 +2139,17 @@ void CallLogWrapper::glDrawElementsInstancedBaseVertexBaseInstance (glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawElementsInstancedBaseVertexBaseInstance(" << toHex(mode) << ", " << count << ", " << toHex(type) << ", " << indices << ", " << instancecount << ", " << basevertex << ", " << baseinstance << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(144, 7);
+		args[0] = tcu::callTraceArg(mode);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(type);
+		args[3] = tcu::callTraceArg(indices);
+		args[4] = tcu::callTraceArg(instancecount);
+		args[5] = tcu::callTraceArg(basevertex);
+		args[6] = tcu::callTraceArg(baseinstance);
+	}
 	m_gl.drawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices, instancecount, basevertex, baseinstance);
 }
 
@@ -1041,6 +2157,16 @@ void CallLogWrapper::glDrawRangeElements (glw::GLenum mode, glw::GLuint start, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawRangeElements(" << getPrimitiveTypeStr(mode) << ", " << start << ", " << end << ", " << count << ", " << getTypeStr(type) << ", " << indices << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(145, 6);
+		args[0] = tcu::callTraceArg(mode);
+		args[1] = tcu::callTraceArg(start);
+		args[2] = tcu::callTraceArg(end);
+		args[3] = tcu::callTraceArg(count);
+		args[4] = tcu::callTraceArg(type);
+		args[5] = tcu::callTraceArg(indices);
+	}
 	m_gl.drawRangeElements(mode, start, end, count, type, indices);
 }
 
@@ -1048,6 +2174,17 @@ void CallLogWrapper::glDrawRangeElementsBaseVertex (glw::GLenum mode, glw::GLuin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawRangeElementsBaseVertex(" << getPrimitiveTypeStr(mode) << ", " << start << ", " << end << ", " << count << ", " << getTypeStr(type) << ", " << indices << ", " << basevertex << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(146, 7);
+		args[0] = tcu::callTraceArg(mode);
+		args[1] = tcu::callTraceArg(start);
+		args[2] = tcu::callTraceArg(end);
+		args[3] = tcu::callTraceArg(count);
+		args[4] = tcu::callTraceArg(type);
+		args[5] = tcu::callTraceArg(indices);
+		args[6] = tcu::callTraceArg(basevertex);
+	}
 	m_gl.drawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
 }
 
@@ -1055,6 +2192,12 @@ void CallLogWrapper::glDrawTransformFeedback (glw::GLenum mode, glw::GLuint id)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawTransformFeedback(" << toHex(mode) << ", " << id << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(147, 2);
+		args[0] = tcu::callTraceArg(mode);
+		args[1] = tcu::callTraceArg(id);
+	}
 	m_gl.drawTransformFeedback(mode, id);
 }
 
@@ -1062,6 +2205,13 @@ void CallLogWrapper::glDrawTransformFeedbackInstanced (glw::GLenum mode, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawTransformFeedbackInstanced(" << toHex(mode) << ", " << id << ", " << instancecount << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(148, 3);
+		args[0] = tcu::callTraceArg(mode);
+		args[1] = tcu::callTraceArg(id);
+		args[2] = tcu::callTraceArg(instancecount);
+	}
 	m_gl.drawTransformFeedbackInstanced(mode, id, instancecount);
 }
 
@@ -1069,6 +2219,13 @@ void CallLogWrapper::glDrawTransformFeedbackStream (glw::GLenum mode, glw::GLuin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawTransformFeedbackStream(" << toHex(mode) << ", " << id << ", " << stream << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(149, 3);
+		args[0] = tcu::callTraceArg(mode);
+		args[1] = tcu::callTraceArg(id);
+		args[2] = tcu::callTraceArg(stream);
+	}
 	m_gl.drawTransformFeedbackStream(mode, id, stream);
 }
 
@@ -1076,6 +2233,14 @@ void CallLogWrapper::glDrawTransformFeedbackStreamInstanced (glw::GLenum mode, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glDrawTransformFeedbackStreamInstanced(" << toHex(mode) << ", " << id << ", " << stream << ", " << instancecount << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(150, 4);
+		args[0] = tcu::callTraceArg(mode);
+		args[1] = tcu::callTraceArg(id);
+		args[2] = tcu::callTraceArg(stream);
+		args[3] = tcu::callTraceArg(instancecount);
+	}
 	m_gl.drawTransformFeedbackStreamInstanced(mode, id, stream, instancecount);
 }
 
@@ -1083,6 +2248,12 @@ void CallLogWrapper::glEGLImageTargetRenderbufferStorageOES (glw::GLenum target,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEGLImageTargetRenderbufferStorageOES(" << toHex(target) << ", " << image << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(151, 2);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(image);
+	}
 	m_gl.eglImageTargetRenderbufferStorageOES(target, image);
 }
 
@@ -1090,6 +2261,12 @@ void CallLogWrapper::glEGLImageTargetTexture2DOES (glw::GLenum target, glw::GLeg
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEGLImageTargetTexture2DOES(" << toHex(target) << ", " << image << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(152, 2);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(image);
+	}
 	m_gl.eglImageTargetTexture2DOES(target, image);
 }
 
@@ -1097,6 +2274,11 @@ void CallLogWrapper::glEnable (glw::GLenum cap)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEnable(" << getEnableCapStr(cap) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(153, 1);
+		args[0] = tcu::callTraceArg(cap);
+	}
 	m_gl.enable(cap);
 }
 
@@ -1104,6 +2286,12 @@ void CallLogWrapper::glEnableVertexArrayAttrib (glw::GLuint vaobj, glw::GLuint i
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEnableVertexArrayAttrib(" << vaobj << ", " << index << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(154, 2);
+		args[0] = tcu::callTraceArg(vaobj);
+		args[1] = tcu::callTraceArg(index);
+	}
 	m_gl.enableVertexArrayAttrib(vaobj, index);
 }
 
@@ -1111,6 +2299,11 @@ void CallLogWrapper::glEnableVertexAttribArray (glw::GLuint index)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEnableVertexAttribArray(" << index << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(155, 1);
+		args[0] = tcu::callTraceArg(index);
+	}
 	m_gl.enableVertexAttribArray(index);
 }
 
@@ -1118,6 +2311,12 @@ void CallLogWrapper::glEnablei (glw::GLenum target, glw::GLuint index)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEnablei(" << getIndexedEnableCapStr(target) << ", " << index << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(156, 2);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(index);
+	}
 	m_gl.enablei(target, index);
 }
 
@@ -1125,6 +2324,8 @@ void CallLogWrapper::glEndConditionalRender (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEndConditionalRender(" << ");" << TestLog::EndMessage;
+	if (m_trace)
+		m_trace->recordCall(157, 0);
 	m_gl.endConditionalRender();
 }
 
@@ -1132,6 +2333,11 @@ void CallLogWrapper::glEndQuery (glw::GLenum target)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEndQuery(" << getQueryTargetStr(target) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(158, 1);
+		args[0] = tcu::callTraceArg(target);
+	}
 	m_gl.endQuery(target);
 }
 
@@ -1139,6 +2345,12 @@ void CallLogWrapper::glEndQueryIndexed (glw::GLenum target, glw::GLuint index)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEndQueryIndexed(" << toHex(target) << ", " << index << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(159, 2);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(index);
+	}
 	m_gl.endQueryIndexed(target, index);
 }
 
@@ -1146,6 +2358,8 @@ void CallLogWrapper::glEndTransformFeedback (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glEndTransformFeedback(" << ");" << TestLog::EndMessage;
+	if (m_trace)
+		m_trace->recordCall(160, 0);
 	m_gl.endTransformFeedback();
 }
 
@@ -1153,6 +2367,12 @@ glw::GLsync CallLogWrapper::glFenceSync (glw::GLenum condition, glw::GLbitfield
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFenceSync(" << toHex(condition) << ", " << toHex(flags) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(161, 2);
+		args[0] = tcu::callTraceArg(condition);
+		args[1] = tcu::callTraceArg(flags);
+	}
 	glw::GLsync returnValue = m_gl.fenceSync(condition, flags);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -1163,6 +2383,8 @@ void CallLogWrapper::glFinish (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFinish(" << ");" << TestLog::EndMessage;
+	if (m_trace)
+		m_trace->recordCall(162, 0);
 	m_gl.finish();
 }
 
@@ -1170,6 +2392,8 @@ void CallLogWrapper::glFlush (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFlush(" << ");" << TestLog::EndMessage;
+	if (m_trace)
+		m_trace->recordCall(163, 0);
 	m_gl.flush();
 }
 
@@ -1177,6 +2401,13 @@ void CallLogWrapper::glFlushMappedBufferRange (glw::GLenum target, glw::GLintptr
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFlushMappedBufferRange(" << getBufferTargetStr(target) << ", " << offset << ", " << length << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(164, 3);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(offset);
+		args[2] = tcu::callTraceArg(length);
+	}
 	m_gl.flushMappedBufferRange(target, offset, length);
 }
 
@@ -1184,6 +2415,13 @@ void CallLogWrapper::glFlushMappedNamedBufferRange (glw::GLuint buffer, glw::GLi
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFlushMappedNamedBufferRange(" << buffer << ", " << offset << ", " << length << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(165, 3);
+		args[0] = tcu::callTraceArg(buffer);
+		args[1] = tcu::callTraceArg(offset);
+		args[2] = tcu::callTraceArg(length);
+	}
 	m_gl.flushMappedNamedBufferRange(buffer, offset, length);
 }
 
@@ -1191,6 +2429,13 @@ void CallLogWrapper::glFramebufferParameteri (glw::GLenum target, glw::GLenum pn
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferParameteri(" << getFramebufferTargetStr(target) << ", " << getFramebufferParameterStr(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(166, 3);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(param);
+	}
 	m_gl.framebufferParameteri(target, pname, param);
 }
 
@@ -1198,6 +2443,14 @@ void CallLogWrapper::glFramebufferRenderbuffer (glw::GLenum target, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferRenderbuffer(" << getFramebufferTargetStr(target) << ", " << getFramebufferAttachmentStr(attachment) << ", " << getFramebufferTargetStr(renderbuffertarget) << ", " << renderbuffer << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(167, 4);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(attachment);
+		args[2] = tcu::callTraceArg(renderbuffertarget);
+		args[3] = tcu::callTraceArg(renderbuffer);
+	}
 	m_gl.framebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
 }
 
@@ -1205,6 +2458,14 @@ void CallLogWrapper::glFramebufferTexture (glw::GLenum target, glw::GLenum attac
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferTexture(" << getFramebufferTargetStr(target) << ", " << getFramebufferAttachmentStr(attachment) << ", " << texture << ", " << level << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(168, 4);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(attachment);
+		args[2] = tcu::callTraceArg(texture);
+		args[3] = tcu::callTraceArg(level);
+	}
 	m_gl.framebufferTexture(target, attachment, texture, level);
 }
 
@@ -1212,6 +2473,15 @@ void CallLogWrapper::glFramebufferTexture1D (glw::GLenum target, glw::GLenum att
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferTexture1D(" << toHex(target) << ", " << toHex(attachment) << ", " << toHex(textarget) << ", " << texture << ", " << level << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(169, 5);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(attachment);
+		args[2] = tcu::callTraceArg(textarget);
+		args[3] = tcu::callTraceArg(texture);
+		args[4] = tcu::callTraceArg(level);
+	}
 	m_gl.framebufferTexture1D(target, attachment, textarget, texture, level);
 }
 
@@ -1219,6 +2489,15 @@ void CallLogWrapper::glFramebufferTexture2D (glw::GLenum target, glw::GLenum att
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferTexture2D(" << getFramebufferTargetStr(target) << ", " << getFramebufferAttachmentStr(attachment) << ", " << getTextureTargetStr(textarget) << ", " << texture << ", " << level << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(170, 5);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(attachment);
+		args[2] = tcu::callTraceArg(textarget);
+		args[3] = tcu::callTraceArg(texture);
+		args[4] = tcu::callTraceArg(level);
+	}
 	m_gl.framebufferTexture2D(target, attachment, textarget, texture, level);
 }
 
@@ -1226,6 +2505,16 @@ void CallLogWrapper::glFramebufferTexture3D (glw::GLenum target, glw::GLenum att
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferTexture3D(" << toHex(target) << ", " << toHex(attachment) << ", " << toHex(textarget) << ", " << texture << ", " << level << ", " << zoffset << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(171, 6);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(attachment);
+		args[2] = tcu::callTraceArg(textarget);
+		args[3] = tcu::callTraceArg(texture);
+		args[4] = tcu::callTraceArg(level);
+		args[5] = tcu::callTraceArg(zoffset);
+	}
 	m_gl.framebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
 }
 
@@ -1233,6 +2522,15 @@ void CallLogWrapper::glFramebufferTextureLayer (glw::GLenum target, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFramebufferTextureLayer(" << getFramebufferTargetStr(target) << ", " << getFramebufferAttachmentStr(attachment) << ", " << texture << ", " << level << ", " << layer << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(172, 5);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(attachment);
+		args[2] = tcu::callTraceArg(texture);
+		args[3] = tcu::callTraceArg(level);
+		args[4] = tcu::callTraceArg(layer);
+	}
 	m_gl.framebufferTextureLayer(target, attachment, texture, level, layer);
 }
 
@@ -1240,6 +2538,11 @@ void CallLogWrapper::glFrontFace (glw::GLenum mode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glFrontFace(" << getWindingStr(mode) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(173, 1);
+		args[0] = tcu::callTraceArg(mode);
+	}
 	m_gl.frontFace(mode);
 }
 
@@ -1247,6 +2550,12 @@ void CallLogWrapper::glGenBuffers (glw::GLsizei n, glw::GLuint *buffers)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenBuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(174, 2);
+		args[0] = tcu::callTraceArg(n);
+		args[1] = tcu::callTraceArg(buffers);
+	}
 	m_gl.genBuffers(n, buffers);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// buffers = " << getPointerStr(buffers, n) << TestLog::EndMessage;
@@ -1256,6 +2565,12 @@ void CallLogWrapper::glGenFramebuffers (glw::GLsizei n, glw::GLuint *framebuffer
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenFramebuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(framebuffers))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(175, 2);
+		args[0] = tcu::callTraceArg(n);
+		args[1] = tcu::callTraceArg(framebuffers);
+	}
 	m_gl.genFramebuffers(n, framebuffers);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// framebuffers = " << getPointerStr(framebuffers, n) << TestLog::EndMessage;
@@ -1265,6 +2580,12 @@ void CallLogWrapper::glGenProgramPipelines (glw::GLsizei n, glw::GLuint *pipelin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenProgramPipelines(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pipelines))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(176, 2);
+		args[0] = tcu::callTraceArg(n);
+		args[1] = tcu::callTraceArg(pipelines);
+	}
 	m_gl.genProgramPipelines(n, pipelines);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// pipelines = " << getPointerStr(pipelines, n) << TestLog::EndMessage;
@@ -1274,6 +2595,12 @@ void CallLogWrapper::glGenQueries (glw::GLsizei n, glw::GLuint *ids)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenQueries(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(177, 2);
+		args[0] = tcu::callTraceArg(n);
+		args[1] = tcu::callTraceArg(ids);
+	}
 	m_gl.genQueries(n, ids);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// ids = " << getPointerStr(ids, n) << TestLog::EndMessage;
@@ -1283,6 +2610,12 @@ void CallLogWrapper::glGenRenderbuffers (glw::GLsizei n, glw::GLuint *renderbuff
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenRenderbuffers(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(renderbuffers))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(178, 2);
+		args[0] = tcu::callTraceArg(n);
+		args[1] = tcu::callTraceArg(renderbuffers);
+	}
 	m_gl.genRenderbuffers(n, renderbuffers);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// renderbuffers = " << getPointerStr(renderbuffers, n) << TestLog::EndMessage;
@@ -1292,6 +2625,12 @@ void CallLogWrapper::glGenSamplers (glw::GLsizei count, glw::GLuint *samplers)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenSamplers(" << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(samplers))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(179, 2);
+		args[0] = tcu::callTraceArg(count);
+		args[1] = tcu::callTraceArg(samplers);
+	}
 	m_gl.genSamplers(count, samplers);
 }
 
@@ -1299,6 +2638,12 @@ void CallLogWrapper::glGenTextures (glw::GLsizei n, glw::GLuint *textures)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenTextures(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(textures))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(180, 2);
+		args[0] = tcu::callTraceArg(n);
+		args[1] = tcu::callTraceArg(textures);
+	}
 	m_gl.genTextures(n, textures);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// textures = " << getPointerStr(textures, n) << TestLog::EndMessage;
@@ -1308,6 +2653,12 @@ void CallLogWrapper::glGenTransformFeedbacks (glw::GLsizei n, glw::GLuint *ids)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenTransformFeedbacks(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(181, 2);
+		args[0] = tcu::callTraceArg(n);
+		args[1] = tcu::callTraceArg(ids);
+	}
 	m_gl.genTransformFeedbacks(n, ids);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// ids = " << getPointerStr(ids, n) << TestLog::EndMessage;
@@ -1317,6 +2668,12 @@ void CallLogWrapper::glGenVertexArrays (glw::GLsizei n, glw::GLuint *arrays)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenVertexArrays(" << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(arrays))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(182, 2);
+		args[0] = tcu::callTraceArg(n);
+		args[1] = tcu::callTraceArg(arrays);
+	}
 	m_gl.genVertexArrays(n, arrays);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// arrays = " << getPointerStr(arrays, n) << TestLog::EndMessage;
@@ -1326,6 +2683,11 @@ void CallLogWrapper::glGenerateMipmap (glw::GLenum target)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenerateMipmap(" << getTextureTargetStr(target) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(183, 1);
+		args[0] = tcu::callTraceArg(target);
+	}
 	m_gl.generateMipmap(target);
 }
 
@@ -1333,6 +2695,11 @@ void CallLogWrapper::glGenerateTextureMipmap (glw::GLuint texture)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGenerateTextureMipmap(" << texture << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(184, 1);
+		args[0] = tcu::callTraceArg(texture);
+	}
 	m_gl.generateTextureMipmap(texture);
 }
 
@@ -1340,6 +2707,14 @@ void CallLogWrapper::glGetActiveAtomicCounterBufferiv (glw::GLuint program, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetActiveAtomicCounterBufferiv(" << program << ", " << bufferIndex << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(185, 4);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(bufferIndex);
+		args[2] = tcu::callTraceArg(pname);
+		args[3] = tcu::callTraceArg(params);
+	}
 	m_gl.getActiveAtomicCounterBufferiv(program, bufferIndex, pname, params);
 }
 
@@ -1347,6 +2722,17 @@ void CallLogWrapper::glGetActiveAttrib (glw::GLuint program, glw::GLuint index,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetActiveAttrib(" << program << ", " << index << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(size))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(type))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(186, 7);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(index);
+		args[2] = tcu::callTraceArg(bufSize);
+		args[3] = tcu::callTraceArg(length);
+		args[4] = tcu::callTraceArg(size);
+		args[5] = tcu::callTraceArg(type);
+		args[6] = tcu::callTraceArg(name);
+	}
 	m_gl.getActiveAttrib(program, index, bufSize, length, size, type, name);
 }
 
@@ -1354,6 +2740,16 @@ void CallLogWrapper::glGetActiveSubroutineName (glw::GLuint program, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetActiveSubroutineName(" << program << ", " << toHex(shadertype) << ", " << index << ", " << bufsize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(187, 6);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(shadertype);
+		args[2] = tcu::callTraceArg(index);
+		args[3] = tcu::callTraceArg(bufsize);
+		args[4] = tcu::callTraceArg(length);
+		args[5] = tcu::callTraceArg(name);
+	}
 	m_gl.getActiveSubroutineName(program, shadertype, index, bufsize, length, name);
 }
 
@@ -1361,6 +2757,16 @@ void CallLogWrapper::glGetActiveSubroutineUniformName (glw::GLuint program, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetActiveSubroutineUniformName(" << program << ", " << toHex(shadertype) << ", " << index << ", " << bufsize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(188, 6);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(shadertype);
+		args[2] = tcu::callTraceArg(index);
+		args[3] = tcu::callTraceArg(bufsize);
+		args[4] = tcu::callTraceArg(length);
+		args[5] = tcu::callTraceArg(name);
+	}
 	m_gl.getActiveSubroutineUniformName(program, shadertype, index, bufsize, length, name);
 }
 
@@ -1368,6 +2774,15 @@ void CallLogWrapper::glGetActiveSubroutineUniformiv (glw::GLuint program, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetActiveSubroutineUniformiv(" << program << ", " << toHex(shadertype) << ", " << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(values))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(189, 5);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(shadertype);
+		args[2] = tcu::callTraceArg(index);
+		args[3] = tcu::callTraceArg(pname);
+		args[4] = tcu::callTraceArg(values);
+	}
 	m_gl.getActiveSubroutineUniformiv(program, shadertype, index, pname, values);
 }
 
@@ -1375,6 +2790,17 @@ void CallLogWrapper::glGetActiveUniform (glw::GLuint program, glw::GLuint index,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetActiveUniform(" << program << ", " << index << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(size))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(type))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(190, 7);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(index);
+		args[2] = tcu::callTraceArg(bufSize);
+		args[3] = tcu::callTraceArg(length);
+		args[4] = tcu::callTraceArg(size);
+		args[5] = tcu::callTraceArg(type);
+		args[6] = tcu::callTraceArg(name);
+	}
 	m_gl.getActiveUniform(program, index, bufSize, length, size, type, name);
 	if (m_enableLog)
 	{
@@ -1389,6 +2815,15 @@ void CallLogWrapper::glGetActiveUniformBlockName (glw::GLuint program, glw::GLui
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetActiveUniformBlockName(" << program << ", " << uniformBlockIndex << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(uniformBlockName))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(191, 5);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(uniformBlockIndex);
+		args[2] = tcu::callTraceArg(bufSize);
+		args[3] = tcu::callTraceArg(length);
+		args[4] = tcu::callTraceArg(uniformBlockName);
+	}
 	m_gl.getActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
 }
 
@@ -1396,6 +2831,14 @@ void CallLogWrapper::glGetActiveUniformBlockiv (glw::GLuint program, glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetActiveUniformBlockiv(" << program << ", " << uniformBlockIndex << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(192, 4);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(uniformBlockIndex);
+		args[2] = tcu::callTraceArg(pname);
+		args[3] = tcu::callTraceArg(params);
+	}
 	m_gl.getActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
 }
 
@@ -1403,6 +2846,15 @@ void CallLogWrapper::glGetActiveUniformName (glw::GLuint program, glw::GLuint un
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetActiveUniformName(" << program << ", " << uniformIndex << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(uniformName))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(193, 5);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(uniformIndex);
+		args[2] = tcu::callTraceArg(bufSize);
+		args[3] = tcu::callTraceArg(length);
+		args[4] = tcu::callTraceArg(uniformName);
+	}
 	m_gl.getActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
 }
 
@@ -1410,6 +2862,15 @@ void CallLogWrapper::glGetActiveUniformsiv (glw::GLuint program, glw::GLsizei un
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetActiveUniformsiv(" << program << ", " << uniformCount << ", " << getPointerStr(uniformIndices, uniformCount) << ", " << getUniformParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(194, 5);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(uniformCount);
+		args[2] = tcu::callTraceArg(uniformIndices);
+		args[3] = tcu::callTraceArg(pname);
+		args[4] = tcu::callTraceArg(params);
+	}
 	m_gl.getActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, uniformCount) << TestLog::EndMessage;
@@ -1419,6 +2880,14 @@ void CallLogWrapper::glGetAttachedShaders (glw::GLuint program, glw::GLsizei max
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetAttachedShaders(" << program << ", " << maxCount << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(count))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(shaders))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(195, 4);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(maxCount);
+		args[2] = tcu::callTraceArg(count);
+		args[3] = tcu::callTraceArg(shaders);
+	}
 	m_gl.getAttachedShaders(program, maxCount, count, shaders);
 }
 
@@ -1426,6 +2895,12 @@ glw::GLint CallLogWrapper::glGetAttribLocation (glw::GLuint program, const glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetAttribLocation(" << program << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(196, 2);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(name);
+	}
 	glw::GLint returnValue = m_gl.getAttribLocation(program, name);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -1436,6 +2911,13 @@ void CallLogWrapper::glGetBooleani_v (glw::GLenum target, glw::GLuint index, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetBooleani_v(" << getGettableIndexedStateStr(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(197, 3);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(index);
+		args[2] = tcu::callTraceArg(data);
+	}
 	m_gl.getBooleani_v(target, index, data);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// data = " << getBooleanPointerStr(data, getIndexedQueryNumArgsOut(target)) << TestLog::EndMessage;
@@ -1445,6 +2927,12 @@ void CallLogWrapper::glGetBooleanv (glw::GLenum pname, glw::GLboolean *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetBooleanv(" << getGettableStateStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(198, 2);
+		args[0] = tcu::callTraceArg(pname);
+		args[1] = tcu::callTraceArg(data);
+	}
 	m_gl.getBooleanv(pname, data);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// data = " << getBooleanPointerStr(data, getBasicQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -1454,6 +2942,13 @@ void CallLogWrapper::glGetBufferParameteri64v (glw::GLenum target, glw::GLenum p
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetBufferParameteri64v(" << getBufferTargetStr(target) << ", " << getBufferQueryStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(199, 3);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.getBufferParameteri64v(target, pname, params);
 }
 
@@ -1461,6 +2956,13 @@ void CallLogWrapper::glGetBufferParameteriv (glw::GLenum target, glw::GLenum pna
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetBufferParameteriv(" << getBufferTargetStr(target) << ", " << getBufferQueryStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(200, 3);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.getBufferParameteriv(target, pname, params);
 }
 
@@ -1468,6 +2970,13 @@ void CallLogWrapper::glGetBufferPointerv (glw::GLenum target, glw::GLenum pname,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetBufferPointerv(" << toHex(target) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(201, 3);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.getBufferPointerv(target, pname, params);
 }
 
@@ -1475,6 +2984,14 @@ void CallLogWrapper::glGetBufferSubData (glw::GLenum target, glw::GLintptr offse
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetBufferSubData(" << toHex(target) << ", " << offset << ", " << size << ", " << data << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(202, 4);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(offset);
+		args[2] = tcu::callTraceArg(size);
+		args[3] = tcu::callTraceArg(data);
+	}
 	m_gl.getBufferSubData(target, offset, size, data);
 }
 
@@ -1482,6 +2999,13 @@ void CallLogWrapper::glGetCompressedTexImage (glw::GLenum target, glw::GLint lev
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetCompressedTexImage(" << toHex(target) << ", " << level << ", " << img << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(203, 3);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(level);
+		args[2] = tcu::callTraceArg(img);
+	}
 	m_gl.getCompressedTexImage(target, level, img);
 }
 
@@ -1489,6 +3013,14 @@ void CallLogWrapper::glGetCompressedTextureImage (glw::GLuint texture, glw::GLin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetCompressedTextureImage(" << texture << ", " << level << ", " << bufSize << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(204, 4);
+		args[0] = tcu::callTraceArg(texture);
+		args[1] = tcu::callTraceArg(level);
+		args[2] = tcu::callTraceArg(bufSize);
+		args[3] = tcu::callTraceArg(pixels);
+	}
 	m_gl.getCompressedTextureImage(texture, level, bufSize, pixels);
 }
 
@@ -1496,6 +3028,20 @@ void CallLogWrapper::glGetCompressedTextureSubImage (glw::GLuint texture, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetCompressedTextureSubImage(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << bufSize << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(205, 10);
+		args[0] = tcu::callTraceArg(texture);
+		args[1] = tcu::callTraceArg(level);
+		args[2] = tcu::callTraceArg(xoffset);
+		args[3] = tcu::callTraceArg(yoffset);
+		args[4] = tcu::callTraceArg(zoffset);
+		args[5] = tcu::callTraceArg(width);
+		args[6] = tcu::callTraceArg(height);
+		args[7] = tcu::callTraceArg(depth);
+		args[8] = tcu::callTraceArg(bufSize);
+		args[9] = tcu::callTraceArg(pixels);
+	}
 	m_gl.getCompressedTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels);
 }
 
@@ -1503,6 +3049,18 @@ glw::GLuint CallLogWrapper::glGetDebugMessageLog (glw::GLuint count, glw::GLsize
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetDebugMessageLog(" << count << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(sources))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(types))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(ids))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(severities))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(lengths))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(messageLog))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(206, 8);
+		args[0] = tcu::callTraceArg(count);
+		args[1] = tcu::callTraceArg(bufSize);
+		args[2] = tcu::callTraceArg(sources);
+		args[3] = tcu::callTraceArg(types);
+		args[4] = tcu::callTraceArg(ids);
+		args[5] = tcu::callTraceArg(severities);
+		args[6] = tcu::callTraceArg(lengths);
+		args[7] = tcu::callTraceArg(messageLog);
+	}
 	glw::GLuint returnValue = m_gl.getDebugMessageLog(count, bufSize, sources, types, ids, severities, lengths, messageLog);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -1513,6 +3071,13 @@ void CallLogWrapper::glGetDoublei_v (glw::GLenum target, glw::GLuint index, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetDoublei_v(" << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(207, 3);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(index);
+		args[2] = tcu::callTraceArg(data);
+	}
 	m_gl.getDoublei_v(target, index, data);
 }
 
@@ -1520,6 +3085,12 @@ void CallLogWrapper::glGetDoublev (glw::GLenum pname, glw::GLdouble *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetDoublev(" << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(208, 2);
+		args[0] = tcu::callTraceArg(pname);
+		args[1] = tcu::callTraceArg(data);
+	}
 	m_gl.getDoublev(pname, data);
 }
 
@@ -1527,6 +3098,8 @@ glw::GLenum CallLogWrapper::glGetError (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetError(" << ");" << TestLog::EndMessage;
+	if (m_trace)
+		m_trace->recordCall(209, 0);
 	glw::GLenum returnValue = m_gl.getError();
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getErrorStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -1537,6 +3110,13 @@ void CallLogWrapper::glGetFloati_v (glw::GLenum target, glw::GLuint index, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetFloati_v(" << toHex(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(210, 3);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(index);
+		args[2] = tcu::callTraceArg(data);
+	}
 	m_gl.getFloati_v(target, index, data);
 }
 
@@ -1544,6 +3124,12 @@ void CallLogWrapper::glGetFloatv (glw::GLenum pname, glw::GLfloat *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetFloatv(" << getGettableStateStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(211, 2);
+		args[0] = tcu::callTraceArg(pname);
+		args[1] = tcu::callTraceArg(data);
+	}
 	m_gl.getFloatv(pname, data);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// data = " << getPointerStr(data, getBasicQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -1553,6 +3139,12 @@ glw::GLint CallLogWrapper::glGetFragDataIndex (glw::GLuint program, const glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetFragDataIndex(" << program << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(212, 2);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(name);
+	}
 	glw::GLint returnValue = m_gl.getFragDataIndex(program, name);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -1563,6 +3155,12 @@ glw::GLint CallLogWrapper::glGetFragDataLocation (glw::GLuint program, const glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetFragDataLocation(" << program << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(213, 2);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(name);
+	}
 	glw::GLint returnValue = m_gl.getFragDataLocation(program, name);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -1573,6 +3171,14 @@ void CallLogWrapper::glGetFramebufferAttachmentParameteriv (glw::GLenum target,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetFramebufferAttachmentParameteriv(" << getFramebufferTargetStr(target) << ", " << getFramebufferAttachmentStr(attachment) << ", " << getFramebufferAttachmentParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(214, 4);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(attachment);
+		args[2] = tcu::callTraceArg(pname);
+		args[3] = tcu::callTraceArg(params);
+	}
 	m_gl.getFramebufferAttachmentParameteriv(target, attachment, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getFramebufferAttachmentParameterValueStr(pname, params) << TestLog::EndMessage;
@@ -1582,6 +3188,13 @@ void CallLogWrapper::glGetFramebufferParameteriv (glw::GLenum target, glw::GLenu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetFramebufferParameteriv(" << getFramebufferTargetStr(target) << ", " << getFramebufferParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(215, 3);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.getFramebufferParameteriv(target, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
@@ -1591,6 +3204,8 @@ glw::GLenum CallLogWrapper::glGetGraphicsResetStatus (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetGraphicsResetStatus(" << ");" << TestLog::EndMessage;
+	if (m_trace)
+		m_trace->recordCall(216, 0);
 	glw::GLenum returnValue = m_gl.getGraphicsResetStatus();
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << toHex(returnValue) << " returned" << TestLog::EndMessage;
@@ -1601,6 +3216,13 @@ void CallLogWrapper::glGetInteger64i_v (glw::GLenum target, glw::GLuint index, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetInteger64i_v(" << getGettableIndexedStateStr(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(217, 3);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(index);
+		args[2] = tcu::callTraceArg(data);
+	}
 	m_gl.getInteger64i_v(target, index, data);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// data = " << getPointerStr(data, getIndexedQueryNumArgsOut(target)) << TestLog::EndMessage;
@@ -1610,6 +3232,12 @@ void CallLogWrapper::glGetInteger64v (glw::GLenum pname, glw::GLint64 *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetInteger64v(" << getGettableStateStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(218, 2);
+		args[0] = tcu::callTraceArg(pname);
+		args[1] = tcu::callTraceArg(data);
+	}
 	m_gl.getInteger64v(pname, data);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// data = " << getPointerStr(data, getBasicQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -1619,6 +3247,13 @@ void CallLogWrapper::glGetIntegeri_v (glw::GLenum target, glw::GLuint index, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetIntegeri_v(" << getGettableIndexedStateStr(target) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(219, 3);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(index);
+		args[2] = tcu::callTraceArg(data);
+	}
 	m_gl.getIntegeri_v(target, index, data);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// data = " << getPointerStr(data, getIndexedQueryNumArgsOut(target)) << TestLog::EndMessage;
@@ -1628,6 +3263,12 @@ void CallLogWrapper::glGetIntegerv (glw::GLenum pname, glw::GLint *data)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetIntegerv(" << getGettableStateStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(data))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(220, 2);
+		args[0] = tcu::callTraceArg(pname);
+		args[1] = tcu::callTraceArg(data);
+	}
 	m_gl.getIntegerv(pname, data);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// data = " << getPointerStr(data, getBasicQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -1637,6 +3278,15 @@ void CallLogWrapper::glGetInternalformati64v (glw::GLenum target, glw::GLenum in
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetInternalformati64v(" << toHex(target) << ", " << toHex(internalformat) << ", " << toHex(pname) << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(221, 5);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(internalformat);
+		args[2] = tcu::callTraceArg(pname);
+		args[3] = tcu::callTraceArg(bufSize);
+		args[4] = tcu::callTraceArg(params);
+	}
 	m_gl.getInternalformati64v(target, internalformat, pname, bufSize, params);
 }
 
@@ -1644,6 +3294,15 @@ void CallLogWrapper::glGetInternalformativ (glw::GLenum target, glw::GLenum inte
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetInternalformativ(" << getInternalFormatTargetStr(target) << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << getInternalFormatParameterStr(pname) << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(222, 5);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(internalformat);
+		args[2] = tcu::callTraceArg(pname);
+		args[3] = tcu::callTraceArg(bufSize);
+		args[4] = tcu::callTraceArg(params);
+	}
 	m_gl.getInternalformativ(target, internalformat, pname, bufSize, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, bufSize) << TestLog::EndMessage;
@@ -1653,6 +3312,13 @@ void CallLogWrapper::glGetMultisamplefv (glw::GLenum pname, glw::GLuint index, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetMultisamplefv(" << getMultisampleParameterStr(pname) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(val))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(223, 3);
+		args[0] = tcu::callTraceArg(pname);
+		args[1] = tcu::callTraceArg(index);
+		args[2] = tcu::callTraceArg(val);
+	}
 	m_gl.getMultisamplefv(pname, index, val);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// val = " << getPointerStr(val, 2) << TestLog::EndMessage;
@@ -1662,6 +3328,13 @@ void CallLogWrapper::glGetNamedBufferParameteri64v (glw::GLuint buffer, glw::GLe
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedBufferParameteri64v(" << buffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(224, 3);
+		args[0] = tcu::callTraceArg(buffer);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.getNamedBufferParameteri64v(buffer, pname, params);
 }
 
@@ -1669,6 +3342,13 @@ void CallLogWrapper::glGetNamedBufferParameteriv (glw::GLuint buffer, glw::GLenu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedBufferParameteriv(" << buffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(225, 3);
+		args[0] = tcu::callTraceArg(buffer);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.getNamedBufferParameteriv(buffer, pname, params);
 }
 
@@ -1676,6 +3356,13 @@ void CallLogWrapper::glGetNamedBufferPointerv (glw::GLuint buffer, glw::GLenum p
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedBufferPointerv(" << buffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(226, 3);
+		args[0] = tcu::callTraceArg(buffer);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.getNamedBufferPointerv(buffer, pname, params);
 }
 
@@ -1683,6 +3370,14 @@ void CallLogWrapper::glGetNamedBufferSubData (glw::GLuint buffer, glw::GLintptr
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedBufferSubData(" << buffer << ", " << offset << ", " << size << ", " << data << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(227, 4);
+		args[0] = tcu::callTraceArg(buffer);
+		args[1] = tcu::callTraceArg(offset);
+		args[2] = tcu::callTraceArg(size);
+		args[3] = tcu::callTraceArg(data);
+	}
 	m_gl.getNamedBufferSubData(buffer, offset, size, data);
 }
 
@@ -1690,6 +3385,14 @@ void CallLogWrapper::glGetNamedFramebufferAttachmentParameteriv (glw::GLuint fra
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedFramebufferAttachmentParameteriv(" << framebuffer << ", " << toHex(attachment) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(228, 4);
+		args[0] = tcu::callTraceArg(framebuffer);
+		args[1] = tcu::callTraceArg(attachment);
+		args[2] = tcu::callTraceArg(pname);
+		args[3] = tcu::callTraceArg(params);
+	}
 	m_gl.getNamedFramebufferAttachmentParameteriv(framebuffer, attachment, pname, params);
 }
 
@@ -1697,6 +3400,13 @@ void CallLogWrapper::glGetNamedFramebufferParameteriv (glw::GLuint framebuffer,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedFramebufferParameteriv(" << framebuffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(229, 3);
+		args[0] = tcu::callTraceArg(framebuffer);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(param);
+	}
 	m_gl.getNamedFramebufferParameteriv(framebuffer, pname, param);
 }
 
@@ -1704,6 +3414,13 @@ void CallLogWrapper::glGetNamedRenderbufferParameteriv (glw::GLuint renderbuffer
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetNamedRenderbufferParameteriv(" << renderbuffer << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(230, 3);
+		args[0] = tcu::callTraceArg(renderbuffer);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.getNamedRenderbufferParameteriv(renderbuffer, pname, params);
 }
 
@@ -1711,6 +3428,15 @@ void CallLogWrapper::glGetObjectLabel (glw::GLenum identifier, glw::GLuint name,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetObjectLabel(" << toHex(identifier) << ", " << name << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(label))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(231, 5);
+		args[0] = tcu::callTraceArg(identifier);
+		args[1] = tcu::callTraceArg(name);
+		args[2] = tcu::callTraceArg(bufSize);
+		args[3] = tcu::callTraceArg(length);
+		args[4] = tcu::callTraceArg(label);
+	}
 	m_gl.getObjectLabel(identifier, name, bufSize, length, label);
 }
 
@@ -1718,6 +3444,14 @@ void CallLogWrapper::glGetObjectPtrLabel (const void *ptr, glw::GLsizei bufSize,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetObjectPtrLabel(" << ptr << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(label))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(232, 4);
+		args[0] = tcu::callTraceArg(ptr);
+		args[1] = tcu::callTraceArg(bufSize);
+		args[2] = tcu::callTraceArg(length);
+		args[3] = tcu::callTraceArg(label);
+	}
 	m_gl.getObjectPtrLabel(ptr, bufSize, length, label);
 }
 
@@ -1725,6 +3459,12 @@ void CallLogWrapper::glGetPointerv (glw::GLenum pname, void **params)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetPointerv(" << getPointerStateStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(233, 2);
+		args[0] = tcu::callTraceArg(pname);
+		args[1] = tcu::callTraceArg(params);
+	}
 	m_gl.getPointerv(pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
@@ -1734,6 +3474,15 @@ void CallLogWrapper::glGetProgramBinary (glw::GLuint program, glw::GLsizei bufSi
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramBinary(" << program << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(binaryFormat))) << ", " << binary << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(234, 5);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(bufSize);
+		args[2] = tcu::callTraceArg(length);
+		args[3] = tcu::callTraceArg(binaryFormat);
+		args[4] = tcu::callTraceArg(binary);
+	}
 	m_gl.getProgramBinary(program, bufSize, length, binaryFormat, binary);
 }
 
@@ -1741,6 +3490,14 @@ void CallLogWrapper::glGetProgramInfoLog (glw::GLuint program, glw::GLsizei bufS
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramInfoLog(" << program << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(infoLog))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(235, 4);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(bufSize);
+		args[2] = tcu::callTraceArg(length);
+		args[3] = tcu::callTraceArg(infoLog);
+	}
 	m_gl.getProgramInfoLog(program, bufSize, length, infoLog);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// length = " << getPointerStr(length, 1) << TestLog::EndMessage;
@@ -1750,6 +3507,14 @@ void CallLogWrapper::glGetProgramInterfaceiv (glw::GLuint program, glw::GLenum p
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramInterfaceiv(" << program << ", " << toHex(programInterface) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(236, 4);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(programInterface);
+		args[2] = tcu::callTraceArg(pname);
+		args[3] = tcu::callTraceArg(params);
+	}
 	m_gl.getProgramInterfaceiv(program, programInterface, pname, params);
 }
 
@@ -1757,6 +3522,14 @@ void CallLogWrapper::glGetProgramPipelineInfoLog (glw::GLuint pipeline, glw::GLs
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramPipelineInfoLog(" << pipeline << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(infoLog))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(237, 4);
+		args[0] = tcu::callTraceArg(pipeline);
+		args[1] = tcu::callTraceArg(bufSize);
+		args[2] = tcu::callTraceArg(length);
+		args[3] = tcu::callTraceArg(infoLog);
+	}
 	m_gl.getProgramPipelineInfoLog(pipeline, bufSize, length, infoLog);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// length = " << getPointerStr(length, 1) << TestLog::EndMessage;
@@ -1766,6 +3539,13 @@ void CallLogWrapper::glGetProgramPipelineiv (glw::GLuint pipeline, glw::GLenum p
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramPipelineiv(" << pipeline << ", " << getPipelineParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(238, 3);
+		args[0] = tcu::callTraceArg(pipeline);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.getProgramPipelineiv(pipeline, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
@@ -1775,6 +3555,13 @@ glw::GLuint CallLogWrapper::glGetProgramResourceIndex (glw::GLuint program, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramResourceIndex(" << program << ", " << getProgramInterfaceStr(programInterface) << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(239, 3);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(programInterface);
+		args[2] = tcu::callTraceArg(name);
+	}
 	glw::GLuint returnValue = m_gl.getProgramResourceIndex(program, programInterface, name);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -1785,6 +3572,13 @@ glw::GLint CallLogWrapper::glGetProgramResourceLocation (glw::GLuint program, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramResourceLocation(" << program << ", " << toHex(programInterface) << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(240, 3);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(programInterface);
+		args[2] = tcu::callTraceArg(name);
+	}
 	glw::GLint returnValue = m_gl.getProgramResourceLocation(program, programInterface, name);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -1795,6 +3589,13 @@ glw::GLint CallLogWrapper::glGetProgramResourceLocationIndex (glw::GLuint progra
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramResourceLocationIndex(" << program << ", " << toHex(programInterface) << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(241, 3);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(programInterface);
+		args[2] = tcu::callTraceArg(name);
+	}
 	glw::GLint returnValue = m_gl.getProgramResourceLocationIndex(program, programInterface, name);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -1805,6 +3606,16 @@ void CallLogWrapper::glGetProgramResourceName (glw::GLuint program, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramResourceName(" << program << ", " << toHex(programInterface) << ", " << index << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(242, 6);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(programInterface);
+		args[2] = tcu::callTraceArg(index);
+		args[3] = tcu::callTraceArg(bufSize);
+		args[4] = tcu::callTraceArg(length);
+		args[5] = tcu::callTraceArg(name);
+	}
 	m_gl.getProgramResourceName(program, programInterface, index, bufSize, length, name);
 }
 
@@ -1812,6 +3623,18 @@ void CallLogWrapper::glGetProgramResourceiv (glw::GLuint program, glw::GLenum pr
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramResourceiv(" << program << ", " << getProgramInterfaceStr(programInterface) << ", " << index << ", " << propCount << ", " << getEnumPointerStr(props, propCount, getProgramResourcePropertyName) << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(243, 8);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(programInterface);
+		args[2] = tcu::callTraceArg(index);
+		args[3] = tcu::callTraceArg(propCount);
+		args[4] = tcu::callTraceArg(props);
+		args[5] = tcu::callTraceArg(bufSize);
+		args[6] = tcu::callTraceArg(length);
+		args[7] = tcu::callTraceArg(params);
+	}
 	m_gl.getProgramResourceiv(program, programInterface, index, propCount, props, bufSize, length, params);
 	if (m_enableLog)
 	{
@@ -1824,6 +3647,14 @@ void CallLogWrapper::glGetProgramStageiv (glw::GLuint program, glw::GLenum shade
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramStageiv(" << program << ", " << toHex(shadertype) << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(values))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(244, 4);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(shadertype);
+		args[2] = tcu::callTraceArg(pname);
+		args[3] = tcu::callTraceArg(values);
+	}
 	m_gl.getProgramStageiv(program, shadertype, pname, values);
 }
 
@@ -1831,6 +3662,13 @@ void CallLogWrapper::glGetProgramiv (glw::GLuint program, glw::GLenum pname, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetProgramiv(" << program << ", " << getProgramParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(245, 3);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.getProgramiv(program, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getProgramQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -1840,6 +3678,14 @@ void CallLogWrapper::glGetQueryBufferObjecti64v (glw::GLuint id, glw::GLuint buf
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetQueryBufferObjecti64v(" << id << ", " << buffer << ", " << toHex(pname) << ", " << offset << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(246, 4);
+		args[0] = tcu::callTraceArg(id);
+		args[1] = tcu::callTraceArg(buffer);
+		args[2] = tcu::callTraceArg(pname);
+		args[3] = tcu::callTraceArg(offset);
+	}
 	m_gl.getQueryBufferObjecti64v(id, buffer, pname, offset);
 }
 
@@ -1847,6 +3693,14 @@ void CallLogWrapper::glGetQueryBufferObjectiv (glw::GLuint id, glw::GLuint buffe
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetQueryBufferObjectiv(" << id << ", " << buffer << ", " << toHex(pname) << ", " << offset << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(247, 4);
+		args[0] = tcu::callTraceArg(id);
+		args[1] = tcu::callTraceArg(buffer);
+		args[2] = tcu::callTraceArg(pname);
+		args[3] = tcu::callTraceArg(offset);
+	}
 	m_gl.getQueryBufferObjectiv(id, buffer, pname, offset);
 }
 
@@ -1854,6 +3708,14 @@ void CallLogWrapper::glGetQueryBufferObjectui64v (glw::GLuint id, glw::GLuint bu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetQueryBufferObjectui64v(" << id << ", " << buffer << ", " << toHex(pname) << ", " << offset << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(248, 4);
+		args[0] = tcu::callTraceArg(id);
+		args[1] = tcu::callTraceArg(buffer);
+		args[2] = tcu::callTraceArg(pname);
+		args[3] = tcu::callTraceArg(offset);
+	}
 	m_gl.getQueryBufferObjectui64v(id, buffer, pname, offset);
 }
 
@@ -1861,6 +3723,14 @@ void CallLogWrapper::glGetQueryBufferObjectuiv (glw::GLuint id, glw::GLuint buff
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetQueryBufferObjectuiv(" << id << ", " << buffer << ", " << toHex(pname) << ", " << offset << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(249, 4);
+		args[0] = tcu::callTraceArg(id);
+		args[1] = tcu::callTraceArg(buffer);
+		args[2] = tcu::callTraceArg(pname);
+		args[3] = tcu::callTraceArg(offset);
+	}
 	m_gl.getQueryBufferObjectuiv(id, buffer, pname, offset);
 }
 
@@ -1868,6 +3738,14 @@ void CallLogWrapper::glGetQueryIndexediv (glw::GLenum target, glw::GLuint index,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetQueryIndexediv(" << toHex(target) << ", " << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(250, 4);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(index);
+		args[2] = tcu::callTraceArg(pname);
+		args[3] = tcu::callTraceArg(params);
+	}
 	m_gl.getQueryIndexediv(target, index, pname, params);
 }
 
@@ -1875,6 +3753,13 @@ void CallLogWrapper::glGetQueryObjecti64v (glw::GLuint id, glw::GLenum pname, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetQueryObjecti64v(" << id << ", " << getQueryObjectParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(251, 3);
+		args[0] = tcu::callTraceArg(id);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.getQueryObjecti64v(id, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
@@ -1884,6 +3769,13 @@ void CallLogWrapper::glGetQueryObjectiv (glw::GLuint id, glw::GLenum pname, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetQueryObjectiv(" << id << ", " << getQueryObjectParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(252, 3);
+		args[0] = tcu::callTraceArg(id);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.getQueryObjectiv(id, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
@@ -1893,6 +3785,13 @@ void CallLogWrapper::glGetQueryObjectui64v (glw::GLuint id, glw::GLenum pname, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetQueryObjectui64v(" << id << ", " << getQueryObjectParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(253, 3);
+		args[0] = tcu::callTraceArg(id);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.getQueryObjectui64v(id, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
@@ -1902,6 +3801,13 @@ void CallLogWrapper::glGetQueryObjectuiv (glw::GLuint id, glw::GLenum pname, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetQueryObjectuiv(" << id << ", " << getQueryObjectParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(254, 3);
+		args[0] = tcu::callTraceArg(id);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.getQueryObjectuiv(id, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
@@ -1911,6 +3817,13 @@ void CallLogWrapper::glGetQueryiv (glw::GLenum target, glw::GLenum pname, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetQueryiv(" << getQueryTargetStr(target) << ", " << getQueryParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(255, 3);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.getQueryiv(target, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
@@ -1920,6 +3833,13 @@ void CallLogWrapper::glGetRenderbufferParameteriv (glw::GLenum target, glw::GLen
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetRenderbufferParameteriv(" << getFramebufferTargetStr(target) << ", " << getRenderbufferParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(256, 3);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.getRenderbufferParameteriv(target, pname, params);
 }
 
@@ -1927,6 +3847,13 @@ void CallLogWrapper::glGetSamplerParameterIiv (glw::GLuint sampler, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetSamplerParameterIiv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(257, 3);
+		args[0] = tcu::callTraceArg(sampler);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.getSamplerParameterIiv(sampler, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getTextureParamQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -1936,6 +3863,13 @@ void CallLogWrapper::glGetSamplerParameterIuiv (glw::GLuint sampler, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetSamplerParameterIuiv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(258, 3);
+		args[0] = tcu::callTraceArg(sampler);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.getSamplerParameterIuiv(sampler, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getTextureParamQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -1945,6 +3879,13 @@ void CallLogWrapper::glGetSamplerParameterfv (glw::GLuint sampler, glw::GLenum p
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetSamplerParameterfv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(259, 3);
+		args[0] = tcu::callTraceArg(sampler);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.getSamplerParameterfv(sampler, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getTextureParamQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -1954,6 +3895,13 @@ void CallLogWrapper::glGetSamplerParameteriv (glw::GLuint sampler, glw::GLenum p
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetSamplerParameteriv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(260, 3);
+		args[0] = tcu::callTraceArg(sampler);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.getSamplerParameteriv(sampler, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getTextureParamQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -1963,6 +3911,14 @@ void CallLogWrapper::glGetShaderInfoLog (glw::GLuint shader, glw::GLsizei bufSiz
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetShaderInfoLog(" << shader << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(infoLog))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(261, 4);
+		args[0] = tcu::callTraceArg(shader);
+		args[1] = tcu::callTraceArg(bufSize);
+		args[2] = tcu::callTraceArg(length);
+		args[3] = tcu::callTraceArg(infoLog);
+	}
 	m_gl.getShaderInfoLog(shader, bufSize, length, infoLog);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// length = " << getPointerStr(length, 1) << TestLog::EndMessage;
@@ -1972,6 +3928,14 @@ void CallLogWrapper::glGetShaderPrecisionFormat (glw::GLenum shadertype, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetShaderPrecisionFormat(" << getShaderTypeStr(shadertype) << ", " << getPrecisionFormatTypeStr(precisiontype) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(range))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(precision))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(262, 4);
+		args[0] = tcu::callTraceArg(shadertype);
+		args[1] = tcu::callTraceArg(precisiontype);
+		args[2] = tcu::callTraceArg(range);
+		args[3] = tcu::callTraceArg(precision);
+	}
 	m_gl.getShaderPrecisionFormat(shadertype, precisiontype, range, precision);
 }
 
@@ -1979,6 +3943,14 @@ void CallLogWrapper::glGetShaderSource (glw::GLuint shader, glw::GLsizei bufSize
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetShaderSource(" << shader << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(source))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(263, 4);
+		args[0] = tcu::callTraceArg(shader);
+		args[1] = tcu::callTraceArg(bufSize);
+		args[2] = tcu::callTraceArg(length);
+		args[3] = tcu::callTraceArg(source);
+	}
 	m_gl.getShaderSource(shader, bufSize, length, source);
 }
 
@@ -1986,6 +3958,13 @@ void CallLogWrapper::glGetShaderiv (glw::GLuint shader, glw::GLenum pname, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetShaderiv(" << shader << ", " << getShaderParamStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(264, 3);
+		args[0] = tcu::callTraceArg(shader);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.getShaderiv(shader, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
@@ -1995,6 +3974,11 @@ const glw::GLubyte * CallLogWrapper::glGetString (glw::GLenum name)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetString(" << getGettableStringStr(name) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(265, 1);
+		args[0] = tcu::callTraceArg(name);
+	}
 	const glw::GLubyte * returnValue = m_gl.getString(name);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getStringStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -2005,6 +3989,12 @@ const glw::GLubyte * CallLogWrapper::glGetStringi (glw::GLenum name, glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetStringi(" << getGettableStringStr(name) << ", " << index << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(266, 2);
+		args[0] = tcu::callTraceArg(name);
+		args[1] = tcu::callTraceArg(index);
+	}
 	const glw::GLubyte * returnValue = m_gl.getStringi(name, index);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getStringStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -2015,6 +4005,13 @@ glw::GLuint CallLogWrapper::glGetSubroutineIndex (glw::GLuint program, glw::GLen
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetSubroutineIndex(" << program << ", " << toHex(shadertype) << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(267, 3);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(shadertype);
+		args[2] = tcu::callTraceArg(name);
+	}
 	glw::GLuint returnValue = m_gl.getSubroutineIndex(program, shadertype, name);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -2025,6 +4022,13 @@ glw::GLint CallLogWrapper::glGetSubroutineUniformLocation (glw::GLuint program,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetSubroutineUniformLocation(" << program << ", " << toHex(shadertype) << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(268, 3);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(shadertype);
+		args[2] = tcu::callTraceArg(name);
+	}
 	glw::GLint returnValue = m_gl.getSubroutineUniformLocation(program, shadertype, name);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -2035,6 +4039,15 @@ void CallLogWrapper::glGetSynciv (glw::GLsync sync, glw::GLenum pname, glw::GLsi
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetSynciv(" << sync << ", " << toHex(pname) << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(values))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(269, 5);
+		args[0] = tcu::callTraceArg(sync);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(bufSize);
+		args[3] = tcu::callTraceArg(length);
+		args[4] = tcu::callTraceArg(values);
+	}
 	m_gl.getSynciv(sync, pname, bufSize, length, values);
 }
 
@@ -2042,6 +4055,15 @@ void CallLogWrapper::glGetTexImage (glw::GLenum target, glw::GLint level, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTexImage(" << toHex(target) << ", " << level << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(270, 5);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(level);
+		args[2] = tcu::callTraceArg(format);
+		args[3] = tcu::callTraceArg(type);
+		args[4] = tcu::callTraceArg(pixels);
+	}
 	m_gl.getTexImage(target, level, format, type, pixels);
 }
 
@@ -2049,6 +4071,14 @@ void CallLogWrapper::glGetTexLevelParameterfv (glw::GLenum target, glw::GLint le
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTexLevelParameterfv(" << getTextureTargetStr(target) << ", " << level << ", " << getTextureLevelParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(271, 4);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(level);
+		args[2] = tcu::callTraceArg(pname);
+		args[3] = tcu::callTraceArg(params);
+	}
 	m_gl.getTexLevelParameterfv(target, level, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
@@ -2058,6 +4088,14 @@ void CallLogWrapper::glGetTexLevelParameteriv (glw::GLenum target, glw::GLint le
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTexLevelParameteriv(" << getTextureTargetStr(target) << ", " << level << ", " << getTextureLevelParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(272, 4);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(level);
+		args[2] = tcu::callTraceArg(pname);
+		args[3] = tcu::callTraceArg(params);
+	}
 	m_gl.getTexLevelParameteriv(target, level, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, 1) << TestLog::EndMessage;
@@ -2067,6 +4105,13 @@ void CallLogWrapper::glGetTexParameterIiv (glw::GLenum target, glw::GLenum pname
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTexParameterIiv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(273, 3);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.getTexParameterIiv(target, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getTextureParamQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -2076,6 +4121,13 @@ void CallLogWrapper::glGetTexParameterIuiv (glw::GLenum target, glw::GLenum pnam
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTexParameterIuiv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(274, 3);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.getTexParameterIuiv(target, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getTextureParamQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -2085,6 +4137,13 @@ void CallLogWrapper::glGetTexParameterfv (glw::GLenum target, glw::GLenum pname,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTexParameterfv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(275, 3);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.getTexParameterfv(target, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getTextureParamQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -2094,6 +4153,13 @@ void CallLogWrapper::glGetTexParameteriv (glw::GLenum target, glw::GLenum pname,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTexParameteriv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(276, 3);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.getTexParameteriv(target, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getTextureParamQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -2103,6 +4169,16 @@ void CallLogWrapper::glGetTextureImage (glw::GLuint texture, glw::GLint level, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureImage(" << texture << ", " << level << ", " << toHex(format) << ", " << toHex(type) << ", " << bufSize << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(277, 6);
+		args[0] = tcu::callTraceArg(texture);
+		args[1] = tcu::callTraceArg(level);
+		args[2] = tcu::callTraceArg(format);
+		args[3] = tcu::callTraceArg(type);
+		args[4] = tcu::callTraceArg(bufSize);
+		args[5] = tcu::callTraceArg(pixels);
+	}
 	m_gl.getTextureImage(texture, level, format, type, bufSize, pixels);
 }
 
@@ -2110,6 +4186,14 @@ void CallLogWrapper::glGetTextureLevelParameterfv (glw::GLuint texture, glw::GLi
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureLevelParameterfv(" << texture << ", " << level << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(278, 4);
+		args[0] = tcu::callTraceArg(texture);
+		args[1] = tcu::callTraceArg(level);
+		args[2] = tcu::callTraceArg(pname);
+		args[3] = tcu::callTraceArg(params);
+	}
 	m_gl.getTextureLevelParameterfv(texture, level, pname, params);
 }
 
@@ -2117,6 +4201,14 @@ void CallLogWrapper::glGetTextureLevelParameteriv (glw::GLuint texture, glw::GLi
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureLevelParameteriv(" << texture << ", " << level << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(279, 4);
+		args[0] = tcu::callTraceArg(texture);
+		args[1] = tcu::callTraceArg(level);
+		args[2] = tcu::callTraceArg(pname);
+		args[3] = tcu::callTraceArg(params);
+	}
 	m_gl.getTextureLevelParameteriv(texture, level, pname, params);
 }
 
@@ -2124,6 +4216,13 @@ void CallLogWrapper::glGetTextureParameterIiv (glw::GLuint texture, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureParameterIiv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(280, 3);
+		args[0] = tcu::callTraceArg(texture);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.getTextureParameterIiv(texture, pname, params);
 }
 
@@ -2131,6 +4230,13 @@ void CallLogWrapper::glGetTextureParameterIuiv (glw::GLuint texture, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureParameterIuiv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(281, 3);
+		args[0] = tcu::callTraceArg(texture);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.getTextureParameterIuiv(texture, pname, params);
 }
 
@@ -2138,6 +4244,13 @@ void CallLogWrapper::glGetTextureParameterfv (glw::GLuint texture, glw::GLenum p
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureParameterfv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(282, 3);
+		args[0] = tcu::callTraceArg(texture);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.getTextureParameterfv(texture, pname, params);
 }
 
@@ -2145,6 +4258,13 @@ void CallLogWrapper::glGetTextureParameteriv (glw::GLuint texture, glw::GLenum p
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureParameteriv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(283, 3);
+		args[0] = tcu::callTraceArg(texture);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.getTextureParameteriv(texture, pname, params);
 }
 
@@ -2152,6 +4272,22 @@ void CallLogWrapper::glGetTextureSubImage (glw::GLuint texture, glw::GLint level
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTextureSubImage(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << toHex(type) << ", " << bufSize << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(284, 12);
+		args[0] = tcu::callTraceArg(texture);
+		args[1] = tcu::callTraceArg(level);
+		args[2] = tcu::callTraceArg(xoffset);
+		args[3] = tcu::callTraceArg(yoffset);
+		args[4] = tcu::callTraceArg(zoffset);
+		args[5] = tcu::callTraceArg(width);
+		args[6] = tcu::callTraceArg(height);
+		args[7] = tcu::callTraceArg(depth);
+		args[8] = tcu::callTraceArg(format);
+		args[9] = tcu::callTraceArg(type);
+		args[10] = tcu::callTraceArg(bufSize);
+		args[11] = tcu::callTraceArg(pixels);
+	}
 	m_gl.getTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels);
 }
 
@@ -2159,6 +4295,17 @@ void CallLogWrapper::glGetTransformFeedbackVarying (glw::GLuint program, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTransformFeedbackVarying(" << program << ", " << index << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(size))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(type))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(name))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(285, 7);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(index);
+		args[2] = tcu::callTraceArg(bufSize);
+		args[3] = tcu::callTraceArg(length);
+		args[4] = tcu::callTraceArg(size);
+		args[5] = tcu::callTraceArg(type);
+		args[6] = tcu::callTraceArg(name);
+	}
 	m_gl.getTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
 }
 
@@ -2166,6 +4313,14 @@ void CallLogWrapper::glGetTransformFeedbacki64_v (glw::GLuint xfb, glw::GLenum p
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTransformFeedbacki64_v(" << xfb << ", " << toHex(pname) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(286, 4);
+		args[0] = tcu::callTraceArg(xfb);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(index);
+		args[3] = tcu::callTraceArg(param);
+	}
 	m_gl.getTransformFeedbacki64_v(xfb, pname, index, param);
 }
 
@@ -2173,6 +4328,14 @@ void CallLogWrapper::glGetTransformFeedbacki_v (glw::GLuint xfb, glw::GLenum pna
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTransformFeedbacki_v(" << xfb << ", " << toHex(pname) << ", " << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(287, 4);
+		args[0] = tcu::callTraceArg(xfb);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(index);
+		args[3] = tcu::callTraceArg(param);
+	}
 	m_gl.getTransformFeedbacki_v(xfb, pname, index, param);
 }
 
@@ -2180,6 +4343,13 @@ void CallLogWrapper::glGetTransformFeedbackiv (glw::GLuint xfb, glw::GLenum pnam
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetTransformFeedbackiv(" << xfb << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(288, 3);
+		args[0] = tcu::callTraceArg(xfb);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(param);
+	}
 	m_gl.getTransformFeedbackiv(xfb, pname, param);
 }
 
@@ -2187,6 +4357,12 @@ glw::GLuint CallLogWrapper::glGetUniformBlockIndex (glw::GLuint program, const g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetUniformBlockIndex(" << program << ", " << getStringStr(uniformBlockName) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(289, 2);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(uniformBlockName);
+	}
 	glw::GLuint returnValue = m_gl.getUniformBlockIndex(program, uniformBlockName);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -2197,6 +4373,14 @@ void CallLogWrapper::glGetUniformIndices (glw::GLuint program, glw::GLsizei unif
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetUniformIndices(" << program << ", " << uniformCount << ", " << getPointerStr(uniformNames, uniformCount) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(uniformIndices))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(290, 4);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(uniformCount);
+		args[2] = tcu::callTraceArg(uniformNames);
+		args[3] = tcu::callTraceArg(uniformIndices);
+	}
 	m_gl.getUniformIndices(program, uniformCount, uniformNames, uniformIndices);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// uniformIndices = " << getPointerStr(uniformIndices, uniformCount) << TestLog::EndMessage;
@@ -2206,6 +4390,12 @@ glw::GLint CallLogWrapper::glGetUniformLocation (glw::GLuint program, const glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetUniformLocation(" << program << ", " << getStringStr(name) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(291, 2);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(name);
+	}
 	glw::GLint returnValue = m_gl.getUniformLocation(program, name);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -2216,6 +4406,13 @@ void CallLogWrapper::glGetUniformSubroutineuiv (glw::GLenum shadertype, glw::GLi
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetUniformSubroutineuiv(" << toHex(shadertype) << ", " << location << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(292, 3);
+		args[0] = tcu::callTraceArg(shadertype);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.getUniformSubroutineuiv(shadertype, location, params);
 }
 
@@ -2223,6 +4420,13 @@ void CallLogWrapper::glGetUniformdv (glw::GLuint program, glw::GLint location, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetUniformdv(" << program << ", " << location << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(293, 3);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.getUniformdv(program, location, params);
 }
 
@@ -2230,6 +4434,13 @@ void CallLogWrapper::glGetUniformfv (glw::GLuint program, glw::GLint location, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetUniformfv(" << program << ", " << location << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(294, 3);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.getUniformfv(program, location, params);
 }
 
@@ -2237,6 +4448,13 @@ void CallLogWrapper::glGetUniformiv (glw::GLuint program, glw::GLint location, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetUniformiv(" << program << ", " << location << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(295, 3);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.getUniformiv(program, location, params);
 }
 
@@ -2244,6 +4462,13 @@ void CallLogWrapper::glGetUniformuiv (glw::GLuint program, glw::GLint location,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetUniformuiv(" << program << ", " << location << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(296, 3);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.getUniformuiv(program, location, params);
 }
 
@@ -2251,6 +4476,14 @@ void CallLogWrapper::glGetVertexArrayIndexed64iv (glw::GLuint vaobj, glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexArrayIndexed64iv(" << vaobj << ", " << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(297, 4);
+		args[0] = tcu::callTraceArg(vaobj);
+		args[1] = tcu::callTraceArg(index);
+		args[2] = tcu::callTraceArg(pname);
+		args[3] = tcu::callTraceArg(param);
+	}
 	m_gl.getVertexArrayIndexed64iv(vaobj, index, pname, param);
 }
 
@@ -2258,6 +4491,14 @@ void CallLogWrapper::glGetVertexArrayIndexediv (glw::GLuint vaobj, glw::GLuint i
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexArrayIndexediv(" << vaobj << ", " << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(298, 4);
+		args[0] = tcu::callTraceArg(vaobj);
+		args[1] = tcu::callTraceArg(index);
+		args[2] = tcu::callTraceArg(pname);
+		args[3] = tcu::callTraceArg(param);
+	}
 	m_gl.getVertexArrayIndexediv(vaobj, index, pname, param);
 }
 
@@ -2265,6 +4506,13 @@ void CallLogWrapper::glGetVertexArrayiv (glw::GLuint vaobj, glw::GLenum pname, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexArrayiv(" << vaobj << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(299, 3);
+		args[0] = tcu::callTraceArg(vaobj);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(param);
+	}
 	m_gl.getVertexArrayiv(vaobj, pname, param);
 }
 
@@ -2272,6 +4520,13 @@ void CallLogWrapper::glGetVertexAttribIiv (glw::GLuint index, glw::GLenum pname,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexAttribIiv(" << index << ", " << getVertexAttribParameterNameStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(300, 3);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.getVertexAttribIiv(index, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getAttributeQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -2281,6 +4536,13 @@ void CallLogWrapper::glGetVertexAttribIuiv (glw::GLuint index, glw::GLenum pname
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexAttribIuiv(" << index << ", " << getVertexAttribParameterNameStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(301, 3);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.getVertexAttribIuiv(index, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getAttributeQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -2290,6 +4552,13 @@ void CallLogWrapper::glGetVertexAttribLdv (glw::GLuint index, glw::GLenum pname,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexAttribLdv(" << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(302, 3);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.getVertexAttribLdv(index, pname, params);
 }
 
@@ -2297,6 +4566,13 @@ void CallLogWrapper::glGetVertexAttribPointerv (glw::GLuint index, glw::GLenum p
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexAttribPointerv(" << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(pointer))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(303, 3);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(pointer);
+	}
 	m_gl.getVertexAttribPointerv(index, pname, pointer);
 }
 
@@ -2304,6 +4580,13 @@ void CallLogWrapper::glGetVertexAttribdv (glw::GLuint index, glw::GLenum pname,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexAttribdv(" << index << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(304, 3);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.getVertexAttribdv(index, pname, params);
 }
 
@@ -2311,6 +4594,13 @@ void CallLogWrapper::glGetVertexAttribfv (glw::GLuint index, glw::GLenum pname,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexAttribfv(" << index << ", " << getVertexAttribParameterNameStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(305, 3);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.getVertexAttribfv(index, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getAttributeQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -2320,6 +4610,13 @@ void CallLogWrapper::glGetVertexAttribiv (glw::GLuint index, glw::GLenum pname,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetVertexAttribiv(" << index << ", " << getVertexAttribParameterNameStr(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(306, 3);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.getVertexAttribiv(index, pname, params);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// params = " << getPointerStr(params, getAttributeQueryNumArgsOut(pname)) << TestLog::EndMessage;
@@ -2329,6 +4626,14 @@ void CallLogWrapper::glGetnCompressedTexImage (glw::GLenum target, glw::GLint lo
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetnCompressedTexImage(" << toHex(target) << ", " << lod << ", " << bufSize << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(307, 4);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(lod);
+		args[2] = tcu::callTraceArg(bufSize);
+		args[3] = tcu::callTraceArg(pixels);
+	}
 	m_gl.getnCompressedTexImage(target, lod, bufSize, pixels);
 }
 
@@ -2336,6 +4641,16 @@ void CallLogWrapper::glGetnTexImage (glw::GLenum target, glw::GLint level, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetnTexImage(" << toHex(target) << ", " << level << ", " << toHex(format) << ", " << toHex(type) << ", " << bufSize << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(308, 6);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(level);
+		args[2] = tcu::callTraceArg(format);
+		args[3] = tcu::callTraceArg(type);
+		args[4] = tcu::callTraceArg(bufSize);
+		args[5] = tcu::callTraceArg(pixels);
+	}
 	m_gl.getnTexImage(target, level, format, type, bufSize, pixels);
 }
 
@@ -2343,6 +4658,14 @@ void CallLogWrapper::glGetnUniformdv (glw::GLuint program, glw::GLint location,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetnUniformdv(" << program << ", " << location << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(309, 4);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(bufSize);
+		args[3] = tcu::callTraceArg(params);
+	}
 	m_gl.getnUniformdv(program, location, bufSize, params);
 }
 
@@ -2350,6 +4673,14 @@ void CallLogWrapper::glGetnUniformfv (glw::GLuint program, glw::GLint location,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetnUniformfv(" << program << ", " << location << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(310, 4);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(bufSize);
+		args[3] = tcu::callTraceArg(params);
+	}
 	m_gl.getnUniformfv(program, location, bufSize, params);
 }
 
@@ -2357,6 +4688,14 @@ void CallLogWrapper::glGetnUniformiv (glw::GLuint program, glw::GLint location,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetnUniformiv(" << program << ", " << location << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(311, 4);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(bufSize);
+		args[3] = tcu::callTraceArg(params);
+	}
 	m_gl.getnUniformiv(program, location, bufSize, params);
 }
 
@@ -2364,6 +4703,14 @@ void CallLogWrapper::glGetnUniformuiv (glw::GLuint program, glw::GLint location,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glGetnUniformuiv(" << program << ", " << location << ", " << bufSize << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(312, 4);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(bufSize);
+		args[3] = tcu::callTraceArg(params);
+	}
 	m_gl.getnUniformuiv(program, location, bufSize, params);
 }
 
@@ -2371,6 +4718,12 @@ void CallLogWrapper::glHint (glw::GLenum target, glw::GLenum mode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glHint(" << getHintStr(target) << ", " << getHintModeStr(mode) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(313, 2);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(mode);
+	}
 	m_gl.hint(target, mode);
 }
 
@@ -2378,6 +4731,12 @@ void CallLogWrapper::glInsertEventMarkerEXT (glw::GLsizei length, const glw::GLc
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glInsertEventMarkerEXT(" << length << ", " << getStringStr(marker) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(314, 2);
+		args[0] = tcu::callTraceArg(length);
+		args[1] = tcu::callTraceArg(marker);
+	}
 	m_gl.insertEventMarkerEXT(length, marker);
 }
 
@@ -2385,6 +4744,11 @@ void CallLogWrapper::glInvalidateBufferData (glw::GLuint buffer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glInvalidateBufferData(" << buffer << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(315, 1);
+		args[0] = tcu::callTraceArg(buffer);
+	}
 	m_gl.invalidateBufferData(buffer);
 }
 
@@ -2392,6 +4756,13 @@ void CallLogWrapper::glInvalidateBufferSubData (glw::GLuint buffer, glw::GLintpt
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glInvalidateBufferSubData(" << buffer << ", " << offset << ", " << length << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(316, 3);
+		args[0] = tcu::callTraceArg(buffer);
+		args[1] = tcu::callTraceArg(offset);
+		args[2] = tcu::callTraceArg(length);
+	}
 	m_gl.invalidateBufferSubData(buffer, offset, length);
 }
 
@@ -2399,6 +4770,13 @@ void CallLogWrapper::glInvalidateFramebuffer (glw::GLenum target, glw::GLsizei n
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glInvalidateFramebuffer(" << getFramebufferTargetStr(target) << ", " << numAttachments << ", " << getEnumPointerStr(attachments, numAttachments, getInvalidateAttachmentName) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(317, 3);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(numAttachments);
+		args[2] = tcu::callTraceArg(attachments);
+	}
 	m_gl.invalidateFramebuffer(target, numAttachments, attachments);
 }
 
@@ -2406,6 +4784,13 @@ void CallLogWrapper::glInvalidateNamedFramebufferData (glw::GLuint framebuffer,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glInvalidateNamedFramebufferData(" << framebuffer << ", " << numAttachments << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(attachments))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(318, 3);
+		args[0] = tcu::callTraceArg(framebuffer);
+		args[1] = tcu::callTraceArg(numAttachments);
+		args[2] = tcu::callTraceArg(attachments);
+	}
 	m_gl.invalidateNamedFramebufferData(framebuffer, numAttachments, attachments);
 }
 
@@ -2413,6 +4798,17 @@ void CallLogWrapper::glInvalidateNamedFramebufferSubData (glw::GLuint framebuffe
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glInvalidateNamedFramebufferSubData(" << framebuffer << ", " << numAttachments << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(attachments))) << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(319, 7);
+		args[0] = tcu::callTraceArg(framebuffer);
+		args[1] = tcu::callTraceArg(numAttachments);
+		args[2] = tcu::callTraceArg(attachments);
+		args[3] = tcu::callTraceArg(x);
+		args[4] = tcu::callTraceArg(y);
+		args[5] = tcu::callTraceArg(width);
+		args[6] = tcu::callTraceArg(height);
+	}
 	m_gl.invalidateNamedFramebufferSubData(framebuffer, numAttachments, attachments, x, y, width, height);
 }
 
@@ -2420,6 +4816,17 @@ void CallLogWrapper::glInvalidateSubFramebuffer (glw::GLenum target, glw::GLsize
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glInvalidateSubFramebuffer(" << getFramebufferTargetStr(target) << ", " << numAttachments << ", " << getEnumPointerStr(attachments, numAttachments, getInvalidateAttachmentName) << ", " << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(320, 7);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(numAttachments);
+		args[2] = tcu::callTraceArg(attachments);
+		args[3] = tcu::callTraceArg(x);
+		args[4] = tcu::callTraceArg(y);
+		args[5] = tcu::callTraceArg(width);
+		args[6] = tcu::callTraceArg(height);
+	}
 	m_gl.invalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height);
 }
 
@@ -2427,6 +4834,12 @@ void CallLogWrapper::glInvalidateTexImage (glw::GLuint texture, glw::GLint level
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glInvalidateTexImage(" << texture << ", " << level << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(321, 2);
+		args[0] = tcu::callTraceArg(texture);
+		args[1] = tcu::callTraceArg(level);
+	}
 	m_gl.invalidateTexImage(texture, level);
 }
 
@@ -2434,6 +4847,18 @@ void CallLogWrapper::glInvalidateTexSubImage (glw::GLuint texture, glw::GLint le
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glInvalidateTexSubImage(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(322, 8);
+		args[0] = tcu::callTraceArg(texture);
+		args[1] = tcu::callTraceArg(level);
+		args[2] = tcu::callTraceArg(xoffset);
+		args[3] = tcu::callTraceArg(yoffset);
+		args[4] = tcu::callTraceArg(zoffset);
+		args[5] = tcu::callTraceArg(width);
+		args[6] = tcu::callTraceArg(height);
+		args[7] = tcu::callTraceArg(depth);
+	}
 	m_gl.invalidateTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth);
 }
 
@@ -2441,6 +4866,11 @@ glw::GLboolean CallLogWrapper::glIsBuffer (glw::GLuint buffer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsBuffer(" << buffer << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(323, 1);
+		args[0] = tcu::callTraceArg(buffer);
+	}
 	glw::GLboolean returnValue = m_gl.isBuffer(buffer);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -2451,6 +4881,11 @@ glw::GLboolean CallLogWrapper::glIsEnabled (glw::GLenum cap)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsEnabled(" << getEnableCapStr(cap) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(324, 1);
+		args[0] = tcu::callTraceArg(cap);
+	}
 	glw::GLboolean returnValue = m_gl.isEnabled(cap);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -2461,6 +4896,12 @@ glw::GLboolean CallLogWrapper::glIsEnabledi (glw::GLenum target, glw::GLuint ind
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsEnabledi(" << getIndexedEnableCapStr(target) << ", " << index << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(325, 2);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(index);
+	}
 	glw::GLboolean returnValue = m_gl.isEnabledi(target, index);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -2471,6 +4912,11 @@ glw::GLboolean CallLogWrapper::glIsFramebuffer (glw::GLuint framebuffer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsFramebuffer(" << framebuffer << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(326, 1);
+		args[0] = tcu::callTraceArg(framebuffer);
+	}
 	glw::GLboolean returnValue = m_gl.isFramebuffer(framebuffer);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -2481,6 +4927,11 @@ glw::GLboolean CallLogWrapper::glIsProgram (glw::GLuint program)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsProgram(" << program << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(327, 1);
+		args[0] = tcu::callTraceArg(program);
+	}
 	glw::GLboolean returnValue = m_gl.isProgram(program);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -2491,6 +4942,11 @@ glw::GLboolean CallLogWrapper::glIsProgramPipeline (glw::GLuint pipeline)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsProgramPipeline(" << pipeline << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(328, 1);
+		args[0] = tcu::callTraceArg(pipeline);
+	}
 	glw::GLboolean returnValue = m_gl.isProgramPipeline(pipeline);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -2501,6 +4957,11 @@ glw::GLboolean CallLogWrapper::glIsQuery (glw::GLuint id)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsQuery(" << id << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(329, 1);
+		args[0] = tcu::callTraceArg(id);
+	}
 	glw::GLboolean returnValue = m_gl.isQuery(id);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -2511,6 +4972,11 @@ glw::GLboolean CallLogWrapper::glIsRenderbuffer (glw::GLuint renderbuffer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsRenderbuffer(" << renderbuffer << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(330, 1);
+		args[0] = tcu::callTraceArg(renderbuffer);
+	}
 	glw::GLboolean returnValue = m_gl.isRenderbuffer(renderbuffer);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -2521,6 +4987,11 @@ glw::GLboolean CallLogWrapper::glIsSampler (glw::GLuint sampler)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsSampler(" << sampler << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(331, 1);
+		args[0] = tcu::callTraceArg(sampler);
+	}
 	glw::GLboolean returnValue = m_gl.isSampler(sampler);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -2531,6 +5002,11 @@ glw::GLboolean CallLogWrapper::glIsShader (glw::GLuint shader)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsShader(" << shader << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(332, 1);
+		args[0] = tcu::callTraceArg(shader);
+	}
 	glw::GLboolean returnValue = m_gl.isShader(shader);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -2541,6 +5017,11 @@ glw::GLboolean CallLogWrapper::glIsSync (glw::GLsync sync)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsSync(" << sync << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(333, 1);
+		args[0] = tcu::callTraceArg(sync);
+	}
 	glw::GLboolean returnValue = m_gl.isSync(sync);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -2551,6 +5032,11 @@ glw::GLboolean CallLogWrapper::glIsTexture (glw::GLuint texture)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsTexture(" << texture << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(334, 1);
+		args[0] = tcu::callTraceArg(texture);
+	}
 	glw::GLboolean returnValue = m_gl.isTexture(texture);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -2561,6 +5047,11 @@ glw::GLboolean CallLogWrapper::glIsTransformFeedback (glw::GLuint id)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsTransformFeedback(" << id << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(335, 1);
+		args[0] = tcu::callTraceArg(id);
+	}
 	glw::GLboolean returnValue = m_gl.isTransformFeedback(id);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -2571,6 +5062,11 @@ glw::GLboolean CallLogWrapper::glIsVertexArray (glw::GLuint array)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glIsVertexArray(" << array << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(336, 1);
+		args[0] = tcu::callTraceArg(array);
+	}
 	glw::GLboolean returnValue = m_gl.isVertexArray(array);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -2581,6 +5077,11 @@ void CallLogWrapper::glLineWidth (glw::GLfloat width)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glLineWidth(" << width << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(337, 1);
+		args[0] = tcu::callTraceArg(width);
+	}
 	m_gl.lineWidth(width);
 }
 
@@ -2588,6 +5089,11 @@ void CallLogWrapper::glLinkProgram (glw::GLuint program)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glLinkProgram(" << program << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(338, 1);
+		args[0] = tcu::callTraceArg(program);
+	}
 	m_gl.linkProgram(program);
 }
 
@@ -2595,6 +5101,11 @@ void CallLogWrapper::glLogicOp (glw::GLenum opcode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glLogicOp(" << toHex(opcode) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(339, 1);
+		args[0] = tcu::callTraceArg(opcode);
+	}
 	m_gl.logicOp(opcode);
 }
 
@@ -2602,6 +5113,12 @@ void * CallLogWrapper::glMapBuffer (glw::GLenum target, glw::GLenum access)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMapBuffer(" << toHex(target) << ", " << toHex(access) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(340, 2);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(access);
+	}
 	void * returnValue = m_gl.mapBuffer(target, access);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -2612,6 +5129,14 @@ void * CallLogWrapper::glMapBufferRange (glw::GLenum target, glw::GLintptr offse
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMapBufferRange(" << getBufferTargetStr(target) << ", " << offset << ", " << length << ", " << getBufferMapFlagsStr(access) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(341, 4);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(offset);
+		args[2] = tcu::callTraceArg(length);
+		args[3] = tcu::callTraceArg(access);
+	}
 	void * returnValue = m_gl.mapBufferRange(target, offset, length, access);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -2622,6 +5147,12 @@ void * CallLogWrapper::glMapNamedBuffer (glw::GLuint buffer, glw::GLenum access)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMapNamedBuffer(" << buffer << ", " << toHex(access) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(342, 2);
+		args[0] = tcu::callTraceArg(buffer);
+		args[1] = tcu::callTraceArg(access);
+	}
 	void * returnValue = m_gl.mapNamedBuffer(buffer, access);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -2632,6 +5163,14 @@ void * CallLogWrapper::glMapNamedBufferRange (glw::GLuint buffer, glw::GLintptr
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMapNamedBufferRange(" << buffer << ", " << offset << ", " << length << ", " << toHex(access) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(343, 4);
+		args[0] = tcu::callTraceArg(buffer);
+		args[1] = tcu::callTraceArg(offset);
+		args[2] = tcu::callTraceArg(length);
+		args[3] = tcu::callTraceArg(access);
+	}
 	void * returnValue = m_gl.mapNamedBufferRange(buffer, offset, length, access);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << returnValue << " returned" << TestLog::EndMessage;
@@ -2642,6 +5181,11 @@ void CallLogWrapper::glMemoryBarrier (glw::GLbitfield barriers)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMemoryBarrier(" << getMemoryBarrierFlagsStr(barriers) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(344, 1);
+		args[0] = tcu::callTraceArg(barriers);
+	}
 	m_gl.memoryBarrier(barriers);
 }
 
@@ -2649,6 +5193,11 @@ void CallLogWrapper::glMemoryBarrierByRegion (glw::GLbitfield barriers)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMemoryBarrierByRegion(" << toHex(barriers) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(345, 1);
+		args[0] = tcu::callTraceArg(barriers);
+	}
 	m_gl.memoryBarrierByRegion(barriers);
 }
 
@@ -2656,6 +5205,11 @@ void CallLogWrapper::glMinSampleShading (glw::GLfloat value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMinSampleShading(" << value << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(346, 1);
+		args[0] = tcu::callTraceArg(value);
+	}
 	m_gl.minSampleShading(value);
 }
 
@@ -2663,6 +5217,14 @@ void CallLogWrapper::glMultiDrawArrays (glw::GLenum mode, const glw::GLint *firs
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiDrawArrays(" << getPrimitiveTypeStr(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(first))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(count))) << ", " << drawcount << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(347, 4);
+		args[0] = tcu::callTraceArg(mode);
+		args[1] = tcu::callTraceArg(first);
+		args[2] = tcu::callTraceArg(count);
+		args[3] = tcu::callTraceArg(drawcount);
+	}
 	m_gl.multiDrawArrays(mode, first, count, drawcount);
 }
 
@@ -2670,6 +5232,14 @@ void CallLogWrapper::glMultiDrawArraysIndirect (glw::GLenum mode, const void *in
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiDrawArraysIndirect(" << toHex(mode) << ", " << indirect << ", " << drawcount << ", " << stride << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(348, 4);
+		args[0] = tcu::callTraceArg(mode);
+		args[1] = tcu::callTraceArg(indirect);
+		args[2] = tcu::callTraceArg(drawcount);
+		args[3] = tcu::callTraceArg(stride);
+	}
 	m_gl.multiDrawArraysIndirect(mode, indirect, drawcount, stride);
 }
 
@@ -2677,6 +5247,15 @@ void CallLogWrapper::glMultiDrawElements (glw::GLenum mode, const glw::GLsizei *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiDrawElements(" << getPrimitiveTypeStr(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(count))) << ", " << getTypeStr(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(indices))) << ", " << drawcount << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(349, 5);
+		args[0] = tcu::callTraceArg(mode);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(type);
+		args[3] = tcu::callTraceArg(indices);
+		args[4] = tcu::callTraceArg(drawcount);
+	}
 	m_gl.multiDrawElements(mode, count, type, indices, drawcount);
 }
 
@@ -2684,6 +5263,16 @@ void CallLogWrapper::glMultiDrawElementsBaseVertex (glw::GLenum mode, const glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiDrawElementsBaseVertex(" << getPrimitiveTypeStr(mode) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(count))) << ", " << getTypeStr(type) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(indices))) << ", " << drawcount << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(basevertex))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(350, 6);
+		args[0] = tcu::callTraceArg(mode);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(type);
+		args[3] = tcu::callTraceArg(indices);
+		args[4] = tcu::callTraceArg(drawcount);
+		args[5] = tcu::callTraceArg(basevertex);
+	}
 	m_gl.multiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
 }
 
@@ -2691,6 +5280,15 @@ void CallLogWrapper::glMultiDrawElementsIndirect (glw::GLenum mode, glw::GLenum
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glMultiDrawElementsIndirect(" << toHex(mode) << ", " << toHex(type) << ", " << indirect << ", " << drawcount << ", " << stride << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(351, 5);
+		args[0] = tcu::callTraceArg(mode);
+		args[1] = tcu::callTraceArg(type);
+		args[2] = tcu::callTraceArg(indirect);
+		args[3] = tcu::callTraceArg(drawcount);
+		args[4] = tcu::callTraceArg(stride);
+	}
 	m_gl.multiDrawElementsIndirect(mode, type, indirect, drawcount, stride);
 }
 
@@ -2698,6 +5296,14 @@ void CallLogWrapper::glNamedBufferData (glw::GLuint buffer, glw::GLsizeiptr size
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedBufferData(" << buffer << ", " << size << ", " << data << ", " << toHex(usage) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(352, 4);
+		args[0] = tcu::callTraceArg(buffer);
+		args[1] = tcu::callTraceArg(size);
+		args[2] = tcu::callTraceArg(data);
+		args[3] = tcu::callTraceArg(usage);
+	}
 	m_gl.namedBufferData(buffer, size, data, usage);
 }
 
@@ -2705,6 +5311,14 @@ void CallLogWrapper::glNamedBufferStorage (glw::GLuint buffer, glw::GLsizeiptr s
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedBufferStorage(" << buffer << ", " << size << ", " << data << ", " << toHex(flags) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(353, 4);
+		args[0] = tcu::callTraceArg(buffer);
+		args[1] = tcu::callTraceArg(size);
+		args[2] = tcu::callTraceArg(data);
+		args[3] = tcu::callTraceArg(flags);
+	}
 	m_gl.namedBufferStorage(buffer, size, data, flags);
 }
 
@@ -2712,6 +5326,14 @@ void CallLogWrapper::glNamedBufferSubData (glw::GLuint buffer, glw::GLintptr off
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedBufferSubData(" << buffer << ", " << offset << ", " << size << ", " << data << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(354, 4);
+		args[0] = tcu::callTraceArg(buffer);
+		args[1] = tcu::callTraceArg(offset);
+		args[2] = tcu::callTraceArg(size);
+		args[3] = tcu::callTraceArg(data);
+	}
 	m_gl.namedBufferSubData(buffer, offset, size, data);
 }
 
@@ -2719,6 +5341,12 @@ void CallLogWrapper::glNamedFramebufferDrawBuffer (glw::GLuint framebuffer, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferDrawBuffer(" << framebuffer << ", " << toHex(buf) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(355, 2);
+		args[0] = tcu::callTraceArg(framebuffer);
+		args[1] = tcu::callTraceArg(buf);
+	}
 	m_gl.namedFramebufferDrawBuffer(framebuffer, buf);
 }
 
@@ -2726,6 +5354,13 @@ void CallLogWrapper::glNamedFramebufferDrawBuffers (glw::GLuint framebuffer, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferDrawBuffers(" << framebuffer << ", " << n << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(bufs))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(356, 3);
+		args[0] = tcu::callTraceArg(framebuffer);
+		args[1] = tcu::callTraceArg(n);
+		args[2] = tcu::callTraceArg(bufs);
+	}
 	m_gl.namedFramebufferDrawBuffers(framebuffer, n, bufs);
 }
 
@@ -2733,6 +5368,13 @@ void CallLogWrapper::glNamedFramebufferParameteri (glw::GLuint framebuffer, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferParameteri(" << framebuffer << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(357, 3);
+		args[0] = tcu::callTraceArg(framebuffer);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(param);
+	}
 	m_gl.namedFramebufferParameteri(framebuffer, pname, param);
 }
 
@@ -2740,6 +5382,12 @@ void CallLogWrapper::glNamedFramebufferReadBuffer (glw::GLuint framebuffer, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferReadBuffer(" << framebuffer << ", " << toHex(src) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(358, 2);
+		args[0] = tcu::callTraceArg(framebuffer);
+		args[1] = tcu::callTraceArg(src);
+	}
 	m_gl.namedFramebufferReadBuffer(framebuffer, src);
 }
 
@@ -2747,6 +5395,14 @@ void CallLogWrapper::glNamedFramebufferRenderbuffer (glw::GLuint framebuffer, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferRenderbuffer(" << framebuffer << ", " << toHex(attachment) << ", " << toHex(renderbuffertarget) << ", " << renderbuffer << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(359, 4);
+		args[0] = tcu::callTraceArg(framebuffer);
+		args[1] = tcu::callTraceArg(attachment);
+		args[2] = tcu::callTraceArg(renderbuffertarget);
+		args[3] = tcu::callTraceArg(renderbuffer);
+	}
 	m_gl.namedFramebufferRenderbuffer(framebuffer, attachment, renderbuffertarget, renderbuffer);
 }
 
@@ -2754,6 +5410,14 @@ void CallLogWrapper::glNamedFramebufferTexture (glw::GLuint framebuffer, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferTexture(" << framebuffer << ", " << toHex(attachment) << ", " << texture << ", " << level << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(360, 4);
+		args[0] = tcu::callTraceArg(framebuffer);
+		args[1] = tcu::callTraceArg(attachment);
+		args[2] = tcu::callTraceArg(texture);
+		args[3] = tcu::callTraceArg(level);
+	}
 	m_gl.namedFramebufferTexture(framebuffer, attachment, texture, level);
 }
 
@@ -2761,6 +5425,15 @@ void CallLogWrapper::glNamedFramebufferTextureLayer (glw::GLuint framebuffer, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedFramebufferTextureLayer(" << framebuffer << ", " << toHex(attachment) << ", " << texture << ", " << level << ", " << layer << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(361, 5);
+		args[0] = tcu::callTraceArg(framebuffer);
+		args[1] = tcu::callTraceArg(attachment);
+		args[2] = tcu::callTraceArg(texture);
+		args[3] = tcu::callTraceArg(level);
+		args[4] = tcu::callTraceArg(layer);
+	}
 	m_gl.namedFramebufferTextureLayer(framebuffer, attachment, texture, level, layer);
 }
 
@@ -2768,6 +5441,14 @@ void CallLogWrapper::glNamedRenderbufferStorage (glw::GLuint renderbuffer, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedRenderbufferStorage(" << renderbuffer << ", " << toHex(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(362, 4);
+		args[0] = tcu::callTraceArg(renderbuffer);
+		args[1] = tcu::callTraceArg(internalformat);
+		args[2] = tcu::callTraceArg(width);
+		args[3] = tcu::callTraceArg(height);
+	}
 	m_gl.namedRenderbufferStorage(renderbuffer, internalformat, width, height);
 }
 
@@ -2775,6 +5456,15 @@ void CallLogWrapper::glNamedRenderbufferStorageMultisample (glw::GLuint renderbu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glNamedRenderbufferStorageMultisample(" << renderbuffer << ", " << samples << ", " << toHex(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(363, 5);
+		args[0] = tcu::callTraceArg(renderbuffer);
+		args[1] = tcu::callTraceArg(samples);
+		args[2] = tcu::callTraceArg(internalformat);
+		args[3] = tcu::callTraceArg(width);
+		args[4] = tcu::callTraceArg(height);
+	}
 	m_gl.namedRenderbufferStorageMultisample(renderbuffer, samples, internalformat, width, height);
 }
 
@@ -2782,6 +5472,14 @@ void CallLogWrapper::glObjectLabel (glw::GLenum identifier, glw::GLuint name, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glObjectLabel(" << toHex(identifier) << ", " << name << ", " << length << ", " << getStringStr(label) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(364, 4);
+		args[0] = tcu::callTraceArg(identifier);
+		args[1] = tcu::callTraceArg(name);
+		args[2] = tcu::callTraceArg(length);
+		args[3] = tcu::callTraceArg(label);
+	}
 	m_gl.objectLabel(identifier, name, length, label);
 }
 
@@ -2789,6 +5487,13 @@ void CallLogWrapper::glObjectPtrLabel (const void *ptr, glw::GLsizei length, con
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glObjectPtrLabel(" << ptr << ", " << length << ", " << getStringStr(label) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(365, 3);
+		args[0] = tcu::callTraceArg(ptr);
+		args[1] = tcu::callTraceArg(length);
+		args[2] = tcu::callTraceArg(label);
+	}
 	m_gl.objectPtrLabel(ptr, length, label);
 }
 
@@ -2796,6 +5501,12 @@ void CallLogWrapper::glPatchParameterfv (glw::GLenum pname, const glw::GLfloat *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPatchParameterfv(" << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(values))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(366, 2);
+		args[0] = tcu::callTraceArg(pname);
+		args[1] = tcu::callTraceArg(values);
+	}
 	m_gl.patchParameterfv(pname, values);
 }
 
@@ -2803,6 +5514,12 @@ void CallLogWrapper::glPatchParameteri (glw::GLenum pname, glw::GLint value)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPatchParameteri(" << getPatchParamStr(pname) << ", " << value << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(367, 2);
+		args[0] = tcu::callTraceArg(pname);
+		args[1] = tcu::callTraceArg(value);
+	}
 	m_gl.patchParameteri(pname, value);
 }
 
@@ -2810,6 +5527,8 @@ void CallLogWrapper::glPauseTransformFeedback (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPauseTransformFeedback(" << ");" << TestLog::EndMessage;
+	if (m_trace)
+		m_trace->recordCall(368, 0);
 	m_gl.pauseTransformFeedback();
 }
 
@@ -2817,6 +5536,12 @@ void CallLogWrapper::glPixelStoref (glw::GLenum pname, glw::GLfloat param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPixelStoref(" << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(369, 2);
+		args[0] = tcu::callTraceArg(pname);
+		args[1] = tcu::callTraceArg(param);
+	}
 	m_gl.pixelStoref(pname, param);
 }
 
@@ -2824,6 +5549,12 @@ void CallLogWrapper::glPixelStorei (glw::GLenum pname, glw::GLint param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPixelStorei(" << getPixelStoreParameterStr(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(370, 2);
+		args[0] = tcu::callTraceArg(pname);
+		args[1] = tcu::callTraceArg(param);
+	}
 	m_gl.pixelStorei(pname, param);
 }
 
@@ -2831,6 +5562,12 @@ void CallLogWrapper::glPointParameterf (glw::GLenum pname, glw::GLfloat param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPointParameterf(" << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(371, 2);
+		args[0] = tcu::callTraceArg(pname);
+		args[1] = tcu::callTraceArg(param);
+	}
 	m_gl.pointParameterf(pname, param);
 }
 
@@ -2838,6 +5575,12 @@ void CallLogWrapper::glPointParameterfv (glw::GLenum pname, const glw::GLfloat *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPointParameterfv(" << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(372, 2);
+		args[0] = tcu::callTraceArg(pname);
+		args[1] = tcu::callTraceArg(params);
+	}
 	m_gl.pointParameterfv(pname, params);
 }
 
@@ -2845,6 +5588,12 @@ void CallLogWrapper::glPointParameteri (glw::GLenum pname, glw::GLint param)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPointParameteri(" << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(373, 2);
+		args[0] = tcu::callTraceArg(pname);
+		args[1] = tcu::callTraceArg(param);
+	}
 	m_gl.pointParameteri(pname, param);
 }
 
@@ -2852,6 +5601,12 @@ void CallLogWrapper::glPointParameteriv (glw::GLenum pname, const glw::GLint *pa
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPointParameteriv(" << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(374, 2);
+		args[0] = tcu::callTraceArg(pname);
+		args[1] = tcu::callTraceArg(params);
+	}
 	m_gl.pointParameteriv(pname, params);
 }
 
@@ -2859,6 +5614,11 @@ void CallLogWrapper::glPointSize (glw::GLfloat size)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPointSize(" << size << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(375, 1);
+		args[0] = tcu::callTraceArg(size);
+	}
 	m_gl.pointSize(size);
 }
 
@@ -2866,6 +5626,12 @@ void CallLogWrapper::glPolygonMode (glw::GLenum face, glw::GLenum mode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPolygonMode(" << toHex(face) << ", " << toHex(mode) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(376, 2);
+		args[0] = tcu::callTraceArg(face);
+		args[1] = tcu::callTraceArg(mode);
+	}
 	m_gl.polygonMode(face, mode);
 }
 
@@ -2873,6 +5639,12 @@ void CallLogWrapper::glPolygonOffset (glw::GLfloat factor, glw::GLfloat units)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPolygonOffset(" << factor << ", " << units << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(377, 2);
+		args[0] = tcu::callTraceArg(factor);
+		args[1] = tcu::callTraceArg(units);
+	}
 	m_gl.polygonOffset(factor, units);
 }
 
@@ -2880,6 +5652,8 @@ void CallLogWrapper::glPopDebugGroup (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPopDebugGroup(" << ");" << TestLog::EndMessage;
+	if (m_trace)
+		m_trace->recordCall(378, 0);
 	m_gl.popDebugGroup();
 }
 
@@ -2887,6 +5661,8 @@ void CallLogWrapper::glPopGroupMarkerEXT (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPopGroupMarkerEXT(" << ");" << TestLog::EndMessage;
+	if (m_trace)
+		m_trace->recordCall(379, 0);
 	m_gl.popGroupMarkerEXT();
 }
 
@@ -2894,6 +5670,18 @@ void CallLogWrapper::glPrimitiveBoundingBoxEXT (glw::GLfloat minX, glw::GLfloat
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPrimitiveBoundingBoxEXT(" << minX << ", " << minY << ", " << minZ << ", " << minW << ", " << maxX << ", " << maxY << ", " << maxZ << ", " << maxW << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(380, 8);
+		args[0] = tcu::callTraceArg(minX);
+		args[1] = tcu::callTraceArg(minY);
+		args[2] = tcu::callTraceArg(minZ);
+		args[3] = tcu::callTraceArg(minW);
+		args[4] = tcu::callTraceArg(maxX);
+		args[5] = tcu::callTraceArg(maxY);
+		args[6] = tcu::callTraceArg(maxZ);
+		args[7] = tcu::callTraceArg(maxW);
+	}
 	m_gl.primitiveBoundingBoxEXT(minX, minY, minZ, minW, maxX, maxY, maxZ, maxW);
 }
 
@@ -2901,6 +5689,11 @@ void CallLogWrapper::glPrimitiveRestartIndex (glw::GLuint index)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPrimitiveRestartIndex(" << index << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(381, 1);
+		args[0] = tcu::callTraceArg(index);
+	}
 	m_gl.primitiveRestartIndex(index);
 }
 
@@ -2908,6 +5701,14 @@ void CallLogWrapper::glProgramBinary (glw::GLuint program, glw::GLenum binaryFor
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramBinary(" << program << ", " << toHex(binaryFormat) << ", " << binary << ", " << length << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(382, 4);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(binaryFormat);
+		args[2] = tcu::callTraceArg(binary);
+		args[3] = tcu::callTraceArg(length);
+	}
 	m_gl.programBinary(program, binaryFormat, binary, length);
 }
 
@@ -2915,6 +5716,13 @@ void CallLogWrapper::glProgramParameteri (glw::GLuint program, glw::GLenum pname
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramParameteri(" << program << ", " << getProgramParamStr(pname) << ", " << value << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(383, 3);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(value);
+	}
 	m_gl.programParameteri(program, pname, value);
 }
 
@@ -2922,6 +5730,13 @@ void CallLogWrapper::glProgramUniform1d (glw::GLuint program, glw::GLint locatio
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform1d(" << program << ", " << location << ", " << v0 << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(384, 3);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(v0);
+	}
 	m_gl.programUniform1d(program, location, v0);
 }
 
@@ -2929,6 +5744,14 @@ void CallLogWrapper::glProgramUniform1dv (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform1dv(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(385, 4);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(count);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.programUniform1dv(program, location, count, value);
 }
 
@@ -2936,6 +5759,13 @@ void CallLogWrapper::glProgramUniform1f (glw::GLuint program, glw::GLint locatio
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform1f(" << program << ", " << location << ", " << v0 << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(386, 3);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(v0);
+	}
 	m_gl.programUniform1f(program, location, v0);
 }
 
@@ -2943,6 +5773,14 @@ void CallLogWrapper::glProgramUniform1fv (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform1fv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 1)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(387, 4);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(count);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.programUniform1fv(program, location, count, value);
 }
 
@@ -2950,6 +5788,13 @@ void CallLogWrapper::glProgramUniform1i (glw::GLuint program, glw::GLint locatio
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform1i(" << program << ", " << location << ", " << v0 << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(388, 3);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(v0);
+	}
 	m_gl.programUniform1i(program, location, v0);
 }
 
@@ -2957,6 +5802,14 @@ void CallLogWrapper::glProgramUniform1iv (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform1iv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 1)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(389, 4);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(count);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.programUniform1iv(program, location, count, value);
 }
 
@@ -2964,6 +5817,13 @@ void CallLogWrapper::glProgramUniform1ui (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform1ui(" << program << ", " << location << ", " << v0 << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(390, 3);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(v0);
+	}
 	m_gl.programUniform1ui(program, location, v0);
 }
 
@@ -2971,6 +5831,14 @@ void CallLogWrapper::glProgramUniform1uiv (glw::GLuint program, glw::GLint locat
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform1uiv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 1)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(391, 4);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(count);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.programUniform1uiv(program, location, count, value);
 }
 
@@ -2978,6 +5846,14 @@ void CallLogWrapper::glProgramUniform2d (glw::GLuint program, glw::GLint locatio
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform2d(" << program << ", " << location << ", " << v0 << ", " << v1 << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(392, 4);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(v0);
+		args[3] = tcu::callTraceArg(v1);
+	}
 	m_gl.programUniform2d(program, location, v0, v1);
 }
 
@@ -2985,6 +5861,14 @@ void CallLogWrapper::glProgramUniform2dv (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform2dv(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(393, 4);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(count);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.programUniform2dv(program, location, count, value);
 }
 
@@ -2992,6 +5876,14 @@ void CallLogWrapper::glProgramUniform2f (glw::GLuint program, glw::GLint locatio
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform2f(" << program << ", " << location << ", " << v0 << ", " << v1 << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(394, 4);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(v0);
+		args[3] = tcu::callTraceArg(v1);
+	}
 	m_gl.programUniform2f(program, location, v0, v1);
 }
 
@@ -2999,6 +5891,14 @@ void CallLogWrapper::glProgramUniform2fv (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform2fv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 2)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(395, 4);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(count);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.programUniform2fv(program, location, count, value);
 }
 
@@ -3006,6 +5906,14 @@ void CallLogWrapper::glProgramUniform2i (glw::GLuint program, glw::GLint locatio
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform2i(" << program << ", " << location << ", " << v0 << ", " << v1 << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(396, 4);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(v0);
+		args[3] = tcu::callTraceArg(v1);
+	}
 	m_gl.programUniform2i(program, location, v0, v1);
 }
 
@@ -3013,6 +5921,14 @@ void CallLogWrapper::glProgramUniform2iv (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform2iv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 2)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(397, 4);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(count);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.programUniform2iv(program, location, count, value);
 }
 
@@ -3020,6 +5936,14 @@ void CallLogWrapper::glProgramUniform2ui (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform2ui(" << program << ", " << location << ", " << v0 << ", " << v1 << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(398, 4);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(v0);
+		args[3] = tcu::callTraceArg(v1);
+	}
 	m_gl.programUniform2ui(program, location, v0, v1);
 }
 
@@ -3027,6 +5951,14 @@ void CallLogWrapper::glProgramUniform2uiv (glw::GLuint program, glw::GLint locat
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform2uiv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 2)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(399, 4);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(count);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.programUniform2uiv(program, location, count, value);
 }
 
@@ -3034,6 +5966,15 @@ void CallLogWrapper::glProgramUniform3d (glw::GLuint program, glw::GLint locatio
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform3d(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(400, 5);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(v0);
+		args[3] = tcu::callTraceArg(v1);
+		args[4] = tcu::callTraceArg(v2);
+	}
 	m_gl.programUniform3d(program, location, v0, v1, v2);
 }
 
@@ -3041,6 +5982,14 @@ void CallLogWrapper::glProgramUniform3dv (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform3dv(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(401, 4);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(count);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.programUniform3dv(program, location, count, value);
 }
 
@@ -3048,6 +5997,15 @@ void CallLogWrapper::glProgramUniform3f (glw::GLuint program, glw::GLint locatio
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform3f(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(402, 5);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(v0);
+		args[3] = tcu::callTraceArg(v1);
+		args[4] = tcu::callTraceArg(v2);
+	}
 	m_gl.programUniform3f(program, location, v0, v1, v2);
 }
 
@@ -3055,6 +6013,14 @@ void CallLogWrapper::glProgramUniform3fv (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform3fv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 3)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(403, 4);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(count);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.programUniform3fv(program, location, count, value);
 }
 
@@ -3062,6 +6028,15 @@ void CallLogWrapper::glProgramUniform3i (glw::GLuint program, glw::GLint locatio
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform3i(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(404, 5);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(v0);
+		args[3] = tcu::callTraceArg(v1);
+		args[4] = tcu::callTraceArg(v2);
+	}
 	m_gl.programUniform3i(program, location, v0, v1, v2);
 }
 
@@ -3069,6 +6044,14 @@ void CallLogWrapper::glProgramUniform3iv (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform3iv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 3)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(405, 4);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(count);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.programUniform3iv(program, location, count, value);
 }
 
@@ -3076,6 +6059,15 @@ void CallLogWrapper::glProgramUniform3ui (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform3ui(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(406, 5);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(v0);
+		args[3] = tcu::callTraceArg(v1);
+		args[4] = tcu::callTraceArg(v2);
+	}
 	m_gl.programUniform3ui(program, location, v0, v1, v2);
 }
 
@@ -3083,6 +6075,14 @@ void CallLogWrapper::glProgramUniform3uiv (glw::GLuint program, glw::GLint locat
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform3uiv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 3)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(407, 4);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(count);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.programUniform3uiv(program, location, count, value);
 }
 
@@ -3090,6 +6090,16 @@ void CallLogWrapper::glProgramUniform4d (glw::GLuint program, glw::GLint locatio
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform4d(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(408, 6);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(v0);
+		args[3] = tcu::callTraceArg(v1);
+		args[4] = tcu::callTraceArg(v2);
+		args[5] = tcu::callTraceArg(v3);
+	}
 	m_gl.programUniform4d(program, location, v0, v1, v2, v3);
 }
 
@@ -3097,6 +6107,14 @@ void CallLogWrapper::glProgramUniform4dv (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform4dv(" << program << ", " << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(409, 4);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(count);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.programUniform4dv(program, location, count, value);
 }
 
@@ -3104,6 +6122,16 @@ void CallLogWrapper::glProgramUniform4f (glw::GLuint program, glw::GLint locatio
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform4f(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(410, 6);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(v0);
+		args[3] = tcu::callTraceArg(v1);
+		args[4] = tcu::callTraceArg(v2);
+		args[5] = tcu::callTraceArg(v3);
+	}
 	m_gl.programUniform4f(program, location, v0, v1, v2, v3);
 }
 
@@ -3111,6 +6139,14 @@ void CallLogWrapper::glProgramUniform4fv (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform4fv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 4)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(411, 4);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(count);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.programUniform4fv(program, location, count, value);
 }
 
@@ -3118,6 +6154,16 @@ void CallLogWrapper::glProgramUniform4i (glw::GLuint program, glw::GLint locatio
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform4i(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(412, 6);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(v0);
+		args[3] = tcu::callTraceArg(v1);
+		args[4] = tcu::callTraceArg(v2);
+		args[5] = tcu::callTraceArg(v3);
+	}
 	m_gl.programUniform4i(program, location, v0, v1, v2, v3);
 }
 
@@ -3125,6 +6171,14 @@ void CallLogWrapper::glProgramUniform4iv (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform4iv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 4)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(413, 4);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(count);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.programUniform4iv(program, location, count, value);
 }
 
@@ -3132,6 +6186,16 @@ void CallLogWrapper::glProgramUniform4ui (glw::GLuint program, glw::GLint locati
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform4ui(" << program << ", " << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(414, 6);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(v0);
+		args[3] = tcu::callTraceArg(v1);
+		args[4] = tcu::callTraceArg(v2);
+		args[5] = tcu::callTraceArg(v3);
+	}
 	m_gl.programUniform4ui(program, location, v0, v1, v2, v3);
 }
 
@@ -3139,6 +6203,14 @@ void CallLogWrapper::glProgramUniform4uiv (glw::GLuint program, glw::GLint locat
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniform4uiv(" << program << ", " << location << ", " << count << ", " << getPointerStr(value, (count * 4)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(415, 4);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(count);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.programUniform4uiv(program, location, count, value);
 }
 
@@ -3146,6 +6218,15 @@ void CallLogWrapper::glProgramUniformMatrix2dv (glw::GLuint program, glw::GLint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix2dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(416, 5);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(count);
+		args[3] = tcu::callTraceArg(transpose);
+		args[4] = tcu::callTraceArg(value);
+	}
 	m_gl.programUniformMatrix2dv(program, location, count, transpose, value);
 }
 
@@ -3153,6 +6234,15 @@ void CallLogWrapper::glProgramUniformMatrix2fv (glw::GLuint program, glw::GLint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix2fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 2*2)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(417, 5);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(count);
+		args[3] = tcu::callTraceArg(transpose);
+		args[4] = tcu::callTraceArg(value);
+	}
 	m_gl.programUniformMatrix2fv(program, location, count, transpose, value);
 }
 
@@ -3160,6 +6250,15 @@ void CallLogWrapper::glProgramUniformMatrix2x3dv (glw::GLuint program, glw::GLin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix2x3dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(418, 5);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(count);
+		args[3] = tcu::callTraceArg(transpose);
+		args[4] = tcu::callTraceArg(value);
+	}
 	m_gl.programUniformMatrix2x3dv(program, location, count, transpose, value);
 }
 
@@ -3167,6 +6266,15 @@ void CallLogWrapper::glProgramUniformMatrix2x3fv (glw::GLuint program, glw::GLin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix2x3fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 2*3)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(419, 5);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(count);
+		args[3] = tcu::callTraceArg(transpose);
+		args[4] = tcu::callTraceArg(value);
+	}
 	m_gl.programUniformMatrix2x3fv(program, location, count, transpose, value);
 }
 
@@ -3174,6 +6282,15 @@ void CallLogWrapper::glProgramUniformMatrix2x4dv (glw::GLuint program, glw::GLin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix2x4dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(420, 5);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(count);
+		args[3] = tcu::callTraceArg(transpose);
+		args[4] = tcu::callTraceArg(value);
+	}
 	m_gl.programUniformMatrix2x4dv(program, location, count, transpose, value);
 }
 
@@ -3181,6 +6298,15 @@ void CallLogWrapper::glProgramUniformMatrix2x4fv (glw::GLuint program, glw::GLin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix2x4fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 2*4)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(421, 5);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(count);
+		args[3] = tcu::callTraceArg(transpose);
+		args[4] = tcu::callTraceArg(value);
+	}
 	m_gl.programUniformMatrix2x4fv(program, location, count, transpose, value);
 }
 
@@ -3188,6 +6314,15 @@ void CallLogWrapper::glProgramUniformMatrix3dv (glw::GLuint program, glw::GLint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix3dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(422, 5);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(count);
+		args[3] = tcu::callTraceArg(transpose);
+		args[4] = tcu::callTraceArg(value);
+	}
 	m_gl.programUniformMatrix3dv(program, location, count, transpose, value);
 }
 
@@ -3195,6 +6330,15 @@ void CallLogWrapper::glProgramUniformMatrix3fv (glw::GLuint program, glw::GLint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix3fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 3*3)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(423, 5);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(count);
+		args[3] = tcu::callTraceArg(transpose);
+		args[4] = tcu::callTraceArg(value);
+	}
 	m_gl.programUniformMatrix3fv(program, location, count, transpose, value);
 }
 
@@ -3202,6 +6346,15 @@ void CallLogWrapper::glProgramUniformMatrix3x2dv (glw::GLuint program, glw::GLin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix3x2dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(424, 5);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(count);
+		args[3] = tcu::callTraceArg(transpose);
+		args[4] = tcu::callTraceArg(value);
+	}
 	m_gl.programUniformMatrix3x2dv(program, location, count, transpose, value);
 }
 
@@ -3209,6 +6362,15 @@ void CallLogWrapper::glProgramUniformMatrix3x2fv (glw::GLuint program, glw::GLin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix3x2fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 3*2)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(425, 5);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(count);
+		args[3] = tcu::callTraceArg(transpose);
+		args[4] = tcu::callTraceArg(value);
+	}
 	m_gl.programUniformMatrix3x2fv(program, location, count, transpose, value);
 }
 
@@ -3216,6 +6378,15 @@ void CallLogWrapper::glProgramUniformMatrix3x4dv (glw::GLuint program, glw::GLin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix3x4dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(426, 5);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(count);
+		args[3] = tcu::callTraceArg(transpose);
+		args[4] = tcu::callTraceArg(value);
+	}
 	m_gl.programUniformMatrix3x4dv(program, location, count, transpose, value);
 }
 
@@ -3223,6 +6394,15 @@ void CallLogWrapper::glProgramUniformMatrix3x4fv (glw::GLuint program, glw::GLin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix3x4fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 3*4)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(427, 5);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(count);
+		args[3] = tcu::callTraceArg(transpose);
+		args[4] = tcu::callTraceArg(value);
+	}
 	m_gl.programUniformMatrix3x4fv(program, location, count, transpose, value);
 }
 
@@ -3230,6 +6410,15 @@ void CallLogWrapper::glProgramUniformMatrix4dv (glw::GLuint program, glw::GLint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix4dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(428, 5);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(count);
+		args[3] = tcu::callTraceArg(transpose);
+		args[4] = tcu::callTraceArg(value);
+	}
 	m_gl.programUniformMatrix4dv(program, location, count, transpose, value);
 }
 
@@ -3237,6 +6426,15 @@ void CallLogWrapper::glProgramUniformMatrix4fv (glw::GLuint program, glw::GLint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix4fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 4*4)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(429, 5);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(count);
+		args[3] = tcu::callTraceArg(transpose);
+		args[4] = tcu::callTraceArg(value);
+	}
 	m_gl.programUniformMatrix4fv(program, location, count, transpose, value);
 }
 
@@ -3244,6 +6442,15 @@ void CallLogWrapper::glProgramUniformMatrix4x2dv (glw::GLuint program, glw::GLin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix4x2dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(430, 5);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(count);
+		args[3] = tcu::callTraceArg(transpose);
+		args[4] = tcu::callTraceArg(value);
+	}
 	m_gl.programUniformMatrix4x2dv(program, location, count, transpose, value);
 }
 
@@ -3251,6 +6458,15 @@ void CallLogWrapper::glProgramUniformMatrix4x2fv (glw::GLuint program, glw::GLin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix4x2fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 4*2)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(431, 5);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(count);
+		args[3] = tcu::callTraceArg(transpose);
+		args[4] = tcu::callTraceArg(value);
+	}
 	m_gl.programUniformMatrix4x2fv(program, location, count, transpose, value);
 }
 
@@ -3258,6 +6474,15 @@ void CallLogWrapper::glProgramUniformMatrix4x3dv (glw::GLuint program, glw::GLin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix4x3dv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(432, 5);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(count);
+		args[3] = tcu::callTraceArg(transpose);
+		args[4] = tcu::callTraceArg(value);
+	}
 	m_gl.programUniformMatrix4x3dv(program, location, count, transpose, value);
 }
 
@@ -3265,6 +6490,15 @@ void CallLogWrapper::glProgramUniformMatrix4x3fv (glw::GLuint program, glw::GLin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProgramUniformMatrix4x3fv(" << program << ", " << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 4*3)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(433, 5);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(location);
+		args[2] = tcu::callTraceArg(count);
+		args[3] = tcu::callTraceArg(transpose);
+		args[4] = tcu::callTraceArg(value);
+	}
 	m_gl.programUniformMatrix4x3fv(program, location, count, transpose, value);
 }
 
@@ -3272,6 +6506,11 @@ void CallLogWrapper::glProvokingVertex (glw::GLenum mode)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glProvokingVertex(" << getProvokingVertexStr(mode) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(434, 1);
+		args[0] = tcu::callTraceArg(mode);
+	}
 	m_gl.provokingVertex(mode);
 }
 
@@ -3279,6 +6518,14 @@ void CallLogWrapper::glPushDebugGroup (glw::GLenum source, glw::GLuint id, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPushDebugGroup(" << getDebugMessageSourceStr(source) << ", " << id << ", " << length << ", " << getStringStr(message) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(435, 4);
+		args[0] = tcu::callTraceArg(source);
+		args[1] = tcu::callTraceArg(id);
+		args[2] = tcu::callTraceArg(length);
+		args[3] = tcu::callTraceArg(message);
+	}
 	m_gl.pushDebugGroup(source, id, length, message);
 }
 
@@ -3286,6 +6533,12 @@ void CallLogWrapper::glPushGroupMarkerEXT (glw::GLsizei length, const glw::GLcha
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glPushGroupMarkerEXT(" << length << ", " << getStringStr(marker) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(436, 2);
+		args[0] = tcu::callTraceArg(length);
+		args[1] = tcu::callTraceArg(marker);
+	}
 	m_gl.pushGroupMarkerEXT(length, marker);
 }
 
@@ -3293,6 +6546,12 @@ void CallLogWrapper::glQueryCounter (glw::GLuint id, glw::GLenum target)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glQueryCounter(" << id << ", " << toHex(target) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(437, 2);
+		args[0] = tcu::callTraceArg(id);
+		args[1] = tcu::callTraceArg(target);
+	}
 	m_gl.queryCounter(id, target);
 }
 
@@ -3300,6 +6559,11 @@ void CallLogWrapper::glReadBuffer (glw::GLenum src)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glReadBuffer(" << getDrawReadBufferStr(src) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(438, 1);
+		args[0] = tcu::callTraceArg(src);
+	}
 	m_gl.readBuffer(src);
 }
 
@@ -3307,6 +6571,17 @@ void CallLogWrapper::glReadPixels (glw::GLint x, glw::GLint y, glw::GLsizei widt
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glReadPixels(" << x << ", " << y << ", " << width << ", " << height << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(439, 7);
+		args[0] = tcu::callTraceArg(x);
+		args[1] = tcu::callTraceArg(y);
+		args[2] = tcu::callTraceArg(width);
+		args[3] = tcu::callTraceArg(height);
+		args[4] = tcu::callTraceArg(format);
+		args[5] = tcu::callTraceArg(type);
+		args[6] = tcu::callTraceArg(pixels);
+	}
 	m_gl.readPixels(x, y, width, height, format, type, pixels);
 }
 
@@ -3314,6 +6589,18 @@ void CallLogWrapper::glReadnPixels (glw::GLint x, glw::GLint y, glw::GLsizei wid
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glReadnPixels(" << x << ", " << y << ", " << width << ", " << height << ", " << toHex(format) << ", " << toHex(type) << ", " << bufSize << ", " << data << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(440, 8);
+		args[0] = tcu::callTraceArg(x);
+		args[1] = tcu::callTraceArg(y);
+		args[2] = tcu::callTraceArg(width);
+		args[3] = tcu::callTraceArg(height);
+		args[4] = tcu::callTraceArg(format);
+		args[5] = tcu::callTraceArg(type);
+		args[6] = tcu::callTraceArg(bufSize);
+		args[7] = tcu::callTraceArg(data);
+	}
 	m_gl.readnPixels(x, y, width, height, format, type, bufSize, data);
 }
 
@@ -3321,6 +6608,8 @@ void CallLogWrapper::glReleaseShaderCompiler (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glReleaseShaderCompiler(" << ");" << TestLog::EndMessage;
+	if (m_trace)
+		m_trace->recordCall(441, 0);
 	m_gl.releaseShaderCompiler();
 }
 
@@ -3328,6 +6617,14 @@ void CallLogWrapper::glRenderbufferStorage (glw::GLenum target, glw::GLenum inte
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glRenderbufferStorage(" << getFramebufferTargetStr(target) << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(442, 4);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(internalformat);
+		args[2] = tcu::callTraceArg(width);
+		args[3] = tcu::callTraceArg(height);
+	}
 	m_gl.renderbufferStorage(target, internalformat, width, height);
 }
 
@@ -3335,6 +6632,15 @@ void CallLogWrapper::glRenderbufferStorageMultisample (glw::GLenum target, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glRenderbufferStorageMultisample(" << getFramebufferTargetStr(target) << ", " << samples << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(443, 5);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(samples);
+		args[2] = tcu::callTraceArg(internalformat);
+		args[3] = tcu::callTraceArg(width);
+		args[4] = tcu::callTraceArg(height);
+	}
 	m_gl.renderbufferStorageMultisample(target, samples, internalformat, width, height);
 }
 
@@ -3342,6 +6648,8 @@ void CallLogWrapper::glResumeTransformFeedback (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glResumeTransformFeedback(" << ");" << TestLog::EndMessage;
+	if (m_trace)
+		m_trace->recordCall(444, 0);
 	m_gl.resumeTransformFeedback();
 }
 
@@ -3349,6 +6657,12 @@ void CallLogWrapper::glSampleCoverage (glw::GLfloat value, glw::GLboolean invert
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glSampleCoverage(" << value << ", " << getBooleanStr(invert) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(445, 2);
+		args[0] = tcu::callTraceArg(value);
+		args[1] = tcu::callTraceArg(invert);
+	}
 	m_gl.sampleCoverage(value, invert);
 }
 
@@ -3356,6 +6670,12 @@ void CallLogWrapper::glSampleMaski (glw::GLuint maskNumber, glw::GLbitfield mask
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glSampleMaski(" << maskNumber << ", " << toHex(mask) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(446, 2);
+		args[0] = tcu::callTraceArg(maskNumber);
+		args[1] = tcu::callTraceArg(mask);
+	}
 	m_gl.sampleMaski(maskNumber, mask);
 }
 
@@ -3363,6 +6683,13 @@ void CallLogWrapper::glSamplerParameterIiv (glw::GLuint sampler, glw::GLenum pna
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glSamplerParameterIiv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(param, getTextureParamNumArgs(pname)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(447, 3);
+		args[0] = tcu::callTraceArg(sampler);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(param);
+	}
 	m_gl.samplerParameterIiv(sampler, pname, param);
 }
 
@@ -3370,6 +6697,13 @@ void CallLogWrapper::glSamplerParameterIuiv (glw::GLuint sampler, glw::GLenum pn
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glSamplerParameterIuiv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(param, getTextureParamNumArgs(pname)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(448, 3);
+		args[0] = tcu::callTraceArg(sampler);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(param);
+	}
 	m_gl.samplerParameterIuiv(sampler, pname, param);
 }
 
@@ -3377,6 +6711,13 @@ void CallLogWrapper::glSamplerParameterf (glw::GLuint sampler, glw::GLenum pname
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glSamplerParameterf(" << sampler << ", " << getTextureParameterStr(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(449, 3);
+		args[0] = tcu::callTraceArg(sampler);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(param);
+	}
 	m_gl.samplerParameterf(sampler, pname, param);
 }
 
@@ -3384,6 +6725,13 @@ void CallLogWrapper::glSamplerParameterfv (glw::GLuint sampler, glw::GLenum pnam
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glSamplerParameterfv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(param, getTextureParamNumArgs(pname)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(450, 3);
+		args[0] = tcu::callTraceArg(sampler);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(param);
+	}
 	m_gl.samplerParameterfv(sampler, pname, param);
 }
 
@@ -3391,6 +6739,13 @@ void CallLogWrapper::glSamplerParameteri (glw::GLuint sampler, glw::GLenum pname
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glSamplerParameteri(" << sampler << ", " << getTextureParameterStr(pname) << ", " << getTextureParameterValueStr(pname, param) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(451, 3);
+		args[0] = tcu::callTraceArg(sampler);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(param);
+	}
 	m_gl.samplerParameteri(sampler, pname, param);
 }
 
@@ -3398,6 +6753,13 @@ void CallLogWrapper::glSamplerParameteriv (glw::GLuint sampler, glw::GLenum pnam
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glSamplerParameteriv(" << sampler << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(param, getTextureParamNumArgs(pname)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(452, 3);
+		args[0] = tcu::callTraceArg(sampler);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(param);
+	}
 	m_gl.samplerParameteriv(sampler, pname, param);
 }
 
@@ -3405,6 +6767,14 @@ void CallLogWrapper::glScissor (glw::GLint x, glw::GLint y, glw::GLsizei width,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glScissor(" << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(453, 4);
+		args[0] = tcu::callTraceArg(x);
+		args[1] = tcu::callTraceArg(y);
+		args[2] = tcu::callTraceArg(width);
+		args[3] = tcu::callTraceArg(height);
+	}
 	m_gl.scissor(x, y, width, height);
 }
 
@@ -3412,6 +6782,13 @@ void CallLogWrapper::glScissorArrayv (glw::GLuint first, glw::GLsizei count, con
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glScissorArrayv(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(454, 3);
+		args[0] = tcu::callTraceArg(first);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(v);
+	}
 	m_gl.scissorArrayv(first, count, v);
 }
 
@@ -3419,6 +6796,15 @@ void CallLogWrapper::glScissorIndexed (glw::GLuint index, glw::GLint left, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glScissorIndexed(" << index << ", " << left << ", " << bottom << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(455, 5);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(left);
+		args[2] = tcu::callTraceArg(bottom);
+		args[3] = tcu::callTraceArg(width);
+		args[4] = tcu::callTraceArg(height);
+	}
 	m_gl.scissorIndexed(index, left, bottom, width, height);
 }
 
@@ -3426,6 +6812,12 @@ void CallLogWrapper::glScissorIndexedv (glw::GLuint index, const glw::GLint *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glScissorIndexedv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(456, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(v);
+	}
 	m_gl.scissorIndexedv(index, v);
 }
 
@@ -3433,6 +6825,15 @@ void CallLogWrapper::glShaderBinary (glw::GLsizei count, const glw::GLuint *shad
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glShaderBinary(" << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(shaders))) << ", " << toHex(binaryformat) << ", " << binary << ", " << length << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(457, 5);
+		args[0] = tcu::callTraceArg(count);
+		args[1] = tcu::callTraceArg(shaders);
+		args[2] = tcu::callTraceArg(binaryformat);
+		args[3] = tcu::callTraceArg(binary);
+		args[4] = tcu::callTraceArg(length);
+	}
 	m_gl.shaderBinary(count, shaders, binaryformat, binary, length);
 }
 
@@ -3440,6 +6841,14 @@ void CallLogWrapper::glShaderSource (glw::GLuint shader, glw::GLsizei count, con
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glShaderSource(" << shader << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(string))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(length))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(458, 4);
+		args[0] = tcu::callTraceArg(shader);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(string);
+		args[3] = tcu::callTraceArg(length);
+	}
 	m_gl.shaderSource(shader, count, string, length);
 }
 
@@ -3447,6 +6856,13 @@ void CallLogWrapper::glShaderStorageBlockBinding (glw::GLuint program, glw::GLui
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glShaderStorageBlockBinding(" << program << ", " << storageBlockIndex << ", " << storageBlockBinding << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(459, 3);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(storageBlockIndex);
+		args[2] = tcu::callTraceArg(storageBlockBinding);
+	}
 	m_gl.shaderStorageBlockBinding(program, storageBlockIndex, storageBlockBinding);
 }
 
@@ -3454,6 +6870,13 @@ void CallLogWrapper::glStencilFunc (glw::GLenum func, glw::GLint ref, glw::GLuin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glStencilFunc(" << getCompareFuncStr(func) << ", " << ref << ", " << mask << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(460, 3);
+		args[0] = tcu::callTraceArg(func);
+		args[1] = tcu::callTraceArg(ref);
+		args[2] = tcu::callTraceArg(mask);
+	}
 	m_gl.stencilFunc(func, ref, mask);
 }
 
@@ -3461,6 +6884,14 @@ void CallLogWrapper::glStencilFuncSeparate (glw::GLenum face, glw::GLenum func,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glStencilFuncSeparate(" << getFaceStr(face) << ", " << getCompareFuncStr(func) << ", " << ref << ", " << mask << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(461, 4);
+		args[0] = tcu::callTraceArg(face);
+		args[1] = tcu::callTraceArg(func);
+		args[2] = tcu::callTraceArg(ref);
+		args[3] = tcu::callTraceArg(mask);
+	}
 	m_gl.stencilFuncSeparate(face, func, ref, mask);
 }
 
@@ -3468,6 +6899,11 @@ void CallLogWrapper::glStencilMask (glw::GLuint mask)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glStencilMask(" << mask << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(462, 1);
+		args[0] = tcu::callTraceArg(mask);
+	}
 	m_gl.stencilMask(mask);
 }
 
@@ -3475,6 +6911,12 @@ void CallLogWrapper::glStencilMaskSeparate (glw::GLenum face, glw::GLuint mask)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glStencilMaskSeparate(" << getFaceStr(face) << ", " << mask << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(463, 2);
+		args[0] = tcu::callTraceArg(face);
+		args[1] = tcu::callTraceArg(mask);
+	}
 	m_gl.stencilMaskSeparate(face, mask);
 }
 
@@ -3482,6 +6924,13 @@ void CallLogWrapper::glStencilOp (glw::GLenum fail, glw::GLenum zfail, glw::GLen
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glStencilOp(" << getStencilOpStr(fail) << ", " << getStencilOpStr(zfail) << ", " << getStencilOpStr(zpass) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(464, 3);
+		args[0] = tcu::callTraceArg(fail);
+		args[1] = tcu::callTraceArg(zfail);
+		args[2] = tcu::callTraceArg(zpass);
+	}
 	m_gl.stencilOp(fail, zfail, zpass);
 }
 
@@ -3489,6 +6938,14 @@ void CallLogWrapper::glStencilOpSeparate (glw::GLenum face, glw::GLenum sfail, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glStencilOpSeparate(" << getFaceStr(face) << ", " << getStencilOpStr(sfail) << ", " << getStencilOpStr(dpfail) << ", " << getStencilOpStr(dppass) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(465, 4);
+		args[0] = tcu::callTraceArg(face);
+		args[1] = tcu::callTraceArg(sfail);
+		args[2] = tcu::callTraceArg(dpfail);
+		args[3] = tcu::callTraceArg(dppass);
+	}
 	m_gl.stencilOpSeparate(face, sfail, dpfail, dppass);
 }
 
@@ -3496,6 +6953,13 @@ void CallLogWrapper::glTexBuffer (glw::GLenum target, glw::GLenum internalformat
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexBuffer(" << getBufferTargetStr(target) << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << buffer << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(466, 3);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(internalformat);
+		args[2] = tcu::callTraceArg(buffer);
+	}
 	m_gl.texBuffer(target, internalformat, buffer);
 }
 
@@ -3503,6 +6967,15 @@ void CallLogWrapper::glTexBufferRange (glw::GLenum target, glw::GLenum internalf
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexBufferRange(" << getBufferTargetStr(target) << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << buffer << ", " << offset << ", " << size << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(467, 5);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(internalformat);
+		args[2] = tcu::callTraceArg(buffer);
+		args[3] = tcu::callTraceArg(offset);
+		args[4] = tcu::callTraceArg(size);
+	}
 	m_gl.texBufferRange(target, internalformat, buffer, offset, size);
 }
 
@@ -3510,6 +6983,18 @@ void CallLogWrapper::glTexImage1D (glw::GLenum target, glw::GLint level, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexImage1D(" << getTextureTargetStr(target) << ", " << level << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << border << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(468, 8);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(level);
+		args[2] = tcu::callTraceArg(internalformat);
+		args[3] = tcu::callTraceArg(width);
+		args[4] = tcu::callTraceArg(border);
+		args[5] = tcu::callTraceArg(format);
+		args[6] = tcu::callTraceArg(type);
+		args[7] = tcu::callTraceArg(pixels);
+	}
 	m_gl.texImage1D(target, level, internalformat, width, border, format, type, pixels);
 }
 
@@ -3517,6 +7002,19 @@ void CallLogWrapper::glTexImage2D (glw::GLenum target, glw::GLint level, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexImage2D(" << getTextureTargetStr(target) << ", " << level << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << border << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(469, 9);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(level);
+		args[2] = tcu::callTraceArg(internalformat);
+		args[3] = tcu::callTraceArg(width);
+		args[4] = tcu::callTraceArg(height);
+		args[5] = tcu::callTraceArg(border);
+		args[6] = tcu::callTraceArg(format);
+		args[7] = tcu::callTraceArg(type);
+		args[8] = tcu::callTraceArg(pixels);
+	}
 	m_gl.texImage2D(target, level, internalformat, width, height, border, format, type, pixels);
 }
 
@@ -3524,6 +7022,16 @@ void CallLogWrapper::glTexImage2DMultisample (glw::GLenum target, glw::GLsizei s
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexImage2DMultisample(" << getTextureTargetStr(target) << ", " << samples << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << getBooleanStr(fixedsamplelocations) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(470, 6);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(samples);
+		args[2] = tcu::callTraceArg(internalformat);
+		args[3] = tcu::callTraceArg(width);
+		args[4] = tcu::callTraceArg(height);
+		args[5] = tcu::callTraceArg(fixedsamplelocations);
+	}
 	m_gl.texImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
 }
 
@@ -3531,6 +7039,20 @@ void CallLogWrapper::glTexImage3D (glw::GLenum target, glw::GLint level, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexImage3D(" << getTextureTargetStr(target) << ", " << level << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << border << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(471, 10);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(level);
+		args[2] = tcu::callTraceArg(internalformat);
+		args[3] = tcu::callTraceArg(width);
+		args[4] = tcu::callTraceArg(height);
+		args[5] = tcu::callTraceArg(depth);
+		args[6] = tcu::callTraceArg(border);
+		args[7] = tcu::callTraceArg(format);
+		args[8] = tcu::callTraceArg(type);
+		args[9] = tcu::callTraceArg(pixels);
+	}
 	m_gl.texImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
 }
 
@@ -3538,6 +7060,17 @@ void CallLogWrapper::glTexImage3DMultisample (glw::GLenum target, glw::GLsizei s
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexImage3DMultisample(" << toHex(target) << ", " << samples << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << getBooleanStr(fixedsamplelocations) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(472, 7);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(samples);
+		args[2] = tcu::callTraceArg(internalformat);
+		args[3] = tcu::callTraceArg(width);
+		args[4] = tcu::callTraceArg(height);
+		args[5] = tcu::callTraceArg(depth);
+		args[6] = tcu::callTraceArg(fixedsamplelocations);
+	}
 	m_gl.texImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
 }
 
@@ -3545,6 +7078,13 @@ void CallLogWrapper::glTexParameterIiv (glw::GLenum target, glw::GLenum pname, c
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexParameterIiv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(params, getTextureParamNumArgs(pname)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(473, 3);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.texParameterIiv(target, pname, params);
 }
 
@@ -3552,6 +7092,13 @@ void CallLogWrapper::glTexParameterIuiv (glw::GLenum target, glw::GLenum pname,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexParameterIuiv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(params, getTextureParamNumArgs(pname)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(474, 3);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.texParameterIuiv(target, pname, params);
 }
 
@@ -3559,6 +7106,13 @@ void CallLogWrapper::glTexParameterf (glw::GLenum target, glw::GLenum pname, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexParameterf(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(475, 3);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(param);
+	}
 	m_gl.texParameterf(target, pname, param);
 }
 
@@ -3566,6 +7120,13 @@ void CallLogWrapper::glTexParameterfv (glw::GLenum target, glw::GLenum pname, co
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexParameterfv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(params, getTextureParamNumArgs(pname)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(476, 3);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.texParameterfv(target, pname, params);
 }
 
@@ -3573,6 +7134,13 @@ void CallLogWrapper::glTexParameteri (glw::GLenum target, glw::GLenum pname, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexParameteri(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << getTextureParameterValueStr(pname, param) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(477, 3);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(param);
+	}
 	m_gl.texParameteri(target, pname, param);
 }
 
@@ -3580,6 +7148,13 @@ void CallLogWrapper::glTexParameteriv (glw::GLenum target, glw::GLenum pname, co
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexParameteriv(" << getTextureTargetStr(target) << ", " << getTextureParameterStr(pname) << ", " << getPointerStr(params, getTextureParamNumArgs(pname)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(478, 3);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.texParameteriv(target, pname, params);
 }
 
@@ -3587,6 +7162,14 @@ void CallLogWrapper::glTexStorage1D (glw::GLenum target, glw::GLsizei levels, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexStorage1D(" << toHex(target) << ", " << levels << ", " << toHex(internalformat) << ", " << width << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(479, 4);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(levels);
+		args[2] = tcu::callTraceArg(internalformat);
+		args[3] = tcu::callTraceArg(width);
+	}
 	m_gl.texStorage1D(target, levels, internalformat, width);
 }
 
@@ -3594,6 +7177,15 @@ void CallLogWrapper::glTexStorage2D (glw::GLenum target, glw::GLsizei levels, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexStorage2D(" << getTextureTargetStr(target) << ", " << levels << ", " << getTextureFormatStr(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(480, 5);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(levels);
+		args[2] = tcu::callTraceArg(internalformat);
+		args[3] = tcu::callTraceArg(width);
+		args[4] = tcu::callTraceArg(height);
+	}
 	m_gl.texStorage2D(target, levels, internalformat, width, height);
 }
 
@@ -3601,6 +7193,16 @@ void CallLogWrapper::glTexStorage2DMultisample (glw::GLenum target, glw::GLsizei
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexStorage2DMultisample(" << getTextureTargetStr(target) << ", " << samples << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << getBooleanStr(fixedsamplelocations) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(481, 6);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(samples);
+		args[2] = tcu::callTraceArg(internalformat);
+		args[3] = tcu::callTraceArg(width);
+		args[4] = tcu::callTraceArg(height);
+		args[5] = tcu::callTraceArg(fixedsamplelocations);
+	}
 	m_gl.texStorage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
 }
 
@@ -3608,6 +7210,16 @@ void CallLogWrapper::glTexStorage3D (glw::GLenum target, glw::GLsizei levels, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexStorage3D(" << getTextureTargetStr(target) << ", " << levels << ", " << getTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << depth << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(482, 6);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(levels);
+		args[2] = tcu::callTraceArg(internalformat);
+		args[3] = tcu::callTraceArg(width);
+		args[4] = tcu::callTraceArg(height);
+		args[5] = tcu::callTraceArg(depth);
+	}
 	m_gl.texStorage3D(target, levels, internalformat, width, height, depth);
 }
 
@@ -3615,6 +7227,17 @@ void CallLogWrapper::glTexStorage3DMultisample (glw::GLenum target, glw::GLsizei
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexStorage3DMultisample(" << getTextureTargetStr(target) << ", " << samples << ", " << getUncompressedTextureFormatStr(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << getBooleanStr(fixedsamplelocations) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(483, 7);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(samples);
+		args[2] = tcu::callTraceArg(internalformat);
+		args[3] = tcu::callTraceArg(width);
+		args[4] = tcu::callTraceArg(height);
+		args[5] = tcu::callTraceArg(depth);
+		args[6] = tcu::callTraceArg(fixedsamplelocations);
+	}
 	m_gl.texStorage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
 }
 
@@ -3622,6 +7245,17 @@ void CallLogWrapper::glTexSubImage1D (glw::GLenum target, glw::GLint level, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexSubImage1D(" << getTextureTargetStr(target) << ", " << level << ", " << xoffset << ", " << width << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(484, 7);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(level);
+		args[2] = tcu::callTraceArg(xoffset);
+		args[3] = tcu::callTraceArg(width);
+		args[4] = tcu::callTraceArg(format);
+		args[5] = tcu::callTraceArg(type);
+		args[6] = tcu::callTraceArg(pixels);
+	}
 	m_gl.texSubImage1D(target, level, xoffset, width, format, type, pixels);
 }
 
@@ -3629,6 +7263,19 @@ void CallLogWrapper::glTexSubImage2D (glw::GLenum target, glw::GLint level, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexSubImage2D(" << getTextureTargetStr(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(485, 9);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(level);
+		args[2] = tcu::callTraceArg(xoffset);
+		args[3] = tcu::callTraceArg(yoffset);
+		args[4] = tcu::callTraceArg(width);
+		args[5] = tcu::callTraceArg(height);
+		args[6] = tcu::callTraceArg(format);
+		args[7] = tcu::callTraceArg(type);
+		args[8] = tcu::callTraceArg(pixels);
+	}
 	m_gl.texSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
 }
 
@@ -3636,6 +7283,21 @@ void CallLogWrapper::glTexSubImage3D (glw::GLenum target, glw::GLint level, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTexSubImage3D(" << getTextureTargetStr(target) << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << getUncompressedTextureFormatStr(format) << ", " << getTypeStr(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(486, 11);
+		args[0] = tcu::callTraceArg(target);
+		args[1] = tcu::callTraceArg(level);
+		args[2] = tcu::callTraceArg(xoffset);
+		args[3] = tcu::callTraceArg(yoffset);
+		args[4] = tcu::callTraceArg(zoffset);
+		args[5] = tcu::callTraceArg(width);
+		args[6] = tcu::callTraceArg(height);
+		args[7] = tcu::callTraceArg(depth);
+		args[8] = tcu::callTraceArg(format);
+		args[9] = tcu::callTraceArg(type);
+		args[10] = tcu::callTraceArg(pixels);
+	}
 	m_gl.texSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
 }
 
@@ -3643,6 +7305,8 @@ void CallLogWrapper::glTextureBarrier (void)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureBarrier(" << ");" << TestLog::EndMessage;
+	if (m_trace)
+		m_trace->recordCall(487, 0);
 	m_gl.textureBarrier();
 }
 
@@ -3650,6 +7314,13 @@ void CallLogWrapper::glTextureBuffer (glw::GLuint texture, glw::GLenum internalf
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureBuffer(" << texture << ", " << toHex(internalformat) << ", " << buffer << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(488, 3);
+		args[0] = tcu::callTraceArg(texture);
+		args[1] = tcu::callTraceArg(internalformat);
+		args[2] = tcu::callTraceArg(buffer);
+	}
 	m_gl.textureBuffer(texture, internalformat, buffer);
 }
 
@@ -3657,6 +7328,15 @@ void CallLogWrapper::glTextureBufferRange (glw::GLuint texture, glw::GLenum inte
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureBufferRange(" << texture << ", " << toHex(internalformat) << ", " << buffer << ", " << offset << ", " << size << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(489, 5);
+		args[0] = tcu::callTraceArg(texture);
+		args[1] = tcu::callTraceArg(internalformat);
+		args[2] = tcu::callTraceArg(buffer);
+		args[3] = tcu::callTraceArg(offset);
+		args[4] = tcu::callTraceArg(size);
+	}
 	m_gl.textureBufferRange(texture, internalformat, buffer, offset, size);
 }
 
@@ -3664,6 +7344,13 @@ void CallLogWrapper::glTextureParameterIiv (glw::GLuint texture, glw::GLenum pna
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureParameterIiv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(490, 3);
+		args[0] = tcu::callTraceArg(texture);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.textureParameterIiv(texture, pname, params);
 }
 
@@ -3671,6 +7358,13 @@ void CallLogWrapper::glTextureParameterIuiv (glw::GLuint texture, glw::GLenum pn
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureParameterIuiv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(params))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(491, 3);
+		args[0] = tcu::callTraceArg(texture);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(params);
+	}
 	m_gl.textureParameterIuiv(texture, pname, params);
 }
 
@@ -3678,6 +7372,13 @@ void CallLogWrapper::glTextureParameterf (glw::GLuint texture, glw::GLenum pname
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureParameterf(" << texture << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(492, 3);
+		args[0] = tcu::callTraceArg(texture);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(param);
+	}
 	m_gl.textureParameterf(texture, pname, param);
 }
 
@@ -3685,6 +7386,13 @@ void CallLogWrapper::glTextureParameterfv (glw::GLuint texture, glw::GLenum pnam
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureParameterfv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(493, 3);
+		args[0] = tcu::callTraceArg(texture);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(param);
+	}
 	m_gl.textureParameterfv(texture, pname, param);
 }
 
@@ -3692,6 +7400,13 @@ void CallLogWrapper::glTextureParameteri (glw::GLuint texture, glw::GLenum pname
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureParameteri(" << texture << ", " << toHex(pname) << ", " << param << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(494, 3);
+		args[0] = tcu::callTraceArg(texture);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(param);
+	}
 	m_gl.textureParameteri(texture, pname, param);
 }
 
@@ -3699,6 +7414,13 @@ void CallLogWrapper::glTextureParameteriv (glw::GLuint texture, glw::GLenum pnam
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureParameteriv(" << texture << ", " << toHex(pname) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(param))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(495, 3);
+		args[0] = tcu::callTraceArg(texture);
+		args[1] = tcu::callTraceArg(pname);
+		args[2] = tcu::callTraceArg(param);
+	}
 	m_gl.textureParameteriv(texture, pname, param);
 }
 
@@ -3706,6 +7428,14 @@ void CallLogWrapper::glTextureStorage1D (glw::GLuint texture, glw::GLsizei level
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureStorage1D(" << texture << ", " << levels << ", " << toHex(internalformat) << ", " << width << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(496, 4);
+		args[0] = tcu::callTraceArg(texture);
+		args[1] = tcu::callTraceArg(levels);
+		args[2] = tcu::callTraceArg(internalformat);
+		args[3] = tcu::callTraceArg(width);
+	}
 	m_gl.textureStorage1D(texture, levels, internalformat, width);
 }
 
@@ -3713,6 +7443,15 @@ void CallLogWrapper::glTextureStorage2D (glw::GLuint texture, glw::GLsizei level
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureStorage2D(" << texture << ", " << levels << ", " << toHex(internalformat) << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(497, 5);
+		args[0] = tcu::callTraceArg(texture);
+		args[1] = tcu::callTraceArg(levels);
+		args[2] = tcu::callTraceArg(internalformat);
+		args[3] = tcu::callTraceArg(width);
+		args[4] = tcu::callTraceArg(height);
+	}
 	m_gl.textureStorage2D(texture, levels, internalformat, width, height);
 }
 
@@ -3720,6 +7459,16 @@ void CallLogWrapper::glTextureStorage2DMultisample (glw::GLuint texture, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureStorage2DMultisample(" << texture << ", " << samples << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << getBooleanStr(fixedsamplelocations) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(498, 6);
+		args[0] = tcu::callTraceArg(texture);
+		args[1] = tcu::callTraceArg(samples);
+		args[2] = tcu::callTraceArg(internalformat);
+		args[3] = tcu::callTraceArg(width);
+		args[4] = tcu::callTraceArg(height);
+		args[5] = tcu::callTraceArg(fixedsamplelocations);
+	}
 	m_gl.textureStorage2DMultisample(texture, samples, internalformat, width, height, fixedsamplelocations);
 }
 
@@ -3727,6 +7476,16 @@ void CallLogWrapper::glTextureStorage3D (glw::GLuint texture, glw::GLsizei level
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureStorage3D(" << texture << ", " << levels << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(499, 6);
+		args[0] = tcu::callTraceArg(texture);
+		args[1] = tcu::callTraceArg(levels);
+		args[2] = tcu::callTraceArg(internalformat);
+		args[3] = tcu::callTraceArg(width);
+		args[4] = tcu::callTraceArg(height);
+		args[5] = tcu::callTraceArg(depth);
+	}
 	m_gl.textureStorage3D(texture, levels, internalformat, width, height, depth);
 }
 
@@ -3734,6 +7493,17 @@ void CallLogWrapper::glTextureStorage3DMultisample (glw::GLuint texture, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureStorage3DMultisample(" << texture << ", " << samples << ", " << toHex(internalformat) << ", " << width << ", " << height << ", " << depth << ", " << getBooleanStr(fixedsamplelocations) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(500, 7);
+		args[0] = tcu::callTraceArg(texture);
+		args[1] = tcu::callTraceArg(samples);
+		args[2] = tcu::callTraceArg(internalformat);
+		args[3] = tcu::callTraceArg(width);
+		args[4] = tcu::callTraceArg(height);
+		args[5] = tcu::callTraceArg(depth);
+		args[6] = tcu::callTraceArg(fixedsamplelocations);
+	}
 	m_gl.textureStorage3DMultisample(texture, samples, internalformat, width, height, depth, fixedsamplelocations);
 }
 
@@ -3741,6 +7511,17 @@ void CallLogWrapper::glTextureSubImage1D (glw::GLuint texture, glw::GLint level,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureSubImage1D(" << texture << ", " << level << ", " << xoffset << ", " << width << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(501, 7);
+		args[0] = tcu::callTraceArg(texture);
+		args[1] = tcu::callTraceArg(level);
+		args[2] = tcu::callTraceArg(xoffset);
+		args[3] = tcu::callTraceArg(width);
+		args[4] = tcu::callTraceArg(format);
+		args[5] = tcu::callTraceArg(type);
+		args[6] = tcu::callTraceArg(pixels);
+	}
 	m_gl.textureSubImage1D(texture, level, xoffset, width, format, type, pixels);
 }
 
@@ -3748,6 +7529,19 @@ void CallLogWrapper::glTextureSubImage2D (glw::GLuint texture, glw::GLint level,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureSubImage2D(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << width << ", " << height << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(502, 9);
+		args[0] = tcu::callTraceArg(texture);
+		args[1] = tcu::callTraceArg(level);
+		args[2] = tcu::callTraceArg(xoffset);
+		args[3] = tcu::callTraceArg(yoffset);
+		args[4] = tcu::callTraceArg(width);
+		args[5] = tcu::callTraceArg(height);
+		args[6] = tcu::callTraceArg(format);
+		args[7] = tcu::callTraceArg(type);
+		args[8] = tcu::callTraceArg(pixels);
+	}
 	m_gl.textureSubImage2D(texture, level, xoffset, yoffset, width, height, format, type, pixels);
 }
 
@@ -3755,6 +7549,21 @@ void CallLogWrapper::glTextureSubImage3D (glw::GLuint texture, glw::GLint level,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureSubImage3D(" << texture << ", " << level << ", " << xoffset << ", " << yoffset << ", " << zoffset << ", " << width << ", " << height << ", " << depth << ", " << toHex(format) << ", " << toHex(type) << ", " << pixels << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(503, 11);
+		args[0] = tcu::callTraceArg(texture);
+		args[1] = tcu::callTraceArg(level);
+		args[2] = tcu::callTraceArg(xoffset);
+		args[3] = tcu::callTraceArg(yoffset);
+		args[4] = tcu::callTraceArg(zoffset);
+		args[5] = tcu::callTraceArg(width);
+		args[6] = tcu::callTraceArg(height);
+		args[7] = tcu::callTraceArg(depth);
+		args[8] = tcu::callTraceArg(format);
+		args[9] = tcu::callTraceArg(type);
+		args[10] = tcu::callTraceArg(pixels);
+	}
 	m_gl.textureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
 }
 
@@ -3762,6 +7571,18 @@ void CallLogWrapper::glTextureView (glw::GLuint texture, glw::GLenum target, glw
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTextureView(" << texture << ", " << toHex(target) << ", " << origtexture << ", " << toHex(internalformat) << ", " << minlevel << ", " << numlevels << ", " << minlayer << ", " << numlayers << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(504, 8);
+		args[0] = tcu::callTraceArg(texture);
+		args[1] = tcu::callTraceArg(target);
+		args[2] = tcu::callTraceArg(origtexture);
+		args[3] = tcu::callTraceArg(internalformat);
+		args[4] = tcu::callTraceArg(minlevel);
+		args[5] = tcu::callTraceArg(numlevels);
+		args[6] = tcu::callTraceArg(minlayer);
+		args[7] = tcu::callTraceArg(numlayers);
+	}
 	m_gl.textureView(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
 }
 
@@ -3769,6 +7590,13 @@ void CallLogWrapper::glTransformFeedbackBufferBase (glw::GLuint xfb, glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTransformFeedbackBufferBase(" << xfb << ", " << index << ", " << buffer << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(505, 3);
+		args[0] = tcu::callTraceArg(xfb);
+		args[1] = tcu::callTraceArg(index);
+		args[2] = tcu::callTraceArg(buffer);
+	}
 	m_gl.transformFeedbackBufferBase(xfb, index, buffer);
 }
 
@@ -3776,6 +7604,15 @@ void CallLogWrapper::glTransformFeedbackBufferRange (glw::GLuint xfb, glw::GLuin
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTransformFeedbackBufferRange(" << xfb << ", " << index << ", " << buffer << ", " << offset << ", " << size << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(506, 5);
+		args[0] = tcu::callTraceArg(xfb);
+		args[1] = tcu::callTraceArg(index);
+		args[2] = tcu::callTraceArg(buffer);
+		args[3] = tcu::callTraceArg(offset);
+		args[4] = tcu::callTraceArg(size);
+	}
 	m_gl.transformFeedbackBufferRange(xfb, index, buffer, offset, size);
 }
 
@@ -3783,6 +7620,14 @@ void CallLogWrapper::glTransformFeedbackVaryings (glw::GLuint program, glw::GLsi
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glTransformFeedbackVaryings(" << program << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(varyings))) << ", " << toHex(bufferMode) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(507, 4);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(varyings);
+		args[3] = tcu::callTraceArg(bufferMode);
+	}
 	m_gl.transformFeedbackVaryings(program, count, varyings, bufferMode);
 }
 
@@ -3790,6 +7635,12 @@ void CallLogWrapper::glUniform1d (glw::GLint location, glw::GLdouble x)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform1d(" << location << ", " << x << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(508, 2);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(x);
+	}
 	m_gl.uniform1d(location, x);
 }
 
@@ -3797,6 +7648,13 @@ void CallLogWrapper::glUniform1dv (glw::GLint location, glw::GLsizei count, cons
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform1dv(" << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(509, 3);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(value);
+	}
 	m_gl.uniform1dv(location, count, value);
 }
 
@@ -3804,6 +7662,12 @@ void CallLogWrapper::glUniform1f (glw::GLint location, glw::GLfloat v0)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform1f(" << location << ", " << v0 << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(510, 2);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(v0);
+	}
 	m_gl.uniform1f(location, v0);
 }
 
@@ -3811,6 +7675,13 @@ void CallLogWrapper::glUniform1fv (glw::GLint location, glw::GLsizei count, cons
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform1fv(" << location << ", " << count << ", " << getPointerStr(value, (count * 1)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(511, 3);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(value);
+	}
 	m_gl.uniform1fv(location, count, value);
 }
 
@@ -3818,6 +7689,12 @@ void CallLogWrapper::glUniform1i (glw::GLint location, glw::GLint v0)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform1i(" << location << ", " << v0 << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(512, 2);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(v0);
+	}
 	m_gl.uniform1i(location, v0);
 }
 
@@ -3825,6 +7702,13 @@ void CallLogWrapper::glUniform1iv (glw::GLint location, glw::GLsizei count, cons
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform1iv(" << location << ", " << count << ", " << getPointerStr(value, (count * 1)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(513, 3);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(value);
+	}
 	m_gl.uniform1iv(location, count, value);
 }
 
@@ -3832,6 +7716,12 @@ void CallLogWrapper::glUniform1ui (glw::GLint location, glw::GLuint v0)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform1ui(" << location << ", " << v0 << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(514, 2);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(v0);
+	}
 	m_gl.uniform1ui(location, v0);
 }
 
@@ -3839,6 +7729,13 @@ void CallLogWrapper::glUniform1uiv (glw::GLint location, glw::GLsizei count, con
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform1uiv(" << location << ", " << count << ", " << getPointerStr(value, (count * 1)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(515, 3);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(value);
+	}
 	m_gl.uniform1uiv(location, count, value);
 }
 
@@ -3846,6 +7743,13 @@ void CallLogWrapper::glUniform2d (glw::GLint location, glw::GLdouble x, glw::GLd
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform2d(" << location << ", " << x << ", " << y << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(516, 3);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(x);
+		args[2] = tcu::callTraceArg(y);
+	}
 	m_gl.uniform2d(location, x, y);
 }
 
@@ -3853,6 +7757,13 @@ void CallLogWrapper::glUniform2dv (glw::GLint location, glw::GLsizei count, cons
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform2dv(" << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(517, 3);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(value);
+	}
 	m_gl.uniform2dv(location, count, value);
 }
 
@@ -3860,6 +7771,13 @@ void CallLogWrapper::glUniform2f (glw::GLint location, glw::GLfloat v0, glw::GLf
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform2f(" << location << ", " << v0 << ", " << v1 << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(518, 3);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(v0);
+		args[2] = tcu::callTraceArg(v1);
+	}
 	m_gl.uniform2f(location, v0, v1);
 }
 
@@ -3867,6 +7785,13 @@ void CallLogWrapper::glUniform2fv (glw::GLint location, glw::GLsizei count, cons
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform2fv(" << location << ", " << count << ", " << getPointerStr(value, (count * 2)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(519, 3);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(value);
+	}
 	m_gl.uniform2fv(location, count, value);
 }
 
@@ -3874,6 +7799,13 @@ void CallLogWrapper::glUniform2i (glw::GLint location, glw::GLint v0, glw::GLint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform2i(" << location << ", " << v0 << ", " << v1 << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(520, 3);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(v0);
+		args[2] = tcu::callTraceArg(v1);
+	}
 	m_gl.uniform2i(location, v0, v1);
 }
 
@@ -3881,6 +7813,13 @@ void CallLogWrapper::glUniform2iv (glw::GLint location, glw::GLsizei count, cons
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform2iv(" << location << ", " << count << ", " << getPointerStr(value, (count * 2)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(521, 3);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(value);
+	}
 	m_gl.uniform2iv(location, count, value);
 }
 
@@ -3888,6 +7827,13 @@ void CallLogWrapper::glUniform2ui (glw::GLint location, glw::GLuint v0, glw::GLu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform2ui(" << location << ", " << v0 << ", " << v1 << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(522, 3);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(v0);
+		args[2] = tcu::callTraceArg(v1);
+	}
 	m_gl.uniform2ui(location, v0, v1);
 }
 
@@ -3895,6 +7841,13 @@ void CallLogWrapper::glUniform2uiv (glw::GLint location, glw::GLsizei count, con
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform2uiv(" << location << ", " << count << ", " << getPointerStr(value, (count * 2)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(523, 3);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(value);
+	}
 	m_gl.uniform2uiv(location, count, value);
 }
 
@@ -3902,6 +7855,14 @@ void CallLogWrapper::glUniform3d (glw::GLint location, glw::GLdouble x, glw::GLd
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform3d(" << location << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(524, 4);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(x);
+		args[2] = tcu::callTraceArg(y);
+		args[3] = tcu::callTraceArg(z);
+	}
 	m_gl.uniform3d(location, x, y, z);
 }
 
@@ -3909,6 +7870,13 @@ void CallLogWrapper::glUniform3dv (glw::GLint location, glw::GLsizei count, cons
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform3dv(" << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(525, 3);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(value);
+	}
 	m_gl.uniform3dv(location, count, value);
 }
 
@@ -3916,6 +7884,14 @@ void CallLogWrapper::glUniform3f (glw::GLint location, glw::GLfloat v0, glw::GLf
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform3f(" << location << ", " << v0 << ", " << v1 << ", " << v2 << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(526, 4);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(v0);
+		args[2] = tcu::callTraceArg(v1);
+		args[3] = tcu::callTraceArg(v2);
+	}
 	m_gl.uniform3f(location, v0, v1, v2);
 }
 
@@ -3923,6 +7899,13 @@ void CallLogWrapper::glUniform3fv (glw::GLint location, glw::GLsizei count, cons
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform3fv(" << location << ", " << count << ", " << getPointerStr(value, (count * 3)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(527, 3);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(value);
+	}
 	m_gl.uniform3fv(location, count, value);
 }
 
@@ -3930,6 +7913,14 @@ void CallLogWrapper::glUniform3i (glw::GLint location, glw::GLint v0, glw::GLint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform3i(" << location << ", " << v0 << ", " << v1 << ", " << v2 << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(528, 4);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(v0);
+		args[2] = tcu::callTraceArg(v1);
+		args[3] = tcu::callTraceArg(v2);
+	}
 	m_gl.uniform3i(location, v0, v1, v2);
 }
 
@@ -3937,6 +7928,13 @@ void CallLogWrapper::glUniform3iv (glw::GLint location, glw::GLsizei count, cons
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform3iv(" << location << ", " << count << ", " << getPointerStr(value, (count * 3)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(529, 3);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(value);
+	}
 	m_gl.uniform3iv(location, count, value);
 }
 
@@ -3944,6 +7942,14 @@ void CallLogWrapper::glUniform3ui (glw::GLint location, glw::GLuint v0, glw::GLu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform3ui(" << location << ", " << v0 << ", " << v1 << ", " << v2 << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(530, 4);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(v0);
+		args[2] = tcu::callTraceArg(v1);
+		args[3] = tcu::callTraceArg(v2);
+	}
 	m_gl.uniform3ui(location, v0, v1, v2);
 }
 
@@ -3951,6 +7957,13 @@ void CallLogWrapper::glUniform3uiv (glw::GLint location, glw::GLsizei count, con
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform3uiv(" << location << ", " << count << ", " << getPointerStr(value, (count * 3)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(531, 3);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(value);
+	}
 	m_gl.uniform3uiv(location, count, value);
 }
 
@@ -3958,6 +7971,15 @@ void CallLogWrapper::glUniform4d (glw::GLint location, glw::GLdouble x, glw::GLd
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform4d(" << location << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(532, 5);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(x);
+		args[2] = tcu::callTraceArg(y);
+		args[3] = tcu::callTraceArg(z);
+		args[4] = tcu::callTraceArg(w);
+	}
 	m_gl.uniform4d(location, x, y, z, w);
 }
 
@@ -3965,6 +7987,13 @@ void CallLogWrapper::glUniform4dv (glw::GLint location, glw::GLsizei count, cons
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform4dv(" << location << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(533, 3);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(value);
+	}
 	m_gl.uniform4dv(location, count, value);
 }
 
@@ -3972,6 +8001,15 @@ void CallLogWrapper::glUniform4f (glw::GLint location, glw::GLfloat v0, glw::GLf
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform4f(" << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(534, 5);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(v0);
+		args[2] = tcu::callTraceArg(v1);
+		args[3] = tcu::callTraceArg(v2);
+		args[4] = tcu::callTraceArg(v3);
+	}
 	m_gl.uniform4f(location, v0, v1, v2, v3);
 }
 
@@ -3979,6 +8017,13 @@ void CallLogWrapper::glUniform4fv (glw::GLint location, glw::GLsizei count, cons
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform4fv(" << location << ", " << count << ", " << getPointerStr(value, (count * 4)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(535, 3);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(value);
+	}
 	m_gl.uniform4fv(location, count, value);
 }
 
@@ -3986,6 +8031,15 @@ void CallLogWrapper::glUniform4i (glw::GLint location, glw::GLint v0, glw::GLint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform4i(" << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(536, 5);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(v0);
+		args[2] = tcu::callTraceArg(v1);
+		args[3] = tcu::callTraceArg(v2);
+		args[4] = tcu::callTraceArg(v3);
+	}
 	m_gl.uniform4i(location, v0, v1, v2, v3);
 }
 
@@ -3993,6 +8047,13 @@ void CallLogWrapper::glUniform4iv (glw::GLint location, glw::GLsizei count, cons
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform4iv(" << location << ", " << count << ", " << getPointerStr(value, (count * 4)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(537, 3);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(value);
+	}
 	m_gl.uniform4iv(location, count, value);
 }
 
@@ -4000,6 +8061,15 @@ void CallLogWrapper::glUniform4ui (glw::GLint location, glw::GLuint v0, glw::GLu
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform4ui(" << location << ", " << v0 << ", " << v1 << ", " << v2 << ", " << v3 << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(538, 5);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(v0);
+		args[2] = tcu::callTraceArg(v1);
+		args[3] = tcu::callTraceArg(v2);
+		args[4] = tcu::callTraceArg(v3);
+	}
 	m_gl.uniform4ui(location, v0, v1, v2, v3);
 }
 
@@ -4007,6 +8077,13 @@ void CallLogWrapper::glUniform4uiv (glw::GLint location, glw::GLsizei count, con
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniform4uiv(" << location << ", " << count << ", " << getPointerStr(value, (count * 4)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(539, 3);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(value);
+	}
 	m_gl.uniform4uiv(location, count, value);
 }
 
@@ -4014,6 +8091,13 @@ void CallLogWrapper::glUniformBlockBinding (glw::GLuint program, glw::GLuint uni
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformBlockBinding(" << program << ", " << uniformBlockIndex << ", " << uniformBlockBinding << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(540, 3);
+		args[0] = tcu::callTraceArg(program);
+		args[1] = tcu::callTraceArg(uniformBlockIndex);
+		args[2] = tcu::callTraceArg(uniformBlockBinding);
+	}
 	m_gl.uniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
 }
 
@@ -4021,6 +8105,14 @@ void CallLogWrapper::glUniformMatrix2dv (glw::GLint location, glw::GLsizei count
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix2dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(541, 4);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(transpose);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.uniformMatrix2dv(location, count, transpose, value);
 }
 
@@ -4028,6 +8120,14 @@ void CallLogWrapper::glUniformMatrix2fv (glw::GLint location, glw::GLsizei count
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix2fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 2*2)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(542, 4);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(transpose);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.uniformMatrix2fv(location, count, transpose, value);
 }
 
@@ -4035,6 +8135,14 @@ void CallLogWrapper::glUniformMatrix2x3dv (glw::GLint location, glw::GLsizei cou
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix2x3dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(543, 4);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(transpose);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.uniformMatrix2x3dv(location, count, transpose, value);
 }
 
@@ -4042,6 +8150,14 @@ void CallLogWrapper::glUniformMatrix2x3fv (glw::GLint location, glw::GLsizei cou
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix2x3fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 2*3)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(544, 4);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(transpose);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.uniformMatrix2x3fv(location, count, transpose, value);
 }
 
@@ -4049,6 +8165,14 @@ void CallLogWrapper::glUniformMatrix2x4dv (glw::GLint location, glw::GLsizei cou
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix2x4dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(545, 4);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(transpose);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.uniformMatrix2x4dv(location, count, transpose, value);
 }
 
@@ -4056,6 +8180,14 @@ void CallLogWrapper::glUniformMatrix2x4fv (glw::GLint location, glw::GLsizei cou
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix2x4fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 2*4)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(546, 4);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(transpose);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.uniformMatrix2x4fv(location, count, transpose, value);
 }
 
@@ -4063,6 +8195,14 @@ void CallLogWrapper::glUniformMatrix3dv (glw::GLint location, glw::GLsizei count
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix3dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(547, 4);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(transpose);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.uniformMatrix3dv(location, count, transpose, value);
 }
 
@@ -4070,6 +8210,14 @@ void CallLogWrapper::glUniformMatrix3fv (glw::GLint location, glw::GLsizei count
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix3fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 3*3)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(548, 4);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(transpose);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.uniformMatrix3fv(location, count, transpose, value);
 }
 
@@ -4077,6 +8225,14 @@ void CallLogWrapper::glUniformMatrix3x2dv (glw::GLint location, glw::GLsizei cou
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix3x2dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(549, 4);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(transpose);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.uniformMatrix3x2dv(location, count, transpose, value);
 }
 
@@ -4084,6 +8240,14 @@ void CallLogWrapper::glUniformMatrix3x2fv (glw::GLint location, glw::GLsizei cou
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix3x2fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 3*2)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(550, 4);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(transpose);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.uniformMatrix3x2fv(location, count, transpose, value);
 }
 
@@ -4091,6 +8255,14 @@ void CallLogWrapper::glUniformMatrix3x4dv (glw::GLint location, glw::GLsizei cou
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix3x4dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(551, 4);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(transpose);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.uniformMatrix3x4dv(location, count, transpose, value);
 }
 
@@ -4098,6 +8270,14 @@ void CallLogWrapper::glUniformMatrix3x4fv (glw::GLint location, glw::GLsizei cou
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix3x4fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 3*4)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(552, 4);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(transpose);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.uniformMatrix3x4fv(location, count, transpose, value);
 }
 
@@ -4105,6 +8285,14 @@ void CallLogWrapper::glUniformMatrix4dv (glw::GLint location, glw::GLsizei count
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix4dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(553, 4);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(transpose);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.uniformMatrix4dv(location, count, transpose, value);
 }
 
@@ -4112,6 +8300,14 @@ void CallLogWrapper::glUniformMatrix4fv (glw::GLint location, glw::GLsizei count
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix4fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 4*4)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(554, 4);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(transpose);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.uniformMatrix4fv(location, count, transpose, value);
 }
 
@@ -4119,6 +8315,14 @@ void CallLogWrapper::glUniformMatrix4x2dv (glw::GLint location, glw::GLsizei cou
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix4x2dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(555, 4);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(transpose);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.uniformMatrix4x2dv(location, count, transpose, value);
 }
 
@@ -4126,6 +8330,14 @@ void CallLogWrapper::glUniformMatrix4x2fv (glw::GLint location, glw::GLsizei cou
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix4x2fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 4*2)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(556, 4);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(transpose);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.uniformMatrix4x2fv(location, count, transpose, value);
 }
 
@@ -4133,6 +8345,14 @@ void CallLogWrapper::glUniformMatrix4x3dv (glw::GLint location, glw::GLsizei cou
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix4x3dv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(557, 4);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(transpose);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.uniformMatrix4x3dv(location, count, transpose, value);
 }
 
@@ -4140,6 +8360,14 @@ void CallLogWrapper::glUniformMatrix4x3fv (glw::GLint location, glw::GLsizei cou
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformMatrix4x3fv(" << location << ", " << count << ", " << getBooleanStr(transpose) << ", " << getPointerStr(value, (count * 4*3)) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(558, 4);
+		args[0] = tcu::callTraceArg(location);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(transpose);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.uniformMatrix4x3fv(location, count, transpose, value);
 }
 
@@ -4147,6 +8375,13 @@ void CallLogWrapper::glUniformSubroutinesuiv (glw::GLenum shadertype, glw::GLsiz
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUniformSubroutinesuiv(" << toHex(shadertype) << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(indices))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(559, 3);
+		args[0] = tcu::callTraceArg(shadertype);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(indices);
+	}
 	m_gl.uniformSubroutinesuiv(shadertype, count, indices);
 }
 
@@ -4154,6 +8389,11 @@ glw::GLboolean CallLogWrapper::glUnmapBuffer (glw::GLenum target)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUnmapBuffer(" << getBufferTargetStr(target) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(560, 1);
+		args[0] = tcu::callTraceArg(target);
+	}
 	glw::GLboolean returnValue = m_gl.unmapBuffer(target);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -4164,6 +8404,11 @@ glw::GLboolean CallLogWrapper::glUnmapNamedBuffer (glw::GLuint buffer)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUnmapNamedBuffer(" << buffer << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(561, 1);
+		args[0] = tcu::callTraceArg(buffer);
+	}
 	glw::GLboolean returnValue = m_gl.unmapNamedBuffer(buffer);
 	if (m_enableLog)
 		m_log << TestLog::Message << "// " << getBooleanStr(returnValue) << " returned" << TestLog::EndMessage;
@@ -4174,6 +8419,11 @@ void CallLogWrapper::glUseProgram (glw::GLuint program)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUseProgram(" << program << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(562, 1);
+		args[0] = tcu::callTraceArg(program);
+	}
 	m_gl.useProgram(program);
 }
 
@@ -4181,6 +8431,13 @@ void CallLogWrapper::glUseProgramStages (glw::GLuint pipeline, glw::GLbitfield s
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glUseProgramStages(" << pipeline << ", " << getShaderTypeMaskStr(stages) << ", " << program << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(563, 3);
+		args[0] = tcu::callTraceArg(pipeline);
+		args[1] = tcu::callTraceArg(stages);
+		args[2] = tcu::callTraceArg(program);
+	}
 	m_gl.useProgramStages(pipeline, stages, program);
 }
 
@@ -4188,6 +8445,11 @@ void CallLogWrapper::glValidateProgram (glw::GLuint program)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glValidateProgram(" << program << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(564, 1);
+		args[0] = tcu::callTraceArg(program);
+	}
 	m_gl.validateProgram(program);
 }
 
@@ -4195,6 +8457,11 @@ void CallLogWrapper::glValidateProgramPipeline (glw::GLuint pipeline)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glValidateProgramPipeline(" << pipeline << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(565, 1);
+		args[0] = tcu::callTraceArg(pipeline);
+	}
 	m_gl.validateProgramPipeline(pipeline);
 }
 
@@ -4202,6 +8469,13 @@ void CallLogWrapper::glVertexArrayAttribBinding (glw::GLuint vaobj, glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayAttribBinding(" << vaobj << ", " << attribindex << ", " << bindingindex << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(566, 3);
+		args[0] = tcu::callTraceArg(vaobj);
+		args[1] = tcu::callTraceArg(attribindex);
+		args[2] = tcu::callTraceArg(bindingindex);
+	}
 	m_gl.vertexArrayAttribBinding(vaobj, attribindex, bindingindex);
 }
 
@@ -4209,6 +8483,16 @@ void CallLogWrapper::glVertexArrayAttribFormat (glw::GLuint vaobj, glw::GLuint a
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayAttribFormat(" << vaobj << ", " << attribindex << ", " << size << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << relativeoffset << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(567, 6);
+		args[0] = tcu::callTraceArg(vaobj);
+		args[1] = tcu::callTraceArg(attribindex);
+		args[2] = tcu::callTraceArg(size);
+		args[3] = tcu::callTraceArg(type);
+		args[4] = tcu::callTraceArg(normalized);
+		args[5] = tcu::callTraceArg(relativeoffset);
+	}
 	m_gl.vertexArrayAttribFormat(vaobj, attribindex, size, type, normalized, relativeoffset);
 }
 
@@ -4216,6 +8500,15 @@ void CallLogWrapper::glVertexArrayAttribIFormat (glw::GLuint vaobj, glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayAttribIFormat(" << vaobj << ", " << attribindex << ", " << size << ", " << toHex(type) << ", " << relativeoffset << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(568, 5);
+		args[0] = tcu::callTraceArg(vaobj);
+		args[1] = tcu::callTraceArg(attribindex);
+		args[2] = tcu::callTraceArg(size);
+		args[3] = tcu::callTraceArg(type);
+		args[4] = tcu::callTraceArg(relativeoffset);
+	}
 	m_gl.vertexArrayAttribIFormat(vaobj, attribindex, size, type, relativeoffset);
 }
 
@@ -4223,6 +8516,15 @@ void CallLogWrapper::glVertexArrayAttribLFormat (glw::GLuint vaobj, glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayAttribLFormat(" << vaobj << ", " << attribindex << ", " << size << ", " << toHex(type) << ", " << relativeoffset << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(569, 5);
+		args[0] = tcu::callTraceArg(vaobj);
+		args[1] = tcu::callTraceArg(attribindex);
+		args[2] = tcu::callTraceArg(size);
+		args[3] = tcu::callTraceArg(type);
+		args[4] = tcu::callTraceArg(relativeoffset);
+	}
 	m_gl.vertexArrayAttribLFormat(vaobj, attribindex, size, type, relativeoffset);
 }
 
@@ -4230,6 +8532,13 @@ void CallLogWrapper::glVertexArrayBindingDivisor (glw::GLuint vaobj, glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayBindingDivisor(" << vaobj << ", " << bindingindex << ", " << divisor << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(570, 3);
+		args[0] = tcu::callTraceArg(vaobj);
+		args[1] = tcu::callTraceArg(bindingindex);
+		args[2] = tcu::callTraceArg(divisor);
+	}
 	m_gl.vertexArrayBindingDivisor(vaobj, bindingindex, divisor);
 }
 
@@ -4237,6 +8546,12 @@ void CallLogWrapper::glVertexArrayElementBuffer (glw::GLuint vaobj, glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayElementBuffer(" << vaobj << ", " << buffer << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(571, 2);
+		args[0] = tcu::callTraceArg(vaobj);
+		args[1] = tcu::callTraceArg(buffer);
+	}
 	m_gl.vertexArrayElementBuffer(vaobj, buffer);
 }
 
@@ -4244,6 +8559,15 @@ void CallLogWrapper::glVertexArrayVertexBuffer (glw::GLuint vaobj, glw::GLuint b
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayVertexBuffer(" << vaobj << ", " << bindingindex << ", " << buffer << ", " << offset << ", " << stride << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(572, 5);
+		args[0] = tcu::callTraceArg(vaobj);
+		args[1] = tcu::callTraceArg(bindingindex);
+		args[2] = tcu::callTraceArg(buffer);
+		args[3] = tcu::callTraceArg(offset);
+		args[4] = tcu::callTraceArg(stride);
+	}
 	m_gl.vertexArrayVertexBuffer(vaobj, bindingindex, buffer, offset, stride);
 }
 
@@ -4251,6 +8575,16 @@ void CallLogWrapper::glVertexArrayVertexBuffers (glw::GLuint vaobj, glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexArrayVertexBuffers(" << vaobj << ", " << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(buffers))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(offsets))) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(strides))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(573, 6);
+		args[0] = tcu::callTraceArg(vaobj);
+		args[1] = tcu::callTraceArg(first);
+		args[2] = tcu::callTraceArg(count);
+		args[3] = tcu::callTraceArg(buffers);
+		args[4] = tcu::callTraceArg(offsets);
+		args[5] = tcu::callTraceArg(strides);
+	}
 	m_gl.vertexArrayVertexBuffers(vaobj, first, count, buffers, offsets, strides);
 }
 
@@ -4258,6 +8592,12 @@ void CallLogWrapper::glVertexAttrib1d (glw::GLuint index, glw::GLdouble x)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib1d(" << index << ", " << x << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(574, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(x);
+	}
 	m_gl.vertexAttrib1d(index, x);
 }
 
@@ -4265,6 +8605,12 @@ void CallLogWrapper::glVertexAttrib1dv (glw::GLuint index, const glw::GLdouble *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib1dv(" << index << ", " << getPointerStr(v, 1) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(575, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(v);
+	}
 	m_gl.vertexAttrib1dv(index, v);
 }
 
@@ -4272,6 +8618,12 @@ void CallLogWrapper::glVertexAttrib1f (glw::GLuint index, glw::GLfloat x)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib1f(" << index << ", " << x << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(576, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(x);
+	}
 	m_gl.vertexAttrib1f(index, x);
 }
 
@@ -4279,6 +8631,12 @@ void CallLogWrapper::glVertexAttrib1fv (glw::GLuint index, const glw::GLfloat *v
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib1fv(" << index << ", " << getPointerStr(v, 1) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(577, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(v);
+	}
 	m_gl.vertexAttrib1fv(index, v);
 }
 
@@ -4286,6 +8644,12 @@ void CallLogWrapper::glVertexAttrib1s (glw::GLuint index, glw::GLshort x)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib1s(" << index << ", " << x << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(578, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(x);
+	}
 	m_gl.vertexAttrib1s(index, x);
 }
 
@@ -4293,6 +8657,12 @@ void CallLogWrapper::glVertexAttrib1sv (glw::GLuint index, const glw::GLshort *v
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib1sv(" << index << ", " << getPointerStr(v, 1) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(579, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(v);
+	}
 	m_gl.vertexAttrib1sv(index, v);
 }
 
@@ -4300,6 +8670,13 @@ void CallLogWrapper::glVertexAttrib2d (glw::GLuint index, glw::GLdouble x, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib2d(" << index << ", " << x << ", " << y << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(580, 3);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(x);
+		args[2] = tcu::callTraceArg(y);
+	}
 	m_gl.vertexAttrib2d(index, x, y);
 }
 
@@ -4307,6 +8684,12 @@ void CallLogWrapper::glVertexAttrib2dv (glw::GLuint index, const glw::GLdouble *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib2dv(" << index << ", " << getPointerStr(v, 2) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(581, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(v);
+	}
 	m_gl.vertexAttrib2dv(index, v);
 }
 
@@ -4314,6 +8697,13 @@ void CallLogWrapper::glVertexAttrib2f (glw::GLuint index, glw::GLfloat x, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib2f(" << index << ", " << x << ", " << y << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(582, 3);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(x);
+		args[2] = tcu::callTraceArg(y);
+	}
 	m_gl.vertexAttrib2f(index, x, y);
 }
 
@@ -4321,6 +8711,12 @@ void CallLogWrapper::glVertexAttrib2fv (glw::GLuint index, const glw::GLfloat *v
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib2fv(" << index << ", " << getPointerStr(v, 2) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(583, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(v);
+	}
 	m_gl.vertexAttrib2fv(index, v);
 }
 
@@ -4328,6 +8724,13 @@ void CallLogWrapper::glVertexAttrib2s (glw::GLuint index, glw::GLshort x, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib2s(" << index << ", " << x << ", " << y << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(584, 3);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(x);
+		args[2] = tcu::callTraceArg(y);
+	}
 	m_gl.vertexAttrib2s(index, x, y);
 }
 
@@ -4335,6 +8738,12 @@ void CallLogWrapper::glVertexAttrib2sv (glw::GLuint index, const glw::GLshort *v
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib2sv(" << index << ", " << getPointerStr(v, 2) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(585, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(v);
+	}
 	m_gl.vertexAttrib2sv(index, v);
 }
 
@@ -4342,6 +8751,14 @@ void CallLogWrapper::glVertexAttrib3d (glw::GLuint index, glw::GLdouble x, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib3d(" << index << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(586, 4);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(x);
+		args[2] = tcu::callTraceArg(y);
+		args[3] = tcu::callTraceArg(z);
+	}
 	m_gl.vertexAttrib3d(index, x, y, z);
 }
 
@@ -4349,6 +8766,12 @@ void CallLogWrapper::glVertexAttrib3dv (glw::GLuint index, const glw::GLdouble *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib3dv(" << index << ", " << getPointerStr(v, 3) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(587, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(v);
+	}
 	m_gl.vertexAttrib3dv(index, v);
 }
 
@@ -4356,6 +8779,14 @@ void CallLogWrapper::glVertexAttrib3f (glw::GLuint index, glw::GLfloat x, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib3f(" << index << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(588, 4);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(x);
+		args[2] = tcu::callTraceArg(y);
+		args[3] = tcu::callTraceArg(z);
+	}
 	m_gl.vertexAttrib3f(index, x, y, z);
 }
 
@@ -4363,6 +8794,12 @@ void CallLogWrapper::glVertexAttrib3fv (glw::GLuint index, const glw::GLfloat *v
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib3fv(" << index << ", " << getPointerStr(v, 3) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(589, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(v);
+	}
 	m_gl.vertexAttrib3fv(index, v);
 }
 
@@ -4370,6 +8807,14 @@ void CallLogWrapper::glVertexAttrib3s (glw::GLuint index, glw::GLshort x, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib3s(" << index << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(590, 4);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(x);
+		args[2] = tcu::callTraceArg(y);
+		args[3] = tcu::callTraceArg(z);
+	}
 	m_gl.vertexAttrib3s(index, x, y, z);
 }
 
@@ -4377,6 +8822,12 @@ void CallLogWrapper::glVertexAttrib3sv (glw::GLuint index, const glw::GLshort *v
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib3sv(" << index << ", " << getPointerStr(v, 3) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(591, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(v);
+	}
 	m_gl.vertexAttrib3sv(index, v);
 }
 
@@ -4384,6 +8835,12 @@ void CallLogWrapper::glVertexAttrib4Nbv (glw::GLuint index, const glw::GLbyte *v
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4Nbv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(592, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(v);
+	}
 	m_gl.vertexAttrib4Nbv(index, v);
 }
 
@@ -4391,6 +8848,12 @@ void CallLogWrapper::glVertexAttrib4Niv (glw::GLuint index, const glw::GLint *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4Niv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(593, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(v);
+	}
 	m_gl.vertexAttrib4Niv(index, v);
 }
 
@@ -4398,6 +8861,12 @@ void CallLogWrapper::glVertexAttrib4Nsv (glw::GLuint index, const glw::GLshort *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4Nsv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(594, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(v);
+	}
 	m_gl.vertexAttrib4Nsv(index, v);
 }
 
@@ -4405,6 +8874,15 @@ void CallLogWrapper::glVertexAttrib4Nub (glw::GLuint index, glw::GLubyte x, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4Nub(" << index << ", " << toHex(x) << ", " << toHex(y) << ", " << toHex(z) << ", " << toHex(w) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(595, 5);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(x);
+		args[2] = tcu::callTraceArg(y);
+		args[3] = tcu::callTraceArg(z);
+		args[4] = tcu::callTraceArg(w);
+	}
 	m_gl.vertexAttrib4Nub(index, x, y, z, w);
 }
 
@@ -4412,6 +8890,12 @@ void CallLogWrapper::glVertexAttrib4Nubv (glw::GLuint index, const glw::GLubyte
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4Nubv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(596, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(v);
+	}
 	m_gl.vertexAttrib4Nubv(index, v);
 }
 
@@ -4419,6 +8903,12 @@ void CallLogWrapper::glVertexAttrib4Nuiv (glw::GLuint index, const glw::GLuint *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4Nuiv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(597, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(v);
+	}
 	m_gl.vertexAttrib4Nuiv(index, v);
 }
 
@@ -4426,6 +8916,12 @@ void CallLogWrapper::glVertexAttrib4Nusv (glw::GLuint index, const glw::GLushort
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4Nusv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(598, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(v);
+	}
 	m_gl.vertexAttrib4Nusv(index, v);
 }
 
@@ -4433,6 +8929,12 @@ void CallLogWrapper::glVertexAttrib4bv (glw::GLuint index, const glw::GLbyte *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4bv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(599, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(v);
+	}
 	m_gl.vertexAttrib4bv(index, v);
 }
 
@@ -4440,6 +8942,15 @@ void CallLogWrapper::glVertexAttrib4d (glw::GLuint index, glw::GLdouble x, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4d(" << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(600, 5);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(x);
+		args[2] = tcu::callTraceArg(y);
+		args[3] = tcu::callTraceArg(z);
+		args[4] = tcu::callTraceArg(w);
+	}
 	m_gl.vertexAttrib4d(index, x, y, z, w);
 }
 
@@ -4447,6 +8958,12 @@ void CallLogWrapper::glVertexAttrib4dv (glw::GLuint index, const glw::GLdouble *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4dv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(601, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(v);
+	}
 	m_gl.vertexAttrib4dv(index, v);
 }
 
@@ -4454,6 +8971,15 @@ void CallLogWrapper::glVertexAttrib4f (glw::GLuint index, glw::GLfloat x, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4f(" << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(602, 5);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(x);
+		args[2] = tcu::callTraceArg(y);
+		args[3] = tcu::callTraceArg(z);
+		args[4] = tcu::callTraceArg(w);
+	}
 	m_gl.vertexAttrib4f(index, x, y, z, w);
 }
 
@@ -4461,6 +8987,12 @@ void CallLogWrapper::glVertexAttrib4fv (glw::GLuint index, const glw::GLfloat *v
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4fv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(603, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(v);
+	}
 	m_gl.vertexAttrib4fv(index, v);
 }
 
@@ -4468,6 +9000,12 @@ void CallLogWrapper::glVertexAttrib4iv (glw::GLuint index, const glw::GLint *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4iv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(604, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(v);
+	}
 	m_gl.vertexAttrib4iv(index, v);
 }
 
@@ -4475,6 +9013,15 @@ void CallLogWrapper::glVertexAttrib4s (glw::GLuint index, glw::GLshort x, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4s(" << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(605, 5);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(x);
+		args[2] = tcu::callTraceArg(y);
+		args[3] = tcu::callTraceArg(z);
+		args[4] = tcu::callTraceArg(w);
+	}
 	m_gl.vertexAttrib4s(index, x, y, z, w);
 }
 
@@ -4482,6 +9029,12 @@ void CallLogWrapper::glVertexAttrib4sv (glw::GLuint index, const glw::GLshort *v
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4sv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(606, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(v);
+	}
 	m_gl.vertexAttrib4sv(index, v);
 }
 
@@ -4489,6 +9042,12 @@ void CallLogWrapper::glVertexAttrib4ubv (glw::GLuint index, const glw::GLubyte *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4ubv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(607, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(v);
+	}
 	m_gl.vertexAttrib4ubv(index, v);
 }
 
@@ -4496,6 +9055,12 @@ void CallLogWrapper::glVertexAttrib4uiv (glw::GLuint index, const glw::GLuint *v
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4uiv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(608, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(v);
+	}
 	m_gl.vertexAttrib4uiv(index, v);
 }
 
@@ -4503,6 +9068,12 @@ void CallLogWrapper::glVertexAttrib4usv (glw::GLuint index, const glw::GLushort
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttrib4usv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(609, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(v);
+	}
 	m_gl.vertexAttrib4usv(index, v);
 }
 
@@ -4510,6 +9081,12 @@ void CallLogWrapper::glVertexAttribBinding (glw::GLuint attribindex, glw::GLuint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribBinding(" << attribindex << ", " << bindingindex << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(610, 2);
+		args[0] = tcu::callTraceArg(attribindex);
+		args[1] = tcu::callTraceArg(bindingindex);
+	}
 	m_gl.vertexAttribBinding(attribindex, bindingindex);
 }
 
@@ -4517,6 +9094,12 @@ void CallLogWrapper::glVertexAttribDivisor (glw::GLuint index, glw::GLuint divis
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribDivisor(" << index << ", " << divisor << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(611, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(divisor);
+	}
 	m_gl.vertexAttribDivisor(index, divisor);
 }
 
@@ -4524,6 +9107,15 @@ void CallLogWrapper::glVertexAttribFormat (glw::GLuint attribindex, glw::GLint s
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribFormat(" << attribindex << ", " << size << ", " << getTypeStr(type) << ", " << getBooleanStr(normalized) << ", " << relativeoffset << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(612, 5);
+		args[0] = tcu::callTraceArg(attribindex);
+		args[1] = tcu::callTraceArg(size);
+		args[2] = tcu::callTraceArg(type);
+		args[3] = tcu::callTraceArg(normalized);
+		args[4] = tcu::callTraceArg(relativeoffset);
+	}
 	m_gl.vertexAttribFormat(attribindex, size, type, normalized, relativeoffset);
 }
 
@@ -4531,6 +9123,12 @@ void CallLogWrapper::glVertexAttribI1i (glw::GLuint index, glw::GLint x)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI1i(" << index << ", " << x << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(613, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(x);
+	}
 	m_gl.vertexAttribI1i(index, x);
 }
 
@@ -4538,6 +9136,12 @@ void CallLogWrapper::glVertexAttribI1iv (glw::GLuint index, const glw::GLint *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI1iv(" << index << ", " << getPointerStr(v, 1) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(614, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(v);
+	}
 	m_gl.vertexAttribI1iv(index, v);
 }
 
@@ -4545,6 +9149,12 @@ void CallLogWrapper::glVertexAttribI1ui (glw::GLuint index, glw::GLuint x)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI1ui(" << index << ", " << x << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(615, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(x);
+	}
 	m_gl.vertexAttribI1ui(index, x);
 }
 
@@ -4552,6 +9162,12 @@ void CallLogWrapper::glVertexAttribI1uiv (glw::GLuint index, const glw::GLuint *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI1uiv(" << index << ", " << getPointerStr(v, 1) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(616, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(v);
+	}
 	m_gl.vertexAttribI1uiv(index, v);
 }
 
@@ -4559,6 +9175,13 @@ void CallLogWrapper::glVertexAttribI2i (glw::GLuint index, glw::GLint x, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI2i(" << index << ", " << x << ", " << y << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(617, 3);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(x);
+		args[2] = tcu::callTraceArg(y);
+	}
 	m_gl.vertexAttribI2i(index, x, y);
 }
 
@@ -4566,6 +9189,12 @@ void CallLogWrapper::glVertexAttribI2iv (glw::GLuint index, const glw::GLint *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI2iv(" << index << ", " << getPointerStr(v, 2) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(618, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(v);
+	}
 	m_gl.vertexAttribI2iv(index, v);
 }
 
@@ -4573,6 +9202,13 @@ void CallLogWrapper::glVertexAttribI2ui (glw::GLuint index, glw::GLuint x, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI2ui(" << index << ", " << x << ", " << y << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(619, 3);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(x);
+		args[2] = tcu::callTraceArg(y);
+	}
 	m_gl.vertexAttribI2ui(index, x, y);
 }
 
@@ -4580,6 +9216,12 @@ void CallLogWrapper::glVertexAttribI2uiv (glw::GLuint index, const glw::GLuint *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI2uiv(" << index << ", " << getPointerStr(v, 2) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(620, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(v);
+	}
 	m_gl.vertexAttribI2uiv(index, v);
 }
 
@@ -4587,6 +9229,14 @@ void CallLogWrapper::glVertexAttribI3i (glw::GLuint index, glw::GLint x, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI3i(" << index << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(621, 4);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(x);
+		args[2] = tcu::callTraceArg(y);
+		args[3] = tcu::callTraceArg(z);
+	}
 	m_gl.vertexAttribI3i(index, x, y, z);
 }
 
@@ -4594,6 +9244,12 @@ void CallLogWrapper::glVertexAttribI3iv (glw::GLuint index, const glw::GLint *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI3iv(" << index << ", " << getPointerStr(v, 3) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(622, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(v);
+	}
 	m_gl.vertexAttribI3iv(index, v);
 }
 
@@ -4601,6 +9257,14 @@ void CallLogWrapper::glVertexAttribI3ui (glw::GLuint index, glw::GLuint x, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI3ui(" << index << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(623, 4);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(x);
+		args[2] = tcu::callTraceArg(y);
+		args[3] = tcu::callTraceArg(z);
+	}
 	m_gl.vertexAttribI3ui(index, x, y, z);
 }
 
@@ -4608,6 +9272,12 @@ void CallLogWrapper::glVertexAttribI3uiv (glw::GLuint index, const glw::GLuint *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI3uiv(" << index << ", " << getPointerStr(v, 3) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(624, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(v);
+	}
 	m_gl.vertexAttribI3uiv(index, v);
 }
 
@@ -4615,6 +9285,12 @@ void CallLogWrapper::glVertexAttribI4bv (glw::GLuint index, const glw::GLbyte *v
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI4bv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(625, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(v);
+	}
 	m_gl.vertexAttribI4bv(index, v);
 }
 
@@ -4622,6 +9298,15 @@ void CallLogWrapper::glVertexAttribI4i (glw::GLuint index, glw::GLint x, glw::GL
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI4i(" << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(626, 5);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(x);
+		args[2] = tcu::callTraceArg(y);
+		args[3] = tcu::callTraceArg(z);
+		args[4] = tcu::callTraceArg(w);
+	}
 	m_gl.vertexAttribI4i(index, x, y, z, w);
 }
 
@@ -4629,6 +9314,12 @@ void CallLogWrapper::glVertexAttribI4iv (glw::GLuint index, const glw::GLint *v)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI4iv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(627, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(v);
+	}
 	m_gl.vertexAttribI4iv(index, v);
 }
 
@@ -4636,6 +9327,12 @@ void CallLogWrapper::glVertexAttribI4sv (glw::GLuint index, const glw::GLshort *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI4sv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(628, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(v);
+	}
 	m_gl.vertexAttribI4sv(index, v);
 }
 
@@ -4643,6 +9340,12 @@ void CallLogWrapper::glVertexAttribI4ubv (glw::GLuint index, const glw::GLubyte
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI4ubv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(629, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(v);
+	}
 	m_gl.vertexAttribI4ubv(index, v);
 }
 
@@ -4650,6 +9353,15 @@ void CallLogWrapper::glVertexAttribI4ui (glw::GLuint index, glw::GLuint x, glw::
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI4ui(" << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(630, 5);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(x);
+		args[2] = tcu::callTraceArg(y);
+		args[3] = tcu::callTraceArg(z);
+		args[4] = tcu::callTraceArg(w);
+	}
 	m_gl.vertexAttribI4ui(index, x, y, z, w);
 }
 
@@ -4657,6 +9369,12 @@ void CallLogWrapper::glVertexAttribI4uiv (glw::GLuint index, const glw::GLuint *
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI4uiv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(631, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(v);
+	}
 	m_gl.vertexAttribI4uiv(index, v);
 }
 
@@ -4664,6 +9382,12 @@ void CallLogWrapper::glVertexAttribI4usv (glw::GLuint index, const glw::GLushort
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribI4usv(" << index << ", " << getPointerStr(v, 4) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(632, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(v);
+	}
 	m_gl.vertexAttribI4usv(index, v);
 }
 
@@ -4671,6 +9395,14 @@ void CallLogWrapper::glVertexAttribIFormat (glw::GLuint attribindex, glw::GLint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribIFormat(" << attribindex << ", " << size << ", " << getTypeStr(type) << ", " << relativeoffset << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(633, 4);
+		args[0] = tcu::callTraceArg(attribindex);
+		args[1] = tcu::callTraceArg(size);
+		args[2] = tcu::callTraceArg(type);
+		args[3] = tcu::callTraceArg(relativeoffset);
+	}
 	m_gl.vertexAttribIFormat(attribindex, size, type, relativeoffset);
 }
 
@@ -4678,6 +9410,15 @@ void CallLogWrapper::glVertexAttribIPointer (glw::GLuint index, glw::GLint size,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribIPointer(" << index << ", " << size << ", " << getTypeStr(type) << ", " << stride << ", " << pointer << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(634, 5);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(size);
+		args[2] = tcu::callTraceArg(type);
+		args[3] = tcu::callTraceArg(stride);
+		args[4] = tcu::callTraceArg(pointer);
+	}
 	m_gl.vertexAttribIPointer(index, size, type, stride, pointer);
 }
 
@@ -4685,6 +9426,12 @@ void CallLogWrapper::glVertexAttribL1d (glw::GLuint index, glw::GLdouble x)
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribL1d(" << index << ", " << x << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(635, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(x);
+	}
 	m_gl.vertexAttribL1d(index, x);
 }
 
@@ -4692,6 +9439,12 @@ void CallLogWrapper::glVertexAttribL1dv (glw::GLuint index, const glw::GLdouble
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribL1dv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(636, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(v);
+	}
 	m_gl.vertexAttribL1dv(index, v);
 }
 
@@ -4699,6 +9452,13 @@ void CallLogWrapper::glVertexAttribL2d (glw::GLuint index, glw::GLdouble x, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribL2d(" << index << ", " << x << ", " << y << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(637, 3);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(x);
+		args[2] = tcu::callTraceArg(y);
+	}
 	m_gl.vertexAttribL2d(index, x, y);
 }
 
@@ -4706,6 +9466,12 @@ void CallLogWrapper::glVertexAttribL2dv (glw::GLuint index, const glw::GLdouble
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribL2dv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(638, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(v);
+	}
 	m_gl.vertexAttribL2dv(index, v);
 }
 
@@ -4713,6 +9479,14 @@ void CallLogWrapper::glVertexAttribL3d (glw::GLuint index, glw::GLdouble x, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribL3d(" << index << ", " << x << ", " << y << ", " << z << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(639, 4);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(x);
+		args[2] = tcu::callTraceArg(y);
+		args[3] = tcu::callTraceArg(z);
+	}
 	m_gl.vertexAttribL3d(index, x, y, z);
 }
 
@@ -4720,6 +9494,12 @@ void CallLogWrapper::glVertexAttribL3dv (glw::GLuint index, const glw::GLdouble
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribL3dv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(640, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(v);
+	}
 	m_gl.vertexAttribL3dv(index, v);
 }
 
@@ -4727,6 +9507,15 @@ void CallLogWrapper::glVertexAttribL4d (glw::GLuint index, glw::GLdouble x, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribL4d(" << index << ", " << x << ", " << y << ", " << z << ", " << w << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(641, 5);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(x);
+		args[2] = tcu::callTraceArg(y);
+		args[3] = tcu::callTraceArg(z);
+		args[4] = tcu::callTraceArg(w);
+	}
 	m_gl.vertexAttribL4d(index, x, y, z, w);
 }
 
@@ -4734,6 +9523,12 @@ void CallLogWrapper::glVertexAttribL4dv (glw::GLuint index, const glw::GLdouble
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribL4dv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(642, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(v);
+	}
 	m_gl.vertexAttribL4dv(index, v);
 }
 
@@ -4741,6 +9536,14 @@ void CallLogWrapper::glVertexAttribLFormat (glw::GLuint attribindex, glw::GLint
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribLFormat(" << attribindex << ", " << size << ", " << toHex(type) << ", " << relativeoffset << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(643, 4);
+		args[0] = tcu::callTraceArg(attribindex);
+		args[1] = tcu::callTraceArg(size);
+		args[2] = tcu::callTraceArg(type);
+		args[3] = tcu::callTraceArg(relativeoffset);
+	}
 	m_gl.vertexAttribLFormat(attribindex, size, type, relativeoffset);
 }
 
@@ -4748,6 +9551,15 @@ void CallLogWrapper::glVertexAttribLPointer (glw::GLuint index, glw::GLint size,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribLPointer(" << index << ", " << size << ", " << toHex(type) << ", " << stride << ", " << pointer << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(644, 5);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(size);
+		args[2] = tcu::callTraceArg(type);
+		args[3] = tcu::callTraceArg(stride);
+		args[4] = tcu::callTraceArg(pointer);
+	}
 	m_gl.vertexAttribLPointer(index, size, type, stride, pointer);
 }
 
@@ -4755,6 +9567,14 @@ void CallLogWrapper::glVertexAttribP1ui (glw::GLuint index, glw::GLenum type, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribP1ui(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << value << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(645, 4);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(type);
+		args[2] = tcu::callTraceArg(normalized);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.vertexAttribP1ui(index, type, normalized, value);
 }
 
@@ -4762,6 +9582,14 @@ void CallLogWrapper::glVertexAttribP1uiv (glw::GLuint index, glw::GLenum type, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribP1uiv(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(646, 4);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(type);
+		args[2] = tcu::callTraceArg(normalized);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.vertexAttribP1uiv(index, type, normalized, value);
 }
 
@@ -4769,6 +9597,14 @@ void CallLogWrapper::glVertexAttribP2ui (glw::GLuint index, glw::GLenum type, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribP2ui(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << value << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(647, 4);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(type);
+		args[2] = tcu::callTraceArg(normalized);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.vertexAttribP2ui(index, type, normalized, value);
 }
 
@@ -4776,6 +9612,14 @@ void CallLogWrapper::glVertexAttribP2uiv (glw::GLuint index, glw::GLenum type, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribP2uiv(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(648, 4);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(type);
+		args[2] = tcu::callTraceArg(normalized);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.vertexAttribP2uiv(index, type, normalized, value);
 }
 
@@ -4783,6 +9627,14 @@ void CallLogWrapper::glVertexAttribP3ui (glw::GLuint index, glw::GLenum type, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribP3ui(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << value << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(649, 4);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(type);
+		args[2] = tcu::callTraceArg(normalized);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.vertexAttribP3ui(index, type, normalized, value);
 }
 
@@ -4790,6 +9642,14 @@ void CallLogWrapper::glVertexAttribP3uiv (glw::GLuint index, glw::GLenum type, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribP3uiv(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(650, 4);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(type);
+		args[2] = tcu::callTraceArg(normalized);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.vertexAttribP3uiv(index, type, normalized, value);
 }
 
@@ -4797,6 +9657,14 @@ void CallLogWrapper::glVertexAttribP4ui (glw::GLuint index, glw::GLenum type, gl
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribP4ui(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << value << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(651, 4);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(type);
+		args[2] = tcu::callTraceArg(normalized);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.vertexAttribP4ui(index, type, normalized, value);
 }
 
@@ -4804,6 +9672,14 @@ void CallLogWrapper::glVertexAttribP4uiv (glw::GLuint index, glw::GLenum type, g
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribP4uiv(" << index << ", " << toHex(type) << ", " << getBooleanStr(normalized) << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(value))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(652, 4);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(type);
+		args[2] = tcu::callTraceArg(normalized);
+		args[3] = tcu::callTraceArg(value);
+	}
 	m_gl.vertexAttribP4uiv(index, type, normalized, value);
 }
 
@@ -4811,6 +9687,16 @@ void CallLogWrapper::glVertexAttribPointer (glw::GLuint index, glw::GLint size,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexAttribPointer(" << index << ", " << size << ", " << getTypeStr(type) << ", " << getBooleanStr(normalized) << ", " << stride << ", " << pointer << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(653, 6);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(size);
+		args[2] = tcu::callTraceArg(type);
+		args[3] = tcu::callTraceArg(normalized);
+		args[4] = tcu::callTraceArg(stride);
+		args[5] = tcu::callTraceArg(pointer);
+	}
 	m_gl.vertexAttribPointer(index, size, type, normalized, stride, pointer);
 }
 
@@ -4818,6 +9704,12 @@ void CallLogWrapper::glVertexBindingDivisor (glw::GLuint bindingindex, glw::GLui
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glVertexBindingDivisor(" << bindingindex << ", " << divisor << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(654, 2);
+		args[0] = tcu::callTraceArg(bindingindex);
+		args[1] = tcu::callTraceArg(divisor);
+	}
 	m_gl.vertexBindingDivisor(bindingindex, divisor);
 }
 
@@ -4825,6 +9717,14 @@ void CallLogWrapper::glViewport (glw::GLint x, glw::GLint y, glw::GLsizei width,
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glViewport(" << x << ", " << y << ", " << width << ", " << height << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(655, 4);
+		args[0] = tcu::callTraceArg(x);
+		args[1] = tcu::callTraceArg(y);
+		args[2] = tcu::callTraceArg(width);
+		args[3] = tcu::callTraceArg(height);
+	}
 	m_gl.viewport(x, y, width, height);
 }
 
@@ -4832,6 +9732,13 @@ void CallLogWrapper::glViewportArrayv (glw::GLuint first, glw::GLsizei count, co
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glViewportArrayv(" << first << ", " << count << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(656, 3);
+		args[0] = tcu::callTraceArg(first);
+		args[1] = tcu::callTraceArg(count);
+		args[2] = tcu::callTraceArg(v);
+	}
 	m_gl.viewportArrayv(first, count, v);
 }
 
@@ -4839,6 +9746,15 @@ void CallLogWrapper::glViewportIndexedf (glw::GLuint index, glw::GLfloat x, glw:
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glViewportIndexedf(" << index << ", " << x << ", " << y << ", " << w << ", " << h << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(657, 5);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(x);
+		args[2] = tcu::callTraceArg(y);
+		args[3] = tcu::callTraceArg(w);
+		args[4] = tcu::callTraceArg(h);
+	}
 	m_gl.viewportIndexedf(index, x, y, w, h);
 }
 
@@ -4846,6 +9762,12 @@ void CallLogWrapper::glViewportIndexedfv (glw::GLuint index, const glw::GLfloat
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glViewportIndexedfv(" << index << ", " << toHex(reinterpret_cast<deUintptr>(static_cast<const void*>(v))) << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(658, 2);
+		args[0] = tcu::callTraceArg(index);
+		args[1] = tcu::callTraceArg(v);
+	}
 	m_gl.viewportIndexedfv(index, v);
 }
 
@@ -4853,5 +9775,12 @@ void CallLogWrapper::glWaitSync (glw::GLsync sync, glw::GLbitfield flags, glw::G
 {
 	if (m_enableLog)
 		m_log << TestLog::Message << "glWaitSync(" << sync << ", " << toHex(flags) << ", " << timeout << ");" << TestLog::EndMessage;
+	if (m_trace)
+	{
+		deUint64* const args = m_trace->recordCall(659, 3);
+		args[0] = tcu::callTraceArg(sync);
+		args[1] = tcu::callTraceArg(flags);
+		args[2] = tcu::callTraceArg(timeout);
+	}
 	m_gl.waitSync(sync, flags, timeout);
 }
@@ -0,0 +1,665 @@
+/* WARNING: This is auto-generated file. Do not modify, since changes will
+ * be lost! Modify the generating script instead.
+ *
+ * Generated from Khronos GL API description (gl.xml) revision 30159.
+ */
+{ "glActiveShaderProgram",							"uu"				},
+{ "glActiveTexture",								"x"					},
+{ "glAttachShader",									"uu"				},
+{ "glBeginConditionalRender",						"ux"				},
+{ "glBeginQuery",									"xu"				},
+{ "glBeginQueryIndexed",							"xuu"				},
+{ "glBeginTransformFeedback",						"x"					},
+{ "glBindAttribLocation",							"uup"				},
+{ "glBindBuffer",									"xu"				},
+{ "glBindBufferBase",								"xuu"				},
+{ "glBindBufferRange",								"xuuii"				},
+{ "glBindBuffersBase",								"xuip"				},
+{ "glBindBuffersRange",								"xuippp"			},
+{ "glBindFragDataLocation",							"uup"				},
+{ "glBindFragDataLocationIndexed",					"uuup"				},
+{ "glBindFramebuffer",								"xu"				},
+{ "glBindImageTexture",								"uuiuixx"			},
+{ "glBindImageTextures",							"uip"				},
+{ "glBindProgramPipeline",							"u"					},
+{ "glBindRenderbuffer",								"xu"				},
+{ "glBindSampler",									"uu"				},
+{ "glBindSamplers",									"uip"				},
+{ "glBindTexture",									"xu"				},
+{ "glBindTextureUnit",								"uu"				},
+{ "glBindTextures",									"uip"				},
+{ "glBindTransformFeedback",						"xu"				},
+{ "glBindVertexArray",								"u"					},
+{ "glBindVertexBuffer",								"uuii"				},
+{ "glBindVertexBuffers",							"uippp"				},
+{ "glBlendBarrierKHR",								""					},
+{ "glBlendColor",									"ffff"				},
+{ "glBlendEquation",								"x"					},
+{ "glBlendEquationSeparate",						"xx"				},
+{ "glBlendEquationSeparatei",						"uxx"				},
+{ "glBlendEquationi",								"ux"				},
+{ "glBlendFunc",									"xx"				},
+{ "glBlendFuncSeparate",							"xxxx"				},
+{ "glBlendFuncSeparatei",							"uxxxx"				},
+{ "glBlendFunci",									"uxx"				},
+{ "glBlitFramebuffer",								"iiiiiiiixx"		},
+{ "glBlitNamedFramebuffer",							"uuiiiiiiiixx"		},
+{ "glBufferData",									"xipx"				},
+{ "glBufferStorage",								"xipx"				},
+{ "glBufferSubData",								"xiip"				},
+{ "glCheckFramebufferStatus",						"x"					},
+{ "glCheckNamedFramebufferStatus",					"ux"				},
+{ "glClampColor",									"xx"				},
+{ "glClear",										"x"					},
+{ "glClearBufferData",								"xxxxp"				},
+{ "glClearBufferSubData",							"xxiixxp"			},
+{ "glClearBufferfi",								"xifi"				},
+{ "glClearBufferfv",								"xip"				},
+{ "glClearBufferiv",								"xip"				},
+{ "glClearBufferuiv",								"xip"				},
+{ "glClearColor",									"ffff"				},
+{ "glClearDepth",									"d"					},
+{ "glClearDepthf",									"f"					},
+{ "glClearNamedBufferData",							"uxxxp"				},
+{ "glClearNamedBufferSubData",						"uxiixxp"			},
+{ "glClearNamedFramebufferfi",						"uxfi"				},
+{ "glClearNamedFramebufferfv",						"uxip"				},
+{ "glClearNamedFramebufferiv",						"uxip"				},
+{ "glClearNamedFramebufferuiv",						"uxip"				},
+{ "glClearStencil",									"i"					},
+{ "glClearTexImage",								"uixxp"				},
+{ "glClearTexSubImage",								"uiiiiiiixxp"		},
+{ "glClientWaitSync",								"pxu"				},
+{ "glClipControl",									"xx"				},
+{ "glColorMask",									"uuuu"				},
+{ "glColorMaski",									"uuuuu"				},
+{ "glCompileShader",								"u"					},
+{ "glCompressedTexImage1D",							"xixiiip"			},
+{ "glCompressedTexImage2D",							"xixiiiip"			},
+{ "glCompressedTexImage3D",							"xixiiiiip"			},
+{ "glCompressedTexSubImage1D",						"xiiixip"			},
+{ "glCompressedTexSubImage2D",						"xiiiiixip"			},
+{ "glCompressedTexSubImage3D",						"xiiiiiiixip"		},
+{ "glCompressedTextureSubImage1D",					"uiiixip"			},
+{ "glCompressedTextureSubImage2D",					"uiiiiixip"			},
+{ "glCompressedTextureSubImage3D",					"uiiiiiiixip"		},
+{ "glCopyBufferSubData",							"xxiii"				},
+{ "glCopyImageSubData",								"uxiiiiuxiiiiiii"	},
+{ "glCopyNamedBufferSubData",						"uuiii"				},
+{ "glCopyTexImage1D",								"xixiiii"			},
+{ "glCopyTexImage2D",								"xixiiiii"			},
+{ "glCopyTexSubImage1D",							"xiiiii"			},
+{ "glCopyTexSubImage2D",							"xiiiiiii"			},
+{ "glCopyTexSubImage3D",							"xiiiiiiii"			},
+{ "glCopyTextureSubImage1D",						"uiiiii"			},
+{ "glCopyTextureSubImage2D",						"uiiiiiii"			},
+{ "glCopyTextureSubImage3D",						"uiiiiiiii"			},
+{ "glCreateBuffers",								"ip"				},
+{ "glCreateFramebuffers",							"ip"				},
+{ "glCreateProgram",								""					},
+{ "glCreateProgramPipelines",						"ip"				},
+{ "glCreateQueries",								"xip"				},
+{ "glCreateRenderbuffers",							"ip"				},
+{ "glCreateSamplers",								"ip"				},
+{ "glCreateShader",									"x"					},
+{ "glCreateShaderProgramv",							"xip"				},
+{ "glCreateTextures",								"xip"				},
+{ "glCreateTransformFeedbacks",						"ip"				},
+{ "glCreateVertexArrays",							"ip"				},
+{ "glCullFace",										"x"					},
+{ "glDebugMessageCallback",							"pp"				},
+{ "glDebugMessageControl",							"xxxipu"			},
+{ "glDebugMessageInsert",							"xxuxip"			},
+{ "glDeleteBuffers",								"ip"				},
+{ "glDeleteFramebuffers",							"ip"				},
+{ "glDeleteProgram",								"u"					},
+{ "glDeleteProgramPipelines",						"ip"				},
+{ "glDeleteQueries",								"ip"				},
+{ "glDeleteRenderbuffers",							"ip"				},
+{ "glDeleteSamplers",								"ip"				},
+{ "glDeleteShader",									"u"					},
+{ "glDeleteSync",									"p"					},
+{ "glDeleteTextures",								"ip"				},
+{ "glDeleteTransformFeedbacks",						"ip"				},
+{ "glDeleteVertexArrays",							"ip"				},
+{ "glDepthFunc",									"x"					},
+{ "glDepthMask",									"u"					},
+{ "glDepthRange",									"dd"				},
+{ "glDepthRangeArrayv",								"uip"				},
+{ "glDepthRangeIndexed",							"udd"				},
+{ "glDepthRangef",									"ff"				},
+{ "glDetachShader",									"uu"				},
+{ "glDisable",										"x"					},
+{ "glDisableVertexArrayAttrib",						"uu"				},
+{ "glDisableVertexAttribArray",						"u"					},
+{ "glDisablei",										"xu"				},
+{ "glDispatchCompute",								"uuu"				},
+{ "glDispatchComputeIndirect",						"i"					},
+{ "glDrawArrays",									"xii"				},
+{ "glDrawArraysIndirect",							"xp"				},
+{ "glDrawArraysInstanced",							"xiii"				},
+{ "glDrawArraysInstancedBaseInstance",				"xiiiu"				},
+{ "glDrawBuffer",									"x"					},
+{ "glDrawBuffers",									"ip"				},
+{ "glDrawElements",									"xixp"				},
+{ "glDrawElementsBaseVertex",						"xixpi"				},
+{ "glDrawElementsIndirect",							"xxp"				},
+{ "glDrawElementsInstanced",						"xixpi"				},
+{ "glDrawElementsInstancedBaseInstance",			"xixpiu"			},
+{ "glDrawElementsInstancedBaseVertex",				"xixpii"			},
+{ "glDrawElementsInstancedBaseVertexBaseInstance",	"xixpiiu"			},
+{ "glDrawRangeElements",							"xuuixp"			},
+{ "glDrawRangeElementsBaseVertex",					"xuuixpi"			},
+{ "glDrawTransformFeedback",						"xu"				},
+{ "glDrawTransformFeedbackInstanced",				"xui"				},
+{ "glDrawTransformFeedbackStream",					"xuu"				},
+{ "glDrawTransformFeedbackStreamInstanced",			"xuui"				},
+{ "glEGLImageTargetRenderbufferStorageOES",			"xp"				},
+{ "glEGLImageTargetTexture2DOES",					"xp"				},
+{ "glEnable",										"x"					},
+{ "glEnableVertexArrayAttrib",						"uu"				},
+{ "glEnableVertexAttribArray",						"u"					},
+{ "glEnablei",										"xu"				},
+{ "glEndConditionalRender",							""					},
+{ "glEndQuery",										"x"					},
+{ "glEndQueryIndexed",								"xu"				},
+{ "glEndTransformFeedback",							""					},
+{ "glFenceSync",									"xx"				},
+{ "glFinish",										""					},
+{ "glFlush",										""					},
+{ "glFlushMappedBufferRange",						"xii"				},
+{ "glFlushMappedNamedBufferRange",					"uii"				},
+{ "glFramebufferParameteri",						"xxi"				},
+{ "glFramebufferRenderbuffer",						"xxxu"				},
+{ "glFramebufferTexture",							"xxui"				},
+{ "glFramebufferTexture1D",							"xxxui"				},
+{ "glFramebufferTexture2D",							"xxxui"				},
+{ "glFramebufferTexture3D",							"xxxuii"			},
+{ "glFramebufferTextureLayer",						"xxuii"				},
+{ "glFrontFace",									"x"					},
+{ "glGenBuffers",									"ip"				},
+{ "glGenFramebuffers",								"ip"				},
+{ "glGenProgramPipelines",							"ip"				},
+{ "glGenQueries",									"ip"				},
+{ "glGenRenderbuffers",								"ip"				},
+{ "glGenSamplers",									"ip"				},
+{ "glGenTextures",									"ip"				},
+{ "glGenTransformFeedbacks",						"ip"				},
+{ "glGenVertexArrays",								"ip"				},
+{ "glGenerateMipmap",								"x"					},
+{ "glGenerateTextureMipmap",						"u"					},
+{ "glGetActiveAtomicCounterBufferiv",				"uuxp"				},
+{ "glGetActiveAttrib",								"uuipppp"			},
+{ "glGetActiveSubroutineName",						"uxuipp"			},
+{ "glGetActiveSubroutineUniformName",				"uxuipp"			},
+{ "glGetActiveSubroutineUniformiv",					"uxuxp"				},
+{ "glGetActiveUniform",								"uuipppp"			},
+{ "glGetActiveUniformBlockName",					"uuipp"				},
+{ "glGetActiveUniformBlockiv",						"uuxp"				},
+{ "glGetActiveUniformName",							"uuipp"				},
+{ "glGetActiveUniformsiv",							"uipxp"				},
+{ "glGetAttachedShaders",							"uipp"				},
+{ "glGetAttribLocation",							"up"				},
+{ "glGetBooleani_v",								"xup"				},
+{ "glGetBooleanv",									"xp"				},
+{ "glGetBufferParameteri64v",						"xxp"				},
+{ "glGetBufferParameteriv",							"xxp"				},
+{ "glGetBufferPointerv",							"xxp"				},
+{ "glGetBufferSubData",								"xiip"				},
+{ "glGetCompressedTexImage",						"xip"				},
+{ "glGetCompressedTextureImage",					"uiip"				},
+{ "glGetCompressedTextureSubImage",					"uiiiiiiiip"		},
+{ "glGetDebugMessageLog",							"uipppppp"			},
+{ "glGetDoublei_v",									"xup"				},
+{ "glGetDoublev",									"xp"				},
+{ "glGetError",										""					},
+{ "glGetFloati_v",									"xup"				},
+{ "glGetFloatv",									"xp"				},
+{ "glGetFragDataIndex",								"up"				},
+{ "glGetFragDataLocation",							"up"				},
+{ "glGetFramebufferAttachmentParameteriv",			"xxxp"				},
+{ "glGetFramebufferParameteriv",					"xxp"				},
+{ "glGetGraphicsResetStatus",						""					},
+{ "glGetInteger64i_v",								"xup"				},
+{ "glGetInteger64v",								"xp"				},
+{ "glGetIntegeri_v",								"xup"				},
+{ "glGetIntegerv",									"xp"				},
+{ "glGetInternalformati64v",						"xxxip"				},
+{ "glGetInternalformativ",							"xxxip"				},
+{ "glGetMultisamplefv",								"xup"				},
+{ "glGetNamedBufferParameteri64v",					"uxp"				},
+{ "glGetNamedBufferParameteriv",					"uxp"				},
+{ "glGetNamedBufferPointerv",						"uxp"				},
+{ "glGetNamedBufferSubData",						"uiip"				},
+{ "glGetNamedFramebufferAttachmentParameteriv",		"uxxp"				},
+{ "glGetNamedFramebufferParameteriv",				"uxp"				},
+{ "glGetNamedRenderbufferParameteriv",				"uxp"				},
+{ "glGetObjectLabel",								"xuipp"				},
+{ "glGetObjectPtrLabel",							"pipp"				},
+{ "glGetPointerv",									"xp"				},
+{ "glGetProgramBinary",								"uippp"				},
+{ "glGetProgramInfoLog",							"uipp"				},
+{ "glGetProgramInterfaceiv",						"uxxp"				},
+{ "glGetProgramPipelineInfoLog",					"uipp"				},
+{ "glGetProgramPipelineiv",							"uxp"				},
+{ "glGetProgramResourceIndex",						"uxp"				},
+{ "glGetProgramResourceLocation",					"uxp"				},
+{ "glGetProgramResourceLocationIndex",				"uxp"				},
+{ "glGetProgramResourceName",						"uxuipp"			},
+{ "glGetProgramResourceiv",							"uxuipipp"			},
+{ "glGetProgramStageiv",							"uxxp"				},
+{ "glGetProgramiv",									"uxp"				},
+{ "glGetQueryBufferObjecti64v",						"uuxi"				},
+{ "glGetQueryBufferObjectiv",						"uuxi"				},
+{ "glGetQueryBufferObjectui64v",					"uuxi"				},
+{ "glGetQueryBufferObjectuiv",						"uuxi"				},
+{ "glGetQueryIndexediv",							"xuxp"				},
+{ "glGetQueryObjecti64v",							"uxp"				},
+{ "glGetQueryObjectiv",								"uxp"				},
+{ "glGetQueryObjectui64v",							"uxp"				},
+{ "glGetQueryObjectuiv",							"uxp"				},
+{ "glGetQueryiv",									"xxp"				},
+{ "glGetRenderbufferParameteriv",					"xxp"				},
+{ "glGetSamplerParameterIiv",						"uxp"				},
+{ "glGetSamplerParameterIuiv",						"uxp"				},
+{ "glGetSamplerParameterfv",						"uxp"				},
+{ "glGetSamplerParameteriv",						"uxp"				},
+{ "glGetShaderInfoLog",								"uipp"				},
+{ "glGetShaderPrecisionFormat",						"xxpp"				},
+{ "glGetShaderSource",								"uipp"				},
+{ "glGetShaderiv",									"uxp"				},
+{ "glGetString",									"x"					},
+{ "glGetStringi",									"xu"				},
+{ "glGetSubroutineIndex",							"uxp"				},
+{ "glGetSubroutineUniformLocation",					"uxp"				},
+{ "glGetSynciv",									"pxipp"				},
+{ "glGetTexImage",									"xixxp"				},
+{ "glGetTexLevelParameterfv",						"xixp"				},
+{ "glGetTexLevelParameteriv",						"xixp"				},
+{ "glGetTexParameterIiv",							"xxp"				},
+{ "glGetTexParameterIuiv",							"xxp"				},
+{ "glGetTexParameterfv",							"xxp"				},
+{ "glGetTexParameteriv",							"xxp"				},
+{ "glGetTextureImage",								"uixxip"			},
+{ "glGetTextureLevelParameterfv",					"uixp"				},
+{ "glGetTextureLevelParameteriv",					"uixp"				},
+{ "glGetTextureParameterIiv",						"uxp"				},
+{ "glGetTextureParameterIuiv",						"uxp"				},
+{ "glGetTextureParameterfv",						"uxp"				},
+{ "glGetTextureParameteriv",						"uxp"				},
+{ "glGetTextureSubImage",							"uiiiiiiixxip"		},
+{ "glGetTransformFeedbackVarying",					"uuipppp"			},
+{ "glGetTransformFeedbacki64_v",					"uxup"				},
+{ "glGetTransformFeedbacki_v",						"uxup"				},
+{ "glGetTransformFeedbackiv",						"uxp"				},
+{ "glGetUniformBlockIndex",							"up"				},
+{ "glGetUniformIndices",							"uipp"				},
+{ "glGetUniformLocation",							"up"				},
+{ "glGetUniformSubroutineuiv",						"xip"				},
+{ "glGetUniformdv",									"uip"				},
+{ "glGetUniformfv",									"uip"				},
+{ "glGetUniformiv",									"uip"				},
+{ "glGetUniformuiv",								"uip"				},
+{ "glGetVertexArrayIndexed64iv",					"uuxp"				},
+{ "glGetVertexArrayIndexediv",						"uuxp"				},
+{ "glGetVertexArrayiv",								"uxp"				},
+{ "glGetVertexAttribIiv",							"uxp"				},
+{ "glGetVertexAttribIuiv",							"uxp"				},
+{ "glGetVertexAttribLdv",							"uxp"				},
+{ "glGetVertexAttribPointerv",						"uxp"				},
+{ "glGetVertexAttribdv",							"uxp"				},
+{ "glGetVertexAttribfv",							"uxp"				},
+{ "glGetVertexAttribiv",							"uxp"				},
+{ "glGetnCompressedTexImage",						"xiip"				},
+{ "glGetnTexImage",									"xixxip"			},
+{ "glGetnUniformdv",								"uiip"				},
+{ "glGetnUniformfv",								"uiip"				},
+{ "glGetnUniformiv",								"uiip"				},
+{ "glGetnUniformuiv",								"uiip"				},
+{ "glHint",											"xx"				},
+{ "glInsertEventMarkerEXT",							"ip"				},
+{ "glInvalidateBufferData",							"u"					},
+{ "glInvalidateBufferSubData",						"uii"				},
+{ "glInvalidateFramebuffer",						"xip"				},
+{ "glInvalidateNamedFramebufferData",				"uip"				},
+{ "glInvalidateNamedFramebufferSubData",			"uipiiii"			},
+{ "glInvalidateSubFramebuffer",						"xipiiii"			},
+{ "glInvalidateTexImage",							"ui"				},
+{ "glInvalidateTexSubImage",						"uiiiiiii"			},
+{ "glIsBuffer",										"u"					},
+{ "glIsEnabled",									"x"					},
+{ "glIsEnabledi",									"xu"				},
+{ "glIsFramebuffer",								"u"					},
+{ "glIsProgram",									"u"					},
+{ "glIsProgramPipeline",							"u"					},
+{ "glIsQuery",										"u"					},
+{ "glIsRenderbuffer",								"u"					},
+{ "glIsSampler",									"u"					},
+{ "glIsShader",										"u"					},
+{ "glIsSync",										"p"					},
+{ "glIsTexture",									"u"					},
+{ "glIsTransformFeedback",							"u"					},
+{ "glIsVertexArray",								"u"					},
+{ "glLineWidth",									"f"					},
+{ "glLinkProgram",									"u"					},
+{ "glLogicOp",										"x"					},
+{ "glMapBuffer",									"xx"				},
+{ "glMapBufferRange",								"xiix"				},
+{ "glMapNamedBuffer",								"ux"				},
+{ "glMapNamedBufferRange",							"uiix"				},
+{ "glMemoryBarrier",								"x"					},
+{ "glMemoryBarrierByRegion",						"x"					},
+{ "glMinSampleShading",								"f"					},
+{ "glMultiDrawArrays",								"xppi"				},
+{ "glMultiDrawArraysIndirect",						"xpii"				},
+{ "glMultiDrawElements",							"xpxpi"				},
+{ "glMultiDrawElementsBaseVertex",					"xpxpip"			},
+{ "glMultiDrawElementsIndirect",					"xxpii"				},
+{ "glNamedBufferData",								"uipx"				},
+{ "glNamedBufferStorage",							"uipx"				},
+{ "glNamedBufferSubData",							"uiip"				},
+{ "glNamedFramebufferDrawBuffer",					"ux"				},
+{ "glNamedFramebufferDrawBuffers",					"uip"				},
+{ "glNamedFramebufferParameteri",					"uxi"				},
+{ "glNamedFramebufferReadBuffer",					"ux"				},
+{ "glNamedFramebufferRenderbuffer",					"uxxu"				},
+{ "glNamedFramebufferTexture",						"uxui"				},
+{ "glNamedFramebufferTextureLayer",					"uxuii"				},
+{ "glNamedRenderbufferStorage",						"uxii"				},
+{ "glNamedRenderbufferStorageMultisample",			"uixii"				},
+{ "glObjectLabel",									"xuip"				},
+{ "glObjectPtrLabel",								"pip"				},
+{ "glPatchParameterfv",								"xp"				},
+{ "glPatchParameteri",								"xi"				},
+{ "glPauseTransformFeedback",						""					},
+{ "glPixelStoref",									"xf"				},
+{ "glPixelStorei",									"xi"				},
+{ "glPointParameterf",								"xf"				},
+{ "glPointParameterfv",								"xp"				},
+{ "glPointParameteri",								"xi"				},
+{ "glPointParameteriv",								"xp"				},
+{ "glPointSize",									"f"					},
+{ "glPolygonMode",									"xx"				},
+{ "glPolygonOffset",								"ff"				},
+{ "glPopDebugGroup",								""					},
+{ "glPopGroupMarkerEXT",							""					},
+{ "glPrimitiveBoundingBoxEXT",						"ffffffff"			},
+{ "glPrimitiveRestartIndex",						"u"					},
+{ "glProgramBinary",								"uxpi"				},
+{ "glProgramParameteri",							"uxi"				},
+{ "glProgramUniform1d",								"uid"				},
+{ "glProgramUniform1dv",							"uiip"				},
+{ "glProgramUniform1f",								"uif"				},
+{ "glProgramUniform1fv",							"uiip"				},
+{ "glProgramUniform1i",								"uii"				},
+{ "glProgramUniform1iv",							"uiip"				},
+{ "glProgramUniform1ui",							"uiu"				},
+{ "glProgramUniform1uiv",							"uiip"				},
+{ "glProgramUniform2d",								"uidd"				},
+{ "glProgramUniform2dv",							"uiip"				},
+{ "glProgramUniform2f",								"uiff"				},
+{ "glProgramUniform2fv",							"uiip"				},
+{ "glProgramUniform2i",								"uiii"				},
+{ "glProgramUniform2iv",							"uiip"				},
+{ "glProgramUniform2ui",							"uiuu"				},
+{ "glProgramUniform2uiv",							"uiip"				},
+{ "glProgramUniform3d",								"uiddd"				},
+{ "glProgramUniform3dv",							"uiip"				},
+{ "glProgramUniform3f",								"uifff"				},
+{ "glProgramUniform3fv",							"uiip"				},
+{ "glProgramUniform3i",								"uiiii"				},
+{ "glProgramUniform3iv",							"uiip"				},
+{ "glProgramUniform3ui",							"uiuuu"				},
+{ "glProgramUniform3uiv",							"uiip"				},
+{ "glProgramUniform4d",								"uidddd"			},
+{ "glProgramUniform4dv",							"uiip"				},
+{ "glProgramUniform4f",								"uiffff"			},
+{ "glProgramUniform4fv",							"uiip"				},
+{ "glProgramUniform4i",								"uiiiii"			},
+{ "glProgramUniform4iv",							"uiip"				},
+{ "glProgramUniform4ui",							"uiuuuu"			},
+{ "glProgramUniform4uiv",							"uiip"				},
+{ "glProgramUniformMatrix2dv",						"uiiup"				},
+{ "glProgramUniformMatrix2fv",						"uiiup"				},
+{ "glProgramUniformMatrix2x3dv",					"uiiup"				},
+{ "glProgramUniformMatrix2x3fv",					"uiiup"				},
+{ "glProgramUniformMatrix2x4dv",					"uiiup"				},
+{ "glProgramUniformMatrix2x4fv",					"uiiup"				},
+{ "glProgramUniformMatrix3dv",						"uiiup"				},
+{ "glProgramUniformMatrix3fv",						"uiiup"				},
+{ "glProgramUniformMatrix3x2dv",					"uiiup"				},
+{ "glProgramUniformMatrix3x2fv",					"uiiup"				},
+{ "glProgramUniformMatrix3x4dv",					"uiiup"				},
+{ "glProgramUniformMatrix3x4fv",					"uiiup"				},
+{ "glProgramUniformMatrix4dv",						"uiiup"				},
+{ "glProgramUniformMatrix4fv",						"uiiup"				},
+{ "glProgramUniformMatrix4x2dv",					"uiiup"				},
+{ "glProgramUniformMatrix4x2fv",					"uiiup"				},
+{ "glProgramUniformMatrix4x3dv",					"uiiup"				},
+{ "glProgramUniformMatrix4x3fv",					"uiiup"				},
+{ "glProvokingVertex",								"x"					},
+{ "glPushDebugGroup",								"xuip"				},
+{ "glPushGroupMarkerEXT",							"ip"				},
+{ "glQueryCounter",									"ux"				},
+{ "glReadBuffer",									"x"					},
+{ "glReadPixels",									"iiiixxp"			},
+{ "glReadnPixels",									"iiiixxip"			},
+{ "glReleaseShaderCompiler",						""					},
+{ "glRenderbufferStorage",							"xxii"				},
+{ "glRenderbufferStorageMultisample",				"xixii"				},
+{ "glResumeTransformFeedback",						""					},
+{ "glSampleCoverage",								"fu"				},
+{ "glSampleMaski",									"ux"				},
+{ "glSamplerParameterIiv",							"uxp"				},
+{ "glSamplerParameterIuiv",							"uxp"				},
+{ "glSamplerParameterf",							"uxf"				},
+{ "glSamplerParameterfv",							"uxp"				},
+{ "glSamplerParameteri",							"uxi"				},
+{ "glSamplerParameteriv",							"uxp"				},
+{ "glScissor",										"iiii"				},
+{ "glScissorArrayv",								"uip"				},
+{ "glScissorIndexed",								"uiiii"				},
+{ "glScissorIndexedv",								"up"				},
+{ "glShaderBinary",									"ipxpi"				},
+{ "glShaderSource",									"uipp"				},
+{ "glShaderStorageBlockBinding",					"uuu"				},
+{ "glStencilFunc",									"xiu"				},
+{ "glStencilFuncSeparate",							"xxiu"				},
+{ "glStencilMask",									"u"					},
+{ "glStencilMaskSeparate",							"xu"				},
+{ "glStencilOp",									"xxx"				},
+{ "glStencilOpSeparate",							"xxxx"				},
+{ "glTexBuffer",									"xxu"				},
+{ "glTexBufferRange",								"xxuii"				},
+{ "glTexImage1D",									"xiiiixxp"			},
+{ "glTexImage2D",									"xiiiiixxp"			},
+{ "glTexImage2DMultisample",						"xixiiu"			},
+{ "glTexImage3D",									"xiiiiiixxp"		},
+{ "glTexImage3DMultisample",						"xixiiiu"			},
+{ "glTexParameterIiv",								"xxp"				},
+{ "glTexParameterIuiv",								"xxp"				},
+{ "glTexParameterf",								"xxf"				},
+{ "glTexParameterfv",								"xxp"				},
+{ "glTexParameteri",								"xxi"				},
+{ "glTexParameteriv",								"xxp"				},
+{ "glTexStorage1D",									"xixi"				},
+{ "glTexStorage2D",									"xixii"				},
+{ "glTexStorage2DMultisample",						"xixiiu"			},
+{ "glTexStorage3D",									"xixiii"			},
+{ "glTexStorage3DMultisample",						"xixiiiu"			},
+{ "glTexSubImage1D",								"xiiixxp"			},
+{ "glTexSubImage2D",								"xiiiiixxp"			},
+{ "glTexSubImage3D",								"xiiiiiiixxp"		},
+{ "glTextureBarrier",								""					},
+{ "glTextureBuffer",								"uxu"				},
+{ "glTextureBufferRange",							"uxuii"				},
+{ "glTextureParameterIiv",							"uxp"				},
+{ "glTextureParameterIuiv",							"uxp"				},
+{ "glTextureParameterf",							"uxf"				},
+{ "glTextureParameterfv",							"uxp"				},
+{ "glTextureParameteri",							"uxi"				},
+{ "glTextureParameteriv",							"uxp"				},
+{ "glTextureStorage1D",								"uixi"				},
+{ "glTextureStorage2D",								"uixii"				},
+{ "glTextureStorage2DMultisample",					"uixiiu"			},
+{ "glTextureStorage3D",								"uixiii"			},
+{ "glTextureStorage3DMultisample",					"uixiiiu"			},
+{ "glTextureSubImage1D",							"uiiixxp"			},
+{ "glTextureSubImage2D",							"uiiiiixxp"			},
+{ "glTextureSubImage3D",							"uiiiiiiixxp"		},
+{ "glTextureView",									"uxuxuuuu"			},
+{ "glTransformFeedbackBufferBase",					"uuu"				},
+{ "glTransformFeedbackBufferRange",					"uuuii"				},
+{ "glTransformFeedbackVaryings",					"uipx"				},
+{ "glUniform1d",									"id"				},
+{ "glUniform1dv",									"iip"				},
+{ "glUniform1f",									"if"				},
+{ "glUniform1fv",									"iip"				},
+{ "glUniform1i",									"ii"				},
+{ "glUniform1iv",									"iip"				},
+{ "glUniform1ui",									"iu"				},
+{ "glUniform1uiv",									"iip"				},
+{ "glUniform2d",									"idd"				},
+{ "glUniform2dv",									"iip"				},
+{ "glUniform2f",									"iff"				},
+{ "glUniform2fv",									"iip"				},
+{ "glUniform2i",									"iii"				},
+{ "glUniform2iv",									"iip"				},
+{ "glUniform2ui",									"iuu"				},
+{ "glUniform2uiv",									"iip"				},
+{ "glUniform3d",									"iddd"				},
+{ "glUniform3dv",									"iip"				},
+{ "glUniform3f",									"ifff"				},
+{ "glUniform3fv",									"iip"				},
+{ "glUniform3i",									"iiii"				},
+{ "glUniform3iv",									"iip"				},
+{ "glUniform3ui",									"iuuu"				},
+{ "glUniform3uiv",									"iip"				},
+{ "glUniform4d",									"idddd"				},
+{ "glUniform4dv",									"iip"				},
+{ "glUniform4f",									"iffff"				},
+{ "glUniform4fv",									"iip"				},
+{ "glUniform4i",									"iiiii"				},
+{ "glUniform4iv",									"iip"				},
+{ "glUniform4ui",									"iuuuu"				},
+{ "glUniform4uiv",									"iip"				},
+{ "glUniformBlockBinding",							"uuu"				},
+{ "glUniformMatrix2dv",								"iiup"				},
+{ "glUniformMatrix2fv",								"iiup"				},
+{ "glUniformMatrix2x3dv",							"iiup"				},
+{ "glUniformMatrix2x3fv",							"iiup"				},
+{ "glUniformMatrix2x4dv",							"iiup"				},
+{ "glUniformMatrix2x4fv",							"iiup"				},
+{ "glUniformMatrix3dv",								"iiup"				},
+{ "glUniformMatrix3fv",								"iiup"				},
+{ "glUniformMatrix3x2dv",							"iiup"				},
+{ "glUniformMatrix3x2fv",							"iiup"				},
+{ "glUniformMatrix3x4dv",							"iiup"				},
+{ "glUniformMatrix3x4fv",							"iiup"				},
+{ "glUniformMatrix4dv",								"iiup"				},
+{ "glUniformMatrix4fv",								"iiup"				},
+{ "glUniformMatrix4x2dv",							"iiup"				},
+{ "glUniformMatrix4x2fv",							"iiup"				},
+{ "glUniformMatrix4x3dv",							"iiup"				},
+{ "glUniformMatrix4x3fv",							"iiup"				},
+{ "glUniformSubroutinesuiv",						"xip"				},
+{ "glUnmapBuffer",									"x"					},
+{ "glUnmapNamedBuffer",								"u"					},
+{ "glUseProgram",									"u"					},
+{ "glUseProgramStages",								"uxu"				},
+{ "glValidateProgram",								"u"					},
+{ "glValidateProgramPipeline",						"u"					},
+{ "glVertexArrayAttribBinding",						"uuu"				},
+{ "glVertexArrayAttribFormat",						"uuixuu"			},
+{ "glVertexArrayAttribIFormat",						"uuixu"				},
+{ "glVertexArrayAttribLFormat",						"uuixu"				},
+{ "glVertexArrayBindingDivisor",					"uuu"				},
+{ "glVertexArrayElementBuffer",						"uu"				},
+{ "glVertexArrayVertexBuffer",						"uuuii"				},
+{ "glVertexArrayVertexBuffers",						"uuippp"			},
+{ "glVertexAttrib1d",								"ud"				},
+{ "glVertexAttrib1dv",								"up"				},
+{ "glVertexAttrib1f",								"uf"				},
+{ "glVertexAttrib1fv",								"up"				},
+{ "glVertexAttrib1s",								"ui"				},
+{ "glVertexAttrib1sv",								"up"				},
+{ "glVertexAttrib2d",								"udd"				},
+{ "glVertexAttrib2dv",								"up"				},
+{ "glVertexAttrib2f",								"uff"				},
+{ "glVertexAttrib2fv",								"up"				},
+{ "glVertexAttrib2s",								"uii"				},
+{ "glVertexAttrib2sv",								"up"				},
+{ "glVertexAttrib3d",								"uddd"				},
+{ "glVertexAttrib3dv",								"up"				},
+{ "glVertexAttrib3f",								"ufff"				},
+{ "glVertexAttrib3fv",								"up"				},
+{ "glVertexAttrib3s",								"uiii"				},
+{ "glVertexAttrib3sv",								"up"				},
+{ "glVertexAttrib4Nbv",								"up"				},
+{ "glVertexAttrib4Niv",								"up"				},
+{ "glVertexAttrib4Nsv",								"up"				},
+{ "glVertexAttrib4Nub",								"uuuuu"				},
+{ "glVertexAttrib4Nubv",							"up"				},
+{ "glVertexAttrib4Nuiv",							"up"				},
+{ "glVertexAttrib4Nusv",							"up"				},
+{ "glVertexAttrib4bv",								"up"				},
+{ "glVertexAttrib4d",								"udddd"				},
+{ "glVertexAttrib4dv",								"up"				},
+{ "glVertexAttrib4f",								"uffff"				},
+{ "glVertexAttrib4fv",								"up"				},
+{ "glVertexAttrib4iv",								"up"				},
+{ "glVertexAttrib4s",								"uiiii"				},
+{ "glVertexAttrib4sv",								"up"				},
+{ "glVertexAttrib4ubv",								"up"				},
+{ "glVertexAttrib4uiv",								"up"				},
+{ "glVertexAttrib4usv",								"up"				},
+{ "glVertexAttribBinding",							"uu"				},
+{ "glVertexAttribDivisor",							"uu"				},
+{ "glVertexAttribFormat",							"uixuu"				},
+{ "glVertexAttribI1i",								"ui"				},
+{ "glVertexAttribI1iv",								"up"				},
+{ "glVertexAttribI1ui",								"uu"				},
+{ "glVertexAttribI1uiv",							"up"				},
+{ "glVertexAttribI2i",								"uii"				},
+{ "glVertexAttribI2iv",								"up"				},
+{ "glVertexAttribI2ui",								"uuu"				},
+{ "glVertexAttribI2uiv",							"up"				},
+{ "glVertexAttribI3i",								"uiii"				},
+{ "glVertexAttribI3iv",								"up"				},
+{ "glVertexAttribI3ui",								"uuuu"				},
+{ "glVertexAttribI3uiv",							"up"				},
+{ "glVertexAttribI4bv",								"up"				},
+{ "glVertexAttribI4i",								"uiiii"				},
+{ "glVertexAttribI4iv",								"up"				},
+{ "glVertexAttribI4sv",								"up"				},
+{ "glVertexAttribI4ubv",							"up"				},
+{ "glVertexAttribI4ui",								"uuuuu"				},
+{ "glVertexAttribI4uiv",							"up"				},
+{ "glVertexAttribI4usv",							"up"				},
+{ "glVertexAttribIFormat",							"uixu"				},
+{ "glVertexAttribIPointer",							"uixip"				},
+{ "glVertexAttribL1d",								"ud"				},
+{ "glVertexAttribL1dv",								"up"				},
+{ "glVertexAttribL2d",								"udd"				},
+{ "glVertexAttribL2dv",								"up"				},
+{ "glVertexAttribL3d",								"uddd"				},
+{ "glVertexAttribL3dv",								"up"				},
+{ "glVertexAttribL4d",								"udddd"				},
+{ "glVertexAttribL4dv",								"up"				},
+{ "glVertexAttribLFormat",							"uixu"				},
+{ "glVertexAttribLPointer",							"uixip"				},
+{ "glVertexAttribP1ui",								"uxuu"				},
+{ "glVertexAttribP1uiv",							"uxup"				},
+{ "glVertexAttribP2ui",								"uxuu"				},
+{ "glVertexAttribP2uiv",							"uxup"				},
+{ "glVertexAttribP3ui",								"uxuu"				},
+{ "glVertexAttribP3uiv",							"uxup"				},
+{ "glVertexAttribP4ui",								"uxuu"				},
+{ "glVertexAttribP4uiv",							"uxup"				},
+{ "glVertexAttribPointer",							"uixuip"			},
+{ "glVertexBindingDivisor",							"uu"				},
+{ "glViewport",										"iiii"				},
+{ "glViewportArrayv",								"uip"				},
+{ "glViewportIndexedf",								"uffff"				},
+{ "glViewportIndexedfv",							"up"				},
+{ "glWaitSync",										"pxu"				},
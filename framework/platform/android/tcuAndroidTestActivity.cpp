@@ -23,6 +23,7 @@
 
 #include "tcuAndroidTestActivity.hpp"
 #include "tcuAndroidUtil.hpp"
+#include "tcuPackedArchive.hpp"
 
 #include <android/window.h>
 
@@ -38,13 +39,21 @@ namespace Android
 
 // TestThread
 
+static Archive* createArchive (NativeActivity& activity, const CommandLine& cmdLine)
+{
+	if (cmdLine.getResourceArchive())
+		return new PackedArchive(cmdLine.getResourceArchive());
+	else
+		return new AssetArchive(activity.getNativeActivity()->assetManager);
+}
+
 TestThread::TestThread (NativeActivity& activity, const CommandLine& cmdLine)
 	: RenderThread	(activity)
 	, m_cmdLine		(cmdLine)
 	, m_platform	(activity)
-	, m_archive		(activity.getNativeActivity()->assetManager)
+	, m_archive		(createArchive(activity, cmdLine))
 	, m_log			(m_cmdLine.getLogFileName(), m_cmdLine.getLogFlags())
-	, m_app			(m_platform, m_archive, m_log, m_cmdLine)
+	, m_app			(m_platform, *m_archive, m_log, m_cmdLine)
 	, m_finished	(false)
 {
 }
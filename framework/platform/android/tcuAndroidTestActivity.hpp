@@ -30,6 +30,7 @@
 #include "tcuAndroidAssets.hpp"
 #include "tcuTestLog.hpp"
 #include "tcuApp.hpp"
+#include "deUniquePtr.hpp"
 
 namespace tcu
 {
@@ -52,7 +53,7 @@ private:
 
 	const CommandLine&		m_cmdLine;
 	Platform				m_platform;
-	AssetArchive			m_archive;
+	de::UniquePtr<Archive>	m_archive;
 	TestLog					m_log;
 	App						m_app;
 	bool					m_finished;					//!< Is execution finished.
@@ -26,14 +26,65 @@
 #include "tcuPlatform.hpp"
 #include "tcuApp.hpp"
 #include "tcuResource.hpp"
+#include "tcuPackedArchive.hpp"
 #include "tcuTestLog.hpp"
 #include "deUniquePtr.hpp"
 
+#if (DE_OS == DE_OS_UNIX) || (DE_OS == DE_OS_OSX)
+#	include "fsForkServer.hpp"
+#	define TCU_MAIN_SUPPORT_FORK_SERVER 1
+#endif
+
 #include <cstdio>
 
 // Implement this in your platform port.
 tcu::Platform* createPlatform (void);
 
+static tcu::Archive* createArchive (const tcu::CommandLine& cmdLine)
+{
+	if (cmdLine.getResourceArchive())
+		return new tcu::PackedArchive(cmdLine.getResourceArchive());
+	else
+		return new tcu::DirArchive(".");
+}
+
+static void runTests (const tcu::CommandLine& cmdLine, tcu::Archive& archive)
+{
+	tcu::TestLog					log			(cmdLine.getLogFileName(), cmdLine.getLogFlags());
+	de::UniquePtr<tcu::Platform>	platform	(createPlatform());
+	de::UniquePtr<tcu::App>			app			(new tcu::App(*platform, archive, log, cmdLine));
+
+	// Main loop.
+	for (;;)
+	{
+		if (!app->iterate())
+			break;
+	}
+}
+
+#if defined(TCU_MAIN_SUPPORT_FORK_SERVER)
+
+static int runForkServerSession (int argc, const char* const* argv, void* userPtr)
+{
+	// \note Platform is created in the forked child as window system and driver state can't be shared across fork().
+	//		 Test packages are created in the child as well since they are bound to the per-session test context.
+	try
+	{
+		tcu::Archive&			archive		= *static_cast<tcu::Archive*>(userPtr);
+		const tcu::CommandLine	cmdLine		(argc, argv);
+
+		runTests(cmdLine, archive);
+	}
+	catch (const std::exception& e)
+	{
+		tcu::die("%s", e.what());
+	}
+
+	return 0;
+}
+
+#endif // TCU_MAIN_SUPPORT_FORK_SERVER
+
 int main (int argc, const char* argv[])
 {
 #if (DE_OS != DE_OS_WIN32)
@@ -44,17 +95,18 @@ int main (int argc, const char* argv[])
 	try
 	{
 		tcu::CommandLine				cmdLine		(argc, argv);
-		tcu::DirArchive					archive		(".");
-		tcu::TestLog					log			(cmdLine.getLogFileName(), cmdLine.getLogFlags());
-		de::UniquePtr<tcu::Platform>	platform	(createPlatform());
-		de::UniquePtr<tcu::App>			app			(new tcu::App(*platform, archive, log, cmdLine));
+		de::UniquePtr<tcu::Archive>		archive		(createArchive(cmdLine));
 
-		// Main loop.
-		for (;;)
+#if defined(TCU_MAIN_SUPPORT_FORK_SERVER)
+		if (cmdLine.isForkServerEnabled())
 		{
-			if (!app->iterate())
-				break;
+			// Archive is opened once and shared by all forked test processes.
+			fs::runForkServer(argv[0], runForkServerSession, archive.get());
+			return 0;
 		}
+#endif
+
+		runTests(cmdLine, *archive);
 	}
 	catch (const std::exception& e)
 	{
@@ -29,8 +29,10 @@
 #include "deMemory.h"
 #include "deInt32.h"
 #include "deString.h"
+#include "deSha1.h"
 
 #include "deMutex.h"
+#include "deAtomic.h"
 
 #if defined(QP_SUPPORT_PNG)
 #	include <png.h>
@@ -39,6 +41,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdarg.h>
+#include <string.h>
 
 #if (DE_OS == DE_OS_WIN32)
 #	include <windows.h>
@@ -124,6 +127,9 @@ struct qpTestLog_s
 {
 	deUint32				flags;				/*!< Logging flags.						*/
 
+	char*					fileName;			/*!< Log file name, buffer logs are created next to it.	*/
+	char*					tempFileName;		/*!< Buffer log file to remove on destroy, if not removed when opened.	*/
+
 	deMutex					lock;				/*!< Lock for mutable state below.		*/
 
 	/* State protected by lock. */
@@ -132,6 +138,10 @@ struct qpTestLog_s
 	deBool					isSessionOpen;
 	deBool					isCaseOpen;
 
+	deSha1*					imageHashes;		/*!< Hashes of images logged in current case.	*/
+	int						numImageHashes;
+	int						imageHashCapacity;
+
 #if defined(DE_DEBUG)
 	ContainerStack			containerStack;		/*!< For container usage verification.	*/
 #endif
@@ -144,7 +154,7 @@ typedef struct qpKeyStringMap_s
 	char*	string;
 } qpKeyStringMap;
 
-static const char* LOG_FORMAT_VERSION = "0.3.3";
+static const char* LOG_FORMAT_VERSION = "0.3.4";
 
 /* Mapping enum to above strings... */
 static const qpKeyStringMap s_qpTestTypeMap[] =
@@ -323,32 +333,20 @@ static deBool endSession (qpTestLog* log)
 	return DE_TRUE;
 }
 
-/*--------------------------------------------------------------------*//*!
- * \brief Create a file based logger instance
- * \param fileName Name of the file where to put logs
- * \return qpTestLog instance, or DE_NULL if cannot create file
- *//*--------------------------------------------------------------------*/
-qpTestLog* qpTestLog_createFileLog (const char* fileName, deUint32 flags)
+static qpTestLog* createLog (FILE* outputFile, deUint32 flags)
 {
 	qpTestLog* log = (qpTestLog*)deCalloc(sizeof(qpTestLog));
 	if (!log)
+	{
+		fclose(outputFile);
 		return DE_NULL;
-
-	DE_ASSERT(fileName && fileName[0]); /* must have filename. */
+	}
 
 #if defined(DE_DEBUG)
 	ContainerStack_reset(&log->containerStack);
 #endif
 
-	/* Create output file. */
-	log->outputFile = fopen(fileName, "wb");
-	if (!log->outputFile)
-	{
-		qpPrintf("ERROR: Unable to open test log output file '%s'.\n", fileName);
-		qpTestLog_destroy(log);
-		return DE_NULL;
-	}
-
+	log->outputFile		= outputFile;
 	log->flags			= flags;
 	log->writer			= qpXmlWriter_createFileWriter(log->outputFile, 0);
 	log->lock			= deMutex_create(DE_NULL);
@@ -357,7 +355,7 @@ qpTestLog* qpTestLog_createFileLog (const char* fileName, deUint32 flags)
 
 	if (!log->writer)
 	{
-		qpPrintf("ERROR: Unable to create output XML writer to file '%s'.\n", fileName);
+		qpPrintf("ERROR: Unable to create output XML writer.\n");
 		qpTestLog_destroy(log);
 		return DE_NULL;
 	}
@@ -369,11 +367,224 @@ qpTestLog* qpTestLog_createFileLog (const char* fileName, deUint32 flags)
 		return DE_NULL;
 	}
 
+	return log;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Create a file based logger instance
+ * \param fileName Name of the file where to put logs
+ * \return qpTestLog instance, or DE_NULL if cannot create file
+ *//*--------------------------------------------------------------------*/
+qpTestLog* qpTestLog_createFileLog (const char* fileName, deUint32 flags)
+{
+	FILE*		outputFile;
+	qpTestLog*	log;
+
+	DE_ASSERT(fileName && fileName[0]); /* must have filename. */
+
+	/* Create output file. */
+	outputFile = fopen(fileName, "wb");
+	if (!outputFile)
+	{
+		qpPrintf("ERROR: Unable to open test log output file '%s'.\n", fileName);
+		return DE_NULL;
+	}
+
+	log = createLog(outputFile, flags);
+	if (!log)
+		return DE_NULL;
+
+	log->fileName = deStrdup(fileName);
+	if (!log->fileName)
+	{
+		qpPrintf("ERROR: Out of memory.\n");
+		qpTestLog_destroy(log);
+		return DE_NULL;
+	}
+
 	beginSession(log);
 
 	return log;
 }
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Create a buffered logger instance
+ *
+ * Buffered log collects test case results into a temporary file without
+ * session header. Results are written to the actual log with
+ * qpTestLog_appendBufferLog(). This allows executing several test cases
+ * concurrently while keeping results in the main log in case order.
+ *
+ * The temporary file is created next to the log file, since tmpfile() is
+ * not usable on all platforms (e.g. Android applications). The file is
+ * unlinked right away where the platform allows it and otherwise removed
+ * when the buffered log is destroyed.
+ *
+ * \param log Log to create buffered log for
+ * \return qpTestLog instance, or DE_NULL if temporary file cannot be created
+ *//*--------------------------------------------------------------------*/
+qpTestLog* qpTestLog_createBufferLog (const qpTestLog* log)
+{
+	static volatile deUint32	s_bufferLogNdx	= 0;
+	char*						tempFileName;
+	size_t						tempFileNameSize;
+	FILE*						outputFile;
+	qpTestLog*					bufferLog;
+
+	DE_ASSERT(log && log->fileName);
+
+	tempFileNameSize	= strlen(log->fileName) + 16;
+	tempFileName		= (char*)deMalloc(tempFileNameSize);
+	if (!tempFileName)
+	{
+		qpPrintf("ERROR: Out of memory.\n");
+		return DE_NULL;
+	}
+
+	deSprintf(tempFileName, tempFileNameSize, "%s.buf%u", log->fileName, deAtomicIncrementUint32(&s_bufferLogNdx));
+
+	outputFile = fopen(tempFileName, "w+b");
+	if (!outputFile)
+	{
+		qpPrintf("ERROR: Unable to create buffered test log file '%s'.\n", tempFileName);
+		deFree(tempFileName);
+		return DE_NULL;
+	}
+
+	/* Open file can't be removed on Windows, defer to qpTestLog_destroy(). */
+	if (remove(tempFileName) == 0)
+	{
+		deFree(tempFileName);
+		tempFileName = DE_NULL;
+	}
+
+	bufferLog = createLog(outputFile, log->flags);
+	if (!bufferLog)
+	{
+		if (tempFileName)
+		{
+			remove(tempFileName);
+			deFree(tempFileName);
+		}
+		return DE_NULL;
+	}
+
+	bufferLog->tempFileName	= tempFileName;
+	bufferLog->fileName		= deStrdup(log->fileName);
+
+	if (!bufferLog->fileName)
+	{
+		qpPrintf("ERROR: Out of memory.\n");
+		qpTestLog_destroy(bufferLog);
+		return DE_NULL;
+	}
+
+	return bufferLog;
+}
+
+/* Copy everything written to bufferLog so far to the end of log. */
+static deBool copyBufferLog (qpTestLog* log, qpTestLog* bufferLog)
+{
+	char	buffer[16*1024];
+	deBool	isOk	= DE_TRUE;
+
+	qpXmlWriter_flush(log->writer);
+	fflush(bufferLog->outputFile);
+	rewind(bufferLog->outputFile);
+
+	for (;;)
+	{
+		const size_t numRead = fread(buffer, 1, sizeof(buffer), bufferLog->outputFile);
+
+		if (numRead > 0 && fwrite(buffer, 1, numRead, log->outputFile) != numRead)
+		{
+			isOk = DE_FALSE;
+			break;
+		}
+
+		if (numRead < sizeof(buffer))
+		{
+			isOk = !ferror(bufferLog->outputFile);
+			break;
+		}
+	}
+
+	/* Leave buffer log positioned at end in case it is written further. */
+	fseek(bufferLog->outputFile, 0, SEEK_END);
+	qpTestLog_flushFile(log);
+
+	return isOk;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Append contents of buffered log to log
+ * \param log		qpTestLog instance
+ * \param bufferLog	Log created with qpTestLog_createBufferLog()
+ * \return true if ok, false otherwise
+ *
+ * Buffered log may not have a test case open. If log has a test case open,
+ * buffered log must contain only case content (no complete test cases),
+ * which is then inserted into the open case. Contents are written
+ * atomically with respect to other logging calls on log.
+ *//*--------------------------------------------------------------------*/
+deBool qpTestLog_appendBufferLog (qpTestLog* log, qpTestLog* bufferLog)
+{
+	deBool isOk;
+
+	DE_ASSERT(log && bufferLog && log != bufferLog);
+	DE_ASSERT(!bufferLog->isSessionOpen);
+
+	deMutex_lock(bufferLog->lock);
+	deMutex_lock(log->lock);
+
+	DE_ASSERT(!bufferLog->isCaseOpen);
+
+	qpXmlWriter_flush(bufferLog->writer);
+	isOk = copyBufferLog(log, bufferLog);
+
+	deMutex_unlock(log->lock);
+	deMutex_unlock(bufferLog->lock);
+
+	if (!isOk)
+		qpPrintf("qpTestLog_appendBufferLog(): Copying buffered log failed\n");
+
+	return isOk;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Append partial contents of an interrupted buffered log to log
+ * \param log		qpTestLog instance with no test case open
+ * \param bufferLog	Log created with qpTestLog_createBufferLog() with a test case open
+ * \return true if ok, false otherwise
+ *
+ * For crash and timeout handlers. Contents written to bufferLog so far are
+ * copied to log and the test case is left open in log, so that it can be
+ * terminated with qpTestLog_terminateCase(). Lock of bufferLog is not
+ * taken since its owner may have been interrupted while holding it.
+ *//*--------------------------------------------------------------------*/
+deBool qpTestLog_appendInterruptedBufferLog (qpTestLog* log, qpTestLog* bufferLog)
+{
+	deBool isOk;
+
+	DE_ASSERT(log && bufferLog && log != bufferLog);
+
+	deMutex_lock(log->lock);
+
+	if (log->isCaseOpen || !bufferLog->isCaseOpen)
+	{
+		deMutex_unlock(log->lock);
+		return DE_FALSE; /* Soft error. This is called from error handler. */
+	}
+
+	isOk = copyBufferLog(log, bufferLog);
+
+	if (isOk)
+		log->isCaseOpen = DE_TRUE;
+
+	deMutex_unlock(log->lock);
+	return isOk;
+}
+
 /*--------------------------------------------------------------------*//*!
  * \brief Destroy a logger instance
  * \param a	qpTestLog instance
@@ -391,9 +602,17 @@ void qpTestLog_destroy (qpTestLog* log)
 	if (log->outputFile)
 		fclose(log->outputFile);
 
+	if (log->tempFileName)
+	{
+		remove(log->tempFileName);
+		deFree(log->tempFileName);
+	}
+
 	if (log->lock)
 		deMutex_destroy(log->lock);
 
+	deFree(log->fileName);
+	deFree(log->imageHashes);
 	deFree(log);
 }
 
@@ -421,7 +640,8 @@ deBool qpTestLog_startCase (qpTestLog* log, const char* testCasePath, qpTestCase
 	fprintf(log->outputFile, "\n#beginTestCaseResult %s\n", testCasePath);
 	qpTestLog_flushFile(log);
 
-	log->isCaseOpen = DE_TRUE;
+	log->isCaseOpen		= DE_TRUE;
+	log->numImageHashes	= 0;
 
 	/* Fill in attributes. */
 	resultAttribs[numResultAttribs++] = qpSetStringAttrib("Version", LOG_FORMAT_VERSION);
@@ -758,6 +978,60 @@ static deBool compressImagePNG (Buffer* buffer, qpImageFormat imageFormat, int w
 }
 #endif /* QP_SUPPORT_PNG */
 
+/* Hash of image contents. Row padding is not included. */
+static void computeImageHash (deSha1* hash, qpImageFormat imageFormat, int width, int height, int rowStride, const void* data)
+{
+	const int		pixelSize	= imageFormat == QP_IMAGE_FORMAT_RGB888 ? 3 : 4;
+	deInt32			header[3];
+	deSha1Stream	stream;
+	int				row;
+
+	header[0] = (deInt32)imageFormat;
+	header[1] = width;
+	header[2] = height;
+
+	deSha1Stream_init(&stream);
+	deSha1Stream_process(&stream, sizeof(header), &header[0]);
+
+	for (row = 0; row < height; row++)
+		deSha1Stream_process(&stream, (size_t)(pixelSize*width), (const deUint8*)data + row*rowStride);
+
+	deSha1Stream_finalize(&stream, hash);
+}
+
+/* \note Must be called with log lock held. */
+static deBool hasImageHash (const qpTestLog* log, const deSha1* hash)
+{
+	int ndx;
+
+	for (ndx = 0; ndx < log->numImageHashes; ndx++)
+	{
+		if (deSha1_equal(&log->imageHashes[ndx], hash))
+			return DE_TRUE;
+	}
+
+	return DE_FALSE;
+}
+
+/* \note Must be called with log lock held. */
+static deBool addImageHash (qpTestLog* log, const deSha1* hash)
+{
+	if (log->numImageHashes == log->imageHashCapacity)
+	{
+		const int	newCapacity	= deMax32(2*log->imageHashCapacity, 16);
+		deSha1*		newHashes	= (deSha1*)deRealloc(log->imageHashes, sizeof(deSha1)*(size_t)newCapacity);
+
+		if (!newHashes)
+			return DE_FALSE;
+
+		log->imageHashes		= newHashes;
+		log->imageHashCapacity	= newCapacity;
+	}
+
+	log->imageHashes[log->numImageHashes++] = *hash;
+	return DE_TRUE;
+}
+
 /*--------------------------------------------------------------------*//*!
  * \brief Start image set
  * \param log			qpTestLog instance
@@ -817,6 +1091,11 @@ deBool qpTestLog_endImageSet (qpTestLog* log)
 
 /*--------------------------------------------------------------------*//*!
  * \brief Write base64 encoded raw image data into log
+ *
+ * Images are identified by a hash of their contents. If an identical
+ * image has already been written in the current test case, only a
+ * reference to the earlier image is written and compression is skipped.
+ *
  * \param log				qpTestLog instance
  * \param name				Unique name (matching names can be compared across BatchResults).
  * \param description		Textual description (shown in Candy).
@@ -841,11 +1120,14 @@ deBool qpTestLog_writeImage	(
 {
 	char			widthStr[32];
 	char			heightStr[32];
+	char			hashStr[41];
 	qpXmlAttribute	attribs[8];
 	int				numAttribs			= 0;
 	Buffer			compressedBuffer;
 	const void*		writeDataPtr		= DE_NULL;
 	size_t			writeDataBytes		= ~(size_t)0;
+	deSha1			hash;
+	deBool			isDuplicate;
 
 	DE_ASSERT(log && name);
 	DE_ASSERT(deInRange32(width, 1, 16384));
@@ -855,6 +1137,40 @@ deBool qpTestLog_writeImage	(
 	if (log->flags & QP_TEST_LOG_EXCLUDE_IMAGES)
 		return DE_TRUE; /* Image not logged. */
 
+	computeImageHash(&hash, imageFormat, width, height, stride, data);
+	deSha1_render(&hash, hashStr);
+	hashStr[40] = 0;
+
+	int32ToString(width, widthStr);
+	int32ToString(height, heightStr);
+
+	deMutex_lock(log->lock);
+	isDuplicate = hasImageHash(log, &hash);
+
+	if (isDuplicate)
+	{
+		/* <Image Name="Foobar" Width="640" Height="480" Format="RGB888" Reference="<hash>"/> */
+		attribs[numAttribs++] = qpSetStringAttrib("Name", name);
+		attribs[numAttribs++] = qpSetStringAttrib("Width", widthStr);
+		attribs[numAttribs++] = qpSetStringAttrib("Height", heightStr);
+		attribs[numAttribs++] = qpSetStringAttrib("Format", QP_LOOKUP_STRING(s_qpImageFormatMap, imageFormat));
+		attribs[numAttribs++] = qpSetStringAttrib("Reference", hashStr);
+		if (description) attribs[numAttribs++] = qpSetStringAttrib("Description", description);
+
+		if (!qpXmlWriter_startElement(log->writer, "Image", numAttribs, attribs) ||
+			!qpXmlWriter_endElement(log->writer, "Image"))
+		{
+			qpPrintf("qpTestLog_writeImage(): Writing XML failed\n");
+			deMutex_unlock(log->lock);
+			return DE_FALSE;
+		}
+
+		deMutex_unlock(log->lock);
+		return DE_TRUE;
+	}
+
+	deMutex_unlock(log->lock);
+
 	Buffer_init(&compressedBuffer);
 
 	/* BEST compression mode defaults to PNG. */
@@ -904,6 +1220,7 @@ deBool qpTestLog_writeImage	(
 					int row;
 					for (row = 0; row < height; row++)
 						memcpy(&compressedBuffer.data[packedStride*row], &((const deUint8*)data)[row*stride], (size_t)(pixelSize*width));
+					writeDataPtr = compressedBuffer.data;
 				}
 				else
 				{
@@ -930,19 +1247,22 @@ deBool qpTestLog_writeImage	(
 	}
 
 	/* Fill in attributes. */
-	int32ToString(width, widthStr);
-	int32ToString(height, heightStr);
 	attribs[numAttribs++] = qpSetStringAttrib("Name", name);
 	attribs[numAttribs++] = qpSetStringAttrib("Width", widthStr);
 	attribs[numAttribs++] = qpSetStringAttrib("Height", heightStr);
 	attribs[numAttribs++] = qpSetStringAttrib("Format", QP_LOOKUP_STRING(s_qpImageFormatMap, imageFormat));
 	attribs[numAttribs++] = qpSetStringAttrib("CompressionMode", QP_LOOKUP_STRING(s_qpImageCompressionModeMap, compressionMode));
+	attribs[numAttribs++] = qpSetStringAttrib("Hash", hashStr);
 	if (description) attribs[numAttribs++] = qpSetStringAttrib("Description", description);
 
 	/* \note Log lock is acquired after compression! */
 	deMutex_lock(log->lock);
 
-	/* <Image ID="result" Name="Foobar" Width="640" Height="480" Format="RGB888" CompressionMode="None">base64 data</Image> */
+	/* \note Identical image may have been written by another thread meanwhile, in which case hash is already known. */
+	if (!hasImageHash(log, &hash) && !addImageHash(log, &hash))
+		qpPrintf("WARNING: Failed to store image hash -- image will not be deduplicated.\n");
+
+	/* <Image ID="result" Name="Foobar" Width="640" Height="480" Format="RGB888" CompressionMode="None" Hash="<hash>">base64 data</Image> */
 	if (!qpXmlWriter_startElement(log->writer, "Image", numAttribs, attribs) ||
 		!qpXmlWriter_writeBase64(log->writer, (const deUint8*)writeDataPtr, writeDataBytes) ||
 		!qpXmlWriter_endElement(log->writer, "Image"))
@@ -188,8 +188,12 @@ typedef struct qpEglConfigInfo_s
 
 
 qpTestLog*		qpTestLog_createFileLog			(const char* fileName, deUint32 flags);
+qpTestLog*		qpTestLog_createBufferLog		(const qpTestLog* log);
 void			qpTestLog_destroy				(qpTestLog* log);
 
+deBool			qpTestLog_appendBufferLog		(qpTestLog* log, qpTestLog* bufferLog);
+deBool			qpTestLog_appendInterruptedBufferLog	(qpTestLog* log, qpTestLog* bufferLog);
+
 deBool			qpTestLog_startCase				(qpTestLog* log, const char* testCasePath, qpTestCaseType testCaseType);
 deBool			qpTestLog_endCase				(qpTestLog* log, qpTestResult result, const char* description);
 deBool			qpTestLog_terminateCase			(qpTestLog* log, qpTestResult result);
@@ -24,6 +24,7 @@
 #include "qpWatchDog.h"
 
 #include "deThread.h"
+#include "deSemaphore.h"
 #include "deClock.h"
 #include "deMemory.h"
 
@@ -47,12 +48,16 @@ struct qpWatchDog_s
 {
 	qpWatchDogFunc		timeOutFunc;
 	void*				timeOutUserPtr;
-	int					totalTimeLimit;			/* Total test case time limit in seconds 	*/
-	int					intervalTimeLimit;		/* Iteration length limit in seconds 		*/
+	deUint64			defaultTotalTimeLimit;		/* Default total test case time limit in microseconds	*/
+	deUint64			defaultIntervalTimeLimit;	/* Default iteration length limit in microseconds		*/
+
+	volatile deUint64	totalTimeLimit;				/* Current total time limit in microseconds				*/
+	volatile deUint64	intervalTimeLimit;			/* Current iteration length limit in microseconds		*/
 
 	volatile deUint64	resetTime;
 	volatile deUint64	lastTouchTime;
 
+	deSemaphore			wakeUpSignal;				/* Signaled when limits are lowered or thread must stop	*/
 	deThread			watchDogThread;
 	volatile Status		status;
 };
@@ -66,18 +71,23 @@ static void watchDogThreadFunc (void* arg)
 
 	while (dog->status == STATUS_THREAD_RUNNING)
 	{
-		deUint64	curTime					= deGetMicroseconds();
-		int			totalSecondsPassed		= (int)((curTime - dog->resetTime) / 1000000ull);
-		int			secondsSinceLastTouch	= (int)((curTime - dog->lastTouchTime) / 1000000ull);
+		const deUint64	curTime				= deGetMicroseconds();
+		const deUint64	totalDeadline		= dog->resetTime + dog->totalTimeLimit;
+		const deUint64	intervalDeadline	= dog->lastTouchTime + dog->intervalTimeLimit;
+		const deUint64	deadline			= totalDeadline < intervalDeadline ? totalDeadline : intervalDeadline;
 
-		if ((secondsSinceLastTouch > dog->intervalTimeLimit) || (totalSecondsPassed > dog->totalTimeLimit))
+		if (curTime > deadline)
 		{
 			DBGPRINT(("watchDogThreadFunc(): call timeout func\n"));
 			dog->timeOutFunc(dog, dog->timeOutUserPtr);
 			break;
 		}
 
-		deSleep(100);
+		/* Sleep until the nearest deadline. Touching only moves the interval
+		 * deadline forward and thus doesn't need to wake the thread; the
+		 * deadlines are simply re-evaluated once the wait expires. Resetting
+		 * and overriding limits may bring deadlines closer and wake the thread. */
+		deSemaphore_timedDecrement(dog->wakeUpSignal, (deUint32)((deadline - curTime) / 1000ull) + 1u);
 	}
 
 	DBGPRINT(("watchDogThreadFunc(): stop\n"));
@@ -95,12 +105,19 @@ qpWatchDog* qpWatchDog_create (qpWatchDogFunc timeOutFunc, void* userPtr, int to
 
 	DBGPRINT(("qpWatchDog::create(%ds, %ds)\n", totalTimeLimitSecs, intervalTimeLimitSecs));
 
-	dog->timeOutFunc		= timeOutFunc;
-	dog->timeOutUserPtr		= userPtr;
-	dog->totalTimeLimit		= totalTimeLimitSecs;
-	dog->intervalTimeLimit	= intervalTimeLimitSecs;
+	dog->timeOutFunc				= timeOutFunc;
+	dog->timeOutUserPtr				= userPtr;
+	dog->defaultTotalTimeLimit		= (deUint64)totalTimeLimitSecs * 1000000ull;
+	dog->defaultIntervalTimeLimit	= (deUint64)intervalTimeLimitSecs * 1000000ull;
+
+	dog->wakeUpSignal = deSemaphore_create(0, DE_NULL);
+	if (!dog->wakeUpSignal)
+	{
+		deFree(dog);
+		return DE_NULL;
+	}
 
-	/* Reset (sets time values). */
+	/* Reset (sets time values and limits). */
 	qpWatchDog_reset(dog);
 
 	/* Initialize watchdog thread. */
@@ -108,6 +125,7 @@ qpWatchDog* qpWatchDog_create (qpWatchDogFunc timeOutFunc, void* userPtr, int to
 	dog->watchDogThread = deThread_create(watchDogThreadFunc, dog, DE_NULL);
 	if (!dog->watchDogThread)
 	{
+		deSemaphore_destroy(dog->wakeUpSignal);
 		deFree(dog);
 		return DE_NULL;
 	}
@@ -124,6 +142,36 @@ void qpWatchDog_reset (qpWatchDog* dog)
 
 	dog->resetTime			= curTime;
 	dog->lastTouchTime		= curTime;
+	dog->totalTimeLimit		= dog->defaultTotalTimeLimit;
+	dog->intervalTimeLimit	= dog->defaultIntervalTimeLimit;
+
+	/* Previous case may have had longer limits; wake the thread to recompute its deadline. */
+	deSemaphore_increment(dog->wakeUpSignal);
+}
+
+void qpWatchDog_setCaseTimeLimits (qpWatchDog* dog, int totalTimeLimitMs, int intervalTimeLimitMs)
+{
+	DE_ASSERT(dog);
+	DE_ASSERT((totalTimeLimitMs >= 0) && (intervalTimeLimitMs >= 0));
+	DBGPRINT(("qpWatchDog::setCaseTimeLimits(%dms, %dms)\n", totalTimeLimitMs, intervalTimeLimitMs));
+
+	dog->totalTimeLimit		= totalTimeLimitMs > 0		? (deUint64)totalTimeLimitMs * 1000ull		: dog->defaultTotalTimeLimit;
+	dog->intervalTimeLimit	= intervalTimeLimitMs > 0	? (deUint64)intervalTimeLimitMs * 1000ull	: dog->defaultIntervalTimeLimit;
+
+	/* Limits may have been lowered; wake the thread to recompute its deadline. */
+	deSemaphore_increment(dog->wakeUpSignal);
+}
+
+int qpWatchDog_getDefaultTotalTimeLimit (const qpWatchDog* dog)
+{
+	DE_ASSERT(dog);
+	return (int)(dog->defaultTotalTimeLimit / 1000ull);
+}
+
+int qpWatchDog_getDefaultIntervalTimeLimit (const qpWatchDog* dog)
+{
+	DE_ASSERT(dog);
+	return (int)(dog->defaultIntervalTimeLimit / 1000ull);
 }
 
 void qpWatchDog_destroy (qpWatchDog* dog)
@@ -133,8 +181,10 @@ void qpWatchDog_destroy (qpWatchDog* dog)
 
 	/* Finish the watchdog thread. */
 	dog->status = STATUS_STOP_THREAD;
+	deSemaphore_increment(dog->wakeUpSignal);
 	deThread_join(dog->watchDogThread);
 	deThread_destroy(dog->watchDogThread);
+	deSemaphore_destroy(dog->wakeUpSignal);
 
 	DBGPRINT(("qpWatchDog::destroy() finished\n"));
 	deFree(dog);
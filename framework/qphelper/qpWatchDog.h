@@ -36,6 +36,13 @@ void			qpWatchDog_destroy		(qpWatchDog* dog);
 void			qpWatchDog_reset		(qpWatchDog* dog);
 void			qpWatchDog_touch		(qpWatchDog* dog);
 
+/* Override time limits until next reset. Limits are in milliseconds, 0 keeps the default limit. */
+void			qpWatchDog_setCaseTimeLimits	(qpWatchDog* dog, int totalTimeLimitMs, int intervalTimeLimitMs);
+
+/* Default limits given to qpWatchDog_create(), in milliseconds. */
+int				qpWatchDog_getDefaultTotalTimeLimit		(const qpWatchDog* dog);
+int				qpWatchDog_getDefaultIntervalTimeLimit	(const qpWatchDog* dog);
+
 DE_END_EXTERN_C
 
 #endif /* _QPWATCHDOG_H */
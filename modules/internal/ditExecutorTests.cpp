@@ -0,0 +1,45 @@
+/*-------------------------------------------------------------------------
+ * drawElements Internal Test Module
+ * ---------------------------------
+ *
+ * Copyright 2014 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Test executor tests.
+ *//*--------------------------------------------------------------------*/
+
+#include "ditExecutorTests.hpp"
+#include "ditTestCase.hpp"
+
+#include "xeTestLogIndex.hpp"
+#include "xeTestResultParser.hpp"
+
+#include "deUniquePtr.hpp"
+
+namespace dit
+{
+
+tcu::TestCaseGroup* createExecutorTests (tcu::TestContext& testCtx)
+{
+	de::MovePtr<tcu::TestCaseGroup>	group	(new tcu::TestCaseGroup(testCtx, "executor", "Test Executor Tests"));
+
+	group->addChild(new SelfCheckCase(testCtx, "test_log_index", "xe::TestLogIndex_selfTest()", xe::TestLogIndex_selfTest));
+	group->addChild(new SelfCheckCase(testCtx, "test_result_parser", "xe::TestResultParser_selfTest()", xe::TestResultParser_selfTest));
+
+	return group.release();
+}
+
+} // dit
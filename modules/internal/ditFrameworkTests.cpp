@@ -25,11 +25,17 @@
 #include "ditTextureFormatTests.hpp"
 #include "ditAstcTests.hpp"
 #include "ditVulkanTests.hpp"
+#include "ditExecutorTests.hpp"
 
 #include "tcuFloatFormat.hpp"
 #include "tcuEither.hpp"
 #include "tcuTestLog.hpp"
 #include "tcuCommandLine.hpp"
+#include "tcuCallTrace.hpp"
+#include "tcuPackedArchive.hpp"
+#include "tcuTestHierarchyCache.hpp"
+#include "tcuTestHierarchyIterator.hpp"
+#include "tcuTestPackage.hpp"
 
 #include "rrRenderer.hpp"
 #include "tcuTextureUtil.hpp"
@@ -38,6 +44,11 @@
 
 #include "deRandom.hpp"
 #include "deArrayUtil.hpp"
+#include "deUniquePtr.hpp"
+#include "deFile.h"
+#include "deThread.h"
+
+#include "qpWatchDog.h"
 
 namespace dit
 {
@@ -866,6 +877,194 @@ protected:
 	vector<SubCase>::const_iterator	m_caseIter;
 };
 
+class HierarchyCacheDummyCase : public tcu::TestCase
+{
+public:
+	HierarchyCacheDummyCase (tcu::TestContext& testCtx, const char* name, const char* description)
+		: tcu::TestCase(testCtx, name, description)
+	{
+	}
+
+	IterateResult iterate (void)
+	{
+		m_testCtx.setTestResult(QP_TEST_RESULT_PASS, "Pass");
+		return STOP;
+	}
+};
+
+class HierarchyCacheDummyPackage : public tcu::TestPackage
+{
+public:
+	HierarchyCacheDummyPackage (tcu::TestContext& testCtx, int* numInits)
+		: tcu::TestPackage	(testCtx, "package", "Package with \"quoted\" description")
+		, m_numInits		(numInits)
+	{
+	}
+
+	void init (void)
+	{
+		tcu::TestCaseGroup* const	groupA	= new tcu::TestCaseGroup(m_testCtx, "group_a", "Multi-line\ndescription with \\ backslash");
+		tcu::TestCaseGroup* const	groupB	= new tcu::TestCaseGroup(m_testCtx, "group_b", "");
+
+		groupA->addChild(new HierarchyCacheDummyCase(m_testCtx, "case_a", "Case A"));
+		groupA->addChild(new HierarchyCacheDummyCase(m_testCtx, "case_b", ""));
+		groupB->addChild(new HierarchyCacheDummyCase(m_testCtx, "case_c", "Case C"));
+
+		addChild(groupA);
+		addChild(groupB);
+
+		*m_numInits += 1;
+	}
+
+	tcu::TestCaseExecutor* createExecutor (void) const
+	{
+		return DE_NULL;
+	}
+
+private:
+	int* const	m_numInits;
+};
+
+class TestHierarchyCacheCase : public tcu::TestCase
+{
+public:
+	TestHierarchyCacheCase (tcu::TestContext& testCtx)
+		: tcu::TestCase(testCtx, "test_hierarchy_cache", "Test hierarchy cache round-trip")
+	{
+	}
+
+	IterateResult iterate (void)
+	{
+		const string						cacheFilename	= "dit-test-hierarchy-cache.txt";
+		const string						cacheArg		= string("--deqp-caselist-cache=") + cacheFilename;
+		int									numInits		= 0;
+		vector<tcu::TestNode*>				packages;
+
+		packages.push_back(new HierarchyCacheDummyPackage(m_testCtx, &numInits));
+
+		{
+			tcu::TestPackageRoot	liveRoot	(m_testCtx, packages);
+			const tcu::CommandLine	cmdLine		("deqp " + cacheArg + " --deqp-surface-width=64");
+			const tcu::CommandLine	otherLog	("deqp " + cacheArg + " --deqp-surface-width=64 --deqp-log-filename=other.qpa");
+			const tcu::CommandLine	otherWidth	("deqp " + cacheArg + " --deqp-surface-width=128");
+
+			deDeleteFile(cacheFilename.c_str());
+
+			// First use writes the cache
+			checkRoundTrip(liveRoot, cmdLine, numInits, true);
+
+			// Same build & options are served from cache
+			checkRoundTrip(liveRoot, cmdLine, numInits, false);
+			checkRoundTrip(liveRoot, otherLog, numInits, false);
+
+			// Options that may affect hierarchy invalidate cache
+			checkRoundTrip(liveRoot, otherWidth, numInits, true);
+
+			deDeleteFile(cacheFilename.c_str());
+		}
+
+		m_testCtx.setTestResult(QP_TEST_RESULT_PASS, "Pass");
+		return STOP;
+	}
+
+private:
+	void checkRoundTrip (tcu::TestPackageRoot& liveRoot, const tcu::CommandLine& cmdLine, const int& numInits, bool expectRebuild)
+	{
+		const int									numInitsBefore	= numInits;
+		const de::UniquePtr<tcu::TestPackageRoot>	cachedRoot		(tcu::createCachedTestHierarchy(liveRoot, m_testCtx, cmdLine));
+		const tcu::CommandLine						allCases		("deqp");
+
+		// \note Build id can't be determined only if binary doesn't carry one and binary path is missing
+		TCU_CHECK(cachedRoot);
+		TCU_CHECK((numInits != numInitsBefore) == expectRebuild);
+
+		{
+			tcu::DefaultHierarchyInflater	inflater	(m_testCtx);
+			tcu::TestHierarchyIterator		liveIter	(liveRoot, inflater, allCases);
+			tcu::TestHierarchyIterator		cachedIter	(*cachedRoot, inflater, allCases);
+
+			for (;;)
+			{
+				TCU_CHECK(liveIter.getState() == cachedIter.getState());
+
+				if (liveIter.getState() == tcu::TestHierarchyIterator::STATE_FINISHED)
+					break;
+
+				if (liveIter.getState() == tcu::TestHierarchyIterator::STATE_ENTER_NODE)
+				{
+					const tcu::TestNode* const	liveNode	= liveIter.getNode();
+					const tcu::TestNode* const	cachedNode	= cachedIter.getNode();
+
+					m_testCtx.getLog() << TestLog::Message << liveIter.getNodePath() << TestLog::EndMessage;
+
+					TCU_CHECK(liveIter.getNodePath() == cachedIter.getNodePath());
+					TCU_CHECK(liveNode->getNodeType() == cachedNode->getNodeType());
+					TCU_CHECK(string(liveNode->getDescription()) == cachedNode->getDescription());
+				}
+
+				liveIter.next();
+				cachedIter.next();
+			}
+		}
+	}
+};
+
+class WatchDogCase : public tcu::TestCase
+{
+public:
+	WatchDogCase (tcu::TestContext& testCtx)
+		: tcu::TestCase(testCtx, "watchdog", "Watchdog limits are restored between cases")
+	{
+	}
+
+	IterateResult iterate (void)
+	{
+		// Over-limit case after a case with long limits must time out with default limits.
+		{
+			volatile deBool	timedOut		= DE_FALSE;
+			deBool			timedOutEarly	= DE_FALSE;
+			qpWatchDog*		dog				= qpWatchDog_create(onTimeout, (void*)&timedOut, 1, 1);
+
+			TCU_CHECK_INTERNAL(dog);
+
+			qpWatchDog_setCaseTimeLimits(dog, 60000, 60000);
+			deSleep(200);
+			timedOutEarly = timedOut;
+
+			qpWatchDog_reset(dog);
+			deSleep(1500);
+
+			qpWatchDog_destroy(dog);
+			TCU_CHECK_MSG(!timedOutEarly, "Case with long limits timed out");
+			TCU_CHECK_MSG(timedOut, "Case exceeding default limits after a case with long limits didn't time out");
+		}
+
+		// Case with long total limit must still time out if it stops making progress.
+		{
+			volatile deBool	timedOut	= DE_FALSE;
+			qpWatchDog*		dog			= qpWatchDog_create(onTimeout, (void*)&timedOut, 300, 300);
+
+			TCU_CHECK_INTERNAL(dog);
+
+			qpWatchDog_setCaseTimeLimits(dog, 60000, 200);
+			deSleep(700);
+
+			qpWatchDog_destroy(dog);
+			TCU_CHECK_MSG(timedOut, "Interval limit was not applied");
+		}
+
+		m_testCtx.setTestResult(QP_TEST_RESULT_PASS, "Pass");
+		return STOP;
+	}
+
+private:
+	static void onTimeout (qpWatchDog* dog, void* userPtr)
+	{
+		DE_UNREF(dog);
+		*(volatile deBool*)userPtr = DE_TRUE;
+	}
+};
+
 class CommonFrameworkTests : public tcu::TestCaseGroup
 {
 public:
@@ -880,6 +1079,12 @@ public:
 								   tcu::FloatFormat_selfTest));
 		addChild(new SelfCheckCase(m_testCtx, "either","tcu::Either_selfTest()",
 								   tcu::Either_selfTest));
+		addChild(new SelfCheckCase(m_testCtx, "call_trace","tcu::CallTraceBuffer_selfTest()",
+								   tcu::CallTraceBuffer_selfTest));
+		addChild(new SelfCheckCase(m_testCtx, "packed_archive","tcu::PackedArchive_selfTest()",
+								   tcu::PackedArchive_selfTest));
+		addChild(new TestHierarchyCacheCase(m_testCtx));
+		addChild(new WatchDogCase(m_testCtx));
 	}
 };
 
@@ -916,6 +1121,7 @@ void FrameworkTests::init (void)
 	addChild(createTextureFormatTests	(m_testCtx));
 	addChild(createAstcTests			(m_testCtx));
 	addChild(createVulkanTests			(m_testCtx));
+	addChild(createExecutorTests		(m_testCtx));
 }
 
 } // dit
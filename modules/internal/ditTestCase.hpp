@@ -34,9 +34,10 @@ class SelfCheckCase : public tcu::TestCase
 public:
 	typedef void (*Function) (void);
 
-	SelfCheckCase (tcu::TestContext& testCtx, const char* name, const char* desc, Function func)
+	SelfCheckCase (tcu::TestContext& testCtx, const char* name, const char* desc, Function func, bool threadSafe = false)
 		: tcu::TestCase	(testCtx, name, desc)
 		, m_function	(func)
+		, m_threadSafe	(threadSafe)
 	{
 	}
 
@@ -47,8 +48,15 @@ public:
 		return STOP;
 	}
 
+	//! Self-tests that create no threads, measure no time and use no global state can run concurrently.
+	bool isThreadSafe (void) const
+	{
+		return m_threadSafe;
+	}
+
 private:
-	Function m_function;
+	Function	m_function;
+	bool		m_threadSafe;
 };
 
 } // dit
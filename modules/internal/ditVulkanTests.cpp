@@ -24,19 +24,752 @@
 #include "ditVulkanTests.hpp"
 #include "ditTestCase.hpp"
 
+#include "vkAllocationCallbackUtil.hpp"
+#include "vkCallStatsWrapper.hpp"
 #include "vkImageUtil.hpp"
+#include "vkMemUtil.hpp"
+#include "vkNullDriver.hpp"
+#include "vkPlatform.hpp"
+#include "vkDeviceUtil.hpp"
+#include "vkQueryUtil.hpp"
+#include "vkRefUtil.hpp"
 
 #include "deUniquePtr.hpp"
+#include "deSharedPtr.hpp"
+#include "deMemory.h"
+#include "deString.h"
+
+#include <vector>
 
 namespace dit
 {
 
+namespace
+{
+
+using namespace vk;
+using std::vector;
+using de::MovePtr;
+using de::SharedPtr;
+
+//! Device of the null driver. Null driver memory is plain host memory.
+class NullDevice
+{
+public:
+								NullDevice				(void);
+
+	const InstanceInterface&	getInstanceInterface	(void) const	{ return m_instanceInterface;	}
+	VkPhysicalDevice			getPhysicalDevice		(void) const	{ return m_physicalDevice;		}
+	const DeviceInterface&		getDeviceInterface		(void) const	{ return m_deviceInterface;	}
+	VkDevice					getDevice				(void) const	{ return *m_device;			}
+	VkQueue						getQueue				(void) const;
+
+private:
+	static Move<VkDevice>		createNullDevice		(const InstanceInterface& vki, VkPhysicalDevice physicalDevice);
+
+	const de::UniquePtr<Library>	m_library;
+	const Unique<VkInstance>		m_instance;
+	const InstanceDriver			m_instanceInterface;
+	const VkPhysicalDevice			m_physicalDevice;
+	const Unique<VkDevice>			m_device;
+	const DeviceDriver				m_deviceInterface;
+};
+
+NullDevice::NullDevice (void)
+	: m_library				(createNullDriver())
+	, m_instance			(createDefaultInstance(m_library->getPlatformInterface()))
+	, m_instanceInterface	(m_library->getPlatformInterface(), *m_instance)
+	, m_physicalDevice		(enumeratePhysicalDevices(m_instanceInterface, *m_instance).at(0))
+	, m_device				(createNullDevice(m_instanceInterface, m_physicalDevice))
+	, m_deviceInterface		(m_instanceInterface, *m_device)
+{
+}
+
+Move<VkDevice> NullDevice::createNullDevice (const InstanceInterface& vki, VkPhysicalDevice physicalDevice)
+{
+	VkDeviceQueueCreateInfo		queueInfo;
+	VkDeviceCreateInfo			deviceInfo;
+	const float					queuePriority	= 1.0f;
+
+	deMemset(&queueInfo,	0, sizeof(queueInfo));
+	deMemset(&deviceInfo,	0, sizeof(deviceInfo));
+
+	queueInfo.sType							= VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+	queueInfo.queueFamilyIndex				= 0u;
+	queueInfo.queueCount					= 1u;
+	queueInfo.pQueuePriorities				= &queuePriority;
+
+	deviceInfo.sType						= VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+	deviceInfo.queueCreateInfoCount			= 1u;
+	deviceInfo.pQueueCreateInfos			= &queueInfo;
+
+	return createDevice(vki, physicalDevice, &deviceInfo);
+}
+
+VkQueue NullDevice::getQueue (void) const
+{
+	VkQueue queue = DE_NULL;
+
+	m_deviceInterface.getDeviceQueue(*m_device, 0u, 0u, &queue);
+
+	return queue;
+}
+
+// PoolAllocator tests
+
+enum
+{
+	POOL_BLOCK_SIZE			= 64*1024,
+	POOL_GRANULARITY		= 1024,		//!< bufferImageGranularity
+	POOL_ATOM_SIZE			= 4096		//!< nonCoherentAtomSize
+};
+
+enum PoolMemoryType
+{
+	POOL_MEMORY_DEVICE_LOCAL = 0,
+	POOL_MEMORY_HOST_NON_COHERENT,
+	POOL_MEMORY_LAZY,
+
+	POOL_MEMORY_LAST
+};
+
+class PoolAllocatorEnv
+{
+public:
+								PoolAllocatorEnv	(void);
+
+	PoolAllocator&				getAllocator		(void) { return m_allocator; }
+	MovePtr<Allocation>			allocate			(PoolMemoryType type, VkDeviceSize size, VkDeviceSize alignment);
+
+private:
+	static VkPhysicalDeviceMemoryProperties	getMemoryProperties	(void);
+	static VkPhysicalDeviceLimits			getLimits			(void);
+
+	const NullDevice			m_device;
+	PoolAllocator				m_allocator;
+};
+
+PoolAllocatorEnv::PoolAllocatorEnv (void)
+	: m_allocator	(m_device.getDeviceInterface(), m_device.getDevice(), getMemoryProperties(), getLimits(), (VkDeviceSize)POOL_BLOCK_SIZE)
+{
+}
+
+VkPhysicalDeviceMemoryProperties PoolAllocatorEnv::getMemoryProperties (void)
+{
+	VkPhysicalDeviceMemoryProperties props;
+
+	deMemset(&props, 0, sizeof(props));
+
+	props.memoryHeapCount		= 1u;
+	props.memoryHeaps[0].size	= 1ull << 30;
+	props.memoryTypeCount		= POOL_MEMORY_LAST;
+
+	props.memoryTypes[POOL_MEMORY_DEVICE_LOCAL].propertyFlags		= VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+	props.memoryTypes[POOL_MEMORY_HOST_NON_COHERENT].propertyFlags	= VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+	props.memoryTypes[POOL_MEMORY_LAZY].propertyFlags				= VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT|VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT;
+
+	return props;
+}
+
+VkPhysicalDeviceLimits PoolAllocatorEnv::getLimits (void)
+{
+	VkPhysicalDeviceLimits limits;
+
+	deMemset(&limits, 0, sizeof(limits));
+
+	limits.bufferImageGranularity	= POOL_GRANULARITY;
+	limits.nonCoherentAtomSize		= POOL_ATOM_SIZE;
+
+	return limits;
+}
+
+MovePtr<Allocation> PoolAllocatorEnv::allocate (PoolMemoryType type, VkDeviceSize size, VkDeviceSize alignment)
+{
+	const VkMemoryAllocateInfo	allocInfo	=
+	{
+		VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,	//	VkStructureType			sType;
+		DE_NULL,								//	const void*				pNext;
+		size,									//	VkDeviceSize			allocationSize;
+		(deUint32)type,							//	deUint32				memoryTypeIndex;
+	};
+
+	return m_allocator.allocate(allocInfo, alignment);
+}
+
+//! Check that no two allocations from same VkDeviceMemory touch the same page of pageSize bytes
+void checkNoSharedPages (const vector<SharedPtr<Allocation> >& allocs, const vector<VkDeviceSize>& sizes, VkDeviceSize pageSize)
+{
+	for (size_t aNdx = 0; aNdx < allocs.size(); aNdx++)
+	for (size_t bNdx = aNdx+1; bNdx < allocs.size(); bNdx++)
+	{
+		const Allocation&	a	= *allocs[aNdx];
+		const Allocation&	b	= *allocs[bNdx];
+
+		if (a.getMemory() == b.getMemory())
+		{
+			const VkDeviceSize	aFirst	= a.getOffset() / pageSize;
+			const VkDeviceSize	aLast	= (a.getOffset() + sizes[aNdx] - 1u) / pageSize;
+			const VkDeviceSize	bFirst	= b.getOffset() / pageSize;
+			const VkDeviceSize	bLast	= (b.getOffset() + sizes[bNdx] - 1u) / pageSize;
+
+			TCU_CHECK(aLast < bFirst || bLast < aFirst);
+		}
+	}
+}
+
+void poolAllocatorAlignmentTest (void)
+{
+	static const VkDeviceSize		s_sizes[]		= { 1u, 100u, 1000u, 3000u };
+	static const VkDeviceSize		s_alignments[]	= { 1u, 4u, 256u, 512u, 2048u, 8192u };
+
+	PoolAllocatorEnv				env;
+	vector<SharedPtr<Allocation> >	allocs;
+	vector<VkDeviceSize>			sizes;
+	VkDeviceSize					totalSize		= 0u;
+
+	for (int sizeNdx = 0; sizeNdx < DE_LENGTH_OF_ARRAY(s_sizes); sizeNdx++)
+	for (int alignNdx = 0; alignNdx < DE_LENGTH_OF_ARRAY(s_alignments); alignNdx++)
+	{
+		allocs.push_back(SharedPtr<Allocation>(env.allocate(POOL_MEMORY_DEVICE_LOCAL, s_sizes[sizeNdx], s_alignments[alignNdx]).release()));
+		sizes.push_back(s_sizes[sizeNdx]);
+		totalSize += s_sizes[sizeNdx];
+
+		TCU_CHECK(allocs.back()->getOffset() % s_alignments[alignNdx] == 0u);
+	}
+
+	checkNoSharedPages(allocs, sizes, (VkDeviceSize)POOL_GRANULARITY);
+
+	{
+		const PoolAllocator::Stats	stats	= env.getAllocator().getStats();
+
+		TCU_CHECK(stats.numSubAllocations == (deUint32)allocs.size());
+		TCU_CHECK(stats.numDedicatedAllocations == 0u);
+		TCU_CHECK(stats.requestedBytes == totalSize);
+		TCU_CHECK(stats.usedBytes >= totalSize);
+	}
+}
+
+void poolAllocatorGranularityTest (void)
+{
+	const int		numAllocs		= 8;
+	const int		allocSize		= 16;
+
+	PoolAllocatorEnv	env;
+
+	// Small allocations must not share a bufferImageGranularity page
+	{
+		vector<SharedPtr<Allocation> >	allocs;
+		vector<VkDeviceSize>			sizes	(numAllocs, (VkDeviceSize)allocSize);
+
+		for (int allocNdx = 0; allocNdx < numAllocs; allocNdx++)
+			allocs.push_back(SharedPtr<Allocation>(env.allocate(POOL_MEMORY_DEVICE_LOCAL, allocSize, 1u).release()));
+
+		checkNoSharedPages(allocs, sizes, (VkDeviceSize)POOL_GRANULARITY);
+	}
+
+	// Allocations from non-coherent memory must not share a nonCoherentAtomSize range
+	{
+		vector<SharedPtr<Allocation> >	allocs;
+		vector<VkDeviceSize>			sizes	(numAllocs, (VkDeviceSize)allocSize);
+
+		for (int allocNdx = 0; allocNdx < numAllocs; allocNdx++)
+			allocs.push_back(SharedPtr<Allocation>(env.allocate(POOL_MEMORY_HOST_NON_COHERENT, allocSize, 1u).release()));
+
+		checkNoSharedPages(allocs, sizes, (VkDeviceSize)POOL_ATOM_SIZE);
+
+		// Host pointers point to allocation offset in persistently mapped block
+		for (int allocNdx = 0; allocNdx < numAllocs; allocNdx++)
+		{
+			const Allocation&	first	= *allocs[0];
+			const Allocation&	alloc	= *allocs[allocNdx];
+
+			TCU_CHECK(alloc.getMemory() == first.getMemory());
+			TCU_CHECK((deUint8*)alloc.getHostPtr() - (deUint8*)first.getHostPtr() == (deIntptr)(alloc.getOffset() - first.getOffset()));
+
+			deMemset(alloc.getHostPtr(), allocNdx, allocSize);
+		}
+	}
+}
+
+void poolAllocatorBuddyMergeTest (void)
+{
+	const int							numNodes	= POOL_BLOCK_SIZE / POOL_GRANULARITY;
+	PoolAllocatorEnv					env;
+	vector<SharedPtr<Allocation> >		allocs;
+
+	// Fill single block with minimum-sized nodes
+	for (int nodeNdx = 0; nodeNdx < numNodes; nodeNdx++)
+		allocs.push_back(SharedPtr<Allocation>(env.allocate(POOL_MEMORY_DEVICE_LOCAL, 1u, 1u).release()));
+
+	{
+		const PoolAllocator::Stats	stats	= env.getAllocator().getStats();
+
+		TCU_CHECK(stats.numBlocks == 1u);
+		TCU_CHECK(stats.usedBytes == (VkDeviceSize)POOL_BLOCK_SIZE);
+		TCU_CHECK(stats.largestFreeRange == 0u);
+	}
+
+	// Freeing every other node leaves nothing to merge
+	for (int nodeNdx = 1; nodeNdx < numNodes; nodeNdx += 2)
+		allocs[nodeNdx].clear();
+
+	TCU_CHECK(env.getAllocator().getStats().largestFreeRange == (VkDeviceSize)POOL_GRANULARITY);
+
+	// Freeing the rest merges buddies back to a single free block
+	for (int nodeNdx = 0; nodeNdx < numNodes; nodeNdx += 2)
+		allocs[nodeNdx].clear();
+
+	{
+		const PoolAllocator::Stats	stats	= env.getAllocator().getStats();
+
+		TCU_CHECK(stats.numBlocks == 1u);
+		TCU_CHECK(stats.usedBytes == 0u);
+		TCU_CHECK(stats.largestFreeRange == (VkDeviceSize)POOL_BLOCK_SIZE);
+	}
+
+	// Empty block is kept and can hold a block-sized allocation
+	{
+		const MovePtr<Allocation>	whole	= env.allocate(POOL_MEMORY_DEVICE_LOCAL, POOL_BLOCK_SIZE, 1u);
+		const PoolAllocator::Stats	stats	= env.getAllocator().getStats();
+
+		TCU_CHECK(whole->getOffset() == 0u);
+		TCU_CHECK(stats.numBlocks == 1u);
+		TCU_CHECK(stats.numSubAllocations == 1u);
+		TCU_CHECK(stats.numDedicatedAllocations == 0u);
+
+		// Additional block is released once it becomes empty
+		{
+			const MovePtr<Allocation>	extra	= env.allocate(POOL_MEMORY_DEVICE_LOCAL, 1u, 1u);
+
+			TCU_CHECK(extra->getMemory() != whole->getMemory());
+			TCU_CHECK(env.getAllocator().getStats().numBlocks == 2u);
+		}
+
+		TCU_CHECK(env.getAllocator().getStats().numBlocks == 1u);
+	}
+}
+
+void poolAllocatorDedicatedTest (void)
+{
+	PoolAllocatorEnv	env;
+
+	// Larger than block
+	{
+		const MovePtr<Allocation>	alloc	= env.allocate(POOL_MEMORY_DEVICE_LOCAL, POOL_BLOCK_SIZE+1, 1u);
+		const PoolAllocator::Stats	stats	= env.getAllocator().getStats();
+
+		TCU_CHECK(alloc->getOffset() == 0u);
+		TCU_CHECK(stats.numDedicatedAllocations == 1u);
+		TCU_CHECK(stats.numSubAllocations == 0u);
+	}
+
+	// Alignment larger than block
+	{
+		const MovePtr<Allocation>	alloc	= env.allocate(POOL_MEMORY_DEVICE_LOCAL, 1u, 2*POOL_BLOCK_SIZE);
+
+		TCU_CHECK(alloc->getOffset() == 0u);
+		TCU_CHECK(env.getAllocator().getStats().numDedicatedAllocations == 1u);
+	}
+
+	// Lazily allocated memory is never pooled
+	{
+		const MovePtr<Allocation>	alloc	= env.allocate(POOL_MEMORY_LAZY, 1u, 1u);
+		const PoolAllocator::Stats	stats	= env.getAllocator().getStats();
+
+		TCU_CHECK(stats.numDedicatedAllocations == 1u);
+		TCU_CHECK(stats.numBlocks == 0u);
+	}
+
+	// Host-visible dedicated allocations are mapped
+	{
+		const MovePtr<Allocation>	alloc	= env.allocate(POOL_MEMORY_HOST_NON_COHERENT, POOL_BLOCK_SIZE+1, 1u);
+
+		TCU_CHECK(env.getAllocator().getStats().numDedicatedAllocations == 1u);
+		deMemset(alloc->getHostPtr(), 0, POOL_BLOCK_SIZE+1);
+	}
+
+	TCU_CHECK(env.getAllocator().getStats().numDedicatedAllocations == 0u);
+}
+
+// Null driver tests
+
+Move<VkBuffer> createTransferBuffer (const DeviceInterface& vkd, VkDevice device, VkDeviceSize size)
+{
+	const VkBufferCreateInfo	createInfo	=
+	{
+		VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+		DE_NULL,
+		(VkBufferCreateFlags)0u,
+		size,
+		VK_BUFFER_USAGE_TRANSFER_SRC_BIT|VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+		VK_SHARING_MODE_EXCLUSIVE,
+		0u,
+		DE_NULL,
+	};
+
+	return createBuffer(vkd, device, &createInfo);
+}
+
+Move<VkImage> createTransferImage (const DeviceInterface& vkd, VkDevice device, VkFormat format, deUint32 width, deUint32 height)
+{
+	const VkImageCreateInfo		createInfo	=
+	{
+		VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+		DE_NULL,
+		(VkImageCreateFlags)0u,
+		VK_IMAGE_TYPE_2D,
+		format,
+		{ width, height, 1u },
+		1u,
+		1u,
+		VK_SAMPLE_COUNT_1_BIT,
+		VK_IMAGE_TILING_LINEAR,
+		VK_IMAGE_USAGE_TRANSFER_SRC_BIT|VK_IMAGE_USAGE_TRANSFER_DST_BIT,
+		VK_SHARING_MODE_EXCLUSIVE,
+		0u,
+		DE_NULL,
+		VK_IMAGE_LAYOUT_UNDEFINED,
+	};
+
+	return createImage(vkd, device, &createInfo);
+}
+
+MovePtr<Allocation> bindBuffer (const DeviceInterface& vkd, VkDevice device, Allocator& allocator, VkBuffer buffer)
+{
+	MovePtr<Allocation> alloc = allocator.allocate(getBufferMemoryRequirements(vkd, device, buffer), MemoryRequirement::HostVisible);
+	VK_CHECK(vkd.bindBufferMemory(device, buffer, alloc->getMemory(), alloc->getOffset()));
+	return alloc;
+}
+
+MovePtr<Allocation> bindImage (const DeviceInterface& vkd, VkDevice device, Allocator& allocator, VkImage image)
+{
+	MovePtr<Allocation> alloc = allocator.allocate(getImageMemoryRequirements(vkd, device, image), MemoryRequirement::HostVisible);
+	VK_CHECK(vkd.bindImageMemory(device, image, alloc->getMemory(), alloc->getOffset()));
+	return alloc;
+}
+
+Move<VkCommandBuffer> beginTransferCommands (const DeviceInterface& vkd, VkDevice device, VkCommandPool cmdPool)
+{
+	const VkCommandBufferAllocateInfo	allocInfo	=
+	{
+		VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+		DE_NULL,
+		cmdPool,
+		VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+		1u,
+	};
+	const VkCommandBufferBeginInfo		beginInfo	=
+	{
+		VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+		DE_NULL,
+		VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+		DE_NULL,
+	};
+	Move<VkCommandBuffer>				cmdBuffer	= allocateCommandBuffer(vkd, device, &allocInfo);
+
+	VK_CHECK(vkd.beginCommandBuffer(*cmdBuffer, &beginInfo));
+
+	return cmdBuffer;
+}
+
+Move<VkCommandPool> createTransferCommandPool (const DeviceInterface& vkd, VkDevice device)
+{
+	const VkCommandPoolCreateInfo	createInfo	=
+	{
+		VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+		DE_NULL,
+		(VkCommandPoolCreateFlags)0u,
+		0u,
+	};
+
+	return createCommandPool(vkd, device, &createInfo);
+}
+
+void submitCommands (const DeviceInterface& vkd, VkQueue queue, VkCommandBuffer cmdBuffer)
+{
+	const VkSubmitInfo	submitInfo	=
+	{
+		VK_STRUCTURE_TYPE_SUBMIT_INFO,
+		DE_NULL,
+		0u,
+		DE_NULL,
+		DE_NULL,
+		1u,
+		&cmdBuffer,
+		0u,
+		DE_NULL,
+	};
+
+	VK_CHECK(vkd.queueSubmit(queue, 1u, &submitInfo, DE_NULL));
+}
+
+void nullDriverTransferTest (void)
+{
+	const int						size		= 4;
+	const int						numBytes	= size*size*4;
+	const NullDevice				device;
+	const DeviceInterface&			vkd			= device.getDeviceInterface();
+	const VkDevice					dev			= device.getDevice();
+	VkPhysicalDeviceMemoryProperties	memProps;
+
+	deMemset(&memProps, 0, sizeof(memProps));
+	memProps.memoryTypeCount				= 1u;
+	memProps.memoryTypes[0].propertyFlags	= VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT|VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+	memProps.memoryHeapCount				= 1u;
+	memProps.memoryHeaps[0].size			= 1ull << 30;
+
+	{
+		SimpleAllocator					allocator	(vkd, dev, memProps);
+		const Unique<VkBuffer>			srcBuffer	(createTransferBuffer(vkd, dev, numBytes));
+		const Unique<VkBuffer>			dstBuffer	(createTransferBuffer(vkd, dev, 2*numBytes));
+		const Unique<VkImage>			image		(createTransferImage(vkd, dev, VK_FORMAT_R8G8B8A8_UNORM, size, size));
+		const Unique<VkImage>			clearImage	(createTransferImage(vkd, dev, VK_FORMAT_R8G8B8A8_UINT, size, size));
+		const MovePtr<Allocation>		srcMem		(bindBuffer(vkd, dev, allocator, *srcBuffer));
+		const MovePtr<Allocation>		dstMem		(bindBuffer(vkd, dev, allocator, *dstBuffer));
+		const MovePtr<Allocation>		imageMem	(bindImage(vkd, dev, allocator, *image));
+		const MovePtr<Allocation>		clearMem	(bindImage(vkd, dev, allocator, *clearImage));
+		const Unique<VkCommandPool>		cmdPool		(createTransferCommandPool(vkd, dev));
+		const Unique<VkCommandBuffer>	cmdBuffer	(beginTransferCommands(vkd, dev, *cmdPool));
+		const deUint32					fillValue	= 0x04030201u;
+		const deUint8					update[]	= { 0xaa, 0xbb, 0xcc, 0xdd };
+		const VkImageSubresourceLayers	layers		= { VK_IMAGE_ASPECT_COLOR_BIT, 0u, 0u, 1u };
+		const VkImageSubresourceRange	range		= { VK_IMAGE_ASPECT_COLOR_BIT, 0u, 1u, 0u, 1u };
+		const VkBufferImageCopy			toImage		= { 0u, 0u, 0u, layers, { 0, 0, 0 }, { (deUint32)size, (deUint32)size, 1u } };
+		const VkBufferImageCopy			fromImage	= { (VkDeviceSize)numBytes, 0u, 0u, layers, { 0, 0, 0 }, { (deUint32)size, (deUint32)size, 1u } };
+		const VkBufferCopy				bufCopy		= { 0u, 0u, (VkDeviceSize)numBytes };
+		VkClearColorValue				clearValue;
+
+		deMemset(&clearValue, 0, sizeof(clearValue));
+		clearValue.uint32[0] = 7u;
+		clearValue.uint32[3] = 255u;
+
+		deMemset(dstMem->getHostPtr(), 0, 2*numBytes);
+
+		// src = fill with update in the middle; image <- src; dst[0..] <- src; dst[numBytes..] <- image
+		vkd.cmdFillBuffer(*cmdBuffer, *srcBuffer, 0u, VK_WHOLE_SIZE, fillValue);
+		vkd.cmdUpdateBuffer(*cmdBuffer, *srcBuffer, 8u, sizeof(update), (const deUint32*)update);
+		vkd.cmdCopyBufferToImage(*cmdBuffer, *srcBuffer, *image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1u, &toImage);
+		vkd.cmdCopyBuffer(*cmdBuffer, *srcBuffer, *dstBuffer, 1u, &bufCopy);
+		vkd.cmdCopyImageToBuffer(*cmdBuffer, *image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, *dstBuffer, 1u, &fromImage);
+		vkd.cmdClearColorImage(*cmdBuffer, *clearImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &clearValue, 1u, &range);
+
+		VK_CHECK(vkd.endCommandBuffer(*cmdBuffer));
+		submitCommands(vkd, device.getQueue(), *cmdBuffer);
+
+		{
+			const deUint8* const	src		= (const deUint8*)srcMem->getHostPtr();
+			const deUint8* const	dst		= (const deUint8*)dstMem->getHostPtr();
+			const deUint8* const	clear	= (const deUint8*)clearMem->getHostPtr();
+
+			for (int byteNdx = 0; byteNdx < numBytes; byteNdx++)
+			{
+				const deUint8	expected	= byteNdx >= 8 && byteNdx < 12 ? update[byteNdx-8] : (deUint8)(byteNdx % 4 + 1);
+
+				TCU_CHECK(src[byteNdx] == expected);
+				TCU_CHECK(dst[byteNdx] == expected);
+				TCU_CHECK(dst[numBytes + byteNdx] == expected);
+				TCU_CHECK(clear[byteNdx] == (byteNdx % 4 == 0 ? 7 : byteNdx % 4 == 3 ? 255 : 0));
+			}
+		}
+	}
+}
+
+void nullDriverUnsupportedFormatTest (void)
+{
+	const NullDevice				device;
+	const DeviceInterface&			vkd			= device.getDeviceInterface();
+	const VkDevice					dev			= device.getDevice();
+	const Unique<VkImage>			image		(createTransferImage(vkd, dev, VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK, 16u, 8u));
+
+	// Compressed images are laid out in rows of 4x4 blocks of 8 bytes
+	{
+		const VkImageSubresource	subresource	= { VK_IMAGE_ASPECT_COLOR_BIT, 0u, 0u };
+		VkSubresourceLayout			layout;
+
+		vkd.getImageSubresourceLayout(dev, *image, &subresource, &layout);
+
+		TCU_CHECK(layout.size == 64u);
+		TCU_CHECK(layout.rowPitch == 32u);
+		TCU_CHECK(layout.depthPitch == 64u);
+	}
+
+	// Blit features are only reported for formats transfer commands can access
+	{
+		const InstanceInterface&	vki					= device.getInstanceInterface();
+		const VkPhysicalDevice		physicalDevice		= device.getPhysicalDevice();
+		const VkFormatFeatureFlags	blitFeatures		= VK_FORMAT_FEATURE_BLIT_SRC_BIT|VK_FORMAT_FEATURE_BLIT_DST_BIT;
+		const VkFormatProperties	compressedProps		= getPhysicalDeviceFormatProperties(vki, physicalDevice, VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK);
+		const VkFormatProperties	uncompressedProps	= getPhysicalDeviceFormatProperties(vki, physicalDevice, VK_FORMAT_R8G8B8A8_UNORM);
+
+		TCU_CHECK((compressedProps.linearTilingFeatures & blitFeatures) == 0);
+		TCU_CHECK((compressedProps.optimalTilingFeatures & blitFeatures) == 0);
+		TCU_CHECK((uncompressedProps.optimalTilingFeatures & blitFeatures) == blitFeatures);
+	}
+}
+
+// AllocationCallbackRecorder statistics tests
+
+void allocationStatsSizeClassTest (void)
+{
+	TCU_CHECK(AllocationCallbackStats::getSizeClass(0) == 0);
+	TCU_CHECK(AllocationCallbackStats::getSizeClass(15) == 0);
+	TCU_CHECK(AllocationCallbackStats::getSizeClass(16) == 1);
+	TCU_CHECK(AllocationCallbackStats::getSizeClass(31) == 1);
+	TCU_CHECK(AllocationCallbackStats::getSizeClass(32) == 2);
+	TCU_CHECK(AllocationCallbackStats::getSizeClass(4095) == 8);
+	TCU_CHECK(AllocationCallbackStats::getSizeClass(4096) == 9);
+	TCU_CHECK(AllocationCallbackStats::getSizeClass((1u << 18) - 1u) == AllocationCallbackStats::NUM_SIZE_CLASSES-2);
+	TCU_CHECK(AllocationCallbackStats::getSizeClass(1u << 18) == AllocationCallbackStats::NUM_SIZE_CLASSES-1);
+	TCU_CHECK(AllocationCallbackStats::getSizeClass(~(size_t)0) == AllocationCallbackStats::NUM_SIZE_CLASSES-1);
+}
+
+void allocationStatsLivePeakTest (void)
+{
+	AllocationCallbackRecorder		recorder	(getSystemAllocator(), 16u);
+	const VkAllocationCallbacks*	callbacks	= recorder.getCallbacks();
+	void*							objectMem	= callbacks->pfnAllocation(callbacks->pUserData, 100, 8, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+	void*							deviceMem	= callbacks->pfnAllocation(callbacks->pUserData, 1000, 8, VK_SYSTEM_ALLOCATION_SCOPE_DEVICE);
+
+	TCU_CHECK(objectMem && deviceMem);
+
+	{
+		const AllocationCallbackStats	stats	= recorder.getStats();
+
+		TCU_CHECK(stats.numAllocations == 2);
+		TCU_CHECK(stats.liveBytes == 1100 && stats.peakBytes == 1100);
+		TCU_CHECK(stats.scopes[VK_SYSTEM_ALLOCATION_SCOPE_OBJECT].liveBytes == 100);
+		TCU_CHECK(stats.scopes[VK_SYSTEM_ALLOCATION_SCOPE_DEVICE].liveBytes == 1000);
+	}
+
+	callbacks->pfnFree(callbacks->pUserData, objectMem);
+	deviceMem = callbacks->pfnReallocation(callbacks->pUserData, deviceMem, 2000, 8, VK_SYSTEM_ALLOCATION_SCOPE_DEVICE);
+
+	TCU_CHECK(deviceMem);
+
+	callbacks->pfnInternalAllocation(callbacks->pUserData, 64, VK_INTERNAL_ALLOCATION_TYPE_EXECUTABLE, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+
+	{
+		const AllocationCallbackStats	stats	= recorder.getStats();
+
+		// Peak is reached when the reallocation replaces the 1000-byte block
+		TCU_CHECK(stats.numReallocations == 1 && stats.numFrees == 1);
+		TCU_CHECK(stats.liveBytes == 2000 && stats.peakBytes == 2000);
+		TCU_CHECK(stats.scopes[VK_SYSTEM_ALLOCATION_SCOPE_OBJECT].liveBytes == 0);
+		TCU_CHECK(stats.scopes[VK_SYSTEM_ALLOCATION_SCOPE_OBJECT].peakBytes == 100);
+		TCU_CHECK(stats.scopes[VK_SYSTEM_ALLOCATION_SCOPE_DEVICE].liveBytes == 2000);
+		TCU_CHECK(stats.liveInternalBytes == 64 && stats.peakInternalBytes == 64);
+	}
+
+	callbacks->pfnFree(callbacks->pUserData, deviceMem);
+	callbacks->pfnInternalFree(callbacks->pUserData, 64, VK_INTERNAL_ALLOCATION_TYPE_EXECUTABLE, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+
+	{
+		const AllocationCallbackStats	stats	= recorder.getStats();
+
+		TCU_CHECK(stats.numFrees == 2);
+		TCU_CHECK(stats.liveBytes == 0 && stats.peakBytes == 2000);
+		TCU_CHECK(stats.scopes[VK_SYSTEM_ALLOCATION_SCOPE_DEVICE].liveBytes == 0);
+		TCU_CHECK(stats.scopes[VK_SYSTEM_ALLOCATION_SCOPE_DEVICE].peakBytes == 2000);
+		TCU_CHECK(stats.liveInternalBytes == 0 && stats.peakInternalBytes == 64);
+
+		// 100 bytes: [64, 128), 1000 bytes: [512, 1024), 2000 bytes: [1024, 2048)
+		TCU_CHECK(stats.sizeClassHistogram[3] == 1);
+		TCU_CHECK(stats.sizeClassHistogram[6] == 1);
+		TCU_CHECK(stats.sizeClassHistogram[7] == 1);
+	}
+}
+
+void allocationStatsProfileModeTest (void)
+{
+	AllocationCallbackRecorder		recorder	(getSystemAllocator(), 16u, AllocationCallbackRecorder::MODE_PROFILE);
+	const VkAllocationCallbacks*	callbacks	= recorder.getCallbacks();
+	vector<void*>					allocations;
+
+	// More live allocations than the capacity hint, freed in allocation order
+	for (int allocNdx = 0; allocNdx < 100; ++allocNdx)
+	{
+		allocations.push_back(callbacks->pfnAllocation(callbacks->pUserData, 32, 8, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT));
+		TCU_CHECK(allocations.back());
+	}
+
+	for (size_t allocNdx = 0; allocNdx < allocations.size(); ++allocNdx)
+		callbacks->pfnFree(callbacks->pUserData, allocations[allocNdx]);
+
+	{
+		const AllocationCallbackStats	stats	= recorder.getStats();
+
+		TCU_CHECK(stats.numAllocations == 100 && stats.numFrees == 100);
+		TCU_CHECK(stats.liveBytes == 0 && stats.peakBytes == 3200);
+	}
+
+	TCU_CHECK(recorder.getRecordsBegin() == recorder.getRecordsEnd());
+}
+
+const AllocationCallbackStats::CallCounts* findCallCounts (const AllocationCallbackStats& stats, const char* name)
+{
+	for (int callNdx = 0; callNdx < stats.numTrackedCalls; ++callNdx)
+	{
+		if (stats.calls[callNdx].name && deStringEqual(stats.calls[callNdx].name, name))
+			return &stats.calls[callNdx];
+	}
+
+	return DE_NULL;
+}
+
+void allocationStatsAttributionTest (void)
+{
+	const NullDevice				device;
+	const DeviceCallStatsWrapper	vkd			(device.getDeviceInterface());
+	AllocationCallbackRecorder		recorder	(getSystemAllocator(), 16u);
+	const VkAllocationCallbacks*	callbacks	= recorder.getCallbacks();
+	VkFenceCreateInfo				fenceInfo;
+	VkFence							fence		= (VkFence)0;
+
+	deMemset(&fenceInfo, 0, sizeof(fenceInfo));
+	fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+	VK_CHECK(vkd.createFence(device.getDevice(), &fenceInfo, callbacks, &fence));
+	vkd.destroyFence(device.getDevice(), fence, callbacks);
+
+	TCU_CHECK(CallStats::getCurrentCall() == DE_NULL);
+
+	// Callback outside wrapped calls
+	callbacks->pfnFree(callbacks->pUserData, callbacks->pfnAllocation(callbacks->pUserData, 16, 8, VK_SYSTEM_ALLOCATION_SCOPE_COMMAND));
+
+	{
+		const AllocationCallbackStats				stats		= recorder.getStats();
+		const AllocationCallbackStats::CallCounts*	createCall	= findCallCounts(stats, "vkCreateFence");
+		const AllocationCallbackStats::CallCounts*	destroyCall	= findCallCounts(stats, "vkDestroyFence");
+
+		TCU_CHECK(createCall && destroyCall);
+		TCU_CHECK(createCall->numAllocations == 1 && createCall->numFrees == 0);
+		TCU_CHECK(destroyCall->numAllocations == 0 && destroyCall->numFrees == 1);
+
+		TCU_CHECK(stats.calls[0].name == DE_NULL);
+		TCU_CHECK(stats.calls[0].numAllocations == 1 && stats.calls[0].numFrees == 1);
+		TCU_CHECK(stats.otherCalls.numAllocations == 0);
+	}
+}
+
+} // anonymous
+
 tcu::TestCaseGroup* createVulkanTests (tcu::TestContext& testCtx)
 {
 	de::MovePtr<tcu::TestCaseGroup>	group	(new tcu::TestCaseGroup(testCtx, "vulkan", "Vulkan Framework Tests"));
 
 	group->addChild(new SelfCheckCase(testCtx, "image_util", "ImageUtil self-check tests", vk::imageUtilSelfTest));
 
+	group->addChild(new SelfCheckCase(testCtx, "pool_allocator_alignment",		"PoolAllocator sub-allocation alignment",						poolAllocatorAlignmentTest));
+	group->addChild(new SelfCheckCase(testCtx, "pool_allocator_granularity",	"PoolAllocator bufferImageGranularity and nonCoherentAtomSize",	poolAllocatorGranularityTest));
+	group->addChild(new SelfCheckCase(testCtx, "pool_allocator_buddy_merge",	"PoolAllocator merging of freed buddy nodes",					poolAllocatorBuddyMergeTest));
+	group->addChild(new SelfCheckCase(testCtx, "pool_allocator_dedicated",		"PoolAllocator fallback to dedicated allocations",				poolAllocatorDedicatedTest));
+	group->addChild(new SelfCheckCase(testCtx, "null_driver_transfer",			"Null driver transfer command execution",						nullDriverTransferTest));
+	group->addChild(new SelfCheckCase(testCtx, "null_driver_unsupported_format",	"Null driver compressed image layout and unsupported formats",	nullDriverUnsupportedFormatTest));
+	group->addChild(new SelfCheckCase(testCtx, "allocation_stats_size_class",		"AllocationCallbackStats size classes",							allocationStatsSizeClassTest));
+	group->addChild(new SelfCheckCase(testCtx, "allocation_stats_live_peak",		"AllocationCallbackRecorder live and peak byte accounting",		allocationStatsLivePeakTest));
+	group->addChild(new SelfCheckCase(testCtx, "allocation_stats_profile_mode",		"AllocationCallbackRecorder statistics without callback records",	allocationStatsProfileModeTest));
+	group->addChild(new SelfCheckCase(testCtx, "allocation_stats_attribution",		"AllocationCallbackRecorder attribution to wrapped entry points",	allocationStatsAttributionTest));
+
 	return group.release();
 }
 
@@ -0,0 +1,130 @@
+# -*- coding: utf-8 -*-
+
+#-------------------------------------------------------------------------
+# drawElements Quality Program utilities
+# --------------------------------------
+#
+# Copyright 2015 The Android Open Source Project
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+#-------------------------------------------------------------------------
+
+# Builds packed resource archive readable by tcu::PackedArchive.
+# See framework/common/tcuPackedArchive.cpp for format description.
+
+import os
+import sys
+import struct
+import argparse
+
+ARCHIVE_MAGIC	= b"dEPA"
+ARCHIVE_VERSION	= 1
+DATA_ALIGNMENT	= 16
+
+def readArchive (filename):
+	entries = {}
+
+	with open(filename, "rb") as f:
+		data = f.read()
+
+	if data[0:4] != ARCHIVE_MAGIC:
+		raise Exception("%s is not a packed archive" % filename)
+
+	version, numEntries = struct.unpack_from("<II", data, 4)
+	if version != ARCHIVE_VERSION:
+		raise Exception("%s: unsupported archive version %d" % (filename, version))
+
+	pos = 12
+	for ndx in range(numEntries):
+		nameLen,		= struct.unpack_from("<I", data, pos)
+		name			= data[pos+4:pos+4+nameLen].decode("utf-8")
+		offset, size	= struct.unpack_from("<QI", data, pos+4+nameLen)
+		pos				+= 4 + nameLen + 12
+
+		entries[name] = data[offset:offset+size]
+
+	return entries
+
+def readDir (srcDir, dstPrefix):
+	entries = {}
+
+	for root, dirs, files in os.walk(srcDir):
+		dirs.sort()
+		for filename in files:
+			srcPath	= os.path.join(root, filename)
+			relPath	= os.path.relpath(srcPath, srcDir).replace(os.sep, "/")
+			name	= dstPrefix.rstrip("/") + "/" + relPath if dstPrefix else relPath
+
+			with open(srcPath, "rb") as f:
+				entries[name] = f.read()
+
+	return entries
+
+def align (value, alignment):
+	return (value + alignment - 1) // alignment * alignment
+
+def writeArchive (filename, entries):
+	names		= sorted(entries.keys())
+	encNames	= [name.encode("utf-8") for name in names]
+	indexSize	= 12 + sum([4 + len(n) + 12 for n in encNames])
+	offsets		= []
+	offset		= align(indexSize, DATA_ALIGNMENT)
+
+	for name in names:
+		offsets.append(offset)
+		offset = align(offset + len(entries[name]), DATA_ALIGNMENT)
+
+	tmpFilename = filename + ".tmp"
+
+	with open(tmpFilename, "wb") as f:
+		f.write(ARCHIVE_MAGIC)
+		f.write(struct.pack("<II", ARCHIVE_VERSION, len(names)))
+
+		for encName, name, entryOffset in zip(encNames, names, offsets):
+			f.write(struct.pack("<I", len(encName)))
+			f.write(encName)
+			f.write(struct.pack("<QI", entryOffset, len(entries[name])))
+
+		for name, entryOffset in zip(names, offsets):
+			f.write(b"\0" * (entryOffset - f.tell()))
+			f.write(entries[name])
+
+	# Write via temporary file so that failed build doesn't leave partial archive behind
+	if os.path.exists(filename):
+		os.remove(filename)
+	os.rename(tmpFilename, filename)
+
+def parseArgs ():
+	parser = argparse.ArgumentParser(description = "Build packed resource archive")
+	parser.add_argument("--append",
+						dest="append",
+						action="store_true",
+						help="Add files to existing archive instead of creating new one")
+	parser.add_argument("archive",
+						help="Archive file")
+	parser.add_argument("srcDir",
+						help="Source directory")
+	parser.add_argument("dstPrefix",
+						help="Resource name prefix for files in source directory")
+	return parser.parse_args()
+
+if __name__ == "__main__":
+	args	= parseArgs()
+	entries	= {}
+
+	if args.append and os.path.exists(args.archive):
+		entries = readArchive(args.archive)
+
+	entries.update(readDir(args.srcDir, args.dstPrefix))
+	writeArchive(args.archive, entries)
@@ -0,0 +1,115 @@
+# -*- coding: utf-8 -*-
+
+#-------------------------------------------------------------------------
+# drawElements Quality Program utilities
+# --------------------------------------
+#
+# Copyright 2015 The Android Open Source Project
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+#-------------------------------------------------------------------------
+
+# Converts binary call trace written by tcu::CallTraceBuffer::writeBinary()
+# to text. See framework/common/tcuCallTrace.cpp for format description.
+
+import sys
+import struct
+import argparse
+
+CALL_TRACE_MAGIC	= b"dECT"
+CALL_TRACE_VERSION	= 1
+
+class Reader:
+	def __init__ (self, data):
+		self.data	= data
+		self.pos	= 0
+
+	def read (self, size):
+		if self.pos + size > len(self.data):
+			raise Exception("Unexpected end of trace")
+		value = self.data[self.pos:self.pos+size]
+		self.pos += size
+		return value
+
+	def readUint32 (self):
+		return struct.unpack("<I", self.read(4))[0]
+
+	def readUint64 (self):
+		return struct.unpack("<Q", self.read(8))[0]
+
+	def readString (self):
+		return self.read(self.readUint32()).decode("utf-8")
+
+def formatArg (argType, value):
+	if argType == "i":
+		return str(struct.unpack("<q", struct.pack("<Q", value))[0])
+	elif argType == "u":
+		return str(value)
+	elif argType == "f":
+		return repr(struct.unpack("<f", struct.pack("<I", value & 0xffffffff))[0])
+	elif argType == "d":
+		return repr(struct.unpack("<d", struct.pack("<Q", value))[0])
+	else:
+		return "0x%x" % value
+
+def convertTrace (data, out):
+	reader = Reader(data)
+
+	if reader.read(4) != CALL_TRACE_MAGIC:
+		raise Exception("Not a call trace")
+
+	version = reader.readUint32()
+	if version != CALL_TRACE_VERSION:
+		raise Exception("Unsupported call trace version %d" % version)
+
+	apiName			= reader.readString()
+	numFunctions	= reader.readUint32()
+	functions		= []
+
+	for ndx in range(numFunctions):
+		name		= reader.readString()
+		argTypes	= reader.readString()
+		functions.append((name, argTypes))
+
+	numCalls		= reader.readUint32()
+	firstTimestamp	= None
+
+	out.write("%s call trace, %d calls\n" % (apiName, numCalls))
+
+	for callNdx in range(numCalls):
+		functionNdx	= reader.readUint32()
+		timestamp	= reader.readUint64()
+
+		if functionNdx >= len(functions):
+			raise Exception("Invalid function index %d" % functionNdx)
+
+		name, argTypes	= functions[functionNdx]
+		args			= [formatArg(argType, reader.readUint64()) for argType in argTypes]
+
+		if firstTimestamp == None:
+			firstTimestamp = timestamp
+
+		out.write("+%dus %s(%s)\n" % (timestamp - firstTimestamp, name, ", ".join(args)))
+
+def parseArgs ():
+	parser = argparse.ArgumentParser(description = "Convert binary call trace to text")
+	parser.add_argument("trace",
+						help="Binary call trace file")
+	return parser.parse_args()
+
+if __name__ == "__main__":
+	args = parseArgs()
+
+	with open(args.trace, "rb") as f:
+		convertTrace(f.read(), sys.stdout)
@@ -87,7 +87,33 @@ def getVarDefaultPrint (type, varName):
 	else:
 		return varName
 
-def commandLogWrapperMemberDef (command):
+def getTraceArgType (type):
+	baseType = re.sub(r'^const +', '', type).strip()
+	if baseType == 'EGLenum':
+		return "x"
+	elif baseType in ('EGLint', 'EGLAttrib'):
+		return "i"
+	elif baseType in ('EGLBoolean', 'EGLTime', 'EGLTimeKHR'):
+		return "u"
+	else:
+		# Pointers, handles and native types
+		return "p"
+
+def commandTraceFunctionEntry (command):
+	return "{ \"%s\",\t\"%s\"\t}," % (command.name, "".join(getTraceArgType(p.type) for p in command.params))
+
+def genTraceRecord (commandNdx, command):
+	if len(command.params) == 0:
+		return "\tif (m_trace)\n\t\tm_trace->recordCall(%d, 0);\n" % commandNdx
+
+	src = "\tif (m_trace)\n\t{\n"
+	src += "\t\tdeUint64* const args = m_trace->recordCall(%d, %d);\n" % (commandNdx, len(command.params))
+	for paramNdx, param in enumerate(command.params):
+		src += "\t\targs[%d] = tcu::callTraceArg(%s);\n" % (paramNdx, param.name)
+	src += "\t}\n"
+	return src
+
+def commandLogWrapperMemberDef (commandNdx, command):
 	src = ""
 	try:
 		logSpec = CALL_LOG_SPECS[command.name]
@@ -113,6 +139,8 @@ def commandLogWrapperMemberDef (command):
 	src += "\tif (m_enableLog)\n"
 	src += "\t\tm_log << TestLog::Message << %s;\n" % " << ".join(callPrintItems)
 
+	src += genTraceRecord(commandNdx, command)
+
 	callStr = "m_egl.%s(%s)" % (getFunctionMemberName(command.name), ", ".join([p.name for p in command.params]))
 
 	isVoid	= command.type == 'void'
@@ -146,4 +174,5 @@ def commandLogWrapperMemberDef (command):
 
 def gen (iface):
 	genCommandList(iface, commandLogWrapperMemberDecl, EGL_DIR, "egluCallLogWrapperApi.inl", True)
-	genCommandList(iface, commandLogWrapperMemberDef, EGL_DIR, "egluCallLogWrapper.inl", False)
+	genCommandList(iface, lambda command: commandLogWrapperMemberDef(iface.commands.index(command), command), EGL_DIR, "egluCallLogWrapper.inl", False)
+	genCommandList(iface, commandTraceFunctionEntry, EGL_DIR, "egluCallLogWrapperTrace.inl", True)
@@ -380,7 +380,36 @@ def getVarDefaultPrint (type, varName):
 	else:
 		return varName
 
-def commandLogWrapperMemberDef (command):
+def getTraceArgType (type):
+	baseType = re.sub(r'^const +', '', type).strip()
+	if '*' in baseType or baseType in ("GLsync", "GLDEBUGPROC", "GLeglImageOES"):
+		return "p"
+	elif baseType in ("GLenum", "GLbitfield"):
+		return "x"
+	elif baseType in ("GLfloat", "GLclampf"):
+		return "f"
+	elif baseType in ("GLdouble", "GLclampd"):
+		return "d"
+	elif baseType in ("GLbyte", "GLshort", "GLint", "GLsizei", "GLfixed", "GLintptr", "GLsizeiptr", "GLint64"):
+		return "i"
+	else:
+		return "u"
+
+def commandTraceFunctionEntry (command):
+	return "{ \"%s\",\t\"%s\"\t}," % (command.name, "".join(getTraceArgType(p.type) for p in command.params))
+
+def genTraceRecord (commandNdx, command):
+	if len(command.params) == 0:
+		return "\tif (m_trace)\n\t\tm_trace->recordCall(%d, 0);\n" % commandNdx
+
+	src = "\tif (m_trace)\n\t{\n"
+	src += "\t\tdeUint64* const args = m_trace->recordCall(%d, %d);\n" % (commandNdx, len(command.params))
+	for paramNdx, param in enumerate(command.params):
+		src += "\t\targs[%d] = tcu::callTraceArg(%s);\n" % (paramNdx, param.name)
+	src += "\t}\n"
+	return src
+
+def commandLogWrapperMemberDef (commandNdx, command):
 	src = ""
 	try:
 		logSpec = CALL_LOG_SPECS[command.name]
@@ -406,6 +435,8 @@ def commandLogWrapperMemberDef (command):
 	src += "\tif (m_enableLog)\n"
 	src += "\t\tm_log << TestLog::Message << %s;\n" % " << ".join(callPrintItems)
 
+	src += genTraceRecord(commandNdx, command)
+
 	callStr = "m_gl.%s(%s)" % (getFunctionMemberName(command.name), ", ".join([p.name for p in command.params]))
 
 	isVoid	= command.type == 'void'
@@ -451,7 +482,8 @@ def commandLogWrapperMemberDef (command):
 
 def genCallLogWrapper (iface):
 	genCommandList(iface, commandLogWrapperMemberDecl, OPENGL_DIR, "gluCallLogWrapperApi.inl", True)
-	genCommandList(iface, commandLogWrapperMemberDef, OPENGL_DIR, "gluCallLogWrapper.inl", False)
+	genCommandList(iface, lambda command: commandLogWrapperMemberDef(iface.commands.index(command), command), OPENGL_DIR, "gluCallLogWrapper.inl", False)
+	genCommandList(iface, commandTraceFunctionEntry, OPENGL_DIR, "gluCallLogWrapperTrace.inl", True)
 
 if __name__ == "__main__":
 	genCallLogWrapper(getHybridInterface())